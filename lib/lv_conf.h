@@ -60,10 +60,12 @@
 #endif
 
 #else       /*LV_MEM_CUSTOM*/
-#define LV_MEM_CUSTOM_INCLUDE <stdlib.h>   /*Header for the dynamic memory function*/
-#define LV_MEM_CUSTOM_ALLOC   malloc
-#define LV_MEM_CUSTOM_FREE    free
-#define LV_MEM_CUSTOM_REALLOC realloc
+#define LV_MEM_CUSTOM_INCLUDE "system/pda_mem.h"   /*Header for the dynamic memory function*/
+#define LV_MEM_CUSTOM_ALLOC   pda_mem_alloc      /*Arena-aware allocator with statistics, see src/system/pda_mem.h*/
+#define LV_MEM_CUSTOM_FREE    pda_mem_free
+#define LV_MEM_CUSTOM_REALLOC pda_mem_realloc
+#define LV_MEM_CUSTOM_TLSF    1                  /*pda_mem keeps small allocations in a TLSF pool in internal SRAM*/
+#define LV_MEM_CUSTOM_TLSF_POOL_SIZE (64U * 1024U)
 #endif     /*LV_MEM_CUSTOM*/
 
 /*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
@@ -83,6 +85,11 @@
 /*Input device read period in milliseconds*/
 #define LV_INDEV_DEF_READ_PERIOD 30     /*[ms]*/
 
+/*Called instead of invalidating a scrolled object. Lets the display driver scroll eligible containers
+ *in the ST7789's memory (VSCRDEF/VSCSAD) and redraw only the uncovered strip, see src/system/tft_scroll.h*/
+#define LV_SCROLL_CUSTOM_INCLUDE "system/tft_scroll.h"
+#define LV_SCROLL_CUSTOM_INVALIDATE tft_scroll_lvgl
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #define LV_TICK_CUSTOM 1
@@ -117,7 +124,12 @@
 * The circumference of 1/4 circle are saved for anti-aliasing
 * radius * 4 bytes are used per circle (the most often used radiuses are saved)
 * 0: to disable caching */
-#define LV_CIRCLE_CACHE_SIZE 4
+#define LV_CIRCLE_CACHE_SIZE 16
+
+/*Max. memory of the circles kept between refreshes in bytes (radius * 6 + 6 bytes per circle)
+ *Without it every refresh calculates the circles of the rounded corners (radius 8/12) and round buttons again
+ *0: free the circles after every refresh*/
+#define LV_CIRCLE_CACHE_BUDGET (4U * 1024U)
 #endif /*LV_DRAW_COMPLEX*/
 
 /*Default image cache size. Image caching keeps the images opened.
@@ -125,7 +137,20 @@
  *With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
  *However the opened images might consume additional RAM.
  *0: to disable caching*/
-#define LV_IMG_CACHE_DEF_SIZE   0
+#define LV_IMG_CACHE_DEF_SIZE   24
+
+/*Limit of RAM held by decoded images in the image cache in bytes. 0: no limit
+ *Images drawn directly from a C array don't count; icons decoded from the asset pack do*/
+#define LV_IMG_CACHE_BUDGET     (512U * 1024U)
+
+/*Size of the glyph cache in bytes. 0: disable caching
+ *Keeps the glyph descriptors and the 8 bit opacity masks of recently drawn letters (in PSRAM),
+ *so compressed fonts are not decompressed and converted on every refresh*/
+#define LV_GLYPH_CACHE_SIZE     (64U * 1024U)
+
+/*1: Allow keeping the rendered pixels of static widget subtrees (see lv_obj_set_render_cache())
+ *Each cached object keeps an RGB565 copy of its area (in PSRAM) and is blitted from it until invalidated*/
+#define LV_USE_RENDER_CACHE     1
 
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
@@ -153,6 +178,10 @@
  *Only used if software rotation is enabled in the display driver.*/
 #define LV_DISP_ROT_MAX_BUF (10*1024)
 
+/*1: Blend RGB565 pixels two at a time in 32 bit words (fills and images with opacity, e.g. the modal overlays)
+ *The result is the same as with the pixel by pixel code. Only used with LV_COLOR_DEPTH 16*/
+#define LV_DRAW_SW_WORD_BLEND 1
+
 /*-------------
  * GPU
  *-----------*/
@@ -213,6 +242,11 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 *0: User need to register a callback with `lv_log_register_print_cb()`*/
 #define LV_LOG_PRINTF 1
 
+/*Send the logs to the asynchronous ring-buffered logger of src/system/pda_log.h
+ *instead of formatting and printing them in the caller (LV_LOG_PRINTF is then unused)*/
+#define LV_LOG_CUSTOM_INCLUDE "system/pda_log.h"
+#define LV_LOG_CUSTOM_ADD pda_log_lvgl
+
 /*Enable/disable LV_LOG_TRACE in modules that produces a huge number of logs*/
 #define LV_LOG_TRACE_MEM        1
 #define LV_LOG_TRACE_TIMER      1
@@ -225,6 +259,14 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 
 #endif  /*LV_USE_LOG*/
 
+/*Binary trace events of src/system/pda_trace.h (enabled with -DPDA_TRACE=1 in the build flags)
+ *Marks every lv_timer_handler() call as a begin/end pair in the trace*/
+#if defined(PDA_TRACE) && PDA_TRACE
+#define LV_TIMER_TRACE_INCLUDE "system/pda_trace.h"
+#define LV_TIMER_TRACE_BEGIN() pda_trace_emit(PDA_TRACE_ID_LV_TIMER, PDA_TRACE_BEGIN_EVENT, 0)
+#define LV_TIMER_TRACE_END()   pda_trace_emit(PDA_TRACE_ID_LV_TIMER, PDA_TRACE_END_EVENT, 0)
+#endif
+
 /*-------------
  * Asserts
  *-----------*/
@@ -327,22 +369,24 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
  *===================*/
 
 /*Montserrat fonts with ASCII range and some symbols using bpp = 4
- *https://fonts.google.com/specimen/Montserrat*/
+ *https://fonts.google.com/specimen/Montserrat
+ *The sizes used by the apps (12, 14, 16, 18, 20, 28, 36) are generated by tools/fonts/gen_fonts.py (run by hand)
+ *into src/fonts/generated (subsetted, with Latin-1; 28 and 36 compressed) and declared in LV_FONT_CUSTOM_DECLARE below*/
 #define LV_FONT_MONTSERRAT_8  0
 #define LV_FONT_MONTSERRAT_10 0
-#define LV_FONT_MONTSERRAT_12 1
-#define LV_FONT_MONTSERRAT_14 1
-#define LV_FONT_MONTSERRAT_16 1
-#define LV_FONT_MONTSERRAT_18 1
-#define LV_FONT_MONTSERRAT_20 1
+#define LV_FONT_MONTSERRAT_12 0
+#define LV_FONT_MONTSERRAT_14 0
+#define LV_FONT_MONTSERRAT_16 0
+#define LV_FONT_MONTSERRAT_18 0
+#define LV_FONT_MONTSERRAT_20 0
 #define LV_FONT_MONTSERRAT_22 0
 #define LV_FONT_MONTSERRAT_24 0
 #define LV_FONT_MONTSERRAT_26 0
-#define LV_FONT_MONTSERRAT_28 1
+#define LV_FONT_MONTSERRAT_28 0
 #define LV_FONT_MONTSERRAT_30 0
 #define LV_FONT_MONTSERRAT_32 0
 #define LV_FONT_MONTSERRAT_34 0
-#define LV_FONT_MONTSERRAT_36 1
+#define LV_FONT_MONTSERRAT_36 0
 #define LV_FONT_MONTSERRAT_38 0
 #define LV_FONT_MONTSERRAT_40 0
 #define LV_FONT_MONTSERRAT_42 0
@@ -363,7 +407,10 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 /*Optionally declare custom fonts here.
  *You can use these fonts as default font too and they will be available globally.
  *E.g. #define LV_FONT_CUSTOM_DECLARE   LV_FONT_DECLARE(my_font_1) LV_FONT_DECLARE(my_font_2)*/
-#define LV_FONT_CUSTOM_DECLARE
+#define LV_FONT_CUSTOM_DECLARE  LV_FONT_DECLARE(lv_font_montserrat_12) LV_FONT_DECLARE(lv_font_montserrat_14) \
+                                LV_FONT_DECLARE(lv_font_montserrat_16) LV_FONT_DECLARE(lv_font_montserrat_18) \
+                                LV_FONT_DECLARE(lv_font_montserrat_20) LV_FONT_DECLARE(lv_font_montserrat_28) \
+                                LV_FONT_DECLARE(lv_font_montserrat_36)
 
 /*Always set a default font*/
 #define LV_FONT_DEFAULT &lv_font_montserrat_14
@@ -374,7 +421,7 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 #define LV_FONT_FMT_TXT_LARGE 0
 
 /*Enables/disables support for compressed fonts.*/
-#define LV_USE_FONT_COMPRESSED 0
+#define LV_USE_FONT_COMPRESSED 1
 
 /*Enable subpixel rendering*/
 #define LV_USE_FONT_SUBPX 0
@@ -413,6 +460,11 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 /*The control character to use for signalling text recoloring.*/
 #define LV_TXT_COLOR_CMD "#"
 
+/*Number of texts whose line breaks are cached (see lv_txt_layout.h). 0: disable caching
+ *Labels find where the lines of their text start by the text (hash, then compared), font and width
+ *instead of breaking it into lines again on every layout and draw pass*/
+#define LV_TXT_LAYOUT_CACHE_CNT 16
+
 /*Support bidirectional texts. Allows mixing Left-to-Right and Right-to-Left texts.
  *The direction will be processed according to the Unicode Bidirectional Algorithm:
  *https://www.w3.org/International/articles/inline-bidi-markup/uba-basics*/
@@ -652,7 +704,7 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
  *----------*/
 
 /*1: Enable API to take snapshot for object*/
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1
 
 /*1: Enable Monkey test*/
 #define LV_USE_MONKEY   0
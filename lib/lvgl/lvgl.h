@@ -29,6 +29,7 @@ extern "C" {
 #include "src/misc/lv_async.h"
 #include "src/misc/lv_anim_timeline.h"
 #include "src/misc/lv_printf.h"
+#include "src/misc/lv_txt_layout.h"
 
 #include "src/hal/lv_hal.h"
 
@@ -6,6 +6,7 @@ CSRCS += lv_obj.c
 CSRCS += lv_obj_class.c
 CSRCS += lv_obj_draw.c
 CSRCS += lv_obj_pos.c
+CSRCS += lv_obj_render_cache.c
 CSRCS += lv_obj_scroll.c
 CSRCS += lv_obj_style.c
 CSRCS += lv_obj_style_gen.c
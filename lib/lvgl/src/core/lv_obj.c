@@ -143,6 +143,9 @@ void lv_init(void)
 
     /*Initialize the screen refresh system*/
     _lv_refr_init();
+#if LV_USE_RENDER_CACHE
+    _lv_ll_init(&LV_GC_ROOT(_lv_render_cache_ll), sizeof(lv_obj_render_cache_t));
+#endif
 
     _lv_img_decoder_init();
 #if LV_IMG_CACHE_DEF_SIZE
@@ -454,13 +457,18 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     _lv_event_mark_deleted(obj);
 
     /*Remove all style*/
+    bool style_refr_en = lv_obj_is_style_refresh_enabled();
     lv_obj_enable_style_refresh(false); /*No need to refresh the style because the object will be deleted*/
     lv_obj_remove_style_all(obj);
-    lv_obj_enable_style_refresh(true);
+    lv_obj_enable_style_refresh(style_refr_en);
 
     /*Remove the animations from this object*/
     lv_anim_del(obj, NULL);
 
+#if LV_USE_RENDER_CACHE
+    if(obj->render_cached) _lv_obj_render_cache_remove(obj);
+#endif
+
     /*Delete from the group*/
     lv_group_t * group = lv_obj_get_group(obj);
     if(group) lv_group_remove_obj(obj);
@@ -138,6 +138,7 @@ typedef enum {
 #include "lv_obj_scroll.h"
 #include "lv_obj_style.h"
 #include "lv_obj_draw.h"
+#include "lv_obj_render_cache.h"
 #include "lv_obj_class.h"
 #include "lv_event.h"
 #include "lv_group.h"
@@ -189,6 +190,9 @@ typedef struct _lv_obj_t {
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
     uint16_t being_deleted   : 1;
+#if LV_USE_RENDER_CACHE
+    uint16_t render_cached   : 1;
+#endif
 } lv_obj_t;
 
 /**********************
@@ -104,12 +104,14 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
 void lv_obj_class_init_obj(lv_obj_t * obj)
 {
     lv_obj_mark_layout_as_dirty(obj);
+    /*Keep the caller's setting: if refreshing is disabled (bulk update) the whole tree is refreshed later*/
+    bool style_refr_en = lv_obj_is_style_refresh_enabled();
     lv_obj_enable_style_refresh(false);
 
     lv_theme_apply(obj);
     lv_obj_construct(obj);
 
-    lv_obj_enable_style_refresh(true);
+    lv_obj_enable_style_refresh(style_refr_en);
     lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
 
     lv_obj_refresh_self_size(obj);
@@ -835,6 +835,11 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+#if LV_USE_RENDER_CACHE
+    /*Also when the pixels are not refreshed now (inactive screen, disabled invalidation)*/
+    _lv_obj_render_cache_invalidate_area(obj, area);
+#endif
+
     lv_disp_t * disp   = lv_obj_get_disp(obj);
     if(!lv_disp_is_invalidation_enabled(disp)) return;
 
@@ -0,0 +1,285 @@
+/**
+ * @file lv_obj_render_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj.h"
+#include "lv_refr.h"
+#include "lv_disp.h"
+#include "../misc/lv_gc.h"
+
+#if LV_USE_RENDER_CACHE
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MY_CLASS &lv_obj_class
+#define cache_ll_p &(LV_GC_ROOT(_lv_render_cache_ll))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_obj_render_cache_t * find_cache(const lv_obj_t * obj);
+static void get_cache_area(lv_obj_t * obj, lv_area_t * area);
+static void get_transformed_area(const lv_obj_t * obj, lv_area_t * area);
+static void invalidate_layer(lv_obj_render_cache_t * cache);
+static lv_res_t render_layer(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, lv_obj_render_cache_t * cache,
+                             const lv_area_t * area);
+static void copy_area(lv_color_t * dest_buf, const lv_area_t * dest_area, const lv_color_t * src_buf,
+                      const lv_area_t * src_area, const lv_area_t * area);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_obj_set_render_cache(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    if(en) {
+        if(obj->render_cached) return;
+        lv_obj_render_cache_t * cache = _lv_ll_ins_tail(cache_ll_p);
+        LV_ASSERT_MALLOC(cache);
+        if(cache == NULL) return;
+        lv_memset_00(cache, sizeof(lv_obj_render_cache_t));
+        cache->obj = obj;
+        obj->render_cached = 1;
+    }
+    else {
+        _lv_obj_render_cache_remove(obj);
+    }
+}
+
+const lv_obj_render_cache_t * lv_obj_get_render_cache(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    if(!obj->render_cached) return NULL;
+    return find_cache(obj);
+}
+
+const lv_obj_render_cache_t * lv_obj_render_cache_get_next(const lv_obj_render_cache_t * prev)
+{
+    if(prev == NULL) return _lv_ll_get_head(cache_ll_p);
+    return _lv_ll_get_next(cache_ll_p, prev);
+}
+
+uint32_t lv_obj_render_cache_get_used_bytes(void)
+{
+    uint32_t bytes = 0;
+    lv_obj_render_cache_t * cache;
+    _LV_LL_READ(cache_ll_p, cache) {
+        if(cache->buf) bytes += lv_area_get_size(&cache->area) * sizeof(lv_color_t);
+    }
+    return bytes;
+}
+
+void lv_obj_render_cache_reset_stats(void)
+{
+    lv_obj_render_cache_t * cache;
+    _LV_LL_READ(cache_ll_p, cache) {
+        cache->hits = 0;
+        cache->misses = 0;
+    }
+}
+
+bool _lv_obj_render_cache_draw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
+{
+    lv_obj_render_cache_t * cache = find_cache(obj);
+    if(cache == NULL) return false;
+
+    /*Children drawn out of the object can't be cut to the layer*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return false;
+
+    /*The layer is copied row by row, so the target must be an opaque lv_color_t buffer*/
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    if(disp == NULL || disp->driver->screen_transp || disp->driver->set_px_cb) return false;
+
+    lv_area_t area;
+    get_cache_area(obj, &area);
+
+    lv_area_t blit_area;
+    if(!_lv_area_intersect(&blit_area, draw_ctx->clip_area, &area)) return true;
+    if(!_lv_area_intersect(&blit_area, &blit_area, draw_ctx->buf_area)) return true;
+
+    lv_draw_wait_for_finish(draw_ctx);
+
+    if(cache->valid && _lv_area_is_equal(&cache->area, &area)) {
+        cache->hits++;
+    }
+    else {
+        cache->misses++;
+        cache->valid = 0;
+
+        /*The layer starts with the pixels below the object, so they all need to be drawn already*/
+        if(!_lv_area_is_in(&area, draw_ctx->clip_area, 0)) return false;
+        if(!_lv_area_is_in(&area, draw_ctx->buf_area, 0)) return false;
+
+        if(render_layer(draw_ctx, obj, cache, &area) != LV_RES_OK) return false;
+    }
+
+    copy_area(draw_ctx->buf, draw_ctx->buf_area, cache->buf, &cache->area, &blit_area);
+    return true;
+}
+
+void _lv_obj_render_cache_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
+{
+    if(_lv_ll_get_head(cache_ll_p) == NULL) return;
+
+    /*Only the part visible through the object and its parents can change pixels*/
+    lv_area_t area_tmp = *area;
+    if(!lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        lv_area_t obj_coords = obj->coords;
+        lv_coord_t ext_size = _lv_obj_get_ext_draw_size(obj);
+        lv_area_increase(&obj_coords, ext_size, ext_size);
+        if(!_lv_area_intersect(&area_tmp, &area_tmp, &obj_coords)) return;
+    }
+    get_transformed_area(obj, &area_tmp);
+
+    lv_obj_t * par = lv_obj_get_parent(obj);
+    while(par) {
+        if(!lv_obj_has_flag(par, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+            lv_area_t par_area = par->coords;
+            get_transformed_area(par, &par_area);
+            if(!_lv_area_intersect(&area_tmp, &area_tmp, &par_area)) return;
+        }
+        par = lv_obj_get_parent(par);
+    }
+
+    /*Layers on other screens (or below the top and system layers) don't see this change*/
+    lv_obj_t * scr = lv_obj_get_screen(obj);
+    lv_obj_render_cache_t * cache;
+    _LV_LL_READ(cache_ll_p, cache) {
+        if(!cache->valid) continue;
+        if(!_lv_area_is_on(&area_tmp, &cache->area)) continue;
+        if(lv_obj_get_screen(cache->obj) != scr) continue;
+        cache->valid = 0;
+        invalidate_layer(cache);
+    }
+}
+
+void _lv_obj_render_cache_remove(lv_obj_t * obj)
+{
+    lv_obj_render_cache_t * cache = find_cache(obj);
+    if(cache) {
+        lv_mem_free(cache->buf);
+        _lv_ll_remove(cache_ll_p, cache);
+        lv_mem_free(cache);
+    }
+    obj->render_cached = 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_obj_render_cache_t * find_cache(const lv_obj_t * obj)
+{
+    lv_obj_render_cache_t * cache;
+    _LV_LL_READ(cache_ll_p, cache) {
+        if(cache->obj == obj) return cache;
+    }
+    return NULL;
+}
+
+static void get_cache_area(lv_obj_t * obj, lv_area_t * area)
+{
+    lv_obj_get_coords(obj, area);
+    lv_coord_t ext_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(area, ext_size, ext_size);
+}
+
+/**
+ * Like `lv_obj_get_transformed_area()` but without its 5 px margin if neither the object nor its parents
+ * are transformed. The margin would touch the layers of the neighbors.
+ */
+static void get_transformed_area(const lv_obj_t * obj, lv_area_t * area)
+{
+    const lv_obj_t * o;
+    for(o = obj; o; o = lv_obj_get_parent(o)) {
+        if(lv_obj_get_style_transform_angle(o, 0) != 0 ||
+           lv_obj_get_style_transform_zoom(o, 0) != LV_IMG_ZOOM_NONE) {
+            lv_obj_get_transformed_area(obj, area, true, false);
+            return;
+        }
+    }
+}
+
+/**
+ * Refresh the whole cached object after a change in a part of it.
+ * The layer is rebuilt only if the whole object is redrawn, so with partial refresh
+ * only the changed part would be redrawn and the layer would miss in every frame.
+ */
+static void invalidate_layer(lv_obj_render_cache_t * cache)
+{
+    lv_disp_t * disp = lv_obj_get_disp(cache->obj);
+    if(!lv_disp_is_invalidation_enabled(disp)) return;
+
+    lv_area_t area;
+    get_cache_area(cache->obj, &area);
+    if(lv_obj_area_is_visible(cache->obj, &area)) _lv_inv_area(disp, &area);
+}
+
+/**
+ * Render the object and its children into a new opaque layer and keep the layer's buffer.
+ */
+static lv_res_t render_layer(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, lv_obj_render_cache_t * cache,
+                             const lv_area_t * area)
+{
+    lv_draw_layer_ctx_t * layer_ctx = lv_draw_layer_create(draw_ctx, area, 0);
+    if(layer_ctx == NULL) {
+        LV_LOG_WARN("Couldn't create the layer of a cached object");
+        return LV_RES_INV;
+    }
+
+    /*Start from the pixels below the object, as if it was drawn directly*/
+    copy_area(layer_ctx->buf, &layer_ctx->area_full, layer_ctx->original.buf, layer_ctx->original.buf_area, area);
+
+    lv_obj_redraw(draw_ctx, obj);
+    lv_draw_wait_for_finish(draw_ctx);
+
+    /*Take over the layer's buffer so that destroying the layer doesn't free it*/
+    lv_mem_free(cache->buf);
+    cache->buf = layer_ctx->buf;
+    cache->area = *area;
+    cache->valid = 1;
+    layer_ctx->buf = NULL;
+    lv_draw_layer_destroy(draw_ctx, layer_ctx);
+
+    return LV_RES_OK;
+}
+
+static void copy_area(lv_color_t * dest_buf, const lv_area_t * dest_area, const lv_color_t * src_buf,
+                      const lv_area_t * src_area, const lv_area_t * area)
+{
+    lv_coord_t dest_w = lv_area_get_width(dest_area);
+    lv_coord_t src_w = lv_area_get_width(src_area);
+    uint32_t row_bytes = lv_area_get_width(area) * sizeof(lv_color_t);
+
+    dest_buf += (int32_t)(area->y1 - dest_area->y1) * dest_w + (area->x1 - dest_area->x1);
+    src_buf += (int32_t)(area->y1 - src_area->y1) * src_w + (area->x1 - src_area->x1);
+
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(dest_buf, src_buf, row_bytes);
+        dest_buf += dest_w;
+        src_buf += src_w;
+    }
+}
+
+#endif /*LV_USE_RENDER_CACHE*/
@@ -0,0 +1,120 @@
+/**
+ * @file lv_obj_render_cache.h
+ *
+ * Retained layers for static widget subtrees.
+ * A cached object is rendered once (with its children) into an RGB565 layer created with the
+ * `lv_draw_layer` machinery. The layer includes everything drawn below the object too, so later
+ * refreshes only copy its rows into the draw buffer. Invalidating any area that overlaps the
+ * layer on the same screen (a child changing, the object moving, the background changing)
+ * drops the layer and it's rendered again on the next refresh.
+ */
+
+#ifndef LV_OBJ_RENDER_CACHE_H
+#define LV_OBJ_RENDER_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "../misc/lv_area.h"
+#include "../misc/lv_color.h"
+#include "../draw/lv_draw.h"
+
+#if LV_USE_RENDER_CACHE
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_obj_t;
+
+typedef struct {
+    struct _lv_obj_t * obj;     /**< The cached object*/
+    lv_color_t * buf;           /**< The rendered pixels of `area`, NULL if not rendered yet*/
+    lv_area_t area;             /**< The area in `buf`: the object's coordinates + its ext. draw size*/
+    uint32_t hits;              /**< Refreshes served by copying `buf`*/
+    uint32_t misses;            /**< Refreshes that drew the subtree (to render `buf` or because it was only partially visible)*/
+    uint8_t valid : 1;          /**< `buf` matches the current look of the area*/
+} lv_obj_render_cache_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Enable or disable the render cache of an object.
+ * Use it on subtrees which rarely change. Objects with transformation, opacity layer or
+ * `LV_OBJ_FLAG_OVERFLOW_VISIBLE` are always drawn normally.
+ * @param obj       pointer to an object
+ * @param en        true: keep the rendered pixels of the object and its children; false: free them
+ */
+void lv_obj_set_render_cache(struct _lv_obj_t * obj, bool en);
+
+/**
+ * Get the render cache of an object.
+ * @param obj       pointer to an object
+ * @return          the cache (with the hit/miss counters) or NULL if it's not enabled
+ */
+const lv_obj_render_cache_t * lv_obj_get_render_cache(const struct _lv_obj_t * obj);
+
+/**
+ * Iterate over the render caches of all objects.
+ * @param prev      the previous cache or NULL to get the first
+ * @return          the next cache or NULL if there are no more
+ */
+const lv_obj_render_cache_t * lv_obj_render_cache_get_next(const lv_obj_render_cache_t * prev);
+
+/**
+ * Get the RAM held by the rendered pixels of all caches.
+ * @return          the size in bytes
+ */
+uint32_t lv_obj_render_cache_get_used_bytes(void);
+
+/**
+ * Zero the hit and miss counters of all caches.
+ */
+void lv_obj_render_cache_reset_stats(void);
+
+/**
+ * Draw a cached object from its layer, rendering the layer first if needed.
+ * Called by the refresh for objects with the render cache enabled.
+ * @param draw_ctx  pointer to the current draw context
+ * @param obj       pointer to a cached object
+ * @return          true: the object and its children are drawn; false: draw them normally
+ */
+bool _lv_obj_render_cache_draw(lv_draw_ctx_t * draw_ctx, struct _lv_obj_t * obj);
+
+/**
+ * Drop the layers overlapped by an area invalidated on an object and invalidate the whole area
+ * of those objects, so the next refresh can render their layers again.
+ * Called by `lv_obj_invalidate_area()` even if invalidation is disabled or the screen is not active.
+ * @param obj       the object being invalidated
+ * @param area      the invalidated area
+ */
+void _lv_obj_render_cache_invalidate_area(const struct _lv_obj_t * obj, const lv_area_t * area);
+
+/**
+ * Free the cache of an object which is being deleted.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_render_cache_remove(struct _lv_obj_t * obj);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_RENDER_CACHE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_RENDER_CACHE_H*/
@@ -12,6 +12,10 @@
 #include "lv_disp.h"
 #include "lv_indev_scroll.h"
 
+#ifdef LV_SCROLL_CUSTOM_INCLUDE
+    #include LV_SCROLL_CUSTOM_INCLUDE
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -420,6 +424,10 @@ lv_res_t _lv_obj_scroll_by_raw(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
     lv_obj_move_children_by(obj, x, y, true);
     lv_res_t res = lv_event_send(obj, LV_EVENT_SCROLL, NULL);
     if(res != LV_RES_OK) return res;
+#ifdef LV_SCROLL_CUSTOM_INVALIDATE
+    /*The display driver may move the pixels already on the screen and invalidate only the uncovered part*/
+    if(LV_SCROLL_CUSTOM_INVALIDATE(obj, x, y)) return LV_RES_OK;
+#endif
     lv_obj_invalidate(obj);
     return LV_RES_OK;
 }
@@ -618,6 +626,10 @@ void lv_obj_get_scrollbar_area(lv_obj_t * obj, lv_area_t * hor_area, lv_area_t *
 
 void lv_obj_scrollbar_invalidate(lv_obj_t * obj)
 {
+    /*Finding the scrollbar area needs the content size (a loop over every child).
+     *Skip it if nothing would be invalidated anyway (e.g. during a bulk update)*/
+    if(!lv_disp_is_invalidation_enabled(lv_obj_get_disp(obj))) return;
+
     lv_area_t hor_area;
     lv_area_t ver_area;
     lv_obj_get_scrollbar_area(obj, &hor_area, &ver_area);
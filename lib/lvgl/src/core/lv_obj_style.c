@@ -47,6 +47,7 @@ static _lv_obj_style_t * get_trans_style(lv_obj_t * obj, uint32_t part);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v);
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
+static void refresh_tree_cache(lv_obj_t * obj);
 static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
 static void trans_anim_cb(void * _tr, int32_t v);
 static void trans_anim_start_cb(lv_anim_t * a);
@@ -220,6 +221,22 @@ void lv_obj_enable_style_refresh(bool en)
     style_refr = en;
 }
 
+bool lv_obj_is_style_refresh_enabled(void)
+{
+    return style_refr;
+}
+
+void lv_obj_refresh_style_tree(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    if(!style_refr) return;
+
+    refresh_tree_cache(obj);
+    /*Sends LV_EVENT_STYLE_CHANGED to the object and its children and marks the layout dirty*/
+    lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
+}
+
 lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     lv_style_value_t value_act;
@@ -705,6 +722,28 @@ static void refresh_children_style(lv_obj_t * obj)
     }
 }
 
+/**
+ * Recursively update the cached layer type and extra draw size of an object and its children.
+ * Used by `lv_obj_refresh_style_tree()` to catch up on styles set while style refresh was disabled.
+ * @param obj pointer to an object
+ */
+static void refresh_tree_cache(lv_obj_t * obj)
+{
+    lv_layer_type_t layer_type = calculate_layer_type(obj);
+    if(obj->spec_attr) obj->spec_attr->layer_type = layer_type;
+    else if(layer_type != LV_LAYER_TYPE_NONE) {
+        lv_obj_allocate_spec_attr(obj);
+        obj->spec_attr->layer_type = layer_type;
+    }
+    lv_obj_refresh_ext_draw_size(obj);
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < child_cnt; i++) {
+        refresh_tree_cache(obj->spec_attr->children[i]);
+    }
+}
+
 /**
  * Remove the transition from object's part's property.
  * - Remove the transition from `_lv_obj_style_trans_ll` and free it
@@ -118,6 +118,20 @@ void lv_obj_refresh_style(struct _lv_obj_t * obj, lv_part_t part, lv_style_prop_
  */
 void lv_obj_enable_style_refresh(bool en);
 
+/**
+ * Tell whether automatic style refreshing is enabled.
+ * @return          true: enabled; false: disabled with `lv_obj_enable_style_refresh(false)`
+ */
+bool lv_obj_is_style_refresh_enabled(void);
+
+/**
+ * Refresh an object and all of its descendants as if they were just created:
+ * cached layer type, extra draw size and `LV_EVENT_STYLE_CHANGED` for every object.
+ * Use it after objects were created or styled with style refreshing disabled.
+ * @param obj       pointer to an object
+ */
+void lv_obj_refresh_style_tree(struct _lv_obj_t * obj);
+
 /**
  * Get the value of a style property. The current state of the object will be considered.
  * Inherited properties will be inherited.
@@ -967,6 +967,9 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
     lv_layer_type_t layer_type = _lv_obj_get_layer_type(obj);
     if(layer_type == LV_LAYER_TYPE_NONE) {
+#if LV_USE_RENDER_CACHE
+        if(obj->render_cached && _lv_obj_render_cache_draw(draw_ctx, obj)) return;
+#endif
         lv_obj_redraw(draw_ctx, obj);
     }
     else {
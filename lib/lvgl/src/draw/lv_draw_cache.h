@@ -0,0 +1,50 @@
+/**
+ * @file lv_draw_cache.h
+ *
+ * Statistics of the caches of the drawing: glyphs and circles (the anti-aliased corners of the radius masks).
+ * See `lv_glyph_cache_get_stats()` and `lv_draw_mask_circle_cache_get_stats()`.
+ */
+
+#ifndef LV_DRAW_CACHE_H
+#define LV_DRAW_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include <stdint.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t hits;          /**< Items found in the cache*/
+    uint32_t misses;        /**< Items which had to be calculated*/
+    uint32_t evictions;     /**< Entries dropped to make room for new ones*/
+    uint32_t entries;       /**< Entries in the cache now*/
+    uint32_t used_bytes;    /**< Memory used by the entries now*/
+    uint32_t size;          /**< Size of the cache in bytes*/
+} lv_draw_cache_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_CACHE_H*/
@@ -13,6 +13,7 @@
 #include "../core/lv_refr.h"
 #include "../misc/lv_bidi.h"
 #include "../misc/lv_assert.h"
+#include "../misc/lv_txt_layout.h"
 
 /*********************
  *      DEFINES
@@ -35,6 +36,10 @@ typedef uint8_t cmd_state_t;
  **********************/
 
 static uint8_t hex_char_to_num(char hex);
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const char * txt, int32_t w,
+                             const _lv_txt_layout_t * layout, uint32_t line, uint32_t line_start);
+static lv_coord_t get_line_width(const lv_draw_label_dsc_t * dsc, const char * txt, const _lv_txt_layout_t * layout,
+                                 uint32_t line, uint32_t line_start, uint32_t line_end);
 
 /**********************
  *  STATIC VARIABLES
@@ -134,10 +139,15 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
     pos.y += y_ofs;
 
     uint32_t line_start     = 0;
+    uint32_t line           = 0;
     int32_t last_line_start = -1;
 
+    /*Use the cached line breaks if the text was measured recently.
+     *With them skipping the lines above the clip area is cheap, so the hint is not needed*/
+    const _lv_txt_layout_t * layout = _lv_txt_layout_get(txt, font, dsc->letter_space, w, dsc->flag);
+
     /*Check the hint to use the cached info*/
-    if(hint && y_ofs == 0 && coords->y1 < 0) {
+    if(hint && layout == NULL && y_ofs == 0 && coords->y1 < 0) {
         /*If the label changed too much recalculate the hint.*/
         if(LV_ABS(hint->coord_y - coords->y1) > LV_LABEL_HINT_UPDATE_TH - 2 * line_height) {
             hint->line_start = -1;
@@ -151,13 +161,14 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
         pos.y += hint->y;
     }
 
-    uint32_t line_end = line_start + _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+    uint32_t line_end = get_line_end(dsc, txt, w, layout, line, line_start);
 
     /*Go the first visible line*/
     while(pos.y + line_height_font < draw_ctx->clip_area->y1) {
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line++;
+        line_end = get_line_end(dsc, txt, w, layout, line, line_start);
         pos.y += line_height;
 
         /*Save at the threshold coordinate*/
@@ -172,14 +183,14 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+        line_width = get_line_width(dsc, txt, layout, line, line_start, line_end);
 
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+        line_width = get_line_width(dsc, txt, layout, line, line_start, line_end);
         pos.x += lv_area_get_width(coords) - line_width;
     }
     uint32_t sel_start = dsc->sel_start;
@@ -334,21 +345,20 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 #endif
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line++;
+        line_end = get_line_end(dsc, txt, w, layout, line, line_start);
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+            line_width = get_line_width(dsc, txt, layout, line, line_start, line_end);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+            line_width = get_line_width(dsc, txt, layout, line, line_start, line_end);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -371,6 +381,23 @@ void lv_draw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get where the line after `line_start` starts, from the cached line breaks if there are
+ */
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const char * txt, int32_t w,
+                             const _lv_txt_layout_t * layout, uint32_t line, uint32_t line_start)
+{
+    if(layout) return line < layout->line_cnt ? _lv_txt_layout_get_line_end(layout, line) : line_start;
+    return line_start + _lv_txt_get_next_line(&txt[line_start], dsc->font, dsc->letter_space, w, NULL, dsc->flag);
+}
+
+static lv_coord_t get_line_width(const lv_draw_label_dsc_t * dsc, const char * txt, const _lv_txt_layout_t * layout,
+                                 uint32_t line, uint32_t line_start, uint32_t line_end)
+{
+    if(layout && line < layout->line_cnt) return layout->lines[line].width;
+    return lv_txt_get_width(&txt[line_start], line_end - line_start, dsc->font, dsc->letter_space, dsc->flag);
+}
+
 /**
  * Convert a hexadecimal characters to a number (0..15)
  * @param hex Pointer to a hexadecimal character (0..9, A..F)
@@ -18,6 +18,7 @@
  *********************/
 #define CIRCLE_CACHE_LIFE_MAX   1000
 #define CIRCLE_CACHE_AGING(life, r)   life = LV_MIN(life + (r < 16 ? 1 : (r >> 4)), 1000)
+#define CIRCLE_CACHE_BUF_SIZE(r)      ((r) * 6 + 6)
 
 /**********************
  *      TYPEDEFS
@@ -63,6 +64,7 @@ static inline lv_opa_t /* LV_ATTRIBUTE_FAST_MEM */ mask_mix(lv_opa_t mask_act, l
 /**********************
  *  STATIC VARIABLES
  **********************/
+static lv_draw_cache_stats_t circle_stats;
 
 /**********************
  *      MACROS
@@ -232,12 +234,52 @@ void lv_draw_mask_free_param(void * p)
 void _lv_draw_mask_cleanup(void)
 {
     uint8_t i;
+    uint32_t used_bytes = 0;
     for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
-        if(LV_GC_ROOT(_lv_circle_cache[i]).buf) {
-            lv_mem_free(LV_GC_ROOT(_lv_circle_cache[i]).buf);
+        _lv_draw_mask_radius_circle_dsc_t * c = &LV_GC_ROOT(_lv_circle_cache[i]);
+        if(c->buf) used_bytes += CIRCLE_CACHE_BUF_SIZE(c->radius);
+    }
+
+    /*Keep the circles for the next refresh while they fit into the budget. Drop the least used first.*/
+    while(used_bytes > LV_CIRCLE_CACHE_BUDGET) {
+        _lv_draw_mask_radius_circle_dsc_t * entry = NULL;
+        for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+            _lv_draw_mask_radius_circle_dsc_t * c = &LV_GC_ROOT(_lv_circle_cache[i]);
+            if(c->buf == NULL || c->used_cnt) continue;
+            if(entry == NULL || c->life < entry->life) entry = c;
         }
-        lv_memset_00(&LV_GC_ROOT(_lv_circle_cache[i]), sizeof(LV_GC_ROOT(_lv_circle_cache[i])));
+        if(entry == NULL) break;
+
+        used_bytes -= CIRCLE_CACHE_BUF_SIZE(entry->radius);
+        lv_mem_free(entry->buf);
+        lv_memset_00(entry, sizeof(_lv_draw_mask_radius_circle_dsc_t));
     }
+
+    /*Age the kept circles so the ones not used recently are replaced first*/
+    for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+        LV_GC_ROOT(_lv_circle_cache[i]).life >>= 1;
+    }
+}
+
+void lv_draw_mask_circle_cache_get_stats(lv_draw_cache_stats_t * stats)
+{
+    *stats = circle_stats;
+    stats->entries = 0;
+    stats->used_bytes = 0;
+    stats->size = LV_CIRCLE_CACHE_BUDGET;
+
+    uint8_t i;
+    for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+        _lv_draw_mask_radius_circle_dsc_t * c = &LV_GC_ROOT(_lv_circle_cache[i]);
+        if(c->buf == NULL) continue;
+        stats->entries++;
+        stats->used_bytes += CIRCLE_CACHE_BUF_SIZE(c->radius);
+    }
+}
+
+void lv_draw_mask_circle_cache_reset_stats(void)
+{
+    lv_memset_00(&circle_stats, sizeof(circle_stats));
 }
 
 /**
@@ -499,6 +541,7 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
             LV_GC_ROOT(_lv_circle_cache[i]).used_cnt++;
             CIRCLE_CACHE_AGING(LV_GC_ROOT(_lv_circle_cache[i]).life, radius);
             param->circle = &LV_GC_ROOT(_lv_circle_cache[i]);
+            circle_stats.hits++;
             return;
         }
     }
@@ -519,12 +562,14 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
         entry->life = -1;
     }
     else {
+        if(entry->buf) circle_stats.evictions++;
         entry->used_cnt++;
         entry->life = 0;
         CIRCLE_CACHE_AGING(entry->life, radius);
     }
 
     param->circle = entry;
+    circle_stats.misses++;
 
     circ_calc_aa4(param->circle, radius);
 }
@@ -1367,7 +1412,7 @@ static void circ_calc_aa4(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radi
     /*Allocate buffers*/
     if(c->buf) lv_mem_free(c->buf);
 
-    c->buf = lv_mem_alloc(radius * 6 + 6);  /*Use uint16_t for opa_start_on_y and x_start_on_y*/
+    c->buf = lv_mem_alloc(CIRCLE_CACHE_BUF_SIZE(radius));  /*Use uint16_t for opa_start_on_y and x_start_on_y*/
     LV_ASSERT_MALLOC(c->buf);
     c->cir_opa = c->buf;
     c->opa_start_on_y = (uint16_t *)(c->buf + 2 * radius + 2);
@@ -17,6 +17,7 @@ extern "C" {
 #include "../misc/lv_area.h"
 #include "../misc/lv_color.h"
 #include "../misc/lv_math.h"
+#include "lv_draw_cache.h"
 
 /*********************
  *      DEFINES
@@ -288,6 +289,18 @@ void lv_draw_mask_free_param(void * p);
  */
 void _lv_draw_mask_cleanup(void);
 
+/**
+ * Get the counters and the memory usage of the circle cache.
+ * The circles (anti-aliased quarter circles) are kept between refreshes up to `LV_CIRCLE_CACHE_BUDGET` bytes.
+ * @param stats store the result here
+ */
+void lv_draw_mask_circle_cache_get_stats(lv_draw_cache_stats_t * stats);
+
+/**
+ * Zero the hit, miss and eviction counters of the circle cache.
+ */
+void lv_draw_mask_circle_cache_reset_stats(void);
+
 //! @cond Doxygen_Suppress
 
 /**
@@ -0,0 +1,284 @@
+/**
+ * @file lv_glyph_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_glyph_cache.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_gc.h"
+#include "../misc/lv_math.h"
+#include "../misc/lv_mem.h"
+#include "../misc/lv_tlsf.h"
+
+#if LV_GLYPH_CACHE_SIZE
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Number of hash buckets, a power of 2*/
+#define LV_GLYPH_CACHE_BUCKETS  128
+
+/*lv_tlsf is compiled with the built-in allocator and with LV_MEM_CUSTOM_TLSF*/
+#define LV_GLYPH_CACHE_TLSF     (LV_MEM_CUSTOM == 0 || LV_MEM_CUSTOM_TLSF)
+
+/*Room for the TLSF control structure and a few letters*/
+#define LV_GLYPH_CACHE_MIN_SIZE 4096
+
+#if LV_GLYPH_CACHE_SIZE < LV_GLYPH_CACHE_MIN_SIZE
+    #error "LV_GLYPH_CACHE_SIZE is too small"
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool cache_init(void);
+static uint32_t hash(const lv_font_t * font, uint32_t letter);
+static void * entry_alloc(uint32_t size);
+static void entry_free(_lv_glyph_cache_entry_t * entry);
+static void lru_unlink(_lv_glyph_cache_entry_t * entry);
+static void lru_push_head(_lv_glyph_cache_entry_t * entry);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_GLYPH_CACHE_TLSF
+    static lv_tlsf_t tlsf;
+#endif
+static uint32_t cache_size = LV_GLYPH_CACHE_SIZE;
+static _lv_glyph_cache_entry_t * buckets[LV_GLYPH_CACHE_BUCKETS];
+static _lv_glyph_cache_entry_t * lru_head;
+static _lv_glyph_cache_entry_t * lru_tail;
+static lv_glyph_cache_stats_t stats;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+_lv_glyph_cache_entry_t * _lv_glyph_cache_get(const lv_font_t * font, uint32_t letter)
+{
+    _lv_glyph_cache_entry_t * entry = NULL;
+    if(cache_size == 0) return NULL;
+    if(LV_GC_ROOT(_lv_glyph_cache_mem)) entry = buckets[hash(font, letter)];
+    while(entry) {
+        if(entry->letter == letter && entry->font == font) break;
+        entry = entry->hash_next;
+    }
+
+    if(entry == NULL) {
+        stats.misses++;
+        return NULL;
+    }
+
+    stats.hits++;
+    if(entry != lru_head) {
+        lru_unlink(entry);
+        lru_push_head(entry);
+    }
+    return entry;
+}
+
+_lv_glyph_cache_entry_t * _lv_glyph_cache_add(const lv_font_t * font, uint32_t letter,
+                                              const lv_font_glyph_dsc_t * dsc)
+{
+    if(!cache_init()) return NULL;
+
+    uint32_t mask_size = (uint32_t)dsc->box_w * dsc->box_h;
+    uint32_t size = sizeof(_lv_glyph_cache_entry_t) + mask_size;
+    if(size > cache_size / 4) return NULL;   /*Don't let a huge letter flush the cache*/
+
+    /*Drop the least recently used letters until the new one fits*/
+    _lv_glyph_cache_entry_t * entry = entry_alloc(size);
+    while(entry == NULL && lru_tail) {
+        entry_free(lru_tail);
+        stats.evictions++;
+        entry = entry_alloc(size);
+    }
+    if(entry == NULL) return NULL;
+
+    lv_memset_00(entry, sizeof(_lv_glyph_cache_entry_t));
+    entry->font = font;
+    entry->letter = letter;
+    entry->dsc = *dsc;
+    entry->mask = mask_size ? (lv_opa_t *)(entry + 1) : NULL;
+
+    uint32_t h = hash(font, letter);
+    entry->hash_next = buckets[h];
+    buckets[h] = entry;
+    lru_push_head(entry);
+    stats.entries++;
+
+    return entry;
+}
+
+void lv_glyph_cache_invalidate(const lv_font_t * font)
+{
+    if(LV_GC_ROOT(_lv_glyph_cache_mem) == NULL) return;
+
+    _lv_glyph_cache_entry_t * entry = lru_head;
+    while(entry) {
+        _lv_glyph_cache_entry_t * next = entry->next;
+        if(font == NULL || entry->font == font) entry_free(entry);
+        entry = next;
+    }
+}
+
+void lv_glyph_cache_set_size(uint32_t bytes)
+{
+    lv_glyph_cache_invalidate(NULL);
+    lv_mem_free(LV_GC_ROOT(_lv_glyph_cache_mem));
+    LV_GC_ROOT(_lv_glyph_cache_mem) = NULL;
+    cache_size = bytes == 0 ? 0 : LV_MAX(bytes, LV_GLYPH_CACHE_MIN_SIZE);
+}
+
+void lv_glyph_cache_get_stats(lv_glyph_cache_stats_t * stats_out)
+{
+    *stats_out = stats;
+    stats_out->size = cache_size;
+}
+
+void lv_glyph_cache_reset_stats(void)
+{
+    stats.hits = 0;
+    stats.misses = 0;
+    stats.evictions = 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Allocate the memory of the cache on first use.
+ */
+static bool cache_init(void)
+{
+    if(LV_GC_ROOT(_lv_glyph_cache_mem)) return true;
+    if(cache_size == 0) return false;
+
+    LV_GC_ROOT(_lv_glyph_cache_mem) = lv_mem_alloc(cache_size);
+    LV_ASSERT_MALLOC(LV_GC_ROOT(_lv_glyph_cache_mem));
+    if(LV_GC_ROOT(_lv_glyph_cache_mem) == NULL) {
+        LV_LOG_WARN("Couldn't allocate the glyph cache");
+        return false;
+    }
+
+#if LV_GLYPH_CACHE_TLSF
+    tlsf = lv_tlsf_create_with_pool(LV_GC_ROOT(_lv_glyph_cache_mem), cache_size);
+#endif
+
+    /*Forget the entries of a previous `lv_init()`*/
+    lv_memset_00(buckets, sizeof(buckets));
+    lru_head = NULL;
+    lru_tail = NULL;
+    stats.entries = 0;
+    stats.used_bytes = 0;
+    return true;
+}
+
+static uint32_t hash(const lv_font_t * font, uint32_t letter)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)font >> 2) ^ (letter * 2654435761U);
+    return (h ^ (h >> 16)) & (LV_GLYPH_CACHE_BUCKETS - 1);
+}
+
+static void * entry_alloc(uint32_t size)
+{
+#if LV_GLYPH_CACHE_TLSF
+    void * p = lv_tlsf_malloc(tlsf, size);
+    if(p) stats.used_bytes += lv_tlsf_block_size(p);
+    return p;
+#else
+    /*Without TLSF the entries are allocated one by one and only the budget is kept*/
+    if(stats.used_bytes + size > cache_size) return NULL;
+    void * p = lv_mem_alloc(size);
+    if(p) stats.used_bytes += size;
+    return p;
+#endif
+}
+
+static void entry_free(_lv_glyph_cache_entry_t * entry)
+{
+    _lv_glyph_cache_entry_t ** p = &buckets[hash(entry->font, entry->letter)];
+    while(*p != entry) p = &(*p)->hash_next;
+    *p = entry->hash_next;
+
+    lru_unlink(entry);
+    stats.entries--;
+
+#if LV_GLYPH_CACHE_TLSF
+    stats.used_bytes -= lv_tlsf_block_size(entry);
+    lv_tlsf_free(tlsf, entry);
+#else
+    stats.used_bytes -= sizeof(_lv_glyph_cache_entry_t) + (uint32_t)entry->dsc.box_w * entry->dsc.box_h;
+    lv_mem_free(entry);
+#endif
+}
+
+static void lru_unlink(_lv_glyph_cache_entry_t * entry)
+{
+    if(entry->prev) entry->prev->next = entry->next;
+    else lru_head = entry->next;
+    if(entry->next) entry->next->prev = entry->prev;
+    else lru_tail = entry->prev;
+    entry->prev = NULL;
+    entry->next = NULL;
+}
+
+static void lru_push_head(_lv_glyph_cache_entry_t * entry)
+{
+    entry->prev = NULL;
+    entry->next = lru_head;
+    if(lru_head) lru_head->prev = entry;
+    lru_head = entry;
+    if(lru_tail == NULL) lru_tail = entry;
+}
+
+#else /*LV_GLYPH_CACHE_SIZE*/
+
+_lv_glyph_cache_entry_t * _lv_glyph_cache_get(const lv_font_t * font, uint32_t letter)
+{
+    LV_UNUSED(font);
+    LV_UNUSED(letter);
+    return NULL;
+}
+
+_lv_glyph_cache_entry_t * _lv_glyph_cache_add(const lv_font_t * font, uint32_t letter,
+                                              const lv_font_glyph_dsc_t * dsc)
+{
+    LV_UNUSED(font);
+    LV_UNUSED(letter);
+    LV_UNUSED(dsc);
+    return NULL;
+}
+
+void lv_glyph_cache_invalidate(const lv_font_t * font)
+{
+    LV_UNUSED(font);
+}
+
+void lv_glyph_cache_set_size(uint32_t bytes)
+{
+    LV_UNUSED(bytes);
+}
+
+void lv_glyph_cache_get_stats(lv_glyph_cache_stats_t * stats_out)
+{
+    lv_memset_00(stats_out, sizeof(lv_glyph_cache_stats_t));
+}
+
+void lv_glyph_cache_reset_stats(void)
+{
+}
+
+#endif /*LV_GLYPH_CACHE_SIZE*/
@@ -0,0 +1,102 @@
+/**
+ * @file lv_glyph_cache.h
+ *
+ * Cache of the rendered letters.
+ * Keeps the glyph descriptor and an 8 bit opacity mask of the recently drawn letters,
+ * so compressed (or any non 8 bpp) fonts are not decoded again on every refresh.
+ * The entries are kept in one memory block of `LV_GLYPH_CACHE_SIZE` bytes (see `lv_glyph_cache_set_size()`)
+ * and the least recently used ones are dropped when it's full.
+ */
+
+#ifndef LV_GLYPH_CACHE_H
+#define LV_GLYPH_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "../font/lv_font.h"
+#include "../misc/lv_color.h"
+#include "lv_draw_cache.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct __lv_glyph_cache_entry_t {
+    struct __lv_glyph_cache_entry_t * hash_next;    /**< Next entry in the same hash bucket*/
+    struct __lv_glyph_cache_entry_t * prev;         /**< Previous (more recently used) entry*/
+    struct __lv_glyph_cache_entry_t * next;         /**< Next (less recently used) entry*/
+    const lv_font_t * font;                         /**< The font the letter was drawn with*/
+    uint32_t letter;                                /**< The Unicode code point*/
+    lv_font_glyph_dsc_t dsc;                        /**< The glyph descriptor (without kerning)*/
+    lv_opa_t * mask;                                /**< `box_w * box_h` opacities, row by row. NULL if empty*/
+} _lv_glyph_cache_entry_t;
+
+typedef lv_draw_cache_stats_t lv_glyph_cache_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Find a letter in the cache and mark it as the most recently used.
+ * @param font      the font of the letter
+ * @param letter    a Unicode code point
+ * @return          the entry or NULL if the letter is not cached
+ */
+_lv_glyph_cache_entry_t * _lv_glyph_cache_get(const lv_font_t * font, uint32_t letter);
+
+/**
+ * Add a letter to the cache, dropping the least recently used entries if there is no room.
+ * The caller has to fill the `box_w * box_h` bytes of `mask`.
+ * @param font      the font of the letter
+ * @param letter    a Unicode code point
+ * @param dsc       the glyph descriptor of the letter
+ * @return          the new entry or NULL if it doesn't fit in the cache
+ */
+_lv_glyph_cache_entry_t * _lv_glyph_cache_add(const lv_font_t * font, uint32_t letter,
+                                              const lv_font_glyph_dsc_t * dsc);
+
+/**
+ * Drop the cached letters of a font. Call it before freeing a font.
+ * @param font      pointer to a font or NULL to drop all letters
+ */
+void lv_glyph_cache_invalidate(const lv_font_t * font);
+
+/**
+ * Change the size of the cache. All cached letters are dropped.
+ * The memory is allocated again when the next letter is cached.
+ * It has effect only if the cache is enabled with `LV_GLYPH_CACHE_SIZE`.
+ * @param bytes     the new size in bytes, 0: don't cache letters
+ */
+void lv_glyph_cache_set_size(uint32_t bytes);
+
+/**
+ * Get the counters and the memory usage of the cache.
+ * @param stats     store the result here
+ */
+void lv_glyph_cache_get_stats(lv_glyph_cache_stats_t * stats);
+
+/**
+ * Zero the hit, miss and eviction counters.
+ */
+void lv_glyph_cache_reset_stats(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_GLYPH_CACHE_H*/
@@ -35,6 +35,9 @@
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE
     static bool lv_img_cache_match(const void * src1, const void * src2);
+    static uint32_t lv_img_cache_entry_bytes(const _lv_img_cache_entry_t * entry);
+    static void lv_img_cache_close_entry(_lv_img_cache_entry_t * entry);
+    static void lv_img_cache_trim(const _lv_img_cache_entry_t * keep);
 #endif
 
 /**********************
@@ -42,6 +45,8 @@
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE
     static uint16_t entry_cnt;
+    static uint32_t cache_budget = LV_IMG_CACHE_BUDGET;
+    static uint32_t cache_bytes;
 #endif
 
 /**********************
@@ -109,7 +114,7 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
 
     /*Close the decoder to reuse if it was opened (has a valid source)*/
     if(cached_src->dec_dsc.src) {
-        lv_img_decoder_close(&cached_src->dec_dsc);
+        lv_img_cache_close_entry(cached_src);
         LV_LOG_INFO("image draw: cache miss, close and reuse an entry");
     }
     else {
@@ -137,6 +142,12 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
 
     if(cached_src->dec_dsc.time_to_open == 0) cached_src->dec_dsc.time_to_open = 1;
 
+#if LV_IMG_CACHE_DEF_SIZE
+    cached_src->bytes = lv_img_cache_entry_bytes(cached_src);
+    cache_bytes += cached_src->bytes;
+    lv_img_cache_trim(cached_src);
+#endif
+
     return cached_src;
 }
 
@@ -169,6 +180,36 @@ void lv_img_cache_set_size(uint16_t new_entry_cnt)
 
     /*Clean the cache*/
     lv_memset_00(LV_GC_ROOT(_lv_img_cache_array), entry_cnt * sizeof(_lv_img_cache_entry_t));
+    cache_bytes = 0;
+#endif
+}
+
+/**
+ * Limit the RAM held by the decoded images in the cache.
+ * When the limit is exceeded the least used entries are closed, even if there are free entries.
+ * Images drawn directly from their source (e.g. `lv_img_dsc_t` variables in flash) don't count.
+ * @param bytes the limit in bytes, 0: no limit
+ */
+void lv_img_cache_set_budget(uint32_t bytes)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    cache_budget = bytes;
+    if(LV_GC_ROOT(_lv_img_cache_array) != NULL) lv_img_cache_trim(NULL);
+#else
+    LV_UNUSED(bytes);
+#endif
+}
+
+/**
+ * Get the RAM currently held by the decoded images in the cache.
+ * @return the size in bytes
+ */
+uint32_t lv_img_cache_get_used_bytes(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    return cache_bytes;
+#else
+    return 0;
 #endif
 }
 
@@ -186,11 +227,7 @@ void lv_img_cache_invalidate_src(const void * src)
     uint16_t i;
     for(i = 0; i < entry_cnt; i++) {
         if(src == NULL || lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            if(cache[i].dec_dsc.src != NULL) {
-                lv_img_decoder_close(&cache[i].dec_dsc);
-            }
-
-            lv_memset_00(&cache[i], sizeof(_lv_img_cache_entry_t));
+            lv_img_cache_close_entry(&cache[i]);
         }
     }
 #endif
@@ -212,4 +249,47 @@ static bool lv_img_cache_match(const void * src1, const void * src2)
         return false;
     return strcmp(src1, src2) == 0;
 }
+
+static uint32_t lv_img_cache_entry_bytes(const _lv_img_cache_entry_t * entry)
+{
+    const lv_img_decoder_dsc_t * dsc = &entry->dec_dsc;
+
+    /*Read line by line: nothing is kept decoded*/
+    if(dsc->img_data == NULL) return 0;
+
+    /*Drawn directly from the source variable*/
+    if(lv_img_src_get_type(dsc->src) == LV_IMG_SRC_VARIABLE &&
+       dsc->img_data == ((const lv_img_dsc_t *)dsc->src)->data) return 0;
+
+    return lv_img_buf_get_img_size(dsc->header.w, dsc->header.h, dsc->header.cf);
+}
+
+static void lv_img_cache_close_entry(_lv_img_cache_entry_t * entry)
+{
+    if(entry->dec_dsc.src != NULL) {
+        lv_img_decoder_close(&entry->dec_dsc);
+    }
+    cache_bytes -= entry->bytes;
+    lv_memset_00(entry, sizeof(_lv_img_cache_entry_t));
+}
+
+/*Close the least used entries until the decoded images fit in the budget*/
+static void lv_img_cache_trim(const _lv_img_cache_entry_t * keep)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+
+    while(cache_budget && cache_bytes > cache_budget) {
+        _lv_img_cache_entry_t * victim = NULL;
+        uint16_t i;
+        for(i = 0; i < entry_cnt; i++) {
+            if(&cache[i] == keep || cache[i].bytes == 0) continue;
+            if(victim == NULL || cache[i].life < victim->life) victim = &cache[i];
+        }
+        if(victim == NULL) break;
+
+        LV_LOG_INFO("image cache: over budget, close an entry");
+        lv_img_cache_close_entry(victim);
+        victim->life = INT32_MIN;
+    }
+}
 #endif
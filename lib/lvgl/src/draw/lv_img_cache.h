@@ -35,6 +35,9 @@ typedef struct {
      * Decrement all lifes by one every in every ::lv_img_cache_open.
      * If life == 0 the entry can be reused*/
     int32_t life;
+
+    /** RAM held by the decoded image. 0 if the image is drawn directly from its source*/
+    uint32_t bytes;
 } _lv_img_cache_entry_t;
 
 /**********************
@@ -60,6 +63,20 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
  */
 void lv_img_cache_set_size(uint16_t new_slot_num);
 
+/**
+ * Limit the RAM held by the decoded images in the cache.
+ * When the limit is exceeded the least used entries are closed, even if there are free entries.
+ * Images drawn directly from their source (e.g. `lv_img_dsc_t` variables in flash) don't count.
+ * @param bytes the limit in bytes, 0: no limit
+ */
+void lv_img_cache_set_budget(uint32_t bytes);
+
+/**
+ * Get the RAM currently held by the decoded images in the cache.
+ * @return the size in bytes
+ */
+uint32_t lv_img_cache_get_used_bytes(void);
+
 /**
  * Invalidate an image source in the cache.
  * Useful if the image source is updated therefore it needs to be cached again.
@@ -14,6 +14,20 @@
 /*********************
  *      DEFINES
  *********************/
+/*The word kernels round like `lv_color_mix()` does with LV_COLOR_MIX_ROUND_OFS > 0*/
+#if LV_DRAW_SW_WORD_BLEND && LV_COLOR_DEPTH == 16 && LV_COLOR_MIX_ROUND_OFS != 0
+    #define BLEND_WORD  1
+#else
+    #define BLEND_WORD  0
+#endif
+
+#if BLEND_WORD
+/*Two RGB565 pixels of a 32 bit word split to 16 bit lanes, one channel per word*/
+#define WORD_R(w)       (((w) >> 11) & 0x001F001FU)
+#define WORD_G(w)       (((w) >> 5) & 0x003F003FU)
+#define WORD_B(w)       ((w) & 0x001F001FU)
+#define WORD_LANES(v)   ((uint32_t)(v) * 0x00010001U)
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -68,6 +82,17 @@ static inline lv_color_t color_blend_true_color_subtractive(lv_color_t fg, lv_co
 static inline lv_color_t color_blend_true_color_multiply(lv_color_t fg, lv_color_t bg, lv_opa_t opa);
 #endif /*LV_DRAW_COMPLEX*/
 
+#if BLEND_WORD
+static void /* LV_ATTRIBUTE_FAST_MEM */ fill_normal_opa_word(lv_color_t * dest_buf, int32_t w, int32_t h,
+                                                             lv_coord_t dest_stride, lv_color_t color, lv_opa_t opa);
+static void /* LV_ATTRIBUTE_FAST_MEM */ map_normal_opa_word(lv_color_t * dest_buf, int32_t w, int32_t h,
+                                                            lv_coord_t dest_stride, const lv_color_t * src_buf,
+                                                            lv_coord_t src_stride, lv_opa_t opa);
+static inline uint32_t word_to_rgb565(uint32_t w);
+static inline uint32_t word_div255(uint32_t x);
+static inline uint32_t word_mix_premult(const uint32_t * fg_premult, uint32_t bg, uint32_t opa_inv);
+#endif /*BLEND_WORD*/
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -259,6 +284,9 @@ static LV_ATTRIBUTE_FAST_MEM void fill_normal(lv_color_t * dest_buf, const lv_ar
         }
         /*Has opacity*/
         else {
+#if BLEND_WORD
+            fill_normal_opa_word(dest_buf, w, h, dest_stride, color, opa);
+#else
             lv_color_t last_dest_color = lv_color_black();
             lv_color_t last_res_color = lv_color_mix(color, last_dest_color, opa);
 
@@ -284,6 +312,7 @@ static LV_ATTRIBUTE_FAST_MEM void fill_normal(lv_color_t * dest_buf, const lv_ar
                 }
                 dest_buf += dest_stride;
             }
+#endif /*BLEND_WORD*/
         }
     }
     /*Masked*/
@@ -660,6 +689,9 @@ static void LV_ATTRIBUTE_FAST_MEM map_normal(lv_color_t * dest_buf, const lv_are
             }
         }
         else {
+#if BLEND_WORD
+            map_normal_opa_word(dest_buf, w, h, dest_stride, src_buf, src_stride, opa);
+#else
             for(y = 0; y < h; y++) {
                 for(x = 0; x < w; x++) {
                     dest_buf[x] = lv_color_mix(src_buf[x], dest_buf[x], opa);
@@ -667,6 +699,7 @@ static void LV_ATTRIBUTE_FAST_MEM map_normal(lv_color_t * dest_buf, const lv_are
                 dest_buf += dest_stride;
                 src_buf += src_stride;
             }
+#endif
         }
     }
     /*Masked*/
@@ -690,10 +723,21 @@ static void LV_ATTRIBUTE_FAST_MEM map_normal(lv_color_t * dest_buf, const lv_are
                 for(; x < x_end4; x += 4) {
                     if(*mask32) {
                         if((*mask32) == 0xFFFFFFFF) {
-                            dest_buf[x] = src_buf[x];
-                            dest_buf[x + 1] = src_buf[x + 1];
-                            dest_buf[x + 2] = src_buf[x + 2];
-                            dest_buf[x + 3] = src_buf[x + 3];
+#if BLEND_WORD
+                            if((((lv_uintptr_t)&dest_buf[x] | (lv_uintptr_t)&src_buf[x]) & 0x3) == 0) {
+                                uint32_t * d32 = (uint32_t *)&dest_buf[x];
+                                const uint32_t * s32 = (const uint32_t *)&src_buf[x];
+                                d32[0] = s32[0];
+                                d32[1] = s32[1];
+                            }
+                            else
+#endif
+                            {
+                                dest_buf[x] = src_buf[x];
+                                dest_buf[x + 1] = src_buf[x + 1];
+                                dest_buf[x + 2] = src_buf[x + 2];
+                                dest_buf[x + 3] = src_buf[x + 3];
+                            }
                         }
                         else {
                             mask_tmp_x = (const lv_opa_t *)mask32;
@@ -1050,3 +1094,140 @@ static inline lv_color_t color_blend_true_color_multiply(lv_color_t fg, lv_color
 }
 
 #endif
+
+#if BLEND_WORD
+/**
+ * Mix a color with opacity on an area, two pixels at a time.
+ * The result is the same as `lv_color_mix(color, dest, opa)` pixel by pixel.
+ */
+static void LV_ATTRIBUTE_FAST_MEM fill_normal_opa_word(lv_color_t * dest_buf, int32_t w, int32_t h,
+                                                       lv_coord_t dest_stride, lv_color_t color, lv_opa_t opa)
+{
+    uint32_t c = word_to_rgb565(color.full);
+    uint32_t fg_premult[3];
+    fg_premult[0] = WORD_LANES(((c >> 11) & 0x1F) * opa + LV_COLOR_MIX_ROUND_OFS);
+    fg_premult[1] = WORD_LANES(((c >> 5) & 0x3F) * opa + LV_COLOR_MIX_ROUND_OFS);
+    fg_premult[2] = WORD_LANES((c & 0x1F) * opa + LV_COLOR_MIX_ROUND_OFS);
+    uint32_t opa_inv = 255 - opa;
+
+    /*Overlays are drawn mostly on plain backgrounds: reuse the last result*/
+    uint32_t last_dest = 0;
+    uint32_t last_res = word_mix_premult(fg_premult, 0, opa_inv);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        x = 0;
+        if((lv_uintptr_t)dest_buf & 0x3) {
+            uint32_t px = dest_buf[0].full;
+            dest_buf[0].full = (uint16_t)word_mix_premult(fg_premult, px | (px << 16), opa_inv);
+            x = 1;
+        }
+
+        uint32_t * d32 = (uint32_t *)&dest_buf[x];
+        for(; x < w - 1; x += 2) {
+            if(*d32 != last_dest) {
+                last_dest = *d32;
+                last_res = word_mix_premult(fg_premult, last_dest, opa_inv);
+            }
+            *d32 = last_res;
+            d32++;
+        }
+
+        if(x < w) {
+            uint32_t px = dest_buf[x].full;
+            dest_buf[x].full = (uint16_t)word_mix_premult(fg_premult, px | (px << 16), opa_inv);
+        }
+        dest_buf += dest_stride;
+    }
+}
+
+/**
+ * Mix an image with opacity on an area, two pixels at a time.
+ * The result is the same as `lv_color_mix(src, dest, opa)` pixel by pixel.
+ */
+static void LV_ATTRIBUTE_FAST_MEM map_normal_opa_word(lv_color_t * dest_buf, int32_t w, int32_t h,
+                                                      lv_coord_t dest_stride, const lv_color_t * src_buf,
+                                                      lv_coord_t src_stride, lv_opa_t opa)
+{
+    uint32_t opa_inv = 255 - opa;
+    uint32_t ofs = WORD_LANES(LV_COLOR_MIX_ROUND_OFS);
+    uint32_t fg_premult[3];
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        x = 0;
+        if((lv_uintptr_t)dest_buf & 0x3) {
+            uint32_t fg = word_to_rgb565(src_buf[0].full);
+            fg_premult[0] = ((fg >> 11) & 0x1F) * opa + ofs;
+            fg_premult[1] = ((fg >> 5) & 0x3F) * opa + ofs;
+            fg_premult[2] = (fg & 0x1F) * opa + ofs;
+            uint32_t px = dest_buf[0].full;
+            dest_buf[0].full = (uint16_t)word_mix_premult(fg_premult, px | (px << 16), opa_inv);
+            x = 1;
+        }
+
+        /*The source is read by halfwords if it's not aligned like the destination*/
+        bool src_aligned = ((lv_uintptr_t)&src_buf[x] & 0x3) == 0;
+        uint32_t * d32 = (uint32_t *)&dest_buf[x];
+        for(; x < w - 1; x += 2) {
+            uint32_t fg = src_aligned ? *(const uint32_t *)&src_buf[x] :
+                          src_buf[x].full | ((uint32_t)src_buf[x + 1].full << 16);
+            fg = word_to_rgb565(fg);
+            fg_premult[0] = WORD_R(fg) * opa + ofs;
+            fg_premult[1] = WORD_G(fg) * opa + ofs;
+            fg_premult[2] = WORD_B(fg) * opa + ofs;
+            *d32 = word_mix_premult(fg_premult, *d32, opa_inv);
+            d32++;
+        }
+
+        if(x < w) {
+            uint32_t fg = word_to_rgb565(src_buf[x].full);
+            fg_premult[0] = ((fg >> 11) & 0x1F) * opa + ofs;
+            fg_premult[1] = ((fg >> 5) & 0x3F) * opa + ofs;
+            fg_premult[2] = (fg & 0x1F) * opa + ofs;
+            uint32_t px = dest_buf[x].full;
+            dest_buf[x].full = (uint16_t)word_mix_premult(fg_premult, px | (px << 16), opa_inv);
+        }
+        dest_buf += dest_stride;
+        src_buf += src_stride;
+    }
+}
+
+/**
+ * Convert one or two pixels of the buffer to RGB565 (and back): swap the bytes with LV_COLOR_16_SWAP.
+ */
+static inline uint32_t word_to_rgb565(uint32_t w)
+{
+#if LV_COLOR_16_SWAP
+    return ((w & 0x00FF00FFU) << 8) | ((w >> 8) & 0x00FF00FFU);
+#else
+    return w;
+#endif
+}
+
+/**
+ * Divide both 16 bit lanes by 255, like `LV_UDIV255()`. The lanes need to be < 65535.
+ */
+static inline uint32_t word_div255(uint32_t x)
+{
+    return ((x + 0x00010001U + ((x >> 8) & 0x00FF00FFU)) >> 8) & 0x00FF00FFU;
+}
+
+/**
+ * Mix two pixels with the pre-multiplied channels of the foreground.
+ * @param fg_premult    `channel * opa + LV_COLOR_MIX_ROUND_OFS` of red, green and blue in both lanes
+ * @param bg            two background pixels as they are in the buffer
+ * @param opa_inv       `255 - opa`
+ * @return              the two mixed pixels as they are in the buffer
+ */
+static inline uint32_t word_mix_premult(const uint32_t * fg_premult, uint32_t bg, uint32_t opa_inv)
+{
+    bg = word_to_rgb565(bg);
+    uint32_t r = word_div255(fg_premult[0] + WORD_R(bg) * opa_inv);
+    uint32_t g = word_div255(fg_premult[1] + WORD_G(bg) * opa_inv);
+    uint32_t b = word_div255(fg_premult[2] + WORD_B(bg) * opa_inv);
+    return word_to_rgb565((r << 11) | (g << 5) | b);
+}
+#endif /*BLEND_WORD*/
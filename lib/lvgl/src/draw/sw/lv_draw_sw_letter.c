@@ -14,6 +14,7 @@
 #include "../../misc/lv_style.h"
 #include "../../font/lv_font.h"
 #include "../../core/lv_refr.h"
+#include "../lv_glyph_cache.h"
 
 /*********************
  *      DEFINES
@@ -35,6 +36,13 @@ static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_
                               lv_font_glyph_dsc_t * g, const uint8_t * map_p);
 #endif /*LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX*/
 
+#if LV_GLYPH_CACHE_SIZE
+static bool is_cacheable(const lv_font_glyph_dsc_t * g);
+static void fill_cache_mask(_lv_glyph_cache_entry_t * entry, const uint8_t * map_p);
+static void draw_letter_cached(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos,
+                               const _lv_glyph_cache_entry_t * entry);
+#endif /*LV_GLYPH_CACHE_SIZE*/
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -95,7 +103,23 @@ void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc
                        uint32_t letter)
 {
     lv_font_glyph_dsc_t g;
-    bool g_ret = lv_font_get_glyph_dsc(dsc->font, &g, letter, '\0');
+    bool g_ret;
+#if LV_GLYPH_CACHE_SIZE
+    _lv_glyph_cache_entry_t * cached = _lv_glyph_cache_get(dsc->font, letter);
+    if(cached) {
+        g = cached->dsc;
+        g_ret = true;
+    }
+    else {
+        g_ret = lv_font_get_glyph_dsc(dsc->font, &g, letter, '\0');
+        /*Empty letters (e.g. space) are cached too, to find them quickly next time*/
+        if(g_ret && (g.box_h == 0 || g.box_w == 0) && is_cacheable(&g)) {
+            _lv_glyph_cache_add(dsc->font, letter, &g);
+        }
+    }
+#else
+    g_ret = lv_font_get_glyph_dsc(dsc->font, &g, letter, '\0');
+#endif
     if(g_ret == false) {
         /*Add warning if the dsc is not found
          *but do not print warning for non printable ASCII chars (e.g. '\n')*/
@@ -139,12 +163,31 @@ void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc
         return;
     }
 
+#if LV_GLYPH_CACHE_SIZE
+    if(cached) {
+        draw_letter_cached(draw_ctx, dsc, &gpos, cached);
+        return;
+    }
+#endif
+
     const uint8_t * map_p = lv_font_get_glyph_bitmap(g.resolved_font, letter);
     if(map_p == NULL) {
         LV_LOG_WARN("lv_draw_letter: character's bitmap not found");
         return;
     }
 
+#if LV_GLYPH_CACHE_SIZE
+    /*Keep the decoded opacities to draw the letter from them next time*/
+    if(is_cacheable(&g)) {
+        cached = _lv_glyph_cache_add(dsc->font, letter, &g);
+        if(cached) {
+            fill_cache_mask(cached, map_p);
+            draw_letter_cached(draw_ctx, dsc, &gpos, cached);
+            return;
+        }
+    }
+#endif
+
     if(g.resolved_font->subpx) {
 #if LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX
         draw_letter_subpx(draw_ctx, dsc, &gpos, &g, map_p);
@@ -350,6 +393,141 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
     lv_mem_buf_release(mask_buf);
 }
 
+#if LV_GLYPH_CACHE_SIZE
+/**
+ * Only the normal (not sub-pixel, not image font) letters are cached
+ */
+static bool is_cacheable(const lv_font_glyph_dsc_t * g)
+{
+    if(g->resolved_font == NULL || g->resolved_font->subpx) return false;
+
+    switch(g->bpp) {
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 8:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Convert a glyph bitmap to the opacities of the cache entry, the same way `draw_letter_normal` does
+ */
+static void fill_cache_mask(_lv_glyph_cache_entry_t * entry, const uint8_t * map_p)
+{
+    const uint8_t * bpp_opa_table_p;
+    uint32_t bpp = entry->dsc.bpp;
+    if(bpp == 3) bpp = 4;
+
+    switch(bpp) {
+        case 1:
+            bpp_opa_table_p = _lv_bpp1_opa_table;
+            break;
+        case 2:
+            bpp_opa_table_p = _lv_bpp2_opa_table;
+            break;
+        case 4:
+            bpp_opa_table_p = _lv_bpp4_opa_table;
+            break;
+        default:
+            bpp_opa_table_p = _lv_bpp8_opa_table;
+            break;
+    }
+
+    uint32_t px_cnt = (uint32_t)entry->dsc.box_w * entry->dsc.box_h;
+    uint32_t px_mask = (1 << bpp) - 1;
+    uint32_t bit_pos = 0;
+    uint32_t i;
+    for(i = 0; i < px_cnt; i++) {
+        uint32_t letter_px = (map_p[bit_pos >> 3] >> (8 - bpp - (bit_pos & 0x7))) & px_mask;
+        entry->mask[i] = bpp_opa_table_p[letter_px];
+        bit_pos += bpp;
+    }
+}
+
+/**
+ * Draw a letter from its cached opacities.
+ * Without masks and opacity the opacities are blended directly, else the rows are copied and processed
+ * like in `draw_letter_normal` to get the same result.
+ */
+static void LV_ATTRIBUTE_FAST_MEM draw_letter_cached(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                                     const lv_point_t * pos, const _lv_glyph_cache_entry_t * entry)
+{
+    lv_area_t letter_area;
+    letter_area.x1 = pos->x;
+    letter_area.y1 = pos->y;
+    letter_area.x2 = pos->x + entry->dsc.box_w - 1;
+    letter_area.y2 = pos->y + entry->dsc.box_h - 1;
+
+    lv_area_t blend_area;
+    if(!_lv_area_intersect(&blend_area, &letter_area, draw_ctx->clip_area)) return;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.blend_mode = dsc->blend_mode;
+
+#if LV_DRAW_COMPLEX
+    bool mask_any = lv_draw_mask_is_any(&blend_area);
+#else
+    bool mask_any = false;
+#endif
+
+    if(!mask_any && dsc->opa >= LV_OPA_MAX) {
+        blend_dsc.blend_area = &blend_area;
+        blend_dsc.mask_buf = entry->mask;
+        blend_dsc.mask_area = &letter_area;
+        blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+        lv_draw_sw_blend(draw_ctx, &blend_dsc);
+        return;
+    }
+
+    lv_coord_t w = lv_area_get_width(&blend_area);
+    lv_opa_t * mask_buf = lv_mem_buf_get(w);
+    const lv_opa_t * mask_src = entry->mask + (int32_t)(blend_area.y1 - letter_area.y1) * entry->dsc.box_w +
+                                (blend_area.x1 - letter_area.x1);
+    lv_opa_t opa = dsc->opa;
+
+    lv_area_t row_area = blend_area;
+    blend_dsc.blend_area = &row_area;
+    blend_dsc.mask_buf = mask_buf;
+    blend_dsc.mask_area = &row_area;
+
+    lv_coord_t y;
+    for(y = blend_area.y1; y <= blend_area.y2; y++) {
+        row_area.y1 = y;
+        row_area.y2 = y;
+
+        if(opa < LV_OPA_MAX) {
+            lv_coord_t x;
+            for(x = 0; x < w; x++) {
+                mask_buf[x] = mask_src[x] == LV_OPA_COVER ? opa : ((mask_src[x] * opa) >> 8);
+            }
+        }
+        else {
+            lv_memcpy(mask_buf, mask_src, w);
+        }
+
+#if LV_DRAW_COMPLEX
+        if(mask_any) {
+            lv_draw_mask_res_t res = lv_draw_mask_apply(mask_buf, blend_area.x1, y, w);
+            if(res == LV_DRAW_MASK_RES_TRANSP) lv_memset_00(mask_buf, w);
+        }
+#endif
+
+        blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+        lv_draw_sw_blend(draw_ctx, &blend_dsc);
+        mask_src += entry->dsc.box_w;
+    }
+
+    lv_mem_buf_release(mask_buf);
+}
+#endif /*LV_GLYPH_CACHE_SIZE*/
+
 #if LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX
 static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos,
                               lv_font_glyph_dsc_t * g, const uint8_t * map_p)
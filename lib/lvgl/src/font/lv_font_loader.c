@@ -117,6 +117,10 @@ lv_font_t * lv_font_load(const char * font_name)
 void lv_font_free(lv_font_t * font)
 {
     if(NULL != font) {
+        /*A new font could get the same address*/
+        lv_glyph_cache_invalidate(font);
+        lv_txt_layout_cache_invalidate(font);
+
         lv_font_fmt_txt_dsc_t * dsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
         if(NULL != dsc) {
@@ -186,6 +186,24 @@
             #define LV_MEM_CUSTOM_REALLOC realloc
         #endif
     #endif
+    /*1: still compile LVGL's TLSF so the custom allocator can manage its own pool with it*/
+    #ifndef LV_MEM_CUSTOM_TLSF
+        #ifdef CONFIG_LV_MEM_CUSTOM_TLSF
+            #define LV_MEM_CUSTOM_TLSF CONFIG_LV_MEM_CUSTOM_TLSF
+        #else
+            #define LV_MEM_CUSTOM_TLSF 0
+        #endif
+    #endif
+    #if LV_MEM_CUSTOM_TLSF
+        /*Largest pool the custom allocator will hand to TLSF*/
+        #ifndef LV_MEM_CUSTOM_TLSF_POOL_SIZE
+            #ifdef CONFIG_LV_MEM_CUSTOM_TLSF_POOL_SIZE
+                #define LV_MEM_CUSTOM_TLSF_POOL_SIZE CONFIG_LV_MEM_CUSTOM_TLSF_POOL_SIZE
+            #else
+                #define LV_MEM_CUSTOM_TLSF_POOL_SIZE (64U * 1024U)
+            #endif
+        #endif
+    #endif
 #endif     /*LV_MEM_CUSTOM*/
 
 /*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
@@ -313,6 +331,16 @@
             #define LV_CIRCLE_CACHE_SIZE 4
         #endif
     #endif
+
+    /*Max. memory of the circles kept between refreshes in bytes (radius * 6 + 6 bytes per circle).
+    *0: free the circles after every refresh*/
+    #ifndef LV_CIRCLE_CACHE_BUDGET
+        #ifdef CONFIG_LV_CIRCLE_CACHE_BUDGET
+            #define LV_CIRCLE_CACHE_BUDGET CONFIG_LV_CIRCLE_CACHE_BUDGET
+        #else
+            #define LV_CIRCLE_CACHE_BUDGET 0
+        #endif
+    #endif
 #endif /*LV_DRAW_COMPLEX*/
 
 /**
@@ -356,6 +384,33 @@
     #endif
 #endif
 
+/*Limit of RAM held by decoded images in the image cache in bytes. 0: no limit*/
+#ifndef LV_IMG_CACHE_BUDGET
+    #ifdef CONFIG_LV_IMG_CACHE_BUDGET
+        #define LV_IMG_CACHE_BUDGET CONFIG_LV_IMG_CACHE_BUDGET
+    #else
+        #define LV_IMG_CACHE_BUDGET 0
+    #endif
+#endif
+
+/*Size of the glyph cache in bytes. 0: disable caching*/
+#ifndef LV_GLYPH_CACHE_SIZE
+    #ifdef CONFIG_LV_GLYPH_CACHE_SIZE
+        #define LV_GLYPH_CACHE_SIZE CONFIG_LV_GLYPH_CACHE_SIZE
+    #else
+        #define LV_GLYPH_CACHE_SIZE 0
+    #endif
+#endif
+
+/*1: Allow keeping the rendered pixels of static widget subtrees (see lv_obj_set_render_cache())*/
+#ifndef LV_USE_RENDER_CACHE
+    #ifdef CONFIG_LV_USE_RENDER_CACHE
+        #define LV_USE_RENDER_CACHE CONFIG_LV_USE_RENDER_CACHE
+    #else
+        #define LV_USE_RENDER_CACHE 0
+    #endif
+#endif
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -412,6 +467,16 @@
     #endif
 #endif
 
+/*1: Blend RGB565 pixels two at a time in 32 bit words (fills and images with opacity).
+ *The result is the same as with the pixel by pixel code. Only used with LV_COLOR_DEPTH 16*/
+#ifndef LV_DRAW_SW_WORD_BLEND
+    #ifdef CONFIG_LV_DRAW_SW_WORD_BLEND
+        #define LV_DRAW_SW_WORD_BLEND CONFIG_LV_DRAW_SW_WORD_BLEND
+    #else
+        #define LV_DRAW_SW_WORD_BLEND 0
+    #endif
+#endif
+
 /*-------------
  * GPU
  *-----------*/
@@ -1327,6 +1392,15 @@
     #endif
 #endif
 
+/*Number of texts whose line breaks are cached. 0: disable caching*/
+#ifndef LV_TXT_LAYOUT_CACHE_CNT
+    #ifdef CONFIG_LV_TXT_LAYOUT_CACHE_CNT
+        #define LV_TXT_LAYOUT_CACHE_CNT CONFIG_LV_TXT_LAYOUT_CACHE_CNT
+    #else
+        #define LV_TXT_LAYOUT_CACHE_CNT 0
+    #endif
+#endif
+
 /*Support bidirectional texts. Allows mixing Left-to-Right and Right-to-Left texts.
  *The direction will be processed according to the Unicode Bidirectional Algorithm:
  *https://www.w3.org/International/articles/inline-bidi-markup/uba-basics*/
@@ -18,6 +18,10 @@
     #include <stdio.h>
 #endif
 
+#ifdef LV_LOG_CUSTOM_INCLUDE
+    #include LV_LOG_CUSTOM_INCLUDE
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -67,6 +71,15 @@ void _lv_log_add(lv_log_level_t level, const char * file, int line, const char *
 {
     if(level >= _LV_LOG_LEVEL_NUM) return; /*Invalid level*/
 
+#ifdef LV_LOG_CUSTOM_ADD
+    /*The custom backend filters, formats and prints on its own*/
+    va_list custom_args;
+    va_start(custom_args, format);
+    LV_LOG_CUSTOM_ADD(level, file, line, func, format, custom_args);
+    va_end(custom_args);
+    return;
+#endif
+
     static uint32_t last_log_time = 0;
 
     if(level >= LV_LOG_LEVEL) {
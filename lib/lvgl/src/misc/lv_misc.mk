@@ -18,6 +18,7 @@ CSRCS += lv_timer.c
 CSRCS += lv_tlsf.c
 CSRCS += lv_txt.c
 CSRCS += lv_txt_ap.c
+CSRCS += lv_txt_layout.c
 CSRCS += lv_utils.c
 
 DEPPATH += --dep-path $(LVGL_DIR)/$(LVGL_DIR_NAME)/src/misc
@@ -45,6 +45,13 @@ static bool timer_created;
     #define TIMER_TRACE(...)
 #endif
 
+#ifdef LV_TIMER_TRACE_INCLUDE
+    #include LV_TIMER_TRACE_INCLUDE
+#else
+    #define LV_TIMER_TRACE_BEGIN()
+    #define LV_TIMER_TRACE_END()
+#endif
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -81,6 +88,8 @@ uint32_t LV_ATTRIBUTE_TIMER_HANDLER lv_timer_handler(void)
         return 1;
     }
 
+    LV_TIMER_TRACE_BEGIN();
+
     static uint32_t idle_period_start = 0;
     static uint32_t busy_time         = 0;
 
@@ -141,6 +150,7 @@ uint32_t LV_ATTRIBUTE_TIMER_HANDLER lv_timer_handler(void)
 
     already_running = false; /*Release the mutex*/
 
+    LV_TIMER_TRACE_END();
     TIMER_TRACE("finished (%d ms until the next timer call)", time_till_next);
     return time_till_next;
 }
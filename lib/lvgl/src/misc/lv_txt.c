@@ -9,6 +9,7 @@
 #include <stdarg.h>
 #include "lv_txt.h"
 #include "lv_txt_ap.h"
+#include "lv_txt_layout.h"
 #include "lv_math.h"
 #include "lv_log.h"
 #include "lv_mem.h"
@@ -101,11 +102,19 @@ void lv_txt_get_size(lv_point_t * size_res, const char * text, const lv_font_t *
 
     uint32_t line_start     = 0;
     uint32_t new_line_start = 0;
+    uint32_t line           = 0;
     uint16_t letter_height = lv_font_get_line_height(font);
 
+    /*Use the cached line breaks if the text was measured recently*/
+    const _lv_txt_layout_t * layout = _lv_txt_layout_get(text, font, letter_space, max_width, flag);
+
     /*Calc. the height and longest line*/
     while(text[line_start] != '\0') {
-        new_line_start += _lv_txt_get_next_line(&text[line_start], font, letter_space, max_width, NULL, flag);
+        /*Past the cached lines (shouldn't happen): measure the rest*/
+        if(layout && line >= layout->line_cnt) layout = NULL;
+
+        if(layout) new_line_start = _lv_txt_layout_get_line_end(layout, line);
+        else new_line_start += _lv_txt_get_next_line(&text[line_start], font, letter_space, max_width, NULL, flag);
 
         if((unsigned long)size_res->y + (unsigned long)letter_height + (unsigned long)line_space > LV_MAX_OF(lv_coord_t)) {
             LV_LOG_WARN("lv_txt_get_size: integer overflow while calculating text height");
@@ -117,11 +126,13 @@ void lv_txt_get_size(lv_point_t * size_res, const char * text, const lv_font_t *
         }
 
         /*Calculate the longest line*/
-        lv_coord_t act_line_length = lv_txt_get_width(&text[line_start], new_line_start - line_start, font, letter_space,
-                                                      flag);
+        lv_coord_t act_line_length;
+        if(layout) act_line_length = layout->lines[line].width;
+        else act_line_length = lv_txt_get_width(&text[line_start], new_line_start - line_start, font, letter_space, flag);
 
         size_res->x = LV_MAX(act_line_length, size_res->x);
         line_start  = new_line_start;
+        line++;
     }
 
     /*Make the text one line taller if the last character is '\n' or '\r'*/
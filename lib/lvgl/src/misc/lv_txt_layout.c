@@ -0,0 +1,264 @@
+/**
+ * @file lv_txt_layout.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_txt_layout.h"
+#include "lv_assert.h"
+#include "lv_gc.h"
+#include "lv_math.h"
+#include "lv_mem.h"
+#include <string.h>
+
+#if LV_TXT_LAYOUT_CACHE_CNT
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Texts shorter than this (in bytes) are measured every time*/
+#define LV_TXT_LAYOUT_MIN_LEN   16
+
+#define cache_p ((_lv_txt_layout_t *)LV_GC_ROOT(_lv_txt_layout_cache_array))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool cache_init(void);
+static uint32_t hash_text(const char * txt, uint32_t * len);
+static bool break_lines(_lv_txt_layout_t * layout, const char * txt);
+static void entry_free(_lv_txt_layout_t * layout);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static bool enabled = true;
+static uint32_t age;
+static lv_txt_layout_cache_stats_t stats;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+const _lv_txt_layout_t * _lv_txt_layout_get(const char * txt, const lv_font_t * font, lv_coord_t letter_space,
+                                            lv_coord_t max_width, lv_text_flag_t flag)
+{
+    if(!enabled || txt == NULL || font == NULL) return NULL;
+
+    uint32_t len;
+    uint32_t hash = hash_text(txt, &len);
+    if(len < LV_TXT_LAYOUT_MIN_LEN) return NULL;
+    if(!cache_init()) return NULL;
+
+    /*The width doesn't matter for these, so any width can use the same entry*/
+    if(flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) max_width = LV_COORD_MAX;
+
+    _lv_txt_layout_t * oldest = &cache_p[0];
+    uint32_t i;
+    for(i = 0; i < LV_TXT_LAYOUT_CACHE_CNT; i++) {
+        _lv_txt_layout_t * layout = &cache_p[i];
+        if(layout->lines == NULL) {
+            oldest = layout;
+            continue;
+        }
+
+        if(layout->hash == hash && layout->len == len && layout->font == font &&
+           layout->max_width == max_width && layout->letter_space == letter_space && layout->flag == flag &&
+           memcmp(layout->txt, txt, len) == 0) {
+            layout->last_used = ++age;
+            stats.hits++;
+            return layout;
+        }
+
+        if(oldest->lines && layout->last_used < oldest->last_used) oldest = layout;
+    }
+
+    stats.misses++;
+    entry_free(oldest);
+
+    oldest->font = font;
+    oldest->hash = hash;
+    oldest->len = len;
+    oldest->letter_space = letter_space;
+    oldest->max_width = max_width;
+    oldest->flag = flag;
+    if(!break_lines(oldest, txt)) return NULL;
+
+    oldest->last_used = ++age;
+    stats.entries++;
+    stats.used_bytes += oldest->line_cnt * sizeof(_lv_txt_layout_line_t) + len;
+    return oldest;
+}
+
+void lv_txt_layout_cache_invalidate(const lv_font_t * font)
+{
+    if(cache_p == NULL) return;
+
+    uint32_t i;
+    for(i = 0; i < LV_TXT_LAYOUT_CACHE_CNT; i++) {
+        if(font == NULL || cache_p[i].font == font) entry_free(&cache_p[i]);
+    }
+}
+
+void lv_txt_layout_cache_set_enabled(bool en)
+{
+    if(!en) lv_txt_layout_cache_invalidate(NULL);
+    enabled = en;
+}
+
+void lv_txt_layout_cache_get_stats(lv_txt_layout_cache_stats_t * stats_out)
+{
+    *stats_out = stats;
+}
+
+void lv_txt_layout_cache_reset_stats(void)
+{
+    stats.hits = 0;
+    stats.misses = 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Allocate the entries on first use.
+ */
+static bool cache_init(void)
+{
+    if(cache_p) return true;
+
+    LV_GC_ROOT(_lv_txt_layout_cache_array) = lv_mem_alloc(sizeof(_lv_txt_layout_t) * LV_TXT_LAYOUT_CACHE_CNT);
+    LV_ASSERT_MALLOC(cache_p);
+    if(cache_p == NULL) return false;
+
+    /*Forget the entries of a previous `lv_init()`*/
+    lv_memset_00(cache_p, sizeof(_lv_txt_layout_t) * LV_TXT_LAYOUT_CACHE_CNT);
+    age = 0;
+    stats.entries = 0;
+    stats.used_bytes = 0;
+    return true;
+}
+
+/**
+ * FNV-1a hash of a '\0' terminated string
+ */
+static uint32_t hash_text(const char * txt, uint32_t * len)
+{
+    uint32_t h = 2166136261U;
+    uint32_t i;
+    for(i = 0; txt[i] != '\0'; i++) {
+        h ^= (uint8_t)txt[i];
+        h *= 16777619U;
+    }
+    *len = i;
+    return h;
+}
+
+/**
+ * Break the text into lines the same way `lv_txt_get_size()` does and keep a copy of the text after the lines
+ */
+static bool break_lines(_lv_txt_layout_t * layout, const char * txt)
+{
+    uint32_t cap = 4;
+    _lv_txt_layout_line_t * lines = lv_mem_alloc(cap * sizeof(_lv_txt_layout_line_t));
+    LV_ASSERT_MALLOC(lines);
+    if(lines == NULL) return false;
+
+    uint32_t line_cnt = 0;
+    lv_coord_t width = 0;
+    uint32_t line_start = 0;
+    while(txt[line_start] != '\0') {
+        if(line_cnt == cap) {
+            cap *= 2;
+            _lv_txt_layout_line_t * new_lines = lv_mem_realloc(lines, cap * sizeof(_lv_txt_layout_line_t));
+            LV_ASSERT_MALLOC(new_lines);
+            if(new_lines == NULL) {
+                lv_mem_free(lines);
+                return false;
+            }
+            lines = new_lines;
+        }
+
+        uint32_t line_end = line_start + _lv_txt_get_next_line(&txt[line_start], layout->font, layout->letter_space,
+                                                               layout->max_width, NULL, layout->flag);
+        lines[line_cnt].start = line_start;
+        lines[line_cnt].width = lv_txt_get_width(&txt[line_start], line_end - line_start, layout->font,
+                                                 layout->letter_space, layout->flag);
+        width = LV_MAX(width, lines[line_cnt].width);
+        line_cnt++;
+        line_start = line_end;
+    }
+
+    /*Give back the unused part and make room for the text*/
+    _lv_txt_layout_line_t * new_lines = lv_mem_realloc(lines, line_cnt * sizeof(_lv_txt_layout_line_t) + layout->len);
+    LV_ASSERT_MALLOC(new_lines);
+    if(new_lines == NULL) {
+        lv_mem_free(lines);
+        return false;
+    }
+    lines = new_lines;
+    lv_memcpy(&lines[line_cnt], txt, layout->len);
+
+    layout->lines = lines;
+    layout->txt = (const char *)&lines[line_cnt];
+    layout->line_cnt = line_cnt;
+    layout->width = width;
+    return true;
+}
+
+static void entry_free(_lv_txt_layout_t * layout)
+{
+    if(layout->lines == NULL) return;
+
+    stats.entries--;
+    stats.used_bytes -= layout->line_cnt * sizeof(_lv_txt_layout_line_t) + layout->len;
+    lv_mem_free(layout->lines);
+    layout->lines = NULL;
+    layout->txt = NULL;
+    layout->font = NULL;
+}
+
+#else /*LV_TXT_LAYOUT_CACHE_CNT*/
+
+const _lv_txt_layout_t * _lv_txt_layout_get(const char * txt, const lv_font_t * font, lv_coord_t letter_space,
+                                            lv_coord_t max_width, lv_text_flag_t flag)
+{
+    LV_UNUSED(txt);
+    LV_UNUSED(font);
+    LV_UNUSED(letter_space);
+    LV_UNUSED(max_width);
+    LV_UNUSED(flag);
+    return NULL;
+}
+
+void lv_txt_layout_cache_invalidate(const lv_font_t * font)
+{
+    LV_UNUSED(font);
+}
+
+void lv_txt_layout_cache_set_enabled(bool en)
+{
+    LV_UNUSED(en);
+}
+
+void lv_txt_layout_cache_get_stats(lv_txt_layout_cache_stats_t * stats_out)
+{
+    lv_memset_00(stats_out, sizeof(lv_txt_layout_cache_stats_t));
+}
+
+void lv_txt_layout_cache_reset_stats(void)
+{
+}
+
+#endif /*LV_TXT_LAYOUT_CACHE_CNT*/
@@ -0,0 +1,119 @@
+/**
+ * @file lv_txt_layout.h
+ *
+ * Cache of the line breaks of texts.
+ * Keeps where the lines of the recently measured texts start and how wide they are,
+ * keyed by the text, the font, the letter space, the max. width and the flags.
+ * Each entry keeps a copy of its text: the hash only picks the candidates, the text itself is compared.
+ * `lv_txt_get_size()` and `lv_draw_label()` use it instead of breaking the same text into lines again.
+ * There are `LV_TXT_LAYOUT_CACHE_CNT` entries and the least recently used one is replaced on a miss.
+ */
+
+#ifndef LV_TXT_LAYOUT_H
+#define LV_TXT_LAYOUT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "lv_txt.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t start;         /**< Byte index of the line's first character*/
+    lv_coord_t width;       /**< Width of the line in pixels, as `lv_txt_get_width()` gives it*/
+} _lv_txt_layout_line_t;
+
+typedef struct {
+    const lv_font_t * font;
+    uint32_t hash;                  /**< Hash of the text*/
+    uint32_t len;                   /**< Length of the text in bytes*/
+    const char * txt;               /**< Copy of the text (`len` bytes, not '\0' terminated) after the lines*/
+    lv_coord_t letter_space;
+    lv_coord_t max_width;           /**< `LV_COORD_MAX` with `LV_TEXT_FLAG_EXPAND` or `LV_TEXT_FLAG_FIT`*/
+    lv_text_flag_t flag;
+    uint32_t line_cnt;
+    lv_coord_t width;               /**< Width of the longest line*/
+    uint32_t last_used;             /**< Age stamp for the LRU replacement*/
+    _lv_txt_layout_line_t * lines;  /**< `line_cnt` lines and the copy of the text. NULL if the entry is empty*/
+} _lv_txt_layout_t;
+
+typedef struct {
+    uint32_t hits;          /**< Texts found in the cache*/
+    uint32_t misses;        /**< Texts which had to be broken into lines*/
+    uint32_t entries;       /**< Entries in the cache now*/
+    uint32_t used_bytes;    /**< Memory used by the lines and texts of the entries now*/
+} lv_txt_layout_cache_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the line breaks of a text from the cache or break it into lines and cache the result.
+ * Short texts are not cached as measuring them is as fast as finding them.
+ * @param txt           a '\0' terminated string
+ * @param font          pointer to the font of the text
+ * @param letter_space  letter space of the text
+ * @param max_width     max width of the lines
+ * @param flag          settings for the text from ::lv_text_flag_t
+ * @return              the line breaks of the text, valid until the next call, or NULL if not cached
+ */
+const _lv_txt_layout_t * _lv_txt_layout_get(const char * txt, const lv_font_t * font, lv_coord_t letter_space,
+                                            lv_coord_t max_width, lv_text_flag_t flag);
+
+/**
+ * Drop the cached line breaks. Call it before freeing a font.
+ * @param font          pointer to a font or NULL to drop all texts
+ */
+void lv_txt_layout_cache_invalidate(const lv_font_t * font);
+
+/**
+ * Enable or disable the cache. Disabling it drops the cached texts.
+ * It has effect only if the cache is enabled with `LV_TXT_LAYOUT_CACHE_CNT`.
+ * @param en            true: cache the line breaks; false: measure the texts every time
+ */
+void lv_txt_layout_cache_set_enabled(bool en);
+
+/**
+ * Get the counters and the memory usage of the cache.
+ * @param stats         store the result here
+ */
+void lv_txt_layout_cache_get_stats(lv_txt_layout_cache_stats_t * stats);
+
+/**
+ * Zero the hit and miss counters.
+ */
+void lv_txt_layout_cache_reset_stats(void);
+
+/**
+ * Get the byte index after the last character of a line (i.e. where the next line starts)
+ * @param layout        the line breaks of a text
+ * @param line          index of the line
+ * @return              the end of the line
+ */
+static inline uint32_t _lv_txt_layout_get_line_end(const _lv_txt_layout_t * layout, uint32_t line)
+{
+    return line + 1 < layout->line_cnt ? layout->lines[line + 1].start : layout->len;
+}
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_TXT_LAYOUT_H*/
@@ -894,6 +894,10 @@ static void lv_label_refr_text(lv_obj_t * obj)
 {
     lv_label_t * label = (lv_label_t *)obj;
     if(label->text == NULL) return;
+    /*With style refreshing disabled (object creation, bulk update) LV_EVENT_STYLE_CHANGED
+     *will come later and refresh the text. Doing it now with not yet updated coordinates
+     *would start (and later delete) a scroll animation for every long mode label.*/
+    if(!lv_obj_is_style_refresh_enabled()) return;
 #if LV_LABEL_LONG_TXT_HINT
     label->hint.line_start = -1; /*The hint is invalid if the text changes*/
 #endif
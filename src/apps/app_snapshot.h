@@ -0,0 +1,188 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+
+/**
+ * App Snapshot Cache
+ *
+ * Guarda uma "foto" (snapshot RGB565) do último quadro de cada aplicativo quando
+ * ele é suspenso pelo AppManager. Ao voltar para o app, o snapshot é exibido
+ * imediatamente em uma tela leve, enquanto o app real executa seu show()
+ * (reconstrução da árvore de widgets, busca na rede etc.) no próximo ciclo.
+ *
+ * - Captura via lv_snapshot_take_to_buf() em um buffer de rascunho na PSRAM.
+ * - Cada snapshot é comprimido com RLE (pares [repetições][cor] de 16 bits),
+ *   o que funciona muito bem para os fundos lisos da interface.
+ * - Tudo fica na PSRAM; a SRAM interna não é usada.
+ *
+ * Este arquivo é incluído a partir de `apps.h`, depois da interface do AppManager.
+ */
+
+#ifndef APP_SNAPSHOT_ENABLE
+#define APP_SNAPSHOT_ENABLE 1
+#endif
+
+namespace AppSnapshot {
+
+#define APP_SNAPSHOT_MAX_APPS 16
+
+struct Slot {
+    uint16_t* data = nullptr;   // Dados RLE na PSRAM
+    uint32_t capacity = 0;      // Capacidade em palavras de 16 bits
+    uint32_t length = 0;        // Palavras usadas
+    lv_coord_t w = 0;
+    lv_coord_t h = 0;
+    bool valid = false;
+};
+
+static Slot slots[APP_SNAPSHOT_MAX_APPS];
+static uint16_t* scratch = nullptr;      // Quadro descomprimido (captura e exibição)
+static uint32_t scratch_size = 0;        // Em bytes
+static lv_img_dsc_t scratch_dsc;
+static lv_obj_t* snapshot_screen = nullptr;
+static lv_obj_t* snapshot_img = nullptr;
+
+/**
+ * @brief Garante que o buffer de rascunho comporta `bytes`.
+ */
+static bool ensure_scratch(uint32_t bytes) {
+    if (scratch && scratch_size >= bytes) return true;
+    uint16_t* buf = (uint16_t*)ps_realloc(scratch, bytes);
+    if (!buf) {
+        LV_LOG_WARN("Snapshot: failed to allocate %u bytes in PSRAM", (unsigned)bytes);
+        return false;
+    }
+    scratch = buf;
+    scratch_size = bytes;
+    return true;
+}
+
+/**
+ * @brief Comprime `count` pixels de `src` para o slot usando RLE.
+ */
+static bool compress_into(Slot& slot, const uint16_t* src, uint32_t count) {
+    // Primeira passada: conta as palavras necessárias para não superalocar.
+    uint32_t words = 0;
+    for (uint32_t i = 0; i < count;) {
+        uint32_t run = 1;
+        while (i + run < count && run < 0xFFFF && src[i + run] == src[i]) run++;
+        words += 2;
+        i += run;
+    }
+
+    if (slot.capacity < words) {
+        uint16_t* buf = (uint16_t*)ps_realloc(slot.data, words * sizeof(uint16_t));
+        if (!buf) {
+            slot.valid = false;
+            return false;
+        }
+        slot.data = buf;
+        slot.capacity = words;
+    }
+
+    uint16_t* out = slot.data;
+    for (uint32_t i = 0; i < count;) {
+        uint32_t run = 1;
+        while (i + run < count && run < 0xFFFF && src[i + run] == src[i]) run++;
+        *out++ = (uint16_t)run;
+        *out++ = src[i];
+        i += run;
+    }
+    slot.length = words;
+    return true;
+}
+
+/**
+ * @brief Descomprime o slot para o buffer de rascunho.
+ */
+static void decompress_from(const Slot& slot, uint16_t* dst) {
+    const uint16_t* in = slot.data;
+    const uint16_t* end = slot.data + slot.length;
+    while (in < end) {
+        uint16_t run = *in++;
+        uint16_t color = *in++;
+        while (run--) *dst++ = color;
+    }
+}
+
+/**
+ * @brief Cria a tela leve usada para exibir os snapshots.
+ */
+inline void init() {
+#if APP_SNAPSHOT_ENABLE
+    if (snapshot_screen) return;
+    snapshot_screen = lv_obj_create(NULL);
+    lv_obj_clear_flag(snapshot_screen, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_style_pad_all(snapshot_screen, 0, 0);
+    snapshot_img = lv_img_create(snapshot_screen);
+    lv_obj_set_pos(snapshot_img, 0, 0);
+#endif
+}
+
+/**
+ * @brief Captura o último quadro do app que está sendo suspenso.
+ * @param app Índice do app (AppManager::App).
+ * @param screen A tela do app.
+ */
+inline void capture(int app, lv_obj_t* screen) {
+#if APP_SNAPSHOT_ENABLE
+    if (app < 0 || app >= APP_SNAPSHOT_MAX_APPS || !screen || screen == snapshot_screen) return;
+
+    uint32_t needed = lv_snapshot_buf_size_needed(screen, LV_IMG_CF_TRUE_COLOR);
+    if (needed == 0 || !ensure_scratch(needed)) return;
+
+    lv_img_dsc_t dsc;
+    if (lv_snapshot_take_to_buf(screen, LV_IMG_CF_TRUE_COLOR, &dsc, scratch, scratch_size) != LV_RES_OK) {
+        slots[app].valid = false;
+        return;
+    }
+
+    Slot& slot = slots[app];
+    slot.w = dsc.header.w;
+    slot.h = dsc.header.h;
+    slot.valid = compress_into(slot, scratch, (uint32_t)slot.w * slot.h);
+#endif
+}
+
+/**
+ * @brief Exibe imediatamente o snapshot do app, se existir.
+ * @return true se o snapshot foi exibido e o show() real pode ser adiado.
+ */
+inline bool present(int app) {
+#if APP_SNAPSHOT_ENABLE
+    if (!snapshot_screen || app < 0 || app >= APP_SNAPSHOT_MAX_APPS) return false;
+    const Slot& slot = slots[app];
+    if (!slot.valid) return false;
+
+    uint32_t bytes = (uint32_t)slot.w * slot.h * sizeof(uint16_t);
+    if (!ensure_scratch(bytes)) return false;
+    decompress_from(slot, scratch);
+
+    scratch_dsc.header.always_zero = 0;
+    scratch_dsc.header.cf = LV_IMG_CF_TRUE_COLOR;
+    scratch_dsc.header.w = slot.w;
+    scratch_dsc.header.h = slot.h;
+    scratch_dsc.data_size = bytes;
+    scratch_dsc.data = (const uint8_t*)scratch;
+
+    // O conteúdo do buffer mudou, mas o ponteiro é o mesmo.
+    lv_img_cache_invalidate_src(&scratch_dsc);
+    lv_img_set_src(snapshot_img, &scratch_dsc);
+    lv_scr_load(snapshot_screen);
+    lv_refr_now(NULL);
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Descarta o snapshot de um app (ex: quando o conteúdo fica inválido).
+ */
+inline void invalidate(int app) {
+    if (app >= 0 && app < APP_SNAPSHOT_MAX_APPS) {
+        slots[app].valid = false;
+    }
+}
+
+} // namespace AppSnapshot
@@ -24,7 +24,8 @@ enum App {
     APP_SETTINGS,
     APP_WEATHER,
     APP_NOTES,
-    APP_CALENDAR
+    APP_CALENDAR,
+    APP_MONITOR
     // Adicione outros apps aqui no futuro
 };
 
@@ -37,12 +38,18 @@ void handle();
 
 // --- Application Includes ---
 // Agora, incluímos todos os cabeçalhos dos aplicativos.
+#include "system/pda_mem.h"
+#include "system/stall_detector.h"
+#include "system/alloc_trace.h"
+#include "app_snapshot.h"
+#include "pda_theme.h"
 #include "mainmenu/mainmenu.h"
 #include "calculator/calculator.h"
 #include "settings/settings.h"
 #include "weather/weather.h"
 #include "notes/notes.h"
 #include "calendar/calendar.h"
+#include "monitor/monitor.h"
 //#include "sketch/sketch.h" // Exemplo para futuros apps
 
 // --- AppManager Implementation ---
@@ -52,21 +59,15 @@ namespace AppManager {
 
 // Variável estática para rastrear qual aplicativo está ativo.
 static App current_app = APP_MAIN_MENU;
+// Indica que o snapshot do app já está na tela e o show() real ainda precisa rodar.
+static bool pending_show = false;
+// Nome de cada app nos relatórios do StallDetector e nas marcas do AllocTrace, na ordem do enum App.
+static const char* const app_site_names[] = {
+    "MainMenu", "Calculator", "Settings", "Weather", "Notes", "Calendar", "Monitor"
+};
 
-inline void init() {
-    Settings::init();
-    delay(1000);
-    MainMenu::init();
-    Calculator::init();
-    Weather::init();
-    Notes::init();
-    Calendar::init();
-    // Mostra o menu principal ao iniciar
-    show_app(APP_MAIN_MENU);
-}
-
-inline void show_app(App app_to_show) {
-    current_app = app_to_show;
+// Chama o show() do app ativo, que reconstrói/atualiza e carrega sua tela real.
+inline void show_current_app() {
     switch (current_app) {
         case APP_MAIN_MENU:
             MainMenu::show();
@@ -86,10 +87,60 @@ inline void show_app(App app_to_show) {
         case APP_CALENDAR:
             Calendar::show();
             break;
+        case APP_MONITOR:
+            Monitor::show();
+            break;
+    }
+}
+
+// Inicializa um app com todas as alocações do LVGL agrupadas na arena da sua tela.
+inline void init_app(const char* arena_name, void (*init_fn)()) {
+    LvMem::ArenaScope scope(LvMem::arena_create(arena_name));
+    init_fn();
+}
+
+inline void init() {
+    // Estilos compartilhados antes de qualquer tela ser criada
+    PdaTheme::init();
+    init_app("settings", Settings::init);
+    delay(1000);
+    init_app("mainmenu", MainMenu::init);
+    init_app("calculator", Calculator::init);
+    init_app("weather", Weather::init);
+    init_app("notes", Notes::init);
+    init_app("calendar", Calendar::init);
+    init_app("monitor", Monitor::init);
+    AppSnapshot::init();
+    // Mostra o menu principal ao iniciar
+    current_app = APP_MAIN_MENU;
+    show_current_app();
+}
+
+inline void show_app(App app_to_show) {
+    // Suspende o app atual guardando seu último quadro.
+    AppSnapshot::capture(current_app, lv_scr_act());
+    current_app = app_to_show;
+    // No relatório de alocações, o que vem depois é atribuído a este app
+    AllocTrace::mark(app_site_names[current_app]);
+
+    // Se houver um snapshot, ele aparece já neste quadro; o show() real
+    // (reconstrução da tela, busca na rede) roda no próximo handle().
+    if (AppSnapshot::present(current_app)) {
+        pending_show = true;
+        return;
     }
+    pending_show = false;
+    show_current_app();
 }
 
 inline void handle() {
+    // Um travamento sem site mais específico é atribuído ao app ativo
+    STALL_SITE(app_site_names[current_app]);
+    if (pending_show) {
+        pending_show = false;
+        show_current_app();
+    }
+
     // O switch garante que apenas o handler do app ativo seja executado.
     if (current_app == APP_MAIN_MENU) MainMenu::handle();
     else if (current_app == APP_CALCULATOR) Calculator::handle();
@@ -97,6 +148,7 @@ inline void handle() {
     else if (current_app == APP_WEATHER) Weather::handle();
     else if (current_app == APP_NOTES) Notes::handle();
     else if (current_app == APP_CALENDAR) Calendar::handle();
+    else if (current_app == APP_MONITOR) Monitor::handle();
 }
 
 } // namespace AppManager
@@ -6,6 +6,10 @@
 #include <math.h>
 #include <ctype.h>
 #include "input/input.h"
+#include "system/pda_mem.h"
+#include "apps/pda_theme.h"
+#include "system/lv_bulk.h"
+#include "system/pda_trace.h"
 
 // Font declarations for all used fonts
 LV_FONT_DECLARE(lv_font_montserrat_16);
@@ -39,6 +43,7 @@ static bool just_calculated = false; // Flag to check if equals was just pressed
 #define MAX_HISTORY 20
 static char calculation_history[MAX_HISTORY][64];
 static int history_count = 0;
+static LvMem::Arena* history_arena = nullptr; // Released as a whole on every history rebuild
 
 // --- Function Prototypes ---
 inline void update_display();
@@ -101,15 +106,13 @@ static void show_history() {
     if (!history_list) return;
 
     lv_obj_clean(history_list);
+    LvMem::arena_renew(history_arena, "calculator.history");
+    LvMem::ArenaScope arena_scope(history_arena);
+    // Layout and redraw once for the whole history instead of once per entry.
+    LvBulk::Scope bulk(history_list);
     for (int i = 0; i < history_count; i++) {
-        lv_list_add_text(history_list, calculation_history[i]);
-    }
-
-    uint32_t child_count = lv_obj_get_child_cnt(history_list);
-    for (uint32_t i = 0; i < child_count; i++) {
-        lv_obj_t* child = lv_obj_get_child(history_list, i);
-        lv_obj_set_style_bg_opa(child, 0, LV_PART_MAIN);
-        lv_obj_set_style_text_color(child, lv_color_hex(0x0B3C5D), LV_PART_MAIN);
+        lv_obj_t* entry = lv_list_add_text(history_list, calculation_history[i]);
+        lv_obj_add_style(entry, &PdaTheme::style_list_item, LV_PART_MAIN);
     }
 }
 
@@ -336,32 +339,12 @@ inline void hide() {
 }
 
 inline void init() {
-    calculator_screen = lv_obj_create(NULL);
-    lv_obj_add_flag(calculator_screen, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_set_size(calculator_screen, 320, 240);
-    lv_obj_set_style_bg_color(calculator_screen, lv_color_hex(0xFDF5E6), LV_PART_MAIN);
-
-    lv_obj_t* back_btn = lv_btn_create(calculator_screen);
-    lv_obj_align(back_btn, LV_ALIGN_TOP_LEFT, 5, 5);
-    lv_obj_add_event_cb(back_btn, back_button_event_cb, LV_EVENT_CLICKED, NULL);
-    lv_obj_set_style_bg_color(back_btn, lv_color_hex(0x1A5FB4), LV_PART_MAIN);
-    lv_obj_set_style_bg_opa(back_btn, LV_OPA_50, LV_PART_MAIN);
-    lv_obj_set_style_radius(back_btn, 12, LV_PART_MAIN);
-    lv_obj_set_style_border_width(back_btn, 0, LV_PART_MAIN);
-    lv_obj_set_style_shadow_opa(back_btn, 0, LV_PART_MAIN);
-
-    lv_obj_t* back_label = lv_label_create(back_btn);
-    lv_label_set_text(back_label, LV_SYMBOL_LEFT);
-    lv_obj_set_style_text_color(back_label, lv_color_hex(0xFFFFFF), 0);
-    lv_obj_set_style_text_font(back_label, &lv_font_montserrat_16, 0);
-    lv_obj_center(back_label);
+    calculator_screen = PdaTheme::create_screen();
+
+    PdaTheme::create_back_button(calculator_screen, back_button_event_cb);
 
     // --- Título da Tela ---
-    lv_obj_t* screen_title = lv_label_create(calculator_screen);
-    lv_label_set_text(screen_title, "Calculator");
-    lv_obj_set_style_text_font(screen_title, &lv_font_montserrat_28, 0);
-    lv_obj_set_style_text_color(screen_title, lv_color_hex(0x0B3C5D), 0);
-    lv_obj_align(screen_title, LV_ALIGN_TOP_MID, 0, 10);
+    PdaTheme::create_title(calculator_screen, "Calculator");
 
     display_container = lv_obj_create(calculator_screen);
     lv_obj_set_size(display_container, 310, 180);
@@ -377,11 +360,11 @@ inline void init() {
     history_list = lv_list_create(display_container);
     lv_obj_set_size(history_list, 290, 100);
     lv_obj_align(history_list, LV_ALIGN_TOP_LEFT, 0, 0);
-    lv_obj_set_style_bg_opa(history_list, 0, LV_PART_MAIN);
-    lv_obj_set_style_border_width(history_list, 0, LV_PART_MAIN);
     lv_obj_set_style_radius(history_list, 0, LV_PART_MAIN);
     lv_obj_set_style_pad_all(history_list, 8, LV_PART_MAIN);
     lv_obj_set_style_text_color(history_list, lv_color_hex(0x0B3C5D), LV_PART_MAIN);
+    // Allocate the list's child bookkeeping now, outside the history arena.
+    lv_obj_allocate_spec_attr(history_list);
 
     expression_label = lv_label_create(display_container);
     lv_obj_set_width(expression_label, 290);
@@ -409,6 +392,7 @@ inline void show() {
 }
 
 inline void handle() {
+    PDA_TRACE_SCOPE("Calculator::handle");
     char key = Keyboard::get_key();
     if (key > 0) {
         switch (key) {
@@ -7,6 +7,13 @@
 #include <ArduinoJson.h>
 #include "secrets.h"
 #include "lvgl.h"
+#include "system/pda_mem.h"
+#include "apps/pda_theme.h"
+#include "apps/virtual_list.h"
+#include "system/render_cache.h"
+#include "system/pda_trace.h"
+#include "system/alloc_trace.h"
+#include "system/stall_detector.h"
 
 namespace Utils
 {
@@ -35,11 +42,16 @@ namespace Calendar
     static lv_obj_t *back_btn = nullptr;
     static lv_obj_t *title_label = nullptr;
     static lv_obj_t *events_list = nullptr;
+    static VirtualList::List events_vlist; // Recycled rows: only the visible ones exist
+    // Events shown in the list when filtered by day (nullptr: all events, in order)
+    static uint16_t *shown_events = nullptr;
+    static uint32_t shown_capacity = 0;
     static lv_obj_t *status_label = nullptr;
 
     // --- New UI Variables for calendar grid and month navigation ---
     static lv_obj_t *calendar_grid_cont = nullptr;
     static lv_obj_t *month_label = nullptr;
+    static lv_obj_t *weekday_row = nullptr; // Day of week labels, drawn from a retained layer
     static lv_obj_t *prev_month_btn = nullptr;
     static lv_obj_t *next_month_btn = nullptr;
 
@@ -51,10 +63,17 @@ namespace Calendar
     // --- Variables for async operation ---
     static TaskHandle_t fetch_event_task_handle = NULL;
     static SemaphoreHandle_t data_mutex = NULL;
-    static JsonDocument events_doc;
+    static JsonDocument events_doc(AllocTrace::json());
+    // UI-thread copy: rows, the modal and the day filter read it without the mutex.
+    // Swapped in from events_doc when the fetch task signals new data.
+    static JsonDocument events_view(AllocTrace::json());
     static volatile bool data_ready_for_ui = false;
     static String fetch_status_message = "";
 
+    // --- Memory arenas (released as a whole when the modal/grid is destroyed) ---
+    static LvMem::Arena *modal_arena = nullptr;
+    static LvMem::Arena *grid_arena = nullptr;
+
     // --- Function Prototypes ---
     static void back_button_event_cb(lv_event_t *e);
     static void fetch_events();
@@ -65,7 +84,8 @@ namespace Calendar
     static void event_save_btn_event_cb(lv_event_t *e);
     static void event_cancel_btn_event_cb(lv_event_t *e);
     static void event_delete_btn_event_cb(lv_event_t *e);
-    static void event_list_item_click_event_cb(lv_event_t *e);
+    static void bind_event_row(lv_obj_t *row, lv_obj_t *label, uint32_t index);
+    static void event_row_clicked(uint32_t index);
     static void show_event_modal(const char *title = nullptr, const char *start = nullptr, const char *end = nullptr, const char *description = nullptr, const char *location = nullptr);
     static void close_event_modal();
     static void create_event(const char *title, const char *start, const char *end, const char *description, const char *location);
@@ -156,6 +176,28 @@ namespace Calendar
             lv_obj_set_style_text_color(month_label, lv_color_hex(0x000000), 0);
         }
 
+        // Day of week labels: they never change, so the row is rendered once into a
+        // retained layer and copied on later frames
+        if (!weekday_row)
+        {
+            static const char *day_names[7] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+            weekday_row = lv_obj_create(calendar_grid_cont);
+            lv_obj_add_style(weekday_row, &PdaTheme::style_transparent, 0);
+            lv_obj_set_style_pad_all(weekday_row, 0, 0);
+            lv_obj_set_size(weekday_row, 7 * 40, 16);
+            lv_obj_set_pos(weekday_row, 0, 30);
+            lv_obj_clear_flag(weekday_row, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+            for (int i = 0; i < 7; i++)
+            {
+                lv_obj_t *day_label = lv_label_create(weekday_row);
+                lv_label_set_text(day_label, day_names[i]);
+                lv_obj_set_style_text_font(day_label, &lv_font_montserrat_12, 0);
+                lv_obj_set_style_text_color(day_label, lv_color_hex(0x000000), 0);
+                lv_obj_set_pos(day_label, 5 + i * 40, 0);
+            }
+            RenderCache::enable(weekday_row, "calendar.weekdays");
+        }
+
         // Prev month button
         if (!prev_month_btn)
         {
@@ -213,79 +255,58 @@ namespace Calendar
         
         // Check if there are events on this day
         bool has_event = false;
-        if (xSemaphoreTake(data_mutex, portMAX_DELAY) == pdTRUE)
+        auto items = events_view["items"].as<JsonArray>();
+        for (JsonObject event : items)
         {
-            auto items = events_doc["items"].as<JsonArray>();
-            for (JsonObject event : items)
+            const char *start = event["startTime"] | "";
+            if (strlen(start) > 0)
             {
-                const char *start = event["startTime"] | "";
-                if (strlen(start) > 0)
+                struct tm event_time = convertUTCToGMT3(start);
+                
+                if (event_time.tm_year + 1900 == current_year && 
+                    event_time.tm_mon + 1 == current_month && 
+                    event_time.tm_mday == day)
                 {
-                    struct tm event_time = convertUTCToGMT3(start);
-                    
-                    if (event_time.tm_year + 1900 == current_year && 
-                        event_time.tm_mon + 1 == current_month && 
-                        event_time.tm_mday == day)
-                    {
-                        has_event = true;
-                        break;
-                    }
+                    has_event = true;
+                    break;
                 }
             }
-            xSemaphoreGive(data_mutex);
         }
         if (has_event)
         {
             // Filter events list to show events for this day
-            lv_obj_clean(events_list);
             lv_obj_add_flag(calendar_grid_cont, LV_OBJ_FLAG_HIDDEN);
             lv_obj_clear_flag(events_list, LV_OBJ_FLAG_HIDDEN);
-            if (xSemaphoreTake(data_mutex, portMAX_DELAY) == pdTRUE)
+            uint32_t shown_count = 0;
+            uint32_t item_count = items.size();
+            if (item_count > shown_capacity)
             {
-                auto items = events_doc["items"].as<JsonArray>();
-                for (int i = 0; i < (int)items.size(); i++)
+                uint16_t *buf = (uint16_t *)lv_mem_realloc(shown_events, item_count * sizeof(uint16_t));
+                if (buf)
                 {
-                    JsonObject event = items[i].as<JsonObject>();
-                    const char *start = event["startTime"] | "";
-                    if (strlen(start) > 0)
+                    shown_events = buf;
+                    shown_capacity = item_count;
+                }
+            }
+            uint32_t i = 0;
+            for (JsonObject event : items)
+            {
+                const char *start = event["startTime"] | "";
+                if (strlen(start) > 0 && shown_count < shown_capacity)
+                {
+                    struct tm event_time = convertUTCToGMT3(start);
+
+                    if (event_time.tm_year + 1900 == current_year &&
+                        event_time.tm_mon + 1 == current_month &&
+                        event_time.tm_mday == day)
                     {
-                        struct tm event_time = convertUTCToGMT3(start);
-                        
-                        if (event_time.tm_year + 1900 == current_year && 
-                            event_time.tm_mon + 1 == current_month && 
-                            event_time.tm_mday == day)
-                        {
-                            String title = event["title"] | "Untitled";
-                            title = Utils::sanitizeString(title);
-                            
-                            // Format display with GMT-3 time
-                            char display_text[100];
-                            snprintf(display_text, sizeof(display_text), "%s (%02d:%02d)", 
-                                     title.c_str(), event_time.tm_hour, event_time.tm_min);
-                            
-                            lv_obj_t *btn = lv_list_add_btn(events_list, NULL, display_text);
-                            lv_obj_set_user_data(btn, (void *)(intptr_t)i);
-                            lv_obj_add_event_cb(btn, event_list_item_click_event_cb, LV_EVENT_CLICKED, NULL);
-                        }
+                        shown_events[shown_count++] = (uint16_t)i;
                     }
                 }
-                xSemaphoreGive(data_mutex);
+                i++;
             }
+            VirtualList::set_count(&events_vlist, shown_count);
             lv_label_set_text(status_label, "Filtered events for selected day");
-
-            lv_obj_set_style_bg_opa(events_list, LV_OPA_TRANSP, LV_PART_MAIN);
-            lv_obj_set_style_border_width(events_list, 0, LV_PART_MAIN);
-            lv_obj_set_style_text_color(events_list, lv_color_hex(0x0B3C5D), LV_PART_MAIN);
-
-            // Style each child item in the list
-            uint32_t child_count = lv_obj_get_child_cnt(events_list);
-            for (uint32_t i = 0; i < child_count; i++)
-            {
-                lv_obj_t *child = lv_obj_get_child(events_list, i);
-                lv_obj_set_style_bg_opa(child, LV_OPA_TRANSP, LV_PART_MAIN);
-                lv_obj_set_style_border_width(child, 0, LV_PART_MAIN);
-                lv_obj_set_style_text_color(child, lv_color_hex(0x0B3C5D), LV_PART_MAIN);
-            }
         }
         else
         {
@@ -313,27 +334,18 @@ namespace Calendar
         snprintf(month_year_str, sizeof(month_year_str), "%s %d", month_names[current_month - 1], current_year);
         lv_label_set_text(month_label, month_year_str);
 
-        // Remove existing day buttons and labels except month label and nav buttons
+        // Remove existing day buttons except month label, weekday row and nav buttons
         uint32_t child_count = lv_obj_get_child_cnt(calendar_grid_cont);
         for (int i = (int)child_count - 1; i >= 0; i--)
         {
             lv_obj_t *child = lv_obj_get_child(calendar_grid_cont, i);
-            if (child != month_label && child != prev_month_btn && child != next_month_btn)
+            if (child != month_label && child != weekday_row && child != prev_month_btn && child != next_month_btn)
             {
                 lv_obj_del(child);
             }
         }
-
-        // Day of week labels
-        static const char *day_names[7] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
-        for (int i = 0; i < 7; i++)
-        {
-            lv_obj_t *day_label = lv_label_create(calendar_grid_cont);
-            lv_label_set_text(day_label, day_names[i]);
-            lv_obj_set_style_text_font(day_label, &lv_font_montserrat_12, 0);
-            lv_obj_set_style_text_color(day_label, lv_color_hex(0x000000), 0);
-            lv_obj_set_pos(day_label, 5 + i * 40, 30);
-        }
+        LvMem::arena_renew(grid_arena, "calendar.grid");
+        LvMem::ArenaScope arena_scope(grid_arena);
 
         // Calculate first day of month weekday and number of days in month
         struct tm timeinfo = {0};
@@ -384,9 +396,9 @@ namespace Calendar
 
     static void event_delete_btn_event_cb(lv_event_t *e)
     {
-        if (selected_event_index >= 0 && selected_event_index < (int)events_doc["items"].size())
+        if (selected_event_index >= 0 && selected_event_index < (int)events_view["items"].size())
         {
-            JsonObject event = events_doc["items"][selected_event_index].as<JsonObject>();
+            JsonObject event = events_view["items"][selected_event_index].as<JsonObject>();
             const char *id = event["id"] | "";
             delete_event(id);
             close_event_modal();
@@ -398,12 +410,33 @@ namespace Calendar
         }
     }
 
-    static void event_list_item_click_event_cb(lv_event_t *e)
+    /**
+     * @brief Maps a list row to its event index (rows follow shown_events when filtered by day).
+     */
+    static uint32_t event_index_for_row(uint32_t row)
+    {
+        return shown_events && row < shown_capacity ? shown_events[row] : row;
+    }
+
+    /**
+     * @brief Fills a recycled list row with the event title and start time.
+     */
+    static void bind_event_row(lv_obj_t *row, lv_obj_t *label, uint32_t index)
     {
-        lv_obj_t *target = lv_event_get_target(e);
-        intptr_t index = (intptr_t)lv_obj_get_user_data(target);
+        JsonObject event = events_view["items"][event_index_for_row(index)].as<JsonObject>();
+        String title = event["title"] | "Untitled";
+        struct tm event_time = convertUTCToGMT3(event["startTime"] | "");
+
+        char display_text[100];
+        snprintf(display_text, sizeof(display_text), "%s (%02d:%02d)",
+                 title.c_str(), event_time.tm_hour, event_time.tm_min);
+        lv_label_set_text(label, display_text);
+    }
 
-        if (index < 0 || index >= (intptr_t)events_doc["items"].size())
+    static void event_row_clicked(uint32_t row)
+    {
+        uint32_t index = event_index_for_row(row);
+        if (index >= events_view["items"].size())
         {
             LV_LOG_ERROR("Invalid event index selected: %d", (int)index);
             return;
@@ -411,7 +444,7 @@ namespace Calendar
 
         selected_event_index = (int)index;
 
-        JsonObject event = events_doc["items"][selected_event_index].as<JsonObject>();
+        JsonObject event = events_view["items"][selected_event_index].as<JsonObject>();
         const char *title = event["title"] | "";
         const char *start = event["startTime"] | "";
         struct tm event_time_start = convertUTCToGMT3(start);
@@ -443,25 +476,20 @@ namespace Calendar
             lv_obj_del(event_modal_cont);
             event_modal_cont = nullptr;
         }
-        event_modal_cont = lv_obj_create(lv_scr_act());
-        lv_obj_set_size(event_modal_cont, LV_PCT(100), LV_PCT(100));
-        lv_obj_set_style_bg_color(event_modal_cont, lv_color_hex(0xFDF5E6), 0);
-        lv_obj_set_style_bg_opa(event_modal_cont, LV_OPA_80, 0);
-        lv_obj_set_style_border_width(event_modal_cont, 0, 0);
-        lv_obj_set_style_radius(event_modal_cont, 0, 0);
-        lv_obj_clear_flag(event_modal_cont, LV_OBJ_FLAG_SCROLLABLE);
-
-        event_cancel_btn = lv_btn_create(event_modal_cont);
-        lv_obj_align(event_cancel_btn, LV_ALIGN_TOP_RIGHT, -5, 5);
-        lv_obj_set_size(event_cancel_btn, 40, 40);
-        lv_obj_set_style_radius(event_cancel_btn, LV_RADIUS_CIRCLE, 0);
-        lv_obj_set_style_bg_opa(event_cancel_btn, LV_OPA_50, 0);
-        lv_obj_set_style_bg_color(event_cancel_btn, lv_color_hex(0x1A5FB4), 0);
-        lv_obj_add_event_cb(event_cancel_btn, event_cancel_btn_event_cb, LV_EVENT_CLICKED, NULL);
 
-        lv_obj_t *cancel_label = lv_label_create(event_cancel_btn);
-        lv_label_set_text(cancel_label, LV_SYMBOL_CLOSE);
-        lv_obj_center(cancel_label);
+        // The group outlives the modal, so it must not live in the modal arena.
+        if (!event_modal_group)
+        {
+            event_modal_group = lv_group_create();
+        }
+
+        LvMem::arena_renew(modal_arena, "calendar.modal");
+        LvMem::ArenaScope arena_scope(modal_arena);
+
+        event_modal_cont = PdaTheme::create_modal(lv_scr_act());
+
+        event_cancel_btn = PdaTheme::create_round_button(event_modal_cont, LV_SYMBOL_CLOSE, event_cancel_btn_event_cb);
+        lv_obj_align(event_cancel_btn, LV_ALIGN_TOP_RIGHT, -5, 5);
 
         event_title_textarea = lv_textarea_create(event_modal_cont);
         lv_textarea_set_one_line(event_title_textarea, true);
@@ -529,10 +557,6 @@ namespace Calendar
         else
             lv_textarea_set_text(event_description_textarea, "");
 
-        if (!event_modal_group)
-        {
-            event_modal_group = lv_group_create();
-        }
         lv_group_add_obj(event_modal_group, event_title_textarea);
         lv_group_add_obj(event_modal_group, event_start_textarea);
         lv_group_add_obj(event_modal_group, event_end_textarea);
@@ -544,30 +568,13 @@ namespace Calendar
             lv_indev_set_group(indev, event_modal_group);
         }
 
-        event_save_btn = lv_btn_create(event_modal_cont);
-        lv_obj_set_size(event_save_btn, 40, 40);
+        event_save_btn = PdaTheme::create_round_button(event_modal_cont, LV_SYMBOL_SAVE, event_save_btn_event_cb);
         lv_obj_align(event_save_btn, LV_ALIGN_BOTTOM_MID, -25, 5);
-        lv_obj_set_style_radius(event_save_btn, LV_RADIUS_CIRCLE, 0);
-        lv_obj_set_style_bg_opa(event_save_btn, LV_OPA_50, 0);
-        lv_obj_set_style_bg_color(event_save_btn, lv_color_hex(0x1A5FB4), 0);
-        lv_obj_add_event_cb(event_save_btn, event_save_btn_event_cb, LV_EVENT_CLICKED, NULL);
-
-        lv_obj_t *save_label = lv_label_create(event_save_btn);
-        lv_label_set_text(save_label, LV_SYMBOL_SAVE);
-        lv_obj_center(save_label);
 
         if (is_editing_event)
         {
-            event_delete_btn = lv_btn_create(event_modal_cont);
-            lv_obj_set_size(event_delete_btn, 40, 40);
+            event_delete_btn = PdaTheme::create_round_button(event_modal_cont, LV_SYMBOL_CLOSE, event_delete_btn_event_cb, true);
             lv_obj_align(event_delete_btn, LV_ALIGN_BOTTOM_MID, 25, 5);
-            lv_obj_set_style_radius(event_delete_btn, LV_RADIUS_CIRCLE, 0);
-            lv_obj_set_style_bg_opa(event_delete_btn, LV_OPA_50, 0);
-            lv_obj_set_style_bg_color(event_delete_btn, lv_color_hex(0xB00020), 0);
-            lv_obj_t *delete_label = lv_label_create(event_delete_btn);
-            lv_label_set_text(delete_label, LV_SYMBOL_CLOSE);
-            lv_obj_center(delete_label);
-            lv_obj_add_event_cb(event_delete_btn, event_delete_btn_event_cb, LV_EVENT_CLICKED, NULL);
         }
     }
 
@@ -585,10 +592,13 @@ namespace Calendar
             event_cancel_btn = nullptr;
             event_delete_btn = nullptr;
         }
+        LvMem::arena_release(modal_arena);
+        modal_arena = nullptr;
     }
 
     static int doPostWithRedirect(const String &payload)
     {
+        STALL_SITE("Calendar::doPostWithRedirect");
         HTTPClient http;
         String url = GOOGLE_SCRIPT_URL_CALENDAR;
 
@@ -714,7 +724,7 @@ namespace Calendar
         
         if (is_editing_event && selected_event_index >= 0) {
             // Extract day from existing event
-            JsonObject event = events_doc["items"][selected_event_index].as<JsonObject>();
+            JsonObject event = events_view["items"][selected_event_index].as<JsonObject>();
             const char *existing_start = event["startTime"] | "";
             const char *existing_end = event["endTime"] | "";
             if (strlen(existing_start) >= 10 && strlen(existing_end) >= 10) {
@@ -772,7 +782,7 @@ namespace Calendar
 
         if (is_editing_event && selected_event_index >= 0)
         {
-            JsonObject event = events_doc["items"][selected_event_index].as<JsonObject>();
+            JsonObject event = events_view["items"][selected_event_index].as<JsonObject>();
             const char *id = event["id"] | "";
             update_event(id, title, start_datetime, end_datetime, description, location);
         }
@@ -802,17 +812,16 @@ namespace Calendar
     static void update_events_ui(JsonVariant doc)
     {
 
-        // Ensure events list is visible and clean it
+        // Ensure events list is visible; the full list is not filtered by day
         lv_obj_clear_flag(events_list, LV_OBJ_FLAG_HIDDEN);
-        lv_obj_clean(events_list);
-
-        // Apply styling similar to notes list
-        lv_obj_set_style_bg_opa(events_list, LV_OPA_TRANSP, 0);
-        lv_obj_set_style_border_width(events_list, 0, 0);
+        lv_mem_free(shown_events);
+        shown_events = nullptr;
+        shown_capacity = 0;
 
         auto &&events_var = doc["items"];
         if (!events_var.is<JsonArray>() || events_var.as<JsonArray>().size() == 0)
         {
+            VirtualList::set_count(&events_vlist, 0);
             // Hide the empty list so it doesn't interfere
             lv_obj_add_flag(events_list, LV_OBJ_FLAG_HIDDEN);
 
@@ -820,33 +829,8 @@ namespace Calendar
             return;
         }
 
-        auto &&events = events_var.as<JsonArray>();
-
-        for (int i = 0; i < (int)events.size(); i++)
-        {
-            JsonObject event = events[i].as<JsonObject>();
-            String title = event["title"] | "Untitled";
-                    const char *start = event["startTime"] | "";
-            struct tm event_time = convertUTCToGMT3(start);
-
-            title = Utils::sanitizeString(title);
-                                        char display_text[100];
-                            snprintf(display_text, sizeof(display_text), "%s (%02d:%02d)", 
-                                     title.c_str(), event_time.tm_hour, event_time.tm_min);
-            lv_obj_t *btn = lv_list_add_btn(events_list, NULL, display_text);
-            lv_obj_set_user_data(btn, (void *)(intptr_t)i);
-            lv_obj_add_event_cb(btn, event_list_item_click_event_cb, LV_EVENT_CLICKED, NULL);
-        }
-
-        // Style each child item in the list to fix background and text color
-        uint32_t child_count = lv_obj_get_child_cnt(events_list);
-        for (uint32_t i = 0; i < child_count; i++)
-        {
-            lv_obj_t *child = lv_obj_get_child(events_list, i);
-            lv_obj_set_style_bg_opa(child, LV_OPA_TRANSP, LV_PART_MAIN);
-            lv_obj_set_style_border_width(child, 0, LV_PART_MAIN);
-            lv_obj_set_style_text_color(child, lv_color_hex(0x0B3C5D), LV_PART_MAIN);
-        }
+        // Only the visible rows are bound; the rest are filled in as the list scrolls.
+        VirtualList::set_count(&events_vlist, events_var.as<JsonArray>().size());
     }
 
     static void set_fetch_error_status(const String &message)
@@ -865,7 +849,9 @@ namespace Calendar
         if (xSemaphoreTake(data_mutex, portMAX_DELAY) == pdTRUE)
         {
             events_doc.clear();
+            PDA_TRACE_BEGIN("calendar.json_parse");
             DeserializationError error = deserializeJson(events_doc, payload);
+            PDA_TRACE_END("calendar.json_parse");
             if (error)
             {
                 LV_LOG_ERROR("deserializeJson() failed: %s", error.c_str());
@@ -892,7 +878,9 @@ namespace Calendar
         const char *headerKeys[] = {"location"};
         http.collectHeaders(headerKeys, 1);
 
+        PDA_TRACE_BEGIN("calendar.http_get");
         int http_code = http.GET();
+        PDA_TRACE_END("calendar.http_get");
 
         if (http_code == HTTP_CODE_MOVED_PERMANENTLY || http_code == HTTP_CODE_FOUND)
         {
@@ -904,14 +892,18 @@ namespace Calendar
             {
                 http.begin(url);
                 http.addHeader("User-Agent", "Mozilla/5.0 (compatible; ESP32)");
+                PDA_TRACE_BEGIN("calendar.http_get");
                 http_code = http.GET();
+                PDA_TRACE_END("calendar.http_get");
                 LV_LOG_USER("Second GET HTTP code: %d", http_code);
             }
         }
 
         if (http_code == HTTP_CODE_OK)
         {
+            PDA_TRACE_BEGIN("calendar.http_read");
             String payload = http.getString();
+            PDA_TRACE_END("calendar.http_read");
             LV_LOG_USER("Payload received: %s", payload.c_str());
             process_and_store_payload(payload);
         }
@@ -925,6 +917,7 @@ namespace Calendar
         http.end();
 
         fetch_event_task_handle = NULL;
+        SysMonitor::record_stack("FetchEvents");
         vTaskDelete(NULL);
     }
 
@@ -981,65 +974,24 @@ namespace Calendar
         }
         LV_LOG_USER("Current year: %d, current month: %d", current_year, current_month);
 
-        calendar_screen = lv_obj_create(NULL);
-        lv_obj_add_flag(calendar_screen, LV_OBJ_FLAG_HIDDEN);
-        lv_obj_set_size(calendar_screen, 320, 240);
-        lv_obj_set_style_bg_color(calendar_screen, lv_color_hex(0xFDF5E6), LV_PART_MAIN);
+        calendar_screen = PdaTheme::create_screen();
 
         lv_obj_add_flag(calendar_screen, LV_OBJ_FLAG_CLICKABLE);
         lv_obj_add_event_cb(calendar_screen, refresh_event_cb, LV_EVENT_CLICKED, NULL);
 
-        back_btn = lv_btn_create(calendar_screen);
-        lv_obj_align(back_btn, LV_ALIGN_TOP_LEFT, 5, 5);
-        lv_obj_add_event_cb(back_btn, back_button_event_cb, LV_EVENT_CLICKED, NULL);
-        lv_obj_set_style_bg_color(back_btn, lv_color_hex(0x1A5FB4), LV_PART_MAIN);
-        lv_obj_set_style_bg_opa(back_btn, LV_OPA_50, LV_PART_MAIN);
-        lv_obj_set_style_radius(back_btn, 12, LV_PART_MAIN);
-        lv_obj_set_style_border_width(back_btn, 0, LV_PART_MAIN);
-        lv_obj_set_style_shadow_opa(back_btn, 0, LV_PART_MAIN);
-
-        lv_obj_t *back_label = lv_label_create(back_btn);
-        lv_label_set_text(back_label, LV_SYMBOL_LEFT);
-        lv_obj_set_style_text_color(back_label, lv_color_hex(0xFFFFFF), 0);
-        lv_obj_set_style_text_font(back_label, &lv_font_montserrat_16, 0);
-        lv_obj_center(back_label);
-
-        title_label = lv_label_create(calendar_screen);
-        lv_label_set_text(title_label, "Calendar");
-        lv_obj_set_style_text_font(title_label, &lv_font_montserrat_28, 0);
-        lv_obj_set_style_text_color(title_label, lv_color_hex(0x0B3C5D), 0);
-        lv_obj_align(title_label, LV_ALIGN_TOP_MID, 0, 10);
-
-        events_list = lv_list_create(calendar_screen);
+        back_btn = PdaTheme::create_back_button(calendar_screen, back_button_event_cb);
+
+        title_label = PdaTheme::create_title(calendar_screen, "Calendar");
+
+        events_list = VirtualList::create(&events_vlist, calendar_screen, bind_event_row, event_row_clicked);
         lv_obj_set_size(events_list, 300, 180);
         lv_obj_align(events_list, LV_ALIGN_CENTER, 0, 20);
-        lv_obj_set_style_bg_opa(events_list, LV_OPA_TRANSP, 0);
-        lv_obj_set_style_border_width(events_list, 0, 0);
-
-        lv_obj_t *add_event_btn = lv_btn_create(calendar_screen);
-        lv_obj_set_size(add_event_btn, 40, 40);
-        lv_obj_align(add_event_btn, LV_ALIGN_BOTTOM_LEFT, 10, -10);
-        lv_obj_set_style_bg_color(add_event_btn, lv_color_hex(0x1A5FB4), LV_PART_MAIN);
-        lv_obj_set_style_bg_opa(add_event_btn, LV_OPA_70, LV_PART_MAIN);
-        lv_obj_set_style_radius(add_event_btn, LV_RADIUS_CIRCLE, LV_PART_MAIN);
-        lv_obj_set_style_border_width(add_event_btn, 0, LV_PART_MAIN);
-        lv_obj_set_style_shadow_opa(add_event_btn, 0, LV_PART_MAIN);
-
-        lv_obj_t *add_event_label = lv_label_create(add_event_btn);
-        lv_label_set_text(add_event_label, "+");
-        lv_obj_set_style_text_color(add_event_label, lv_color_hex(0xFFFFFF), 0);
-        lv_obj_set_style_text_font(add_event_label, &lv_font_montserrat_28, 0);
-        lv_obj_center(add_event_label);
-
-        lv_obj_add_event_cb(add_event_btn, add_event_btn_event_cb, LV_EVENT_CLICKED, NULL);
+
+        PdaTheme::create_add_button(calendar_screen, add_event_btn_event_cb);
 
         build_calendar_grid();
 
-        status_label = lv_label_create(calendar_screen);
-        lv_label_set_text(status_label, "");
-        lv_obj_set_style_text_font(status_label, &lv_font_montserrat_12, 0);
-        lv_obj_set_style_text_color(status_label, lv_color_hex(0x324A5F), 0);
-        lv_obj_align(status_label, LV_ALIGN_BOTTOM_RIGHT, -10, -10);
+        status_label = PdaTheme::create_status_label(calendar_screen);
     }
 
     inline void show()
@@ -1055,6 +1007,7 @@ namespace Calendar
 
     inline void handle()
     {
+        PDA_TRACE_SCOPE("Calendar::handle");
         if (event_modal_cont)
         {
             char key = Keyboard::get_key();
@@ -1117,19 +1070,29 @@ namespace Calendar
                 }
             }
         }
+        else if (!lv_obj_has_flag(events_list, LV_OBJ_FLAG_HIDDEN))
+        {
+            // Trackball navigation through the events list
+            if (Trackball::moved_down()) VirtualList::move_selection(&events_vlist, 1);
+            if (Trackball::moved_up()) VirtualList::move_selection(&events_vlist, -1);
+            if (Trackball::clicked()) VirtualList::activate_selection(&events_vlist);
+        }
 
         if (data_ready_for_ui)
         {
             if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE)
             {
+                // Takes the new data (or the cleared document on error) and frees the old
+                swap(events_view, events_doc);
+                events_doc.clear();
                 if (!fetch_status_message.isEmpty())
                 {
                     lv_label_set_text(status_label, fetch_status_message.c_str());
-                    lv_obj_clean(events_list);
+                    VirtualList::set_count(&events_vlist, 0);
                 }
                 else
                 {
-                    update_events_ui(events_doc.as<JsonObject>());
+                    update_events_ui(events_view.as<JsonObject>());
                     lv_label_set_text(status_label, "");
                 }
                 data_ready_for_ui = false;
@@ -5,18 +5,14 @@
 // Este arquivo é incluído a partir de `apps.h`, que já define o AppManager.
 // Portanto, não são necessárias declarações prévias ou includes adicionais aqui.
 
-// Inclua todos os arquivos .c dos ícones aqui.
-// Certifique-se de que esses arquivos foram gerados pelo LVGL Image Converter
-// e estão no caminho correto do seu projeto.
-#include "Icons/lv_img_calculator.c"
-#include "Icons/lv_img_notes.c"
-#include "Icons/lv_img_sketch.c"
-#include "Icons/lv_img_weather.c"
-#include "Icons/lv_img_calendar.c"
-#include "Icons/lv_img_map.c"
-#include "Icons/lv_img_settings.c"
-#include "Icons/lv_img_audio.c"
-#include "Icons/lv_img_about.c"
+// Ícones já no tamanho da tela (RGB565A8), gerados por tools/icons/prescale_icons.py e
+// lidos do pacote de assets na flash (system/asset_pack.h), descomprimidos só no primeiro uso.
+// Nenhum ícone do launcher usa zoom, então o desenho não passa pela transformação por pixel.
+#include "system/asset_pack.h"
+#include "apps/pda_theme.h"
+#include "system/render_cache.h"
+#include "system/pda_trace.h"
+#include "system/pda_log.h"
 
 
 
@@ -48,25 +44,48 @@ namespace MainMenu {
 #define APP_COLS 4
 #define MAX_APPS (APP_ROWS * APP_COLS)
 
+#define ICON_SIZE_FULL 100      // Tamanho de referência do layout (ícone original)
+#define ICON_PULSE_FRAMES 3     // Quadros do pulso: 100, 104 e 108 px
+
 // Nomes dos aplicativos, conforme a imagem
 const char* app_names[MAX_APPS] = {
     "Calculator", "Notes", "Sketch",
     "Weather", "Calendar", "Map",
-    "Settings", "Audio", "About"
+    "Settings", "Audio", "About",
+    "Monitor"
+};
+
+// Ícones dos apps não selecionados (80 px, o antigo zoom LV_IMG_ZOOM_NONE-50).
+// No pacote, cada variante tem o sufixo do tamanho: 'launcher/<nome>_<px>'.
+#define LAUNCHER_ICON(name, px) ASSET_PATH("launcher/" #name "_" #px)
+#define ICON_SIZE_SMALL 80
+
+const char* app_icons[MAX_APPS] = {
+    LAUNCHER_ICON(calculator, 80), // Ícone da calculadora
+    LAUNCHER_ICON(notes, 80),      // Ícone de notas
+    LAUNCHER_ICON(sketch, 80),     // Ícone de esboço/pintura
+    LAUNCHER_ICON(weather, 80),    // Ícone de clima/sol
+    LAUNCHER_ICON(calendar, 80),   // Ícone de calendário
+    LAUNCHER_ICON(map, 80),        // Ícone de mapa
+    LAUNCHER_ICON(settings, 80),   // Ícone de configurações
+    LAUNCHER_ICON(audio, 80),      // Ícone de áudio
+    LAUNCHER_ICON(about, 80),      // Ícone de informações
+    LAUNCHER_ICON(monitor, 80)     // Ícone do monitor do sistema
 };
 
-// Array de ponteiros para as estruturas lv_img_dsc_t dos ícones.
-// O LVGL Image Converter gera variáveis com o prefixo 'lv_img_'.
-const lv_img_dsc_t* app_icons[MAX_APPS] = {
-    &lv_img_calculator, // Referência ao ícone da calculadora
-    &lv_img_notes,      // Referência ao ícone de notas
-    &lv_img_sketch,     // Referência ao ícone de esboço/pintura
-    &lv_img_weather,    // Referência ao ícone de clima/sol
-    &lv_img_calendar,   // Referência ao ícone de calendário
-    &lv_img_map,        // Referência ao ícone de mapa
-    &lv_img_settings,   // Referência ao ícone de configurações
-    &lv_img_audio,      // Referência ao ícone de áudio
-    &lv_img_about       // Referência ao ícone de informações
+// Quadros da animação de pulso do ícone selecionado (o antigo zoom de 256 a 276).
+const lv_coord_t icon_pulse_sizes[ICON_PULSE_FRAMES] = { 100, 104, 108 };
+const char* app_icon_pulse[MAX_APPS][ICON_PULSE_FRAMES] = {
+    { LAUNCHER_ICON(calculator, 100), LAUNCHER_ICON(calculator, 104), LAUNCHER_ICON(calculator, 108) },
+    { LAUNCHER_ICON(notes, 100),      LAUNCHER_ICON(notes, 104),      LAUNCHER_ICON(notes, 108) },
+    { LAUNCHER_ICON(sketch, 100),     LAUNCHER_ICON(sketch, 104),     LAUNCHER_ICON(sketch, 108) },
+    { LAUNCHER_ICON(weather, 100),    LAUNCHER_ICON(weather, 104),    LAUNCHER_ICON(weather, 108) },
+    { LAUNCHER_ICON(calendar, 100),   LAUNCHER_ICON(calendar, 104),   LAUNCHER_ICON(calendar, 108) },
+    { LAUNCHER_ICON(map, 100),        LAUNCHER_ICON(map, 104),        LAUNCHER_ICON(map, 108) },
+    { LAUNCHER_ICON(settings, 100),   LAUNCHER_ICON(settings, 104),   LAUNCHER_ICON(settings, 108) },
+    { LAUNCHER_ICON(audio, 100),      LAUNCHER_ICON(audio, 104),      LAUNCHER_ICON(audio, 108) },
+    { LAUNCHER_ICON(about, 100),      LAUNCHER_ICON(about, 104),      LAUNCHER_ICON(about, 108) },
+    { LAUNCHER_ICON(monitor, 100),    LAUNCHER_ICON(monitor, 104),    LAUNCHER_ICON(monitor, 108) }
 };
 
 // --- Variáveis de UI ---
@@ -77,18 +96,36 @@ lv_style_t style_container_normal;
 lv_style_t style_container_selected;
 int8_t selected_app_index = 4; // Começa com o "Calendar" selecionado (índice 4)
 
+/**
+ * Troca o ícone por uma variante pré-escalada, mantendo o centro no mesmo
+ * lugar (como o zoom fazia, já que ele escala em torno do centro).
+ */
+inline void set_icon_frame(lv_obj_t* icon, const char* path, lv_coord_t size) {
+    // Posições vazias da grade não têm ícone: nada a trocar nem a invalidar
+    if (!path) return;
+    // O lv_img guarda uma cópia do caminho, então a comparação é pelo texto.
+    const void* current = lv_img_get_src(icon);
+    if (current && lv_img_src_get_type(current) == LV_IMG_SRC_FILE && strcmp((const char*)current, path) == 0) return;
+    lv_img_set_src(icon, path);
+    // O tamanho é fixo para o layout não depender do pacote ter sido gravado.
+    lv_obj_set_size(icon, size, size);
+    lv_obj_align(icon, LV_ALIGN_TOP_MID, 0, -15 + (ICON_SIZE_FULL - size) / 2);
+}
+
 /**
  * Anima o ícone selecionado com um efeito de "pulso" para dar feedback visual.
+ * A animação só alterna entre os quadros pré-escalados do ícone.
  */
 inline void animate_selected_icon(lv_obj_t* icon) {
     lv_anim_t a;
     lv_anim_init(&a);
     lv_anim_set_var(&a, icon);
-    lv_anim_set_values(&a, LV_IMG_ZOOM_NONE, LV_IMG_ZOOM_NONE + 20); // Zoom sutil
+    lv_anim_set_values(&a, 0, ICON_PULSE_FRAMES - 1);
     lv_anim_set_time(&a, 150);
     lv_anim_set_playback_time(&a, 150);
     lv_anim_set_exec_cb(&a, [](void* obj, int32_t v) {
-        lv_img_set_zoom((lv_obj_t*)obj, v);
+        intptr_t app_index = (intptr_t)lv_obj_get_user_data((lv_obj_t*)obj);
+        set_icon_frame((lv_obj_t*)obj, app_icon_pulse[app_index][v], icon_pulse_sizes[v]);
     });
     lv_anim_start(&a);
 }
@@ -99,16 +136,17 @@ inline void animate_selected_icon(lv_obj_t* icon) {
  */
 inline void update_selection_visuals() {
     for (int i = 0; i < MAX_APPS; ++i) {
+        // Remove antes de aplicar: cada lv_obj_add_style() acrescenta uma entrada,
+        // e a lista de estilos do objeto crescia a cada toque até estourar
+        lv_obj_remove_style(app_containers[i], &style_container_selected, LV_PART_MAIN);
         if (i == selected_app_index) {
-            // Aplica o estilo de seleção (borda azul)
+            // Aplica o estilo de seleção (borda azul); o normal fica desde a criação
             lv_obj_add_style(app_containers[i], &style_container_selected, LV_PART_MAIN);
             animate_selected_icon(app_icons_img[i]);
         } else {
-            // Garante que o estilo de seleção foi removido e aplica o normal
-            lv_obj_remove_style(app_containers[i], &style_container_selected, LV_PART_MAIN);
-            lv_obj_add_style(app_containers[i], &style_container_normal, LV_PART_MAIN);
-            // Reseta o zoom de ícones não selecionados
-            lv_img_set_zoom(app_icons_img[i], LV_IMG_ZOOM_NONE-50);
+            // Para o pulso e volta à variante pequena dos ícones não selecionados
+            lv_anim_del(app_icons_img[i], NULL);
+            set_icon_frame(app_icons_img[i], app_icons[i], ICON_SIZE_SMALL);
         }
     }
 }
@@ -140,12 +178,9 @@ static void app_click_event_cb(lv_event_t* e) {
  */
 inline void init() {
     // Cria uma tela dedicada para o menu principal.
+    // O fundo vem do tema (PdaTheme).
     main_menu_screen = lv_obj_create(NULL);
 
-    // --- Estilo da Tela Principal ---
-    lv_obj_set_style_bg_color(main_menu_screen, lv_color_hex(0xFDF5E6), LV_PART_MAIN);
-
-
     // --- Estilo para Contêineres de App (Normal) ---
     // Transparente, sem borda, para que apenas o ícone e o texto apareçam
     lv_style_init(&style_container_normal);
@@ -170,8 +205,7 @@ inline void init() {
     lv_obj_set_size(grid, 320, 240);
     lv_obj_align(grid, LV_ALIGN_CENTER, 0, 0);
     lv_obj_set_layout(grid, LV_LAYOUT_GRID);
-    lv_obj_set_style_bg_opa(grid, LV_OPA_TRANSP, 0); // Torna o fundo da grade transparente
-    lv_obj_set_style_border_width(grid, 0, 0);
+    lv_obj_add_style(grid, &PdaTheme::style_transparent, 0);
     lv_obj_set_style_pad_all(grid, 0, 0);
     lv_obj_set_style_pad_gap(grid, 0, 0);
     
@@ -197,9 +231,8 @@ inline void init() {
 
         // Ícone do aplicativo
         app_icons_img[i] = lv_img_create(app_containers[i]);
-        lv_img_set_src(app_icons_img[i], app_icons[i]);
-        lv_obj_align(app_icons_img[i], LV_ALIGN_TOP_MID, 0, -15);
-        lv_img_set_zoom(app_icons_img[i], LV_IMG_ZOOM_NONE - 20);
+        lv_obj_set_user_data(app_icons_img[i], (void*)(intptr_t)i);
+        set_icon_frame(app_icons_img[i], app_icons[i], ICON_SIZE_SMALL);
 
         // Rótulo do aplicativo
         lv_obj_t* label = lv_label_create(app_containers[i]);
@@ -207,6 +240,10 @@ inline void init() {
         lv_label_set_text(label, app_names[i]);
         lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
         lv_obj_align(label, LV_ALIGN_BOTTOM_MID, 0, 0);
+
+        // Cada contêiner tem sua camada retida: o pulso do ícone selecionado só
+        // redesenha o próprio contêiner, os outros são copiados da camada.
+        RenderCache::enable(app_containers[i], app_names[i]);
     }
 
     update_selection_visuals();
@@ -225,7 +262,7 @@ inline void show() {
  */
 inline void launch_selected_app() {
     const char* selected_app_name = app_names[selected_app_index];
-    Serial.printf("Abrindo aplicativo: %s\n", selected_app_name);
+    pda_log(PDA_LOG_MENU, PDA_LOG_USER, "Abrindo aplicativo: %s", selected_app_name);
 
     // Compara o nome do aplicativo selecionado e chama a função 'show' correspondente.
     if (strcmp(selected_app_name, "Calculator") == 0) {
@@ -239,6 +276,8 @@ inline void launch_selected_app() {
         AppManager::show_app(AppManager::APP_NOTES);
     } else if (strcmp(selected_app_name, "Calendar") == 0) {
         AppManager::show_app(AppManager::APP_CALENDAR);
+    } else if (strcmp(selected_app_name, "Monitor") == 0) {
+        AppManager::show_app(AppManager::APP_MONITOR);
     }
 }
 
@@ -246,6 +285,7 @@ inline void launch_selected_app() {
  * Gerencia a entrada do trackball e atualiza a interface.
  */
 inline void handle() {
+    PDA_TRACE_SCOPE("MainMenu::handle");
     int8_t col = selected_app_index % APP_COLS;
     int8_t row = selected_app_index / APP_COLS;
 
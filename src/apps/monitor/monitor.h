@@ -0,0 +1,382 @@
+#pragma once
+#include <lvgl.h>
+#include <WiFi.h>
+#include "input/input.h"
+#include "apps/pda_theme.h"
+#include "system/sys_monitor.h"
+#include "system/pda_trace.h"
+#include "system/stall_detector.h"
+#include "system/pda_log.h"
+#include "system/spi_bus.h"
+#include "system/tft_rgb444.h"
+#include "system/sd_card.h"
+
+// Incluído a partir de apps.h, que já define o AppManager.
+
+/**
+ * Monitor - CPU, memória e quadros do aparelho em tempo real
+ *
+ * Mostra o que o SysMonitor amostra a cada segundo:
+ * - Carga da CPU (por núcleo, ou só a do LVGL sem as run-time stats do FreeRTOS)
+ * - SRAM interna e PSRAM: livre, maior bloco e mínimo desde o boot, e o que o LVGL usa
+ * - Tempos de render e flush dos quadros
+ * - Tarefas por CPU, com a folga de pilha, e a marca d'água das buscas na rede
+ * - Travamentos da UI vistos pelo StallDetector (quantos e o pior)
+ * - Log: mensagens, custo por chamada e perdas do PdaLog
+ * - Ocupação do barramento SPI por dispositivo (SpiBus)
+ * - Quadros enviados em RGB444 (TftRgb444) e os bytes poupados
+ * - Cartão SD: vazão, leituras servidas pelo cache e latência das leituras do LVGL
+ * - RSSI do Wi-Fi e o custo do próprio amostrador
+ *
+ * Os gráficos apontam direto para o histórico do SysMonitor; cada amostra só
+ * desloca o início e invalida os gráficos, e apenas com a tela visível.
+ * Trackball: cima/baixo rola a tela, clique volta ao menu.
+ */
+
+namespace Monitor {
+
+#define MONITOR_TABLE_TASKS 8   // Tarefas mostradas na tabela (as de maior CPU)
+#define MONITOR_SCROLL_STEP 60
+
+// --- UI Variables ---
+static lv_obj_t* monitor_screen = nullptr;
+static lv_obj_t* content = nullptr;
+static lv_obj_t* cpu_label = nullptr;
+static lv_obj_t* cpu_chart = nullptr;
+static lv_obj_t* heap_label = nullptr;
+static lv_obj_t* heap_chart = nullptr;
+static lv_obj_t* frame_label = nullptr;
+static lv_obj_t* frame_chart = nullptr;
+static lv_obj_t* task_table = nullptr;
+static lv_obj_t* wifi_label = nullptr;
+static lv_obj_t* stall_label = nullptr;
+static lv_obj_t* log_label = nullptr;
+static lv_obj_t* spi_label = nullptr;
+static lv_obj_t* panel_label = nullptr;
+static lv_obj_t* sd_label = nullptr;
+static lv_obj_t* status_label = nullptr;
+
+static lv_chart_series_t* cpu_series = nullptr;
+static lv_chart_series_t* sram_series = nullptr;
+static lv_chart_series_t* psram_series = nullptr;
+static lv_chart_series_t* frame_series = nullptr;
+
+static lv_style_t style_caption;
+static lv_style_t style_chart;
+static lv_style_t style_cell;
+
+/**
+ * @brief Callback para o botão de voltar. Retorna ao menu principal.
+ */
+static void back_button_event_cb(lv_event_t* e) {
+    AppManager::show_app(AppManager::APP_MAIN_MENU);
+}
+
+static lv_obj_t* create_caption(const char* text) {
+    lv_obj_t* label = lv_label_create(content);
+    lv_label_set_text(label, text);
+    lv_obj_add_style(label, &style_caption, LV_PART_MAIN);
+    lv_obj_set_width(label, lv_pct(100));
+    lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
+    return label;
+}
+
+/**
+ * @brief Gráfico de linha sobre um buffer de histórico do SysMonitor.
+ */
+static lv_obj_t* create_chart(lv_coord_t max) {
+    lv_obj_t* chart = lv_chart_create(content);
+    lv_obj_add_style(chart, &style_chart, LV_PART_MAIN);
+    lv_obj_set_size(chart, lv_pct(100), 56);
+    lv_obj_set_style_size(chart, 0, LV_PART_INDICATOR); // Sem marcadores nos pontos
+    lv_obj_set_style_line_width(chart, 2, LV_PART_ITEMS);
+    lv_chart_set_type(chart, LV_CHART_TYPE_LINE);
+    lv_chart_set_point_count(chart, SYS_MONITOR_HISTORY);
+    lv_chart_set_div_line_count(chart, 3, 0);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, 0, max);
+    return chart;
+}
+
+static lv_chart_series_t* add_series(lv_obj_t* chart, uint32_t color, lv_chart_axis_t axis, lv_coord_t* history) {
+    lv_chart_series_t* ser = lv_chart_add_series(chart, lv_color_hex(color), axis);
+    lv_chart_set_ext_y_array(chart, ser, history);
+    return ser;
+}
+
+static void format_kb(char* buf, size_t size, uint32_t bytes) {
+    if (bytes >= 1024 * 1024) snprintf(buf, size, "%lu.%lu MB", (unsigned long)(bytes >> 20),
+                                       (unsigned long)((bytes & 0xFFFFF) * 10 >> 20));
+    else snprintf(buf, size, "%lu KB", (unsigned long)(bytes >> 10));
+}
+
+/**
+ * @brief "SRAM 180/320 KB, block 96 KB, min 150 KB": livre/total, maior bloco e mínimo.
+ */
+static void format_tier(char* buf, size_t size, const char* name, const SysMonitor::HeapTier& t) {
+    char free_s[16], total_s[16], largest_s[16], min_s[16];
+    format_kb(free_s, sizeof(free_s), t.free);
+    format_kb(total_s, sizeof(total_s), t.total);
+    format_kb(largest_s, sizeof(largest_s), t.largest);
+    format_kb(min_s, sizeof(min_s), t.min_free);
+    // A unidade só aparece no total quando as duas são iguais
+    char* unit = strchr(free_s, ' ');
+    if (unit && strcmp(unit, strchr(total_s, ' ')) == 0) *unit = '\0';
+    snprintf(buf, size, "%s %s/%s, block %s, min %s", name, free_s, total_s, largest_s, min_s);
+}
+
+static void update_charts() {
+    lv_obj_t* charts[] = {cpu_chart, heap_chart, frame_chart};
+    lv_chart_set_x_start_point(cpu_chart, cpu_series, SysMonitor::history_head);
+    lv_chart_set_x_start_point(heap_chart, sram_series, SysMonitor::history_head);
+    lv_chart_set_x_start_point(heap_chart, psram_series, SysMonitor::history_head);
+    lv_chart_set_x_start_point(frame_chart, frame_series, SysMonitor::history_head);
+    for (lv_obj_t* chart : charts) lv_chart_refresh(chart);
+}
+
+static void update_labels() {
+    const SysMonitor::Snapshot& s = SysMonitor::latest();
+    char buf[160];
+
+    if (s.tasks_available) {
+        snprintf(buf, sizeof(buf), "CPU core 0 %u%%, core 1 %u%%, LVGL %u%%",
+                 s.core_load_permille[0] / 10, s.core_load_permille[1] / 10, s.lvgl_load_permille / 10);
+    } else if (s.cores_available) {
+        snprintf(buf, sizeof(buf), "CPU core 0 %u%%, core 1 %u%%, LVGL %u%% (idle hooks)",
+                 s.core_load_permille[0] / 10, s.core_load_permille[1] / 10, s.lvgl_load_permille / 10);
+    } else {
+        snprintf(buf, sizeof(buf), "LVGL load %u%% (no per-task run-time stats)", s.lvgl_load_permille / 10);
+    }
+    lv_label_set_text(cpu_label, buf);
+
+    char sram_s[96], psram_s[96], lv_sram[16], lv_psram[16];
+    format_tier(sram_s, sizeof(sram_s), "SRAM", s.sram);
+    format_tier(psram_s, sizeof(psram_s), "PSRAM", s.psram);
+    format_kb(lv_sram, sizeof(lv_sram), s.lvgl.sram.bytes_in_use);
+    format_kb(lv_psram, sizeof(lv_psram), s.lvgl.psram.bytes_in_use);
+    lv_label_set_text_fmt(heap_label, "%s\n%s\nLVGL uses %s SRAM + %s PSRAM", sram_s, psram_s, lv_sram, lv_psram);
+
+    snprintf(buf, sizeof(buf), "%lu frames in %lu ms\nrender %lu.%lu ms (max %lu.%lu), flush %lu.%lu (max %lu.%lu)",
+             (unsigned long)s.frames, (unsigned long)s.window_ms,
+             (unsigned long)(s.render_avg_us / 1000), (unsigned long)(s.render_avg_us / 100 % 10),
+             (unsigned long)(s.render_max_us / 1000), (unsigned long)(s.render_max_us / 100 % 10),
+             (unsigned long)(s.flush_avg_us / 1000), (unsigned long)(s.flush_avg_us / 100 % 10),
+             (unsigned long)(s.flush_max_us / 1000), (unsigned long)(s.flush_max_us / 100 % 10));
+    lv_label_set_text(frame_label, buf);
+
+    // Tabela: as tarefas de maior CPU e depois as buscas já encerradas
+    uint16_t row = 1;
+    uint8_t shown = s.task_count < MONITOR_TABLE_TASKS ? s.task_count : MONITOR_TABLE_TASKS;
+    if (!s.tasks_available) {
+        // Sem run-time stats não há CPU por tarefa
+        lv_table_set_cell_value(task_table, row, 0, "tasks");
+        lv_table_set_cell_value(task_table, row, 1, "n/a");
+        lv_table_set_cell_value(task_table, row, 2, "");
+        lv_table_set_cell_value(task_table, row, 3, "");
+        row++;
+    }
+    for (uint8_t i = 0; i < shown; i++, row++) {
+        const SysMonitor::TaskInfo& t = s.tasks[i];
+        lv_table_set_cell_value(task_table, row, 0, t.name);
+        lv_table_set_cell_value_fmt(task_table, row, 1, "%u.%u%%", t.cpu_permille / 10, t.cpu_permille % 10);
+        lv_table_set_cell_value_fmt(task_table, row, 2, "%lu", (unsigned long)t.stack_free);
+        if (t.core < 0) lv_table_set_cell_value(task_table, row, 3, "-");
+        else lv_table_set_cell_value_fmt(task_table, row, 3, "%d", t.core);
+    }
+    for (uint8_t i = 0; i < SysMonitor::stack_mark_count(); i++, row++) {
+        const SysMonitor::StackMark& m = SysMonitor::stack_mark(i);
+        lv_table_set_cell_value(task_table, row, 0, m.name);
+        lv_table_set_cell_value(task_table, row, 1, "ended");
+        lv_table_set_cell_value_fmt(task_table, row, 2, "%lu", (unsigned long)m.stack_free);
+        lv_table_set_cell_value_fmt(task_table, row, 3, "x%lu", (unsigned long)m.runs);
+    }
+    if (row == 1) {
+        lv_table_set_cell_value(task_table, row, 0, "-");
+        for (uint16_t col = 1; col < 4; col++) lv_table_set_cell_value(task_table, row, col, "");
+        row++;
+    }
+    lv_table_set_row_cnt(task_table, row);
+
+    if (WiFi.status() == WL_CONNECTED) {
+        lv_label_set_text_fmt(wifi_label, "Wi-Fi: %d dBm (%s)", (int)WiFi.RSSI(), WiFi.SSID().c_str());
+    } else {
+        lv_label_set_text(wifi_label, "Wi-Fi: not connected");
+    }
+
+    StallDetector::Stats stalls = StallDetector::stats();
+    if (stalls.stalls) {
+        lv_label_set_text_fmt(stall_label, "UI stalls: %lu, worst %lu ms in %s", (unsigned long)stalls.stalls,
+                              (unsigned long)stalls.worst_ms, stalls.worst_site ? stalls.worst_site : "?");
+    } else {
+        lv_label_set_text(stall_label, "UI stalls: none");
+    }
+
+    pda_log_stats_t log;
+    pda_log_get_stats(&log);
+    lv_label_set_text_fmt(log_label, "Log: %lu msgs, %lu ns/call (max %lu), %lu lost",
+                          (unsigned long)log.calls, (unsigned long)log.avg_ns, (unsigned long)log.max_ns,
+                          (unsigned long)(log.dropped + log.limited));
+
+    // Ocupação do SPI na janela da amostra: tempo no fio de cada dispositivo / janela
+    static uint64_t prev_busy_us[SPI_BUS_DEVICES] = {};
+    uint32_t busy_permille[SPI_BUS_DEVICES];
+    uint32_t total_permille = 0;
+    for (uint8_t i = 0; i < SPI_BUS_DEVICES; i++) {
+        SpiBus::DeviceStats spi = SpiBus::stats((SpiBusDevice)i);
+        uint64_t busy = spi.busy_us - prev_busy_us[i];
+        prev_busy_us[i] = spi.busy_us;
+        busy_permille[i] = s.window_ms ? (uint32_t)(busy / s.window_ms) : 0;
+        total_permille += busy_permille[i];
+    }
+    lv_label_set_text_fmt(spi_label, "SPI bus: %lu%% (TFT %lu%%, SD %lu%%, radio %lu%%)",
+                          (unsigned long)(total_permille / 10), (unsigned long)(busy_permille[SPI_BUS_TFT] / 10),
+                          (unsigned long)(busy_permille[SPI_BUS_SD] / 10),
+                          (unsigned long)(busy_permille[SPI_BUS_RADIO] / 10));
+
+    TftRgb444::Stats panel = TftRgb444::stats();
+    lv_label_set_text_fmt(panel_label, "Panel: %lu of %lu frames in RGB444, %lu KB saved, %lu settles",
+                          (unsigned long)panel.frames_444, (unsigned long)panel.frames,
+                          (unsigned long)(panel.bytes_saved / 1024), (unsigned long)panel.settles);
+
+    SdCard::Stats sd = SdCard::stats();
+    if (sd.mounted) {
+        uint32_t served = sd.hits + sd.waits + sd.misses;
+        lv_label_set_text_fmt(sd_label, "SD: %lu MB, %lu KB/s, %lu%% from cache, read %lu us avg (max %lu)",
+                              (unsigned long)sd.card_mb,
+                              (unsigned long)(sd.io_us ? sd.io_bytes * 1000000 / sd.io_us / 1024 : 0),
+                              (unsigned long)(served ? (sd.hits + sd.waits) * 100ULL / served : 0),
+                              (unsigned long)(sd.reads ? sd.read_us / sd.reads : 0), (unsigned long)sd.max_read_us);
+    } else {
+        lv_label_set_text(sd_label, "SD: no card");
+    }
+
+    // Custo do amostrador em centésimos de ponto percentual da janela
+    uint32_t cost = s.window_ms ? s.sampler_us * 100 / s.window_ms : 0;
+    lv_label_set_text_fmt(status_label, "Sampler: %lu us per %u ms (%lu.%02lu%% CPU)",
+                          (unsigned long)s.sampler_us, (unsigned)SYS_MONITOR_PERIOD_MS,
+                          (unsigned long)(cost / 100), (unsigned long)(cost % 100));
+}
+
+/**
+ * @brief Chamado pelo SysMonitor a cada amostra. Fora da tela do app, não faz nada.
+ */
+static void on_sample() {
+    if (lv_scr_act() != monitor_screen) return;
+    update_labels();
+    update_charts();
+}
+
+/**
+ * @brief Inicializa a tela do monitor e seus elementos.
+ */
+inline void init() {
+    lv_style_init(&style_caption);
+    lv_style_set_text_font(&style_caption, &lv_font_montserrat_12);
+    lv_style_set_text_color(&style_caption, lv_color_hex(PDA_COLOR_TEXT));
+
+    lv_style_init(&style_chart);
+    lv_style_set_bg_opa(&style_chart, LV_OPA_TRANSP);
+    lv_style_set_border_width(&style_chart, 1);
+    lv_style_set_border_color(&style_chart, lv_color_hex(PDA_COLOR_MUTED));
+    lv_style_set_border_opa(&style_chart, LV_OPA_30);
+    lv_style_set_radius(&style_chart, 0);
+    lv_style_set_pad_all(&style_chart, 2);
+    lv_style_set_line_width(&style_chart, 1); // Linhas de divisão
+    lv_style_set_line_color(&style_chart, lv_color_hex(PDA_COLOR_MUTED));
+    lv_style_set_line_opa(&style_chart, LV_OPA_20);
+
+    lv_style_init(&style_cell);
+    lv_style_set_text_font(&style_cell, &lv_font_montserrat_12);
+    lv_style_set_text_color(&style_cell, lv_color_hex(PDA_COLOR_TEXT));
+    lv_style_set_bg_opa(&style_cell, LV_OPA_TRANSP);
+    lv_style_set_pad_ver(&style_cell, 2);
+    lv_style_set_pad_hor(&style_cell, 4);
+    lv_style_set_border_width(&style_cell, 0);
+
+    monitor_screen = PdaTheme::create_screen();
+    PdaTheme::create_back_button(monitor_screen, back_button_event_cb);
+    PdaTheme::create_title(monitor_screen, "Monitor");
+
+    // --- Conteúdo rolável abaixo do título ---
+    content = lv_obj_create(monitor_screen);
+    lv_obj_add_style(content, &PdaTheme::style_transparent, 0);
+    lv_obj_set_size(content, 320, 190);
+    lv_obj_align(content, LV_ALIGN_BOTTOM_MID, 0, 0);
+    lv_obj_set_flex_flow(content, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_pad_row(content, 4, 0);
+    lv_obj_set_style_pad_hor(content, 10, 0);
+    lv_obj_set_style_pad_ver(content, 2, 0);
+    lv_obj_set_scrollbar_mode(content, LV_SCROLLBAR_MODE_ACTIVE);
+
+    // --- CPU (%) ---
+    cpu_label = create_caption("Sampling...");
+    cpu_chart = create_chart(100);
+    cpu_series = add_series(cpu_chart, PDA_COLOR_ACCENT, LV_CHART_AXIS_PRIMARY_Y, SysMonitor::hist_cpu);
+
+    // --- Heap: SRAM livre em KB (eixo primário) e PSRAM livre em % (secundário) ---
+    heap_label = create_caption("");
+    heap_chart = create_chart((lv_coord_t)(heap_caps_get_total_size(MALLOC_CAP_INTERNAL) / 1024));
+    lv_chart_set_range(heap_chart, LV_CHART_AXIS_SECONDARY_Y, 0, 100);
+    sram_series = add_series(heap_chart, PDA_COLOR_ACCENT, LV_CHART_AXIS_PRIMARY_Y, SysMonitor::hist_sram);
+    psram_series = add_series(heap_chart, PDA_COLOR_DANGER, LV_CHART_AXIS_SECONDARY_Y, SysMonitor::hist_psram);
+
+    // --- Quadros (ms) ---
+    frame_label = create_caption("");
+    frame_chart = create_chart(50);
+    frame_series = add_series(frame_chart, PDA_COLOR_ACCENT, LV_CHART_AXIS_PRIMARY_Y, SysMonitor::hist_frame);
+
+    // --- Tarefas ---
+    task_table = lv_table_create(content);
+    lv_obj_add_style(task_table, &PdaTheme::style_transparent, LV_PART_MAIN);
+    lv_obj_add_style(task_table, &style_cell, LV_PART_ITEMS);
+    lv_table_set_col_cnt(task_table, 4);
+    lv_table_set_col_width(task_table, 0, 124);
+    lv_table_set_col_width(task_table, 1, 60);
+    lv_table_set_col_width(task_table, 2, 66);
+    lv_table_set_col_width(task_table, 3, 50);
+    lv_table_set_cell_value(task_table, 0, 0, "Task");
+    lv_table_set_cell_value(task_table, 0, 1, "CPU");
+    lv_table_set_cell_value(task_table, 0, 2, "Stack");
+    lv_table_set_cell_value(task_table, 0, 3, "Core");
+
+    wifi_label = create_caption("");
+    stall_label = create_caption("");
+    log_label = create_caption("");
+    spi_label = create_caption("");
+    panel_label = create_caption("");
+    sd_label = create_caption("");
+    status_label = create_caption("");
+    lv_obj_add_style(status_label, &PdaTheme::style_status, LV_PART_MAIN);
+
+    SysMonitor::set_listener(on_sample);
+}
+
+/**
+ * @brief Mostra a tela do monitor com a última amostra.
+ */
+inline void show() {
+    if (monitor_screen) {
+        SysMonitor::set_core_sampling(true);
+        update_labels();
+        update_charts();
+        lv_obj_scroll_to_y(content, 0, LV_ANIM_OFF);
+        lv_obj_clear_flag(monitor_screen, LV_OBJ_FLAG_HIDDEN);
+        lv_scr_load(monitor_screen);
+    }
+}
+
+/**
+ * @brief Gerencia a entrada do usuário e atualiza a interface.
+ */
+inline void handle() {
+    PDA_TRACE_SCOPE("Monitor::handle");
+    if (Trackball::moved_down()) lv_obj_scroll_by_bounded(content, 0, -MONITOR_SCROLL_STEP, LV_ANIM_ON);
+    if (Trackball::moved_up()) lv_obj_scroll_by_bounded(content, 0, MONITOR_SCROLL_STEP, LV_ANIM_ON);
+    if (Trackball::clicked()) {
+        SysMonitor::set_core_sampling(false);
+        AppManager::show_app(AppManager::APP_MAIN_MENU);
+        return;
+    }
+    lv_timer_handler();
+}
+
+} // namespace Monitor
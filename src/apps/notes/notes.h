@@ -6,6 +6,11 @@
 #include "utils/utils.h"
 #include <ArduinoJson.h>
 #include "secrets.h"
+#include "system/pda_mem.h"
+#include "apps/pda_theme.h"
+#include "apps/virtual_list.h"
+#include "system/pda_trace.h"
+#include "system/alloc_trace.h"
 #include "Icons/lv_img_sync.c"
 
 // Included from apps.h, which already defines the AppManager.
@@ -29,14 +34,21 @@ namespace Notes
     static lv_obj_t *back_btn = nullptr;
     static lv_obj_t *title_label = nullptr;
     static lv_obj_t *tasks_list = nullptr;
+    static VirtualList::List tasks_vlist; // Recycled rows: only the visible ones exist
     static lv_obj_t *status_label = nullptr;
     static lv_obj_t* no_tasks_img = nullptr; // Ponteiro para a imagem de "sem tarefas"
 
+    // --- Memory arena (released as a whole when the modal is destroyed) ---
+    static LvMem::Arena *modal_arena = nullptr;
+
     // --- Variables for asynchronous operation ---
     static TaskHandle_t fetch_task_handle = NULL;
     static SemaphoreHandle_t data_mutex = NULL;
     // We use a dynamic document to avoid repeated memory allocations in the loop.
-    static JsonDocument tasks_doc;
+    static JsonDocument tasks_doc(AllocTrace::json());
+    // UI-thread copy: rows, the modal and the day filter read it without the mutex.
+    // Swapped in from tasks_doc when the fetch task signals new data.
+    static JsonDocument tasks_view(AllocTrace::json());
     static volatile bool data_ready_for_ui = false;
     static String fetch_status_message = "";
 
@@ -50,7 +62,8 @@ namespace Notes
     static void task_save_btn_event_cb(lv_event_t *e);
     static void task_cancel_btn_event_cb(lv_event_t *e);
     static void task_delete_btn_event_cb(lv_event_t *e);
-    static void task_list_item_click_event_cb(lv_event_t *e);
+    static void bind_task_row(lv_obj_t *row, lv_obj_t *label, uint32_t index);
+    static void task_row_clicked(uint32_t index);
     static void show_task_modal(const char *initial_text = nullptr);
     static void close_task_modal();
     static void create_task(const char *title);
@@ -70,9 +83,9 @@ static void back_button_event_cb(lv_event_t* e) {
 
     static void task_delete_btn_event_cb(lv_event_t *e)
     {
-        if (selected_task_index >= 0 && selected_task_index < (int)tasks_doc["items"].size())
+        if (selected_task_index >= 0 && selected_task_index < (int)tasks_view["items"].size())
         {
-            JsonObject task = tasks_doc["items"][selected_task_index].as<JsonObject>();
+            JsonObject task = tasks_view["items"][selected_task_index].as<JsonObject>();
             const char *id = task["id"] | "";
             delete_task(id);
             close_task_modal();
@@ -84,14 +97,19 @@ static void back_button_event_cb(lv_event_t* e) {
         }
     }
 
-    static void task_list_item_click_event_cb(lv_event_t *e)
+    /**
+     * @brief Fills a recycled list row with the task at `index`.
+     */
+    static void bind_task_row(lv_obj_t *row, lv_obj_t *label, uint32_t index)
     {
-        lv_obj_t *target = lv_event_get_target(e);
-        // Instead of getting index from parent, get index from the button itself using user data
-        intptr_t index = (intptr_t)lv_obj_get_user_data(target);
+        const char *title = tasks_view["items"][index]["title"] | "Untitled";
+        lv_label_set_text(label, title);
+    }
 
+    static void task_row_clicked(uint32_t index)
+    {
         // Defensive check for valid index
-        if (index < 0 || index >= (intptr_t)tasks_doc["items"].size())
+        if (index >= tasks_view["items"].size())
         {
             LV_LOG_ERROR("Invalid task index selected: %d", (int)index);
             return;
@@ -100,7 +118,7 @@ static void back_button_event_cb(lv_event_t* e) {
         selected_task_index = (int)index;
 
         // Get task title safely
-        JsonObject task = tasks_doc["items"][selected_task_index].as<JsonObject>();
+        JsonObject task = tasks_view["items"][selected_task_index].as<JsonObject>();
         const char *task_text = task["title"] | "";
 
         is_editing_task = true;
@@ -116,26 +134,21 @@ static void back_button_event_cb(lv_event_t* e) {
             lv_obj_del(task_modal_cont);
             task_modal_cont = nullptr;
         }
-        task_modal_cont = lv_obj_create(lv_scr_act());
-        lv_obj_set_size(task_modal_cont, LV_PCT(100), LV_PCT(100));
-        lv_obj_set_style_bg_color(task_modal_cont, lv_color_hex(0xFDF5E6), 0);
-        lv_obj_set_style_bg_opa(task_modal_cont, LV_OPA_80, 0);
-        lv_obj_set_style_border_width(task_modal_cont, 0, 0);
-        lv_obj_set_style_radius(task_modal_cont, 0, 0);
-        lv_obj_clear_flag(task_modal_cont, LV_OBJ_FLAG_SCROLLABLE);
+
+        // The group outlives the modal, so it must not live in the modal arena.
+        if (!task_modal_group)
+        {
+            task_modal_group = lv_group_create();
+        }
+
+        LvMem::arena_renew(modal_arena, "notes.modal");
+        LvMem::ArenaScope arena_scope(modal_arena);
+
+        task_modal_cont = PdaTheme::create_modal(lv_scr_act());
 
         // Close button similar to settings modal
-        task_cancel_btn = lv_btn_create(task_modal_cont);
+        task_cancel_btn = PdaTheme::create_round_button(task_modal_cont, LV_SYMBOL_CLOSE, task_cancel_btn_event_cb);
         lv_obj_align(task_cancel_btn, LV_ALIGN_TOP_RIGHT, -5, 5);
-        lv_obj_set_size(task_cancel_btn, 40, 40);
-        lv_obj_set_style_radius(task_cancel_btn, LV_RADIUS_CIRCLE, 0);
-        lv_obj_set_style_bg_opa(task_cancel_btn, LV_OPA_50, 0);
-        lv_obj_set_style_bg_color(task_cancel_btn, lv_color_hex(0x1A5FB4), 0);
-        lv_obj_add_event_cb(task_cancel_btn, task_cancel_btn_event_cb, LV_EVENT_CLICKED, NULL);
-
-        lv_obj_t *cancel_label = lv_label_create(task_cancel_btn);
-        lv_label_set_text(cancel_label, LV_SYMBOL_CLOSE);
-        lv_obj_center(cancel_label);
 
         task_textarea = lv_textarea_create(task_modal_cont);
         lv_textarea_set_one_line(task_textarea, false);
@@ -154,10 +167,6 @@ static void back_button_event_cb(lv_event_t* e) {
         lv_obj_add_state(task_textarea, LV_STATE_FOCUSED);
         lv_textarea_set_cursor_pos(task_textarea, 0);
 
-        if (!task_modal_group)
-        {
-            task_modal_group = lv_group_create();
-        }
         lv_group_add_obj(task_modal_group, task_textarea);
 
         lv_indev_t *indev = lv_indev_get_next(nullptr);
@@ -167,30 +176,13 @@ static void back_button_event_cb(lv_event_t* e) {
         }
 
         // Save button with icon similar to settings modal
-        task_save_btn = lv_btn_create(task_modal_cont);
-        lv_obj_set_size(task_save_btn, 40, 40);
+        task_save_btn = PdaTheme::create_round_button(task_modal_cont, LV_SYMBOL_SAVE, task_save_btn_event_cb);
         lv_obj_align(task_save_btn, LV_ALIGN_BOTTOM_MID, -25, 5);
-        lv_obj_set_style_radius(task_save_btn, LV_RADIUS_CIRCLE, 0);
-        lv_obj_set_style_bg_opa(task_save_btn, LV_OPA_50, 0);
-        lv_obj_set_style_bg_color(task_save_btn, lv_color_hex(0x1A5FB4), 0);
-        lv_obj_add_event_cb(task_save_btn, task_save_btn_event_cb, LV_EVENT_CLICKED, NULL);
-
-        lv_obj_t *save_label = lv_label_create(task_save_btn);
-        lv_label_set_text(save_label, LV_SYMBOL_SAVE);
-        lv_obj_center(save_label);
 
         if (is_editing_task)
         {
-            task_delete_btn = lv_btn_create(task_modal_cont);
-            lv_obj_set_size(task_delete_btn, 40, 40);
+            task_delete_btn = PdaTheme::create_round_button(task_modal_cont, LV_SYMBOL_CLOSE, task_delete_btn_event_cb, true);
             lv_obj_align(task_delete_btn, LV_ALIGN_BOTTOM_MID, 25, 5);
-            lv_obj_set_style_radius(task_delete_btn, LV_RADIUS_CIRCLE, 0);
-            lv_obj_set_style_bg_opa(task_delete_btn, LV_OPA_50, 0);
-            lv_obj_set_style_bg_color(task_delete_btn, lv_color_hex(0xB00020), 0);
-            lv_obj_t *delete_label = lv_label_create(task_delete_btn);
-            lv_label_set_text(delete_label, LV_SYMBOL_CLOSE);
-            lv_obj_center(delete_label);
-            lv_obj_add_event_cb(task_delete_btn, task_delete_btn_event_cb, LV_EVENT_CLICKED, NULL);
         }
     }
 
@@ -205,6 +197,8 @@ static void back_button_event_cb(lv_event_t* e) {
             task_cancel_btn = nullptr;
             task_delete_btn = nullptr;
         }
+        LvMem::arena_release(modal_arena);
+        modal_arena = nullptr;
     }
 
      static void create_task(const char *title)
@@ -271,7 +265,7 @@ static void back_button_event_cb(lv_event_t* e) {
 
         if (is_editing_task && selected_task_index >= 0)
         {
-            JsonObject task = tasks_doc["items"][selected_task_index].as<JsonObject>();
+            JsonObject task = tasks_view["items"][selected_task_index].as<JsonObject>();
             const char *id = task["id"] | "";
             update_task(id, text);
         }
@@ -306,17 +300,12 @@ static void back_button_event_cb(lv_event_t* e) {
         }
         // Garante que a lista de tarefas esteja visível para o caso de uma atualização
         lv_obj_clear_flag(tasks_list, LV_OBJ_FLAG_HIDDEN);
-        lv_obj_clean(tasks_list);
-
-        // Apply styling similar to WiFi list in settings
-        lv_obj_set_style_bg_opa(tasks_list, LV_OPA_TRANSP, LV_PART_MAIN);
-        lv_obj_set_style_border_width(tasks_list, 0, LV_PART_MAIN);
-        lv_obj_set_style_text_color(tasks_list, lv_color_hex(0x0B3C5D), LV_PART_MAIN);
 
         // Use auto&& to avoid copying and binding issues
         auto&& tasks_var = doc["items"];
         if (!tasks_var.is<JsonArray>() || tasks_var.as<JsonArray>().size() == 0)
         {
+            VirtualList::set_count(&tasks_vlist, 0);
             // Esconde a lista vazia para não interferir
             lv_obj_add_flag(tasks_list, LV_OBJ_FLAG_HIDDEN);
 
@@ -331,26 +320,8 @@ static void back_button_event_cb(lv_event_t* e) {
             return;
         }
 
-        auto&& tasks = tasks_var.as<JsonArray>();
-
-        for (int i = 0; i < (int)tasks.size(); i++)
-        {
-            JsonObject task = tasks[i].as<JsonObject>();
-            String title = task["title"] | "Untitled";
-            title = Utils::sanitizeString(title);
-            lv_obj_t *btn = lv_list_add_btn(tasks_list, NULL, title.c_str());
-            lv_obj_set_user_data(btn, (void *)(intptr_t)i);
-            lv_obj_add_event_cb(btn, task_list_item_click_event_cb, LV_EVENT_CLICKED, NULL);
-        }
-
-        // Style each child item in the list to fix background and text color
-        uint32_t child_count = lv_obj_get_child_cnt(tasks_list);
-        for (uint32_t i = 0; i < child_count; i++) {
-            lv_obj_t* child = lv_obj_get_child(tasks_list, i);
-            lv_obj_set_style_bg_opa(child, LV_OPA_TRANSP, LV_PART_MAIN);
-            lv_obj_set_style_border_width(child, 0, LV_PART_MAIN);
-            lv_obj_set_style_text_color(child, lv_color_hex(0x0B3C5D), LV_PART_MAIN);
-        }
+        // Only the visible rows are bound; the rest are filled in as the list scrolls.
+        VirtualList::set_count(&tasks_vlist, tasks_var.as<JsonArray>().size());
     }
 
     /**
@@ -377,7 +348,9 @@ static void back_button_event_cb(lv_event_t* e) {
         if (xSemaphoreTake(data_mutex, portMAX_DELAY) == pdTRUE)
         {
             tasks_doc.clear();
+            PDA_TRACE_BEGIN("notes.json_parse");
             DeserializationError error = deserializeJson(tasks_doc, payload);
+            PDA_TRACE_END("notes.json_parse");
             if (error)
             {
                 LV_LOG_ERROR("deserializeJson() failed: %s", error.c_str());
@@ -408,7 +381,9 @@ static void back_button_event_cb(lv_event_t* e) {
         const char *headerKeys[] = {"location"};
         http.collectHeaders(headerKeys, 1);
 
+        PDA_TRACE_BEGIN("notes.http_get");
         int http_code = http.GET();
+        PDA_TRACE_END("notes.http_get");
 
         if (http_code == HTTP_CODE_MOVED_PERMANENTLY || http_code == HTTP_CODE_FOUND)
         {
@@ -420,14 +395,18 @@ static void back_button_event_cb(lv_event_t* e) {
             {
                 http.begin(url); // Starts the second request
                 http.addHeader("User-Agent", "Mozilla/5.0 (compatible; ESP32)");
+                PDA_TRACE_BEGIN("notes.http_get");
                 http_code = http.GET();
+                PDA_TRACE_END("notes.http_get");
                 LV_LOG_USER("Second GET HTTP code: %d", http_code);
             }
         }
 
         if (http_code == HTTP_CODE_OK)
         {
+            PDA_TRACE_BEGIN("notes.http_read");
             String payload = http.getString();
+            PDA_TRACE_END("notes.http_read");
             LV_LOG_USER("Payload received: %s", payload.c_str());
             process_and_store_payload(payload);
         }
@@ -442,6 +421,7 @@ static void back_button_event_cb(lv_event_t* e) {
 
         // The task finished, so we clear the handle and delete the task.
         fetch_task_handle = NULL;
+        SysMonitor::record_stack("FetchTasks");
         vTaskDelete(NULL);
     }
 
@@ -486,69 +466,28 @@ static void back_button_event_cb(lv_event_t* e) {
         // Creates the mutex to protect access to shared data between tasks
         data_mutex = xSemaphoreCreateMutex();
 
-        notes_screen = lv_obj_create(NULL);
-        lv_obj_add_flag(notes_screen, LV_OBJ_FLAG_HIDDEN);
-        lv_obj_set_size(notes_screen, 320, 240);
-        lv_obj_set_style_bg_color(notes_screen, lv_color_hex(0xFDF5E6), LV_PART_MAIN);
+        notes_screen = PdaTheme::create_screen();
 
         // Adds the click event to the screen to allow refresh
         lv_obj_add_flag(notes_screen, LV_OBJ_FLAG_CLICKABLE);
         lv_obj_add_event_cb(notes_screen, refresh_event_cb, LV_EVENT_CLICKED, NULL);
 
         // --- Back Button ---
-        back_btn = lv_btn_create(notes_screen);
-        lv_obj_align(back_btn, LV_ALIGN_TOP_LEFT, 5, 5);
-        lv_obj_add_event_cb(back_btn, back_button_event_cb, LV_EVENT_CLICKED, NULL);
-        lv_obj_set_style_bg_color(back_btn, lv_color_hex(0x1A5FB4), LV_PART_MAIN);
-        lv_obj_set_style_bg_opa(back_btn, LV_OPA_50, LV_PART_MAIN);
-        lv_obj_set_style_radius(back_btn, 12, LV_PART_MAIN);
-        lv_obj_set_style_border_width(back_btn, 0, LV_PART_MAIN);
-        lv_obj_set_style_shadow_opa(back_btn, 0, LV_PART_MAIN);
-
-        lv_obj_t *back_label = lv_label_create(back_btn);
-        lv_label_set_text(back_label, LV_SYMBOL_LEFT);
-        lv_obj_set_style_text_color(back_label, lv_color_hex(0xFFFFFF), 0);
-        lv_obj_set_style_text_font(back_label, &lv_font_montserrat_16, 0);
-        lv_obj_center(back_label);
+        back_btn = PdaTheme::create_back_button(notes_screen, back_button_event_cb);
 
         // --- Screen Title ---
-        title_label = lv_label_create(notes_screen);
-        lv_label_set_text(title_label, "Notes");
-        lv_obj_set_style_text_font(title_label, &lv_font_montserrat_28, 0);
-        lv_obj_set_style_text_color(title_label, lv_color_hex(0x0B3C5D), 0);
-        lv_obj_align(title_label, LV_ALIGN_TOP_MID, 0, 10);
+        title_label = PdaTheme::create_title(notes_screen, "Notes");
 
         // --- Task List ---
-        tasks_list = lv_list_create(notes_screen);
+        tasks_list = VirtualList::create(&tasks_vlist, notes_screen, bind_task_row, task_row_clicked);
         lv_obj_set_size(tasks_list, 300, 180);
         lv_obj_align(tasks_list, LV_ALIGN_CENTER, 0, 20);
-        lv_obj_set_style_bg_opa(tasks_list, LV_OPA_TRANSP, 0);
-        lv_obj_set_style_border_width(tasks_list, 0, 0);
 
         // --- Add Task Button ---
-        lv_obj_t *add_task_btn = lv_btn_create(notes_screen);
-        lv_obj_set_size(add_task_btn, 40, 40);
-        lv_obj_align(add_task_btn, LV_ALIGN_BOTTOM_LEFT, 10, -10);
-        lv_obj_set_style_bg_color(add_task_btn, lv_color_hex(0x1A5FB4), LV_PART_MAIN);
-        lv_obj_set_style_bg_opa(add_task_btn, LV_OPA_70, LV_PART_MAIN);
-        lv_obj_set_style_radius(add_task_btn, LV_RADIUS_CIRCLE, LV_PART_MAIN);
-        lv_obj_set_style_border_width(add_task_btn, 0, LV_PART_MAIN);
-        lv_obj_set_style_shadow_opa(add_task_btn, 0, LV_PART_MAIN);
-
-        lv_obj_t *add_task_label = lv_label_create(add_task_btn);
-        lv_label_set_text(add_task_label, "+");
-        lv_obj_set_style_text_color(add_task_label, lv_color_hex(0xFFFFFF), 0);
-        lv_obj_set_style_text_font(add_task_label, &lv_font_montserrat_28, 0);
-        lv_obj_center(add_task_label);
-
-        lv_obj_add_event_cb(add_task_btn, add_task_btn_event_cb, LV_EVENT_CLICKED, NULL);
+        PdaTheme::create_add_button(notes_screen, add_task_btn_event_cb);
 
         // --- Status Label ---
-        status_label = lv_label_create(notes_screen);
-        lv_label_set_text(status_label, "");
-        lv_obj_set_style_text_font(status_label, &lv_font_montserrat_12, 0);
-        lv_obj_set_style_text_color(status_label, lv_color_hex(0x324A5F), 0);
-        lv_obj_align(status_label, LV_ALIGN_BOTTOM_RIGHT, -10, -10);
+        status_label = PdaTheme::create_status_label(notes_screen);
     }
 
     /**
@@ -569,6 +508,7 @@ static void back_button_event_cb(lv_event_t* e) {
      */
     inline void handle()
     {
+        PDA_TRACE_SCOPE("Notes::handle");
         // Handle keyboard input for task modal
         if (task_modal_cont && task_textarea)
         {
@@ -596,6 +536,13 @@ static void back_button_event_cb(lv_event_t* e) {
                 }
             }
         }
+        else if (!lv_obj_has_flag(tasks_list, LV_OBJ_FLAG_HIDDEN))
+        {
+            // Trackball navigation through the task list
+            if (Trackball::moved_down()) VirtualList::move_selection(&tasks_vlist, 1);
+            if (Trackball::moved_up()) VirtualList::move_selection(&tasks_vlist, -1);
+            if (Trackball::clicked()) VirtualList::activate_selection(&tasks_vlist);
+        }
 
         // Checks if the background task signaled that there is new data
         if (data_ready_for_ui)
@@ -603,14 +550,17 @@ static void back_button_event_cb(lv_event_t* e) {
             // Locks access to data to safely read
             if (xSemaphoreTake(data_mutex, (TickType_t)10) == pdTRUE)
             {
+                // Takes the new data (or the cleared document on error) and frees the old
+                swap(tasks_view, tasks_doc);
+                tasks_doc.clear();
                 if (!fetch_status_message.isEmpty())
                 {
                     lv_label_set_text(status_label, fetch_status_message.c_str());
-                    lv_obj_clean(tasks_list); // Clears the list in case of error
+                    VirtualList::set_count(&tasks_vlist, 0); // Clears the list in case of error
                 }
                 else
                 {
-                    update_tasks_ui(tasks_doc.as<JsonObject>());
+                    update_tasks_ui(tasks_view.as<JsonObject>());
                     lv_label_set_text(status_label, ""); // Clear status message on success
                 }
                 data_ready_for_ui = false; // Reset the flag
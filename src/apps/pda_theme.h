@@ -0,0 +1,266 @@
+#pragma once
+#include <lvgl.h>
+
+/**
+ * PDA Theme - Tema e estilos compartilhados da interface
+ *
+ * Todos os apps usam a mesma paleta (fundo creme, texto azul-escuro, destaque
+ * azul). Em vez de cada objeto receber suas próprias propriedades locais
+ * (lv_obj_set_style_*), que alocam uma entrada de estilo por objeto, os estilos
+ * ficam em poucos lv_style_t estáticos compartilhados:
+ *
+ * - O tema (lv_theme_t com o tema padrão como pai) aplica os estilos sozinho
+ *   na criação: telas, listas e itens de lista já nascem com a aparência do PDA.
+ * - As fábricas (create_back_button, create_title...) montam os widgets que se
+ *   repetiam em todos os apps usando só os estilos compartilhados.
+ * - Itens de lista marcados com LV_STATE_CHECKED recebem o destaque de seleção
+ *   do trackball.
+ *
+ * 🎨 Exemplo de uso:
+ *
+ * PdaTheme::init();                       // Antes de criar qualquer tela
+ * lv_obj_t* screen = PdaTheme::create_screen();
+ * PdaTheme::create_back_button(screen, back_button_event_cb);
+ * PdaTheme::create_title(screen, "Notes");
+ */
+
+// --- Paleta ---
+#define PDA_COLOR_BG      0xFDF5E6  // Fundo das telas e modais
+#define PDA_COLOR_TEXT    0x0B3C5D  // Texto principal
+#define PDA_COLOR_MUTED   0x324A5F  // Texto secundário (status, descrições)
+#define PDA_COLOR_ACCENT  0x1A5FB4  // Botões e seleção
+#define PDA_COLOR_DANGER  0xB00020  // Ações destrutivas
+
+namespace PdaTheme {
+
+static lv_theme_t theme;
+static bool ready = false;
+
+static lv_style_t style_screen;         // Fundo da tela
+static lv_style_t style_transparent;    // Containers e listas sem fundo nem borda
+static lv_style_t style_list_item;      // Itens de lista: transparentes, texto da paleta
+static lv_style_t style_list_btn;       // Botões de lista: style_list_item com o espaçamento
+static lv_style_t style_list_pressed;   // Botão de lista tocado
+static lv_style_t style_selected;       // Item selecionado pelo trackball
+static lv_style_t style_title;          // Título no topo das telas
+static lv_style_t style_status;         // Texto de status no rodapé
+static lv_style_t style_back_btn;       // Botão "voltar" no canto superior esquerdo
+static lv_style_t style_fab;            // Botão redondo de adicionar ("+")
+static lv_style_t style_round_btn;      // Botões redondos dos modais
+static lv_style_t style_round_btn_danger;
+static lv_style_t style_modal;          // Fundo semitransparente dos modais
+
+inline lv_color_t dark_filter_cb(const lv_color_filter_dsc_t* f, lv_color_t c, lv_opa_t opa) {
+    LV_UNUSED(f);
+    return lv_color_darken(c, opa);
+}
+
+inline void init_styles() {
+    lv_style_init(&style_screen);
+    lv_style_set_bg_color(&style_screen, lv_color_hex(PDA_COLOR_BG));
+
+    lv_style_init(&style_transparent);
+    lv_style_set_bg_opa(&style_transparent, LV_OPA_TRANSP);
+    lv_style_set_border_width(&style_transparent, 0);
+
+    lv_style_init(&style_list_item);
+    lv_style_set_bg_opa(&style_list_item, LV_OPA_TRANSP);
+    lv_style_set_border_width(&style_list_item, 0);
+    lv_style_set_text_color(&style_list_item, lv_color_hex(PDA_COLOR_TEXT));
+
+    // Os botões de lista não usam os estilos do tema padrão (apply_cb): o que
+    // sobrava deles (espaçamento e o escurecer ao tocar) vem para cá, com os
+    // mesmos valores para uma tela pequena
+    lv_disp_t* disp = lv_disp_get_default();
+    lv_style_init(&style_list_btn);
+    lv_style_set_bg_opa(&style_list_btn, LV_OPA_TRANSP);
+    lv_style_set_border_width(&style_list_btn, 0);
+    lv_style_set_text_color(&style_list_btn, lv_color_hex(PDA_COLOR_TEXT));
+    lv_style_set_pad_all(&style_list_btn, lv_disp_dpx(disp, 10));
+    lv_style_set_pad_column(&style_list_btn, lv_disp_dpx(disp, 10));
+
+    static lv_color_filter_dsc_t dark_filter;
+    lv_color_filter_dsc_init(&dark_filter, dark_filter_cb);
+    lv_style_init(&style_list_pressed);
+    lv_style_set_color_filter_dsc(&style_list_pressed, &dark_filter);
+    lv_style_set_color_filter_opa(&style_list_pressed, 35);
+    lv_style_set_transform_width(&style_list_pressed, lv_disp_dpx(disp, 16));
+
+    lv_style_init(&style_selected);
+    lv_style_set_bg_color(&style_selected, lv_color_hex(PDA_COLOR_ACCENT));
+    lv_style_set_bg_opa(&style_selected, LV_OPA_30);
+
+    lv_style_init(&style_title);
+    lv_style_set_text_font(&style_title, &lv_font_montserrat_28);
+    lv_style_set_text_color(&style_title, lv_color_hex(PDA_COLOR_TEXT));
+
+    lv_style_init(&style_status);
+    lv_style_set_text_font(&style_status, &lv_font_montserrat_12);
+    lv_style_set_text_color(&style_status, lv_color_hex(PDA_COLOR_MUTED));
+
+    // As propriedades de texto são herdadas pelo label dentro do botão.
+    lv_style_init(&style_back_btn);
+    lv_style_set_bg_color(&style_back_btn, lv_color_hex(PDA_COLOR_ACCENT));
+    lv_style_set_bg_opa(&style_back_btn, LV_OPA_50);
+    lv_style_set_radius(&style_back_btn, 12);
+    lv_style_set_border_width(&style_back_btn, 0);
+    lv_style_set_shadow_opa(&style_back_btn, LV_OPA_TRANSP);
+    lv_style_set_text_color(&style_back_btn, lv_color_white());
+    lv_style_set_text_font(&style_back_btn, &lv_font_montserrat_16);
+
+    lv_style_init(&style_fab);
+    lv_style_set_bg_color(&style_fab, lv_color_hex(PDA_COLOR_ACCENT));
+    lv_style_set_bg_opa(&style_fab, LV_OPA_70);
+    lv_style_set_radius(&style_fab, LV_RADIUS_CIRCLE);
+    lv_style_set_border_width(&style_fab, 0);
+    lv_style_set_shadow_opa(&style_fab, LV_OPA_TRANSP);
+    lv_style_set_text_color(&style_fab, lv_color_white());
+    lv_style_set_text_font(&style_fab, &lv_font_montserrat_28);
+
+    lv_style_init(&style_round_btn);
+    lv_style_set_bg_color(&style_round_btn, lv_color_hex(PDA_COLOR_ACCENT));
+    lv_style_set_bg_opa(&style_round_btn, LV_OPA_50);
+    lv_style_set_radius(&style_round_btn, LV_RADIUS_CIRCLE);
+
+    lv_style_init(&style_round_btn_danger);
+    lv_style_set_bg_color(&style_round_btn_danger, lv_color_hex(PDA_COLOR_DANGER));
+
+    lv_style_init(&style_modal);
+    lv_style_set_bg_color(&style_modal, lv_color_hex(PDA_COLOR_BG));
+    lv_style_set_bg_opa(&style_modal, LV_OPA_80);
+    lv_style_set_border_width(&style_modal, 0);
+    lv_style_set_radius(&style_modal, 0);
+}
+
+/**
+ * @brief Aplicado pelo LVGL a cada objeto criado, depois do tema padrão.
+ */
+inline void apply_cb(lv_theme_t* th, lv_obj_t* obj) {
+    LV_UNUSED(th);
+    if (lv_obj_get_parent(obj) == NULL) {
+        lv_obj_add_style(obj, &style_screen, LV_PART_MAIN);
+    } else if (lv_obj_check_type(obj, &lv_list_class)) {
+        lv_obj_add_style(obj, &style_transparent, LV_PART_MAIN);
+    } else if (lv_obj_check_type(obj, &lv_list_btn_class)) {
+        // 3 referências de estilo em vez das 6 do tema padrão mais as nossas:
+        // as listas podem ter centenas de linhas. Os estilos de foco do teclado
+        // saem junto; as linhas nunca entram num grupo (a seleção é CHECKED).
+        lv_obj_remove_style_all(obj);
+        lv_obj_add_style(obj, &style_list_btn, LV_PART_MAIN);
+        lv_obj_add_style(obj, &style_list_pressed, LV_PART_MAIN | LV_STATE_PRESSED);
+        lv_obj_add_style(obj, &style_selected, LV_PART_MAIN | LV_STATE_CHECKED);
+    }
+}
+
+/**
+ * @brief Cria os estilos e instala o tema no display padrão.
+ * Chame depois de lv_init() e antes de criar as telas dos apps.
+ */
+inline void init() {
+    if (ready) return;
+    init_styles();
+
+    lv_disp_t* disp = lv_disp_get_default();
+    lv_theme_t* parent = lv_disp_get_theme(disp);
+    theme = *parent;
+    lv_theme_set_parent(&theme, parent);
+    lv_theme_set_apply_cb(&theme, apply_cb);
+    lv_disp_set_theme(disp, &theme);
+    ready = true;
+}
+
+// --- Fábricas de widgets ---
+
+/**
+ * @brief Cria a tela de um app (320x240, escondida até o show()).
+ */
+inline lv_obj_t* create_screen() {
+    lv_obj_t* screen = lv_obj_create(NULL);
+    lv_obj_add_flag(screen, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_set_size(screen, 320, 240);
+    return screen;
+}
+
+/**
+ * @brief Cria o botão "voltar" no canto superior esquerdo.
+ */
+inline lv_obj_t* create_back_button(lv_obj_t* parent, lv_event_cb_t event_cb) {
+    lv_obj_t* btn = lv_btn_create(parent);
+    lv_obj_add_style(btn, &style_back_btn, LV_PART_MAIN);
+    lv_obj_align(btn, LV_ALIGN_TOP_LEFT, 5, 5);
+    lv_obj_add_event_cb(btn, event_cb, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_t* label = lv_label_create(btn);
+    lv_label_set_text(label, LV_SYMBOL_LEFT);
+    lv_obj_center(label);
+    return btn;
+}
+
+/**
+ * @brief Cria o título centralizado no topo da tela.
+ */
+inline lv_obj_t* create_title(lv_obj_t* parent, const char* text) {
+    lv_obj_t* label = lv_label_create(parent);
+    lv_label_set_text(label, text);
+    lv_obj_add_style(label, &style_title, LV_PART_MAIN);
+    lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 10);
+    return label;
+}
+
+/**
+ * @brief Cria o label de status no canto inferior direito.
+ */
+inline lv_obj_t* create_status_label(lv_obj_t* parent) {
+    lv_obj_t* label = lv_label_create(parent);
+    lv_label_set_text(label, "");
+    lv_obj_add_style(label, &style_status, LV_PART_MAIN);
+    lv_obj_align(label, LV_ALIGN_BOTTOM_RIGHT, -10, -10);
+    return label;
+}
+
+/**
+ * @brief Cria o botão redondo de adicionar no canto inferior esquerdo.
+ */
+inline lv_obj_t* create_add_button(lv_obj_t* parent, lv_event_cb_t event_cb) {
+    lv_obj_t* btn = lv_btn_create(parent);
+    lv_obj_add_style(btn, &style_fab, LV_PART_MAIN);
+    lv_obj_set_size(btn, 40, 40);
+    lv_obj_align(btn, LV_ALIGN_BOTTOM_LEFT, 10, -10);
+    lv_obj_add_event_cb(btn, event_cb, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_t* label = lv_label_create(btn);
+    lv_label_set_text(label, "+");
+    lv_obj_center(label);
+    return btn;
+}
+
+/**
+ * @brief Cria o fundo de um modal cobrindo toda a tela.
+ */
+inline lv_obj_t* create_modal(lv_obj_t* parent) {
+    lv_obj_t* modal = lv_obj_create(parent);
+    lv_obj_add_style(modal, &style_modal, LV_PART_MAIN);
+    lv_obj_set_size(modal, LV_PCT(100), LV_PCT(100));
+    lv_obj_clear_flag(modal, LV_OBJ_FLAG_SCROLLABLE);
+    return modal;
+}
+
+/**
+ * @brief Cria um botão redondo de 40 px com um símbolo (salvar, fechar...).
+ * O posicionamento fica com quem chama.
+ * @param danger true para a cor de ações destrutivas (ex: excluir).
+ */
+inline lv_obj_t* create_round_button(lv_obj_t* parent, const char* symbol, lv_event_cb_t event_cb, bool danger = false) {
+    lv_obj_t* btn = lv_btn_create(parent);
+    lv_obj_add_style(btn, &style_round_btn, LV_PART_MAIN);
+    if (danger) lv_obj_add_style(btn, &style_round_btn_danger, LV_PART_MAIN);
+    lv_obj_set_size(btn, 40, 40);
+    lv_obj_add_event_cb(btn, event_cb, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_t* label = lv_label_create(btn);
+    lv_label_set_text(label, symbol);
+    lv_obj_center(label);
+    return btn;
+}
+
+} // namespace PdaTheme
@@ -7,6 +7,13 @@
 #include <ctype.h>
 #include <ArduinoJson.h>
 #include "input/trackball/trackball.h"
+#include "system/pda_mem.h"
+#include "apps/pda_theme.h"
+#include "system/lv_bulk.h"
+#include "system/render_cache.h"
+#include "system/pda_trace.h"
+#include "system/alloc_trace.h"
+#include "system/stall_detector.h"
 
 // Este arquivo é incluído a partir de `apps.h`, que já define o AppManager.
 
@@ -37,6 +44,10 @@ static lv_obj_t* password_textarea = nullptr;
 static lv_obj_t* brightness_slider = nullptr;
 static lv_obj_t* brightness_label = nullptr;
 
+// --- Memory arenas (released as a whole when the modal/list is destroyed) ---
+static LvMem::Arena* modal_arena = nullptr;
+static LvMem::Arena* wifi_list_arena = nullptr;
+
 // --- Preferences ---
 static Preferences preferences;
 
@@ -60,6 +71,7 @@ static void back_button_event_cb(lv_event_t* e);
 static void setting_header_event_cb(lv_event_t* e);
 static lv_obj_t* create_accordion_item(lv_obj_t* parent, const char* icon, const char* title);
 static void update_wifi_list_selection_visuals();
+static void set_disconnect_selected(bool selected);
 static void wifi_list_item_click_event_cb(lv_event_t* e);
 static void show_password_modal(const char* ssid);
 static void attempt_wifi_connection(const char* ssid, const char* password, bool is_auto_connect = false);
@@ -121,6 +133,7 @@ static void setting_header_event_cb(lv_event_t* e) {
     bool is_hidden = lv_obj_has_flag(content_panel, LV_OBJ_FLAG_HIDDEN);
 
     // Reseta todos os focos antes de decidir o que fazer
+    if (is_disconnect_ui_focused) set_disconnect_selected(false);
     is_wifi_list_focused = false;
     is_disconnect_ui_focused = false;
     is_display_ui_focused = false;
@@ -148,6 +161,19 @@ static void setting_header_event_cb(lv_event_t* e) {
     }
 }
 
+/**
+ * @brief Liga ou desliga o destaque do botão "Disconnect", o último item da
+ * lista quando o Wi-Fi está conectado.
+ */
+static void set_disconnect_selected(bool selected) {
+    if (!wifi_list) return;
+    uint32_t child_count = lv_obj_get_child_cnt(wifi_list);
+    if (child_count == 0) return;
+    lv_obj_t* disconnect_btn = lv_obj_get_child(wifi_list, child_count - 1);
+    if (selected) lv_obj_add_state(disconnect_btn, LV_STATE_CHECKED);
+    else lv_obj_clear_state(disconnect_btn, LV_STATE_CHECKED);
+}
+
 /**
  * @brief Atualiza o destaque visual do item selecionado na lista de Wi-Fi.
  */
@@ -156,12 +182,9 @@ static void update_wifi_list_selection_visuals() {
     uint32_t child_count = lv_obj_get_child_cnt(wifi_list);
     for (uint32_t i = 0; i < child_count; i++) {
         lv_obj_t* btn = lv_obj_get_child(wifi_list, i);
-        if (i == wifi_list_selected_index) {
-            lv_obj_set_style_bg_color(btn, lv_color_hex(0x1A5FB4), 0);
-            lv_obj_set_style_bg_opa(btn, LV_OPA_30, 0);
-        } else {
-            lv_obj_set_style_bg_opa(btn, LV_OPA_TRANSP, 0);
-        }
+        // O destaque vem do estilo compartilhado de LV_STATE_CHECKED (PdaTheme).
+        if (i == wifi_list_selected_index) lv_obj_add_state(btn, LV_STATE_CHECKED);
+        else lv_obj_clear_state(btn, LV_STATE_CHECKED);
     }
 }
 
@@ -199,6 +222,8 @@ static void close_password_modal() {
         password_modal_cont = nullptr;
         password_textarea = nullptr;
     }
+    LvMem::arena_release(modal_arena);
+    modal_arena = nullptr;
 }
 
 /**
@@ -213,27 +238,15 @@ static void password_cancel_event_cb(lv_event_t* e) {
  * @brief Mostra uma janela modal com um teclado para digitar a senha do Wi-Fi.
  */
 static void show_password_modal(const char* ssid) {
+    LvMem::arena_renew(modal_arena, "settings.modal");
+    LvMem::ArenaScope arena_scope(modal_arena);
+
     // Cria um fundo semi-transparente para o modal
-    password_modal_cont = lv_obj_create(lv_scr_act());
-    lv_obj_set_size(password_modal_cont, LV_PCT(100), LV_PCT(100));
-    lv_obj_set_style_bg_color(password_modal_cont, lv_color_hex(0xFDF5E6), 0);
-    lv_obj_set_style_bg_opa(password_modal_cont, LV_OPA_80, 0);
-    lv_obj_set_style_border_width(password_modal_cont, 0, 0);
-    lv_obj_set_style_radius(password_modal_cont, 0, 0);
-    lv_obj_clear_flag(password_modal_cont, LV_OBJ_FLAG_SCROLLABLE);
+    password_modal_cont = PdaTheme::create_modal(lv_scr_act());
 
     // Botão de Cancelar (X no canto)
-    lv_obj_t* cancel_btn = lv_btn_create(password_modal_cont);
+    lv_obj_t* cancel_btn = PdaTheme::create_round_button(password_modal_cont, LV_SYMBOL_CLOSE, password_cancel_event_cb);
     lv_obj_align(cancel_btn, LV_ALIGN_TOP_RIGHT, -5, 5);
-    lv_obj_set_size(cancel_btn, 40, 40);
-    lv_obj_add_event_cb(cancel_btn, password_cancel_event_cb, LV_EVENT_CLICKED, NULL);
-    lv_obj_set_style_radius(cancel_btn, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_bg_opa(cancel_btn, LV_OPA_50, 0);
-    lv_obj_set_style_bg_color(cancel_btn, lv_color_hex(0x1A5FB4), 0);
-
-    lv_obj_t* cancel_label = lv_label_create(cancel_btn);
-    lv_label_set_text(cancel_label, LV_SYMBOL_CLOSE);
-    lv_obj_center(cancel_label);
 
     // Cria a área de texto para a senha
     password_textarea = lv_textarea_create(password_modal_cont);
@@ -273,33 +286,26 @@ static void display_wifi_connected_ui() {
     is_disconnect_ui_focused = true;
     is_wifi_list_focused = false; // Não há lista para navegar
     lv_obj_clean(wifi_content_panel); // Limpa tudo que estava no painel
+    LvMem::arena_renew(wifi_list_arena, "settings.wifi");
+    LvMem::ArenaScope arena_scope(wifi_list_arena);
+    LvBulk::Scope bulk(wifi_content_panel);
 
     // Recria a lista para exibir o status
     wifi_list = lv_list_create(wifi_content_panel);
     lv_obj_set_width(wifi_list, lv_pct(100));
     lv_obj_set_height(wifi_list, LV_SIZE_CONTENT);
-    lv_obj_set_style_bg_opa(wifi_list, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(wifi_list, 0, 0);
 
     char status_text[64];
     snprintf(status_text, sizeof(status_text), "Connected to: %s", WiFi.SSID().c_str());
-    lv_list_add_text(wifi_list, status_text);
+    // Textos de status com o mesmo estilo limpo dos itens (o botão já vem do tema)
+    lv_obj_add_style(lv_list_add_text(wifi_list, status_text), &PdaTheme::style_list_item, 0);
 
     snprintf(status_text, sizeof(status_text), "IP: %s", WiFi.localIP().toString().c_str());
-    lv_list_add_text(wifi_list, status_text);
+    lv_obj_add_style(lv_list_add_text(wifi_list, status_text), &PdaTheme::style_list_item, 0);
 
     // Botão para desconectar
     lv_obj_t* disconnect_btn = lv_list_add_btn(wifi_list, LV_SYMBOL_CLOSE, "Disconnect");
     lv_obj_add_event_cb(disconnect_btn, disconnect_wifi_event_cb, LV_EVENT_CLICKED, NULL);
-
-    // Aplica o estilo limpo aos itens de texto e ao botão
-    uint32_t child_count = lv_obj_get_child_cnt(wifi_list);
-    for (uint32_t i = 0; i < child_count; i++) {
-        lv_obj_t* child = lv_obj_get_child(wifi_list, i);
-        lv_obj_set_style_bg_opa(child, LV_OPA_TRANSP, LV_PART_MAIN);
-        lv_obj_set_style_border_width(child, 0, LV_PART_MAIN);
-        lv_obj_set_style_text_color(child, lv_color_hex(0x0B3C5D), LV_PART_MAIN);
-    }
 }
 
 /**
@@ -309,6 +315,7 @@ static void disconnect_wifi_event_cb(lv_event_t* e) {
     LV_LOG_USER("Disconnecting Wi-Fi...");
     // A lógica de "esquecer" a rede poderia ser mais complexa, por agora apenas desconecta.
     WiFi.disconnect(true);
+    set_disconnect_selected(false);
     is_disconnect_ui_focused = false;
     wifi_connect_status = IDLE;
     // Inicia um novo escaneamento para mostrar a lista de redes novamente
@@ -330,23 +337,33 @@ static void start_wifi_scan() {
     WiFi.mode(WIFI_STA);
 
     lv_obj_clean(wifi_content_panel); // Limpa o painel (remove o status de conectado)
+    LvMem::arena_renew(wifi_list_arena, "settings.wifi");
+    LvMem::ArenaScope arena_scope(wifi_list_arena);
 
     // Recria a lista de Wi-Fi
     wifi_list = lv_list_create(wifi_content_panel);
     lv_obj_set_width(wifi_list, lv_pct(100));
     lv_obj_set_height(wifi_list, 120);
     lv_obj_align(wifi_list, LV_ALIGN_TOP_LEFT, 0, 0);
-    lv_obj_set_style_bg_opa(wifi_list, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(wifi_list, 0, 0);
 
     lv_list_add_text(wifi_list, "Scanning for networks...");
     // Força uma atualização imediata da tela para garantir que a mensagem "Scanning..."
     // seja exibida antes da chamada de escaneamento síncrono, que bloqueia a UI.
-    lv_refr_now(NULL);
+    {
+        // O desenho usa buffers temporários, que não devem ir para a arena da lista.
+        LvMem::ArenaScope heap_scope(nullptr);
+        lv_refr_now(NULL);
+    }
 
-    int n = WiFi.scanNetworks(false, true);
+    int n;
+    {
+        STALL_SITE("WiFi.scanNetworks");
+        n = WiFi.scanNetworks(false, true);
+    }
 
     LV_LOG_USER("Wi-Fi scan finished, %d networks found.", n);
+    // Recria os itens com um único layout e redesenho no fim (ver LvBulk)
+    LvBulk::Scope bulk(wifi_list);
     lv_obj_clean(wifi_list);
     if (n == 0) {
         lv_list_add_text(wifi_list, "No networks found.");
@@ -362,9 +379,6 @@ static void start_wifi_scan() {
             const char* encryption_symbol = (WiFi.encryptionType(i) == WIFI_AUTH_OPEN) ? "" : " " LV_SYMBOL_EYE_CLOSE;
             snprintf(item_text, sizeof(item_text), "%s %s%s", get_wifi_signal_icon(rssi), ssid.c_str(), encryption_symbol);
             lv_obj_t* btn = lv_list_add_btn(wifi_list, NULL, item_text);
-            lv_obj_set_style_bg_opa(btn, LV_OPA_TRANSP, LV_PART_MAIN);
-            lv_obj_set_style_border_width(btn, 0, LV_PART_MAIN);
-            lv_obj_set_style_text_color(btn, lv_color_hex(0x0B3C5D), LV_PART_MAIN);
             lv_obj_add_event_cb(btn, wifi_list_item_click_event_cb, LV_EVENT_CLICKED, (void*)(intptr_t)i);
             found_count++;
         }
@@ -418,8 +432,7 @@ static lv_obj_t* create_accordion_item(lv_obj_t* parent, const char* icon, const
     lv_obj_set_layout(item_container, LV_LAYOUT_FLEX);
     lv_obj_set_flex_flow(item_container, LV_FLEX_FLOW_COLUMN);
     lv_obj_set_style_pad_all(item_container, 0, 0);
-    lv_obj_set_style_bg_opa(item_container, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(item_container, 0, 0);
+    lv_obj_add_style(item_container, &PdaTheme::style_transparent, 0);
 
     // Cabeçalho clicável
     lv_obj_t* header = lv_obj_create(item_container);
@@ -427,8 +440,7 @@ static lv_obj_t* create_accordion_item(lv_obj_t* parent, const char* icon, const
     lv_obj_set_height(header, LV_SIZE_CONTENT); // Garante que o cabeçalho se ajuste ao conteúdo
     lv_obj_set_width(header, lv_pct(100));
     // Remove o estilo padrão do botão para um visual mais limpo
-    lv_obj_set_style_bg_opa(header, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(header, 0, 0);
+    lv_obj_add_style(header, &PdaTheme::style_transparent, 0);
     lv_obj_set_style_shadow_width(header, 0, 0);
     lv_obj_set_style_radius(header, 8, 0);
     lv_obj_set_style_pad_ver(header, 8, 0); // Aumenta o padding para dar mais altura ao item
@@ -452,8 +464,7 @@ static lv_obj_t* create_accordion_item(lv_obj_t* parent, const char* icon, const
     lv_obj_set_style_pad_left(content_panel, 20, 0); // Indenta o conteúdo para alinhar abaixo do título
     lv_obj_set_style_pad_right(content_panel, 10, 0);
     lv_obj_set_style_pad_ver(content_panel, 5, 0);
-    lv_obj_set_style_bg_opa(content_panel, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(content_panel, 0, 0);
+    lv_obj_add_style(content_panel, &PdaTheme::style_transparent, 0);
 
     // Adiciona o evento de clique ao cabeçalho para mostrar/ocultar o conteúdo
     lv_obj_add_event_cb(header, setting_header_event_cb, LV_EVENT_CLICKED, content_panel);
@@ -471,12 +482,12 @@ static void save_wifi_network(const char* ssid, const char* password) {
 
     // Lê a lista existente ou cria uma nova
     String json_string = preferences.getString(SAVED_NETWORKS_KEY, "[]");
-    JsonDocument old_doc;
+    JsonDocument old_doc(AllocTrace::json());
     deserializeJson(old_doc, json_string);
     JsonArray old_array = old_doc.as<JsonArray>();
 
     // Cria um novo documento e array para a lista atualizada
-    JsonDocument new_doc;
+    JsonDocument new_doc(AllocTrace::json());
     JsonArray new_array = new_doc.to<JsonArray>();
 
     // Adiciona a nova rede no início da lista
@@ -507,11 +518,12 @@ static void save_wifi_network(const char* ssid, const char* password) {
  * @brief Tenta se conectar automaticamente ao Wi-Fi na inicialização usando credenciais salvas.
  */
 static void auto_connect_wifi() {
+    STALL_SITE("Settings::auto_connect_wifi");
     preferences.begin("wifi-creds", true); // Abre em modo somente leitura
     String json_string = preferences.getString(SAVED_NETWORKS_KEY, "[]");
     preferences.end();
 
-    JsonDocument doc; // Usar JsonDocument aqui também para consistência
+    JsonDocument doc(AllocTrace::json()); // Usar JsonDocument aqui também para consistência
     deserializeJson(doc, json_string);
     JsonArray array = doc.as<JsonArray>();
 
@@ -547,33 +559,24 @@ static void auto_connect_wifi() {
  * @brief Inicializa a tela de configurações e seus elementos.
  */
 inline void init() {
-    settings_screen = lv_obj_create(NULL);
-    lv_obj_add_flag(settings_screen, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_set_size(settings_screen, 320, 240);
-    lv_obj_set_style_bg_color(settings_screen, lv_color_hex(0xFDF5E6), LV_PART_MAIN);
+    settings_screen = PdaTheme::create_screen();
+
+    // --- Cabeçalho (voltar + título) ---
+    // Não muda depois de criado, então é desenhado a partir de uma camada retida.
+    lv_obj_t* header = lv_obj_create(settings_screen);
+    lv_obj_set_size(header, 320, 55);
+    lv_obj_align(header, LV_ALIGN_TOP_LEFT, 0, 0);
+    lv_obj_add_style(header, &PdaTheme::style_transparent, 0);
+    lv_obj_set_style_pad_all(header, 0, 0);
+    lv_obj_clear_flag(header, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
 
     // --- Botão de Voltar ---
-    lv_obj_t* back_btn = lv_btn_create(settings_screen);
-    lv_obj_align(back_btn, LV_ALIGN_TOP_LEFT, 5, 5);
-    lv_obj_add_event_cb(back_btn, back_button_event_cb, LV_EVENT_CLICKED, NULL);
-    lv_obj_set_style_bg_color(back_btn, lv_color_hex(0x1A5FB4), LV_PART_MAIN);
-    lv_obj_set_style_bg_opa(back_btn, LV_OPA_50, LV_PART_MAIN);
-    lv_obj_set_style_radius(back_btn, 12, LV_PART_MAIN);
-    lv_obj_set_style_border_width(back_btn, 0, LV_PART_MAIN);
-    lv_obj_set_style_shadow_opa(back_btn, 0, LV_PART_MAIN);
-
-    lv_obj_t* back_label = lv_label_create(back_btn);
-    lv_label_set_text(back_label, LV_SYMBOL_LEFT);
-    lv_obj_set_style_text_color(back_label, lv_color_hex(0xFFFFFF), 0);
-    lv_obj_set_style_text_font(back_label, &lv_font_montserrat_16, 0);
-    lv_obj_center(back_label);
+    PdaTheme::create_back_button(header, back_button_event_cb);
 
     // --- Título da Tela ---
-    lv_obj_t* screen_title = lv_label_create(settings_screen);
-    lv_label_set_text(screen_title, "Settings");
-    lv_obj_set_style_text_font(screen_title, &lv_font_montserrat_28, 0);
-    lv_obj_set_style_text_color(screen_title, lv_color_hex(0x0B3C5D), 0);
-    lv_obj_align(screen_title, LV_ALIGN_TOP_MID, 0, 10);
+    PdaTheme::create_title(header, "Settings");
+
+    RenderCache::enable(header, "settings.header");
 
     // --- Contêiner principal para a lista de configurações ---
     main_container = lv_obj_create(settings_screen);
@@ -583,8 +586,7 @@ inline void init() {
     lv_obj_set_flex_flow(main_container, LV_FLEX_FLOW_COLUMN);
     lv_obj_set_style_pad_row(main_container, 0, 0); // Remove completamente o espaçamento entre os itens
     lv_obj_set_style_pad_hor(main_container, 10, 0);
-    lv_obj_set_style_bg_opa(main_container, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(main_container, 0, 0);
+    lv_obj_add_style(main_container, &PdaTheme::style_transparent, 0);
 
     // Habilita a animação para as mudanças de layout (efeito de expandir/recolher)
     static lv_style_t style_cont_transitions;
@@ -601,8 +603,6 @@ inline void init() {
     lv_obj_set_height(wifi_list, 120); // Define uma altura fixa para a lista
     lv_obj_align(wifi_list, LV_ALIGN_TOP_LEFT, 0, 0);
     // Remove o estilo da lista para que não interfira com os botões internos
-    lv_obj_set_style_bg_opa(wifi_list, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(wifi_list, 0, 0);
 
     // --- Item 2: Display (Placeholder) ---
     lv_obj_t* display_content = create_accordion_item(main_container, LV_SYMBOL_SETTINGS, "Display");
@@ -687,6 +687,7 @@ inline void show() {
  * @brief Gerencia a entrada do usuário e atualiza a interface.
  */
 inline void handle() {
+    PDA_TRACE_SCOPE("Settings::handle");
     // Se o modal de senha estiver aberto, desabilita a navegação de fundo
     if (password_modal_cont) {
         char key = Keyboard::get_key();
@@ -756,16 +757,12 @@ inline void handle() {
     }
 
     if (is_disconnect_ui_focused) {
-        // Foca e permite clicar no botão "Disconnect"
+        // Foca e permite clicar no botão "Disconnect" (o último item da lista)
         uint32_t child_count = lv_obj_get_child_cnt(wifi_list);
         if (child_count > 0) {
-            // O botão de desconectar é o último item da lista
-            lv_obj_t* disconnect_btn = lv_obj_get_child(wifi_list, child_count - 1);
-            lv_obj_set_style_bg_color(disconnect_btn, lv_color_hex(0x1A5FB4), 0);
-            lv_obj_set_style_bg_opa(disconnect_btn, LV_OPA_30, 0);
-
+            set_disconnect_selected(true);
             if (Trackball::clicked()) {
-                lv_event_send(disconnect_btn, LV_EVENT_CLICKED, NULL);
+                lv_event_send(lv_obj_get_child(wifi_list, child_count - 1), LV_EVENT_CLICKED, NULL);
             }
         }
         lv_timer_handler();
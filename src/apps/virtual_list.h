@@ -0,0 +1,319 @@
+#pragma once
+#include <lvgl.h>
+#include "system/lv_bulk.h"
+
+/**
+ * Virtual List - Lista com linhas recicladas
+ *
+ * Substitui o padrão "lv_obj_clean + um lv_list_add_btn por item" das listas
+ * longas (tarefas do Notes, eventos do Calendar). Só existem as linhas visíveis
+ * mais algumas de folga (VIRTUAL_LIST_OVERSCAN acima e abaixo):
+ *
+ * - A lista não guarda os dados; o app informa a quantidade de itens e um
+ *   callback que preenche uma linha para um índice do modelo.
+ * - Ao rolar (toque ou trackball), cada linha que sai da área visível é
+ *   reposicionada e associada a um novo índice (índice % tamanho do pool).
+ * - Um objeto invisível no fim do conteúdo define a altura total, então a barra
+ *   de rolagem e a inércia do toque funcionam como em uma lista comum.
+ * - As coordenadas do LVGL vão só até LV_COORD_MAX (8191; acima disso viram
+ *   LV_PCT). Por isso o conteúdo é uma janela de até VIRTUAL_LIST_WINDOW_PX a
+ *   partir do item `base`: perto de uma borda da janela, a base anda e a
+ *   rolagem é compensada na mesma medida, sem salto na tela. Listas que cabem
+ *   na janela nunca mudam de base; nas maiores, a barra de rolagem mostra a
+ *   posição dentro da janela.
+ * - A memória não depende da quantidade de itens e um refresh só preenche as
+ *   linhas visíveis. As linhas são botões de lista, então recebem os estilos
+ *   compartilhados do PdaTheme (incluindo o destaque em LV_STATE_CHECKED).
+ *
+ * 📋 Exemplo de uso:
+ *
+ * static VirtualList::List list;
+ *
+ * static void bind_row(lv_obj_t* row, lv_obj_t* label, uint32_t index) {
+ *     lv_label_set_text(label, items[index]);
+ * }
+ * static void row_clicked(uint32_t index) { open_item(index); }
+ *
+ * lv_obj_t* cont = VirtualList::create(&list, screen, bind_row, row_clicked);
+ * lv_obj_set_size(cont, 300, 180);
+ * VirtualList::set_count(&list, item_count);
+ */
+
+#define VIRTUAL_LIST_MAX_ROWS 16   // Limite do pool de linhas
+#define VIRTUAL_LIST_OVERSCAN 1    // Linhas extras acima e abaixo da área visível
+#define VIRTUAL_LIST_WINDOW_PX 4096 // Altura máxima do conteúdo, bem abaixo de LV_COORD_MAX
+
+namespace VirtualList {
+
+// Preenche a linha (botão de lista com um label) com o item `index` do modelo.
+typedef void (*BindCb)(lv_obj_t* row, lv_obj_t* label, uint32_t index);
+// Chamado quando a linha do item `index` é clicada (toque ou trackball).
+typedef void (*ClickCb)(uint32_t index);
+
+struct List {
+    lv_obj_t* cont = nullptr;                    // Container rolável (um lv_list sem layout)
+    lv_obj_t* spacer = nullptr;                  // Define a altura total do conteúdo
+    lv_obj_t* rows[VIRTUAL_LIST_MAX_ROWS] = {};  // Pool de linhas
+    int32_t row_index[VIRTUAL_LIST_MAX_ROWS] = {}; // Índice associado a cada linha (-1: livre)
+    uint8_t pool_size = 0;
+    lv_coord_t row_h = 0;
+    uint32_t count = 0;
+    uint32_t base = 0;                           // Item no topo do conteúdo (y = 0)
+    bool rebasing = false;                       // Compensando a rolagem de uma troca de base
+    int32_t selected = -1;                       // Item destacado pelo trackball
+    BindCb bind = nullptr;
+    ClickCb click = nullptr;
+    uint32_t binds = 0;                          // Linhas preenchidas desde a criação
+};
+
+inline void update(List* list);
+
+inline void row_click_event_cb(lv_event_t* e) {
+    List* list = (List*)lv_event_get_user_data(e);
+    intptr_t slot = (intptr_t)lv_obj_get_user_data(lv_event_get_target(e));
+    int32_t index = list->row_index[slot];
+    if (index < 0 || (uint32_t)index >= list->count || !list->click) return;
+    list->click((uint32_t)index);
+}
+
+inline void scroll_event_cb(lv_event_t* e) {
+    update((List*)lv_event_get_user_data(e));
+}
+
+inline void size_event_cb(lv_event_t* e) {
+    // A altura da lista define quantas linhas o pool precisa.
+    update((List*)lv_event_get_user_data(e));
+}
+
+/**
+ * @brief Desassocia todas as linhas; o próximo update() preenche as visíveis.
+ */
+inline void invalidate_rows(List* list) {
+    for (uint8_t slot = 0; slot < list->pool_size; slot++) {
+        list->row_index[slot] = -1;
+        lv_obj_add_flag(list->rows[slot], LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+/**
+ * @brief Cria uma linha do pool, igual às do lv_list_add_btn.
+ */
+inline lv_obj_t* create_row(List* list, uint8_t slot) {
+    lv_obj_t* row = lv_list_add_btn(list->cont, NULL, "");
+    lv_obj_set_user_data(row, (void*)(intptr_t)slot);
+    lv_obj_add_event_cb(row, row_click_event_cb, LV_EVENT_CLICKED, list);
+    lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+    list->rows[slot] = row;
+    list->row_index[slot] = -1;
+    return row;
+}
+
+/**
+ * @brief Garante linhas suficientes para cobrir a altura visível da lista.
+ */
+inline void ensure_pool(List* list) {
+    if (list->row_h == 0) {
+        // A altura da linha vem do tema (fonte + espaçamento da primeira linha criada).
+        // Calculada pelos estilos porque isto pode rodar dentro de um refresh de layout.
+        lv_obj_t* row = create_row(list, 0);
+        lv_obj_t* label = lv_obj_get_child(row, 0);
+        list->row_h = lv_font_get_line_height(lv_obj_get_style_text_font(label, LV_PART_MAIN)) +
+                      lv_obj_get_style_pad_top(row, LV_PART_MAIN) + lv_obj_get_style_pad_bottom(row, LV_PART_MAIN) +
+                      2 * lv_obj_get_style_border_width(row, LV_PART_MAIN);
+        lv_obj_set_height(row, list->row_h);
+        list->pool_size = 1;
+    }
+
+    lv_coord_t view_h = lv_obj_get_content_height(list->cont);
+    uint32_t needed = (view_h + list->row_h - 1) / list->row_h + 1 + 2 * VIRTUAL_LIST_OVERSCAN;
+    if (needed > VIRTUAL_LIST_MAX_ROWS) needed = VIRTUAL_LIST_MAX_ROWS;
+
+    if (needed > list->pool_size) {
+        for (uint8_t slot = list->pool_size; slot < needed; slot++) {
+            lv_obj_set_height(create_row(list, slot), list->row_h);
+        }
+        // O mapeamento índice % pool mudou: todas as linhas precisam ser refeitas.
+        list->pool_size = needed;
+        invalidate_rows(list);
+    }
+}
+
+/**
+ * @brief Itens que cabem na janela de conteúdo.
+ */
+inline uint32_t window_rows(const List* list) {
+    return VIRTUAL_LIST_WINDOW_PX / list->row_h;
+}
+
+/**
+ * @brief Põe o espaçador no fim da janela (ou do último item, se vier antes).
+ */
+inline void place_spacer(List* list) {
+    uint32_t rows = list->count - list->base;
+    if (rows > window_rows(list)) rows = window_rows(list);
+    lv_obj_set_height(list->spacer, rows ? 1 : 0);
+    lv_obj_set_y(list->spacer, rows ? (lv_coord_t)(rows * list->row_h) - 1 : 0);
+}
+
+/**
+ * @brief Troca o item do topo da janela e compensa a rolagem: o que está na
+ * tela fica no mesmo lugar.
+ */
+inline void rebase(List* list, int32_t base) {
+    int32_t max_base = list->count > window_rows(list) ? (int32_t)(list->count - window_rows(list)) : 0;
+    if (base > max_base) base = max_base;
+    if (base < 0) base = 0;
+    if ((uint32_t)base == list->base) return;
+
+    lv_coord_t shift = (lv_coord_t)((base - (int32_t)list->base) * list->row_h);
+    list->base = (uint32_t)base;
+    list->rebasing = true;
+    place_spacer(list);
+    for (uint8_t slot = 0; slot < list->pool_size; slot++) {
+        int32_t index = list->row_index[slot];
+        if (index < 0) continue;
+        if (index < base || index >= base + (int32_t)window_rows(list)) {
+            // Fora da nova janela: some, senão aumentaria a área rolável
+            list->row_index[slot] = -1;
+            lv_obj_add_flag(list->rows[slot], LV_OBJ_FLAG_HIDDEN);
+        } else {
+            lv_obj_set_y(list->rows[slot], (lv_coord_t)((index - base) * list->row_h));
+        }
+    }
+    lv_obj_scroll_by(list->cont, 0, shift, LV_ANIM_OFF);
+    list->rebasing = false;
+}
+
+/**
+ * @brief Associa as linhas do pool aos itens que estão na área visível.
+ * Só as linhas cujo item mudou são preenchidas de novo.
+ */
+inline void update(List* list) {
+    if (!list->cont || !list->bind || list->rebasing) return;
+    ensure_pool(list);
+
+    lv_coord_t view_h = lv_obj_get_content_height(list->cont);
+    lv_coord_t scroll_y = lv_obj_get_scroll_y(list->cont);
+    // Perto de uma borda da janela: centraliza a área visível nela. Não durante
+    // a animação do trackball, que rola até um y absoluto (move_selection já
+    // deixou o item dentro da janela).
+    lv_coord_t window_h = window_rows(list) * list->row_h;
+    lv_coord_t margin = window_h / 4;
+    bool near_top = list->base > 0 && scroll_y < margin;
+    bool near_bottom = list->base + window_rows(list) < list->count && scroll_y + view_h > window_h - margin;
+    if ((near_top || near_bottom) && !lv_anim_get(list->cont, NULL)) {
+        rebase(list, (int32_t)(list->base + scroll_y / list->row_h) - (int32_t)(window_h - view_h) / 2 / list->row_h);
+        scroll_y = lv_obj_get_scroll_y(list->cont);
+    }
+
+    int32_t first = (int32_t)list->base + scroll_y / list->row_h - VIRTUAL_LIST_OVERSCAN;
+    if (first < (int32_t)list->base) first = (int32_t)list->base;
+    int32_t last = first + list->pool_size - 1;
+    if (last >= (int32_t)list->count) last = (int32_t)list->count - 1;
+    if (last >= (int32_t)(list->base + window_rows(list))) last = (int32_t)(list->base + window_rows(list)) - 1;
+
+    bool used[VIRTUAL_LIST_MAX_ROWS] = {};
+    for (int32_t index = first; index <= last; index++) {
+        uint8_t slot = index % list->pool_size;
+        lv_obj_t* row = list->rows[slot];
+        used[slot] = true;
+        if (list->row_index[slot] != index) {
+            list->row_index[slot] = index;
+            lv_obj_set_y(row, (lv_coord_t)((index - (int32_t)list->base) * list->row_h));
+            list->bind(row, lv_obj_get_child(row, 0), (uint32_t)index);
+            list->binds++;
+            lv_obj_clear_flag(row, LV_OBJ_FLAG_HIDDEN);
+        }
+        if (index == list->selected) lv_obj_add_state(row, LV_STATE_CHECKED);
+        else lv_obj_clear_state(row, LV_STATE_CHECKED);
+    }
+    for (uint8_t slot = 0; slot < list->pool_size; slot++) {
+        if (!used[slot] && list->row_index[slot] != -1) {
+            list->row_index[slot] = -1;
+            lv_obj_add_flag(list->rows[slot], LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+}
+
+/**
+ * @brief Cria a lista. O container retornado é posicionado e dimensionado
+ * como qualquer objeto; as linhas são criadas quando houver itens.
+ */
+inline lv_obj_t* create(List* list, lv_obj_t* parent, BindCb bind, ClickCb click) {
+    list->bind = bind;
+    list->click = click;
+    list->cont = lv_list_create(parent);
+    // As linhas são posicionadas pela própria lista, sem o flex do lv_list.
+    lv_obj_set_layout(list->cont, 0);
+    lv_obj_set_scroll_dir(list->cont, LV_DIR_VER);
+
+    list->spacer = lv_obj_create(list->cont);
+    lv_obj_remove_style_all(list->spacer);
+    lv_obj_clear_flag(list->spacer, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_size(list->spacer, 1, 0);
+
+    lv_obj_add_event_cb(list->cont, scroll_event_cb, LV_EVENT_SCROLL, list);
+    lv_obj_add_event_cb(list->cont, size_event_cb, LV_EVENT_SIZE_CHANGED, list);
+    return list->cont;
+}
+
+/**
+ * @brief Troca a quantidade de itens (ex: depois de buscar os dados), volta ao
+ * topo e preenche só as linhas visíveis.
+ */
+inline void set_count(List* list, uint32_t count) {
+    list->count = count;
+    list->base = 0;
+    list->selected = -1;
+    ensure_pool(list);
+    invalidate_rows(list);
+    place_spacer(list);
+    lv_obj_scroll_to_y(list->cont, 0, LV_ANIM_OFF);
+    // As linhas visíveis são preenchidas com um único layout e redesenho
+    LvBulk::Scope bulk(list->cont);
+    update(list);
+}
+
+/**
+ * @brief Preenche de novo as linhas visíveis (o modelo mudou, a quantidade não).
+ */
+inline void refresh(List* list) {
+    LvBulk::Scope bulk(list->cont);
+    invalidate_rows(list);
+    update(list);
+}
+
+/**
+ * @brief Move o destaque do trackball em `delta` itens, rolando até ele.
+ */
+inline void move_selection(List* list, int32_t delta) {
+    if (list->count == 0) return;
+    int32_t selected = list->selected < 0 ? 0 : list->selected + delta;
+    if (selected < 0) selected = 0;
+    if (selected >= (int32_t)list->count) selected = (int32_t)list->count - 1;
+    list->selected = selected;
+
+    // O destino da animação é um y dentro da janela: o item precisa estar longe
+    // das bordas dela antes de começar
+    int32_t rows = (int32_t)window_rows(list);
+    int32_t in_window = selected - (int32_t)list->base;
+    if (in_window < rows / 4 || in_window >= rows - rows / 4) rebase(list, selected - rows / 2);
+
+    lv_coord_t view_h = lv_obj_get_content_height(list->cont);
+    lv_coord_t scroll_y = lv_obj_get_scroll_y(list->cont);
+    lv_coord_t top = (lv_coord_t)((selected - (int32_t)list->base) * list->row_h);
+    if (top < scroll_y) lv_obj_scroll_to_y(list->cont, top, LV_ANIM_ON);
+    else if (top + list->row_h > scroll_y + view_h) lv_obj_scroll_to_y(list->cont, top + list->row_h - view_h, LV_ANIM_ON);
+    update(list);
+}
+
+/**
+ * @brief Aciona o item destacado pelo trackball, como um clique.
+ */
+inline void activate_selection(List* list) {
+    if (list->selected >= 0 && (uint32_t)list->selected < list->count && list->click) {
+        list->click((uint32_t)list->selected);
+    }
+}
+
+} // namespace VirtualList
@@ -9,17 +9,14 @@
 // Incluído a partir de apps.h, que já define o AppManager.
 
 // --- Inclusão dos Ícones de Clima ---
-// Presume-se que os arquivos .c dos ícones estão em uma subpasta 'Icons'
-#include "Icons/weather/lv_img_weather_sun.c"
-#include "Icons/weather/lv_img_weather_moon.c"
-#include "Icons/weather/lv_img_weather_cloud_sun.c"
-#include "Icons/weather/lv_img_weather_cloud_moon.c"
-#include "Icons/weather/lv_img_weather_cloud.c"
-#include "Icons/weather/lv_img_weather_rain.c"
-#include "Icons/weather/lv_img_weather_thunderstorm.c"
-#include "Icons/weather/lv_img_weather_snow.c"
-#include "Icons/weather/lv_img_weather_mist.c"
-#include "Icons/weather/lv_img_weather_unknown.c"
+// Variantes de 125 px (RGB565A8) geradas por tools/icons/prescale_icons.py a partir dos
+// arquivos em 'Icons/weather' e lidas do pacote de assets. Já estão no tamanho da tela, sem zoom.
+#include "system/asset_pack.h"
+#include "apps/pda_theme.h"
+#include "system/pda_trace.h"
+#include "system/alloc_trace.h"
+#include "system/stall_detector.h"
+#define WEATHER_ICON(name) ASSET_PATH("weather/" #name "_125")
 
 namespace Weather {
 
@@ -39,8 +36,8 @@ static lv_obj_t* forecast_label = nullptr;
 
 // --- Function Prototypes ---
 static void back_button_event_cb(lv_event_t* e);
-static const lv_img_dsc_t* get_weather_image_from_code(const char* icon_code);
-static void update_weather_ui(const char* city, float temp, const char* desc, const lv_img_dsc_t* img_src);
+static const char* get_weather_image_from_code(const char* icon_code);
+static void update_weather_ui(const char* city, float temp, const char* desc, const char* img_src);
 static void refresh_event_cb(lv_event_t* e);
 static void fetch_weather_data();
 
@@ -61,7 +58,7 @@ static void refresh_event_cb(lv_event_t* e) {
     if (WiFi.status() == WL_CONNECTED) {
         LV_LOG_USER("Screen clicked, refreshing weather data...");
         lv_label_set_text(city_label, "Updating...");
-        lv_img_set_src(weather_icon_img, &lv_img_weather_unknown);
+        lv_img_set_src(weather_icon_img, WEATHER_ICON(unknown));
         lv_label_set_text(temp_label, "--°C");
         lv_label_set_text(desc_label, "");
         fetch_weather_data();
@@ -73,25 +70,25 @@ static void refresh_event_cb(lv_event_t* e) {
  * @param icon_code O código do ícone da API (ex: "01d", "10n").
  * @return Um ponteiro para a estrutura da imagem LVGL.
  */
-static const lv_img_dsc_t* get_weather_image_from_code(const char* icon_code) {
-    if (strcmp(icon_code, "01d") == 0) return &lv_img_weather_sun;
-    if (strcmp(icon_code, "01n") == 0) return &lv_img_weather_moon;
-    if (strcmp(icon_code, "02d") == 0) return &lv_img_weather_cloud_sun;
-    if (strcmp(icon_code, "02n") == 0) return &lv_img_weather_cloud_moon;
-    if (strcmp(icon_code, "03d") == 0 || strcmp(icon_code, "03n") == 0) return &lv_img_weather_cloud;
-    if (strcmp(icon_code, "04d") == 0 || strcmp(icon_code, "04n") == 0) return &lv_img_weather_cloud; // Usando o mesmo para nuvens quebradas
-    if (strcmp(icon_code, "09d") == 0 || strcmp(icon_code, "09n") == 0) return &lv_img_weather_rain;
-    if (strcmp(icon_code, "10d") == 0 || strcmp(icon_code, "10n") == 0) return &lv_img_weather_rain;
-    if (strcmp(icon_code, "11d") == 0 || strcmp(icon_code, "11n") == 0) return &lv_img_weather_thunderstorm;
-    if (strcmp(icon_code, "13d") == 0 || strcmp(icon_code, "13n") == 0) return &lv_img_weather_snow;
-    if (strcmp(icon_code, "50d") == 0 || strcmp(icon_code, "50n") == 0) return &lv_img_weather_mist;
-    return &lv_img_weather_unknown; // Imagem padrão
+static const char* get_weather_image_from_code(const char* icon_code) {
+    if (strcmp(icon_code, "01d") == 0) return WEATHER_ICON(sun);
+    if (strcmp(icon_code, "01n") == 0) return WEATHER_ICON(moon);
+    if (strcmp(icon_code, "02d") == 0) return WEATHER_ICON(cloud_sun);
+    if (strcmp(icon_code, "02n") == 0) return WEATHER_ICON(cloud_moon);
+    if (strcmp(icon_code, "03d") == 0 || strcmp(icon_code, "03n") == 0) return WEATHER_ICON(cloud);
+    if (strcmp(icon_code, "04d") == 0 || strcmp(icon_code, "04n") == 0) return WEATHER_ICON(cloud); // Usando o mesmo para nuvens quebradas
+    if (strcmp(icon_code, "09d") == 0 || strcmp(icon_code, "09n") == 0) return WEATHER_ICON(rain);
+    if (strcmp(icon_code, "10d") == 0 || strcmp(icon_code, "10n") == 0) return WEATHER_ICON(rain);
+    if (strcmp(icon_code, "11d") == 0 || strcmp(icon_code, "11n") == 0) return WEATHER_ICON(thunderstorm);
+    if (strcmp(icon_code, "13d") == 0 || strcmp(icon_code, "13n") == 0) return WEATHER_ICON(snow);
+    if (strcmp(icon_code, "50d") == 0 || strcmp(icon_code, "50n") == 0) return WEATHER_ICON(mist);
+    return WEATHER_ICON(unknown); // Imagem padrão
 }
 
 /**
  * @brief Atualiza os labels da UI com os novos dados de clima.
  */
-static void update_weather_ui(const char* city, float temp, const char* desc, const lv_img_dsc_t* img_src) {
+static void update_weather_ui(const char* city, float temp, const char* desc, const char* img_src) {
     lv_label_set_text(city_label, city);
     lv_img_set_src(weather_icon_img, img_src);
     lv_label_set_text_fmt(temp_label, "%.0f°C", temp);
@@ -103,6 +100,7 @@ static void update_weather_ui(const char* city, float temp, const char* desc, co
  * @brief Busca os dados de clima da API OpenWeatherMap.
  */
 static void fetch_weather_data() {
+    STALL_SITE("Weather::fetch_weather_data");
     // Use WiFiClient client; se quiser passar um client específico
     HTTPClient http;
     String api_url = "https://api.openweathermap.org/data/2.5/weather?id="; // Usa HTTPS para maior confiabilidade
@@ -119,21 +117,26 @@ static void fetch_weather_data() {
     http.setConnectTimeout(5000); // Timeout de conexão de 5 segundos
     http.setTimeout(5000);        // Timeout de resposta de 5 segundos
 
+    PDA_TRACE_BEGIN("weather.http_get");
     int http_code = http.GET();
+    PDA_TRACE_END("weather.http_get");
 
     if (http_code > 0) {
         if (http_code == HTTP_CODE_OK) {
+            PDA_TRACE_BEGIN("weather.http_read");
             String payload = http.getString();
-            JsonDocument doc;
+            PDA_TRACE_END("weather.http_read");
+            JsonDocument doc(AllocTrace::json());
+            PDA_TRACE_BEGIN("weather.json_parse");
             DeserializationError error = deserializeJson(doc, payload);
+            PDA_TRACE_END("weather.json_parse");
 
             if (error) {
                 LV_LOG_ERROR("deserializeJson() failed: %s", error.c_str());
                 lv_label_set_text(forecast_label, "JSON parsing failed.");
             } else {
-                // Usa a classe String do Arduino e a função utilitária para limpar o nome da cidade
+                // As fontes incluem Latin-1, então o nome da cidade é exibido com acentos
                 String city_name_str = doc["name"];
-                city_name_str = Utils::sanitizeString(city_name_str);
 
                 float temperature = doc["main"]["temp"];
                 const char* description = doc["weather"][0]["description"];
@@ -159,43 +162,22 @@ static void fetch_weather_data() {
  * @brief Inicializa a tela de clima e seus elementos.
  */
 inline void init() {
-    weather_screen = lv_obj_create(NULL);
-    lv_obj_add_flag(weather_screen, LV_OBJ_FLAG_HIDDEN);
-    lv_obj_set_size(weather_screen, 320, 240);
-    lv_obj_set_style_bg_color(weather_screen, lv_color_hex(0xFDF5E6), LV_PART_MAIN);
+    weather_screen = PdaTheme::create_screen();
     // Adiciona o evento de clique à tela para permitir o refresh
     lv_obj_add_flag(weather_screen, LV_OBJ_FLAG_CLICKABLE);
     lv_obj_add_event_cb(weather_screen, refresh_event_cb, LV_EVENT_CLICKED, NULL);
 
     // --- Botão de Voltar ---
-    lv_obj_t* back_btn = lv_btn_create(weather_screen);
-    lv_obj_align(back_btn, LV_ALIGN_TOP_LEFT, 5, 5);
-    lv_obj_add_event_cb(back_btn, back_button_event_cb, LV_EVENT_CLICKED, NULL);
-    lv_obj_set_style_bg_color(back_btn, lv_color_hex(0x1A5FB4), LV_PART_MAIN);
-    lv_obj_set_style_bg_opa(back_btn, LV_OPA_50, LV_PART_MAIN);
-    lv_obj_set_style_radius(back_btn, 12, LV_PART_MAIN);
-    lv_obj_set_style_border_width(back_btn, 0, LV_PART_MAIN);
-    lv_obj_set_style_shadow_opa(back_btn, 0, LV_PART_MAIN);
-
-    lv_obj_t* back_label = lv_label_create(back_btn);
-    lv_label_set_text(back_label, LV_SYMBOL_LEFT);
-    lv_obj_set_style_text_color(back_label, lv_color_hex(0xFFFFFF), 0);
-    lv_obj_set_style_text_font(back_label, &lv_font_montserrat_16, 0);
-    lv_obj_center(back_label);
+    PdaTheme::create_back_button(weather_screen, back_button_event_cb);
 
     // --- Título da Tela ---
-    lv_obj_t* screen_title = lv_label_create(weather_screen);
-    lv_label_set_text(screen_title, "Weather");
-    lv_obj_set_style_text_font(screen_title, &lv_font_montserrat_28, 0);
-    lv_obj_set_style_text_color(screen_title, lv_color_hex(0x0B3C5D), 0);
-    lv_obj_align(screen_title, LV_ALIGN_TOP_MID, 0, 10);
+    PdaTheme::create_title(weather_screen, "Weather");
 
     // --- Contêiner Principal de Informações ---
     lv_obj_t* main_container = lv_obj_create(weather_screen);
     lv_obj_set_size(main_container, 300, 180);
     lv_obj_align(main_container, LV_ALIGN_CENTER, 0, 20);
-    lv_obj_set_style_bg_opa(main_container, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(main_container, 0, 0);
+    lv_obj_add_style(main_container, &PdaTheme::style_transparent, 0);
     lv_obj_add_event_cb(main_container, refresh_event_cb, LV_EVENT_CLICKED, NULL);
 
     // --- Nome da Cidade ---
@@ -208,9 +190,9 @@ inline void init() {
 
     // --- Ícone do Clima (agora como imagem) ---
     weather_icon_img = lv_img_create(main_container);
-    lv_img_set_src(weather_icon_img, &lv_img_weather_unknown); // Imagem inicial
-    lv_obj_align(weather_icon_img, LV_ALIGN_LEFT_MID, 15, 0);
-    lv_img_set_zoom(weather_icon_img, LV_IMG_ZOOM_NONE + 64); // Ajuste o zoom conforme necessário
+    lv_img_set_src(weather_icon_img, WEATHER_ICON(unknown)); // Imagem inicial
+    lv_obj_set_size(weather_icon_img, 125, 125); // Tamanho fixo, mesmo antes da primeira decodificação
+    lv_obj_align(weather_icon_img, LV_ALIGN_LEFT_MID, 3, 0); // Mesma posição do antigo ícone de 100 px com zoom
     lv_obj_add_event_cb(weather_icon_img, refresh_event_cb, LV_EVENT_CLICKED, NULL);
 
     // --- Temperatura Atual ---
@@ -249,13 +231,13 @@ inline void show() {
     if (weather_screen) {
         if (WiFi.status() == WL_CONNECTED) {
             lv_label_set_text(city_label, "Updating...");
-            lv_img_set_src(weather_icon_img, &lv_img_weather_unknown);
+            lv_img_set_src(weather_icon_img, WEATHER_ICON(unknown));
             lv_label_set_text(temp_label, "--°C");
             lv_label_set_text(desc_label, "");
             fetch_weather_data();
         } else {
             lv_label_set_text(city_label, "No Connection");
-            lv_img_set_src(weather_icon_img, &lv_img_weather_unknown);
+            lv_img_set_src(weather_icon_img, WEATHER_ICON(unknown));
             lv_label_set_text(temp_label, "N/A");
             lv_label_set_text(desc_label, "Connect to Wi-Fi in Settings");
         }
@@ -268,6 +250,7 @@ inline void show() {
  * @brief Gerencia a entrada do usuário e atualiza a interface.
  */
 inline void handle() {
+    PDA_TRACE_SCOPE("Weather::handle");
     // Por enquanto, apenas o timer do LVGL é necessário.
     lv_timer_handler();
 }
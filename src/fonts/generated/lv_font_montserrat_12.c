@@ -0,0 +1,1584 @@
+/*******************************************************************************
+ * Size: 12 px
+ * Bpp: 4
+ * Charset: text, 212 glyphs
+ * Generated by tools/fonts/gen_fonts.py from Montserrat-Medium.ttf and FontAwesome5-Solid+Brands+Regular.woff. Do not edit.
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x6, 0x20, 0xf4, 0xf, 0x30, 0xe3, 0xe, 0x20, 0xd1, 0x4, 0x0, 0x61, 0x1e, 0x40,
+
+    /* U+0022 "\"" */
+    0x15, 0x6, 0x3b, 0x1e, 0x3b, 0xd, 0x29, 0xb,
+
+    /* U+0023 "#" */
+    0x0, 0x24, 0x1, 0x40, 0x0, 0x5, 0x80, 0x49, 0x0, 0x14, 0x98, 0x48, 0x94, 0x3, 0xad, 0xba,
+    0xcb, 0xa1, 0x0, 0xb2, 0x9, 0x40, 0x0, 0x1d, 0x11, 0xb2, 0x0, 0x9d, 0xfd, 0xdf, 0xd9, 0x0,
+    0x2b, 0x0, 0xd0, 0x0, 0x3, 0x90, 0x2b, 0x0, 0x0,
+
+    /* U+0024 "$" */
+    0x0, 0x7, 0x20, 0x0, 0x4, 0xc8, 0x30, 0xb, 0xdd, 0xad, 0x63, 0xe1, 0x93, 0x1, 0x3f, 0x49,
+    0x30, 0x0, 0x7e, 0xf9, 0x40, 0x0, 0x1a, 0xae, 0x80, 0x0, 0x93, 0x5e, 0x48, 0x29, 0x39, 0xb2,
+    0xae, 0xfe, 0xb2, 0x0, 0x9, 0x30, 0x0, 0x0, 0x31, 0x0,
+
+    /* U+0025 "%" */
+    0x3, 0x62, 0x0, 0x4, 0x20, 0x3b, 0x4b, 0x10, 0x3b, 0x0, 0x84, 0x7, 0x40, 0xb2, 0x0, 0x75,
+    0x8, 0x48, 0x60, 0x0, 0x1b, 0x9a, 0x3b, 0x27, 0x40, 0x0, 0x11, 0xc2, 0xb4, 0x95, 0x0, 0x8,
+    0x53, 0x90, 0x29, 0x0, 0x4a, 0x2, 0xa0, 0x48, 0x1, 0xc1, 0x0, 0x8a, 0xa2,
+
+    /* U+0026 "&" */
+    0x0, 0x26, 0x51, 0x0, 0x2, 0xe7, 0x9a, 0x0, 0x6, 0xb0, 0x2d, 0x0, 0x2, 0xe6, 0xc6, 0x0,
+    0x1, 0xbf, 0x70, 0x0, 0x1c, 0x74, 0xe3, 0x67, 0x6b, 0x0, 0x4e, 0xd4, 0x5d, 0x20, 0x1b, 0xf4,
+    0x8, 0xed, 0xd8, 0x4b,
+
+    /* U+0027 "'" */
+    0x15, 0x3b, 0x3b, 0x29,
+
+    /* U+0028 "(" */
+    0x9, 0x62, 0xe1, 0x7a, 0xa, 0x70, 0xc5, 0xd, 0x40, 0xc5, 0xb, 0x60, 0x89, 0x4, 0xd0, 0xc,
+    0x40, 0x22,
+
+    /* U+0029 ")" */
+    0x5a, 0x0, 0xe2, 0xa, 0x70, 0x6b, 0x4, 0xd0, 0x3d, 0x4, 0xd0, 0x5c, 0x8, 0x90, 0xc4, 0x4d,
+    0x2, 0x20,
+
+    /* U+002A "*" */
+    0x0, 0xa0, 0x7, 0x9c, 0xb5, 0x1b, 0xf9, 0x6, 0x4b, 0x65, 0x0, 0x60, 0x0,
+
+    /* U+002B "+" */
+    0x0, 0xc, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x2a, 0xaf, 0xaa, 0x21, 0x44, 0xf4, 0x41, 0x0, 0xf,
+    0x0, 0x0, 0x0, 0x60, 0x0,
+
+    /* U+002C "," */
+    0x27, 0x4, 0xf1, 0x1c, 0x3, 0x50,
+
+    /* U+002D "-" */
+    0x4c, 0xcb, 0x13, 0x33,
+
+    /* U+002E "." */
+    0x27, 0x5, 0xe1,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x11, 0x0, 0x0, 0x97, 0x0, 0x0, 0xe2, 0x0, 0x4, 0xb0, 0x0, 0xa, 0x60, 0x0,
+    0x1e, 0x10, 0x0, 0x5a, 0x0, 0x0, 0xb5, 0x0, 0x1, 0xe1, 0x0, 0x6, 0xa0, 0x0, 0xb, 0x40,
+    0x0, 0x2e, 0x0, 0x0, 0x11, 0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x26, 0x62, 0x0, 0x4, 0xea, 0xae, 0x40, 0xe, 0x60, 0x6, 0xe0, 0x4e, 0x0, 0x0, 0xe4,
+    0x6c, 0x0, 0x0, 0xc6, 0x5d, 0x0, 0x0, 0xd5, 0x3f, 0x10, 0x1, 0xf3, 0xb, 0xb1, 0x1a, 0xb0,
+    0x1, 0xae, 0xea, 0x10,
+
+    /* U+0031 "1" */
+    0x56, 0x61, 0x9a, 0xf3, 0x0, 0xf3, 0x0, 0xf3, 0x0, 0xf3, 0x0, 0xf3, 0x0, 0xf3, 0x0, 0xf3,
+    0x0, 0xf3,
+
+    /* U+0032 "2" */
+    0x2, 0x67, 0x40, 0x7, 0xea, 0x9e, 0x90, 0x22, 0x0, 0x3f, 0x10, 0x0, 0x3, 0xf1, 0x0, 0x0,
+    0xb9, 0x0, 0x1, 0xba, 0x0, 0x1, 0xba, 0x0, 0x1, 0xca, 0x11, 0x10, 0x8f, 0xff, 0xff, 0x70,
+
+    /* U+0033 "3" */
+    0x36, 0x66, 0x66, 0x5, 0xaa, 0xad, 0xd0, 0x0, 0x4, 0xe2, 0x0, 0x2, 0xe5, 0x0, 0x0, 0x9f,
+    0xb3, 0x0, 0x1, 0x27, 0xe1, 0x0, 0x0, 0xe, 0x48, 0x51, 0x6, 0xf2, 0x6c, 0xef, 0xd5, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x25, 0x0, 0x0, 0x1, 0xd5, 0x0, 0x0, 0xb, 0x90, 0x0, 0x0, 0x8c, 0x0, 0x0,
+    0x5, 0xe2, 0xc, 0x40, 0x2e, 0x51, 0x1d, 0x51, 0x8e, 0xee, 0xef, 0xec, 0x0, 0x0, 0xd, 0x40,
+    0x0, 0x0, 0xd, 0x40,
+
+    /* U+0035 "5" */
+    0x5, 0x66, 0x66, 0x0, 0xcb, 0xaa, 0xa0, 0xe, 0x30, 0x0, 0x1, 0xf2, 0x0, 0x0, 0x2f, 0xff,
+    0xd6, 0x0, 0x0, 0x15, 0xf3, 0x0, 0x0, 0xc, 0x66, 0x61, 0x4, 0xe4, 0x4c, 0xef, 0xd6, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x15, 0x76, 0x10, 0x3, 0xeb, 0x9a, 0x60, 0xd, 0x70, 0x0, 0x0, 0x4e, 0x0, 0x10, 0x0,
+    0x6c, 0x9e, 0xec, 0x30, 0x6f, 0x80, 0x8, 0xd0, 0x3f, 0x20, 0x2, 0xf1, 0xc, 0x80, 0x8, 0xc0,
+    0x2, 0xae, 0xec, 0x20,
+
+    /* U+0037 "7" */
+    0x46, 0x66, 0x66, 0x4a, 0xca, 0xaa, 0xe9, 0xa8, 0x0, 0x1e, 0x31, 0x10, 0x7, 0xb0, 0x0, 0x0,
+    0xe5, 0x0, 0x0, 0x6d, 0x0, 0x0, 0xd, 0x60, 0x0, 0x4, 0xe1, 0x0, 0x0, 0xb8, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x47, 0x73, 0x0, 0xa, 0xd8, 0x9e, 0x60, 0x2f, 0x20, 0x6, 0xd0, 0x1e, 0x50, 0x8, 0xb0,
+    0x6, 0xfd, 0xee, 0x30, 0x2e, 0x62, 0x39, 0xc0, 0x7c, 0x0, 0x1, 0xf2, 0x4e, 0x30, 0x7, 0xe1,
+    0x6, 0xde, 0xec, 0x40,
+
+    /* U+0039 "9" */
+    0x1, 0x67, 0x40, 0x2, 0xda, 0x8c, 0xb0, 0x8a, 0x0, 0xd, 0x69, 0x90, 0x0, 0xbb, 0x4e, 0x75,
+    0x9e, 0xc0, 0x49, 0xa7, 0x7b, 0x0, 0x0, 0xa, 0x80, 0x20, 0x17, 0xe2, 0x1d, 0xfe, 0xb3, 0x0,
+
+    /* U+003A ":" */
+    0x15, 0x6, 0xf1, 0x2, 0x0, 0x0, 0x0, 0x2, 0x70, 0x5e, 0x10,
+
+    /* U+003B ";" */
+    0x15, 0x6, 0xf1, 0x2, 0x0, 0x0, 0x0, 0x2, 0x70, 0x4f, 0x11, 0xc0, 0x35, 0x0,
+
+    /* U+003C "<" */
+    0x0, 0x0, 0x39, 0x20, 0x16, 0xcc, 0x61, 0x2e, 0x93, 0x0, 0x1, 0x9d, 0x93, 0x0, 0x0, 0x16,
+    0xcc, 0x20, 0x0, 0x0, 0x31,
+
+    /* U+003D "=" */
+    0x1, 0x11, 0x11, 0x3, 0xdd, 0xdd, 0xd2, 0x0, 0x0, 0x0, 0x1, 0x44, 0x44, 0x41, 0x2a, 0xaa,
+    0xaa, 0x20,
+
+    /* U+003E ">" */
+    0x28, 0x30, 0x0, 0x1, 0x6c, 0xc6, 0x10, 0x0, 0x3, 0x9e, 0x20, 0x3, 0x9d, 0x91, 0x2c, 0xc6,
+    0x10, 0x1, 0x20, 0x0, 0x0,
+
+    /* U+003F "?" */
+    0x2, 0x67, 0x40, 0x7e, 0x99, 0xe9, 0x22, 0x0, 0x4f, 0x0, 0x0, 0x6d, 0x0, 0x5, 0xe3, 0x0,
+    0x1e, 0x30, 0x0, 0x15, 0x0, 0x0, 0x15, 0x0, 0x0, 0x4e, 0x10,
+
+    /* U+0040 "@" */
+    0x0, 0x0, 0x36, 0x75, 0x10, 0x0, 0x0, 0x3c, 0x96, 0x57, 0xc8, 0x0, 0x3, 0xc2, 0x0, 0x0,
+    0x7, 0xa0, 0xc, 0x21, 0xae, 0xd9, 0xd3, 0x95, 0x3a, 0x9, 0xa0, 0x6, 0xf3, 0x3a, 0x68, 0xe,
+    0x30, 0x0, 0xd3, 0xc, 0x58, 0xe, 0x30, 0x0, 0xd3, 0x1b, 0x3b, 0x9, 0xa1, 0x6, 0xf4, 0x58,
+    0xc, 0x31, 0xae, 0xd9, 0x7e, 0xb1, 0x3, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xb8, 0x7a,
+    0x80, 0x0, 0x0, 0x0, 0x24, 0x53, 0x0, 0x0,
+
+    /* U+0041 "A" */
+    0x0, 0x2, 0x60, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x1e, 0x6d, 0x0, 0x0, 0x8, 0xa0,
+    0xd4, 0x0, 0x1, 0xe3, 0x7, 0xb0, 0x0, 0x6c, 0x11, 0x2e, 0x30, 0xd, 0xee, 0xee, 0xea, 0x5,
+    0xd0, 0x0, 0x2, 0xf2, 0xc7, 0x0, 0x0, 0xa, 0x90,
+
+    /* U+0042 "B" */
+    0x46, 0x66, 0x52, 0x0, 0xbc, 0x99, 0xae, 0x80, 0xb7, 0x0, 0x4, 0xe0, 0xb7, 0x0, 0x6, 0xd0,
+    0xbd, 0xbb, 0xcf, 0x50, 0xb9, 0x33, 0x48, 0xe2, 0xb7, 0x0, 0x0, 0xc7, 0xb7, 0x0, 0x3, 0xe4,
+    0xbf, 0xff, 0xed, 0x70,
+
+    /* U+0043 "C" */
+    0x0, 0x3, 0x77, 0x40, 0x0, 0x1b, 0xea, 0x9d, 0xb1, 0xb, 0xb1, 0x0, 0x5, 0x3, 0xf1, 0x0,
+    0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x0, 0x1f, 0x40, 0x0, 0x0, 0x0,
+    0x7e, 0x61, 0x5, 0xb1, 0x0, 0x5c, 0xff, 0xc5, 0x0,
+
+    /* U+0044 "D" */
+    0x46, 0x66, 0x52, 0x0, 0xb, 0xca, 0xab, 0xea, 0x10, 0xb7, 0x0, 0x2, 0xca, 0xb, 0x70, 0x0,
+    0x2, 0xf2, 0xb7, 0x0, 0x0, 0xe, 0x4b, 0x70, 0x0, 0x0, 0xe4, 0xb7, 0x0, 0x0, 0x5e, 0x1b,
+    0x71, 0x12, 0x7e, 0x50, 0xbf, 0xff, 0xeb, 0x40, 0x0,
+
+    /* U+0045 "E" */
+    0x46, 0x66, 0x66, 0x1b, 0xca, 0xaa, 0xa2, 0xb7, 0x0, 0x0, 0xb, 0x70, 0x0, 0x0, 0xbd, 0xcc,
+    0xc8, 0xb, 0x94, 0x44, 0x20, 0xb7, 0x0, 0x0, 0xb, 0x71, 0x11, 0x10, 0xbf, 0xff, 0xff, 0x50,
+
+    /* U+0046 "F" */
+    0x46, 0x66, 0x66, 0x1b, 0xca, 0xaa, 0xa2, 0xb7, 0x0, 0x0, 0xb, 0x70, 0x0, 0x0, 0xba, 0x66,
+    0x64, 0xb, 0xc9, 0x99, 0x60, 0xb7, 0x0, 0x0, 0xb, 0x70, 0x0, 0x0, 0xb7, 0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x3, 0x67, 0x40, 0x0, 0x1b, 0xea, 0x9d, 0xc1, 0xb, 0xb1, 0x0, 0x5, 0x3, 0xf1, 0x0,
+    0x0, 0x0, 0x6c, 0x0, 0x0, 0x3, 0x15, 0xd0, 0x0, 0x0, 0xe3, 0x1f, 0x40, 0x0, 0xe, 0x30,
+    0x7e, 0x61, 0x4, 0xe3, 0x0, 0x5c, 0xee, 0xd7, 0x0,
+
+    /* U+0048 "H" */
+    0x43, 0x0, 0x0, 0x43, 0xb7, 0x0, 0x0, 0xb7, 0xb7, 0x0, 0x0, 0xb7, 0xb7, 0x0, 0x0, 0xb7,
+    0xbd, 0xcc, 0xcc, 0xe7, 0xb9, 0x44, 0x44, 0xc7, 0xb7, 0x0, 0x0, 0xb7, 0xb7, 0x0, 0x0, 0xb7,
+    0xb7, 0x0, 0x0, 0xb7,
+
+    /* U+0049 "I" */
+    0x43, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7, 0xb7,
+
+    /* U+004A "J" */
+    0x26, 0x66, 0x62, 0xaa, 0xbf, 0x0, 0x3, 0xf0, 0x0, 0x3f, 0x0, 0x3, 0xf0, 0x0, 0x3f, 0x0,
+    0x4, 0xea, 0x30, 0x9b, 0x7e, 0xec, 0x30,
+
+    /* U+004B "K" */
+    0x43, 0x0, 0x1, 0x61, 0xb7, 0x0, 0x1c, 0x80, 0xb7, 0x1, 0xc9, 0x0, 0xb7, 0x1b, 0x90, 0x0,
+    0xb7, 0xbe, 0x10, 0x0, 0xbe, 0xbc, 0xb0, 0x0, 0xbb, 0x11, 0xd8, 0x0, 0xb7, 0x0, 0x2e, 0x60,
+    0xb7, 0x0, 0x4, 0xe3,
+
+    /* U+004C "L" */
+    0x43, 0x0, 0x0, 0xb7, 0x0, 0x0, 0xb7, 0x0, 0x0, 0xb7, 0x0, 0x0, 0xb7, 0x0, 0x0, 0xb7,
+    0x0, 0x0, 0xb7, 0x0, 0x0, 0xb7, 0x11, 0x11, 0xbf, 0xff, 0xff,
+
+    /* U+004D "M" */
+    0x42, 0x0, 0x0, 0x0, 0x51, 0xbc, 0x0, 0x0, 0x5, 0xf3, 0xbf, 0x60, 0x0, 0x1d, 0xf3, 0xba,
+    0xe1, 0x0, 0x7a, 0xe3, 0xb6, 0xa8, 0x2, 0xe2, 0xe3, 0xb6, 0x1e, 0x3a, 0x70, 0xe3, 0xb6, 0x7,
+    0xdd, 0x0, 0xe3, 0xb6, 0x0, 0xc4, 0x0, 0xe3, 0xb6, 0x0, 0x0, 0x0, 0xe3,
+
+    /* U+004E "N" */
+    0x42, 0x0, 0x0, 0x43, 0xbd, 0x10, 0x0, 0xb7, 0xbf, 0xb0, 0x0, 0xb7, 0xb8, 0xd9, 0x0, 0xb7,
+    0xb7, 0x3e, 0x60, 0xb7, 0xb7, 0x5, 0xe3, 0xb7, 0xb7, 0x0, 0x8d, 0xc7, 0xb7, 0x0, 0xa, 0xf7,
+    0xb7, 0x0, 0x1, 0xd7,
+
+    /* U+004F "O" */
+    0x0, 0x3, 0x67, 0x40, 0x0, 0x1, 0xbe, 0xa9, 0xdc, 0x20, 0xb, 0xb1, 0x0, 0xa, 0xc0, 0x3f,
+    0x10, 0x0, 0x1, 0xe4, 0x6c, 0x0, 0x0, 0x0, 0xb7, 0x5d, 0x0, 0x0, 0x0, 0xc6, 0x1f, 0x40,
+    0x0, 0x3, 0xf2, 0x7, 0xe6, 0x10, 0x5e, 0x80, 0x0, 0x5c, 0xef, 0xc6, 0x0,
+
+    /* U+0050 "P" */
+    0x46, 0x66, 0x41, 0xb, 0xca, 0xac, 0xe4, 0xb7, 0x0, 0x8, 0xdb, 0x70, 0x0, 0x3f, 0xb7, 0x0,
+    0x7, 0xdb, 0xc9, 0x9b, 0xe4, 0xbb, 0x77, 0x51, 0xb, 0x70, 0x0, 0x0, 0xb7, 0x0, 0x0, 0x0,
+
+    /* U+0051 "Q" */
+    0x0, 0x3, 0x67, 0x40, 0x0, 0x1, 0xbe, 0xa9, 0xdc, 0x20, 0xb, 0xb1, 0x0, 0xa, 0xc0, 0x3f,
+    0x10, 0x0, 0x1, 0xe4, 0x6c, 0x0, 0x0, 0x0, 0xb7, 0x5d, 0x0, 0x0, 0x0, 0xc6, 0x1f, 0x40,
+    0x0, 0x3, 0xf2, 0x7, 0xe6, 0x10, 0x5e, 0x80, 0x0, 0x5c, 0xff, 0xd6, 0x0, 0x0, 0x0, 0x1a,
+    0xc5, 0x79, 0x0, 0x0, 0x0, 0x5a, 0x82,
+
+    /* U+0052 "R" */
+    0x46, 0x66, 0x41, 0xb, 0xca, 0xac, 0xe4, 0xb7, 0x0, 0x8, 0xdb, 0x70, 0x0, 0x3f, 0xb7, 0x0,
+    0x7, 0xdb, 0xc9, 0x9b, 0xe4, 0xba, 0x77, 0xd7, 0xb, 0x70, 0x3, 0xe2, 0xb7, 0x0, 0x7, 0xc0,
+
+    /* U+0053 "S" */
+    0x0, 0x47, 0x64, 0x0, 0xbd, 0x99, 0xd7, 0x4e, 0x10, 0x0, 0x13, 0xf4, 0x0, 0x0, 0x7, 0xed,
+    0x94, 0x0, 0x1, 0x59, 0xe8, 0x0, 0x0, 0x5, 0xe4, 0x82, 0x1, 0x9c, 0x2a, 0xde, 0xeb, 0x20,
+
+    /* U+0054 "T" */
+    0x66, 0x66, 0x66, 0x69, 0xaa, 0xfa, 0xaa, 0x0, 0x1f, 0x20, 0x0, 0x1, 0xf2, 0x0, 0x0, 0x1f,
+    0x20, 0x0, 0x1, 0xf2, 0x0, 0x0, 0x1f, 0x20, 0x0, 0x1, 0xf2, 0x0, 0x0, 0x1f, 0x20, 0x0,
+
+    /* U+0055 "U" */
+    0x52, 0x0, 0x0, 0x52, 0xc6, 0x0, 0x0, 0xd4, 0xc6, 0x0, 0x0, 0xd4, 0xc6, 0x0, 0x0, 0xd4,
+    0xc6, 0x0, 0x0, 0xd4, 0xc6, 0x0, 0x0, 0xe4, 0xa9, 0x0, 0x1, 0xf2, 0x4e, 0x50, 0x2a, 0xc0,
+    0x6, 0xdf, 0xea, 0x20,
+
+    /* U+0056 "V" */
+    0x62, 0x0, 0x0, 0x4, 0x39, 0xa0, 0x0, 0x1, 0xe2, 0x3f, 0x20, 0x0, 0x7b, 0x0, 0xb8, 0x0,
+    0xe, 0x40, 0x4, 0xe1, 0x6, 0xd0, 0x0, 0xd, 0x60, 0xc6, 0x0, 0x0, 0x6d, 0x4e, 0x10, 0x0,
+    0x1, 0xed, 0x80, 0x0, 0x0, 0x8, 0xf2, 0x0, 0x0,
+
+    /* U+0057 "W" */
+    0x34, 0x0, 0x0, 0x53, 0x0, 0x0, 0x65, 0xe0, 0x0, 0x1f, 0xa0, 0x0, 0x5c, 0xe, 0x40, 0x6,
+    0xce, 0x10, 0xa, 0x70, 0xa9, 0x0, 0xb5, 0xc5, 0x1, 0xe2, 0x5, 0xe0, 0x2e, 0x17, 0xa0, 0x5c,
+    0x0, 0xe, 0x47, 0xa0, 0x2e, 0x1a, 0x70, 0x0, 0xa9, 0xc5, 0x0, 0xc6, 0xe2, 0x0, 0x5, 0xee,
+    0x10, 0x7, 0xec, 0x0, 0x0, 0xe, 0xa0, 0x0, 0x2f, 0x70, 0x0,
+
+    /* U+0058 "X" */
+    0x35, 0x0, 0x0, 0x43, 0x1e, 0x60, 0x4, 0xe2, 0x4, 0xe2, 0x1d, 0x50, 0x0, 0x8c, 0xa9, 0x0,
+    0x0, 0xd, 0xe0, 0x0, 0x0, 0x4e, 0xe5, 0x0, 0x1, 0xe5, 0x4e, 0x20, 0xb, 0x90, 0x8, 0xc0,
+    0x7d, 0x10, 0x0, 0xc8,
+
+    /* U+0059 "Y" */
+    0x62, 0x0, 0x0, 0x34, 0x7c, 0x0, 0x1, 0xd4, 0xd, 0x60, 0x8, 0xa0, 0x4, 0xe1, 0x2e, 0x20,
+    0x0, 0xa9, 0xb7, 0x0, 0x0, 0x2e, 0xc0, 0x0, 0x0, 0xb, 0x70, 0x0, 0x0, 0xb, 0x70, 0x0,
+    0x0, 0xb, 0x70, 0x0,
+
+    /* U+005A "Z" */
+    0x26, 0x66, 0x66, 0x62, 0x4a, 0xaa, 0xac, 0xf4, 0x0, 0x0, 0x1d, 0x80, 0x0, 0x0, 0xaa, 0x0,
+    0x0, 0x8, 0xd1, 0x0, 0x0, 0x5e, 0x20, 0x0, 0x3, 0xe5, 0x0, 0x0, 0x1d, 0x81, 0x11, 0x10,
+    0x7f, 0xff, 0xff, 0xf8,
+
+    /* U+005B "[" */
+    0xae, 0xab, 0x71, 0xb6, 0xb, 0x60, 0xb6, 0xb, 0x60, 0xb6, 0xb, 0x60, 0xb6, 0xb, 0x60, 0xbc,
+    0x83, 0x43,
+
+    /* U+005C "\\" */
+    0x11, 0x0, 0x0, 0x4c, 0x0, 0x0, 0xd, 0x20, 0x0, 0x8, 0x80, 0x0, 0x3, 0xd0, 0x0, 0x0,
+    0xc3, 0x0, 0x0, 0x78, 0x0, 0x0, 0x2e, 0x0, 0x0, 0xc, 0x40, 0x0, 0x6, 0x90, 0x0, 0x1,
+    0xe0, 0x0, 0x0, 0xb5, 0x0, 0x0, 0x11,
+
+    /* U+005D "]" */
+    0xae, 0xa1, 0x7b, 0x6, 0xb0, 0x6b, 0x6, 0xb0, 0x6b, 0x6, 0xb0, 0x6b, 0x6, 0xb0, 0x6b, 0x8c,
+    0xb3, 0x43,
+
+    /* U+005E "^" */
+    0x1, 0xa1, 0x0, 0x7c, 0x70, 0xc, 0x1d, 0x5, 0x90, 0x95, 0xb2, 0x2, 0xb4, 0x0, 0x4,
+
+    /* U+005F "_" */
+    0xaa, 0xaa, 0xaa,
+
+    /* U+0060 "`" */
+    0x2b, 0x40, 0x1, 0x92,
+
+    /* U+0061 "a" */
+    0x1, 0x46, 0x30, 0x1, 0xeb, 0x9e, 0x90, 0x1, 0x0, 0x3f, 0x10, 0x49, 0xaa, 0xf2, 0x3e, 0x53,
+    0x3f, 0x25, 0xd0, 0x5, 0xf2, 0xa, 0xdc, 0x9f, 0x20,
+
+    /* U+0062 "b" */
+    0xc3, 0x0, 0x0, 0xe, 0x40, 0x0, 0x0, 0xe4, 0x46, 0x40, 0xe, 0xcc, 0x9d, 0xb0, 0xea, 0x0,
+    0x1d, 0x6e, 0x40, 0x0, 0x8a, 0xe5, 0x0, 0x9, 0x9e, 0xd2, 0x4, 0xe4, 0xe8, 0xde, 0xd5, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x26, 0x51, 0x0, 0x7e, 0xab, 0xe2, 0x3e, 0x20, 0x4, 0x17, 0xb0, 0x0, 0x0, 0x6c, 0x0,
+    0x0, 0x1, 0xe6, 0x1, 0x93, 0x3, 0xce, 0xe9, 0x10,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x1, 0xe1, 0x0, 0x0, 0x1, 0xf1, 0x0, 0x36, 0x51, 0xf1, 0x8, 0xea, 0xbc, 0xf1,
+    0x3e, 0x20, 0x7, 0xf1, 0x7b, 0x0, 0x1, 0xf1, 0x6c, 0x0, 0x2, 0xf1, 0x1e, 0x60, 0x1b, 0xf1,
+    0x4, 0xce, 0xd7, 0xf1,
+
+    /* U+0065 "e" */
+    0x0, 0x36, 0x40, 0x0, 0x8d, 0x9b, 0xc1, 0x3e, 0x10, 0x9, 0x87, 0xd9, 0x99, 0xbc, 0x6c, 0x33,
+    0x33, 0x31, 0xe7, 0x1, 0x71, 0x3, 0xbe, 0xeb, 0x20,
+
+    /* U+0066 "f" */
+    0x2, 0xce, 0x60, 0xa9, 0x1, 0x4c, 0x95, 0x17, 0xdb, 0x92, 0xb, 0x60, 0x0, 0xb6, 0x0, 0xb,
+    0x60, 0x0, 0xb6, 0x0, 0xb, 0x60, 0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x36, 0x50, 0x51, 0x9, 0xea, 0xbd, 0xe3, 0x4e, 0x20, 0x5, 0xf3, 0x7b, 0x0, 0x0, 0xf3,
+    0x5d, 0x0, 0x2, 0xf3, 0x1c, 0xb5, 0x6d, 0xf3, 0x1, 0x7b, 0x94, 0xf2, 0x4, 0x0, 0x5, 0xe0,
+    0xc, 0xeb, 0xce, 0x50, 0x0, 0x25, 0x41, 0x0,
+
+    /* U+0068 "h" */
+    0xc3, 0x0, 0x0, 0xe, 0x40, 0x0, 0x0, 0xe4, 0x46, 0x30, 0xe, 0xdc, 0xae, 0x80, 0xe9, 0x0,
+    0x4f, 0xe, 0x40, 0x1, 0xf2, 0xe4, 0x0, 0xf, 0x2e, 0x40, 0x0, 0xf2, 0xe4, 0x0, 0xf, 0x20,
+
+    /* U+0069 "i" */
+    0xe5, 0x41, 0x51, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4,
+
+    /* U+006A "j" */
+    0x0, 0xe6, 0x0, 0x41, 0x0, 0x52, 0x0, 0xd5, 0x0, 0xd5, 0x0, 0xd5, 0x0, 0xd5, 0x0, 0xd5,
+    0x0, 0xd5, 0x0, 0xd4, 0xbb, 0xd1, 0x34, 0x10,
+
+    /* U+006B "k" */
+    0xc3, 0x0, 0x0, 0xe, 0x40, 0x0, 0x0, 0xe4, 0x0, 0x35, 0xe, 0x40, 0x4e, 0x40, 0xe4, 0x5e,
+    0x40, 0xe, 0xaf, 0xa0, 0x0, 0xed, 0x5e, 0x60, 0xe, 0x40, 0x4e, 0x30, 0xe4, 0x0, 0x7d, 0x10,
+
+    /* U+006C "l" */
+    0xc3, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4,
+
+    /* U+006D "m" */
+    0x51, 0x46, 0x30, 0x15, 0x51, 0xe, 0xcb, 0xaf, 0x8e, 0xac, 0xe2, 0xe9, 0x0, 0x6f, 0x40, 0xb,
+    0x8e, 0x40, 0x3, 0xf0, 0x0, 0x8a, 0xe4, 0x0, 0x3e, 0x0, 0x8, 0xae, 0x40, 0x3, 0xe0, 0x0,
+    0x8a, 0xe4, 0x0, 0x3e, 0x0, 0x8, 0xa0,
+
+    /* U+006E "n" */
+    0x51, 0x46, 0x30, 0xe, 0xcc, 0xae, 0x80, 0xe9, 0x0, 0x4f, 0xe, 0x40, 0x1, 0xf2, 0xe4, 0x0,
+    0xf, 0x2e, 0x40, 0x0, 0xf2, 0xe4, 0x0, 0xf, 0x20,
+
+    /* U+006F "o" */
+    0x0, 0x26, 0x51, 0x0, 0x8, 0xea, 0xbe, 0x30, 0x3e, 0x20, 0x7, 0xc0, 0x7b, 0x0, 0x1, 0xf1,
+    0x6c, 0x0, 0x2, 0xf1, 0x1e, 0x60, 0x1b, 0xa0, 0x3, 0xce, 0xe9, 0x10,
+
+    /* U+0070 "p" */
+    0x51, 0x46, 0x40, 0xe, 0xcc, 0x9d, 0xb0, 0xea, 0x0, 0x1d, 0x6e, 0x40, 0x0, 0x8a, 0xe5, 0x0,
+    0x9, 0x9e, 0xd2, 0x4, 0xe4, 0xe8, 0xde, 0xd5, 0xe, 0x40, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x3,
+    0x10, 0x0, 0x0,
+
+    /* U+0071 "q" */
+    0x0, 0x36, 0x50, 0x50, 0x8, 0xea, 0xbc, 0xf1, 0x3e, 0x20, 0x7, 0xf1, 0x7b, 0x0, 0x1, 0xf1,
+    0x6c, 0x0, 0x2, 0xf1, 0x1e, 0x60, 0x1b, 0xf1, 0x4, 0xce, 0xd7, 0xf1, 0x0, 0x0, 0x1, 0xf1,
+    0x0, 0x0, 0x1, 0xf1, 0x0, 0x0, 0x0, 0x40,
+
+    /* U+0072 "r" */
+    0x51, 0x43, 0xec, 0xd5, 0xea, 0x0, 0xe4, 0x0, 0xe4, 0x0, 0xe4, 0x0, 0xe4, 0x0,
+
+    /* U+0073 "s" */
+    0x1, 0x56, 0x30, 0x2e, 0xa9, 0xd4, 0x7b, 0x0, 0x0, 0x3e, 0xc9, 0x50, 0x1, 0x47, 0xd7, 0x34,
+    0x0, 0xa9, 0x5d, 0xee, 0xb2,
+
+    /* U+0074 "t" */
+    0x8, 0x50, 0x4, 0xd9, 0x51, 0x7d, 0xb9, 0x20, 0xb6, 0x0, 0xb, 0x60, 0x0, 0xb6, 0x0, 0xa,
+    0x80, 0x10, 0x3d, 0xe7,
+
+    /* U+0075 "u" */
+    0x51, 0x0, 0x15, 0xf3, 0x0, 0x2f, 0xf3, 0x0, 0x2f, 0xf3, 0x0, 0x2f, 0xe3, 0x0, 0x3f, 0xba,
+    0x11, 0xbf, 0x2b, 0xed, 0x8f,
+
+    /* U+0076 "v" */
+    0x51, 0x0, 0x3, 0x3a, 0x80, 0x0, 0xc5, 0x3e, 0x10, 0x3d, 0x0, 0xc6, 0xa, 0x70, 0x5, 0xc2,
+    0xe1, 0x0, 0xd, 0xb9, 0x0, 0x0, 0x7f, 0x20, 0x0,
+
+    /* U+0077 "w" */
+    0x51, 0x0, 0x15, 0x0, 0x2, 0x49, 0x70, 0x6, 0xf3, 0x0, 0xa6, 0x4d, 0x0, 0xcb, 0x90, 0x1e,
+    0x10, 0xd3, 0x2d, 0x2e, 0x6, 0xa0, 0x7, 0x98, 0x80, 0xb5, 0xb4, 0x0, 0x2e, 0xd2, 0x5, 0xcd,
+    0x0, 0x0, 0xbb, 0x0, 0xe, 0x80, 0x0,
+
+    /* U+0078 "x" */
+    0x34, 0x0, 0x5, 0x12, 0xe4, 0x9, 0xa0, 0x4, 0xd7, 0xd1, 0x0, 0x8, 0xf3, 0x0, 0x1, 0xdd,
+    0x80, 0x0, 0xa9, 0x1d, 0x40, 0x7c, 0x0, 0x4e, 0x20,
+
+    /* U+0079 "y" */
+    0x5, 0x10, 0x0, 0x33, 0xa, 0x80, 0x0, 0xc5, 0x3, 0xe1, 0x3, 0xd0, 0x0, 0xb6, 0xa, 0x70,
+    0x0, 0x5d, 0x2e, 0x10, 0x0, 0xd, 0xc8, 0x0, 0x0, 0x6, 0xf2, 0x0, 0x0, 0x7, 0xa0, 0x0,
+    0x1d, 0xbe, 0x20, 0x0, 0x2, 0x41, 0x0, 0x0,
+
+    /* U+007A "z" */
+    0x25, 0x55, 0x54, 0x49, 0x99, 0xe8, 0x0, 0x7, 0xc0, 0x0, 0x5e, 0x20, 0x2, 0xe3, 0x0, 0x1d,
+    0x60, 0x0, 0x7f, 0xee, 0xeb,
+
+    /* U+007B "{" */
+    0x0, 0xad, 0x4, 0xe2, 0x5, 0xc0, 0x5, 0xc0, 0x6, 0xc0, 0x4e, 0x70, 0x18, 0xb0, 0x5, 0xc0,
+    0x5, 0xc0, 0x5, 0xd0, 0x2, 0xeb, 0x0, 0x14,
+
+    /* U+007C "|" */
+    0xa4, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0x31,
+
+    /* U+007D "}" */
+    0xab, 0x20, 0x1b, 0x80, 0x9, 0x90, 0x9, 0x90, 0x8, 0x90, 0x4, 0xe6, 0x8, 0xb2, 0x9, 0x90,
+    0x9, 0x90, 0x9, 0x80, 0x8e, 0x40, 0x32, 0x0,
+
+    /* U+007E "~" */
+    0x1, 0x20, 0x1, 0x11, 0xdb, 0xb2, 0xa3, 0x36, 0x5, 0xb8, 0x0,
+
+    /* U+00A0 "" */
+
+    /* U+00A1 "¡" */
+    0x5, 0x11, 0xf4, 0x1, 0x0, 0x91, 0xd, 0x20, 0xe2, 0xf, 0x30, 0xf4, 0x1c, 0x30,
+
+    /* U+00A2 "¢" */
+    0x0, 0x7, 0x20, 0x0, 0x2, 0xb6, 0x10, 0x8, 0xed, 0xce, 0x23, 0xe2, 0x92, 0x41, 0x7b, 0x9,
+    0x20, 0x6, 0xc0, 0x92, 0x0, 0x1e, 0x6a, 0x49, 0x30, 0x3c, 0xfe, 0x91, 0x0, 0x9, 0x20, 0x0,
+    0x0, 0x31, 0x0,
+
+    /* U+00A3 "£" */
+    0x0, 0x3, 0x67, 0x50, 0x0, 0x7e, 0xa9, 0xc6, 0x2, 0xf3, 0x0, 0x0, 0x5, 0xd0, 0x0, 0x0,
+    0x6b, 0xe9, 0x99, 0x0, 0x27, 0xd3, 0x33, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x5, 0xd1, 0x11, 0x10,
+    0xaf, 0xff, 0xff, 0xf6,
+
+    /* U+00A4 "¤" */
+    0x33, 0x0, 0x0, 0x15, 0x4e, 0x8d, 0xeb, 0xb9, 0x9, 0xa1, 0x6, 0xe1, 0xe, 0x10, 0x0, 0x95,
+    0xe, 0x0, 0x0, 0x86, 0xa, 0x60, 0x2, 0xd2, 0x1c, 0xeb, 0xad, 0xe4, 0x58, 0x3, 0x41, 0x3a,
+
+    /* U+00A5 "¥" */
+    0x52, 0x0, 0x0, 0x5, 0x26, 0xc1, 0x0, 0x5, 0xd1, 0xa, 0x90, 0x2, 0xe3, 0x0, 0x1d, 0x40,
+    0xb7, 0x0, 0x0, 0x4e, 0x9b, 0x0, 0x0, 0x9a, 0xef, 0xba, 0x40, 0x1, 0x16, 0xd1, 0x10, 0x0,
+    0x89, 0xbe, 0x99, 0x30, 0x0, 0x5, 0xd0, 0x0, 0x0,
+
+    /* U+00A6 "¦" */
+    0xa4, 0xb5, 0xb5, 0xb5, 0x31, 0x0, 0x0, 0xa4, 0xb5, 0xb5, 0xb5, 0x31,
+
+    /* U+00A7 "§" */
+    0x1, 0x57, 0x51, 0x1d, 0x97, 0xa7, 0x4c, 0x0, 0x0, 0x1d, 0xb6, 0x20, 0x5c, 0x58, 0xd4, 0x88,
+    0x0, 0x78, 0x2c, 0xb8, 0xd3, 0x0, 0x38, 0xe2, 0x21, 0x0, 0xc4, 0x6e, 0xcd, 0xb0, 0x0, 0x22,
+    0x0,
+
+    /* U+00A8 "¨" */
+    0x90, 0x82, 0x60, 0x51,
+
+    /* U+00A9 "©" */
+    0x0, 0x3, 0x65, 0x10, 0x0, 0x19, 0x62, 0x37, 0x70, 0x9, 0x14, 0x99, 0x25, 0x63, 0x63, 0xc4,
+    0x57, 0x9, 0x63, 0x86, 0x0, 0x0, 0x85, 0x37, 0x70, 0x1, 0x9, 0x18, 0x1c, 0xab, 0x91, 0x90,
+    0x65, 0x3, 0x31, 0x92, 0x0, 0x58, 0x88, 0x82, 0x0,
+
+    /* U+00AA "ª" */
+    0x3a, 0xa8, 0x0, 0x45, 0xd1, 0x77, 0x3d, 0x13, 0xa8, 0xb1,
+
+    /* U+00AB "«" */
+    0x0, 0x61, 0x43, 0x7, 0x93, 0xc1, 0x3d, 0x1d, 0x30, 0x1d, 0x39, 0x70, 0x3, 0xc1, 0xc3, 0x0,
+    0x10, 0x11,
+
+    /* U+00AC "¬" */
+    0x2a, 0xaa, 0xaa, 0x21, 0x44, 0x44, 0xd3, 0x0, 0x0, 0xd, 0x30, 0x0, 0x0, 0x51,
+
+    /* U+00AD "" */
+    0x4c, 0xcb, 0x13, 0x33,
+
+    /* U+00AE "®" */
+    0x0, 0x3, 0x65, 0x10, 0x0, 0x19, 0x62, 0x37, 0x70, 0x9, 0x18, 0x98, 0x25, 0x63, 0x60, 0xc1,
+    0x3c, 0x9, 0x63, 0xc, 0x2, 0xc0, 0x85, 0x30, 0xda, 0xd4, 0x9, 0x18, 0xc, 0x4, 0x91, 0x90,
+    0x65, 0x20, 0x3, 0x92, 0x0, 0x58, 0x88, 0x82, 0x0,
+
+    /* U+00AF "¯" */
+    0x26, 0x66, 0x42, 0x44, 0x42,
+
+    /* U+00B0 "°" */
+    0x3, 0x73, 0x3, 0xa3, 0xa3, 0x64, 0x4, 0x72, 0xa4, 0xa3, 0x2, 0x62, 0x0,
+
+    /* U+00B1 "±" */
+    0x0, 0x5, 0x0, 0x0, 0x0, 0xf0, 0x0, 0x14, 0x4f, 0x44, 0x12, 0xaa, 0xfa, 0xa2, 0x0, 0xf,
+    0x0, 0x0, 0x0, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xee, 0xee, 0xe3,
+
+    /* U+00B2 "²" */
+    0x4b, 0xba, 0x11, 0x10, 0x94, 0x0, 0x3b, 0x10, 0x5b, 0x10, 0x4f, 0xa9, 0x51, 0x11, 0x11,
+
+    /* U+00B3 "³" */
+    0x5a, 0xad, 0x40, 0x6, 0x80, 0x1, 0xca, 0x20, 0x0, 0x58, 0x6b, 0x9c, 0x30, 0x2, 0x0,
+
+    /* U+00B4 "´" */
+    0x2, 0xb4, 0x19, 0x30,
+
+    /* U+00B5 "µ" */
+    0x51, 0x0, 0x5, 0xe, 0x40, 0x1, 0xf1, 0xe4, 0x0, 0x1f, 0x1e, 0x40, 0x1, 0xf1, 0xe4, 0x0,
+    0x2f, 0x1e, 0xb1, 0x1a, 0xf1, 0xea, 0xee, 0x8f, 0x1e, 0x40, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x3,
+    0x10, 0x0, 0x0,
+
+    /* U+00B6 "¶" */
+    0x19, 0xde, 0xee, 0x79, 0xff, 0xa0, 0x78, 0xbf, 0xfa, 0x7, 0x85, 0xff, 0xa0, 0x78, 0x2, 0x8a,
+    0x7, 0x80, 0x4, 0xa0, 0x78, 0x0, 0x4a, 0x7, 0x80, 0x4, 0xa0, 0x78, 0x0, 0x4a, 0x7, 0x80,
+    0x4, 0xa0, 0x78, 0x0, 0x11, 0x1, 0x10,
+
+    /* U+00B7 "·" */
+    0x1, 0x2, 0xf5, 0x7, 0x10,
+
+    /* U+00B8 "¸" */
+    0x1, 0x0, 0xc3, 0x24, 0xb5, 0x93,
+
+    /* U+00B9 "¹" */
+    0xac, 0x30, 0xa, 0x30, 0xa, 0x30, 0xa, 0x30, 0x9d, 0xb4, 0x11, 0x11,
+
+    /* U+00BA "º" */
+    0x1a, 0xaa, 0x18, 0x50, 0x58, 0x85, 0x5, 0x81, 0xab, 0xa1,
+
+    /* U+00BB "»" */
+    0x35, 0x17, 0x0, 0x1c, 0x38, 0x80, 0x3, 0xd1, 0xc4, 0x6, 0xa2, 0xd1, 0x3c, 0x1c, 0x40, 0x11,
+    0x1, 0x0,
+
+    /* U+00BC "¼" */
+    0x66, 0x10, 0x0, 0x3, 0x20, 0x0, 0x4b, 0x30, 0x0, 0x1c, 0x10, 0x0, 0xa, 0x30, 0x0, 0xa4,
+    0x0, 0x0, 0xa, 0x30, 0x5, 0x80, 0x0, 0x0, 0x2a, 0x51, 0x2c, 0x0, 0x67, 0x0, 0x99, 0x94,
+    0xb3, 0x3, 0xb0, 0x0, 0x0, 0x6, 0x70, 0x1c, 0x19, 0x10, 0x0, 0x2b, 0x0, 0x6b, 0xae, 0xb1,
+    0x0, 0xb2, 0x0, 0x0, 0xb, 0x20,
+
+    /* U+00BD "½" */
+    0x66, 0x10, 0x0, 0x3, 0x20, 0x4, 0xb3, 0x0, 0x1, 0xc1, 0x0, 0xa, 0x30, 0x0, 0xa4, 0x0,
+    0x0, 0xa3, 0x0, 0x58, 0x0, 0x0, 0x2a, 0x51, 0x2c, 0x3b, 0xbc, 0x39, 0x99, 0x4b, 0x30, 0x10,
+    0x58, 0x0, 0x6, 0x70, 0x0, 0x2b, 0x20, 0x2, 0xb0, 0x0, 0x3b, 0x20, 0x0, 0xb2, 0x0, 0x2e,
+    0xca, 0x80,
+
+    /* U+00BE "¾" */
+    0x36, 0x66, 0x20, 0x0, 0x32, 0x0, 0x2, 0x46, 0xd2, 0x0, 0x1c, 0x10, 0x0, 0x0, 0xc5, 0x0,
+    0xa, 0x40, 0x0, 0x0, 0x5, 0xa6, 0x5, 0x80, 0x0, 0x0, 0x44, 0x28, 0x72, 0xc0, 0x6, 0x70,
+    0x2, 0x89, 0x60, 0xb3, 0x3, 0xb0, 0x0, 0x0, 0x0, 0x67, 0x1, 0xc1, 0x91, 0x0, 0x0, 0x2b,
+    0x0, 0x6b, 0xae, 0xb1, 0x0, 0xb, 0x20, 0x0, 0x0, 0xb2, 0x0,
+
+    /* U+00BF "¿" */
+    0x0, 0x5, 0x0, 0x0, 0x2, 0xf3, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0xb1, 0x0, 0x0, 0xaa,
+    0x0, 0x0, 0xab, 0x0, 0x0, 0x1f, 0x10, 0x0, 0x1, 0xe8, 0x34, 0xb7, 0x3, 0xad, 0xc7, 0x10,
+
+    /* U+00C0 "À" */
+    0x0, 0x49, 0x10, 0x0, 0x0, 0x0, 0x5a, 0x10, 0x0, 0x0, 0x2, 0x60, 0x0, 0x0, 0x0, 0x9f,
+    0x60, 0x0, 0x0, 0x1e, 0x6d, 0x0, 0x0, 0x8, 0xa0, 0xd4, 0x0, 0x1, 0xe3, 0x7, 0xb0, 0x0,
+    0x6c, 0x11, 0x2e, 0x30, 0xd, 0xee, 0xee, 0xea, 0x5, 0xd0, 0x0, 0x2, 0xf2, 0xc7, 0x0, 0x0,
+    0xa, 0x90,
+
+    /* U+00C1 "Á" */
+    0x0, 0x0, 0x29, 0x20, 0x0, 0x0, 0x2b, 0x30, 0x0, 0x0, 0x2, 0x60, 0x0, 0x0, 0x0, 0x9f,
+    0x60, 0x0, 0x0, 0x1e, 0x6d, 0x0, 0x0, 0x8, 0xa0, 0xd4, 0x0, 0x1, 0xe3, 0x7, 0xb0, 0x0,
+    0x6c, 0x11, 0x2e, 0x30, 0xd, 0xee, 0xee, 0xea, 0x5, 0xd0, 0x0, 0x2, 0xf2, 0xc7, 0x0, 0x0,
+    0xa, 0x90,
+
+    /* U+00C2 "Â" */
+    0x0, 0x5, 0xa3, 0x0, 0x0, 0x4, 0xa3, 0xb2, 0x0, 0x0, 0x2, 0x60, 0x0, 0x0, 0x0, 0x9f,
+    0x60, 0x0, 0x0, 0x1e, 0x6d, 0x0, 0x0, 0x8, 0xa0, 0xd4, 0x0, 0x1, 0xe3, 0x7, 0xb0, 0x0,
+    0x6c, 0x11, 0x2e, 0x30, 0xd, 0xee, 0xee, 0xea, 0x5, 0xd0, 0x0, 0x2, 0xf2, 0xc7, 0x0, 0x0,
+    0xa, 0x90,
+
+    /* U+00C3 "Ã" */
+    0x0, 0x29, 0x33, 0x30, 0x0, 0x7, 0x48, 0xb1, 0x0, 0x0, 0x2, 0x60, 0x0, 0x0, 0x0, 0x9f,
+    0x60, 0x0, 0x0, 0x1e, 0x6d, 0x0, 0x0, 0x8, 0xa0, 0xd4, 0x0, 0x1, 0xe3, 0x7, 0xb0, 0x0,
+    0x6c, 0x11, 0x2e, 0x30, 0xd, 0xee, 0xee, 0xea, 0x5, 0xd0, 0x0, 0x2, 0xf2, 0xc7, 0x0, 0x0,
+    0xa, 0x90,
+
+    /* U+00C4 "Ä" */
+    0x0, 0x15, 0x6, 0x0, 0x0, 0x2, 0x80, 0x90, 0x0, 0x0, 0x2, 0x60, 0x0, 0x0, 0x0, 0x9f,
+    0x60, 0x0, 0x0, 0x1e, 0x6d, 0x0, 0x0, 0x8, 0xa0, 0xd4, 0x0, 0x1, 0xe3, 0x7, 0xb0, 0x0,
+    0x6c, 0x11, 0x2e, 0x30, 0xd, 0xee, 0xee, 0xea, 0x5, 0xd0, 0x0, 0x2, 0xf2, 0xc7, 0x0, 0x0,
+    0xa, 0x90,
+
+    /* U+00C5 "Å" */
+    0x0, 0x5, 0x83, 0x0, 0x0, 0x0, 0x90, 0x90, 0x0, 0x0, 0x6, 0x84, 0x0, 0x0, 0x0, 0x26,
+    0x0, 0x0, 0x0, 0x9, 0xf6, 0x0, 0x0, 0x1, 0xe6, 0xd0, 0x0, 0x0, 0x8a, 0xd, 0x40, 0x0,
+    0x1e, 0x30, 0x7b, 0x0, 0x6, 0xc1, 0x12, 0xe3, 0x0, 0xde, 0xee, 0xee, 0xa0, 0x5d, 0x0, 0x0,
+    0x2f, 0x2c, 0x70, 0x0, 0x0, 0xa9,
+
+    /* U+00C6 "Æ" */
+    0x0, 0x0, 0x16, 0x66, 0x66, 0x64, 0x0, 0x0, 0x8d, 0xfa, 0xaa, 0xa7, 0x0, 0x2, 0xe5, 0xf0,
+    0x0, 0x0, 0x0, 0xb, 0x73, 0xf0, 0x0, 0x0, 0x0, 0x5d, 0x3, 0xfc, 0xcc, 0xc2, 0x1, 0xd5,
+    0x14, 0xf4, 0x44, 0x41, 0x8, 0xee, 0xee, 0xf0, 0x0, 0x0, 0x2e, 0x20, 0x3, 0xf1, 0x11, 0x11,
+    0xb8, 0x0, 0x3, 0xff, 0xff, 0xfd,
+
+    /* U+00C7 "Ç" */
+    0x0, 0x3, 0x77, 0x40, 0x0, 0x1b, 0xea, 0x9d, 0xb1, 0xb, 0xb1, 0x0, 0x5, 0x3, 0xf1, 0x0,
+    0x0, 0x0, 0x6c, 0x0, 0x0, 0x0, 0x5, 0xd0, 0x0, 0x0, 0x0, 0x1f, 0x40, 0x0, 0x0, 0x0,
+    0x7e, 0x61, 0x5, 0xb1, 0x0, 0x5c, 0xff, 0xc5, 0x0, 0x0, 0xa, 0x40, 0x0, 0x0, 0x1, 0x2d,
+    0x0, 0x0, 0x0, 0x39, 0x50, 0x0,
+
+    /* U+00C8 "È" */
+    0x5, 0x80, 0x0, 0x0, 0x7, 0x90, 0x0, 0x46, 0x66, 0x66, 0x1b, 0xca, 0xaa, 0xa2, 0xb7, 0x0,
+    0x0, 0xb, 0x70, 0x0, 0x0, 0xbd, 0xcc, 0xc8, 0xb, 0x94, 0x44, 0x20, 0xb7, 0x0, 0x0, 0xb,
+    0x71, 0x11, 0x10, 0xbf, 0xff, 0xff, 0x50,
+
+    /* U+00C9 "É" */
+    0x0, 0x4, 0x91, 0x0, 0x3, 0xb2, 0x0, 0x46, 0x66, 0x66, 0x1b, 0xca, 0xaa, 0xa2, 0xb7, 0x0,
+    0x0, 0xb, 0x70, 0x0, 0x0, 0xbd, 0xcc, 0xc8, 0xb, 0x94, 0x44, 0x20, 0xb7, 0x0, 0x0, 0xb,
+    0x71, 0x11, 0x10, 0xbf, 0xff, 0xff, 0x50,
+
+    /* U+00CA "Ê" */
+    0x0, 0x69, 0x10, 0x0, 0x69, 0x4b, 0x10, 0x46, 0x66, 0x66, 0x1b, 0xca, 0xaa, 0xa2, 0xb7, 0x0,
+    0x0, 0xb, 0x70, 0x0, 0x0, 0xbd, 0xcc, 0xc8, 0xb, 0x94, 0x44, 0x20, 0xb7, 0x0, 0x0, 0xb,
+    0x71, 0x11, 0x10, 0xbf, 0xff, 0xff, 0x50,
+
+    /* U+00CB "Ë" */
+    0x2, 0x41, 0x60, 0x0, 0x46, 0x18, 0x0, 0x46, 0x66, 0x66, 0x1b, 0xca, 0xaa, 0xa2, 0xb7, 0x0,
+    0x0, 0xb, 0x70, 0x0, 0x0, 0xbd, 0xcc, 0xc8, 0xb, 0x94, 0x44, 0x20, 0xb7, 0x0, 0x0, 0xb,
+    0x71, 0x11, 0x10, 0xbf, 0xff, 0xff, 0x50,
+
+    /* U+00CC "Ì" */
+    0x18, 0x40, 0x1, 0xb4, 0x0, 0x43, 0x0, 0xb7, 0x0, 0xb7, 0x0, 0xb7, 0x0, 0xb7, 0x0, 0xb7,
+    0x0, 0xb7, 0x0, 0xb7, 0x0, 0xb7,
+
+    /* U+00CD "Í" */
+    0x7, 0x68, 0x80, 0x43, 0xb, 0x70, 0xb7, 0xb, 0x70, 0xb7, 0xb, 0x70, 0xb7, 0xb, 0x70, 0xb7,
+    0x0,
+
+    /* U+00CE "Î" */
+    0x1, 0x97, 0x1, 0xa5, 0x87, 0x0, 0x43, 0x0, 0xb, 0x70, 0x0, 0xb7, 0x0, 0xb, 0x70, 0x0,
+    0xb7, 0x0, 0xb, 0x70, 0x0, 0xb7, 0x0, 0xb, 0x70, 0x0, 0xb7, 0x0,
+
+    /* U+00CF "Ï" */
+    0x51, 0x33, 0x72, 0x55, 0x4, 0x30, 0xb, 0x70, 0xb, 0x70, 0xb, 0x70, 0xb, 0x70, 0xb, 0x70,
+    0xb, 0x70, 0xb, 0x70, 0xb, 0x70,
+
+    /* U+00D0 "Ð" */
+    0x4, 0x66, 0x65, 0x20, 0x0, 0xa, 0xda, 0xab, 0xea, 0x10, 0xa, 0x80, 0x0, 0x1b, 0xb0, 0xa,
+    0x80, 0x0, 0x1, 0xf3, 0xaf, 0xfb, 0xb0, 0x0, 0xc6, 0x3d, 0xb3, 0x30, 0x0, 0xd5, 0xa, 0x80,
+    0x0, 0x4, 0xf1, 0xa, 0x91, 0x12, 0x6e, 0x70, 0xa, 0xff, 0xfe, 0xb4, 0x0,
+
+    /* U+00D1 "Ñ" */
+    0x0, 0x67, 0x6, 0x0, 0x1, 0x84, 0xb6, 0x0, 0x42, 0x0, 0x0, 0x43, 0xbd, 0x10, 0x0, 0xb7,
+    0xbf, 0xb0, 0x0, 0xb7, 0xb8, 0xd9, 0x0, 0xb7, 0xb7, 0x3e, 0x60, 0xb7, 0xb7, 0x5, 0xe3, 0xb7,
+    0xb7, 0x0, 0x8d, 0xc7, 0xb7, 0x0, 0xa, 0xf7, 0xb7, 0x0, 0x1, 0xd7,
+
+    /* U+00D2 "Ò" */
+    0x0, 0x7, 0x60, 0x0, 0x0, 0x0, 0x1, 0x96, 0x0, 0x0, 0x0, 0x3, 0x67, 0x40, 0x0, 0x1,
+    0xbe, 0xa9, 0xdc, 0x20, 0xb, 0xb1, 0x0, 0xa, 0xc0, 0x3f, 0x10, 0x0, 0x1, 0xe4, 0x6c, 0x0,
+    0x0, 0x0, 0xb7, 0x5d, 0x0, 0x0, 0x0, 0xc6, 0x1f, 0x40, 0x0, 0x3, 0xf2, 0x7, 0xe6, 0x10,
+    0x5e, 0x80, 0x0, 0x5c, 0xef, 0xc6, 0x0,
+
+    /* U+00D3 "Ó" */
+    0x0, 0x0, 0x5, 0x80, 0x0, 0x0, 0x0, 0x5a, 0x10, 0x0, 0x0, 0x3, 0x67, 0x40, 0x0, 0x1,
+    0xbe, 0xa9, 0xdc, 0x20, 0xb, 0xb1, 0x0, 0xa, 0xc0, 0x3f, 0x10, 0x0, 0x1, 0xe4, 0x6c, 0x0,
+    0x0, 0x0, 0xb7, 0x5d, 0x0, 0x0, 0x0, 0xc6, 0x1f, 0x40, 0x0, 0x3, 0xf2, 0x7, 0xe6, 0x10,
+    0x5e, 0x80, 0x0, 0x5c, 0xef, 0xc6, 0x0,
+
+    /* U+00D4 "Ô" */
+    0x0, 0x0, 0x89, 0x10, 0x0, 0x0, 0x9, 0x76, 0xa0, 0x0, 0x0, 0x3, 0x67, 0x40, 0x0, 0x1,
+    0xbe, 0xa9, 0xdc, 0x20, 0xb, 0xb1, 0x0, 0xa, 0xc0, 0x3f, 0x10, 0x0, 0x1, 0xe4, 0x6c, 0x0,
+    0x0, 0x0, 0xb7, 0x5d, 0x0, 0x0, 0x0, 0xc6, 0x1f, 0x40, 0x0, 0x3, 0xf2, 0x7, 0xe6, 0x10,
+    0x5e, 0x80, 0x0, 0x5c, 0xef, 0xc6, 0x0,
+
+    /* U+00D5 "Õ" */
+    0x0, 0x5, 0x81, 0x60, 0x0, 0x0, 0x9, 0x3a, 0x90, 0x0, 0x0, 0x3, 0x67, 0x40, 0x0, 0x1,
+    0xbe, 0xa9, 0xdc, 0x20, 0xb, 0xb1, 0x0, 0xa, 0xc0, 0x3f, 0x10, 0x0, 0x1, 0xe4, 0x6c, 0x0,
+    0x0, 0x0, 0xb7, 0x5d, 0x0, 0x0, 0x0, 0xc6, 0x1f, 0x40, 0x0, 0x3, 0xf2, 0x7, 0xe6, 0x10,
+    0x5e, 0x80, 0x0, 0x5c, 0xef, 0xc6, 0x0,
+
+    /* U+00D6 "Ö" */
+    0x0, 0x4, 0x32, 0x40, 0x0, 0x0, 0x6, 0x43, 0x70, 0x0, 0x0, 0x3, 0x67, 0x40, 0x0, 0x1,
+    0xbe, 0xa9, 0xdc, 0x20, 0xb, 0xb1, 0x0, 0xa, 0xc0, 0x3f, 0x10, 0x0, 0x1, 0xe4, 0x6c, 0x0,
+    0x0, 0x0, 0xb7, 0x5d, 0x0, 0x0, 0x0, 0xc6, 0x1f, 0x40, 0x0, 0x3, 0xf2, 0x7, 0xe6, 0x10,
+    0x5e, 0x80, 0x0, 0x5c, 0xef, 0xc6, 0x0,
+
+    /* U+00D7 "×" */
+    0x21, 0x1, 0x26, 0xc2, 0xc6, 0x8, 0xf8, 0x1, 0xcb, 0xc1, 0x77, 0x7, 0x70,
+
+    /* U+00D8 "Ø" */
+    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x3, 0x67, 0x45, 0x90, 0x1, 0xbe, 0xa9, 0xff, 0x20, 0xb,
+    0xb1, 0x0, 0xcd, 0xc0, 0x3f, 0x10, 0x8, 0x61, 0xe4, 0x6c, 0x0, 0x4a, 0x0, 0xb7, 0x5d, 0x1,
+    0xc1, 0x0, 0xc6, 0x1f, 0x4a, 0x40, 0x3, 0xf2, 0x7, 0xfe, 0x10, 0x5e, 0x80, 0x2, 0xfc, 0xef,
+    0xc6, 0x0, 0x9, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+00D9 "Ù" */
+    0x1, 0x93, 0x0, 0x0, 0x0, 0x2b, 0x30, 0x0, 0x52, 0x0, 0x0, 0x52, 0xc6, 0x0, 0x0, 0xd4,
+    0xc6, 0x0, 0x0, 0xd4, 0xc6, 0x0, 0x0, 0xd4, 0xc6, 0x0, 0x0, 0xd4, 0xc6, 0x0, 0x0, 0xe4,
+    0xa9, 0x0, 0x1, 0xf2, 0x4e, 0x50, 0x2a, 0xc0, 0x6, 0xdf, 0xea, 0x20,
+
+    /* U+00DA "Ú" */
+    0x0, 0x0, 0x85, 0x0, 0x0, 0x9, 0x70, 0x0, 0x52, 0x0, 0x0, 0x52, 0xc6, 0x0, 0x0, 0xd4,
+    0xc6, 0x0, 0x0, 0xd4, 0xc6, 0x0, 0x0, 0xd4, 0xc6, 0x0, 0x0, 0xd4, 0xc6, 0x0, 0x0, 0xe4,
+    0xa9, 0x0, 0x1, 0xf2, 0x4e, 0x50, 0x2a, 0xc0, 0x6, 0xdf, 0xea, 0x20,
+
+    /* U+00DB "Û" */
+    0x0, 0x29, 0x60, 0x0, 0x1, 0xb4, 0x96, 0x0, 0x52, 0x0, 0x0, 0x52, 0xc6, 0x0, 0x0, 0xd4,
+    0xc6, 0x0, 0x0, 0xd4, 0xc6, 0x0, 0x0, 0xd4, 0xc6, 0x0, 0x0, 0xd4, 0xc6, 0x0, 0x0, 0xe4,
+    0xa9, 0x0, 0x1, 0xf2, 0x4e, 0x50, 0x2a, 0xc0, 0x6, 0xdf, 0xea, 0x20,
+
+    /* U+00DC "Ü" */
+    0x0, 0x61, 0x42, 0x0, 0x0, 0x81, 0x64, 0x0, 0x52, 0x0, 0x0, 0x52, 0xc6, 0x0, 0x0, 0xd4,
+    0xc6, 0x0, 0x0, 0xd4, 0xc6, 0x0, 0x0, 0xd4, 0xc6, 0x0, 0x0, 0xd4, 0xc6, 0x0, 0x0, 0xe4,
+    0xa9, 0x0, 0x1, 0xf2, 0x4e, 0x50, 0x2a, 0xc0, 0x6, 0xdf, 0xea, 0x20,
+
+    /* U+00DD "Ý" */
+    0x0, 0x0, 0x76, 0x0, 0x0, 0x7, 0x90, 0x0, 0x62, 0x0, 0x0, 0x34, 0x7c, 0x0, 0x1, 0xd4,
+    0xd, 0x60, 0x8, 0xa0, 0x4, 0xe1, 0x2e, 0x20, 0x0, 0xa9, 0xb7, 0x0, 0x0, 0x2e, 0xc0, 0x0,
+    0x0, 0xb, 0x70, 0x0, 0x0, 0xb, 0x70, 0x0, 0x0, 0xb, 0x70, 0x0,
+
+    /* U+00DE "Þ" */
+    0x43, 0x0, 0x0, 0xb, 0xa6, 0x54, 0x0, 0xbc, 0xaa, 0xdd, 0x3b, 0x70, 0x0, 0x8c, 0xb7, 0x0,
+    0x3, 0xfb, 0x70, 0x0, 0x7d, 0xbb, 0x88, 0xbe, 0x5b, 0xb8, 0x76, 0x20, 0xb7, 0x0, 0x0, 0x0,
+
+    /* U+00DF "ß" */
+    0x8, 0xee, 0xa1, 0x8, 0xc2, 0x1a, 0xa0, 0xd5, 0x0, 0x4d, 0xe, 0x40, 0x1a, 0x90, 0xe4, 0x2f,
+    0xf5, 0xe, 0x40, 0x14, 0xe4, 0xe4, 0x0, 0x9, 0x8e, 0x40, 0x2, 0xd6, 0xe4, 0x8e, 0xe8, 0x0,
+
+    /* U+00E0 "à" */
+    0x3, 0xb3, 0x0, 0x0, 0x2, 0x91, 0x0, 0x1, 0x46, 0x30, 0x1, 0xeb, 0x9e, 0x90, 0x1, 0x0,
+    0x3f, 0x10, 0x49, 0xaa, 0xf2, 0x3e, 0x53, 0x3f, 0x25, 0xd0, 0x5, 0xf2, 0xa, 0xdc, 0x9f, 0x20,
+
+    /* U+00E1 "á" */
+    0x0, 0x3, 0xb3, 0x0, 0x1, 0x92, 0x0, 0x1, 0x46, 0x30, 0x1, 0xeb, 0x9e, 0x90, 0x1, 0x0,
+    0x3f, 0x10, 0x49, 0xaa, 0xf2, 0x3e, 0x53, 0x3f, 0x25, 0xd0, 0x5, 0xf2, 0xa, 0xdc, 0x9f, 0x20,
+
+    /* U+00E2 "â" */
+    0x0, 0x6c, 0x60, 0x0, 0x38, 0x18, 0x30, 0x1, 0x46, 0x30, 0x1, 0xeb, 0x9e, 0x90, 0x1, 0x0,
+    0x3f, 0x10, 0x49, 0xaa, 0xf2, 0x3e, 0x53, 0x3f, 0x25, 0xd0, 0x5, 0xf2, 0xa, 0xdc, 0x9f, 0x20,
+
+    /* U+00E3 "ã" */
+    0x2, 0xb7, 0x45, 0x0, 0x42, 0x59, 0x10, 0x1, 0x46, 0x30, 0x1, 0xeb, 0x9e, 0x90, 0x1, 0x0,
+    0x3f, 0x10, 0x49, 0xaa, 0xf2, 0x3e, 0x53, 0x3f, 0x25, 0xd0, 0x5, 0xf2, 0xa, 0xdc, 0x9f, 0x20,
+
+    /* U+00E4 "ä" */
+    0x1, 0x90, 0x91, 0x0, 0x16, 0x6, 0x10, 0x1, 0x46, 0x30, 0x1, 0xeb, 0x9e, 0x90, 0x1, 0x0,
+    0x3f, 0x10, 0x49, 0xaa, 0xf2, 0x3e, 0x53, 0x3f, 0x25, 0xd0, 0x5, 0xf2, 0xa, 0xdc, 0x9f, 0x20,
+
+    /* U+00E5 "å" */
+    0x0, 0x48, 0x40, 0x0, 0x9, 0x9, 0x0, 0x0, 0x58, 0x50, 0x0, 0x14, 0x63, 0x0, 0x1e, 0xb9,
+    0xe9, 0x0, 0x10, 0x3, 0xf1, 0x4, 0x9a, 0xaf, 0x23, 0xe5, 0x33, 0xf2, 0x5d, 0x0, 0x5f, 0x20,
+    0xad, 0xc9, 0xf2,
+
+    /* U+00E6 "æ" */
+    0x1, 0x46, 0x30, 0x15, 0x62, 0x0, 0x1e, 0xb9, 0xda, 0xdb, 0x9e, 0x60, 0x1, 0x0, 0x3f, 0x80,
+    0x2, 0xe2, 0x4, 0x9a, 0xaf, 0xba, 0xaa, 0xe5, 0x3e, 0x53, 0x3f, 0x63, 0x33, 0x31, 0x5d, 0x0,
+    0x6e, 0xc2, 0x3, 0x60, 0x9, 0xdd, 0xb2, 0x8e, 0xed, 0x60,
+
+    /* U+00E7 "ç" */
+    0x0, 0x26, 0x51, 0x0, 0x7e, 0xab, 0xe2, 0x3e, 0x20, 0x4, 0x17, 0xb0, 0x0, 0x0, 0x6c, 0x0,
+    0x0, 0x1, 0xe6, 0x1, 0x93, 0x3, 0xcf, 0xe9, 0x10, 0x0, 0xc3, 0x0, 0x0, 0x24, 0xb0, 0x0,
+    0x5, 0x93, 0x0,
+
+    /* U+00E8 "è" */
+    0x2, 0xb5, 0x0, 0x0, 0x1, 0x92, 0x0, 0x0, 0x36, 0x40, 0x0, 0x8d, 0x9b, 0xc1, 0x3e, 0x10,
+    0x9, 0x87, 0xd9, 0x99, 0xbc, 0x6c, 0x33, 0x33, 0x31, 0xe7, 0x1, 0x71, 0x3, 0xbe, 0xeb, 0x20,
+
+    /* U+00E9 "é" */
+    0x0, 0x2, 0xb4, 0x0, 0x0, 0x94, 0x0, 0x0, 0x36, 0x40, 0x0, 0x8d, 0x9b, 0xc1, 0x3e, 0x10,
+    0x9, 0x87, 0xd9, 0x99, 0xbc, 0x6c, 0x33, 0x33, 0x31, 0xe7, 0x1, 0x71, 0x3, 0xbe, 0xeb, 0x20,
+
+    /* U+00EA "ê" */
+    0x0, 0x4c, 0x80, 0x0, 0x29, 0x17, 0x50, 0x0, 0x36, 0x40, 0x0, 0x8d, 0x9b, 0xc1, 0x3e, 0x10,
+    0x9, 0x87, 0xd9, 0x99, 0xbc, 0x6c, 0x33, 0x33, 0x31, 0xe7, 0x1, 0x71, 0x3, 0xbe, 0xeb, 0x20,
+
+    /* U+00EB "ë" */
+    0x0, 0x91, 0x73, 0x0, 0x6, 0x5, 0x20, 0x0, 0x36, 0x40, 0x0, 0x8d, 0x9b, 0xc1, 0x3e, 0x10,
+    0x9, 0x87, 0xd9, 0x99, 0xbc, 0x6c, 0x33, 0x33, 0x31, 0xe7, 0x1, 0x71, 0x3, 0xbe, 0xeb, 0x20,
+
+    /* U+00EC "ì" */
+    0x2b, 0x50, 0x1, 0x92, 0x0, 0x51, 0x0, 0xe4, 0x0, 0xe4, 0x0, 0xe4, 0x0, 0xe4, 0x0, 0xe4,
+    0x0, 0xe4,
+
+    /* U+00ED "í" */
+    0x2b, 0x49, 0x30, 0x51, 0xe, 0x40, 0xe4, 0xe, 0x40, 0xe4, 0xe, 0x40, 0xe4, 0x0,
+
+    /* U+00EE "î" */
+    0x3c, 0x70, 0x92, 0x82, 0x5, 0x10, 0xe, 0x40, 0xe, 0x40, 0xe, 0x40, 0xe, 0x40, 0xe, 0x40,
+    0xe, 0x40,
+
+    /* U+00EF "ï" */
+    0x73, 0x94, 0x26, 0x5, 0x10, 0xe4, 0xe, 0x40, 0xe4, 0xe, 0x40, 0xe4, 0xe, 0x40,
+
+    /* U+00F0 "ð" */
+    0x7, 0xaa, 0x73, 0x40, 0x5, 0x5a, 0xff, 0x60, 0x3, 0xc9, 0x38, 0xa0, 0x1, 0x24, 0x22, 0xf1,
+    0x9, 0xeb, 0xd8, 0xf2, 0x5e, 0x10, 0xa, 0xf2, 0x7b, 0x0, 0x5, 0xe0, 0x4e, 0x30, 0x1c, 0x80,
+    0x6, 0xde, 0xd8, 0x0,
+
+    /* U+00F1 "ñ" */
+    0x6, 0xb4, 0x81, 0x0, 0x71, 0x87, 0x0, 0x51, 0x46, 0x30, 0xe, 0xcc, 0xae, 0x80, 0xe9, 0x0,
+    0x4f, 0xe, 0x40, 0x1, 0xf2, 0xe4, 0x0, 0xf, 0x2e, 0x40, 0x0, 0xf2, 0xe4, 0x0, 0xf, 0x20,
+
+    /* U+00F2 "ò" */
+    0x1, 0xa7, 0x0, 0x0, 0x0, 0x18, 0x40, 0x0, 0x0, 0x26, 0x51, 0x0, 0x8, 0xea, 0xbe, 0x30,
+    0x3e, 0x20, 0x7, 0xc0, 0x7b, 0x0, 0x1, 0xf1, 0x6c, 0x0, 0x2, 0xf1, 0x1e, 0x60, 0x1b, 0xa0,
+    0x3, 0xce, 0xe9, 0x10,
+
+    /* U+00F3 "ó" */
+    0x0, 0x1, 0xb6, 0x0, 0x0, 0x8, 0x50, 0x0, 0x0, 0x26, 0x51, 0x0, 0x8, 0xea, 0xbe, 0x30,
+    0x3e, 0x20, 0x7, 0xc0, 0x7b, 0x0, 0x1, 0xf1, 0x6c, 0x0, 0x2, 0xf1, 0x1e, 0x60, 0x1b, 0xa0,
+    0x3, 0xce, 0xe9, 0x10,
+
+    /* U+00F4 "ô" */
+    0x0, 0x3b, 0xa0, 0x0, 0x1, 0x92, 0x66, 0x0, 0x0, 0x26, 0x51, 0x0, 0x8, 0xea, 0xbe, 0x30,
+    0x3e, 0x20, 0x7, 0xc0, 0x7b, 0x0, 0x1, 0xf1, 0x6c, 0x0, 0x2, 0xf1, 0x1e, 0x60, 0x1b, 0xa0,
+    0x3, 0xce, 0xe9, 0x10,
+
+    /* U+00F5 "õ" */
+    0x0, 0xa9, 0x28, 0x0, 0x2, 0x52, 0x94, 0x0, 0x0, 0x26, 0x51, 0x0, 0x8, 0xea, 0xbe, 0x30,
+    0x3e, 0x20, 0x7, 0xc0, 0x7b, 0x0, 0x1, 0xf1, 0x6c, 0x0, 0x2, 0xf1, 0x1e, 0x60, 0x1b, 0xa0,
+    0x3, 0xce, 0xe9, 0x10,
+
+    /* U+00F6 "ö" */
+    0x0, 0x82, 0x64, 0x0, 0x0, 0x51, 0x43, 0x0, 0x0, 0x26, 0x51, 0x0, 0x8, 0xea, 0xbe, 0x30,
+    0x3e, 0x20, 0x7, 0xc0, 0x7b, 0x0, 0x1, 0xf1, 0x6c, 0x0, 0x2, 0xf1, 0x1e, 0x60, 0x1b, 0xa0,
+    0x3, 0xce, 0xe9, 0x10,
+
+    /* U+00F7 "÷" */
+    0x0, 0x3, 0x0, 0x0, 0x1, 0xf1, 0x0, 0x0, 0x1, 0x0, 0x2, 0xaa, 0xaa, 0xa2, 0x14, 0x44,
+    0x44, 0x10, 0x0, 0x70, 0x0, 0x0, 0x1c, 0x10, 0x0,
+
+    /* U+00F8 "ø" */
+    0x0, 0x0, 0x0, 0x20, 0x0, 0x26, 0x56, 0x50, 0x8, 0xea, 0xcf, 0x30, 0x3e, 0x20, 0x98, 0xc0,
+    0x7b, 0x5, 0x51, 0xf1, 0x6c, 0x19, 0x2, 0xf1, 0x1e, 0xf2, 0x1b, 0xa0, 0x8, 0xfe, 0xe9, 0x10,
+    0x8, 0x0, 0x0, 0x0,
+
+    /* U+00F9 "ù" */
+    0x8, 0x90, 0x0, 0x0, 0x76, 0x0, 0x51, 0x0, 0x15, 0xf3, 0x0, 0x2f, 0xf3, 0x0, 0x2f, 0xf3,
+    0x0, 0x2f, 0xe3, 0x0, 0x3f, 0xba, 0x11, 0xbf, 0x2b, 0xed, 0x8f,
+
+    /* U+00FA "ú" */
+    0x0, 0x8, 0x80, 0x0, 0x57, 0x0, 0x51, 0x0, 0x15, 0xf3, 0x0, 0x2f, 0xf3, 0x0, 0x2f, 0xf3,
+    0x0, 0x2f, 0xe3, 0x0, 0x3f, 0xba, 0x11, 0xbf, 0x2b, 0xed, 0x8f,
+
+    /* U+00FB "û" */
+    0x1, 0xbb, 0x10, 0x8, 0x43, 0x80, 0x51, 0x0, 0x15, 0xf3, 0x0, 0x2f, 0xf3, 0x0, 0x2f, 0xf3,
+    0x0, 0x2f, 0xe3, 0x0, 0x3f, 0xba, 0x11, 0xbf, 0x2b, 0xed, 0x8f,
+
+    /* U+00FC "ü" */
+    0x6, 0x43, 0x60, 0x4, 0x22, 0x40, 0x51, 0x0, 0x15, 0xf3, 0x0, 0x2f, 0xf3, 0x0, 0x2f, 0xf3,
+    0x0, 0x2f, 0xe3, 0x0, 0x3f, 0xba, 0x11, 0xbf, 0x2b, 0xed, 0x8f,
+
+    /* U+00FD "ý" */
+    0x0, 0x0, 0x7a, 0x10, 0x0, 0x4, 0x81, 0x0, 0x5, 0x10, 0x0, 0x33, 0xa, 0x80, 0x0, 0xc5,
+    0x3, 0xe1, 0x3, 0xd0, 0x0, 0xb6, 0xa, 0x70, 0x0, 0x5d, 0x2e, 0x10, 0x0, 0xd, 0xc8, 0x0,
+    0x0, 0x6, 0xf2, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x1d, 0xbe, 0x20, 0x0, 0x2, 0x41, 0x0, 0x0,
+
+    /* U+00FE "þ" */
+    0xc3, 0x0, 0x0, 0xe, 0x40, 0x0, 0x0, 0xe4, 0x46, 0x40, 0xe, 0xcc, 0x9d, 0xb0, 0xea, 0x0,
+    0x1d, 0x6e, 0x40, 0x0, 0x8a, 0xe5, 0x0, 0x9, 0x9e, 0xd2, 0x4, 0xe4, 0xe8, 0xde, 0xd5, 0xe,
+    0x40, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x3, 0x10, 0x0, 0x0,
+
+    /* U+00FF "ÿ" */
+    0x0, 0x46, 0x28, 0x0, 0x0, 0x34, 0x15, 0x0, 0x5, 0x10, 0x0, 0x33, 0xa, 0x80, 0x0, 0xc5,
+    0x3, 0xe1, 0x3, 0xd0, 0x0, 0xb6, 0xa, 0x70, 0x0, 0x5d, 0x2e, 0x10, 0x0, 0xd, 0xc8, 0x0,
+    0x0, 0x6, 0xf2, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x1d, 0xbe, 0x20, 0x0, 0x2, 0x41, 0x0, 0x0,
+
+    /* U+2013 "–" */
+    0xaa, 0xaa, 0xaa, 0x22, 0x22, 0x22,
+
+    /* U+2014 "—" */
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+
+    /* U+2018 "‘" */
+    0xb, 0x2, 0xb0, 0x6f, 0x11, 0x50,
+
+    /* U+2019 "’" */
+    0x4d, 0x12, 0xe1, 0x2a, 0x2, 0x30,
+
+    /* U+201C "“" */
+    0xb, 0x7, 0x32, 0xb0, 0xd1, 0x6f, 0x3f, 0x51, 0x50, 0x61,
+
+    /* U+201D "”" */
+    0x4d, 0x2d, 0x42, 0xe1, 0xc4, 0x2a, 0xc, 0x2, 0x30, 0x40,
+
+    /* U+2022 "•" */
+    0x4, 0x32, 0xfd, 0xa, 0x80,
+
+    /* U+2026 "…" */
+    0x27, 0x4, 0x60, 0x54, 0x5e, 0x18, 0xc0, 0xb9,
+
+    /* U+20AC "€" */
+    0x0, 0x0, 0x47, 0x74, 0x0, 0x0, 0x1b, 0xea, 0x9d, 0xc1, 0x0, 0xbb, 0x10, 0x0, 0x50, 0x37,
+    0xf7, 0x55, 0x40, 0x0, 0x39, 0xd5, 0x55, 0x40, 0x0, 0x6c, 0xea, 0xaa, 0x80, 0x0, 0x1, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x7e, 0x61, 0x5, 0xb1, 0x0, 0x5, 0xcf, 0xfc, 0x60,
+
+    /* U+F00D "" */
+    0x37, 0x0, 0x0, 0x55, 0xd, 0xfa, 0x0, 0x7f, 0xf2, 0x7f, 0xfa, 0x7f, 0xfa, 0x0, 0x7f, 0xff,
+    0xfa, 0x0, 0x0, 0xaf, 0xfe, 0x10, 0x0, 0x7f, 0xff, 0xfa, 0x0, 0x7f, 0xfa, 0x7f, 0xfa, 0xd,
+    0xfa, 0x0, 0x7f, 0xf2, 0x37, 0x0, 0x0, 0x55, 0x0,
+
+    /* U+F013 "" */
+    0x0, 0x0, 0x14, 0x41, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7, 0x0, 0x0, 0x3, 0x43, 0xcf, 0xfc,
+    0x34, 0x30, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x6f, 0xff, 0xfb, 0xbf, 0xff, 0xf6, 0x1b, 0xff,
+    0x70, 0x7, 0xff, 0xb1, 0x7, 0xff, 0x30, 0x3, 0xff, 0x70, 0x1b, 0xff, 0x70, 0x7, 0xff, 0xb1,
+    0x6f, 0xff, 0xfb, 0xbf, 0xff, 0xf6, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x3, 0x43, 0xcf, 0xfc,
+    0x34, 0x30, 0x0, 0x0, 0x7f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x14, 0x41, 0x0, 0x0,
+
+    /* U+F053 "" */
+    0x0, 0x0, 0x7, 0x30, 0x0, 0x9, 0xfb, 0x0, 0x9, 0xfe, 0x20, 0x9, 0xfe, 0x20, 0x9, 0xfe,
+    0x20, 0x4, 0xff, 0x50, 0x0, 0x9, 0xfe, 0x20, 0x0, 0x9, 0xfe, 0x20, 0x0, 0x9, 0xfe, 0x20,
+    0x0, 0x9, 0xfb, 0x0, 0x0, 0x7, 0x30,
+
+    /* U+F070 "" */
+    0x42, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
+    0xf8, 0x5a, 0xdf, 0xea, 0x50, 0x0, 0x0, 0x9, 0xff, 0xc5, 0x25, 0xcf, 0xc2, 0x0, 0x0, 0x5,
+    0xee, 0x4a, 0x71, 0xcf, 0xd2, 0x0, 0xb8, 0x3, 0xdf, 0xff, 0x75, 0xff, 0xb0, 0x3f, 0xfb, 0x11,
+    0xaf, 0xfb, 0x2f, 0xff, 0x30, 0xbf, 0xf5, 0x0, 0x7f, 0xd7, 0xff, 0xb0, 0x2, 0xdf, 0xc0, 0x0,
+    0x4e, 0xff, 0xd1, 0x0, 0x2, 0xcf, 0xc5, 0x21, 0x1b, 0xfa, 0x0, 0x0, 0x0, 0x5a, 0xef, 0xb1,
+    0x8, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xed, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x40,
+
+    /* U+F0C7 "" */
+    0x7b, 0xbb, 0xbb, 0xbb, 0x30, 0xf, 0xdb, 0xbb, 0xbb, 0xee, 0x30, 0xf8, 0x0, 0x0, 0x8, 0xfe,
+    0x2f, 0x80, 0x0, 0x0, 0x8f, 0xf7, 0xfa, 0x44, 0x44, 0x4a, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0x85, 0xcf, 0xff, 0x8f, 0xff, 0xc0, 0x5, 0xff, 0xf8, 0xff, 0xfe, 0x10, 0x8f,
+    0xff, 0x7f, 0xff, 0xfe, 0xcf, 0xff, 0xf7, 0x7b, 0xbb, 0xbb, 0xbb, 0xbb, 0x20,
+
+    /* U+F15B "" */
+    0x68, 0x88, 0x82, 0x40, 0xf, 0xff, 0xff, 0x4f, 0x60, 0xff, 0xff, 0xf4, 0xff, 0x6f, 0xff, 0xff,
+    0x48, 0x87, 0xff, 0xff, 0xfd, 0xbb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x68, 0x88, 0x88, 0x88, 0x60,
+
+    /* U+F1EB "" */
+    0x0, 0x1, 0x58, 0xab, 0xa8, 0x51, 0x0, 0x0, 0x18, 0xef, 0xff, 0xff, 0xff, 0xe8, 0x10, 0x3d,
+    0xff, 0xa5, 0x32, 0x35, 0xaf, 0xfd, 0x3d, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x2a, 0xfd, 0x26, 0x0,
+    0x5a, 0xdf, 0xda, 0x50, 0x6, 0x20, 0x1, 0xbf, 0xff, 0xef, 0xff, 0xb1, 0x0, 0x0, 0x2e, 0xc4,
+    0x0, 0x4, 0xce, 0x20, 0x0, 0x0, 0x20, 0x0, 0x30, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0x50,
+    0x0, 0x0, 0x0,
+
+    /* U+F240 "" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf9,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x7f, 0xbf, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xdf, 0xf8, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0x8, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xdf, 0xf9, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x7f, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x14, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x42, 0x0,
+
+    /* U+F241 "" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf9,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x7f, 0xbf, 0x8b, 0xff, 0xff, 0xff, 0xb0, 0x3, 0xdf, 0xf8, 0xbf,
+    0xff, 0xff, 0xfb, 0x0, 0x8, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xb0, 0x3, 0xdf, 0xf9, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x7f, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x14, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x42, 0x0,
+
+    /* U+F242 "" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf9,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x7f, 0xbf, 0x8b, 0xff, 0xff, 0x80, 0x0, 0x3, 0xdf, 0xf8, 0xbf,
+    0xff, 0xf8, 0x0, 0x0, 0x8, 0xff, 0x8b, 0xff, 0xff, 0x80, 0x0, 0x3, 0xdf, 0xf9, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x7f, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x14, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x42, 0x0,
+
+    /* U+F243 "" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf9,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x7f, 0xbf, 0x8b, 0xff, 0x40, 0x0, 0x0, 0x3, 0xdf, 0xf8, 0xbf,
+    0xf4, 0x0, 0x0, 0x0, 0x8, 0xff, 0x8b, 0xff, 0x40, 0x0, 0x0, 0x3, 0xdf, 0xf9, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x7f, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x14, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x42, 0x0,
+
+    /* U+F244 "" */
+    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf9,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x7f, 0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xf9, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x7f, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x14, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x42, 0x0,
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 52, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 51, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14, .adv_w = 75, .box_w = 4, .box_h = 4, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 22, .adv_w = 135, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 63, .adv_w = 119, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 105, .adv_w = 162, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 150, .adv_w = 132, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 186, .adv_w = 40, .box_w = 2, .box_h = 4, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 190, .adv_w = 65, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 208, .adv_w = 65, .box_w = 3, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 226, .adv_w = 77, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 239, .adv_w = 112, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 260, .adv_w = 44, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 266, .adv_w = 74, .box_w = 4, .box_h = 2, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 270, .adv_w = 44, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 273, .adv_w = 68, .box_w = 6, .box_h = 13, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 312, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 348, .adv_w = 71, .box_w = 4, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 366, .adv_w = 110, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 398, .adv_w = 110, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 430, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 466, .adv_w = 110, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 498, .adv_w = 118, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 534, .adv_w = 115, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 566, .adv_w = 124, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 602, .adv_w = 118, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 634, .adv_w = 44, .box_w = 3, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 645, .adv_w = 44, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 659, .adv_w = 112, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 680, .adv_w = 112, .box_w = 7, .box_h = 5, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 698, .adv_w = 112, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 719, .adv_w = 110, .box_w = 6, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 746, .adv_w = 199, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 818, .adv_w = 141, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 859, .adv_w = 145, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 895, .adv_w = 139, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 936, .adv_w = 159, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 977, .adv_w = 129, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1009, .adv_w = 122, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1041, .adv_w = 148, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1082, .adv_w = 156, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1118, .adv_w = 60, .box_w = 2, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1127, .adv_w = 98, .box_w = 5, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1150, .adv_w = 138, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1186, .adv_w = 114, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1213, .adv_w = 183, .box_w = 10, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1258, .adv_w = 156, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1294, .adv_w = 161, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1339, .adv_w = 139, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1371, .adv_w = 161, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1426, .adv_w = 140, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1458, .adv_w = 119, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1490, .adv_w = 113, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1522, .adv_w = 152, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1558, .adv_w = 137, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1599, .adv_w = 216, .box_w = 13, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1658, .adv_w = 129, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1694, .adv_w = 124, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1730, .adv_w = 126, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1766, .adv_w = 64, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 1784, .adv_w = 68, .box_w = 6, .box_h = 13, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 1823, .adv_w = 64, .box_w = 3, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1841, .adv_w = 112, .box_w = 5, .box_h = 6, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 1856, .adv_w = 96, .box_w = 6, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1859, .adv_w = 115, .box_w = 4, .box_h = 2, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 1863, .adv_w = 115, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1888, .adv_w = 131, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1920, .adv_w = 110, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1945, .adv_w = 131, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1981, .adv_w = 118, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2006, .adv_w = 68, .box_w = 5, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2029, .adv_w = 132, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2069, .adv_w = 131, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2101, .adv_w = 54, .box_w = 2, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2110, .adv_w = 55, .box_w = 4, .box_h = 12, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 2134, .adv_w = 118, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2166, .adv_w = 54, .box_w = 2, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2175, .adv_w = 203, .box_w = 11, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2214, .adv_w = 131, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2239, .adv_w = 122, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2267, .adv_w = 131, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2302, .adv_w = 131, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2342, .adv_w = 79, .box_w = 4, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2356, .adv_w = 96, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2377, .adv_w = 79, .box_w = 5, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2397, .adv_w = 130, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2418, .adv_w = 107, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2443, .adv_w = 173, .box_w = 11, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2482, .adv_w = 106, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2507, .adv_w = 107, .box_w = 8, .box_h = 10, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 2547, .adv_w = 100, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2568, .adv_w = 67, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2592, .adv_w = 57, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2604, .adv_w = 67, .box_w = 4, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2628, .adv_w = 112, .box_w = 7, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 2639, .adv_w = 52, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2639, .adv_w = 51, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2653, .adv_w = 110, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2688, .adv_w = 124, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2724, .adv_w = 134, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2756, .adv_w = 136, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2797, .adv_w = 57, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2809, .adv_w = 96, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2842, .adv_w = 115, .box_w = 4, .box_h = 2, .ofs_x = 2, .ofs_y = 7},
+    {.bitmap_index = 2846, .adv_w = 154, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2887, .adv_w = 78, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 2897, .adv_w = 97, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2915, .adv_w = 112, .box_w = 7, .box_h = 4, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 2929, .adv_w = 74, .box_w = 4, .box_h = 2, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 2933, .adv_w = 154, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2974, .adv_w = 115, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 2979, .adv_w = 80, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 2992, .adv_w = 112, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3020, .adv_w = 83, .box_w = 5, .box_h = 6, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 3035, .adv_w = 83, .box_w = 5, .box_h = 6, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 3050, .adv_w = 115, .box_w = 4, .box_h = 2, .ofs_x = 2, .ofs_y = 7},
+    {.bitmap_index = 3054, .adv_w = 131, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3089, .adv_w = 124, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3128, .adv_w = 51, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 3133, .adv_w = 115, .box_w = 3, .box_h = 4, .ofs_x = 2, .ofs_y = -3},
+    {.bitmap_index = 3139, .adv_w = 83, .box_w = 4, .box_h = 6, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 3151, .adv_w = 80, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 3161, .adv_w = 97, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3179, .adv_w = 199, .box_w = 12, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3233, .adv_w = 199, .box_w = 11, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3283, .adv_w = 199, .box_w = 13, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3342, .adv_w = 110, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3374, .adv_w = 141, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3424, .adv_w = 141, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3474, .adv_w = 141, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3524, .adv_w = 141, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3574, .adv_w = 141, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3624, .adv_w = 141, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3678, .adv_w = 201, .box_w = 12, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3732, .adv_w = 139, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3786, .adv_w = 129, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3825, .adv_w = 129, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3864, .adv_w = 129, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3903, .adv_w = 129, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3942, .adv_w = 60, .box_w = 4, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 3964, .adv_w = 60, .box_w = 3, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3981, .adv_w = 60, .box_w = 5, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4009, .adv_w = 60, .box_w = 4, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4031, .adv_w = 160, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4076, .adv_w = 156, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4120, .adv_w = 161, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4175, .adv_w = 161, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4230, .adv_w = 161, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4285, .adv_w = 161, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4340, .adv_w = 161, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4395, .adv_w = 112, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 4408, .adv_w = 161, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4463, .adv_w = 152, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4507, .adv_w = 152, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4551, .adv_w = 152, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4595, .adv_w = 152, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4639, .adv_w = 124, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4683, .adv_w = 139, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4715, .adv_w = 130, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4747, .adv_w = 115, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4779, .adv_w = 115, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4811, .adv_w = 115, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4843, .adv_w = 115, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4875, .adv_w = 115, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4907, .adv_w = 115, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4942, .adv_w = 190, .box_w = 12, .box_h = 7, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4984, .adv_w = 110, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5019, .adv_w = 118, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5051, .adv_w = 118, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5083, .adv_w = 118, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5115, .adv_w = 118, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5147, .adv_w = 54, .box_w = 4, .box_h = 9, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5165, .adv_w = 54, .box_w = 3, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5179, .adv_w = 54, .box_w = 4, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5197, .adv_w = 54, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5211, .adv_w = 123, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5247, .adv_w = 131, .box_w = 7, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5279, .adv_w = 122, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5315, .adv_w = 122, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5351, .adv_w = 122, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5387, .adv_w = 122, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5423, .adv_w = 122, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5459, .adv_w = 112, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 5484, .adv_w = 122, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5520, .adv_w = 130, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5547, .adv_w = 130, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5574, .adv_w = 130, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5601, .adv_w = 130, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5628, .adv_w = 107, .box_w = 8, .box_h = 12, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 5676, .adv_w = 131, .box_w = 7, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 5718, .adv_w = 107, .box_w = 8, .box_h = 12, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 5766, .adv_w = 96, .box_w = 6, .box_h = 2, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 5772, .adv_w = 192, .box_w = 12, .box_h = 2, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 5784, .adv_w = 44, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 5790, .adv_w = 44, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 5796, .adv_w = 80, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 5806, .adv_w = 80, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 5816, .adv_w = 60, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 5821, .adv_w = 133, .box_w = 8, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5829, .adv_w = 155, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5874, .adv_w = 132, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5915, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 5993, .adv_w = 120, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6032, .adv_w = 240, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 6130, .adv_w = 168, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6191, .adv_w = 144, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 6250, .adv_w = 240, .box_w = 15, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6333, .adv_w = 240, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6401, .adv_w = 240, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6469, .adv_w = 240, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6537, .adv_w = 240, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6605, .adv_w = 240, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 0}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_2[] = {
+    0x0, 0x1, 0x5, 0x6, 0x9, 0xa, 0xf, 0x13,
+    0x99, 0xcffa, 0xd000, 0xd040, 0xd05d, 0xd0b4, 0xd148, 0xd1d8,
+    0xd22d, 0xd22e, 0xd22f, 0xd230, 0xd231
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 160, .range_length = 96, .glyph_id_start = 96,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 8211, .range_length = 53810, .glyph_id_start = 192,
+        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 21, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17, 18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27, 28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37, 37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50, 51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58, 58, 59, 58, 60, 41, 0, 0, 9,
+    0, 61, 47, 62, 63, 64, 0, 65, 0, 22, 8, 66, 0, 9, 22, 0,
+    67, 0, 0, 0, 0, 51, 29, 9, 0, 0, 8, 9, 0, 0, 0, 68,
+    23, 23, 23, 23, 23, 23, 26, 25, 26, 26, 26, 26, 29, 29, 29, 29,
+    22, 29, 22, 22, 22, 22, 22, 0, 22, 30, 30, 30, 30, 39, 69, 46,
+    45, 45, 45, 45, 45, 45, 49, 47, 49, 49, 49, 49, 51, 51, 70, 51,
+    71, 45, 46, 46, 46, 46, 46, 9, 46, 51, 51, 51, 51, 58, 46, 58,
+    0, 0, 72, 73, 72, 73, 9, 10, 25, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12, 18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25, 23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29, 29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0, 39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46, 46, 47, 48, 49, 0, 0, 35, 9,
+    0, 50, 39, 51, 52, 53, 0, 54, 0, 23, 8, 9, 9, 9, 23, 0,
+    55, 0, 0, 0, 0, 42, 56, 9, 0, 0, 8, 57, 0, 0, 0, 58,
+    24, 24, 24, 24, 24, 24, 24, 23, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 23, 23, 23, 23, 23, 0, 23, 28, 28, 28, 28, 31, 25, 38,
+    37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 39, 39, 59, 42, 60, 61,
+    62, 42, 39, 39, 39, 39, 39, 9, 39, 45, 45, 45, 45, 46, 38, 46,
+    0, 0, 63, 64, 63, 64, 9, 10, 52, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 2, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 2, 0, 4, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 9, 0, 5, -4, 0, 0, 4, 0, -11, -12, 1, 9, 4, 3, -8,
+    1, 9, 1, 8, 2, 6, 0, -8, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 12, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, 4, 0, 4, 9, 0, -8, 0, 0, 0, 0, 0, 0,
+    0, -6, 0, 0, 0, 0, 0, -4, 3, 4, 0, 0, -2, 0, -1, 2,
+    0, -2, 0, -2, -1, -4, 0, 0, 0, 0, -2, 0, 0, -2, -3, 0,
+    0, -2, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2,
+    0, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, 0, 0, 0, -5, -2,
+    0, -5, 0, -23, 0, 0, -4, -10, 4, 6, 0, 0, -4, 2, 2, 6,
+    4, -3, 4, 0, 0, -11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -7, 0, 0, 2, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 0, 4, -4, -4,
+    -2, -9, 0, -8, -1, 0, 0, -6, 0, 0, 7, 0, -6, -2, -1, 1,
+    0, -3, 0, 0, -1, -14, 0, 2, 0, 6, -5, 0, -4, 0, -8, 2,
+    0, -15, -2, 7, 2, 0, 0, 0, 0, 0, 0, 2, 0, -2, -1, -2,
+    0, -2, 0, 0, 0, 0, -8, -8, 0, -1, 0, 0, 0, 0, -6, -5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 2, 0, 0, -4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0,
+    0, 7, 2, 1, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 4, 2, 6, -2, 0, 0, 4, -2, -6, -26, 1, 5, 4, 0, -2,
+    0, 7, 0, 6, 0, 6, 0, -18, 0, -2, 6, 0, 6, -2, 4, 2,
+    0, 0, 1, -2, 0, 0, -3, 15, 0, 15, 0, 6, 0, 8, 2, 8,
+    3, 0, 0, 1, 0, 0, 6, 7, 2, -16, 15, 15, 15, -3, 6, 6,
+    0, 0, -3, -7, 0, 0, 0, -2, 1, -1, 0, 1, -3, -2, -4, 1,
+    0, -2, 0, 0, 0, -8, 1, -3, 0, -4, -6, 0, -4, -3, -6, 0,
+    0, -12, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, -2, -4, -2,
+    -2, 0, 0, 1, -4, 2, 0, -17, -2, 0, 0, 0, 0, 2, 0, 0,
+    1, -11, 2, -12, 0, 0, 0, -6, -1, 0, 19, -2, -2, 2, 2, -2,
+    0, -2, 2, 0, 0, -10, -4, 6, 0, 11, -6, -2, -7, 0, -7, 3,
+    0, -19, 0, 2, 2, 0, -2, 0, 2, 0, 0, -1, -2, -6, 0, -6,
+    0, 1, 0, -2, -6, 0, -12, -25, 1, 2, 0, 0, 0, -2, -3, -3,
+    0, 12, -4, 0, -7, 0, 6, 0, -13, -19, -13, -4, 6, 0, 0, -13,
+    0, 2, -4, 0, -3, 0, -4, -8, 0, -2, 6, 0, 6, 0, 6, 0,
+    0, 5, 6, -23, -13, 0, -13, 2, 1, -13, -13, -5, -13, -6, -11, -6,
+    -13, -12, -2, 0, 8, -4, 9, 0, -9, -14, -13, -13, -13, -9, 9, 10,
+    0, 1, 0, 0, 0, 0, 0, 1, 1, -2, -4, 0, -1, -1, -2, 0,
+    0, -1, 0, 0, 0, -4, 0, -2, 0, -4, -4, 0, -5, -6, -6, -4,
+    0, -4, 0, -4, 0, 0, 0, 0, -2, 0, 0, 2, 0, 1, -2, 1,
+    0, 0, 0, 0, -2, 0, 1, 0, 0, -6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, -1, 0, 0, 0, -1, 2, 2, -1, 0, 0, 0, -4,
+    0, -1, 0, 0, 0, 0, 0, 1, 0, 2, -1, 0, -2, 0, -3, 0,
+    0, -1, 0, 6, 0, 0, -2, 0, 0, 0, 0, 0, -1, 1, -1, 1,
+    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0,
+    0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    -2, -2, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, -2, -2, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -2, -1,
+    0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -6, -1, -6, 4, 0, 0, -4, 2, 4, 5, 0, -5, -1, -2, 0,
+    -1, -9, 2, -1, 1, -10, 2, 0, 0, 1, -10, 0, -10, -2, -17, -1,
+    0, -10, 0, 4, 5, 0, 2, 0, 0, 0, 0, 0, 0, -3, -2, -3,
+    0, 0, 2, 2, -2, 4, -6, -3, 0, 2, 0, 0, 0, 2, -4, -2,
+    0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0,
+    -1, -2, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, -1, -2, -2, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2,
+    0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -4, 2, 0, 0, -2, 1, 2, 2, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, -2, -1, -2, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, -2, 0, 0, 0, 0, -2, -3, -2,
+    0, 0, 0, 2, 0, 4, -4, 0, 0, 0, 0, 0, 0, 2, -2, 0,
+    0, 6, -1, 1, -6, 0, 0, 5, -10, -10, -8, -4, 2, 0, -2, -12,
+    -3, 0, -3, 0, -4, 3, -3, -12, 0, -5, 0, 0, 1, -1, 2, -1,
+    0, 2, 0, -6, -7, 0, -10, -5, -4, -5, -6, -2, -5, 0, -4, 0,
+    -5, -5, -2, -4, 2, -2, 1, 5, -3, -12, -5, -5, -5, -10, 2, 4,
+    0, 1, 0, -2, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, -1, 0, -1, -2, 0, -3, -4, -4, -1,
+    0, -6, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, -1, 1,
+    0, 0, 0, 0, -2, 2, 0, 0, 0, -4, 0, 0, 0, 0, -1, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, -2, 0, 2, 0, 7, -2, 0, -4, -1, -7, 0,
+    0, -3, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, -2, 1,
+    0, 0, 0, 0, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -1, 0, 0, 0, -4, 0, 0, 2, 0, -10, -6, 0, 0, 0, -3, -10,
+    0, 0, -2, 2, 0, -5, -1, -8, 0, -5, 0, 0, -2, -3, -2, -2,
+    -3, 0, 0, -4, 0, 0, -2, 0, 0, 0, 0, 0, 0, 2, 0, 2,
+    0, -1, 0, 0, -3, 0, 2, 0, 2, -21, 0, 0, 0, -2, 4, 4,
+    0, -3, 0, 0, 0, 0, 2, 0, 1, -4, -4, 0, -2, -2, -2, 0,
+    0, 0, 0, 0, 0, -6, 0, -2, 0, -3, -2, 0, -4, -5, -6, -2,
+    0, -4, 0, -6, 0, 0, 0, 0, 15, 0, 0, 1, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, -4, 0, 0, 0, 0, -2, -3,
+    0, -8, 0, 0, 0, 0, 0, -18, -3, 6, 6, -2, -8, 0, 2, -3,
+    0, -10, -1, -2, 2, -13, -2, 2, 0, 3, -7, -3, -7, -6, -8, 0,
+    0, -12, 0, 11, 0, 0, -1, 0, 0, 0, -1, -1, -2, -5, -6, -5,
+    0, 2, 0, 0, 0, 0, -18, -15, 2, 4, 0, 0, 0, -1, -6, -6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -2, -3, 0,
+    0, -4, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, -1, 0, -4, 0, 0, 4, -1, 2, 0, -4, 2, -1, -1, -5,
+    -2, 0, -2, -2, -1, 0, -3, -3, 0, 0, -2, -1, -1, -3, -2, 0,
+    0, -2, 0, 2, -1, 0, -4, 0, 0, 0, -4, 0, -3, 0, -3, 0,
+    -3, -2, 0, 0, 0, -1, 2, 1, -1, -2, 0, 0, 0, -4, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, -4, 2, 0, -3, 0, -1, -2, -6,
+    -1, -1, -1, -1, -1, -2, -1, 0, 0, 0, 0, 0, -2, -2, -2, 0,
+    0, 0, 0, 2, -1, 0, -1, 0, 0, 0, -1, -2, -1, -2, -2, -2,
+    -2, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    2, 8, -1, 0, -5, 0, -1, 4, 0, -2, -8, -2, 3, 0, 0, -9,
+    -3, 2, -3, 1, 0, -1, -2, -6, 0, -3, 1, 0, 0, -3, 0, 0,
+    0, 2, 2, -4, -4, 0, -3, -2, -3, -2, -2, 0, -3, 1, -4, 1,
+    -3, -2, 0, 0, 0, -1, 6, 2, -2, -9, -2, 2, 1, -3, 3, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, 0, -2, -2, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, -4, 0, 0, 0, -6, 0, 1, -4, 4, 0, -1, -9,
+    0, 0, -4, -2, 0, -8, -5, -5, 0, 0, -8, -2, -8, -7, -9, 0,
+    -5, 0, 2, 13, -2, 0, -4, -2, -1, -2, -3, -5, -3, -7, -8, -7,
+    -4, 0, 0, 0, 0, 0, -2, -2, -1, 0, -2, -2, -2, -4, -3, 0,
+    0, 0, -1, 0, 1, 0, 0, -13, -2, 6, 4, -4, -7, 0, 1, -6,
+    0, -10, -1, -2, 4, -18, -2, 1, 0, 0, -12, -2, -10, -2, -14, 0,
+    0, -13, 0, 11, 1, 0, -1, 0, 0, 0, 0, -1, -1, -7, -1, -7,
+    0, 0, 0, 0, 0, 0, -12, -15, 1, 0, 0, 0, 0, -1, -8, -9,
+    0, 0, 0, 0, -6, 0, -2, 0, -1, -5, -9, 0, 0, -1, -3, -6,
+    -2, 0, -1, 0, 0, 0, 0, -9, -2, -6, -6, -2, -3, -5, -2, -3,
+    0, -4, -2, -6, -3, 0, -2, -4, -2, -4, 0, 1, 0, -1, -6, -1,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, -10, -4, -4, -4, -2, 0, 2,
+    0, -3, 0, 0, 0, 0, 2, 0, 1, -4, 8, 0, -2, -2, -2, 0,
+    0, 0, 0, 0, 0, -6, 0, -2, 0, -3, -2, 0, -4, -5, -6, -2,
+    0, -4, 2, 8, 0, 0, 0, 0, 15, 0, 0, 1, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, -4, 0, 0, 0, 0, -2, -3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -4,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2, 0, 0, -4, -2, 0,
+    0, -4, 0, 3, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 0, 0, -2, 0, 0, 0, 0, 1, 0,
+    4, 2, -2, 0, -6, -3, 0, 6, -6, -6, -4, -4, 8, 3, 2, -17,
+    -1, 4, -2, 0, -2, 2, -2, -7, 0, -2, 2, -2, -2, -6, -2, 0,
+    0, 6, 4, 0, -5, 0, -11, -2, 6, -2, -7, 1, -2, -6, -6, -6,
+    -2, -4, 0, 0, 0, 0, 8, 6, -2, -11, 2, 7, 3, -11, 5, 5,
+    2, 0, -3, 0, -5, 0, 2, 6, -4, -7, -8, -5, 6, 0, 1, -14,
+    -2, 2, -3, -1, -4, 0, -4, -7, -3, -3, -2, 0, 0, -4, -4, -2,
+    0, 6, 4, -2, -11, 0, -11, -3, 0, -7, -11, -1, -6, -3, -6, -3,
+    -5, -6, 0, 0, 0, 0, 5, 4, -2, -14, 3, 7, 4, -11, 4, 6,
+    0, 0, -2, 0, -4, -2, 0, -2, -3, 0, 3, -6, 2, 0, 0, -10,
+    0, -2, -4, -3, -1, -6, -5, -6, -4, 0, -6, -2, -4, -4, -6, -2,
+    0, 0, 1, 9, -3, 0, -6, -2, 0, -2, -4, -4, -5, -5, -7, -5,
+    -2, -2, 0, 0, 0, 0, -4, 0, -2, 1, -2, -2, -2, -6, 0, 1,
+    4, 0, -3, 0, -10, -2, 1, 4, -6, -7, -4, -6, 6, -2, 1, -18,
+    -3, 4, -4, -3, -7, 0, -6, -8, -2, -2, -2, -2, -4, -6, -1, 0,
+    0, 6, 5, -1, -12, 0, -12, -4, 5, -7, -13, -4, -7, -8, -10, -8,
+    -6, -8, 0, 0, 0, -4, 4, 4, -3, -16, 6, 6, 5, -12, 2, 5,
+    0, 0, 0, 0, -2, 0, 0, 2, -2, 4, 1, -4, 4, 0, 0, -6,
+    -1, 0, -1, 0, 1, 1, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, 2, 6, 0, 0, -2, 0, 0, 0, 0, -1, -1, -2, 0, -2,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0,
+    1, 2, 0, 0, 0, 0, 2, 1, -2, 0, 7, 0, 3, 1, 1, -2,
+    0, 4, 0, 0, 0, 2, 0, 0, 0, 0, 4, 0, 4, 1, 5, 0,
+    0, 6, 0, 5, -2, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 3, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -12, 0, -2, 3, 0, 6, -26, 0, 19, 2, -4, -4, 2, 2, -1,
+    1, -10, 0, 0, 9, -12, -4, 6, 0, 6, -4, -2, -8, 4, -4, 0,
+    0, -13, 7, 27, 0, 0, 0, 0, 23, 0, 0, 0, 0, 4, 0, 4,
+    0, 8, 0, 0, 0, 6, -12, -6, 2, 6, 0, 0, 0, 0, -10, -10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -4, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 4, -5, 0, 0, 1, -2, 0, 2, 25, -4, -2, 6, 5, -5,
+    2, 0, 0, 2, 2, -2, -6, 11, 6, 16, 0, -2, -2, 9, -1, 4,
+    0, -25, 5, 0, -2, 0, -5, 0, 21, 0, 2, -4, -5, -2, 7, 4,
+    5, 2, 3, -1, -2, 5, 0, -14, 2, 0, 0, 0, 0, -5, 0, 0,
+    0, 0, 0, -5, 0, 0, 0, -5, 0, 0, 0, 0, -4, -1, 0, 0,
+    0, -4, 0, -2, 0, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -13, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -2, 0, -2,
+    0, 0, 0, 0, 0, 0, -4, -4, 0, 0, 0, 0, 0, 1, -2, -1,
+    0, -3, 0, -5, 0, 0, 0, -3, 2, -2, 0, 0, -5, -2, -4, 0,
+    0, -5, 0, -2, 0, -9, 0, -2, 0, 0, -16, -4, -8, -2, -7, 0,
+    0, -13, 0, -5, -1, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3,
+    -2, 0, 0, 0, 0, 0, -3, -4, 0, -2, 0, 0, 0, 0, -2, 0,
+    0, 0, 0, 0, -4, 0, -4, 2, -2, 4, 0, -1, -4, -1, -3, -4,
+    0, -2, -1, -1, 1, -5, -1, 0, 0, 0, -17, -2, -3, 0, -4, 0,
+    -1, -9, -2, 0, 0, -1, -2, 0, 0, 0, 0, 1, 0, -1, -3, -1,
+    -1, 0, 0, 0, 0, -2, 3, 0, 0, -1, 0, 0, 0, -2, 3, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, 0, -1, 0, 0, 0, -4, 2, 0, 0, 0, -5, -2, -4, 0,
+    0, -5, 0, -2, 0, -9, 0, 0, 0, 0, -19, 0, -4, -7, -10, 0,
+    0, -13, 0, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, -3, -2,
+    -1, 0, 0, 0, 0, 0, -3, -4, 0, -2, 0, 0, 0, 0, -2, 0,
+    1, 0, 0, 3, -2, 0, 6, 9, -2, -2, -6, 2, 9, 3, 4, -5,
+    2, 8, 2, 6, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 12, 9, -3, -2, 0, -2, 15, 8, 15, 0, 0, 0, 2, 0, 2,
+    0, 0, 0, 0, 0, 0, 7, 8, -1, -2, 13, 9, 12, -2, 9, 14,
+    0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, -16, -2, -2, -8, -9, 0,
+    0, -13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, -16, -2, -2, -8, -9, 0,
+    0, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, -4, 2, 0, -2, 2, 3, 2, -6,
+    0, 0, -2, 2, 0, 2, 0, 0, 0, 0, -5, 0, -2, -1, -4, 0,
+    -2, -8, 0, 12, -2, 0, -4, -1, 0, -1, -3, 0, -2, -5, -4, -5,
+    -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -4, 1, 0,
+    0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, -16, -2, -2, -8, -9, 0,
+    0, -13, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, -6, -2, -2, 6, -2, -2, -8, 1, -1, 1, -1, -5,
+    0, 4, 0, 2, 1, 2, -5, -8, -2, 0, -7, -4, -5, -8, -7, 0,
+    -3, -4, -2, -2, -2, -1, -2, -1, 0, -1, -1, 3, 0, 3, -1, 3,
+    0, 0, 0, 0, 0, 2, 6, 6, 1, -7, -1, -1, -1, -2, 6, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, 0,
+    0, -5, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2,
+    0, 0, 0, 0, 0, 0, -2, -4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, -3, -2, 2, 0, -3, -4, -1, 0, -6,
+    -1, -4, -1, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -13, 0, 6, 0, 0, -3, 0, 0, 0, 0, -2, 0, -2, 0, -2,
+    0, 0, 0, 0, 0, -2, -1, -4, 0, 0, 0, 0, 0, -3, -1, 0,
+    0, 0, -1, 0, -4, 0, 0, 8, -2, -6, -6, 1, 2, 2, 0, -5,
+    1, 3, 1, 6, 1, 6, -1, -5, 0, 0, -8, 0, 0, -6, -5, 0,
+    0, -4, 0, -2, -3, 0, -3, 0, -3, 0, -1, 3, 0, -2, -6, -2,
+    -2, 0, 0, 0, 0, 0, 7, 6, 0, -6, 0, 0, 0, -3, 6, 3,
+    0, 0, -2, 0, -4, 0, 0, 2, -4, 0, 2, -2, 2, 0, 0, -6,
+    0, -1, -1, 0, -2, 2, -2, 0, 0, 0, -8, -2, -4, 0, -6, 0,
+    0, -9, 0, 7, -2, 0, -3, 0, 1, 0, -2, 0, -2, -6, 0, -6,
+    -2, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, -3, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 2, -2, 1, 0, 0, -2, -1, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -12, 0, 4, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, -2, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 8, 0, -4, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 2, 0, 2, -4, 0, -6, -2, -8, 0,
+    0, -11, 1, 2, 0, 0, 0, 0, 13, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, -2, 0, -7, 0, 0, 5, -6, -1, 2, -7, 3, -2, -2, -7,
+    -2, 1, -6, -4, -6, 0, -2, -9, 0, -4, 0, 0, 0, -2, 2, 0,
+    0, 3, 1, 3, -8, 0, -6, -4, -5, -4, -8, -4, -5, -4, -5, -4,
+    -8, -5, 0, 0, 0, -2, 0, 2, -2, -4, -4, 5, 2, -6, -1, 1,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, -2, 0, 0, 0, -2, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    2, 4, 0, 0, 0, 0, 3, 0, -4, -6, -6, -2, 6, 0, 2, -2,
+    0, 5, -2, 0, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 10, 3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, 0, 0, 0, 0, 0, 0, 0, -8, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 0, 0, 0, 3,
+    0, 1, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 2, -2, 1, 2, 0, -1, 0, 0, 1,
+    1, 0, 0, 0, 0, -2, 0, 2, 0, 6, -2, 0, -2, -2, -3, 0,
+    0, -11, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 0, 0, 0, 6, 0, -12, -11, 1, 8, 6, 3, -8,
+    1, 8, 0, 7, 0, 4, 2, -18, 0, -2, 8, 0, 5, -4, 4, 0,
+    0, 10, 0, 0, 0, 0, -3, 0, 0, 0, -1, 4, 0, 7, 2, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -12, 0, 0, 0, -3, 0, 0,
+    -1, -7, 0, -12, -3, 0, 0, -16, -8, 1, 8, -9, -8, 0, 0, -8,
+    0, -8, -8, 0, -1, -26, -10, 3, 0, 0, -11, -7, -13, 2, -15, 0,
+    0, -18, 2, 10, -3, 0, -6, -2, 13, -2, -1, -2, -10, -9, 2, -4,
+    0, 0, 2, -4, -10, 1, -11, -17, -2, -5, -2, -2, -2, -6, -4, -4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -6, 0, -4, -5, -4, 0,
+    -2, 0, 0, 0, 0, -6, 0, -6, 0, -8, -5, 0, -2, -6, -6, -3,
+    0, -8, 0, -6, -2, 0, 0, 0, -2, 0, 0, 1, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, 0, 0, 15, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, 0, 0, 0, 0, -16, -2, -2, -8, -9, 0,
+    0, -13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, -3, 0, 1, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, -1, 0, 0, 0, 0, 0, 2,
+    1, 0, 2, 8, -2, 0, 0, 6, 0, -3, -10, 0, 7, 2, 4, -7,
+    0, 8, -1, 6, 0, 7, 0, -6, 0, -1, 5, 0, 4, 0, 2, 0,
+    0, 10, 0, 0, -1, 0, -2, 6, 0, 6, 0, 3, 0, 6, 0, 6,
+    0, 1, 0, 0, 0, 2, 0, 7, 0, -6, 6, 6, 6, -2, 5, 5,
+    1, 0, 2, 8, -2, 0, 0, 6, 0, -3, -10, 0, 9, 4, 3, -11,
+    0, 5, 0, 2, 0, 7, 0, -6, 0, 0, 5, 0, 6, 1, 5, 0,
+    0, 10, 0, 0, -2, 0, -5, 0, 0, 0, -3, 1, 0, 3, 0, 3,
+    0, 1, 0, 0, 2, 2, 0, 7, 0, -6, 0, 0, 0, -5, 5, 5
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 73,
+    .right_class_cnt     = 64,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 3,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = LV_FONT_FMT_TXT_PLAIN,
+    .cache = &cache
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t lv_font_montserrat_12 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 15,          /*The maximum line height required by the font*/
+    .base_line = 3,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
@@ -0,0 +1,2156 @@
+/*******************************************************************************
+ * Size: 14 px
+ * Bpp: 4
+ * Charset: text, 260 glyphs
+ * Generated by tools/fonts/gen_fonts.py from Montserrat-Medium.ttf and FontAwesome5-Solid+Brands+Regular.woff. Do not edit.
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0xb8, 0xd9, 0xc9, 0xc8, 0xb8, 0xb7, 0x96, 0x0, 0x86, 0xd9,
+
+    /* U+0022 "\"" */
+    0x1c, 0x17, 0x71, 0xf0, 0x88, 0x1f, 0x8, 0x81, 0xe0, 0x87,
+
+    /* U+0023 "#" */
+    0x0, 0xa, 0x20, 0x29, 0x0, 0x0, 0xe, 0x10, 0x5a, 0x0, 0x14, 0x5e, 0x44, 0x9a, 0x42, 0x2b,
+    0xce, 0xbb, 0xdd, 0xb5, 0x0, 0x5a, 0x0, 0xa5, 0x0, 0x0, 0x78, 0x0, 0xc3, 0x0, 0x58, 0xcb,
+    0x88, 0xe9, 0x80, 0x47, 0xd9, 0x78, 0xe7, 0x70, 0x0, 0xc3, 0x3, 0xc0, 0x0, 0x0, 0xe1, 0x4,
+    0xa0, 0x0,
+
+    /* U+0024 "$" */
+    0x0, 0x0, 0x60, 0x0, 0x0, 0x0, 0xd, 0x0, 0x0, 0x1, 0x7c, 0xfc, 0x93, 0x0, 0xbd, 0x7e,
+    0x6b, 0x70, 0x2f, 0x40, 0xd0, 0x0, 0x1, 0xf7, 0xd, 0x0, 0x0, 0x8, 0xfd, 0xe4, 0x0, 0x0,
+    0x3, 0x8f, 0xfd, 0x40, 0x0, 0x0, 0xd2, 0xbe, 0x0, 0x10, 0xd, 0x5, 0xf1, 0x3d, 0x63, 0xd4,
+    0xcc, 0x0, 0x7c, 0xff, 0xea, 0x20, 0x0, 0x0, 0xd0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0,
+
+    /* U+0025 "%" */
+    0x6, 0xcb, 0x20, 0x0, 0x76, 0x0, 0x3c, 0x13, 0xc0, 0x3, 0xd1, 0x0, 0x67, 0x0, 0xd0, 0xc,
+    0x30, 0x0, 0x68, 0x0, 0xd0, 0x88, 0x0, 0x0, 0x1c, 0x69, 0x84, 0xc0, 0x22, 0x0, 0x1, 0x65,
+    0x1d, 0x39, 0xbb, 0x90, 0x0, 0x0, 0x97, 0x2c, 0x0, 0xc2, 0x0, 0x4, 0xc0, 0x3a, 0x0, 0xa4,
+    0x0, 0x1d, 0x20, 0x1d, 0x0, 0xd1, 0x0, 0xa7, 0x0, 0x6, 0xbc, 0x60,
+
+    /* U+0026 "&" */
+    0x0, 0x3b, 0xda, 0x20, 0x0, 0x0, 0xe7, 0x28, 0xb0, 0x0, 0x2, 0xf2, 0x5, 0xd0, 0x0, 0x0,
+    0xca, 0x5e, 0x60, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0, 0x5, 0xe8, 0xd9, 0x2, 0x60, 0x2f, 0x40,
+    0x2d, 0x97, 0xb0, 0x5f, 0x0, 0x2, 0xdf, 0x50, 0x2f, 0x81, 0x14, 0xdf, 0x90, 0x4, 0xcf, 0xfc,
+    0x62, 0xc2,
+
+    /* U+0027 "'" */
+    0x1c, 0x11, 0xf0, 0x1f, 0x1, 0xe0,
+
+    /* U+0028 "(" */
+    0x1, 0x61, 0x7, 0xd0, 0xd, 0x60, 0x3f, 0x20, 0x6d, 0x0, 0x9b, 0x0, 0x9a, 0x0, 0xaa, 0x0,
+    0x9b, 0x0, 0x7d, 0x0, 0x4f, 0x10, 0xe, 0x50, 0x9, 0xb0, 0x2, 0x91,
+
+    /* U+0029 ")" */
+    0x35, 0x0, 0x2f, 0x30, 0xa, 0x90, 0x6, 0xe0, 0x3, 0xf2, 0x0, 0xf4, 0x0, 0xe5, 0x0, 0xe6,
+    0x0, 0xf5, 0x2, 0xf3, 0x4, 0xf0, 0x9, 0xb0, 0x1e, 0x50, 0x48, 0x0,
+
+    /* U+002A "*" */
+    0x0, 0x41, 0x0, 0x31, 0x93, 0x40, 0x5d, 0xdc, 0xb2, 0x19, 0xfe, 0x50, 0x77, 0x95, 0xa2, 0x0,
+    0x83, 0x0,
+
+    /* U+002B "+" */
+    0x0, 0x7, 0xa0, 0x0, 0x0, 0x8, 0xa0, 0x0, 0x7, 0x7b, 0xc7, 0x71, 0x1a, 0xad, 0xda, 0xa2,
+    0x0, 0x8, 0xa0, 0x0, 0x0, 0x8, 0xa0, 0x0, 0x0, 0x1, 0x20, 0x0,
+
+    /* U+002C "," */
+    0x2c, 0x43, 0xf7, 0xd, 0x22, 0xc0,
+
+    /* U+002D "-" */
+    0x16, 0x66, 0x42, 0xbb, 0xb6,
+
+    /* U+002E "." */
+    0x2c, 0x43, 0xe5,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0xb, 0x40, 0x0, 0x3, 0xe1, 0x0, 0x0, 0x9a, 0x0, 0x0, 0xe, 0x40, 0x0, 0x4,
+    0xe0, 0x0, 0x0, 0xa9, 0x0, 0x0, 0x1e, 0x30, 0x0, 0x5, 0xd0, 0x0, 0x0, 0xa8, 0x0, 0x0,
+    0x1f, 0x30, 0x0, 0x6, 0xc0, 0x0, 0x0, 0xb7, 0x0, 0x0, 0x2f, 0x20, 0x0, 0x2, 0x40, 0x0,
+    0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x3a, 0xdc, 0x60, 0x0, 0x4f, 0xa6, 0x8e, 0x80, 0xc, 0xa0, 0x0, 0x5f, 0x22, 0xf4, 0x0,
+    0x0, 0xe7, 0x4f, 0x20, 0x0, 0xc, 0x94, 0xf2, 0x0, 0x0, 0xb9, 0x3f, 0x30, 0x0, 0xd, 0x80,
+    0xd9, 0x0, 0x4, 0xf3, 0x5, 0xf7, 0x35, 0xda, 0x0, 0x6, 0xdf, 0xe9, 0x10,
+
+    /* U+0031 "1" */
+    0xbc, 0xc9, 0x66, 0xcb, 0x0, 0xab, 0x0, 0xab, 0x0, 0xab, 0x0, 0xab, 0x0, 0xab, 0x0, 0xab,
+    0x0, 0xab, 0x0, 0xab,
+
+    /* U+0032 "2" */
+    0x6, 0xbd, 0xc8, 0x10, 0x8e, 0x85, 0x7e, 0xb0, 0x12, 0x0, 0x6, 0xf1, 0x0, 0x0, 0x5, 0xf1,
+    0x0, 0x0, 0x1c, 0xa0, 0x0, 0x1, 0xbc, 0x10, 0x0, 0x1c, 0xc1, 0x0, 0x1, 0xcc, 0x10, 0x0,
+    0x1c, 0xd4, 0x33, 0x32, 0x7f, 0xff, 0xff, 0xf8,
+
+    /* U+0033 "3" */
+    0x6c, 0xcc, 0xcc, 0xc0, 0x36, 0x66, 0x7e, 0xa0, 0x0, 0x0, 0xad, 0x10, 0x0, 0x7, 0xe2, 0x0,
+    0x0, 0x2f, 0xc6, 0x0, 0x0, 0x16, 0x8e, 0xc0, 0x0, 0x0, 0x3, 0xf4, 0x0, 0x0, 0x2, 0xf5,
+    0xaa, 0x42, 0x4b, 0xe1, 0x3b, 0xdf, 0xeb, 0x30,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x9, 0x90, 0x0, 0x0, 0x0, 0x7e, 0x20, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0,
+    0x2e, 0x70, 0x0, 0x0, 0x0, 0xcb, 0x0, 0xb4, 0x0, 0x9, 0xd1, 0x0, 0xf5, 0x0, 0x5f, 0xc9,
+    0x99, 0xfb, 0x92, 0x49, 0x99, 0x99, 0xfb, 0x92, 0x0, 0x0, 0x0, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0xf5, 0x0,
+
+    /* U+0035 "5" */
+    0x7, 0xcc, 0xcc, 0xc0, 0xa, 0xc6, 0x66, 0x60, 0xb, 0x80, 0x0, 0x0, 0xd, 0x70, 0x0, 0x0,
+    0xe, 0xed, 0xc9, 0x20, 0x5, 0x55, 0x7c, 0xe2, 0x0, 0x0, 0x1, 0xe7, 0x0, 0x0, 0x0, 0xe7,
+    0x8b, 0x52, 0x3a, 0xf3, 0x2a, 0xdf, 0xfc, 0x40,
+
+    /* U+0036 "6" */
+    0x0, 0x28, 0xcd, 0xb5, 0x0, 0x2e, 0xc6, 0x57, 0x40, 0xb, 0xb0, 0x0, 0x0, 0x2, 0xf4, 0x0,
+    0x0, 0x0, 0x4f, 0x4a, 0xed, 0x91, 0x5, 0xfe, 0x73, 0x5d, 0xc0, 0x3f, 0x80, 0x0, 0x4f, 0x30,
+    0xe7, 0x0, 0x3, 0xf3, 0x7, 0xe5, 0x13, 0xbc, 0x0, 0x6, 0xdf, 0xeb, 0x20,
+
+    /* U+0037 "7" */
+    0x7c, 0xcc, 0xcc, 0xca, 0x9d, 0x66, 0x66, 0xea, 0x9b, 0x0, 0x4, 0xf3, 0x12, 0x0, 0xa, 0xb0,
+    0x0, 0x0, 0x2f, 0x50, 0x0, 0x0, 0x9d, 0x0, 0x0, 0x1, 0xf6, 0x0, 0x0, 0x8, 0xe1, 0x0,
+    0x0, 0x1e, 0x80, 0x0, 0x0, 0x6f, 0x10, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x7c, 0xdc, 0x71, 0x0, 0xae, 0x64, 0x6e, 0xa0, 0xf, 0x70, 0x0, 0x6f, 0x0, 0xd9, 0x0,
+    0x9, 0xd0, 0x4, 0xec, 0xac, 0xe4, 0x0, 0x9e, 0x97, 0x9e, 0x90, 0x4f, 0x40, 0x0, 0x3f, 0x45,
+    0xf1, 0x0, 0x1, 0xf5, 0x1e, 0xb3, 0x13, 0xbe, 0x10, 0x3b, 0xef, 0xeb, 0x30,
+
+    /* U+0039 "9" */
+    0x2, 0xad, 0xd9, 0x10, 0x2e, 0xa4, 0x4b, 0xd1, 0x8d, 0x0, 0x0, 0xd8, 0x8c, 0x0, 0x0, 0xdc,
+    0x4f, 0x71, 0x18, 0xfe, 0x6, 0xef, 0xfb, 0x9e, 0x0, 0x2, 0x10, 0x9c, 0x0, 0x0, 0x1, 0xe7,
+    0x5, 0x32, 0x5c, 0xc1, 0xb, 0xff, 0xd9, 0x10,
+
+    /* U+003A ":" */
+    0x16, 0x15, 0xf7, 0x5, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2c, 0x43, 0xe5,
+
+    /* U+003B ";" */
+    0x16, 0x15, 0xf7, 0x5, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2c, 0x43, 0xf7, 0xd, 0x22, 0xc0,
+
+    /* U+003C "<" */
+    0x0, 0x0, 0x5, 0xa3, 0x0, 0x28, 0xdd, 0x71, 0xb, 0xe9, 0x30, 0x0, 0x1e, 0xc6, 0x10, 0x0,
+    0x0, 0x5b, 0xea, 0x40, 0x0, 0x0, 0x28, 0xd3,
+
+    /* U+003D "=" */
+    0x2, 0x22, 0x22, 0x20, 0x1f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xcc, 0xcc, 0xc3, 0x5, 0x55, 0x55, 0x51,
+
+    /* U+003E ">" */
+    0x1b, 0x51, 0x0, 0x0, 0x6, 0xce, 0x93, 0x0, 0x0, 0x3, 0x8e, 0xc2, 0x0, 0x1, 0x5b, 0xe2,
+    0x3, 0x9e, 0xc6, 0x10, 0x1e, 0x83, 0x0, 0x0,
+
+    /* U+003F "?" */
+    0x6, 0xbd, 0xc8, 0x19, 0xe7, 0x56, 0xec, 0x12, 0x0, 0x6, 0xf0, 0x0, 0x0, 0x9d, 0x0, 0x0,
+    0x7e, 0x40, 0x0, 0x5f, 0x40, 0x0, 0xa, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x60, 0x0,
+    0x0, 0xda, 0x0,
+
+    /* U+0040 "@" */
+    0x0, 0x0, 0x5a, 0xcd, 0xb8, 0x30, 0x0, 0x0, 0x2c, 0xa4, 0x21, 0x27, 0xd8, 0x0, 0x1, 0xd5,
+    0x0, 0x1, 0x0, 0x1a, 0x80, 0x9, 0x80, 0x2b, 0xff, 0xb8, 0xb1, 0xd2, 0x1e, 0x10, 0xda, 0x21,
+    0x6f, 0xb0, 0x78, 0x3c, 0x5, 0xe1, 0x0, 0xa, 0xb0, 0x4b, 0x4b, 0x6, 0xc0, 0x0, 0x7, 0xb0,
+    0x3c, 0x3c, 0x5, 0xe1, 0x0, 0xa, 0xb0, 0x4a, 0x1e, 0x10, 0xdb, 0x21, 0x6e, 0xd1, 0xa6, 0x9,
+    0x90, 0x2b, 0xee, 0xb3, 0xce, 0x90, 0x1, 0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xc7,
+    0x43, 0x5a, 0x10, 0x0, 0x0, 0x0, 0x38, 0xab, 0x95, 0x0, 0x0,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x9b, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe6, 0x0, 0x0, 0x0, 0x9, 0xb8, 0xd0, 0x0,
+    0x0, 0x1, 0xf4, 0x1f, 0x50, 0x0, 0x0, 0x8d, 0x0, 0x9b, 0x0, 0x0, 0x1e, 0x60, 0x3, 0xf3,
+    0x0, 0x6, 0xf9, 0x99, 0x9e, 0xa0, 0x0, 0xdb, 0x88, 0x88, 0xaf, 0x20, 0x5f, 0x20, 0x0, 0x0,
+    0xd9, 0xc, 0xa0, 0x0, 0x0, 0x6, 0xe1,
+
+    /* U+0042 "B" */
+    0x6c, 0xcc, 0xcb, 0x82, 0x8, 0xe5, 0x55, 0x6c, 0xe1, 0x8d, 0x0, 0x0, 0x2f, 0x58, 0xd0, 0x0,
+    0x3, 0xf4, 0x8e, 0x88, 0x89, 0xe9, 0x8, 0xe9, 0x99, 0xad, 0xd3, 0x8d, 0x0, 0x0, 0xb, 0xb8,
+    0xd0, 0x0, 0x0, 0x9d, 0x8d, 0x22, 0x23, 0x6e, 0x98, 0xff, 0xff, 0xfd, 0x80,
+
+    /* U+0043 "C" */
+    0x0, 0x6, 0xbd, 0xda, 0x40, 0x1, 0xbf, 0x96, 0x6a, 0xf5, 0x9, 0xe3, 0x0, 0x0, 0x40, 0x1f,
+    0x70, 0x0, 0x0, 0x0, 0x4f, 0x20, 0x0, 0x0, 0x0, 0x4f, 0x20, 0x0, 0x0, 0x0, 0x2f, 0x50,
+    0x0, 0x0, 0x0, 0xb, 0xd1, 0x0, 0x0, 0x20, 0x1, 0xdd, 0x63, 0x37, 0xe5, 0x0, 0x18, 0xdf,
+    0xfc, 0x60,
+
+    /* U+0044 "D" */
+    0x6c, 0xcc, 0xcb, 0x72, 0x0, 0x8e, 0x66, 0x68, 0xde, 0x50, 0x8d, 0x0, 0x0, 0x9, 0xf3, 0x8d,
+    0x0, 0x0, 0x0, 0xd9, 0x8d, 0x0, 0x0, 0x0, 0x9c, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x8d, 0x0,
+    0x0, 0x0, 0xca, 0x8d, 0x0, 0x0, 0x6, 0xf4, 0x8d, 0x33, 0x35, 0xaf, 0x80, 0x8f, 0xff, 0xfe,
+    0xa4, 0x0,
+
+    /* U+0045 "E" */
+    0x6c, 0xcc, 0xcc, 0xc5, 0x8e, 0x66, 0x66, 0x62, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0,
+    0x8e, 0x99, 0x99, 0x70, 0x8e, 0x99, 0x99, 0x70, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0,
+    0x8d, 0x33, 0x33, 0x32, 0x8f, 0xff, 0xff, 0xf9,
+
+    /* U+0046 "F" */
+    0x6c, 0xcc, 0xcc, 0xc5, 0x8e, 0x66, 0x66, 0x62, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0,
+    0x8d, 0x22, 0x22, 0x20, 0x8f, 0xff, 0xff, 0xc0, 0x8d, 0x11, 0x11, 0x0, 0x8d, 0x0, 0x0, 0x0,
+    0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x5, 0xbd, 0xda, 0x40, 0x1, 0xbf, 0x96, 0x6a, 0xf6, 0x9, 0xe3, 0x0, 0x0, 0x31, 0x1f,
+    0x70, 0x0, 0x0, 0x0, 0x4f, 0x20, 0x0, 0x0, 0x0, 0x4f, 0x20, 0x0, 0x0, 0xb9, 0x2f, 0x50,
+    0x0, 0x0, 0xb9, 0xa, 0xd1, 0x0, 0x0, 0xb9, 0x1, 0xdd, 0x63, 0x36, 0xe9, 0x0, 0x18, 0xdf,
+    0xfd, 0x81,
+
+    /* U+0048 "H" */
+    0x6a, 0x0, 0x0, 0x6, 0xb8, 0xd0, 0x0, 0x0, 0x8d, 0x8d, 0x0, 0x0, 0x8, 0xd8, 0xd0, 0x0,
+    0x0, 0x8d, 0x8e, 0x99, 0x99, 0x9c, 0xd8, 0xe9, 0x99, 0x99, 0xcd, 0x8d, 0x0, 0x0, 0x8, 0xd8,
+    0xd0, 0x0, 0x0, 0x8d, 0x8d, 0x0, 0x0, 0x8, 0xd8, 0xd0, 0x0, 0x0, 0x8d,
+
+    /* U+0049 "I" */
+    0x6a, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
+
+    /* U+004A "J" */
+    0x2c, 0xcc, 0xca, 0x16, 0x66, 0xbc, 0x0, 0x0, 0x9c, 0x0, 0x0, 0x9c, 0x0, 0x0, 0x9c, 0x0,
+    0x0, 0x9c, 0x0, 0x0, 0x9c, 0x10, 0x0, 0xab, 0xd8, 0x25, 0xe7, 0x5d, 0xfe, 0x91,
+
+    /* U+004B "K" */
+    0x6a, 0x0, 0x0, 0x3c, 0x58, 0xd0, 0x0, 0x2e, 0x80, 0x8d, 0x0, 0x2e, 0x90, 0x8, 0xd0, 0x2d,
+    0xa0, 0x0, 0x8d, 0x2d, 0xc0, 0x0, 0x8, 0xed, 0xdf, 0x50, 0x0, 0x8f, 0xc1, 0x9e, 0x30, 0x8,
+    0xe1, 0x0, 0xbd, 0x10, 0x8d, 0x0, 0x1, 0xcc, 0x8, 0xd0, 0x0, 0x2, 0xea,
+
+    /* U+004C "L" */
+    0x6a, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0,
+    0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0,
+    0x8d, 0x33, 0x33, 0x31, 0x8f, 0xff, 0xff, 0xf3,
+
+    /* U+004D "M" */
+    0x6a, 0x0, 0x0, 0x0, 0x6, 0xb8, 0xf6, 0x0, 0x0, 0x1, 0xed, 0x8f, 0xe1, 0x0, 0x0, 0x9f,
+    0xd8, 0xcc, 0x90, 0x0, 0x3f, 0xad, 0x8c, 0x3f, 0x30, 0xc, 0x87, 0xd8, 0xc0, 0x9b, 0x5, 0xe1,
+    0x7d, 0x8c, 0x1, 0xe6, 0xd6, 0x7, 0xd8, 0xc0, 0x6, 0xfc, 0x0, 0x7d, 0x8c, 0x0, 0xb, 0x30,
+    0x7, 0xd8, 0xc0, 0x0, 0x0, 0x0, 0x7d,
+
+    /* U+004E "N" */
+    0x6b, 0x10, 0x0, 0x6, 0xb8, 0xfa, 0x0, 0x0, 0x8d, 0x8f, 0xf7, 0x0, 0x8, 0xd8, 0xd7, 0xf4,
+    0x0, 0x8d, 0x8d, 0xa, 0xe2, 0x8, 0xd8, 0xd0, 0x1c, 0xc1, 0x8d, 0x8d, 0x0, 0x2e, 0xa8, 0xd8,
+    0xd0, 0x0, 0x4f, 0xdd, 0x8d, 0x0, 0x0, 0x7f, 0xd8, 0xd0, 0x0, 0x0, 0xad,
+
+    /* U+004F "O" */
+    0x0, 0x5, 0xbd, 0xda, 0x40, 0x0, 0x0, 0xbf, 0x96, 0x6a, 0xf8, 0x0, 0x9, 0xe3, 0x0, 0x0,
+    0x6f, 0x50, 0x1f, 0x70, 0x0, 0x0, 0xa, 0xc0, 0x4f, 0x20, 0x0, 0x0, 0x6, 0xf0, 0x4f, 0x20,
+    0x0, 0x0, 0x5, 0xf1, 0x2f, 0x50, 0x0, 0x0, 0x9, 0xd0, 0xa, 0xd1, 0x0, 0x0, 0x3f, 0x70,
+    0x1, 0xdd, 0x63, 0x37, 0xeb, 0x0, 0x0, 0x18, 0xdf, 0xec, 0x70, 0x0,
+
+    /* U+0050 "P" */
+    0x6c, 0xcc, 0xca, 0x50, 0x8, 0xe6, 0x67, 0x9f, 0x90, 0x8d, 0x0, 0x0, 0x5f, 0x38, 0xd0, 0x0,
+    0x1, 0xf5, 0x8d, 0x0, 0x0, 0x4f, 0x48, 0xd3, 0x33, 0x6d, 0xc0, 0x8f, 0xff, 0xfd, 0x91, 0x8,
+    0xd0, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x8, 0xd0, 0x0, 0x0, 0x0,
+
+    /* U+0051 "Q" */
+    0x0, 0x5, 0xbd, 0xda, 0x40, 0x0, 0x0, 0xbf, 0x96, 0x6a, 0xf8, 0x0, 0x9, 0xe3, 0x0, 0x0,
+    0x6f, 0x50, 0x1f, 0x70, 0x0, 0x0, 0xa, 0xc0, 0x4f, 0x20, 0x0, 0x0, 0x6, 0xf0, 0x4f, 0x20,
+    0x0, 0x0, 0x5, 0xf1, 0x2f, 0x50, 0x0, 0x0, 0x9, 0xd0, 0xb, 0xd1, 0x0, 0x0, 0x3f, 0x70,
+    0x2, 0xdd, 0x63, 0x37, 0xeb, 0x0, 0x0, 0x18, 0xdf, 0xfd, 0x70, 0x0, 0x0, 0x0, 0x2, 0xdc,
+    0x53, 0xa4, 0x0, 0x0, 0x0, 0x18, 0xde, 0x91,
+
+    /* U+0052 "R" */
+    0x6c, 0xcc, 0xca, 0x50, 0x8, 0xe6, 0x67, 0x9f, 0x90, 0x8d, 0x0, 0x0, 0x5f, 0x38, 0xd0, 0x0,
+    0x1, 0xf5, 0x8d, 0x0, 0x0, 0x4f, 0x48, 0xd3, 0x33, 0x6d, 0xc0, 0x8f, 0xff, 0xff, 0xa1, 0x8,
+    0xd0, 0x0, 0xbc, 0x0, 0x8d, 0x0, 0x2, 0xe7, 0x8, 0xd0, 0x0, 0x5, 0xf3,
+
+    /* U+0053 "S" */
+    0x1, 0x8c, 0xdc, 0x93, 0x0, 0xbd, 0x75, 0x6b, 0x70, 0x2f, 0x40, 0x0, 0x0, 0x1, 0xf7, 0x0,
+    0x0, 0x0, 0x8, 0xfc, 0x84, 0x0, 0x0, 0x3, 0x8c, 0xfe, 0x40, 0x0, 0x0, 0x2, 0xbe, 0x0,
+    0x10, 0x0, 0x5, 0xf1, 0x3d, 0x62, 0x24, 0xcc, 0x0, 0x7c, 0xff, 0xea, 0x20,
+
+    /* U+0054 "T" */
+    0xbc, 0xcc, 0xcc, 0xcc, 0x26, 0x66, 0xbd, 0x66, 0x61, 0x0, 0x9, 0xc0, 0x0, 0x0, 0x0, 0x9c,
+    0x0, 0x0, 0x0, 0x9, 0xc0, 0x0, 0x0, 0x0, 0x9c, 0x0, 0x0, 0x0, 0x9, 0xc0, 0x0, 0x0,
+    0x0, 0x9c, 0x0, 0x0, 0x0, 0x9, 0xc0, 0x0, 0x0, 0x0, 0x9c, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0x79, 0x0, 0x0, 0x8, 0x89, 0xc0, 0x0, 0x0, 0xaa, 0x9c, 0x0, 0x0, 0xa, 0xa9, 0xc0, 0x0,
+    0x0, 0xaa, 0x9c, 0x0, 0x0, 0xa, 0xa9, 0xc0, 0x0, 0x0, 0xaa, 0x8d, 0x0, 0x0, 0xb, 0x95,
+    0xf2, 0x0, 0x1, 0xe6, 0xd, 0xd5, 0x24, 0xcd, 0x10, 0x19, 0xef, 0xea, 0x20,
+
+    /* U+0056 "V" */
+    0xa8, 0x0, 0x0, 0x0, 0x7a, 0x7f, 0x10, 0x0, 0x1, 0xe6, 0x1e, 0x80, 0x0, 0x7, 0xe1, 0x8,
+    0xe0, 0x0, 0xd, 0x80, 0x2, 0xf6, 0x0, 0x5f, 0x20, 0x0, 0xac, 0x0, 0xba, 0x0, 0x0, 0x4f,
+    0x43, 0xf3, 0x0, 0x0, 0xc, 0xaa, 0xc0, 0x0, 0x0, 0x5, 0xff, 0x50, 0x0, 0x0, 0x0, 0xdd,
+    0x0, 0x0,
+
+    /* U+0057 "W" */
+    0x5c, 0x10, 0x0, 0xa, 0x90, 0x0, 0x2, 0xc2, 0x2f, 0x50, 0x0, 0x2f, 0xf1, 0x0, 0x7, 0xd0,
+    0xc, 0xa0, 0x0, 0x8c, 0xe5, 0x0, 0xc, 0x80, 0x7, 0xe1, 0x0, 0xd7, 0xaa, 0x0, 0x2f, 0x30,
+    0x2, 0xf5, 0x3, 0xf2, 0x5f, 0x10, 0x7d, 0x0, 0x0, 0xca, 0x8, 0xb0, 0xe, 0x60, 0xc8, 0x0,
+    0x0, 0x7e, 0x1d, 0x60, 0x9, 0xb2, 0xf3, 0x0, 0x0, 0x2f, 0x8f, 0x10, 0x4, 0xf8, 0xd0, 0x0,
+    0x0, 0xc, 0xfb, 0x0, 0x0, 0xef, 0x80, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x9f, 0x30, 0x0,
+
+    /* U+0058 "X" */
+    0x4c, 0x40, 0x0, 0xa, 0x80, 0xa, 0xd1, 0x0, 0x7e, 0x20, 0x1, 0xda, 0x3, 0xf5, 0x0, 0x0,
+    0x3f, 0x7d, 0x90, 0x0, 0x0, 0x7, 0xfc, 0x0, 0x0, 0x0, 0x8, 0xfd, 0x10, 0x0, 0x0, 0x4f,
+    0x5d, 0xa0, 0x0, 0x1, 0xe9, 0x3, 0xf6, 0x0, 0xb, 0xc1, 0x0, 0x7e, 0x30, 0x7f, 0x30, 0x0,
+    0xb, 0xd1,
+
+    /* U+0059 "Y" */
+    0xa8, 0x0, 0x0, 0x6, 0xa4, 0xf4, 0x0, 0x2, 0xe5, 0xa, 0xc0, 0x0, 0xab, 0x0, 0x1e, 0x70,
+    0x4f, 0x20, 0x0, 0x7e, 0x2d, 0x80, 0x0, 0x0, 0xce, 0xd0, 0x0, 0x0, 0x4, 0xf5, 0x0, 0x0,
+    0x0, 0x2f, 0x30, 0x0, 0x0, 0x2, 0xf3, 0x0, 0x0, 0x0, 0x2f, 0x30, 0x0,
+
+    /* U+005A "Z" */
+    0x4c, 0xcc, 0xcc, 0xcc, 0x72, 0x66, 0x66, 0x6a, 0xf5, 0x0, 0x0, 0x2, 0xe8, 0x0, 0x0, 0x1,
+    0xdb, 0x0, 0x0, 0x0, 0xbd, 0x10, 0x0, 0x0, 0x8e, 0x20, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0,
+    0x3e, 0x80, 0x0, 0x0, 0x1d, 0xc3, 0x33, 0x33, 0x36, 0xff, 0xff, 0xff, 0xfc,
+
+    /* U+005B "[" */
+    0x36, 0x62, 0x8e, 0xb4, 0x8c, 0x0, 0x8c, 0x0, 0x8c, 0x0, 0x8c, 0x0, 0x8c, 0x0, 0x8c, 0x0,
+    0x8c, 0x0, 0x8c, 0x0, 0x8c, 0x0, 0x8c, 0x0, 0x8e, 0x73, 0x59, 0x94,
+
+    /* U+005C "\\" */
+    0x5a, 0x0, 0x0, 0x1, 0xf2, 0x0, 0x0, 0xb, 0x70, 0x0, 0x0, 0x6d, 0x0, 0x0, 0x1, 0xe3,
+    0x0, 0x0, 0xa, 0x80, 0x0, 0x0, 0x5d, 0x0, 0x0, 0x0, 0xe4, 0x0, 0x0, 0x9, 0x90, 0x0,
+    0x0, 0x4e, 0x0, 0x0, 0x0, 0xd5, 0x0, 0x0, 0x8, 0xa0, 0x0, 0x0, 0x3e, 0x10, 0x0, 0x0,
+    0x51,
+
+    /* U+005D "]" */
+    0x46, 0x61, 0x8b, 0xf3, 0x2, 0xf3, 0x2, 0xf3, 0x2, 0xf3, 0x2, 0xf3, 0x2, 0xf3, 0x2, 0xf3,
+    0x2, 0xf3, 0x2, 0xf3, 0x2, 0xf3, 0x2, 0xf3, 0x58, 0xf3, 0x79, 0x92,
+
+    /* U+005E "^" */
+    0x0, 0x8a, 0x0, 0x1, 0xed, 0x30, 0x7, 0x96, 0x90, 0xd, 0x31, 0xe1, 0x5b, 0x0, 0x97, 0xb5,
+    0x0, 0x3d,
+
+    /* U+005F "_" */
+    0xcc, 0xcc, 0xcc, 0xc0,
+
+    /* U+0060 "`" */
+    0x15, 0x20, 0x5, 0xe4, 0x0, 0x37,
+
+    /* U+0061 "a" */
+    0x0, 0x47, 0x73, 0x0, 0xd, 0xeb, 0xcf, 0x70, 0x4, 0x0, 0x7, 0xe1, 0x0, 0x24, 0x46, 0xf2,
+    0xa, 0xeb, 0xab, 0xf2, 0x3f, 0x20, 0x3, 0xf2, 0x2f, 0x50, 0x2b, 0xf2, 0x6, 0xde, 0xd8, 0xf2,
+
+    /* U+0062 "b" */
+    0x44, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0xb9, 0x16, 0x74, 0x0,
+    0xbc, 0xec, 0xbf, 0xb1, 0xbf, 0x40, 0x2, 0xe8, 0xbb, 0x0, 0x0, 0x8d, 0xba, 0x0, 0x0, 0x6e,
+    0xbd, 0x0, 0x0, 0xab, 0xbf, 0xa3, 0x28, 0xf4, 0xb9, 0x9e, 0xfc, 0x50,
+
+    /* U+0063 "c" */
+    0x0, 0x15, 0x75, 0x10, 0x4, 0xed, 0xbd, 0xd2, 0x1e, 0x90, 0x0, 0x82, 0x5f, 0x10, 0x0, 0x0,
+    0x6f, 0x0, 0x0, 0x0, 0x3f, 0x30, 0x0, 0x0, 0xa, 0xd5, 0x25, 0xd4, 0x1, 0x8d, 0xfd, 0x80,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x6, 0x20, 0x0, 0x0, 0x1, 0xf4, 0x0, 0x0, 0x0, 0x1f, 0x40, 0x1, 0x67,
+    0x41, 0xf4, 0x4, 0xed, 0xbe, 0xbf, 0x41, 0xe9, 0x0, 0xb, 0xf4, 0x5f, 0x10, 0x0, 0x3f, 0x46,
+    0xf0, 0x0, 0x1, 0xf4, 0x3f, 0x40, 0x0, 0x5f, 0x40, 0xbd, 0x42, 0x5e, 0xf4, 0x1, 0x9e, 0xfd,
+    0x5f, 0x40,
+
+    /* U+0065 "e" */
+    0x0, 0x16, 0x74, 0x0, 0x4, 0xec, 0xae, 0xb1, 0x1e, 0x80, 0x1, 0xc8, 0x5f, 0x43, 0x33, 0x8d,
+    0x6f, 0xbb, 0xbb, 0xbb, 0x3f, 0x30, 0x0, 0x0, 0xb, 0xd5, 0x24, 0xb3, 0x1, 0x8d, 0xfe, 0x91,
+
+    /* U+0066 "f" */
+    0x0, 0x26, 0x61, 0x2, 0xec, 0xb3, 0x7, 0xd0, 0x0, 0x5b, 0xd6, 0x60, 0x8d, 0xea, 0xa0, 0x8,
+    0xc0, 0x0, 0x8, 0xc0, 0x0, 0x8, 0xc0, 0x0, 0x8, 0xc0, 0x0, 0x8, 0xc0, 0x0, 0x8, 0xc0,
+    0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x16, 0x75, 0x6, 0x20, 0x5e, 0xdb, 0xdc, 0xe6, 0x1e, 0x90, 0x0, 0x9f, 0x65, 0xf1, 0x0,
+    0x1, 0xf6, 0x5f, 0x0, 0x0, 0xf, 0x62, 0xf6, 0x0, 0x6, 0xf6, 0x7, 0xfa, 0x8a, 0xdf, 0x60,
+    0x4, 0x9a, 0x82, 0xf5, 0x3, 0x0, 0x0, 0x5f, 0x20, 0xcd, 0x97, 0x9f, 0x90, 0x1, 0x69, 0xa9,
+    0x50, 0x0,
+
+    /* U+0068 "h" */
+    0x44, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0xb9, 0x26, 0x74, 0x0,
+    0xbc, 0xec, 0xcf, 0x90, 0xbf, 0x40, 0x7, 0xf2, 0xbb, 0x0, 0x1, 0xf4, 0xb9, 0x0, 0x0, 0xf5,
+    0xb9, 0x0, 0x0, 0xf5, 0xb9, 0x0, 0x0, 0xf5, 0xb9, 0x0, 0x0, 0xf5,
+
+    /* U+0069 "i" */
+    0x65, 0xdb, 0x11, 0x54, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
+
+    /* U+006A "j" */
+    0x0, 0x5, 0x60, 0x0, 0xcc, 0x0, 0x1, 0x10, 0x0, 0x44, 0x0, 0xa, 0xa0, 0x0, 0xaa, 0x0,
+    0xa, 0xa0, 0x0, 0xaa, 0x0, 0xa, 0xa0, 0x0, 0xaa, 0x0, 0xa, 0xa0, 0x0, 0xaa, 0x19, 0x7f,
+    0x61, 0x9a, 0x60,
+
+    /* U+006B "k" */
+    0x44, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x4, 0x61,
+    0xb9, 0x0, 0x5f, 0x50, 0xb9, 0x7, 0xf5, 0x0, 0xb9, 0x8f, 0x60, 0x0, 0xbe, 0xed, 0xc1, 0x0,
+    0xbe, 0x32, 0xe9, 0x0, 0xb9, 0x0, 0x4f, 0x60, 0xb9, 0x0, 0x7, 0xf3,
+
+    /* U+006C "l" */
+    0x44, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xb9,
+
+    /* U+006D "m" */
+    0x54, 0x26, 0x73, 0x0, 0x57, 0x50, 0xb, 0xce, 0xcd, 0xf7, 0xdd, 0xbe, 0xc1, 0xbf, 0x30, 0x9,
+    0xfa, 0x0, 0x3f, 0x6b, 0xb0, 0x0, 0x4f, 0x30, 0x0, 0xc9, 0xb9, 0x0, 0x4, 0xf2, 0x0, 0xb,
+    0x9b, 0x90, 0x0, 0x4f, 0x20, 0x0, 0xb9, 0xb9, 0x0, 0x4, 0xf2, 0x0, 0xb, 0x9b, 0x90, 0x0,
+    0x4f, 0x20, 0x0, 0xb9,
+
+    /* U+006E "n" */
+    0x54, 0x26, 0x74, 0x0, 0xbc, 0xec, 0xcf, 0x90, 0xbf, 0x40, 0x7, 0xf2, 0xbb, 0x0, 0x1, 0xf4,
+    0xb9, 0x0, 0x0, 0xf5, 0xb9, 0x0, 0x0, 0xf5, 0xb9, 0x0, 0x0, 0xf5, 0xb9, 0x0, 0x0, 0xf5,
+
+    /* U+006F "o" */
+    0x0, 0x15, 0x75, 0x10, 0x0, 0x4e, 0xdb, 0xed, 0x30, 0x1e, 0x90, 0x0, 0xbd, 0x5, 0xf1, 0x0,
+    0x3, 0xf3, 0x6f, 0x0, 0x0, 0x1f, 0x43, 0xf4, 0x0, 0x5, 0xf2, 0xb, 0xd4, 0x25, 0xe9, 0x0,
+    0x18, 0xdf, 0xd8, 0x0,
+
+    /* U+0070 "p" */
+    0x54, 0x16, 0x74, 0x0, 0xbc, 0xec, 0xbf, 0xb1, 0xbf, 0x50, 0x2, 0xe8, 0xbb, 0x0, 0x0, 0x8d,
+    0xba, 0x0, 0x0, 0x6e, 0xbd, 0x0, 0x0, 0xab, 0xbf, 0xa3, 0x28, 0xf4, 0xba, 0x9e, 0xfc, 0x50,
+    0xb9, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x76, 0x0, 0x0, 0x0,
+
+    /* U+0071 "q" */
+    0x0, 0x16, 0x74, 0x6, 0x20, 0x4e, 0xdb, 0xeb, 0xf4, 0x1e, 0x90, 0x1, 0xbf, 0x45, 0xf1, 0x0,
+    0x3, 0xf4, 0x6f, 0x0, 0x0, 0x1f, 0x43, 0xf4, 0x0, 0x5, 0xf4, 0xb, 0xd4, 0x25, 0xef, 0x40,
+    0x19, 0xef, 0xd6, 0xf4, 0x0, 0x0, 0x0, 0x1f, 0x40, 0x0, 0x0, 0x1, 0xf4, 0x0, 0x0, 0x0,
+    0x19, 0x30,
+
+    /* U+0072 "r" */
+    0x54, 0x26, 0x2b, 0xbe, 0xd3, 0xbf, 0x50, 0xb, 0xb0, 0x0, 0xb9, 0x0, 0xb, 0x90, 0x0, 0xb9,
+    0x0, 0xb, 0x90, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x57, 0x63, 0x1, 0xdd, 0xac, 0xf2, 0x5e, 0x10, 0x1, 0x4, 0xf9, 0x41, 0x0, 0x5, 0xbe,
+    0xfb, 0x20, 0x0, 0x2, 0xd8, 0x48, 0x32, 0x4e, 0x74, 0xbe, 0xfd, 0x80,
+
+    /* U+0074 "t" */
+    0x0, 0x10, 0x0, 0x8, 0xc0, 0x0, 0x5b, 0xd6, 0x60, 0x8d, 0xea, 0xa0, 0x8, 0xc0, 0x0, 0x8,
+    0xc0, 0x0, 0x8, 0xc0, 0x0, 0x8, 0xc0, 0x0, 0x6, 0xe3, 0x31, 0x1, 0xae, 0xe4,
+
+    /* U+0075 "u" */
+    0x53, 0x0, 0x1, 0x61, 0xc8, 0x0, 0x2, 0xf3, 0xc8, 0x0, 0x2, 0xf3, 0xc8, 0x0, 0x2, 0xf3,
+    0xc8, 0x0, 0x3, 0xf3, 0xba, 0x0, 0x6, 0xf3, 0x7f, 0x62, 0x5e, 0xf3, 0x8, 0xdf, 0xd6, 0xf3,
+
+    /* U+0076 "v" */
+    0x63, 0x0, 0x0, 0x45, 0x9b, 0x0, 0x0, 0xd7, 0x3f, 0x30, 0x5, 0xe1, 0xb, 0x90, 0xb, 0x80,
+    0x5, 0xf1, 0x3f, 0x20, 0x0, 0xd7, 0x9a, 0x0, 0x0, 0x7e, 0xf4, 0x0, 0x0, 0x1e, 0xc0, 0x0,
+
+    /* U+0077 "w" */
+    0x53, 0x0, 0x2, 0x60, 0x0, 0x5, 0x39, 0xa0, 0x0, 0x9f, 0x30, 0x1, 0xf2, 0x3f, 0x10, 0x1e,
+    0xd9, 0x0, 0x6c, 0x0, 0xc6, 0x5, 0xd4, 0xe0, 0xc, 0x60, 0x7, 0xc0, 0xb7, 0xd, 0x52, 0xf1,
+    0x0, 0x2f, 0x4f, 0x20, 0x8b, 0x8a, 0x0, 0x0, 0xbe, 0xb0, 0x2, 0xfe, 0x40, 0x0, 0x5, 0xf5,
+    0x0, 0xb, 0xe0, 0x0,
+
+    /* U+0078 "x" */
+    0x36, 0x0, 0x2, 0x61, 0x1d, 0x80, 0xc, 0xa0, 0x3, 0xf5, 0x8d, 0x10, 0x0, 0x6e, 0xe3, 0x0,
+    0x0, 0x2f, 0xc0, 0x0, 0x1, 0xc9, 0xd9, 0x0, 0xa, 0xc0, 0x3e, 0x50, 0x6e, 0x20, 0x6, 0xe3,
+
+    /* U+0079 "y" */
+    0x6, 0x30, 0x0, 0x4, 0x50, 0x9c, 0x0, 0x0, 0xd6, 0x3, 0xf3, 0x0, 0x5e, 0x10, 0xb, 0xa0,
+    0xb, 0x80, 0x0, 0x4f, 0x23, 0xf2, 0x0, 0x0, 0xd8, 0x9a, 0x0, 0x0, 0x6, 0xee, 0x30, 0x0,
+    0x0, 0x1e, 0xb0, 0x0, 0x0, 0x1, 0xe5, 0x0, 0x1, 0xb7, 0xcb, 0x0, 0x0, 0x17, 0xa8, 0x10,
+    0x0, 0x0,
+
+    /* U+007A "z" */
+    0x26, 0x66, 0x66, 0x44, 0xaa, 0xab, 0xf8, 0x0, 0x0, 0xbc, 0x0, 0x0, 0x8e, 0x20, 0x0, 0x5f,
+    0x40, 0x0, 0x3e, 0x60, 0x0, 0x1d, 0xa2, 0x22, 0x16, 0xff, 0xff, 0xfc,
+
+    /* U+007B "{" */
+    0x0, 0x5, 0x40, 0xb, 0xe7, 0x1, 0xf5, 0x0, 0x1f, 0x40, 0x1, 0xf4, 0x0, 0x1f, 0x40, 0x18,
+    0xf2, 0x2, 0xcd, 0x10, 0x2, 0xf4, 0x0, 0x1f, 0x40, 0x1, 0xf4, 0x0, 0x1f, 0x40, 0x0, 0xdc,
+    0x50, 0x2, 0x86,
+
+    /* U+007C "|" */
+    0x34, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x57,
+
+    /* U+007D "}" */
+    0x44, 0x0, 0x8, 0xea, 0x0, 0x6, 0xf0, 0x0, 0x5f, 0x0, 0x5, 0xf0, 0x0, 0x5f, 0x0, 0x3,
+    0xf8, 0x10, 0x2e, 0xc1, 0x5, 0xf1, 0x0, 0x5f, 0x0, 0x5, 0xf0, 0x0, 0x5f, 0x0, 0x5d, 0xc0,
+    0x7, 0x82, 0x0,
+
+    /* U+007E "~" */
+    0x0, 0x10, 0x0, 0x0, 0x9, 0xfd, 0x30, 0xa4, 0x1d, 0x15, 0xdc, 0xd0, 0x12, 0x0, 0x14, 0x10,
+
+    /* U+00A0 "" */
+
+    /* U+00A1 "¡" */
+    0x53, 0xeb, 0x32, 0x32, 0xa7, 0xb7, 0xc8, 0xc9, 0xd9, 0xda, 0x11,
+
+    /* U+00A2 "¢" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x1, 0xd0, 0x0, 0x0, 0x16, 0xe5, 0x10, 0x4, 0xee, 0xee, 0xd2,
+    0x1e, 0xa1, 0xd0, 0x82, 0x5f, 0x11, 0xd0, 0x0, 0x6f, 0x1, 0xd0, 0x0, 0x3f, 0x41, 0xd0, 0x0,
+    0xb, 0xd5, 0xd5, 0xe4, 0x1, 0x9e, 0xfe, 0x80, 0x0, 0x1, 0xd0, 0x0, 0x0, 0x0, 0x80, 0x0,
+
+    /* U+00A3 "£" */
+    0x0, 0x4, 0xad, 0xdb, 0x50, 0x5, 0xfa, 0x66, 0x98, 0x0, 0xda, 0x0, 0x0, 0x0, 0xf, 0x60,
+    0x0, 0x0, 0x36, 0xf9, 0x55, 0x50, 0x5, 0x9f, 0xb8, 0x88, 0x0, 0x1, 0xf5, 0x0, 0x0, 0x0,
+    0x1f, 0x50, 0x0, 0x0, 0x24, 0xf7, 0x33, 0x33, 0x29, 0xff, 0xff, 0xff, 0xf9,
+
+    /* U+00A4 "¤" */
+    0x39, 0x0, 0x21, 0x1, 0xa1, 0x2d, 0xbd, 0xff, 0xcc, 0xb1, 0x5, 0xe5, 0x1, 0x7f, 0x20, 0xb,
+    0x70, 0x0, 0xa, 0x80, 0xd, 0x40, 0x0, 0x6, 0xa0, 0xb, 0x70, 0x0, 0x9, 0x80, 0x5, 0xe5,
+    0x0, 0x6f, 0x20, 0x1c, 0xce, 0xee, 0xdd, 0xa0, 0x4a, 0x0, 0x32, 0x1, 0xb2,
+
+    /* U+00A5 "¥" */
+    0x99, 0x0, 0x0, 0x0, 0x98, 0x2e, 0x50, 0x0, 0x6, 0xe2, 0x6, 0xe2, 0x0, 0x2e, 0x50, 0x0,
+    0xac, 0x0, 0xc9, 0x0, 0x0, 0x1d, 0x88, 0xd1, 0x0, 0x4, 0x69, 0xff, 0x86, 0x30, 0x5, 0x66,
+    0xdc, 0x66, 0x40, 0x5, 0x77, 0xdc, 0x77, 0x40, 0x4, 0x55, 0xdc, 0x55, 0x30, 0x0, 0x0, 0xba,
+    0x0, 0x0,
+
+    /* U+00A6 "¦" */
+    0x34, 0x8b, 0x8b, 0x8b, 0x8b, 0x45, 0x0, 0x0, 0x12, 0x8b, 0x8b, 0x8b, 0x8b, 0x57,
+
+    /* U+00A7 "§" */
+    0x2, 0x9c, 0xca, 0x30, 0xd9, 0x44, 0x84, 0x2f, 0x10, 0x0, 0x0, 0xcd, 0x73, 0x0, 0x2e, 0x89,
+    0xec, 0x17, 0xb0, 0x1, 0xc7, 0x5e, 0x51, 0xd, 0x60, 0x6c, 0xfe, 0xc0, 0x0, 0x1, 0x7e, 0x12,
+    0x10, 0x1, 0xf2, 0x6f, 0xcb, 0xe9, 0x0, 0x15, 0x63, 0x0,
+
+    /* U+00A8 "¨" */
+    0x10, 0x1, 0xb, 0x82, 0xf2, 0x21, 0x2, 0x0,
+
+    /* U+00A9 "©" */
+    0x0, 0x5, 0x99, 0xa7, 0x10, 0x0, 0xa, 0x60, 0x0, 0x3a, 0x20, 0x8, 0x31, 0x8b, 0xa3, 0x1a,
+    0x1, 0x90, 0xba, 0x36, 0xa0, 0x64, 0x46, 0x2e, 0x0, 0x0, 0x3, 0x74, 0x62, 0xe0, 0x0, 0x0,
+    0x28, 0x29, 0xc, 0x70, 0x37, 0x5, 0x50, 0x92, 0x2b, 0xed, 0x50, 0xb0, 0x1, 0xa3, 0x0, 0x1,
+    0xa3, 0x0, 0x1, 0x89, 0x99, 0x92, 0x0,
+
+    /* U+00AA "ª" */
+    0x4, 0x65, 0x2, 0x85, 0xa8, 0x6, 0x8a, 0xb6, 0x91, 0x5b, 0x3c, 0xaa, 0xb0,
+
+    /* U+00AB "«" */
+    0x0, 0x34, 0x5, 0x30, 0x2e, 0x45, 0xd1, 0xb, 0x72, 0xe3, 0x2, 0xf2, 0x7c, 0x0, 0x7, 0xc1,
+    0xb7, 0x0, 0xa, 0x81, 0xd3,
+
+    /* U+00AC "¬" */
+    0x7, 0x77, 0x77, 0x71, 0x1a, 0xaa, 0xaa, 0xf3, 0x0, 0x0, 0x0, 0xf3, 0x0, 0x0, 0x0, 0xf3,
+    0x0, 0x0, 0x0, 0x20,
+
+    /* U+00AD "" */
+    0x16, 0x66, 0x42, 0xbb, 0xb6,
+
+    /* U+00AE "®" */
+    0x0, 0x5, 0x99, 0xa7, 0x10, 0x0, 0xa, 0x60, 0x0, 0x3a, 0x20, 0x8, 0x34, 0xba, 0x93, 0x1a,
+    0x1, 0x90, 0x69, 0x24, 0xd0, 0x64, 0x46, 0x6, 0x80, 0xd, 0x13, 0x74, 0x60, 0x6d, 0xac, 0x80,
+    0x28, 0x29, 0x6, 0x92, 0xa5, 0x5, 0x50, 0x92, 0x58, 0x1, 0xb1, 0xb0, 0x1, 0xa3, 0x0, 0x1,
+    0xa3, 0x0, 0x1, 0x89, 0x99, 0x92, 0x0,
+
+    /* U+00AF "¯" */
+    0x1c, 0xcc, 0xc6,
+
+    /* U+00B0 "°" */
+    0x5, 0xbb, 0x40, 0x2b, 0x1, 0xc1, 0x57, 0x0, 0x93, 0x1c, 0x34, 0xc0, 0x3, 0x98, 0x20,
+
+    /* U+00B1 "±" */
+    0x0, 0x4, 0x60, 0x0, 0x0, 0x8, 0xa0, 0x0, 0x2, 0x29, 0xb2, 0x20, 0x1f, 0xff, 0xff, 0xf3,
+    0x0, 0x8, 0xa0, 0x0, 0x0, 0x8, 0xa0, 0x0, 0x0, 0x3, 0x40, 0x0, 0x2, 0x22, 0x22, 0x20,
+    0x1f, 0xff, 0xff, 0xf3,
+
+    /* U+00B2 "²" */
+    0x4, 0x65, 0x10, 0x5b, 0x69, 0xc0, 0x0, 0x1, 0xe0, 0x0, 0x1b, 0x70, 0x1, 0xc6, 0x0, 0x2d,
+    0xa6, 0x62, 0x26, 0x66, 0x62,
+
+    /* U+00B3 "³" */
+    0x36, 0x66, 0x60, 0x36, 0x6b, 0xc0, 0x0, 0x4c, 0x10, 0x0, 0x9c, 0x90, 0x0, 0x0, 0xb4, 0x69,
+    0x67, 0xd2, 0x4, 0x76, 0x10,
+
+    /* U+00B4 "´" */
+    0x1, 0x53, 0x1b, 0xa1, 0x46, 0x0,
+
+    /* U+00B5 "µ" */
+    0x54, 0x0, 0x1, 0x62, 0xb9, 0x0, 0x1, 0xf4, 0xb9, 0x0, 0x1, 0xf4, 0xb9, 0x0, 0x1, 0xf4,
+    0xb9, 0x0, 0x2, 0xf4, 0xbb, 0x0, 0x5, 0xf4, 0xbf, 0x72, 0x5d, 0xf4, 0xbb, 0xcf, 0xd6, 0xf4,
+    0xb9, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0x76, 0x0, 0x0, 0x0,
+
+    /* U+00B6 "¶" */
+    0x0, 0x46, 0x66, 0x64, 0x2d, 0xff, 0xba, 0xd9, 0x9f, 0xff, 0x40, 0x89, 0xaf, 0xff, 0x40, 0x89,
+    0x4f, 0xff, 0x40, 0x89, 0x3, 0x8e, 0x40, 0x89, 0x0, 0xc, 0x40, 0x89, 0x0, 0xc, 0x40, 0x89,
+    0x0, 0xc, 0x40, 0x89, 0x0, 0xc, 0x40, 0x89, 0x0, 0xc, 0x40, 0x89, 0x0, 0xc, 0x40, 0x89,
+    0x0, 0x4, 0x10, 0x23,
+
+    /* U+00B7 "·" */
+    0xa7, 0xea, 0x10,
+
+    /* U+00B8 "¸" */
+    0x0, 0x10, 0x5, 0x90, 0x1, 0x97, 0x3b, 0xd4,
+
+    /* U+00B9 "¹" */
+    0x46, 0x40, 0x5, 0x8b, 0x0, 0x4, 0xb0, 0x0, 0x4b, 0x0, 0x4, 0xb0, 0x5, 0x8d, 0x61, 0x56,
+    0x66, 0x10,
+
+    /* U+00BA "º" */
+    0x2, 0x66, 0x10, 0x2d, 0x67, 0xd1, 0x87, 0x0, 0x95, 0x69, 0x0, 0xb4, 0xa, 0xcd, 0x80,
+
+    /* U+00BB "»" */
+    0x25, 0x4, 0x30, 0x1, 0xc6, 0x3e, 0x20, 0x3, 0xe3, 0x7c, 0x0, 0xb, 0x82, 0xe3, 0x7, 0xc1,
+    0xb7, 0x3, 0xd2, 0x7b, 0x0,
+
+    /* U+00BC "¼" */
+    0x9c, 0x90, 0x0, 0x0, 0x3a, 0x0, 0x0, 0x4, 0xb0, 0x0, 0x0, 0xc4, 0x0, 0x0, 0x4, 0xb0,
+    0x0, 0x8, 0x80, 0x0, 0x0, 0x4, 0xb0, 0x0, 0x3c, 0x0, 0x0, 0x0, 0x4, 0xb0, 0x1, 0xc3,
+    0x0, 0x94, 0x0, 0xad, 0xec, 0x29, 0x70, 0x6, 0xa0, 0x0, 0x0, 0x0, 0x4c, 0x0, 0x3d, 0x15,
+    0x0, 0x0, 0x1, 0xd2, 0x1, 0xd6, 0x3e, 0x30, 0x0, 0x9, 0x70, 0x2, 0x99, 0x9f, 0x91, 0x0,
+    0x4b, 0x0, 0x0, 0x0, 0xe, 0x0,
+
+    /* U+00BD "½" */
+    0x9c, 0x90, 0x0, 0x0, 0x3a, 0x0, 0x0, 0x4b, 0x0, 0x0, 0xc, 0x40, 0x0, 0x4, 0xb0, 0x0,
+    0x8, 0x80, 0x0, 0x0, 0x4b, 0x0, 0x3, 0xc0, 0x0, 0x0, 0x4, 0xb0, 0x1, 0xc3, 0x7c, 0xc9,
+    0x1a, 0xde, 0xc2, 0x97, 0x6, 0x10, 0xa6, 0x0, 0x0, 0x4c, 0x0, 0x0, 0xb, 0x40, 0x0, 0x1d,
+    0x20, 0x0, 0x1b, 0x70, 0x0, 0x9, 0x70, 0x0, 0x1c, 0x60, 0x0, 0x4, 0xb0, 0x0, 0xc, 0xec,
+    0xc9,
+
+    /* U+00BE "¾" */
+    0x5c, 0xcc, 0xc1, 0x0, 0x3, 0xa0, 0x0, 0x0, 0x0, 0xa6, 0x0, 0x0, 0xc4, 0x0, 0x0, 0x0,
+    0x8c, 0x20, 0x0, 0x88, 0x0, 0x0, 0x0, 0x4, 0x7d, 0x20, 0x3c, 0x0, 0x0, 0x0, 0x21, 0x0,
+    0xb4, 0x1c, 0x30, 0x9, 0x40, 0x5, 0xdc, 0xd9, 0x9, 0x70, 0x6, 0xa0, 0x0, 0x0, 0x10, 0x4,
+    0xc0, 0x3, 0xd1, 0x50, 0x0, 0x0, 0x1, 0xd2, 0x1, 0xd6, 0x3e, 0x30, 0x0, 0x0, 0x97, 0x0,
+    0x29, 0x99, 0xf9, 0x10, 0x0, 0x4b, 0x0, 0x0, 0x0, 0xe, 0x0,
+
+    /* U+00BF "¿" */
+    0x0, 0x35, 0x0, 0x0, 0xb, 0xf0, 0x0, 0x0, 0x23, 0x0, 0x0, 0x3, 0x40, 0x0, 0x0, 0xc9,
+    0x0, 0x0, 0xad, 0x20, 0x0, 0x9d, 0x10, 0x0, 0xe, 0x60, 0x0, 0x0, 0xdc, 0x21, 0x3b, 0x83,
+    0xcf, 0xff, 0xa2, 0x0, 0x12, 0x10, 0x0,
+
+    /* U+00C0 "À" */
+    0x0, 0x16, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5d, 0x40, 0x0, 0x0, 0x0, 0x0, 0x26, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xb0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x9b, 0x8d, 0x0,
+    0x0, 0x0, 0x1f, 0x41, 0xf5, 0x0, 0x0, 0x8, 0xd0, 0x9, 0xb0, 0x0, 0x1, 0xe6, 0x0, 0x3f,
+    0x30, 0x0, 0x6f, 0x99, 0x99, 0xea, 0x0, 0xd, 0xb8, 0x88, 0x8a, 0xf2, 0x5, 0xf2, 0x0, 0x0,
+    0xd, 0x90, 0xca, 0x0, 0x0, 0x0, 0x6e, 0x10,
+
+    /* U+00C1 "Á" */
+    0x0, 0x0, 0x2, 0x63, 0x0, 0x0, 0x0, 0x2, 0xd7, 0x0, 0x0, 0x0, 0x0, 0x44, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xb0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x9b, 0x8d, 0x0,
+    0x0, 0x0, 0x1f, 0x41, 0xf5, 0x0, 0x0, 0x8, 0xd0, 0x9, 0xb0, 0x0, 0x1, 0xe6, 0x0, 0x3f,
+    0x30, 0x0, 0x6f, 0x99, 0x99, 0xea, 0x0, 0xd, 0xb8, 0x88, 0x8a, 0xf2, 0x5, 0xf2, 0x0, 0x0,
+    0xd, 0x90, 0xca, 0x0, 0x0, 0x0, 0x6e, 0x10,
+
+    /* U+00C2 "Â" */
+    0x0, 0x0, 0x56, 0x0, 0x0, 0x0, 0x0, 0x7c, 0xaa, 0x0, 0x0, 0x0, 0x16, 0x10, 0x53, 0x0,
+    0x0, 0x0, 0x9, 0xb0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x9b, 0x8d, 0x0,
+    0x0, 0x0, 0x1f, 0x41, 0xf5, 0x0, 0x0, 0x8, 0xd0, 0x9, 0xb0, 0x0, 0x1, 0xe6, 0x0, 0x3f,
+    0x30, 0x0, 0x6f, 0x99, 0x99, 0xea, 0x0, 0xd, 0xb8, 0x88, 0x8a, 0xf2, 0x5, 0xf2, 0x0, 0x0,
+    0xd, 0x90, 0xca, 0x0, 0x0, 0x0, 0x6e, 0x10,
+
+    /* U+00C3 "Ã" */
+    0x0, 0x3, 0x50, 0x22, 0x0, 0x0, 0x1, 0xc8, 0xbb, 0x40, 0x0, 0x0, 0x12, 0x3, 0x40, 0x0,
+    0x0, 0x0, 0x9, 0xb0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x9b, 0x8d, 0x0,
+    0x0, 0x0, 0x1f, 0x41, 0xf5, 0x0, 0x0, 0x8, 0xd0, 0x9, 0xb0, 0x0, 0x1, 0xe6, 0x0, 0x3f,
+    0x30, 0x0, 0x6f, 0x99, 0x99, 0xea, 0x0, 0xd, 0xb8, 0x88, 0x8a, 0xf2, 0x5, 0xf2, 0x0, 0x0,
+    0xd, 0x90, 0xca, 0x0, 0x0, 0x0, 0x6e, 0x10,
+
+    /* U+00C4 "Ä" */
+    0x0, 0x2, 0x10, 0x30, 0x0, 0x0, 0x0, 0xc6, 0x3f, 0x10, 0x0, 0x0, 0x1, 0x0, 0x10, 0x0,
+    0x0, 0x0, 0x9, 0xb0, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x9b, 0x8d, 0x0,
+    0x0, 0x0, 0x1f, 0x41, 0xf5, 0x0, 0x0, 0x8, 0xd0, 0x9, 0xb0, 0x0, 0x1, 0xe6, 0x0, 0x3f,
+    0x30, 0x0, 0x6f, 0x99, 0x99, 0xea, 0x0, 0xd, 0xb8, 0x88, 0x8a, 0xf2, 0x5, 0xf2, 0x0, 0x0,
+    0xd, 0x90, 0xca, 0x0, 0x0, 0x0, 0x6e, 0x10,
+
+    /* U+00C5 "Å" */
+    0x0, 0x0, 0x89, 0x20, 0x0, 0x0, 0x0, 0x55, 0x19, 0x0, 0x0, 0x0, 0x3, 0x97, 0x60, 0x0,
+    0x0, 0x0, 0x2, 0x30, 0x0, 0x0, 0x0, 0x0, 0x9b, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe6, 0x0,
+    0x0, 0x0, 0x9, 0xb8, 0xd0, 0x0, 0x0, 0x1, 0xf4, 0x1f, 0x50, 0x0, 0x0, 0x8d, 0x0, 0x9b,
+    0x0, 0x0, 0x1e, 0x60, 0x3, 0xf3, 0x0, 0x6, 0xf9, 0x99, 0x9e, 0xa0, 0x0, 0xdb, 0x88, 0x88,
+    0xaf, 0x20, 0x5f, 0x20, 0x0, 0x0, 0xd9, 0xc, 0xa0, 0x0, 0x0, 0x6, 0xe1,
+
+    /* U+00C6 "Æ" */
+    0x0, 0x0, 0x5, 0xcc, 0xcc, 0xcc, 0xc8, 0x0, 0x0, 0x1d, 0xbf, 0x86, 0x66, 0x64, 0x0, 0x0,
+    0x8c, 0x4f, 0x20, 0x0, 0x0, 0x0, 0x2, 0xf4, 0x4f, 0x20, 0x0, 0x0, 0x0, 0xb, 0xa0, 0x4f,
+    0xa9, 0x99, 0x91, 0x0, 0x5e, 0x20, 0x4f, 0xa9, 0x99, 0x91, 0x1, 0xdd, 0x99, 0xaf, 0x20, 0x0,
+    0x0, 0x8, 0xd8, 0x88, 0xaf, 0x20, 0x0, 0x0, 0x2f, 0x50, 0x0, 0x4f, 0x53, 0x33, 0x33, 0xbb,
+    0x0, 0x0, 0x4f, 0xff, 0xff, 0xfd,
+
+    /* U+00C7 "Ç" */
+    0x0, 0x6, 0xbd, 0xda, 0x40, 0x1, 0xbf, 0x96, 0x6a, 0xf5, 0x9, 0xe3, 0x0, 0x0, 0x40, 0x1f,
+    0x70, 0x0, 0x0, 0x0, 0x4f, 0x20, 0x0, 0x0, 0x0, 0x4f, 0x20, 0x0, 0x0, 0x0, 0x2f, 0x50,
+    0x0, 0x0, 0x0, 0xb, 0xd1, 0x0, 0x0, 0x20, 0x1, 0xdd, 0x63, 0x37, 0xe5, 0x0, 0x18, 0xdf,
+    0xfc, 0x60, 0x0, 0x0, 0xd, 0x20, 0x0, 0x0, 0x0, 0x4, 0xe0, 0x0, 0x0, 0x0, 0xac, 0xa0,
+    0x0,
+
+    /* U+00C8 "È" */
+    0x2, 0x62, 0x0, 0x0, 0x0, 0x7d, 0x20, 0x0, 0x0, 0x3, 0x50, 0x0, 0x6c, 0xcc, 0xcc, 0xc5,
+    0x8e, 0x66, 0x66, 0x62, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x8e, 0x99, 0x99, 0x70,
+    0x8e, 0x99, 0x99, 0x70, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x33, 0x33, 0x32,
+    0x8f, 0xff, 0xff, 0xf9,
+
+    /* U+00C9 "É" */
+    0x0, 0x0, 0x36, 0x10, 0x0, 0x3, 0xd5, 0x0, 0x0, 0x5, 0x20, 0x0, 0x6c, 0xcc, 0xcc, 0xc5,
+    0x8e, 0x66, 0x66, 0x62, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x8e, 0x99, 0x99, 0x70,
+    0x8e, 0x99, 0x99, 0x70, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x33, 0x33, 0x32,
+    0x8f, 0xff, 0xff, 0xf9,
+
+    /* U+00CA "Ê" */
+    0x0, 0x6, 0x50, 0x0, 0x0, 0x9a, 0xb8, 0x0, 0x2, 0x50, 0x6, 0x10, 0x6c, 0xcc, 0xcc, 0xc5,
+    0x8e, 0x66, 0x66, 0x62, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x8e, 0x99, 0x99, 0x70,
+    0x8e, 0x99, 0x99, 0x70, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x33, 0x33, 0x32,
+    0x8f, 0xff, 0xff, 0xf9,
+
+    /* U+00CB "Ë" */
+    0x0, 0x20, 0x2, 0x0, 0x0, 0xe4, 0x5d, 0x0, 0x0, 0x10, 0x1, 0x0, 0x6c, 0xcc, 0xcc, 0xc5,
+    0x8e, 0x66, 0x66, 0x62, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x8e, 0x99, 0x99, 0x70,
+    0x8e, 0x99, 0x99, 0x70, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x0, 0x8d, 0x33, 0x33, 0x32,
+    0x8f, 0xff, 0xff, 0xf9,
+
+    /* U+00CC "Ì" */
+    0x16, 0x30, 0x4, 0xd5, 0x0, 0x26, 0x0, 0x6a, 0x0, 0x8d, 0x0, 0x8d, 0x0, 0x8d, 0x0, 0x8d,
+    0x0, 0x8d, 0x0, 0x8d, 0x0, 0x8d, 0x0, 0x8d, 0x0, 0x8d,
+
+    /* U+00CD "Í" */
+    0x1, 0x63, 0x2c, 0x80, 0x44, 0x0, 0x6a, 0x0, 0x8d, 0x0, 0x8d, 0x0, 0x8d, 0x0, 0x8d, 0x0,
+    0x8d, 0x0, 0x8d, 0x0, 0x8d, 0x0, 0x8d, 0x0, 0x8d, 0x0,
+
+    /* U+00CE "Î" */
+    0x0, 0x46, 0x0, 0x6, 0xc9, 0xb1, 0x16, 0x10, 0x53, 0x0, 0x6a, 0x0, 0x0, 0x8d, 0x0, 0x0,
+    0x8d, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x8d,
+    0x0, 0x0, 0x8d, 0x0, 0x0, 0x8d, 0x0,
+
+    /* U+00CF "Ï" */
+    0x21, 0x3, 0xb, 0x72, 0xf1, 0x10, 0x1, 0x0, 0x6a, 0x0, 0x8, 0xd0, 0x0, 0x8d, 0x0, 0x8,
+    0xd0, 0x0, 0x8d, 0x0, 0x8, 0xd0, 0x0, 0x8d, 0x0, 0x8, 0xd0, 0x0, 0x8d, 0x0, 0x8, 0xd0,
+    0x0,
+
+    /* U+00D0 "Ð" */
+    0x5, 0xcc, 0xcc, 0xb8, 0x20, 0x0, 0x6f, 0x66, 0x68, 0xcf, 0x60, 0x6, 0xf0, 0x0, 0x0, 0x7f,
+    0x40, 0x6f, 0x0, 0x0, 0x0, 0xbb, 0x7e, 0xf8, 0x86, 0x0, 0x7, 0xe7, 0xff, 0x88, 0x60, 0x0,
+    0x7e, 0x6, 0xf0, 0x0, 0x0, 0xa, 0xc0, 0x6f, 0x0, 0x0, 0x4, 0xf6, 0x6, 0xf3, 0x33, 0x59,
+    0xf9, 0x0, 0x6f, 0xff, 0xfe, 0xb5, 0x0,
+
+    /* U+00D1 "Ñ" */
+    0x0, 0x5, 0x20, 0x40, 0x0, 0x7, 0x9b, 0x8c, 0x0, 0x0, 0x30, 0x4, 0x10, 0x6, 0xb1, 0x0,
+    0x0, 0x6b, 0x8f, 0xa0, 0x0, 0x8, 0xd8, 0xff, 0x70, 0x0, 0x8d, 0x8d, 0x7f, 0x40, 0x8, 0xd8,
+    0xd0, 0xae, 0x20, 0x8d, 0x8d, 0x1, 0xcc, 0x18, 0xd8, 0xd0, 0x2, 0xea, 0x8d, 0x8d, 0x0, 0x4,
+    0xfd, 0xd8, 0xd0, 0x0, 0x7, 0xfd, 0x8d, 0x0, 0x0, 0xa, 0xd0,
+
+    /* U+00D2 "Ò" */
+    0x0, 0x2, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7d, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3, 0x40,
+    0x0, 0x0, 0x0, 0x5, 0xbd, 0xda, 0x40, 0x0, 0x0, 0xbf, 0x96, 0x6a, 0xf8, 0x0, 0x9, 0xe3,
+    0x0, 0x0, 0x6f, 0x50, 0x1f, 0x70, 0x0, 0x0, 0xa, 0xc0, 0x4f, 0x20, 0x0, 0x0, 0x6, 0xf0,
+    0x4f, 0x20, 0x0, 0x0, 0x5, 0xf1, 0x2f, 0x50, 0x0, 0x0, 0x9, 0xd0, 0xa, 0xd1, 0x0, 0x0,
+    0x3f, 0x70, 0x1, 0xdd, 0x63, 0x37, 0xeb, 0x0, 0x0, 0x18, 0xdf, 0xec, 0x70, 0x0,
+
+    /* U+00D3 "Ó" */
+    0x0, 0x0, 0x0, 0x36, 0x10, 0x0, 0x0, 0x0, 0x4, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x6, 0x20,
+    0x0, 0x0, 0x0, 0x5, 0xbd, 0xda, 0x40, 0x0, 0x0, 0xbf, 0x96, 0x6a, 0xf8, 0x0, 0x9, 0xe3,
+    0x0, 0x0, 0x6f, 0x50, 0x1f, 0x70, 0x0, 0x0, 0xa, 0xc0, 0x4f, 0x20, 0x0, 0x0, 0x6, 0xf0,
+    0x4f, 0x20, 0x0, 0x0, 0x5, 0xf1, 0x2f, 0x50, 0x0, 0x0, 0x9, 0xd0, 0xa, 0xd1, 0x0, 0x0,
+    0x3f, 0x70, 0x1, 0xdd, 0x63, 0x37, 0xeb, 0x0, 0x0, 0x18, 0xdf, 0xec, 0x70, 0x0,
+
+    /* U+00D4 "Ô" */
+    0x0, 0x0, 0x6, 0x50, 0x0, 0x0, 0x0, 0x0, 0xaa, 0xc7, 0x0, 0x0, 0x0, 0x2, 0x50, 0x16,
+    0x10, 0x0, 0x0, 0x5, 0xbd, 0xda, 0x40, 0x0, 0x0, 0xbf, 0x96, 0x6a, 0xf8, 0x0, 0x9, 0xe3,
+    0x0, 0x0, 0x6f, 0x50, 0x1f, 0x70, 0x0, 0x0, 0xa, 0xc0, 0x4f, 0x20, 0x0, 0x0, 0x6, 0xf0,
+    0x4f, 0x20, 0x0, 0x0, 0x5, 0xf1, 0x2f, 0x50, 0x0, 0x0, 0x9, 0xd0, 0xa, 0xd1, 0x0, 0x0,
+    0x3f, 0x70, 0x1, 0xdd, 0x63, 0x37, 0xeb, 0x0, 0x0, 0x18, 0xdf, 0xec, 0x70, 0x0,
+
+    /* U+00D5 "Õ" */
+    0x0, 0x0, 0x43, 0x3, 0x10, 0x0, 0x0, 0x4, 0xba, 0x9c, 0x10, 0x0, 0x0, 0x2, 0x10, 0x42,
+    0x0, 0x0, 0x0, 0x5, 0xbd, 0xda, 0x40, 0x0, 0x0, 0xbf, 0x96, 0x6a, 0xf8, 0x0, 0x9, 0xe3,
+    0x0, 0x0, 0x6f, 0x50, 0x1f, 0x70, 0x0, 0x0, 0xa, 0xc0, 0x4f, 0x20, 0x0, 0x0, 0x6, 0xf0,
+    0x4f, 0x20, 0x0, 0x0, 0x5, 0xf1, 0x2f, 0x50, 0x0, 0x0, 0x9, 0xd0, 0xa, 0xd1, 0x0, 0x0,
+    0x3f, 0x70, 0x1, 0xdd, 0x63, 0x37, 0xeb, 0x0, 0x0, 0x18, 0xdf, 0xec, 0x70, 0x0,
+
+    /* U+00D6 "Ö" */
+    0x0, 0x0, 0x30, 0x12, 0x0, 0x0, 0x0, 0x1, 0xf3, 0x6c, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1,
+    0x0, 0x0, 0x0, 0x5, 0xbd, 0xda, 0x40, 0x0, 0x0, 0xbf, 0x96, 0x6a, 0xf8, 0x0, 0x9, 0xe3,
+    0x0, 0x0, 0x6f, 0x50, 0x1f, 0x70, 0x0, 0x0, 0xa, 0xc0, 0x4f, 0x20, 0x0, 0x0, 0x6, 0xf0,
+    0x4f, 0x20, 0x0, 0x0, 0x5, 0xf1, 0x2f, 0x50, 0x0, 0x0, 0x9, 0xd0, 0xa, 0xd1, 0x0, 0x0,
+    0x3f, 0x70, 0x1, 0xdd, 0x63, 0x37, 0xeb, 0x0, 0x0, 0x18, 0xdf, 0xec, 0x70, 0x0,
+
+    /* U+00D7 "×" */
+    0x4, 0x0, 0x31, 0x3e, 0x43, 0xe6, 0x5, 0xee, 0x70, 0x3, 0xef, 0x40, 0x2e, 0x75, 0xe4, 0x26,
+    0x0, 0x53,
+
+    /* U+00D8 "Ø" */
+    0x0, 0x0, 0x0, 0x0, 0x8, 0x40, 0x0, 0x5, 0xbd, 0xda, 0x9b, 0x0, 0x0, 0xbf, 0x96, 0x6c,
+    0xf9, 0x0, 0x9, 0xe3, 0x0, 0xc, 0xaf, 0x50, 0x1f, 0x70, 0x0, 0x88, 0xa, 0xc0, 0x4f, 0x20,
+    0x4, 0xc0, 0x6, 0xf0, 0x4f, 0x20, 0x1d, 0x20, 0x5, 0xf1, 0x2f, 0x50, 0xa6, 0x0, 0x9, 0xd0,
+    0xa, 0xd7, 0xa0, 0x0, 0x3f, 0x70, 0x1, 0xff, 0x73, 0x37, 0xeb, 0x0, 0x0, 0xdc, 0xdf, 0xec,
+    0x70, 0x0, 0x7, 0x70, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00D9 "Ù" */
+    0x0, 0x56, 0x0, 0x0, 0x0, 0x1, 0xba, 0x0, 0x0, 0x0, 0x0, 0x52, 0x0, 0x7, 0x90, 0x0,
+    0x0, 0x88, 0x9c, 0x0, 0x0, 0xa, 0xa9, 0xc0, 0x0, 0x0, 0xaa, 0x9c, 0x0, 0x0, 0xa, 0xa9,
+    0xc0, 0x0, 0x0, 0xaa, 0x9c, 0x0, 0x0, 0xa, 0xa8, 0xd0, 0x0, 0x0, 0xb9, 0x5f, 0x20, 0x0,
+    0x1e, 0x60, 0xdd, 0x52, 0x4c, 0xd1, 0x1, 0x9e, 0xfe, 0xa2, 0x0,
+
+    /* U+00DA "Ú" */
+    0x0, 0x0, 0x5, 0x50, 0x0, 0x0, 0x8, 0xc2, 0x0, 0x0, 0x2, 0x60, 0x0, 0x7, 0x90, 0x0,
+    0x0, 0x88, 0x9c, 0x0, 0x0, 0xa, 0xa9, 0xc0, 0x0, 0x0, 0xaa, 0x9c, 0x0, 0x0, 0xa, 0xa9,
+    0xc0, 0x0, 0x0, 0xaa, 0x9c, 0x0, 0x0, 0xa, 0xa8, 0xd0, 0x0, 0x0, 0xb9, 0x5f, 0x20, 0x0,
+    0x1e, 0x60, 0xdd, 0x52, 0x4c, 0xd1, 0x1, 0x9e, 0xfe, 0xa2, 0x0,
+
+    /* U+00DB "Û" */
+    0x0, 0x2, 0x63, 0x0, 0x0, 0x2, 0xd8, 0xd3, 0x0, 0x0, 0x53, 0x2, 0x50, 0x7, 0x90, 0x0,
+    0x0, 0x88, 0x9c, 0x0, 0x0, 0xa, 0xa9, 0xc0, 0x0, 0x0, 0xaa, 0x9c, 0x0, 0x0, 0xa, 0xa9,
+    0xc0, 0x0, 0x0, 0xaa, 0x9c, 0x0, 0x0, 0xa, 0xa8, 0xd0, 0x0, 0x0, 0xb9, 0x5f, 0x20, 0x0,
+    0x1e, 0x60, 0xdd, 0x52, 0x4c, 0xd1, 0x1, 0x9e, 0xfe, 0xa2, 0x0,
+
+    /* U+00DC "Ü" */
+    0x0, 0x2, 0x2, 0x10, 0x0, 0x6, 0xd0, 0xb7, 0x0, 0x0, 0x1, 0x1, 0x0, 0x7, 0x90, 0x0,
+    0x0, 0x88, 0x9c, 0x0, 0x0, 0xa, 0xa9, 0xc0, 0x0, 0x0, 0xaa, 0x9c, 0x0, 0x0, 0xa, 0xa9,
+    0xc0, 0x0, 0x0, 0xaa, 0x9c, 0x0, 0x0, 0xa, 0xa8, 0xd0, 0x0, 0x0, 0xb9, 0x5f, 0x20, 0x0,
+    0x1e, 0x60, 0xdd, 0x52, 0x4c, 0xd1, 0x1, 0x9e, 0xfe, 0xa2, 0x0,
+
+    /* U+00DD "Ý" */
+    0x0, 0x0, 0x5, 0x50, 0x0, 0x0, 0x8, 0xc2, 0x0, 0x0, 0x2, 0x60, 0x0, 0xa, 0x80, 0x0,
+    0x0, 0x6a, 0x4f, 0x40, 0x0, 0x2e, 0x50, 0xac, 0x0, 0xa, 0xb0, 0x1, 0xe7, 0x4, 0xf2, 0x0,
+    0x7, 0xe2, 0xd8, 0x0, 0x0, 0xc, 0xed, 0x0, 0x0, 0x0, 0x4f, 0x50, 0x0, 0x0, 0x2, 0xf3,
+    0x0, 0x0, 0x0, 0x2f, 0x30, 0x0, 0x0, 0x2, 0xf3, 0x0, 0x0,
+
+    /* U+00DE "Þ" */
+    0x6a, 0x0, 0x0, 0x0, 0x8, 0xe9, 0x99, 0x72, 0x0, 0x8e, 0x99, 0xad, 0xf6, 0x8, 0xd0, 0x0,
+    0x8, 0xf2, 0x8d, 0x0, 0x0, 0x1f, 0x58, 0xd0, 0x0, 0x2, 0xf4, 0x8d, 0x0, 0x3, 0xbd, 0x18,
+    0xfe, 0xef, 0xfc, 0x30, 0x8e, 0x44, 0x32, 0x0, 0x8, 0xd0, 0x0, 0x0, 0x0,
+
+    /* U+00DF "ß" */
+    0x0, 0x47, 0x62, 0x0, 0xb, 0xeb, 0xce, 0x50, 0x6e, 0x20, 0x8, 0xd0, 0xaa, 0x0, 0x5, 0xf0,
+    0xb9, 0x0, 0x1b, 0xb0, 0xb9, 0x6, 0xee, 0x30, 0xb9, 0x3, 0x6a, 0xe4, 0xb9, 0x0, 0x0, 0xab,
+    0xb9, 0x0, 0x0, 0x8c, 0xb9, 0x3, 0x25, 0xe8, 0xb9, 0x1e, 0xfd, 0x80,
+
+    /* U+00E0 "à" */
+    0x1, 0x52, 0x0, 0x0, 0x0, 0x7d, 0x30, 0x0, 0x0, 0x3, 0x60, 0x0, 0x0, 0x47, 0x73, 0x0,
+    0xd, 0xeb, 0xcf, 0x70, 0x4, 0x0, 0x7, 0xe1, 0x0, 0x24, 0x46, 0xf2, 0xa, 0xeb, 0xab, 0xf2,
+    0x3f, 0x20, 0x3, 0xf2, 0x2f, 0x50, 0x2b, 0xf2, 0x6, 0xde, 0xd8, 0xf2,
+
+    /* U+00E1 "á" */
+    0x0, 0x0, 0x15, 0x20, 0x0, 0x1, 0xc8, 0x0, 0x0, 0x5, 0x50, 0x0, 0x0, 0x47, 0x73, 0x0,
+    0xd, 0xeb, 0xcf, 0x70, 0x4, 0x0, 0x7, 0xe1, 0x0, 0x24, 0x46, 0xf2, 0xa, 0xeb, 0xab, 0xf2,
+    0x3f, 0x20, 0x3, 0xf2, 0x2f, 0x50, 0x2b, 0xf2, 0x6, 0xde, 0xd8, 0xf2,
+
+    /* U+00E2 "â" */
+    0x0, 0x3, 0x40, 0x0, 0x0, 0x6d, 0xb8, 0x0, 0x1, 0x71, 0x7, 0x20, 0x0, 0x47, 0x73, 0x0,
+    0xd, 0xeb, 0xcf, 0x70, 0x4, 0x0, 0x7, 0xe1, 0x0, 0x24, 0x46, 0xf2, 0xa, 0xeb, 0xab, 0xf2,
+    0x3f, 0x20, 0x3, 0xf2, 0x2f, 0x50, 0x2b, 0xf2, 0x6, 0xde, 0xd8, 0xf2,
+
+    /* U+00E3 "ã" */
+    0x0, 0x23, 0x1, 0x10, 0x1, 0xca, 0x9b, 0x40, 0x1, 0x30, 0x45, 0x0, 0x0, 0x47, 0x73, 0x0,
+    0xd, 0xeb, 0xcf, 0x70, 0x4, 0x0, 0x7, 0xe1, 0x0, 0x24, 0x46, 0xf2, 0xa, 0xeb, 0xab, 0xf2,
+    0x3f, 0x20, 0x3, 0xf2, 0x2f, 0x50, 0x2b, 0xf2, 0x6, 0xde, 0xd8, 0xf2,
+
+    /* U+00E4 "ä" */
+    0x0, 0x10, 0x1, 0x0, 0x0, 0xd6, 0x4e, 0x0, 0x0, 0x20, 0x2, 0x0, 0x0, 0x47, 0x73, 0x0,
+    0xd, 0xeb, 0xcf, 0x70, 0x4, 0x0, 0x7, 0xe1, 0x0, 0x24, 0x46, 0xf2, 0xa, 0xeb, 0xab, 0xf2,
+    0x3f, 0x20, 0x3, 0xf2, 0x2f, 0x50, 0x2b, 0xf2, 0x6, 0xde, 0xd8, 0xf2,
+
+    /* U+00E5 "å" */
+    0x0, 0x3, 0x40, 0x0, 0x0, 0x48, 0x76, 0x0, 0x0, 0x64, 0x28, 0x0, 0x0, 0x8, 0x81, 0x0,
+    0x0, 0x47, 0x73, 0x0, 0xd, 0xeb, 0xcf, 0x70, 0x4, 0x0, 0x7, 0xe1, 0x0, 0x24, 0x46, 0xf2,
+    0xa, 0xeb, 0xab, 0xf2, 0x3f, 0x20, 0x3, 0xf2, 0x2f, 0x50, 0x2b, 0xf2, 0x6, 0xde, 0xd8, 0xf2,
+
+    /* U+00E6 "æ" */
+    0x0, 0x47, 0x63, 0x0, 0x57, 0x51, 0x0, 0xd, 0xeb, 0xcf, 0x8c, 0xda, 0xdd, 0x30, 0x4, 0x0,
+    0x7, 0xfb, 0x0, 0xa, 0xc0, 0x0, 0x24, 0x46, 0xf7, 0x44, 0x46, 0xf2, 0xa, 0xeb, 0xbb, 0xfc,
+    0xbb, 0xbb, 0xb3, 0x3f, 0x20, 0x4, 0xf7, 0x0, 0x0, 0x0, 0x2f, 0x50, 0x2b, 0xde, 0x62, 0x39,
+    0x60, 0x6, 0xde, 0xe9, 0x17, 0xdf, 0xeb, 0x30,
+
+    /* U+00E7 "ç" */
+    0x0, 0x15, 0x75, 0x10, 0x4, 0xed, 0xbd, 0xd2, 0x1e, 0x90, 0x0, 0x82, 0x5f, 0x10, 0x0, 0x0,
+    0x6f, 0x0, 0x0, 0x0, 0x3f, 0x30, 0x0, 0x0, 0xa, 0xd5, 0x25, 0xd4, 0x1, 0x8e, 0xfd, 0x80,
+    0x0, 0x5, 0x90, 0x0, 0x0, 0x1, 0x97, 0x0, 0x0, 0x3b, 0xd4, 0x0,
+
+    /* U+00E8 "è" */
+    0x0, 0x53, 0x0, 0x0, 0x0, 0x4e, 0x50, 0x0, 0x0, 0x2, 0x71, 0x0, 0x0, 0x16, 0x74, 0x0,
+    0x4, 0xec, 0xae, 0xb1, 0x1e, 0x80, 0x1, 0xc8, 0x5f, 0x43, 0x33, 0x8d, 0x6f, 0xbb, 0xbb, 0xbb,
+    0x3f, 0x30, 0x0, 0x0, 0xb, 0xd5, 0x24, 0xb3, 0x1, 0x8d, 0xfe, 0x91,
+
+    /* U+00E9 "é" */
+    0x0, 0x0, 0x5, 0x30, 0x0, 0x0, 0xab, 0x10, 0x0, 0x4, 0x60, 0x0, 0x0, 0x16, 0x74, 0x0,
+    0x4, 0xec, 0xae, 0xb1, 0x1e, 0x80, 0x1, 0xc8, 0x5f, 0x43, 0x33, 0x8d, 0x6f, 0xbb, 0xbb, 0xbb,
+    0x3f, 0x30, 0x0, 0x0, 0xb, 0xd5, 0x24, 0xb3, 0x1, 0x8d, 0xfe, 0x91,
+
+    /* U+00EA "ê" */
+    0x0, 0x2, 0x51, 0x0, 0x0, 0x4d, 0xab, 0x10, 0x0, 0x72, 0x5, 0x40, 0x0, 0x16, 0x74, 0x0,
+    0x4, 0xec, 0xae, 0xb1, 0x1e, 0x80, 0x1, 0xc8, 0x5f, 0x43, 0x33, 0x8d, 0x6f, 0xbb, 0xbb, 0xbb,
+    0x3f, 0x30, 0x0, 0x0, 0xb, 0xd5, 0x24, 0xb3, 0x1, 0x8d, 0xfe, 0x91,
+
+    /* U+00EB "ë" */
+    0x0, 0x11, 0x1, 0x0, 0x0, 0x99, 0xf, 0x30, 0x0, 0x11, 0x2, 0x0, 0x0, 0x16, 0x74, 0x0,
+    0x4, 0xec, 0xae, 0xb1, 0x1e, 0x80, 0x1, 0xc8, 0x5f, 0x43, 0x33, 0x8d, 0x6f, 0xbb, 0xbb, 0xbb,
+    0x3f, 0x30, 0x0, 0x0, 0xb, 0xd5, 0x24, 0xb3, 0x1, 0x8d, 0xfe, 0x91,
+
+    /* U+00EC "ì" */
+    0x25, 0x10, 0x8, 0xd2, 0x0, 0x46, 0x0, 0x54, 0x0, 0xb9, 0x0, 0xb9, 0x0, 0xb9, 0x0, 0xb9,
+    0x0, 0xb9, 0x0, 0xb9, 0x0, 0xb9,
+
+    /* U+00ED "í" */
+    0x2, 0x51, 0x2d, 0x70, 0x64, 0x0, 0x54, 0x0, 0xb9, 0x0, 0xb9, 0x0, 0xb9, 0x0, 0xb9, 0x0,
+    0xb9, 0x0, 0xb9, 0x0, 0xb9, 0x0,
+
+    /* U+00EE "î" */
+    0x4, 0x30, 0x6c, 0xd4, 0x71, 0x27, 0x5, 0x40, 0xb, 0x90, 0xb, 0x90, 0xb, 0x90, 0xb, 0x90,
+    0xb, 0x90, 0xb, 0x90, 0xb, 0x90,
+
+    /* U+00EF "ï" */
+    0x10, 0x10, 0xa8, 0xa8, 0x11, 0x11, 0x5, 0x40, 0xb, 0x90, 0xb, 0x90, 0xb, 0x90, 0xb, 0x90,
+    0xb, 0x90, 0xb, 0x90, 0xb, 0x90,
+
+    /* U+00F0 "ð" */
+    0x0, 0x12, 0x10, 0x0, 0x0, 0x9f, 0xff, 0xc8, 0x90, 0x2, 0x15, 0xce, 0xf6, 0x0, 0x1d, 0xb5,
+    0x9, 0xd0, 0x0, 0x21, 0x20, 0x3f, 0x30, 0x3c, 0xff, 0xd4, 0xf5, 0x1e, 0xa2, 0x4, 0xdf, 0x55,
+    0xf1, 0x0, 0x7, 0xf4, 0x5f, 0x10, 0x0, 0x7e, 0x1, 0xeb, 0x21, 0x5e, 0x60, 0x3, 0xbf, 0xfc,
+    0x60, 0x0,
+
+    /* U+00F1 "ñ" */
+    0x0, 0x32, 0x2, 0x0, 0x5, 0xbb, 0x7c, 0x10, 0x3, 0x10, 0x63, 0x0, 0x54, 0x26, 0x74, 0x0,
+    0xbc, 0xec, 0xcf, 0x90, 0xbf, 0x40, 0x7, 0xf2, 0xbb, 0x0, 0x1, 0xf4, 0xb9, 0x0, 0x0, 0xf5,
+    0xb9, 0x0, 0x0, 0xf5, 0xb9, 0x0, 0x0, 0xf5, 0xb9, 0x0, 0x0, 0xf5,
+
+    /* U+00F2 "ò" */
+    0x0, 0x44, 0x0, 0x0, 0x0, 0x3, 0xd7, 0x0, 0x0, 0x0, 0x1, 0x72, 0x0, 0x0, 0x1, 0x57,
+    0x51, 0x0, 0x4, 0xed, 0xbe, 0xd3, 0x1, 0xe9, 0x0, 0xb, 0xd0, 0x5f, 0x10, 0x0, 0x3f, 0x36,
+    0xf0, 0x0, 0x1, 0xf4, 0x3f, 0x40, 0x0, 0x5f, 0x20, 0xbd, 0x42, 0x5e, 0x90, 0x1, 0x8d, 0xfd,
+    0x80, 0x0,
+
+    /* U+00F3 "ó" */
+    0x0, 0x0, 0x4, 0x40, 0x0, 0x0, 0x8, 0xc2, 0x0, 0x0, 0x3, 0x71, 0x0, 0x0, 0x1, 0x57,
+    0x51, 0x0, 0x4, 0xed, 0xbe, 0xd3, 0x1, 0xe9, 0x0, 0xb, 0xd0, 0x5f, 0x10, 0x0, 0x3f, 0x36,
+    0xf0, 0x0, 0x1, 0xf4, 0x3f, 0x40, 0x0, 0x5f, 0x20, 0xbd, 0x42, 0x5e, 0x90, 0x1, 0x8d, 0xfd,
+    0x80, 0x0,
+
+    /* U+00F4 "ô" */
+    0x0, 0x2, 0x51, 0x0, 0x0, 0x2, 0xda, 0xc1, 0x0, 0x0, 0x63, 0x4, 0x50, 0x0, 0x1, 0x57,
+    0x51, 0x0, 0x4, 0xed, 0xbe, 0xd3, 0x1, 0xe9, 0x0, 0xb, 0xd0, 0x5f, 0x10, 0x0, 0x3f, 0x36,
+    0xf0, 0x0, 0x1, 0xf4, 0x3f, 0x40, 0x0, 0x5f, 0x20, 0xbd, 0x42, 0x5e, 0x90, 0x1, 0x8d, 0xfd,
+    0x80, 0x0,
+
+    /* U+00F5 "õ" */
+    0x0, 0x14, 0x0, 0x20, 0x0, 0xa, 0x9b, 0x89, 0x0, 0x0, 0x40, 0x26, 0x10, 0x0, 0x1, 0x57,
+    0x51, 0x0, 0x4, 0xed, 0xbe, 0xd3, 0x1, 0xe9, 0x0, 0xb, 0xd0, 0x5f, 0x10, 0x0, 0x3f, 0x36,
+    0xf0, 0x0, 0x1, 0xf4, 0x3f, 0x40, 0x0, 0x5f, 0x20, 0xbd, 0x42, 0x5e, 0x90, 0x1, 0x8d, 0xfd,
+    0x80, 0x0,
+
+    /* U+00F6 "ö" */
+    0x0, 0x1, 0x1, 0x0, 0x0, 0x7, 0xb0, 0xd5, 0x0, 0x0, 0x12, 0x2, 0x0, 0x0, 0x1, 0x57,
+    0x51, 0x0, 0x4, 0xed, 0xbe, 0xd3, 0x1, 0xe9, 0x0, 0xb, 0xd0, 0x5f, 0x10, 0x0, 0x3f, 0x36,
+    0xf0, 0x0, 0x1, 0xf4, 0x3f, 0x40, 0x0, 0x5f, 0x20, 0xbd, 0x42, 0x5e, 0x90, 0x1, 0x8d, 0xfd,
+    0x80, 0x0,
+
+    /* U+00F7 "÷" */
+    0x0, 0x3, 0x40, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x7, 0x77, 0x77, 0x71,
+    0x1a, 0xaa, 0xaa, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xb0, 0x0, 0x0, 0x5, 0x70, 0x0,
+
+    /* U+00F8 "ø" */
+    0x0, 0x0, 0x0, 0x4, 0x0, 0x1, 0x57, 0x58, 0x50, 0x4, 0xed, 0xbf, 0xf3, 0x1, 0xe9, 0x0,
+    0xbc, 0xd0, 0x5f, 0x10, 0x76, 0x3f, 0x36, 0xf0, 0x2a, 0x1, 0xf4, 0x3f, 0x4b, 0x20, 0x5f, 0x20,
+    0xbf, 0xa2, 0x5e, 0x90, 0x3, 0xfd, 0xfd, 0x80, 0x0, 0xa2, 0x0, 0x0, 0x0,
+
+    /* U+00F9 "ù" */
+    0x3, 0x50, 0x0, 0x0, 0x1, 0xba, 0x0, 0x0, 0x0, 0x6, 0x40, 0x0, 0x53, 0x0, 0x1, 0x61,
+    0xc8, 0x0, 0x2, 0xf3, 0xc8, 0x0, 0x2, 0xf3, 0xc8, 0x0, 0x2, 0xf3, 0xc8, 0x0, 0x3, 0xf3,
+    0xba, 0x0, 0x6, 0xf3, 0x7f, 0x62, 0x5e, 0xf3, 0x8, 0xdf, 0xd6, 0xf3,
+
+    /* U+00FA "ú" */
+    0x0, 0x0, 0x35, 0x0, 0x0, 0x5, 0xe4, 0x0, 0x0, 0x17, 0x20, 0x0, 0x53, 0x0, 0x1, 0x61,
+    0xc8, 0x0, 0x2, 0xf3, 0xc8, 0x0, 0x2, 0xf3, 0xc8, 0x0, 0x2, 0xf3, 0xc8, 0x0, 0x3, 0xf3,
+    0xba, 0x0, 0x6, 0xf3, 0x7f, 0x62, 0x5e, 0xf3, 0x8, 0xdf, 0xd6, 0xf3,
+
+    /* U+00FB "û" */
+    0x0, 0x15, 0x20, 0x0, 0x1, 0xba, 0xd4, 0x0, 0x4, 0x50, 0x27, 0x0, 0x53, 0x0, 0x1, 0x61,
+    0xc8, 0x0, 0x2, 0xf3, 0xc8, 0x0, 0x2, 0xf3, 0xc8, 0x0, 0x2, 0xf3, 0xc8, 0x0, 0x3, 0xf3,
+    0xba, 0x0, 0x6, 0xf3, 0x7f, 0x62, 0x5e, 0xf3, 0x8, 0xdf, 0xd6, 0xf3,
+
+    /* U+00FC "ü" */
+    0x0, 0x10, 0x11, 0x0, 0x3, 0xf0, 0x99, 0x0, 0x0, 0x20, 0x11, 0x0, 0x53, 0x0, 0x1, 0x61,
+    0xc8, 0x0, 0x2, 0xf3, 0xc8, 0x0, 0x2, 0xf3, 0xc8, 0x0, 0x2, 0xf3, 0xc8, 0x0, 0x3, 0xf3,
+    0xba, 0x0, 0x6, 0xf3, 0x7f, 0x62, 0x5e, 0xf3, 0x8, 0xdf, 0xd6, 0xf3,
+
+    /* U+00FD "ý" */
+    0x0, 0x0, 0x3, 0x50, 0x0, 0x0, 0x5, 0xe4, 0x0, 0x0, 0x1, 0x72, 0x0, 0x0, 0x63, 0x0,
+    0x0, 0x45, 0x9, 0xc0, 0x0, 0xd, 0x60, 0x3f, 0x30, 0x5, 0xe1, 0x0, 0xba, 0x0, 0xb8, 0x0,
+    0x4, 0xf2, 0x3f, 0x20, 0x0, 0xd, 0x89, 0xa0, 0x0, 0x0, 0x6e, 0xe3, 0x0, 0x0, 0x1, 0xeb,
+    0x0, 0x0, 0x0, 0x1e, 0x50, 0x0, 0x1b, 0x7c, 0xb0, 0x0, 0x1, 0x7a, 0x81, 0x0, 0x0,
+
+    /* U+00FE "þ" */
+    0x44, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0xb9, 0x0, 0x0, 0x0, 0xb9, 0x16, 0x74, 0x0,
+    0xbc, 0xec, 0xbf, 0xb1, 0xbf, 0x50, 0x2, 0xe8, 0xbb, 0x0, 0x0, 0x8d, 0xba, 0x0, 0x0, 0x6e,
+    0xbd, 0x0, 0x0, 0xab, 0xbf, 0xa3, 0x28, 0xf4, 0xba, 0x9e, 0xfc, 0x50, 0xb9, 0x0, 0x0, 0x0,
+    0xb9, 0x0, 0x0, 0x0, 0x76, 0x0, 0x0, 0x0,
+
+    /* U+00FF "ÿ" */
+    0x0, 0x1, 0x1, 0x10, 0x0, 0x3, 0xf1, 0x9a, 0x0, 0x0, 0x2, 0x1, 0x10, 0x0, 0x63, 0x0,
+    0x0, 0x45, 0x9, 0xc0, 0x0, 0xd, 0x60, 0x3f, 0x30, 0x5, 0xe1, 0x0, 0xba, 0x0, 0xb8, 0x0,
+    0x4, 0xf2, 0x3f, 0x20, 0x0, 0xd, 0x89, 0xa0, 0x0, 0x0, 0x6e, 0xe3, 0x0, 0x0, 0x1, 0xeb,
+    0x0, 0x0, 0x0, 0x1e, 0x50, 0x0, 0x1b, 0x7c, 0xb0, 0x0, 0x1, 0x7a, 0x81, 0x0, 0x0,
+
+    /* U+2013 "–" */
+    0x55, 0x55, 0x55, 0x59, 0x99, 0x99, 0x99,
+
+    /* U+2014 "—" */
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+
+    /* U+2018 "‘" */
+    0x3, 0x20, 0xb3, 0x1f, 0x15, 0xf7, 0x17, 0x20,
+
+    /* U+2019 "’" */
+    0x6, 0x14, 0xf7, 0xd, 0x41, 0xe0, 0x15, 0x0,
+
+    /* U+201C "“" */
+    0x3, 0x20, 0x50, 0xb, 0x32, 0xd0, 0x1f, 0x17, 0xa0, 0x5f, 0x7a, 0xf1, 0x17, 0x23, 0x60,
+
+    /* U+201D "”" */
+    0x6, 0x12, 0x60, 0x4f, 0x79, 0xf2, 0xd, 0x43, 0xe0, 0x1e, 0x6, 0x90, 0x15, 0x4, 0x20,
+
+    /* U+2022 "•" */
+    0x1, 0xc, 0xf4, 0xef, 0x53, 0x50,
+
+    /* U+2026 "…" */
+    0x2c, 0x40, 0xa7, 0x8, 0xa3, 0xe5, 0x1d, 0x90, 0xac,
+
+    /* U+20AC "€" */
+    0x0, 0x0, 0x4a, 0xdd, 0xb5, 0x0, 0x0, 0x9f, 0xa6, 0x69, 0xf7, 0x0, 0x6f, 0x50, 0x0, 0x3,
+    0x12, 0x4d, 0xc4, 0x44, 0x40, 0x0, 0x59, 0xfa, 0x88, 0x87, 0x0, 0x3, 0x6f, 0x85, 0x55, 0x50,
+    0x0, 0x47, 0xec, 0x77, 0x76, 0x0, 0x0, 0x8, 0xe3, 0x0, 0x0, 0x10, 0x0, 0x1c, 0xe7, 0x33,
+    0x6e, 0x70, 0x0, 0x17, 0xdf, 0xfd, 0x81,
+
+    /* U+F001 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8c, 0xfe, 0x0, 0x0,
+    0x1, 0x59, 0xef, 0xff, 0xff, 0x0, 0x3, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xfc, 0xdf, 0x0, 0x8, 0xff, 0xfe, 0xa5, 0x10, 0xbf, 0x0, 0x8, 0xf9, 0x40, 0x0, 0x0,
+    0xbf, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x8, 0xf4, 0x0, 0x0, 0x0, 0xbf, 0x0,
+    0x8, 0xf4, 0x0, 0x1, 0x67, 0xdf, 0x0, 0x8, 0xf4, 0x0, 0x1d, 0xff, 0xff, 0x18, 0xbd, 0xf4,
+    0x0, 0x2f, 0xff, 0xfe, 0xcf, 0xff, 0xf4, 0x0, 0x6, 0xdf, 0xc4, 0xcf, 0xff, 0xe2, 0x0, 0x0,
+    0x0, 0x0, 0x18, 0xb9, 0x30, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F008 "" */
+    0x50, 0x38, 0x88, 0x88, 0x88, 0x83, 0x5, 0xf9, 0xcf, 0xcc, 0xcc, 0xcc, 0xfc, 0x9f, 0xe4, 0x8e,
+    0x0, 0x0, 0x0, 0xe8, 0x4e, 0xd0, 0x6e, 0x0, 0x0, 0x0, 0xe6, 0xd, 0xfd, 0xee, 0x0, 0x0,
+    0x0, 0xee, 0xdf, 0xd0, 0x6f, 0xee, 0xee, 0xee, 0xf6, 0xd, 0xe6, 0xaf, 0x66, 0x66, 0x66, 0xfa,
+    0x6e, 0xe8, 0xbe, 0x0, 0x0, 0x0, 0xeb, 0x8e, 0xd0, 0x6e, 0x0, 0x0, 0x0, 0xe6, 0xd, 0xfb,
+    0xdf, 0x55, 0x55, 0x55, 0xfd, 0xbf, 0xc2, 0x7f, 0xff, 0xff, 0xff, 0xf7, 0x2c,
+
+    /* U+F00B "" */
+    0x46, 0x64, 0x4, 0x66, 0x66, 0x66, 0x64, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x2f, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0x1e, 0xff, 0xff, 0xff, 0xfe, 0x12, 0x21, 0x1, 0x22,
+    0x22, 0x22, 0x21, 0xdf, 0xfe, 0x1e, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x68, 0x86, 0x6, 0x88, 0x88, 0x88, 0x86, 0x79,
+    0x98, 0x8, 0x99, 0x99, 0x99, 0x97, 0xff, 0xff, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0xff, 0xff, 0xff, 0xff, 0xbd, 0xdc, 0x1c, 0xdd, 0xdd, 0xdd, 0xdb,
+
+    /* U+F00C "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xdf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xd2, 0x2d, 0x60, 0x0, 0x1,
+    0xdf, 0xfd, 0x20, 0xdf, 0xf7, 0x0, 0x1d, 0xff, 0xd2, 0x0, 0x8f, 0xff, 0x71, 0xdf, 0xfd, 0x20,
+    0x0, 0x8, 0xff, 0xfe, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+F00D "" */
+    0x7f, 0x60, 0x0, 0x1b, 0xe3, 0xef, 0xf6, 0x1, 0xbf, 0xf8, 0x4f, 0xff, 0x6b, 0xff, 0xc1, 0x4,
+    0xff, 0xff, 0xfc, 0x10, 0x0, 0x5f, 0xff, 0xd1, 0x0, 0x1, 0xbf, 0xff, 0xf6, 0x0, 0x1b, 0xff,
+    0xdf, 0xff, 0x60, 0xbf, 0xfc, 0x14, 0xff, 0xf5, 0xcf, 0xc1, 0x0, 0x4f, 0xf7, 0x28, 0x10, 0x0,
+    0x4, 0x60,
+
+    /* U+F011 "" */
+    0x0, 0x0, 0x0, 0x33, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0, 0x0, 0x0, 0x5c,
+    0x11, 0xff, 0x11, 0xc4, 0x0, 0x4, 0xff, 0x71, 0xff, 0x17, 0xff, 0x40, 0x1d, 0xfb, 0x11, 0xff,
+    0x11, 0xbf, 0xd1, 0x6f, 0xe1, 0x1, 0xff, 0x10, 0x1e, 0xf5, 0xaf, 0x90, 0x1, 0xff, 0x10, 0x9,
+    0xf9, 0xbf, 0x70, 0x1, 0xff, 0x10, 0x7, 0xfb, 0xaf, 0x70, 0x0, 0x88, 0x0, 0x8, 0xfa, 0x8f,
+    0xc0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x2f, 0xf6, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x9, 0xff, 0x70,
+    0x0, 0x7, 0xff, 0x90, 0x0, 0xbf, 0xfe, 0xbb, 0xef, 0xfb, 0x0, 0x0, 0x8, 0xef, 0xff, 0xfe,
+    0x80, 0x0, 0x0, 0x0, 0x15, 0x77, 0x51, 0x0, 0x0,
+
+    /* U+F013 "" */
+    0x0, 0x0, 0xa, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xc0, 0x0, 0x0, 0x4, 0xc6,
+    0xcf, 0xff, 0xfc, 0x6c, 0x40, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x5f, 0xff, 0xff, 0xaa,
+    0xff, 0xff, 0xf5, 0x19, 0xff, 0xf4, 0x0, 0x4f, 0xff, 0x91, 0x3, 0xff, 0xd0, 0x0, 0xd, 0xff,
+    0x30, 0x4, 0xff, 0xe1, 0x0, 0x1e, 0xff, 0x40, 0x4e, 0xff, 0xfb, 0x22, 0xbf, 0xff, 0xe4, 0x2f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x9, 0xfd, 0xff, 0xff, 0xff, 0xdf, 0x90, 0x1, 0x50, 0x5e,
+    0xff, 0xe5, 0x5, 0x10, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x77, 0x40,
+    0x0, 0x0,
+
+    /* U+F015 "" */
+    0x0, 0x0, 0x0, 0x4, 0x30, 0x4, 0x61, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6, 0xd, 0xf5, 0x0,
+    0x0, 0x0, 0x2c, 0xfc, 0xef, 0x9d, 0xf5, 0x0, 0x0, 0x3, 0xdf, 0x92, 0x2c, 0xff, 0xf5, 0x0,
+    0x0, 0x5e, 0xf7, 0x4e, 0xc2, 0xaf, 0xf6, 0x0, 0x8, 0xfe, 0x46, 0xff, 0xfe, 0x47, 0xfe, 0x50,
+    0xaf, 0xd3, 0x9f, 0xff, 0xff, 0xf6, 0x5e, 0xf7, 0x9b, 0x2b, 0xff, 0xff, 0xff, 0xff, 0x83, 0xd5,
+    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x6f, 0xff, 0xc6, 0x6e, 0xff, 0xf2, 0x0,
+    0x0, 0x6f, 0xff, 0x80, 0xc, 0xff, 0xf2, 0x0, 0x0, 0x6f, 0xff, 0x80, 0xc, 0xff, 0xf2, 0x0,
+    0x0, 0x4d, 0xdd, 0x70, 0xa, 0xdd, 0xd1, 0x0,
+
+    /* U+F019 "" */
+    0x0, 0x0, 0x1, 0x44, 0x10, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xf9,
+    0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xfd, 0x20, 0x0, 0x0,
+    0x0, 0x2d, 0xff, 0xd2, 0x0, 0x0, 0x79, 0x99, 0x92, 0xdd, 0x29, 0x99, 0x97, 0xff, 0xff, 0xfb,
+    0x22, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x86, 0xcf, 0x9b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb9,
+
+    /* U+F01C "" */
+    0x0, 0x3, 0x78, 0x88, 0x88, 0x87, 0x20, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
+    0x0, 0xcf, 0x64, 0x44, 0x44, 0x49, 0xf9, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40,
+    0x3f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd1, 0xcf, 0x84, 0x42, 0x0, 0x0, 0x34, 0x4b, 0xf8,
+    0xff, 0xff, 0xfd, 0x0, 0x2, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0x98, 0x8b, 0xff, 0xff, 0xfb,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+
+    /* U+F021 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0x0, 0x1, 0x8d, 0xff, 0xc7, 0x10, 0xef, 0x0, 0x4e,
+    0xff, 0xff, 0xff, 0xe4, 0xdf, 0x4, 0xff, 0xb3, 0x0, 0x4b, 0xff, 0xef, 0x1d, 0xf8, 0x0, 0x0,
+    0x10, 0x8f, 0xff, 0x5f, 0xc0, 0x0, 0x2, 0xff, 0xef, 0xff, 0x8d, 0x50, 0x0, 0x1, 0xdd, 0xdd,
+    0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x56, 0x66, 0x65, 0x0, 0x0, 0x2, 0x63, 0xff,
+    0xff, 0xff, 0x20, 0x0, 0x8, 0xf7, 0xff, 0xf9, 0x88, 0x10, 0x0, 0x3f, 0xf3, 0xff, 0xfd, 0x40,
+    0x0, 0x4, 0xef, 0x90, 0xfd, 0xbf, 0xfb, 0x87, 0xbf, 0xfb, 0x0, 0xfd, 0x7, 0xef, 0xff, 0xfe,
+    0x80, 0x0, 0xba, 0x0, 0x4, 0x77, 0x51, 0x0, 0x0,
+
+    /* U+F026 "" */
+    0x0, 0x0, 0x1, 0x60, 0x0, 0x1, 0xdf, 0x0, 0x1, 0xdf, 0xfb, 0xdd, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x68, 0xff, 0xf0,
+    0x0, 0x6, 0xff, 0x0, 0x0, 0x6, 0xd0,
+
+    /* U+F027 "" */
+    0x0, 0x0, 0x1, 0x50, 0x0, 0x0, 0x0, 0x1, 0xcf, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xf0, 0x0,
+    0xb, 0xdd, 0xef, 0xff, 0x3, 0x20, 0xff, 0xff, 0xff, 0xf0, 0x8e, 0x2f, 0xff, 0xff, 0xff, 0x0,
+    0xd7, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0x5f, 0xff, 0xff, 0xff, 0x8, 0xa0, 0x46, 0x68, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7, 0xd0, 0x0, 0x0,
+
+    /* U+F028 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x70, 0x0, 0x0, 0x0, 0x1, 0x60, 0x0, 0x5, 0xf9, 0x0,
+    0x0, 0x0, 0x1d, 0xf0, 0x1, 0x81, 0x4f, 0x60, 0x0, 0x1, 0xdf, 0xf0, 0x1, 0xdd, 0x18, 0xe1,
+    0xbd, 0xde, 0xff, 0xf0, 0x33, 0x1e, 0x91, 0xe6, 0xff, 0xff, 0xff, 0xf0, 0x8e, 0x27, 0xe0, 0xb9,
+    0xff, 0xff, 0xff, 0xf0, 0xd, 0x74, 0xf1, 0x9b, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0x55, 0xf1, 0x9a,
+    0xff, 0xff, 0xff, 0xf0, 0x89, 0xa, 0xc0, 0xd8, 0x46, 0x68, 0xff, 0xf0, 0x0, 0x7f, 0x43, 0xf3,
+    0x0, 0x0, 0x6f, 0xf0, 0x2, 0xf6, 0xc, 0xb0, 0x0, 0x0, 0x6, 0xd0, 0x0, 0x11, 0xae, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0,
+
+    /* U+F03E "" */
+    0x37, 0x88, 0x88, 0x88, 0x88, 0x88, 0x73, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0x32,
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x7f, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0x11, 0xbf, 0xff,
+    0xa0, 0x7f, 0xff, 0xff, 0xfe, 0xff, 0xfa, 0x0, 0x7, 0xff, 0xff, 0xe4, 0x5f, 0xa0, 0x0, 0x0,
+    0xcf, 0xfe, 0x40, 0x3, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfe,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xef, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
+
+    /* U+F043 "" */
+    0x0, 0x0, 0x21, 0x0, 0x0, 0x0, 0x1, 0xea, 0x0, 0x0, 0x0, 0x6, 0xff, 0x10, 0x0, 0x0,
+    0xd, 0xff, 0x70, 0x0, 0x0, 0x6f, 0xff, 0xe1, 0x0, 0x2, 0xef, 0xff, 0xfa, 0x0, 0xb, 0xff,
+    0xff, 0xff, 0x60, 0x5f, 0xff, 0xff, 0xff, 0xe1, 0xbf, 0xff, 0xff, 0xff, 0xf6, 0xee, 0xbf, 0xff,
+    0xff, 0xf9, 0xed, 0x4f, 0xff, 0xff, 0xf8, 0xbf, 0x49, 0xff, 0xff, 0xf5, 0x3f, 0xe5, 0x2d, 0xff,
+    0xc0, 0x6, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x28, 0xba, 0x61, 0x0,
+
+    /* U+F048 "" */
+    0x16, 0x40, 0x0, 0x0, 0x51, 0x4f, 0xb0, 0x0, 0xa, 0xf7, 0x4f, 0xb0, 0x1, 0xbf, 0xf8, 0x4f,
+    0xb0, 0x1b, 0xff, 0xf8, 0x4f, 0xb1, 0xcf, 0xff, 0xf8, 0x4f, 0xcd, 0xff, 0xff, 0xf8, 0x4f, 0xff,
+    0xff, 0xff, 0xf8, 0x4f, 0xff, 0xff, 0xff, 0xf8, 0x4f, 0xb7, 0xff, 0xff, 0xf8, 0x4f, 0xb0, 0x6f,
+    0xff, 0xf8, 0x4f, 0xb0, 0x5, 0xff, 0xf8, 0x4f, 0xb0, 0x0, 0x4e, 0xf8, 0x3d, 0x90, 0x0, 0x3,
+    0xc4,
+
+    /* U+F04B "" */
+    0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x81,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0x10, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x0, 0xf, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0, 0xff, 0xff,
+    0xe7, 0x0, 0x0, 0x0, 0xe, 0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x6a, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+F04C "" */
+    0x26, 0x66, 0x30, 0x2, 0x66, 0x63, 0xd, 0xff, 0xff, 0x20, 0xdf, 0xff, 0xf2, 0xff, 0xff, 0xf4,
+    0xf, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x40, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf4, 0xf, 0xff, 0xff,
+    0x4f, 0xff, 0xff, 0x40, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf4, 0xf, 0xff, 0xff, 0x4f, 0xff, 0xff,
+    0x40, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xf4, 0xf, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x40, 0xff, 0xff,
+    0xf4, 0xff, 0xff, 0xf4, 0xf, 0xff, 0xff, 0x4f, 0xff, 0xff, 0x30, 0xff, 0xff, 0xf3, 0x7d, 0xdd,
+    0xa0, 0x7, 0xdd, 0xda, 0x0,
+
+    /* U+F04D "" */
+    0x25, 0x66, 0x66, 0x66, 0x66, 0x63, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x8d, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xda, 0x0,
+
+    /* U+F051 "" */
+    0x4, 0x10, 0x0, 0x2, 0x62, 0x3f, 0xc1, 0x0, 0x7, 0xf8, 0x4f, 0xfd, 0x20, 0x7, 0xf8, 0x4f,
+    0xff, 0xe3, 0x7, 0xf8, 0x4f, 0xff, 0xfe, 0x47, 0xf8, 0x4f, 0xff, 0xff, 0xeb, 0xf8, 0x4f, 0xff,
+    0xff, 0xff, 0xf8, 0x4f, 0xff, 0xff, 0xfe, 0xf8, 0x4f, 0xff, 0xff, 0xa7, 0xf8, 0x4f, 0xff, 0xf9,
+    0x7, 0xf8, 0x4f, 0xff, 0x80, 0x7, 0xf8, 0x4f, 0xf7, 0x0, 0x7, 0xf8, 0x1c, 0x60, 0x0, 0x6,
+    0xd6,
+
+    /* U+F052 "" */
+    0x0, 0x0, 0x3, 0x40, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x70, 0x0, 0x0, 0x0, 0x3, 0xef,
+    0xff, 0x60, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0x50, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xff, 0x40,
+    0x1, 0xcf, 0xff, 0xff, 0xff, 0xfe, 0x30, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0x37, 0x88, 0x88, 0x88, 0x88, 0x74, 0x7, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xad, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdc, 0x10,
+
+    /* U+F053 "" */
+    0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x4, 0xfa, 0x0, 0x0, 0x4f, 0xfb, 0x0, 0x4, 0xff, 0xc1,
+    0x0, 0x4f, 0xfc, 0x10, 0x4, 0xff, 0xc1, 0x0, 0x2f, 0xfd, 0x10, 0x0, 0xb, 0xff, 0x50, 0x0,
+    0x0, 0xbf, 0xf5, 0x0, 0x0, 0xb, 0xff, 0x50, 0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0, 0xb, 0xfd,
+    0x0, 0x0, 0x0, 0x94,
+
+    /* U+F054 "" */
+    0x1, 0x10, 0x0, 0x0, 0x1d, 0xd2, 0x0, 0x0, 0x1e, 0xfd, 0x20, 0x0, 0x3, 0xef, 0xd2, 0x0,
+    0x0, 0x3e, 0xfd, 0x20, 0x0, 0x3, 0xef, 0xd2, 0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0, 0x9f, 0xf7,
+    0x0, 0x9, 0xff, 0x80, 0x0, 0x9f, 0xf8, 0x0, 0x9, 0xff, 0x80, 0x0, 0x2f, 0xf8, 0x0, 0x0,
+    0x6, 0x70, 0x0, 0x0,
+
+    /* U+F067 "" */
+    0x0, 0x0, 0x4, 0x51, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7, 0x0, 0x0,
+    0x6, 0x88, 0x8a, 0xff, 0xb8, 0x88, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf2, 0x1, 0x11, 0x4f, 0xf7, 0x11, 0x11, 0x0, 0x0, 0x3, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x1c, 0xd3, 0x0, 0x0, 0x0,
+
+    /* U+F068 "" */
+    0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x20, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
+
+    /* U+F06E "" */
+    0x0, 0x0, 0x2, 0x67, 0x75, 0x10, 0x0, 0x0, 0x0, 0x4, 0xcf, 0xfd, 0xdf, 0xfa, 0x20, 0x0,
+    0x0, 0x8f, 0xfa, 0x10, 0x3, 0xcf, 0xe5, 0x0, 0x9, 0xff, 0xa0, 0x8, 0xb4, 0x1d, 0xff, 0x50,
+    0x6f, 0xff, 0x20, 0xb, 0xff, 0x26, 0xff, 0xf2, 0xef, 0xff, 0x8, 0xcf, 0xff, 0x73, 0xff, 0xfa,
+    0xaf, 0xff, 0x19, 0xff, 0xff, 0x54, 0xff, 0xf7, 0x2e, 0xff, 0x62, 0xdf, 0xfb, 0x9, 0xff, 0xc0,
+    0x3, 0xef, 0xe3, 0x14, 0x40, 0x5f, 0xfc, 0x10, 0x0, 0x2b, 0xfe, 0x95, 0x6a, 0xff, 0x91, 0x0,
+    0x0, 0x0, 0x49, 0xde, 0xec, 0x83, 0x0, 0x0,
+
+    /* U+F070 "" */
+    0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xf6, 0x0, 0x25, 0x76, 0x41, 0x0, 0x0, 0x0, 0x4, 0xef, 0xac, 0xff, 0xde,
+    0xff, 0x92, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xa1, 0x0, 0x4d, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x9f,
+    0xe5, 0xab, 0x32, 0xef, 0xf4, 0x0, 0x8, 0xb1, 0x5, 0xef, 0xef, 0xe1, 0x8f, 0xfe, 0x10, 0x1f,
+    0xfd, 0x30, 0x2d, 0xff, 0xf5, 0x5f, 0xff, 0x80, 0xc, 0xff, 0xe0, 0x1, 0xaf, 0xf6, 0x6f, 0xff,
+    0x50, 0x3, 0xef, 0xf4, 0x0, 0x7, 0xff, 0xdf, 0xf9, 0x0, 0x0, 0x4e, 0xfd, 0x20, 0x0, 0x3d,
+    0xff, 0xb0, 0x0, 0x0, 0x3, 0xcf, 0xe8, 0x54, 0x1, 0xbf, 0xd3, 0x0, 0x0, 0x0, 0x5, 0xad,
+    0xfe, 0x60, 0x8, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x91,
+
+    /* U+F071 "" */
+    0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xd8, 0x9f, 0xf6, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xb0, 0xe, 0xfe, 0x10, 0x0, 0x0, 0xc, 0xff, 0xb0, 0xf, 0xff, 0x80, 0x0,
+    0x0, 0x5f, 0xff, 0xc0, 0x1f, 0xff, 0xf2, 0x0, 0x1, 0xdf, 0xff, 0xe1, 0x3f, 0xff, 0xfa, 0x0,
+    0x8, 0xff, 0xff, 0xf8, 0xaf, 0xff, 0xff, 0x40, 0x2f, 0xff, 0xff, 0xa0, 0xe, 0xff, 0xff, 0xc0,
+    0xaf, 0xff, 0xff, 0xd3, 0x4f, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x6b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb3,
+
+    /* U+F074 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x50, 0x99, 0x97,
+    0x0, 0x0, 0x59, 0xcf, 0xf5, 0xff, 0xff, 0x80, 0x5, 0xff, 0xff, 0xfd, 0x88, 0xaf, 0xf4, 0x4f,
+    0xfb, 0xcf, 0xf4, 0x0, 0x8, 0xa3, 0xef, 0xb0, 0x7f, 0x40, 0x0, 0x0, 0x3e, 0xfc, 0x10, 0x12,
+    0x0, 0x0, 0x2, 0xef, 0xc2, 0x40, 0x59, 0x0, 0x11, 0x2d, 0xfd, 0x2c, 0xf4, 0x8f, 0xb0, 0xff,
+    0xff, 0xd2, 0xb, 0xff, 0xff, 0xfa, 0xff, 0xfe, 0x20, 0x1, 0xcf, 0xff, 0xfb, 0x22, 0x21, 0x0,
+    0x0, 0x2, 0x8f, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a, 0x10,
+
+    /* U+F077 "" */
+    0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x8f, 0xf9, 0x5f, 0xfb, 0x0, 0x8, 0xff, 0x90, 0x5, 0xff, 0xb0, 0x7f, 0xf9,
+    0x0, 0x0, 0x5f, 0xfb, 0x9f, 0x90, 0x0, 0x0, 0x5, 0xfd, 0x4, 0x0, 0x0, 0x0, 0x0, 0x31,
+
+    /* U+F078 "" */
+    0x4b, 0x30, 0x0, 0x0, 0x1, 0xa7, 0xbf, 0xe3, 0x0, 0x0, 0x1c, 0xfe, 0x2d, 0xfe, 0x30, 0x1,
+    0xcf, 0xf4, 0x2, 0xdf, 0xe3, 0x1c, 0xff, 0x40, 0x0, 0x2d, 0xfe, 0xcf, 0xf4, 0x0, 0x0, 0x2,
+    0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x2d, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1, 0x30, 0x0, 0x0,
+
+    /* U+F079 "" */
+    0x0, 0x17, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xc1, 0x9, 0x99, 0x99, 0x99,
+    0x60, 0x0, 0x1c, 0xff, 0xfc, 0x1c, 0xff, 0xff, 0xff, 0xd0, 0x0, 0xbf, 0xcf, 0xcf, 0xb0, 0x22,
+    0x22, 0x2d, 0xd0, 0x0, 0x68, 0x6f, 0x68, 0x60, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x6f, 0x60,
+    0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x6f, 0x60, 0x0, 0x0, 0x2, 0xd, 0xd0, 0x20, 0x0,
+    0x6f, 0x60, 0x0, 0x0, 0x4f, 0x8d, 0xd8, 0xf4, 0x0, 0x6f, 0xb9, 0x99, 0x99, 0x2c, 0xff, 0xff,
+    0xc1, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x81, 0xcf, 0xfc, 0x10, 0x0, 0x2, 0x22, 0x22, 0x22, 0x0,
+    0x1c, 0xc1, 0x0,
+
+    /* U+F07B "" */
+    0x37, 0x88, 0x87, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xfc, 0xbb, 0xbb, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
+
+    /* U+F093 "" */
+    0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdd, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x2d, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x2d, 0xff, 0xff,
+    0xff, 0xd2, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x79, 0x99, 0x4b, 0xff, 0xb4, 0x99, 0x97, 0xff, 0xff, 0xb2,
+    0x44, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x86, 0xcf, 0x9b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb9,
+
+    /* U+F095 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xc7, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0x40, 0x0,
+    0x49, 0x30, 0x2, 0xcf, 0xf9, 0x0, 0x5c, 0xff, 0xe2, 0x5e, 0xff, 0xb0, 0x0, 0xef, 0xff, 0xfe,
+    0xff, 0xfa, 0x10, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xa2, 0x0,
+    0x0, 0x0, 0x2b, 0xa8, 0x51, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F0C4 "" */
+    0x2, 0x53, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xf8, 0x0, 0x1, 0x9d, 0xa1, 0xde, 0x7d, 0xf2,
+    0x1, 0xcf, 0xfc, 0x1e, 0xd0, 0x9f, 0x31, 0xcf, 0xfc, 0x10, 0x9f, 0xef, 0xf6, 0xcf, 0xfc, 0x10,
+    0x1, 0x9c, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x6, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x25, 0xcf,
+    0xff, 0xf5, 0x0, 0x0, 0x4e, 0xff, 0xfd, 0xff, 0xf5, 0x0, 0xd, 0xe7, 0xdf, 0x26, 0xff, 0xf5,
+    0x0, 0xed, 0x9, 0xf3, 0x5, 0xff, 0xf5, 0x9, 0xfe, 0xfd, 0x0, 0x5, 0xff, 0xf2, 0x19, 0xca,
+    0x20, 0x0, 0x2, 0x63, 0x0,
+
+    /* U+F0C5 "" */
+    0x0, 0x1, 0x44, 0x44, 0x31, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfb, 0x6b, 0x10, 0x0, 0x8, 0xff,
+    0xff, 0xb6, 0xfb, 0x7, 0x96, 0x8f, 0xff, 0xfc, 0x26, 0x61, 0xff, 0x98, 0xff, 0xff, 0xfc, 0xbb,
+    0x3f, 0xf9, 0x8f, 0xff, 0xff, 0xff, 0xf4, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xf9, 0x8f,
+    0xff, 0xff, 0xff, 0xf4, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xf9, 0x8f, 0xff, 0xff, 0xff,
+    0xf4, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xfa, 0x7f, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xe3,
+    0x22, 0x22, 0x22, 0x21, 0xf, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x9b, 0xbb, 0xbb, 0xbb, 0x70,
+    0x0, 0x0,
+
+    /* U+F0C7 "" */
+    0x25, 0x66, 0x66, 0x66, 0x52, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0xfd, 0x66, 0x66,
+    0x66, 0x9f, 0xe2, 0xf, 0xb0, 0x0, 0x0, 0x4, 0xff, 0xe1, 0xfb, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0x4f, 0xc2, 0x22, 0x22, 0x26, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xff, 0xff,
+    0xcb, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xa0, 0x6, 0xff, 0xff, 0x4f, 0xff, 0xf6, 0x0, 0x3f, 0xff,
+    0xf4, 0xff, 0xff, 0xc1, 0x9, 0xff, 0xff, 0x4f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf3, 0x8d, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xda, 0x0,
+
+    /* U+F0C9 "" */
+    0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x34, 0x44, 0x44, 0x44, 0x44, 0x43,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x31, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20,
+
+    /* U+F0E0 "" */
+    0x37, 0x88, 0x88, 0x88, 0x88, 0x88, 0x73, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xc3, 0x8f, 0xff, 0xff,
+    0xff, 0xf8, 0x3c, 0xfe, 0x64, 0xef, 0xff, 0xfe, 0x46, 0xef, 0xff, 0xfa, 0x2b, 0xff, 0xb2, 0xaf,
+    0xff, 0xff, 0xff, 0xd3, 0x55, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
+
+    /* U+F0E7 "" */
+    0x3, 0x44, 0x43, 0x0, 0x2, 0xff, 0xff, 0xf1, 0x0, 0x4f, 0xff, 0xfc, 0x0, 0x6, 0xff, 0xff,
+    0x70, 0x0, 0x8f, 0xff, 0xf2, 0x0, 0xa, 0xff, 0xff, 0xdd, 0xd8, 0xcf, 0xff, 0xff, 0xff, 0x7e,
+    0xff, 0xff, 0xff, 0xd0, 0x89, 0x9a, 0xff, 0xf4, 0x0, 0x0, 0x4f, 0xfb, 0x0, 0x0, 0x8, 0xff,
+    0x20, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x1f, 0xe1, 0x0, 0x0, 0x4, 0xf6, 0x0, 0x0, 0x0,
+    0x39, 0x0, 0x0, 0x0,
+
+    /* U+F0EA "" */
+    0x0, 0x1, 0x30, 0x0, 0x0, 0x0, 0x4, 0x66, 0xee, 0xb6, 0x63, 0x0, 0x0, 0xff, 0xfc, 0x1f,
+    0xff, 0xb0, 0x0, 0xf, 0xff, 0xfe, 0xff, 0xfb, 0x0, 0x0, 0xff, 0xfe, 0x64, 0x44, 0x30, 0x0,
+    0xf, 0xff, 0x96, 0xdd, 0xda, 0x56, 0x0, 0xff, 0xf8, 0x9f, 0xff, 0xb6, 0xf7, 0xf, 0xff, 0x89,
+    0xff, 0xfb, 0x4b, 0xb2, 0xff, 0xf8, 0x9f, 0xff, 0xe6, 0x66, 0x1f, 0xff, 0x89, 0xff, 0xff, 0xff,
+    0xf4, 0xff, 0xf8, 0x9f, 0xff, 0xff, 0xff, 0x4e, 0xff, 0x89, 0xff, 0xff, 0xff, 0xf4, 0x12, 0x21,
+    0x9f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x5b, 0xbb, 0xbb,
+    0xbb, 0x10,
+
+    /* U+F0F3 "" */
+    0x0, 0x0, 0x1, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xae, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8e,
+    0xfa, 0x30, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0x50, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xfe, 0x10,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x5f, 0xff,
+    0xff, 0xff, 0xf9, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
+    0x20, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x12, 0x22,
+    0x22, 0x22, 0x22, 0x21, 0x0, 0x0, 0x8, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xa2, 0x0,
+    0x0, 0x0,
+
+    /* U+F11C "" */
+    0x37, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x71, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0xfd, 0x4a, 0x84, 0xe4, 0x7b, 0x4b, 0x74, 0xfb, 0xfc, 0x8, 0x60, 0xd0, 0x4a, 0xa, 0x40, 0xfb,
+    0xff, 0xfe, 0xef, 0xde, 0xed, 0xfd, 0xef, 0xfb, 0xff, 0xf1, 0x3a, 0x9, 0x50, 0xd0, 0x5f, 0xfb,
+    0xff, 0xf7, 0x8c, 0x6b, 0x96, 0xe6, 0x9f, 0xfb, 0xfe, 0x8c, 0xb8, 0x88, 0x88, 0x8d, 0xa8, 0xfb,
+    0xfb, 0x8, 0x60, 0x0, 0x0, 0x9, 0x40, 0xfb, 0xfe, 0xbe, 0xdb, 0xbb, 0xbb, 0xbe, 0xdc, 0xfb,
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+
+    /* U+F124 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xfb, 0x0, 0x0,
+    0x0, 0x1, 0x7d, 0xff, 0xfd, 0x0, 0x0, 0x2, 0x8e, 0xff, 0xff, 0xf7, 0x0, 0x2, 0x9f, 0xff,
+    0xff, 0xff, 0xe1, 0x4, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x80, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x20, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x49, 0x99, 0x99, 0xef, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0x40, 0x0, 0x0,
+
+    /* U+F15B "" */
+    0x24, 0x44, 0x44, 0x2, 0x0, 0xe, 0xff, 0xff, 0xf2, 0xe4, 0x0, 0xff, 0xff, 0xff, 0x2f, 0xe4,
+    0xf, 0xff, 0xff, 0xf2, 0xff, 0xe3, 0xff, 0xff, 0xff, 0x34, 0x44, 0x2f, 0xff, 0xff, 0xfe, 0xdd,
+    0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x9b, 0xbb, 0xbb,
+    0xbb, 0xbb, 0x40,
+
+    /* U+F1EB "" */
+    0x0, 0x0, 0x0, 0x25, 0x55, 0x41, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9e, 0xff, 0xff, 0xff, 0xc7,
+    0x10, 0x0, 0x2, 0xbf, 0xff, 0xfe, 0xdd, 0xef, 0xff, 0xe6, 0x0, 0x5e, 0xff, 0xb5, 0x10, 0x0,
+    0x3, 0x8e, 0xff, 0xa1, 0xcf, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xf5, 0x28, 0x10, 0x5,
+    0xad, 0xee, 0xc7, 0x20, 0x4, 0x60, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xa5, 0x34, 0x7d, 0xff, 0x50, 0x0, 0x0, 0x2, 0xa3, 0x0, 0x0, 0x0, 0x77, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x86, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xca, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+F240 "" */
+    0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0xfc, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x4f, 0xe5, 0xfb, 0x6f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x2e, 0xf8, 0xfb, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4, 0xf8, 0xfb, 0x6f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x18, 0xf8, 0xfb, 0x38, 0x88, 0x88, 0x88, 0x88, 0x88, 0x2f, 0xf7, 0xfe,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaf, 0xb1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x0,
+
+    /* U+F241 "" */
+    0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0xfc, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x4f, 0xe5, 0xfb, 0x6f, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x2e, 0xf8, 0xfb, 0x6f, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x4, 0xf8, 0xfb, 0x6f, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x18, 0xf8, 0xfb, 0x38, 0x88, 0x88, 0x88, 0x83, 0x0, 0x2f, 0xf7, 0xfe,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaf, 0xb1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x0,
+
+    /* U+F242 "" */
+    0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0xfc, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x4f, 0xe5, 0xfb, 0x6f, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x2e, 0xf8, 0xfb, 0x6f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x4, 0xf8, 0xfb, 0x6f, 0xff,
+    0xff, 0xb0, 0x0, 0x0, 0x18, 0xf8, 0xfb, 0x38, 0x88, 0x88, 0x60, 0x0, 0x0, 0x2f, 0xf7, 0xfe,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaf, 0xb1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x0,
+
+    /* U+F243 "" */
+    0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0xfc, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x4f, 0xe5, 0xfb, 0x6f, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x2e, 0xf8, 0xfb, 0x6f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x4, 0xf8, 0xfb, 0x6f, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x18, 0xf8, 0xfb, 0x38, 0x88, 0x10, 0x0, 0x0, 0x0, 0x2f, 0xf7, 0xfe,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaf, 0xb1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x0,
+
+    /* U+F244 "" */
+    0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0xfc, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x4f, 0xe5, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xf8, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf8, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x18, 0xf8, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf7, 0xfe,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xaf, 0xb1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x0,
+
+    /* U+F287 "" */
+    0x0, 0x0, 0x0, 0x0, 0x5, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xaf, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8b, 0x6e, 0xf7, 0x0, 0x0, 0x0, 0x2, 0x10, 0x1, 0xe1, 0x2,
+    0x40, 0x0, 0x0, 0x0, 0x7f, 0xf6, 0x8, 0x80, 0x0, 0x0, 0x0, 0x59, 0x10, 0xef, 0xfe, 0xbf,
+    0xcb, 0xbb, 0xbb, 0xbb, 0xdf, 0xe4, 0xcf, 0xfb, 0x44, 0x4d, 0x74, 0x44, 0x44, 0x8f, 0x81, 0x29,
+    0x91, 0x0, 0x5, 0xb0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd3, 0x3c, 0xc8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xdf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x21, 0x0, 0x0,
+
+    /* U+F293 "" */
+    0x0, 0x0, 0x13, 0x32, 0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xd4, 0x0, 0x0, 0xcf, 0xfc, 0x7f,
+    0xff, 0x30, 0x6, 0xff, 0xfc, 0x9, 0xff, 0xb0, 0xb, 0xfd, 0xfc, 0x23, 0xaf, 0xf1, 0xe, 0xf5,
+    0x5c, 0x3b, 0x1e, 0xf3, 0x1f, 0xfe, 0x43, 0x12, 0xbf, 0xf5, 0x2f, 0xff, 0xe4, 0x9, 0xff, 0xf5,
+    0x1f, 0xff, 0xd1, 0x5, 0xff, 0xf5, 0x1f, 0xfc, 0x16, 0x24, 0x6f, 0xf5, 0xd, 0xf5, 0x9c, 0x3a,
+    0x1d, 0xf3, 0x9, 0xff, 0xfc, 0x12, 0xcf, 0xe0, 0x3, 0xff, 0xfd, 0x1c, 0xff, 0x80, 0x0, 0x6f,
+    0xfd, 0xcf, 0xfc, 0x10, 0x0, 0x2, 0x8a, 0xba, 0x61, 0x0,
+
+    /* U+F2ED "" */
+    0x0, 0x0, 0x34, 0x44, 0x0, 0x0, 0x5, 0x66, 0x7f, 0xff, 0xf9, 0x66, 0x61, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x45, 0x66, 0x66, 0x66, 0x66, 0x66, 0x61, 0x1b, 0xbb, 0xbb, 0xbb, 0xbb, 0xb4,
+    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x2f, 0xf3, 0xfb, 0x7f, 0x6d, 0xf6, 0x2, 0xff, 0x2f,
+    0xa7, 0xf5, 0xcf, 0x60, 0x2f, 0xf2, 0xfa, 0x7f, 0x5c, 0xf6, 0x2, 0xff, 0x2f, 0xa7, 0xf5, 0xcf,
+    0x60, 0x2f, 0xf2, 0xfa, 0x7f, 0x5c, 0xf6, 0x2, 0xff, 0x2f, 0xa7, 0xf5, 0xcf, 0x60, 0x2f, 0xf3,
+    0xfb, 0x7f, 0x6d, 0xf6, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x7, 0xbb, 0xbb, 0xbb, 0xbb,
+    0x91, 0x0,
+
+    /* U+F304 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x4, 0x39, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x4f,
+    0xe3, 0x9f, 0xfa, 0x0, 0x0, 0x4, 0xff, 0xfe, 0x39, 0xb0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xe3,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x4,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0xaa, 0x86, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F55A "" */
+    0x0, 0x0, 0x27, 0x88, 0x88, 0x88, 0x88, 0x87, 0x40, 0x0, 0x3, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0x0, 0x3e, 0xff, 0xff, 0xcf, 0xff, 0xcf, 0xff, 0xf7, 0x3, 0xef, 0xff, 0xf9, 0x8,
+    0xf8, 0x9, 0xff, 0xf8, 0x3e, 0xff, 0xff, 0xfd, 0x20, 0x40, 0x2d, 0xff, 0xf8, 0xef, 0xff, 0xff,
+    0xff, 0xd1, 0x1, 0xdf, 0xff, 0xf8, 0x9f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x8f, 0xff, 0xf8, 0x9,
+    0xff, 0xff, 0xf9, 0x2, 0xc2, 0x9, 0xff, 0xf8, 0x0, 0x9f, 0xff, 0xfd, 0x5d, 0xfd, 0x5d, 0xff,
+    0xf8, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x8e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xc1,
+
+    /* U+F7C2 "" */
+    0x0, 0x2, 0x44, 0x44, 0x41, 0x0, 0x4, 0xff, 0xff, 0xff, 0xe2, 0x4, 0xf8, 0xc9, 0xbb, 0x9f,
+    0x74, 0xff, 0x19, 0x47, 0x74, 0xf8, 0xff, 0xf1, 0x94, 0x77, 0x4f, 0x8f, 0xff, 0xde, 0xee, 0xee,
+    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3a, 0xbb, 0xbb,
+    0xbb, 0xb8, 0x0,
+
+    /* U+F8A2 "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xf1, 0x0,
+    0x1b, 0x40, 0x0, 0x0, 0x2, 0xff, 0x10, 0x2d, 0xf6, 0x0, 0x0, 0x0, 0x2f, 0xf1, 0x2d, 0xff,
+    0xa7, 0x77, 0x77, 0x78, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x5f, 0xff, 0xdb,
+    0xbb, 0xbb, 0xbb, 0xb9, 0x0, 0x4e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 60, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 60, .box_w = 2, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10, .adv_w = 88, .box_w = 5, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 20, .adv_w = 157, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 70, .adv_w = 139, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 133, .adv_w = 189, .box_w = 12, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 193, .adv_w = 154, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 243, .adv_w = 47, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 249, .adv_w = 75, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 277, .adv_w = 76, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 305, .adv_w = 90, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 323, .adv_w = 130, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 351, .adv_w = 51, .box_w = 3, .box_h = 4, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 357, .adv_w = 86, .box_w = 5, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 362, .adv_w = 51, .box_w = 3, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 365, .adv_w = 79, .box_w = 7, .box_h = 14, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 414, .adv_w = 149, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 459, .adv_w = 83, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 479, .adv_w = 129, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 519, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 559, .adv_w = 150, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 609, .adv_w = 129, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 649, .adv_w = 138, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 694, .adv_w = 134, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 734, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 779, .adv_w = 138, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 819, .adv_w = 51, .box_w = 3, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 831, .adv_w = 51, .box_w = 3, .box_h = 10, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 846, .adv_w = 130, .box_w = 8, .box_h = 6, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 870, .adv_w = 130, .box_w = 8, .box_h = 6, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 894, .adv_w = 130, .box_w = 8, .box_h = 6, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 918, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 953, .adv_w = 232, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1044, .adv_w = 164, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1099, .adv_w = 170, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1144, .adv_w = 162, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1194, .adv_w = 185, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1244, .adv_w = 150, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1284, .adv_w = 142, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1324, .adv_w = 173, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1374, .adv_w = 182, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1419, .adv_w = 69, .box_w = 2, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1429, .adv_w = 115, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1459, .adv_w = 161, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1504, .adv_w = 133, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1544, .adv_w = 214, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1599, .adv_w = 182, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1644, .adv_w = 188, .box_w = 12, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1704, .adv_w = 162, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1749, .adv_w = 188, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1821, .adv_w = 163, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1866, .adv_w = 139, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1911, .adv_w = 131, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1956, .adv_w = 177, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2001, .adv_w = 159, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2051, .adv_w = 252, .box_w = 16, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2131, .adv_w = 151, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2181, .adv_w = 145, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2226, .adv_w = 147, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2271, .adv_w = 75, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2299, .adv_w = 79, .box_w = 7, .box_h = 14, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 2348, .adv_w = 75, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2376, .adv_w = 131, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 2394, .adv_w = 112, .box_w = 7, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2398, .adv_w = 134, .box_w = 4, .box_h = 3, .ofs_x = 1, .ofs_y = 8},
+    {.bitmap_index = 2404, .adv_w = 134, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2436, .adv_w = 153, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2480, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2512, .adv_w = 153, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2562, .adv_w = 137, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2594, .adv_w = 79, .box_w = 6, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2627, .adv_w = 155, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2677, .adv_w = 153, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2721, .adv_w = 62, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2732, .adv_w = 64, .box_w = 5, .box_h = 14, .ofs_x = -2, .ofs_y = -3},
+    {.bitmap_index = 2767, .adv_w = 138, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2811, .adv_w = 62, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2822, .adv_w = 237, .box_w = 13, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2874, .adv_w = 153, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2906, .adv_w = 142, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2942, .adv_w = 153, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2986, .adv_w = 153, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3036, .adv_w = 92, .box_w = 5, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3056, .adv_w = 112, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3084, .adv_w = 93, .box_w = 6, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3114, .adv_w = 152, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3146, .adv_w = 125, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3178, .adv_w = 201, .box_w = 13, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3230, .adv_w = 124, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3262, .adv_w = 125, .box_w = 9, .box_h = 11, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 3312, .adv_w = 117, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3340, .adv_w = 79, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3375, .adv_w = 67, .box_w = 2, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3389, .adv_w = 79, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3424, .adv_w = 130, .box_w = 8, .box_h = 4, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 3440, .adv_w = 60, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3440, .adv_w = 60, .box_w = 2, .box_h = 11, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3451, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3499, .adv_w = 145, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3544, .adv_w = 157, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3589, .adv_w = 158, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3639, .adv_w = 67, .box_w = 2, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3653, .adv_w = 112, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3695, .adv_w = 134, .box_w = 5, .box_h = 3, .ofs_x = 2, .ofs_y = 8},
+    {.bitmap_index = 3703, .adv_w = 180, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3758, .adv_w = 90, .box_w = 5, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 3771, .adv_w = 113, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 3792, .adv_w = 130, .box_w = 8, .box_h = 5, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 3812, .adv_w = 86, .box_w = 5, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 3817, .adv_w = 180, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3872, .adv_w = 134, .box_w = 6, .box_h = 1, .ofs_x = 1, .ofs_y = 9},
+    {.bitmap_index = 3875, .adv_w = 94, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 3890, .adv_w = 130, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3926, .adv_w = 96, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 3947, .adv_w = 96, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 3968, .adv_w = 134, .box_w = 4, .box_h = 3, .ofs_x = 3, .ofs_y = 8},
+    {.bitmap_index = 3974, .adv_w = 153, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 4018, .adv_w = 145, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4070, .adv_w = 60, .box_w = 2, .box_h = 3, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 4073, .adv_w = 134, .box_w = 4, .box_h = 4, .ofs_x = 2, .ofs_y = -3},
+    {.bitmap_index = 4081, .adv_w = 96, .box_w = 5, .box_h = 7, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 4099, .adv_w = 94, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 4114, .adv_w = 113, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 4135, .adv_w = 232, .box_w = 14, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4205, .adv_w = 232, .box_w = 13, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4270, .adv_w = 232, .box_w = 15, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4345, .adv_w = 128, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 4384, .adv_w = 164, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4456, .adv_w = 164, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4528, .adv_w = 164, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4600, .adv_w = 164, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4672, .adv_w = 164, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4744, .adv_w = 164, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4821, .adv_w = 235, .box_w = 14, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4891, .adv_w = 162, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 4956, .adv_w = 150, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5008, .adv_w = 150, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5060, .adv_w = 150, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5112, .adv_w = 150, .box_w = 8, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5164, .adv_w = 69, .box_w = 4, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5190, .adv_w = 69, .box_w = 4, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5216, .adv_w = 69, .box_w = 6, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5255, .adv_w = 69, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5288, .adv_w = 187, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5343, .adv_w = 182, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5402, .adv_w = 188, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5480, .adv_w = 188, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5558, .adv_w = 188, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5636, .adv_w = 188, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5714, .adv_w = 188, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5792, .adv_w = 130, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 5810, .adv_w = 188, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5882, .adv_w = 177, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5941, .adv_w = 177, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6000, .adv_w = 177, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6059, .adv_w = 177, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6118, .adv_w = 145, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6177, .adv_w = 162, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6222, .adv_w = 151, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6266, .adv_w = 134, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6310, .adv_w = 134, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6354, .adv_w = 134, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6398, .adv_w = 134, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6442, .adv_w = 134, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6486, .adv_w = 134, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6534, .adv_w = 222, .box_w = 14, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6590, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6634, .adv_w = 137, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6678, .adv_w = 137, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6722, .adv_w = 137, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6766, .adv_w = 137, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6810, .adv_w = 62, .box_w = 4, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6832, .adv_w = 62, .box_w = 4, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6854, .adv_w = 62, .box_w = 4, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6876, .adv_w = 62, .box_w = 4, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6898, .adv_w = 143, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6948, .adv_w = 153, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6992, .adv_w = 142, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7042, .adv_w = 142, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7092, .adv_w = 142, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7142, .adv_w = 142, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7192, .adv_w = 142, .box_w = 9, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7242, .adv_w = 130, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 7274, .adv_w = 142, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7319, .adv_w = 152, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7363, .adv_w = 152, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7407, .adv_w = 152, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7451, .adv_w = 152, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7495, .adv_w = 125, .box_w = 9, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 7558, .adv_w = 153, .box_w = 8, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 7614, .adv_w = 125, .box_w = 9, .box_h = 14, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 7677, .adv_w = 112, .box_w = 7, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 7684, .adv_w = 224, .box_w = 14, .box_h = 2, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 7698, .adv_w = 51, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 7706, .adv_w = 51, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 7714, .adv_w = 93, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 7729, .adv_w = 93, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 7744, .adv_w = 70, .box_w = 3, .box_h = 4, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 7750, .adv_w = 155, .box_w = 9, .box_h = 2, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7759, .adv_w = 181, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7814, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 7919, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7996, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8087, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8164, .adv_w = 154, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8214, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 8319, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 8417, .adv_w = 252, .box_w = 16, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8521, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 8626, .adv_w = 252, .box_w = 16, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8714, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 8819, .adv_w = 112, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8858, .adv_w = 168, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8919, .adv_w = 252, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 9031, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9108, .adv_w = 154, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 9183, .adv_w = 196, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 9248, .adv_w = 196, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 9346, .adv_w = 196, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9431, .adv_w = 196, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9516, .adv_w = 196, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 9581, .adv_w = 196, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9666, .adv_w = 140, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9718, .adv_w = 140, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9770, .adv_w = 196, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 9855, .adv_w = 196, .box_w = 13, .box_h = 4, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 9881, .adv_w = 252, .box_w = 16, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9969, .adv_w = 280, .box_w = 18, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10104, .adv_w = 252, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10224, .adv_w = 224, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10315, .adv_w = 196, .box_w = 12, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 10363, .adv_w = 196, .box_w = 12, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 10411, .adv_w = 280, .box_w = 18, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10510, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10587, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10692, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10797, .adv_w = 196, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 10882, .adv_w = 196, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 10980, .adv_w = 196, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 11065, .adv_w = 196, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 11143, .adv_w = 224, .box_w = 14, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11220, .adv_w = 140, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 11288, .adv_w = 196, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 11386, .adv_w = 196, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 11484, .adv_w = 252, .box_w = 16, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11572, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 11677, .adv_w = 168, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 11760, .adv_w = 280, .box_w = 18, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 11877, .adv_w = 280, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11967, .adv_w = 280, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12057, .adv_w = 280, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12147, .adv_w = 280, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12237, .adv_w = 280, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12327, .adv_w = 280, .box_w = 18, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 12435, .adv_w = 196, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 12525, .adv_w = 196, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 12623, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 12728, .adv_w = 280, .box_w = 18, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12827, .adv_w = 168, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 12910, .adv_w = 225, .box_w = 15, .box_h = 10, .ofs_x = 0, .ofs_y = 0}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_2[] = {
+    0x0, 0x1, 0x5, 0x6, 0x9, 0xa, 0xf, 0x13,
+    0x99, 0xcfee, 0xcff5, 0xcff8, 0xcff9, 0xcffa, 0xcffe, 0xd000,
+    0xd002, 0xd006, 0xd009, 0xd00e, 0xd013, 0xd014, 0xd015, 0xd02b,
+    0xd030, 0xd035, 0xd038, 0xd039, 0xd03a, 0xd03e, 0xd03f, 0xd040,
+    0xd041, 0xd054, 0xd055, 0xd05b, 0xd05d, 0xd05e, 0xd061, 0xd064,
+    0xd065, 0xd066, 0xd068, 0xd080, 0xd082, 0xd0b1, 0xd0b2, 0xd0b4,
+    0xd0b6, 0xd0cd, 0xd0d4, 0xd0d7, 0xd0e0, 0xd109, 0xd111, 0xd148,
+    0xd1d8, 0xd22d, 0xd22e, 0xd22f, 0xd230, 0xd231, 0xd274, 0xd280,
+    0xd2da, 0xd2f1, 0xd547, 0xd7af, 0xd88f
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 160, .range_length = 96, .glyph_id_start = 96,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 8211, .range_length = 55440, .glyph_id_start = 192,
+        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 69, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17, 18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27, 28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37, 37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50, 51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58, 58, 59, 58, 60, 41, 0, 0, 9,
+    0, 61, 47, 62, 63, 64, 0, 65, 0, 22, 8, 66, 0, 9, 22, 0,
+    67, 0, 0, 0, 0, 51, 29, 9, 0, 0, 8, 9, 0, 0, 0, 68,
+    23, 23, 23, 23, 23, 23, 26, 25, 26, 26, 26, 26, 29, 29, 29, 29,
+    22, 29, 22, 22, 22, 22, 22, 0, 22, 30, 30, 30, 30, 39, 69, 46,
+    45, 45, 45, 45, 45, 45, 49, 47, 49, 49, 49, 49, 51, 51, 70, 51,
+    71, 45, 46, 46, 46, 46, 46, 9, 46, 51, 51, 51, 51, 58, 46, 58,
+    0, 0, 72, 73, 72, 73, 9, 10, 25, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12, 18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25, 23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29, 29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0, 39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46, 46, 47, 48, 49, 0, 0, 35, 9,
+    0, 50, 39, 51, 52, 53, 0, 54, 0, 23, 8, 9, 9, 9, 23, 0,
+    55, 0, 0, 0, 0, 42, 56, 9, 0, 0, 8, 57, 0, 0, 0, 58,
+    24, 24, 24, 24, 24, 24, 24, 23, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 23, 23, 23, 23, 23, 0, 23, 28, 28, 28, 28, 31, 25, 38,
+    37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 39, 39, 59, 42, 60, 61,
+    62, 42, 39, 39, 39, 39, 39, 9, 39, 45, 45, 45, 45, 46, 38, 46,
+    0, 0, 63, 64, 63, 64, 9, 10, 52, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 1, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 2, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 5, 4, 0, 2, 0, 4, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 10, 0, 6, -5, 0, 0, 4, 0, -12, -13, 2, 11, 5, 4, -9,
+    2, 11, 1, 9, 2, 7, 0, -10, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 13, 2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, 4, 0, 4, 10, 0, -10, 0, 0, 0, 0, 0, 0,
+    0, -7, 0, 0, 0, 0, 0, -4, 4, 4, 0, 0, -2, 0, -2, 2,
+    0, -2, 0, -2, -1, -4, 0, 0, 0, 0, -2, 0, 0, -3, -3, 0,
+    0, -2, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2,
+    0, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, 0, 0, 0, -6, -2,
+    0, -6, 0, -27, 0, 0, -4, -11, 4, 7, 0, 0, -4, 2, 2, 7,
+    4, -4, 4, 0, 0, -13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -8, 0, 0, 3, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -6, 0, 0, 0, 0, 0, 0, 5, -4, -4,
+    -3, -11, 0, -9, -2, 0, 0, -7, 0, 0, 9, 0, -7, -2, -1, 1,
+    0, -4, 0, 0, -2, -17, 0, 3, 0, 7, -6, 0, -4, 0, -9, 3,
+    0, -18, -2, 9, 2, 0, 0, 0, 0, 0, 0, 2, 0, -3, -1, -3,
+    0, -2, 0, 0, 0, 0, -9, -10, 0, -1, 0, 0, 0, 0, -7, -6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 2, 0, 0, -4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0,
+    0, 9, 2, 1, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -8, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 4, 2, 7, -2, 0, 0, 4, -2, -7, -31, 2, 6, 4, 0, -3,
+    0, 8, 0, 7, 0, 7, 0, -21, 0, -3, 7, 0, 7, -2, 4, 2,
+    0, 0, 1, -2, 0, 0, -4, 18, 0, 18, 0, 7, 0, 9, 3, 9,
+    4, 0, 0, 2, 0, 0, 7, 8, 3, -18, 18, 18, 18, -4, 7, 7,
+    0, 0, -4, -8, 0, 0, 0, -2, 1, -2, 0, 2, -4, -3, -4, 2,
+    0, -2, 0, 0, 0, -9, 2, -4, 0, -4, -7, 0, -5, -4, -7, 0,
+    0, -15, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, -3, -5, -3,
+    -3, 0, 0, 2, -5, 2, 0, -19, -2, 0, 0, 0, 0, 2, 0, 0,
+    1, -12, 2, -14, 0, 0, 0, -7, -2, 0, 22, -3, -3, 2, 2, -2,
+    0, -3, 2, 0, 0, -12, -4, 7, 0, 13, -7, -2, -8, 0, -8, 4,
+    0, -22, 0, 2, 2, 0, -3, 0, 2, 0, 0, -2, -3, -7, 0, -7,
+    0, 1, 0, -2, -7, 0, -14, -29, 1, 2, 0, 0, 0, -3, -4, -4,
+    0, 13, -4, 0, -8, 0, 7, 0, -15, -22, -15, -4, 7, 0, 0, -15,
+    0, 3, -5, 0, -3, 0, -4, -9, 0, -2, 7, 0, 7, 0, 7, 0,
+    0, 6, 7, -27, -15, 0, -15, 2, 1, -15, -15, -6, -15, -7, -13, -7,
+    -15, -15, -2, 0, 9, -4, 11, 0, -11, -17, -15, -15, -15, -11, 11, 12,
+    0, 2, 0, 0, 0, 0, 0, 2, 2, -3, -4, 0, -1, -1, -2, 0,
+    0, -2, 0, 0, 0, -4, 0, -2, 0, -5, -4, 0, -6, -7, -7, -4,
+    0, -4, 0, -4, 0, 0, 0, 0, -2, 0, 0, 2, 0, 2, -2, 2,
+    0, 0, 0, 0, -3, 0, 1, 0, 0, -7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, -2, 0, 0, 0, -2, 2, 2, -1, 0, 0, 0, -4,
+    0, -1, 0, 0, 0, 0, 0, 1, 0, 3, -2, 0, -3, 0, -4, 0,
+    0, -2, 0, 7, 0, 0, -2, 0, 0, 0, 0, 0, -1, 1, -2, 1,
+    -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0,
+    0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    -2, -3, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, -2, -2, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, -3, -2,
+    0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -7, -2, -7, 4, 0, 0, -4, 2, 4, 6, 0, -6, -1, -3, 0,
+    -1, -11, 2, -2, 2, -12, 2, 0, 0, 1, -12, 0, -12, -2, -19, -2,
+    0, -11, 0, 4, 6, 0, 3, 0, 0, 0, 0, 0, 0, -4, -3, -4,
+    0, 0, 2, 2, -2, 5, -7, -4, 0, 2, 0, 0, 0, 3, -5, -2,
+    0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0,
+    -1, -3, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, -2, -3, -2, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2,
+    0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -4, 2, 0, 0, -3, 1, 2, 2, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 2, 0, 0, -2, 0, -2, -2, -3, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, -2, 0, 0, 0, 0, -2, -3, -2,
+    0, 0, 0, 2, 0, 4, -4, 0, 0, 0, 0, 0, 0, 2, -2, 0,
+    0, 7, -2, 1, -7, 0, 0, 6, -11, -12, -9, -4, 2, 0, -2, -15,
+    -4, 0, -4, 0, -4, 3, -4, -14, 0, -6, 0, 0, 1, -1, 2, -2,
+    0, 2, 0, -7, -9, 0, -11, -5, -5, -5, -7, -3, -6, 0, -4, 0,
+    -6, -6, -3, -4, 3, -2, 1, 6, -4, -14, -5, -5, -5, -11, 2, 4,
+    0, 1, 0, -2, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, -1, 0, -1, -2, 0, -4, -5, -5, -1,
+    0, -7, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, -1, 1,
+    0, 0, 0, 0, -2, 2, 0, 0, 0, -4, 0, 0, 0, 0, -1, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, -2, 0, 2, 0, 8, -2, 0, -5, -2, -8, 0,
+    0, -4, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, -2, 2,
+    0, 0, 0, 0, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 0, -4, 0, 0, 3, 0, -11, -7, 0, 0, 0, -3, -11,
+    0, 0, -2, 2, 0, -6, -1, -10, 0, -6, 0, 0, -3, -4, -3, -2,
+    -4, 0, 0, -4, 0, 0, -2, 0, 0, 0, 0, 0, 0, 2, 0, 2,
+    0, -2, 0, 0, -3, 0, 2, 0, 2, -24, 0, 0, 0, -2, 5, 5,
+    0, -4, 0, 0, 0, 0, 3, 0, 2, -4, -4, 0, -2, -2, -3, 0,
+    0, 0, 0, 0, 0, -7, 0, -2, 0, -3, -2, 0, -5, -6, -7, -2,
+    0, -4, 0, -7, 0, 0, 0, 0, 18, 0, 0, 1, 0, 0, -3, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, -4, 0, 0, 0, 0, -3, -3,
+    0, -10, 0, 0, 0, 0, 0, -21, -4, 7, 7, -2, -9, 0, 2, -3,
+    0, -11, -1, -3, 2, -16, -2, 3, 0, 3, -8, -3, -8, -7, -9, 0,
+    0, -13, 0, 13, 0, 0, -1, 0, 0, 0, -1, -1, -2, -6, -7, -6,
+    0, 2, 0, 0, 0, 0, -21, -18, 3, 4, 0, 0, 0, -1, -7, -7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -2, -3, 0,
+    0, -4, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1,
+    0, 0, -1, 0, -4, 0, 0, 4, -1, 3, 0, -5, 2, -2, -1, -6,
+    -2, 0, -3, -2, -2, 0, -3, -4, 0, 0, -2, -1, -2, -4, -3, 0,
+    0, -2, 0, 2, -2, 0, -5, 0, 0, 0, -4, 0, -4, 0, -4, 0,
+    -4, -2, 0, 0, 0, -2, 2, 2, -1, -3, 0, 0, 0, -5, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, -4, 2, 0, -3, 0, -2, -3, -7,
+    -2, -2, -2, -1, -2, -3, -1, 0, 0, 0, 0, 0, -2, -2, -2, 0,
+    0, 0, 0, 3, -2, 0, -2, 0, 0, 0, -2, -3, -2, -2, -3, -2,
+    -2, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0,
+    2, 9, -1, 0, -6, 0, -2, 4, 0, -2, -9, -3, 3, 0, 0, -11,
+    -4, 2, -4, 2, 0, -2, -2, -7, 0, -3, 1, 0, 0, -4, 0, 0,
+    0, 2, 2, -4, -4, 0, -4, -2, -3, -2, -2, 0, -4, 1, -4, 1,
+    -4, -2, 0, 0, 0, -2, 7, 2, -3, -11, -2, 3, 1, -4, 4, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -3, 0, 0, -2, -2, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, -4, 0, 0, 0, -7, 0, 2, -5, 4, 0, -2, -11,
+    0, 0, -5, -2, 0, -9, -6, -6, 0, 0, -10, -2, -9, -9, -11, 0,
+    -6, 0, 2, 15, -3, 0, -5, -2, -1, -2, -4, -6, -4, -8, -9, -8,
+    -5, 0, 0, 0, 0, 0, -2, -2, -1, 0, -2, -2, -2, -5, -4, 0,
+    0, 0, -2, 0, 1, 0, 0, -16, -2, 7, 5, -5, -8, 0, 1, -7,
+    0, -11, -2, -2, 4, -21, -3, 1, 0, 0, -15, -3, -12, -2, -16, 0,
+    0, -16, 0, 13, 1, 0, -2, 0, 0, 0, 0, -1, -2, -9, -2, -9,
+    0, 0, 0, 0, 0, 0, -15, -17, 2, 0, 0, 0, 0, -2, -10, -11,
+    0, 0, 0, 0, -7, 0, -2, 0, -1, -6, -11, 0, 0, -1, -3, -7,
+    -2, 0, -2, 0, 0, 0, 0, -10, -2, -7, -7, -2, -4, -6, -2, -4,
+    0, -4, -2, -7, -3, 0, -3, -4, -2, -4, 0, 1, 0, -2, -7, -2,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, -12, -4, -4, -4, -3, 0, 2,
+    0, -4, 0, 0, 0, 0, 3, 0, 2, -4, 9, 0, -2, -2, -3, 0,
+    0, 0, 0, 0, 0, -7, 0, -2, 0, -3, -2, 0, -5, -6, -7, -2,
+    0, -4, 2, 9, 0, 0, 0, 0, 18, 0, 0, 1, 0, 0, -3, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, -4, 0, 0, 0, 0, -3, -3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -4,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2, 0, 0, -4, -2, 0,
+    0, -4, 0, 4, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 0, 0, -2, 0, 0, 0, 0, 1, 0,
+    4, 2, -2, 0, -7, -4, 0, 7, -7, -7, -4, -4, 9, 4, 2, -19,
+    -2, 4, -2, 0, -2, 2, -2, -8, 0, -2, 2, -3, -2, -7, -2, 0,
+    0, 7, 4, 0, -6, 0, -12, -3, 6, -3, -9, 1, -3, -7, -7, -7,
+    -2, -4, 0, 0, 0, 0, 9, 7, -3, -13, 3, 8, 4, -12, 6, 6,
+    2, 0, -3, 0, -6, 0, 2, 7, -5, -8, -9, -6, 7, 0, 1, -16,
+    -2, 2, -4, -2, -5, 0, -5, -8, -3, -3, -2, 0, 0, -5, -5, -2,
+    0, 7, 5, -2, -12, 0, -12, -3, 0, -8, -13, -1, -7, -4, -7, -4,
+    -6, -7, 0, 0, 0, 0, 6, 5, -3, -16, 4, 8, 4, -12, 4, 7,
+    0, 0, -3, 0, -4, -2, 0, -2, -4, 0, 4, -7, 2, 0, 0, -12,
+    0, -2, -5, -4, -2, -7, -6, -7, -5, 0, -7, -2, -5, -4, -7, -2,
+    0, 0, 1, 11, -4, 0, -7, -2, 0, -2, -4, -5, -6, -6, -9, -6,
+    -3, -2, 0, 0, 0, 0, -4, 0, -2, 1, -2, -2, -2, -7, 0, 2,
+    4, 0, -3, 0, -11, -3, 1, 4, -7, -8, -4, -7, 7, -2, 1, -21,
+    -4, 4, -5, -4, -8, 0, -7, -9, -3, -2, -2, -2, -5, -7, -1, 0,
+    0, 7, 6, -2, -15, 0, -13, -5, 5, -9, -15, -4, -8, -9, -11, -9,
+    -7, -9, 0, 0, 0, -4, 4, 5, -4, -18, 7, 6, 5, -13, 3, 6,
+    0, 0, 0, 0, -3, 0, 0, 2, -3, 4, 2, -4, 4, 0, 0, -7,
+    -1, 0, -1, 0, 1, 1, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, 2, 7, 0, 0, -3, 0, 0, 0, 0, -2, -2, -3, 0, -3,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0,
+    1, 2, 0, 0, 0, 0, 2, 1, -2, 0, 9, 0, 4, 1, 1, -3,
+    0, 4, 0, 0, 0, 2, 0, 0, 0, 0, 4, 0, 5, 1, 6, 0,
+    0, 7, 0, 6, -2, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 3, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -13, 0, -2, 4, 0, 7, -31, 0, 22, 3, -4, -4, 2, 2, -2,
+    1, -11, 0, 0, 11, -13, -4, 7, 0, 7, -4, -2, -9, 4, -4, 0,
+    0, -15, 9, 31, 0, 0, 0, 0, 27, 0, 0, 0, 0, 4, 0, 4,
+    0, 9, 0, 0, 0, 7, -13, -7, 2, 7, 0, 0, 0, 0, -12, -12,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -4, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 4, -6, 0, 0, 1, -2, 0, 2, 29, -4, -2, 7, 6, -6,
+    2, 0, 0, 2, 2, -3, -7, 13, 7, 18, 0, -2, -2, 11, -2, 4,
+    0, -29, 6, 0, -2, 0, -6, 0, 24, 0, 2, -4, -6, -3, 8, 4,
+    6, 2, 4, -2, -2, 6, 0, -16, 2, 0, 0, 0, 0, -6, 0, 0,
+    0, 0, 0, -6, 0, 0, 0, -6, 0, 0, 0, 0, -5, -1, 0, 0,
+    0, -5, 0, -3, 0, -11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -15, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -2, 0, -2,
+    0, 0, 0, 0, 0, 0, -4, -5, 0, 0, 0, 0, 0, 1, -3, -2,
+    0, -3, 0, -6, 0, 0, 0, -4, 2, -3, 0, 0, -6, -2, -5, 0,
+    0, -6, 0, -2, 0, -11, 0, -2, 0, 0, -18, -4, -9, -2, -8, 0,
+    0, -15, 0, -6, -1, 0, 0, 0, 0, 0, 0, 0, 0, -3, -4, -3,
+    -2, 0, 0, 0, 0, 0, -4, -5, 0, -2, 0, 0, 0, 0, -3, 0,
+    0, 0, 0, 0, -5, 0, -5, 3, -2, 4, 0, -2, -5, -2, -4, -4,
+    0, -3, -1, -2, 2, -6, -1, 0, 0, 0, -20, -2, -3, 0, -5, 0,
+    -2, -11, -2, 0, 0, -2, -2, 0, 0, 0, 0, 2, 0, -2, -4, -2,
+    -2, 0, 0, 0, 0, -2, 4, 0, 0, -2, 0, 0, 0, -2, 4, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -5, 0, -2, 0, 0, 0, -4, 2, 0, 0, 0, -6, -2, -4, 0,
+    0, -6, 0, -2, 0, -11, 0, 0, 0, 0, -22, 0, -4, -8, -11, 0,
+    0, -15, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, -3, -2,
+    -1, 0, 0, 0, 0, 0, -3, -4, 0, -2, 0, 0, 0, 0, -3, 0,
+    1, 0, 0, 4, -3, 0, 7, 11, -2, -2, -7, 3, 11, 4, 5, -6,
+    3, 9, 3, 6, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 11, -4, -2, 0, -2, 18, 10, 18, 0, 0, 0, 2, 0, 2,
+    0, 0, 0, 0, 0, 0, 8, 9, -1, -3, 15, 11, 13, -2, 11, 16,
+    0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, -19, -3, -2, -9, -11, 0,
+    0, -15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, -19, -3, -2, -9, -11, 0,
+    0, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, -5, 2, 0, -2, 2, 4, 2, -7,
+    0, 0, -2, 2, 0, 2, 0, 0, 0, 0, -6, 0, -2, -2, -4, 0,
+    -2, -9, 0, 14, -2, 0, -5, -2, 0, -2, -4, 0, -2, -6, -4, -6,
+    -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -5, 1, 0,
+    0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, -19, -3, -2, -9, -11, 0,
+    0, -15, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, -7, -3, -2, 7, -2, -2, -9, 1, -1, 1, -2, -6,
+    0, 5, 0, 2, 1, 2, -5, -9, -3, 0, -9, -4, -6, -9, -9, 0,
+    -4, -4, -3, -3, -2, -2, -3, -2, 0, -2, -1, 3, 0, 3, -2, 3,
+    0, 0, 0, 0, 0, 2, 7, 7, 1, -8, -2, -2, -2, -3, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, 0,
+    0, -6, 0, -1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2,
+    0, 0, 0, 0, 0, 0, -3, -5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, -4, -2, 2, 0, -4, -4, -2, 0, -6,
+    -2, -5, -2, -3, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -15, 0, 7, 0, 0, -4, 0, 0, 0, 0, -3, 0, -2, 0, -2,
+    0, 0, 0, 0, 0, -2, -1, -4, 0, 0, 0, 0, 0, -4, -2, 0,
+    0, 0, -2, 0, -5, 0, 0, 9, -3, -7, -7, 2, 2, 2, 0, -6,
+    2, 3, 2, 7, 2, 7, -2, -6, 0, 0, -9, 0, 0, -7, -6, 0,
+    0, -4, 0, -3, -4, 0, -3, 0, -3, 0, -2, 3, 0, -2, -7, -2,
+    -2, 0, 0, 0, 0, 0, 8, 7, 0, -7, 0, 0, 0, -3, 7, 4,
+    0, 0, -2, 0, -4, 0, 0, 3, -5, 0, 2, -2, 2, 0, 0, -7,
+    0, -2, -1, 0, -2, 2, -2, 0, 0, 0, -9, -3, -5, 0, -7, 0,
+    0, -11, 0, 8, -2, 0, -4, 0, 1, 0, -2, 0, -2, -7, 0, -7,
+    -2, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, -4, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 2, -3, 1, 0, 0, -3, -2, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -14, 0, 5, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, -2, -2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 9, 0, -4, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 2, 0, 2, -4, 0, -7, -2, -9, 0,
+    0, -12, 1, 2, 0, 0, 0, 0, 15, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, -2, 0, -8, 0, 0, 6, -7, -1, 3, -8, 4, -2, -2, -8,
+    -3, 2, -7, -4, -7, 0, -3, -10, 0, -4, 0, 0, 0, -2, 2, 0,
+    0, 4, 1, 4, -9, 0, -7, -4, -6, -4, -9, -4, -6, -4, -6, -4,
+    -9, -6, 0, 0, 0, -2, 0, 3, -3, -5, -4, 6, 2, -7, -1, 1,
+    0, 0, 0, 0, 0, 0, 0, 2, 2, -2, 0, 0, 0, -2, 0, 0,
+    0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0,
+    2, 4, 0, 0, 0, 0, 3, 0, -5, -7, -7, -3, 7, 0, 2, -2,
+    0, 6, -2, 0, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 11, 3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, 0, 0, 0, 0, 0, 0, 0, -9, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 5, 0, 0, 0, 0, 4,
+    0, 2, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 3, -2, 1, 2, 0, -1, 0, 0, 2,
+    2, 0, 0, 0, 0, -2, 0, 3, 0, 7, -3, 0, -3, -2, -4, 0,
+    0, -13, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 5, 0, 0, 0, 7, 0, -14, -13, 1, 10, 7, 4, -9,
+    2, 9, 0, 8, 0, 4, 2, -21, 0, -2, 9, 0, 6, -4, 4, 0,
+    0, 12, 0, 0, 0, 0, -4, 0, 0, 0, -1, 4, 0, 8, 2, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -14, 0, 0, 0, -4, 0, 0,
+    -1, -8, 0, -13, -4, 0, 0, -19, -9, 1, 9, -11, -10, 0, 0, -10,
+    0, -10, -10, 0, -1, -30, -12, 3, 0, 0, -13, -8, -15, 2, -17, 0,
+    0, -21, 2, 11, -4, 0, -7, -3, 16, -3, -2, -3, -11, -11, 2, -5,
+    0, 0, 2, -4, -11, 1, -13, -20, -2, -6, -3, -3, -3, -7, -5, -4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -5, -7, 0, -4, -6, -4, 0,
+    -2, 0, 0, 0, 0, -7, 0, -7, 0, -9, -6, 0, -2, -7, -7, -4,
+    0, -9, 0, -7, -2, 0, 0, 0, -2, 0, 0, 1, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -6, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, 0, 0, 18, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0, 0, 0, -19, -3, -2, -9, -11, 0,
+    0, -15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, -4, 0, 2, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, -2, 0, 0, 0, 0, 0, 2,
+    1, 0, 2, 9, -3, 0, 0, 7, 0, -4, -12, 0, 8, 3, 4, -8,
+    0, 9, -1, 7, 0, 8, 0, -7, 0, -1, 6, 0, 4, 0, 3, 0,
+    0, 12, 0, 0, -1, 0, -3, 7, 0, 7, 0, 4, 0, 7, 0, 7,
+    0, 1, 0, 0, 0, 2, 0, 8, 0, -7, 7, 7, 7, -3, 6, 6,
+    1, 0, 2, 9, -3, 0, 0, 7, 0, -4, -12, 0, 11, 4, 4, -13,
+    0, 6, 0, 2, 0, 8, 0, -7, 0, 0, 6, 0, 7, 2, 6, 0,
+    0, 12, 0, 0, -2, 0, -6, 0, 0, 0, -4, 1, 0, 4, 0, 4,
+    0, 1, 0, 0, 2, 2, 0, 8, 0, -7, 0, 0, 0, -6, 6, 6
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 73,
+    .right_class_cnt     = 64,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 3,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = LV_FONT_FMT_TXT_PLAIN,
+    .cache = &cache
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t lv_font_montserrat_14 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 16,          /*The maximum line height required by the font*/
+    .base_line = 3,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
@@ -0,0 +1,1066 @@
+/*******************************************************************************
+ * Size: 16 px
+ * Bpp: 4
+ * Charset: ascii, 110 glyphs
+ * Generated by tools/fonts/gen_fonts.py from Montserrat-Medium.ttf and FontAwesome5-Solid+Brands+Regular.woff. Do not edit.
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x23, 0xb, 0xf0, 0xaf, 0xa, 0xe0, 0x9e, 0x9, 0xd0, 0x8c, 0x8, 0xc0, 0x35, 0x0, 0x0, 0x9d,
+    0x1a, 0xd1,
+
+    /* U+0022 "\"" */
+    0x31, 0x3, 0x1f, 0x51, 0xf3, 0xe5, 0x1f, 0x3e, 0x41, 0xf3, 0xe4, 0xf, 0x22, 0x0, 0x20,
+
+    /* U+0023 "#" */
+    0x0, 0x1, 0x20, 0x1, 0x30, 0x0, 0x0, 0x6b, 0x0, 0x4d, 0x0, 0x0, 0x8, 0x90, 0x6, 0xb0,
+    0x0, 0x55, 0xba, 0x55, 0xab, 0x54, 0x1d, 0xdf, 0xdd, 0xde, 0xed, 0xa0, 0x0, 0xe4, 0x0, 0xb6,
+    0x0, 0x0, 0x1f, 0x20, 0xd, 0x40, 0x0, 0x13, 0xf1, 0x11, 0xf3, 0x10, 0x9f, 0xff, 0xff, 0xff,
+    0xff, 0x51, 0x27, 0xb2, 0x25, 0xd2, 0x21, 0x0, 0x89, 0x0, 0x6c, 0x0, 0x0, 0xa, 0x70, 0x7,
+    0xa0, 0x0,
+
+    /* U+0024 "$" */
+    0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x0, 0x79, 0x0, 0x0, 0x0, 0x2, 0x9a, 0x20, 0x0, 0x1,
+    0xbf, 0xff, 0xfe, 0x70, 0xa, 0xe6, 0x89, 0x39, 0x70, 0xf, 0x90, 0x79, 0x0, 0x0, 0xe, 0xb0,
+    0x79, 0x0, 0x0, 0x8, 0xfd, 0xba, 0x0, 0x0, 0x0, 0x5b, 0xff, 0xe9, 0x10, 0x0, 0x0, 0x7b,
+    0xaf, 0xc0, 0x0, 0x0, 0x79, 0x7, 0xf3, 0x4, 0x0, 0x79, 0x6, 0xf3, 0x3f, 0xb6, 0x9b, 0x7e,
+    0xc0, 0x4, 0xbe, 0xff, 0xd9, 0x10, 0x0, 0x0, 0x79, 0x0, 0x0, 0x0, 0x0, 0x67, 0x0, 0x0,
+
+    /* U+0025 "%" */
+    0x0, 0x23, 0x0, 0x0, 0x0, 0x30, 0x0, 0x8d, 0xad, 0x10, 0x0, 0x8b, 0x0, 0x3d, 0x10, 0x88,
+    0x0, 0x3e, 0x10, 0x5, 0xa0, 0x4, 0xb0, 0x1d, 0x50, 0x0, 0x4b, 0x0, 0x5a, 0x9, 0xa0, 0x0,
+    0x1, 0xd5, 0x3c, 0x54, 0xd1, 0x0, 0x0, 0x2, 0xab, 0x61, 0xd4, 0x4d, 0xea, 0x10, 0x0, 0x0,
+    0x99, 0x1d, 0x30, 0x98, 0x0, 0x0, 0x5d, 0x13, 0xc0, 0x3, 0xc0, 0x0, 0x1e, 0x40, 0x4c, 0x0,
+    0x3c, 0x0, 0xa, 0x80, 0x1, 0xe2, 0x9, 0x90, 0x5, 0xd1, 0x0, 0x4, 0xcc, 0xa1,
+
+    /* U+0026 "&" */
+    0x0, 0x0, 0x34, 0x10, 0x0, 0x0, 0x3, 0xde, 0xde, 0x40, 0x0, 0x0, 0xbb, 0x0, 0x9c, 0x0,
+    0x0, 0xd, 0x90, 0x8, 0xc0, 0x0, 0x0, 0x8e, 0x37, 0xf5, 0x0, 0x0, 0x1, 0xcf, 0xe5, 0x0,
+    0x0, 0x0, 0x9f, 0xde, 0x20, 0x2, 0x0, 0xad, 0x21, 0xce, 0x24, 0xf1, 0x2f, 0x50, 0x1, 0xce,
+    0xbc, 0x3, 0xf5, 0x0, 0x1, 0xcf, 0x60, 0xd, 0xe6, 0x34, 0x8f, 0xde, 0x30, 0x2a, 0xef, 0xeb,
+    0x41, 0xb6,
+
+    /* U+0027 "'" */
+    0x31, 0xf5, 0xe5, 0xe4, 0xe4, 0x20,
+
+    /* U+0028 "(" */
+    0x0, 0xa9, 0x4, 0xf3, 0xa, 0xd0, 0xe, 0x80, 0x3f, 0x50, 0x5f, 0x20, 0x6f, 0x10, 0x7f, 0x10,
+    0x6f, 0x10, 0x5f, 0x20, 0x3f, 0x40, 0x1f, 0x70, 0xb, 0xc0, 0x5, 0xf2, 0x0, 0xc9,
+
+    /* U+0029 ")" */
+    0x4d, 0x30, 0xc, 0xa0, 0x7, 0xf1, 0x2, 0xf6, 0x0, 0xe9, 0x0, 0xbb, 0x0, 0xac, 0x0, 0x9d,
+    0x0, 0xad, 0x0, 0xbc, 0x0, 0xd9, 0x1, 0xf6, 0x6, 0xf2, 0xb, 0xb0, 0x4f, 0x40,
+
+    /* U+002A "*" */
+    0x0, 0x49, 0x0, 0x57, 0x4a, 0x39, 0x2b, 0xee, 0xd6, 0x17, 0xff, 0xb3, 0x7a, 0x6a, 0x6c, 0x0,
+    0x4a, 0x0, 0x0, 0x1, 0x0,
+
+    /* U+002B "+" */
+    0x0, 0x2, 0x10, 0x0, 0x0, 0xf, 0x50, 0x0, 0x0, 0xf, 0x50, 0x0, 0x33, 0x4f, 0x73, 0x31,
+    0xef, 0xff, 0xff, 0xf4, 0x11, 0x1f, 0x51, 0x10, 0x0, 0xf, 0x50, 0x0, 0x0, 0xe, 0x40, 0x0,
+
+    /* U+002C "," */
+    0x1, 0x2, 0xeb, 0x1e, 0xc0, 0xa7, 0xe, 0x20, 0x40,
+
+    /* U+002D "-" */
+    0x1, 0x11, 0x10, 0x1f, 0xff, 0xf3, 0x4, 0x44, 0x41,
+
+    /* U+002E "." */
+    0x1, 0x2, 0xeb, 0x2e, 0xa0,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x2, 0x71, 0x0, 0x0, 0x8, 0xd0, 0x0, 0x0, 0xd, 0x80, 0x0, 0x0, 0x3f, 0x30,
+    0x0, 0x0, 0x9c, 0x0, 0x0, 0x0, 0xe7, 0x0, 0x0, 0x4, 0xf2, 0x0, 0x0, 0x9, 0xb0, 0x0,
+    0x0, 0x1e, 0x60, 0x0, 0x0, 0x5f, 0x10, 0x0, 0x0, 0xab, 0x0, 0x0, 0x1, 0xf5, 0x0, 0x0,
+    0x6, 0xe1, 0x0, 0x0, 0xb, 0xa0, 0x0, 0x0, 0x2f, 0x40, 0x0, 0x0, 0x37, 0x0, 0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x0, 0x34, 0x20, 0x0, 0x0, 0x4d, 0xff, 0xfb, 0x10, 0x2, 0xec, 0x42, 0x6e, 0xc0, 0xa,
+    0xe1, 0x0, 0x5, 0xf5, 0x1e, 0x90, 0x0, 0x0, 0xea, 0x2f, 0x60, 0x0, 0x0, 0xbc, 0x3f, 0x60,
+    0x0, 0x0, 0xbd, 0x2f, 0x70, 0x0, 0x0, 0xcc, 0xe, 0xa0, 0x0, 0x1, 0xe9, 0x9, 0xf3, 0x0,
+    0x7, 0xf4, 0x1, 0xde, 0x75, 0x9f, 0xa0, 0x0, 0x2a, 0xef, 0xd7, 0x0,
+
+    /* U+0031 "1" */
+    0x33, 0x33, 0x1d, 0xff, 0xf4, 0x33, 0x7f, 0x40, 0x5, 0xf4, 0x0, 0x5f, 0x40, 0x5, 0xf4, 0x0,
+    0x5f, 0x40, 0x5, 0xf4, 0x0, 0x5f, 0x40, 0x5, 0xf4, 0x0, 0x5f, 0x40, 0x5, 0xf4,
+
+    /* U+0032 "2" */
+    0x0, 0x14, 0x53, 0x0, 0x1, 0x9f, 0xff, 0xfd, 0x30, 0x7e, 0x73, 0x26, 0xed, 0x0, 0x20, 0x0,
+    0x8, 0xf2, 0x0, 0x0, 0x0, 0x8f, 0x10, 0x0, 0x0, 0x1e, 0xb0, 0x0, 0x0, 0x1c, 0xe2, 0x0,
+    0x0, 0x1c, 0xe3, 0x0, 0x0, 0x1c, 0xe3, 0x0, 0x0, 0x2d, 0xd2, 0x0, 0x0, 0x2d, 0xf8, 0x66,
+    0x66, 0x46, 0xff, 0xff, 0xff, 0xfa,
+
+    /* U+0033 "3" */
+    0x13, 0x33, 0x33, 0x33, 0x6, 0xff, 0xff, 0xff, 0xf0, 0x13, 0x33, 0x37, 0xf7, 0x0, 0x0, 0x2,
+    0xea, 0x0, 0x0, 0x1, 0xdc, 0x10, 0x0, 0x0, 0xaf, 0x82, 0x0, 0x0, 0xa, 0xce, 0xf7, 0x0,
+    0x0, 0x0, 0x1a, 0xf3, 0x0, 0x0, 0x0, 0x3f, 0x62, 0x10, 0x0, 0x6, 0xf5, 0xbe, 0x95, 0x58,
+    0xed, 0x2, 0x9d, 0xff, 0xe9, 0x10,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x23, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x1d, 0xb0, 0x0,
+    0x0, 0x0, 0xb, 0xd1, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x1, 0x83,
+    0x0, 0x2, 0xea, 0x0, 0x2f, 0x60, 0x1, 0xdd, 0x32, 0x23, 0xf7, 0x21, 0x6f, 0xff, 0xff, 0xff,
+    0xff, 0x81, 0x44, 0x44, 0x46, 0xf8, 0x42, 0x0, 0x0, 0x0, 0x3f, 0x60, 0x0, 0x0, 0x0, 0x3,
+    0xf6, 0x0,
+
+    /* U+0035 "5" */
+    0x1, 0x33, 0x33, 0x33, 0x0, 0x6f, 0xff, 0xff, 0xf0, 0x7, 0xf3, 0x33, 0x33, 0x0, 0x9d, 0x0,
+    0x0, 0x0, 0xa, 0xc0, 0x0, 0x0, 0x0, 0xce, 0xba, 0x95, 0x0, 0x9, 0xaa, 0xbd, 0xfb, 0x0,
+    0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0x1f, 0x91, 0x30, 0x0, 0x3, 0xf7, 0x8f, 0xa6, 0x57,
+    0xee, 0x21, 0x8d, 0xff, 0xeb, 0x30,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x24, 0x42, 0x0, 0x0, 0x2b, 0xff, 0xff, 0x90, 0x1, 0xde, 0x62, 0x14, 0x30, 0x9,
+    0xe2, 0x0, 0x0, 0x0, 0xe, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0x74, 0xac, 0xa6, 0x0, 0x3f, 0xce,
+    0x98, 0xbf, 0xa0, 0x2f, 0xf3, 0x0, 0x8, 0xf3, 0x1e, 0xc0, 0x0, 0x2, 0xf6, 0xa, 0xe1, 0x0,
+    0x5, 0xf4, 0x2, 0xec, 0x53, 0x6e, 0xc0, 0x0, 0x2a, 0xef, 0xea, 0x10,
+
+    /* U+0037 "7" */
+    0x23, 0x33, 0x33, 0x33, 0x38, 0xff, 0xff, 0xff, 0xfe, 0x8f, 0x33, 0x33, 0x4f, 0xa8, 0xf0, 0x0,
+    0x7, 0xf3, 0x13, 0x0, 0x0, 0xdb, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0xc, 0xd0, 0x0,
+    0x0, 0x4, 0xf6, 0x0, 0x0, 0x0, 0xbe, 0x10, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x9, 0xf1,
+    0x0, 0x0, 0x1, 0xf9, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x1, 0x44, 0x30, 0x0, 0x1, 0xaf, 0xff, 0xfc, 0x30, 0x9, 0xf6, 0x10, 0x4d, 0xd0, 0xd,
+    0xb0, 0x0, 0x7, 0xf2, 0xb, 0xd1, 0x0, 0x9, 0xf1, 0x3, 0xed, 0x87, 0xbf, 0x70, 0x3, 0xcf,
+    0xdc, 0xee, 0x50, 0x1e, 0xc2, 0x0, 0x19, 0xf4, 0x4f, 0x60, 0x0, 0x1, 0xf8, 0x3f, 0x80, 0x0,
+    0x3, 0xf7, 0xb, 0xf8, 0x43, 0x6d, 0xe2, 0x1, 0x8d, 0xff, 0xea, 0x30,
+
+    /* U+0039 "9" */
+    0x0, 0x3, 0x43, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xd3, 0x0, 0x2e, 0xb2, 0x2, 0xae, 0x20, 0x7f,
+    0x20, 0x0, 0x1e, 0x90, 0x8f, 0x10, 0x0, 0xe, 0xe0, 0x4f, 0x80, 0x0, 0x7f, 0xf1, 0x9, 0xfd,
+    0xbd, 0xeb, 0xf1, 0x0, 0x48, 0x96, 0x19, 0xf0, 0x0, 0x0, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x0,
+    0x6f, 0x60, 0x6, 0x74, 0x59, 0xfa, 0x0, 0x9, 0xef, 0xec, 0x70, 0x0,
+
+    /* U+003A ":" */
+    0x7, 0x43, 0xfd, 0x8, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1, 0x2, 0xeb, 0x2e, 0xa0,
+
+    /* U+003B ";" */
+    0x7, 0x43, 0xfd, 0x8, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1, 0x2, 0xeb, 0x1e, 0xc0, 0xa7, 0xe,
+    0x20, 0x40,
+
+    /* U+003C "<" */
+    0x0, 0x0, 0x16, 0xc4, 0x0, 0x4a, 0xfd, 0x71, 0x7d, 0xfa, 0x40, 0x0, 0xee, 0x50, 0x0, 0x0,
+    0x4a, 0xfd, 0x71, 0x0, 0x0, 0x17, 0xdf, 0xa2, 0x0, 0x0, 0x3, 0x93,
+
+    /* U+003D "=" */
+    0x22, 0x22, 0x22, 0x20, 0xef, 0xff, 0xff, 0xf4, 0x22, 0x22, 0x22, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x55, 0x55, 0x55, 0x51, 0xde, 0xee, 0xee, 0xe3,
+
+    /* U+003E ">" */
+    0xd8, 0x20, 0x0, 0x0, 0x5b, 0xfb, 0x61, 0x0, 0x0, 0x28, 0xde, 0x91, 0x0, 0x0, 0x2c, 0xf4,
+    0x0, 0x5b, 0xfc, 0x60, 0x8e, 0xe8, 0x30, 0x0, 0xa5, 0x0, 0x0, 0x0,
+
+    /* U+003F "?" */
+    0x0, 0x14, 0x53, 0x0, 0x1, 0xaf, 0xff, 0xfd, 0x30, 0x8e, 0x62, 0x15, 0xed, 0x0, 0x20, 0x0,
+    0x9, 0xf1, 0x0, 0x0, 0x0, 0xbd, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x8f, 0x50, 0x0,
+    0x0, 0x3f, 0x80, 0x0, 0x0, 0x2, 0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xe4,
+    0x0, 0x0, 0x0, 0x6e, 0x50, 0x0,
+
+    /* U+0040 "@" */
+    0x0, 0x0, 0x0, 0x24, 0x43, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xed, 0xcd, 0xfb, 0x30, 0x0,
+    0x0, 0x1c, 0xd5, 0x0, 0x0, 0x17, 0xe7, 0x0, 0x0, 0xca, 0x10, 0x1, 0x10, 0x0, 0x2d, 0x60,
+    0x6, 0xd1, 0x4, 0xcf, 0xfc, 0x4f, 0x43, 0xe1, 0xd, 0x60, 0x3f, 0xb4, 0x37, 0xef, 0x40, 0xb6,
+    0x1f, 0x20, 0xad, 0x0, 0x0, 0x7f, 0x40, 0x7a, 0x3f, 0x0, 0xd8, 0x0, 0x0, 0x2f, 0x40, 0x5b,
+    0x3f, 0x0, 0xd8, 0x0, 0x0, 0x2f, 0x40, 0x6b, 0x1f, 0x20, 0xad, 0x0, 0x0, 0x7f, 0x40, 0x89,
+    0xc, 0x70, 0x3f, 0xb4, 0x37, 0xee, 0x94, 0xe3, 0x5, 0xe1, 0x3, 0xbe, 0xeb, 0x37, 0xee, 0x60,
+    0x0, 0xac, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xe8, 0x20, 0x1, 0x54, 0x0, 0x0,
+    0x0, 0x0, 0x4a, 0xef, 0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x3, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xbd, 0xf6,
+    0x0, 0x0, 0x0, 0x3, 0xf6, 0xad, 0x0, 0x0, 0x0, 0x9, 0xe0, 0x4f, 0x50, 0x0, 0x0, 0x1f,
+    0x70, 0xc, 0xc0, 0x0, 0x0, 0x8f, 0x10, 0x6, 0xf3, 0x0, 0x1, 0xea, 0x11, 0x12, 0xea, 0x0,
+    0x6, 0xff, 0xff, 0xff, 0xff, 0x20, 0xd, 0xb3, 0x33, 0x33, 0x4f, 0x90, 0x5f, 0x40, 0x0, 0x0,
+    0x9, 0xe1, 0xcd, 0x0, 0x0, 0x0, 0x3, 0xf8,
+
+    /* U+0042 "B" */
+    0x13, 0x33, 0x33, 0x20, 0x0, 0x5, 0xff, 0xff, 0xff, 0xe7, 0x0, 0x5f, 0x51, 0x12, 0x3a, 0xf6,
+    0x5, 0xf4, 0x0, 0x0, 0xe, 0xa0, 0x5f, 0x40, 0x0, 0x1, 0xf9, 0x5, 0xf8, 0x55, 0x57, 0xce,
+    0x20, 0x5f, 0xff, 0xff, 0xff, 0xb2, 0x5, 0xf4, 0x0, 0x0, 0x4d, 0xd0, 0x5f, 0x40, 0x0, 0x0,
+    0x6f, 0x45, 0xf4, 0x0, 0x0, 0x7, 0xf4, 0x5f, 0x74, 0x44, 0x58, 0xfc, 0x5, 0xff, 0xff, 0xff,
+    0xd9, 0x10,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x3, 0x44, 0x10, 0x0, 0x0, 0x7d, 0xff, 0xff, 0xa2, 0x0, 0xaf, 0xb4, 0x23, 0x7e,
+    0xa0, 0x7f, 0x80, 0x0, 0x0, 0x21, 0xd, 0xc0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0x60, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xc, 0xd1, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xa1, 0x0, 0x0, 0x52, 0x0, 0x7f, 0xd7, 0x56, 0xaf, 0xa0, 0x0, 0x4a, 0xef,
+    0xfc, 0x70,
+
+    /* U+0044 "D" */
+    0x13, 0x33, 0x33, 0x10, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfd, 0x70, 0x0, 0x5f, 0x63, 0x33, 0x5a,
+    0xfc, 0x10, 0x5f, 0x40, 0x0, 0x0, 0x5f, 0xa0, 0x5f, 0x40, 0x0, 0x0, 0x9, 0xf2, 0x5f, 0x40,
+    0x0, 0x0, 0x4, 0xf5, 0x5f, 0x40, 0x0, 0x0, 0x3, 0xf6, 0x5f, 0x40, 0x0, 0x0, 0x5, 0xf5,
+    0x5f, 0x40, 0x0, 0x0, 0xb, 0xe1, 0x5f, 0x40, 0x0, 0x0, 0x8f, 0x80, 0x5f, 0x86, 0x66, 0x8d,
+    0xf9, 0x0, 0x5f, 0xff, 0xff, 0xda, 0x40, 0x0,
+
+    /* U+0045 "E" */
+    0x13, 0x33, 0x33, 0x33, 0x25, 0xff, 0xff, 0xff, 0xf9, 0x5f, 0x63, 0x33, 0x33, 0x25, 0xf4, 0x0,
+    0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x5, 0xf8, 0x66, 0x66, 0x50, 0x5f, 0xff, 0xff, 0xfd, 0x5,
+    0xf4, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x5f, 0x86, 0x66,
+    0x66, 0x55, 0xff, 0xff, 0xff, 0xfc,
+
+    /* U+0046 "F" */
+    0x13, 0x33, 0x33, 0x33, 0x25, 0xff, 0xff, 0xff, 0xf9, 0x5f, 0x63, 0x33, 0x33, 0x25, 0xf4, 0x0,
+    0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x5f, 0xee, 0xee, 0xec, 0x5,
+    0xf9, 0x77, 0x77, 0x60, 0x5f, 0x40, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0,
+    0x0, 0x5, 0xf4, 0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x0, 0x3, 0x44, 0x10, 0x0, 0x0, 0x7d, 0xff, 0xff, 0xb2, 0x0, 0xaf, 0xb4, 0x23, 0x6d,
+    0xc0, 0x7f, 0x80, 0x0, 0x0, 0x12, 0xd, 0xc0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0x60, 0x0, 0x0, 0x6, 0xa1, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0xc, 0xd1, 0x0, 0x0,
+    0x8, 0xf0, 0x5f, 0xa1, 0x0, 0x0, 0x8f, 0x0, 0x7f, 0xd8, 0x56, 0x9e, 0xe0, 0x0, 0x4a, 0xef,
+    0xfd, 0x81,
+
+    /* U+0048 "H" */
+    0x13, 0x10, 0x0, 0x0, 0x13, 0x15, 0xf4, 0x0, 0x0, 0x4, 0xf5, 0x5f, 0x40, 0x0, 0x0, 0x4f,
+    0x55, 0xf4, 0x0, 0x0, 0x4, 0xf5, 0x5f, 0x40, 0x0, 0x0, 0x4f, 0x55, 0xf8, 0x66, 0x66, 0x68,
+    0xf5, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf4, 0x0, 0x0, 0x4, 0xf5, 0x5f, 0x40, 0x0, 0x0,
+    0x4f, 0x55, 0xf4, 0x0, 0x0, 0x4, 0xf5, 0x5f, 0x40, 0x0, 0x0, 0x4f, 0x55, 0xf4, 0x0, 0x0,
+    0x4, 0xf5,
+
+    /* U+0049 "I" */
+    0x13, 0x15, 0xf4, 0x5f, 0x45, 0xf4, 0x5f, 0x45, 0xf4, 0x5f, 0x45, 0xf4, 0x5f, 0x45, 0xf4, 0x5f,
+    0x45, 0xf4,
+
+    /* U+004A "J" */
+    0x3, 0x33, 0x33, 0x20, 0xff, 0xff, 0xf9, 0x3, 0x33, 0x3f, 0x90, 0x0, 0x0, 0xe9, 0x0, 0x0,
+    0xe, 0x90, 0x0, 0x0, 0xe9, 0x0, 0x0, 0xe, 0x90, 0x0, 0x0, 0xe9, 0x0, 0x0, 0xf, 0x94,
+    0x10, 0x2, 0xf8, 0xec, 0x55, 0xcf, 0x33, 0xbf, 0xfc, 0x50,
+
+    /* U+004B "K" */
+    0x13, 0x10, 0x0, 0x0, 0x23, 0x5, 0xf4, 0x0, 0x0, 0x5f, 0x80, 0x5f, 0x40, 0x0, 0x5f, 0x90,
+    0x5, 0xf4, 0x0, 0x4f, 0x90, 0x0, 0x5f, 0x40, 0x4f, 0xa0, 0x0, 0x5, 0xf4, 0x4e, 0xb0, 0x0,
+    0x0, 0x5f, 0x8e, 0xfd, 0x10, 0x0, 0x5, 0xff, 0xc5, 0xfb, 0x0, 0x0, 0x5f, 0xc1, 0x6, 0xf9,
+    0x0, 0x5, 0xf4, 0x0, 0x8, 0xf6, 0x0, 0x5f, 0x40, 0x0, 0xa, 0xf4, 0x5, 0xf4, 0x0, 0x0,
+    0x1c, 0xe2,
+
+    /* U+004C "L" */
+    0x13, 0x10, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x5, 0xf4, 0x0,
+    0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x5,
+    0xf4, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x5f, 0x86, 0x66,
+    0x66, 0x25, 0xff, 0xff, 0xff, 0xf5,
+
+    /* U+004D "M" */
+    0x13, 0x0, 0x0, 0x0, 0x0, 0x2, 0x25, 0xf6, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x5f, 0xe1, 0x0,
+    0x0, 0x0, 0xbf, 0x95, 0xff, 0x90, 0x0, 0x0, 0x5f, 0xf9, 0x5f, 0x9f, 0x30, 0x0, 0xd, 0xae,
+    0x95, 0xf3, 0xcc, 0x0, 0x7, 0xe2, 0xe9, 0x5f, 0x33, 0xf6, 0x2, 0xe7, 0xe, 0x95, 0xf3, 0x9,
+    0xe1, 0xad, 0x0, 0xe9, 0x5f, 0x30, 0x1e, 0xbf, 0x40, 0xe, 0x95, 0xf3, 0x0, 0x6f, 0xa0, 0x0,
+    0xe9, 0x5f, 0x30, 0x0, 0x92, 0x0, 0xe, 0x95, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xe9,
+
+    /* U+004E "N" */
+    0x13, 0x0, 0x0, 0x0, 0x13, 0x15, 0xf8, 0x0, 0x0, 0x4, 0xf5, 0x5f, 0xf5, 0x0, 0x0, 0x4f,
+    0x55, 0xfe, 0xe3, 0x0, 0x4, 0xf5, 0x5f, 0x6e, 0xd1, 0x0, 0x4f, 0x55, 0xf4, 0x4f, 0xb0, 0x4,
+    0xf5, 0x5f, 0x40, 0x6f, 0x90, 0x4f, 0x55, 0xf4, 0x0, 0x9f, 0x64, 0xf5, 0x5f, 0x40, 0x0, 0xcf,
+    0x8f, 0x55, 0xf4, 0x0, 0x2, 0xef, 0xf5, 0x5f, 0x40, 0x0, 0x3, 0xff, 0x55, 0xf4, 0x0, 0x0,
+    0x6, 0xf5,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x3, 0x44, 0x10, 0x0, 0x0, 0x0, 0x7d, 0xff, 0xff, 0xa2, 0x0, 0x0, 0xaf, 0xb4,
+    0x23, 0x7e, 0xe3, 0x0, 0x6f, 0x80, 0x0, 0x0, 0x2e, 0xd0, 0xd, 0xc0, 0x0, 0x0, 0x0, 0x6f,
+    0x52, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xf8, 0x3f, 0x60, 0x0, 0x0, 0x0, 0xe, 0xa1, 0xf8, 0x0,
+    0x0, 0x0, 0x1, 0xf8, 0xc, 0xd1, 0x0, 0x0, 0x0, 0x7f, 0x40, 0x5f, 0xa1, 0x0, 0x0, 0x4f,
+    0xb0, 0x0, 0x7f, 0xd7, 0x56, 0xaf, 0xc1, 0x0, 0x0, 0x4a, 0xef, 0xec, 0x71, 0x0,
+
+    /* U+0050 "P" */
+    0x13, 0x33, 0x32, 0x10, 0x0, 0x5f, 0xff, 0xff, 0xfb, 0x20, 0x5f, 0x63, 0x34, 0x7e, 0xe2, 0x5f,
+    0x40, 0x0, 0x3, 0xf8, 0x5f, 0x40, 0x0, 0x0, 0xea, 0x5f, 0x40, 0x0, 0x1, 0xf9, 0x5f, 0x40,
+    0x0, 0x1a, 0xf4, 0x5f, 0xdc, 0xcd, 0xff, 0x70, 0x5f, 0xb9, 0x99, 0x72, 0x0, 0x5f, 0x40, 0x0,
+    0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x0,
+
+    /* U+0051 "Q" */
+    0x0, 0x0, 0x3, 0x44, 0x10, 0x0, 0x0, 0x0, 0x7, 0xdf, 0xff, 0xfa, 0x20, 0x0, 0x0, 0xaf,
+    0xb4, 0x23, 0x7e, 0xe3, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x2, 0xed, 0x0, 0xd, 0xc0, 0x0, 0x0,
+    0x0, 0x6f, 0x50, 0x2f, 0x70, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x3f, 0x60, 0x0, 0x0, 0x0, 0xe,
+    0xa0, 0x1f, 0x80, 0x0, 0x0, 0x0, 0x1f, 0x80, 0xc, 0xd1, 0x0, 0x0, 0x0, 0x7f, 0x40, 0x5,
+    0xfa, 0x10, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x7f, 0xd7, 0x56, 0xaf, 0xd1, 0x0, 0x0, 0x4, 0xae,
+    0xff, 0xd7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xd4, 0x14, 0xb1, 0x0, 0x0, 0x0, 0x2, 0xbf,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2, 0x31, 0x0,
+
+    /* U+0052 "R" */
+    0x13, 0x33, 0x32, 0x10, 0x0, 0x5f, 0xff, 0xff, 0xfb, 0x20, 0x5f, 0x63, 0x34, 0x7e, 0xe2, 0x5f,
+    0x40, 0x0, 0x3, 0xf8, 0x5f, 0x40, 0x0, 0x0, 0xea, 0x5f, 0x40, 0x0, 0x1, 0xf9, 0x5f, 0x40,
+    0x0, 0x1a, 0xf4, 0x5f, 0xcc, 0xcc, 0xef, 0x70, 0x5f, 0xb9, 0x99, 0xf8, 0x0, 0x5f, 0x40, 0x0,
+    0x9f, 0x30, 0x5f, 0x40, 0x0, 0x1d, 0xc0, 0x5f, 0x40, 0x0, 0x3, 0xf8,
+
+    /* U+0053 "S" */
+    0x0, 0x2, 0x45, 0x30, 0x0, 0x1, 0xaf, 0xff, 0xfe, 0x70, 0xa, 0xe6, 0x21, 0x39, 0x70, 0xf,
+    0x90, 0x0, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x0, 0x0, 0x8, 0xfd, 0x74, 0x0, 0x0, 0x0, 0x5b,
+    0xff, 0xe9, 0x10, 0x0, 0x0, 0x14, 0x9f, 0xc0, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x4, 0x0, 0x0,
+    0x6, 0xf3, 0x3f, 0xc6, 0x44, 0x7e, 0xc0, 0x4, 0xbe, 0xff, 0xd9, 0x10,
+
+    /* U+0054 "T" */
+    0x33, 0x33, 0x33, 0x33, 0x31, 0xef, 0xff, 0xff, 0xff, 0xf5, 0x33, 0x34, 0xf9, 0x33, 0x31, 0x0,
+    0x1, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0, 0x1,
+    0xf7, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xf7,
+    0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0x13, 0x10, 0x0, 0x0, 0x13, 0x6, 0xf3, 0x0, 0x0, 0x7, 0xf1, 0x6f, 0x30, 0x0, 0x0, 0x7f,
+    0x16, 0xf3, 0x0, 0x0, 0x7, 0xf1, 0x6f, 0x30, 0x0, 0x0, 0x7f, 0x16, 0xf3, 0x0, 0x0, 0x7,
+    0xf1, 0x6f, 0x30, 0x0, 0x0, 0x7f, 0x16, 0xf3, 0x0, 0x0, 0x8, 0xf0, 0x4f, 0x60, 0x0, 0x0,
+    0xae, 0x1, 0xec, 0x0, 0x0, 0x2e, 0x90, 0x6, 0xfc, 0x65, 0x7e, 0xe2, 0x0, 0x5, 0xbe, 0xfe,
+    0x92, 0x0,
+
+    /* U+0056 "V" */
+    0x32, 0x0, 0x0, 0x0, 0x1, 0x31, 0xbe, 0x10, 0x0, 0x0, 0x8, 0xf2, 0x4f, 0x70, 0x0, 0x0,
+    0xe, 0xa0, 0xc, 0xd0, 0x0, 0x0, 0x6f, 0x30, 0x6, 0xf5, 0x0, 0x0, 0xcc, 0x0, 0x0, 0xec,
+    0x0, 0x4, 0xf5, 0x0, 0x0, 0x8f, 0x30, 0xb, 0xd0, 0x0, 0x0, 0x1f, 0xa0, 0x2f, 0x70, 0x0,
+    0x0, 0x9, 0xf2, 0x9e, 0x10, 0x0, 0x0, 0x3, 0xf9, 0xe9, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0,
+
+    /* U+0057 "W" */
+    0x13, 0x10, 0x0, 0x0, 0x23, 0x0, 0x0, 0x0, 0x31, 0x4f, 0x60, 0x0, 0x0, 0xdf, 0x10, 0x0,
+    0x4, 0xf4, 0xe, 0xb0, 0x0, 0x4, 0xff, 0x60, 0x0, 0x9, 0xe0, 0x9, 0xf1, 0x0, 0x9, 0xdc,
+    0xb0, 0x0, 0xe, 0x90, 0x4, 0xf6, 0x0, 0xe, 0x87, 0xf1, 0x0, 0x4f, 0x40, 0x0, 0xeb, 0x0,
+    0x4f, 0x32, 0xf6, 0x0, 0x9e, 0x0, 0x0, 0x9f, 0x10, 0xad, 0x0, 0xcb, 0x0, 0xe9, 0x0, 0x0,
+    0x4f, 0x61, 0xe8, 0x0, 0x7f, 0x14, 0xf4, 0x0, 0x0, 0xe, 0xb5, 0xf2, 0x0, 0x2f, 0x69, 0xe0,
+    0x0, 0x0, 0x9, 0xfb, 0xc0, 0x0, 0xc, 0xbe, 0x90, 0x0, 0x0, 0x4, 0xff, 0x70, 0x0, 0x6,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0, 0x2, 0xfe, 0x0, 0x0,
+
+    /* U+0058 "X" */
+    0x13, 0x10, 0x0, 0x0, 0x23, 0x12, 0xec, 0x0, 0x0, 0x1d, 0xb0, 0x5, 0xf8, 0x0, 0xa, 0xe2,
+    0x0, 0x9, 0xf4, 0x6, 0xf5, 0x0, 0x0, 0xc, 0xe4, 0xe9, 0x0, 0x0, 0x0, 0x3e, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x7f, 0xbf, 0x40, 0x0, 0x0, 0x4f, 0x80, 0xce,
+    0x10, 0x0, 0x1d, 0xc0, 0x2, 0xeb, 0x0, 0xa, 0xe2, 0x0, 0x6, 0xf7, 0x6, 0xf6, 0x0, 0x0,
+    0xa, 0xf3,
+
+    /* U+0059 "Y" */
+    0x32, 0x0, 0x0, 0x0, 0x13, 0x1a, 0xe2, 0x0, 0x0, 0x9, 0xe1, 0x1e, 0xa0, 0x0, 0x3, 0xf6,
+    0x0, 0x6f, 0x40, 0x0, 0xcc, 0x0, 0x0, 0xcd, 0x0, 0x6f, 0x30, 0x0, 0x3, 0xf8, 0x1e, 0x80,
+    0x0, 0x0, 0x9, 0xfb, 0xe1, 0x0, 0x0, 0x0, 0x1e, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
+    0x0, 0x0,
+
+    /* U+005A "Z" */
+    0x13, 0x33, 0x33, 0x33, 0x33, 0x3, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x13, 0x33, 0x33, 0x3a, 0xf5,
+    0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xeb, 0x0, 0x0, 0x0, 0x1, 0xdd, 0x10,
+    0x0, 0x0, 0x0, 0xbe, 0x30, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0x5f, 0x80, 0x0,
+    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x1d, 0xf7, 0x66, 0x66, 0x66, 0x5, 0xff, 0xff, 0xff,
+    0xff, 0xf1,
+
+    /* U+005B "[" */
+    0x4d, 0xdd, 0x5f, 0x86, 0x5f, 0x30, 0x5f, 0x30, 0x5f, 0x30, 0x5f, 0x30, 0x5f, 0x30, 0x5f, 0x30,
+    0x5f, 0x30, 0x5f, 0x30, 0x5f, 0x30, 0x5f, 0x30, 0x5f, 0x30, 0x5f, 0x64, 0x5f, 0xff,
+
+    /* U+005C "\\" */
+    0x46, 0x0, 0x0, 0x4, 0xf2, 0x0, 0x0, 0xe, 0x70, 0x0, 0x0, 0x8c, 0x0, 0x0, 0x3, 0xf3,
+    0x0, 0x0, 0xd, 0x80, 0x0, 0x0, 0x8d, 0x0, 0x0, 0x2, 0xf4, 0x0, 0x0, 0xc, 0x90, 0x0,
+    0x0, 0x7e, 0x0, 0x0, 0x2, 0xf4, 0x0, 0x0, 0xb, 0xa0, 0x0, 0x0, 0x6e, 0x10, 0x0, 0x1,
+    0xf5, 0x0, 0x0, 0xa, 0xb0, 0x0, 0x0, 0x37,
+
+    /* U+005D "]" */
+    0x9d, 0xd8, 0x46, 0xea, 0x0, 0xda, 0x0, 0xda, 0x0, 0xda, 0x0, 0xda, 0x0, 0xda, 0x0, 0xda,
+    0x0, 0xda, 0x0, 0xda, 0x0, 0xda, 0x0, 0xda, 0x0, 0xda, 0x34, 0xea, 0xaf, 0xfa,
+
+    /* U+005E "^" */
+    0x0, 0x2e, 0x70, 0x0, 0x9, 0xcd, 0x0, 0x1, 0xe3, 0xd5, 0x0, 0x6c, 0x7, 0xb0, 0xd, 0x50,
+    0x1e, 0x34, 0xe0, 0x0, 0x99, 0x76, 0x0, 0x3, 0xa0,
+
+    /* U+005F "_" */
+    0xdd, 0xdd, 0xdd, 0xdd,
+
+    /* U+0060 "`" */
+    0x7c, 0x30, 0x7, 0xe3, 0x0, 0x34,
+
+    /* U+0061 "a" */
+    0x0, 0x37, 0x87, 0x20, 0x0, 0xaf, 0xdc, 0xef, 0x60, 0x5, 0x30, 0x1, 0xce, 0x0, 0x0, 0x0,
+    0x6, 0xf2, 0x2, 0x9c, 0xdd, 0xef, 0x30, 0xdc, 0x53, 0x38, 0xf3, 0x2f, 0x60, 0x0, 0x7f, 0x30,
+    0xec, 0x32, 0x6e, 0xf3, 0x4, 0xbe, 0xec, 0x7f, 0x30,
+
+    /* U+0062 "b" */
+    0x7d, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0x4, 0x87, 0x40, 0x0, 0x8f, 0xaf, 0xcd, 0xfb, 0x10, 0x8f, 0xd2, 0x0, 0x5f, 0xa0, 0x8f, 0x40,
+    0x0, 0x9, 0xf1, 0x8f, 0x0, 0x0, 0x5, 0xf3, 0x8f, 0x10, 0x0, 0x6, 0xf2, 0x8f, 0x70, 0x0,
+    0xc, 0xd0, 0x8f, 0xe9, 0x45, 0xcf, 0x50, 0x8e, 0x4c, 0xee, 0xb4, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x4, 0x78, 0x51, 0x0, 0x1b, 0xfd, 0xcf, 0xd2, 0xa, 0xe4, 0x0, 0x2c, 0x42, 0xf7, 0x0,
+    0x0, 0x0, 0x4f, 0x40, 0x0, 0x0, 0x4, 0xf5, 0x0, 0x0, 0x0, 0xe, 0xb0, 0x0, 0x4, 0x0,
+    0x5f, 0xb5, 0x49, 0xf5, 0x0, 0x4b, 0xef, 0xc6, 0x0,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x1, 0xd6, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0,
+    0x5, 0x88, 0x41, 0xf7, 0x1, 0xcf, 0xdd, 0xfa, 0xf7, 0xb, 0xe4, 0x0, 0x3d, 0xf7, 0x2f, 0x70,
+    0x0, 0x5, 0xf7, 0x4f, 0x40, 0x0, 0x1, 0xf7, 0x4f, 0x50, 0x0, 0x3, 0xf7, 0x1e, 0xb0, 0x0,
+    0x9, 0xf7, 0x6, 0xfb, 0x55, 0xae, 0xf7, 0x0, 0x5c, 0xee, 0xb3, 0xf7,
+
+    /* U+0065 "e" */
+    0x0, 0x5, 0x87, 0x40, 0x0, 0x1, 0xcf, 0xcc, 0xfa, 0x0, 0xb, 0xe3, 0x0, 0x4f, 0x80, 0x2f,
+    0x60, 0x0, 0x8, 0xe0, 0x4f, 0xdc, 0xcc, 0xcd, 0xf1, 0x4f, 0x84, 0x44, 0x44, 0x40, 0xe, 0xb0,
+    0x0, 0x1, 0x0, 0x6, 0xfb, 0x64, 0x7e, 0x50, 0x0, 0x4b, 0xef, 0xd8, 0x10,
+
+    /* U+0066 "f" */
+    0x0, 0x4c, 0xec, 0x10, 0x1e, 0xb5, 0x70, 0x4, 0xf4, 0x0, 0x5, 0xaf, 0x97, 0x50, 0x9d, 0xfc,
+    0xc8, 0x0, 0x5f, 0x30, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x5, 0xf3, 0x0, 0x0,
+    0x5f, 0x30, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x5f, 0x30, 0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x5, 0x88, 0x40, 0x64, 0x2, 0xcf, 0xdd, 0xfb, 0xe9, 0xc, 0xe4, 0x0, 0x2c, 0xf9, 0x3f,
+    0x70, 0x0, 0x3, 0xf9, 0x4f, 0x40, 0x0, 0x0, 0xf9, 0x3f, 0x60, 0x0, 0x2, 0xf9, 0xc, 0xe3,
+    0x0, 0x1b, 0xf9, 0x2, 0xdf, 0xcb, 0xec, 0xf9, 0x0, 0x16, 0x99, 0x51, 0xf8, 0x1, 0x10, 0x0,
+    0x5, 0xf5, 0xa, 0xd8, 0x44, 0x7e, 0xc0, 0x2, 0x9e, 0xff, 0xea, 0x10, 0x0, 0x0, 0x11, 0x0,
+    0x0,
+
+    /* U+0068 "h" */
+    0x7d, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x48,
+    0x84, 0x0, 0x8f, 0xbf, 0xde, 0xf9, 0x8, 0xfc, 0x20, 0xa, 0xf3, 0x8f, 0x30, 0x0, 0x2f, 0x78,
+    0xf0, 0x0, 0x1, 0xf8, 0x8f, 0x0, 0x0, 0xf, 0x88, 0xf0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0,
+    0xf, 0x88, 0xf0, 0x0, 0x0, 0xf8,
+
+    /* U+0069 "i" */
+    0x1, 0xa, 0xf2, 0x7c, 0x10, 0x0, 0x47, 0x8, 0xf0, 0x8f, 0x8, 0xf0, 0x8f, 0x8, 0xf0, 0x8f,
+    0x8, 0xf0, 0x8f, 0x0,
+
+    /* U+006A "j" */
+    0x0, 0x0, 0x10, 0x0, 0x9, 0xf3, 0x0, 0x6, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x3, 0x71, 0x0,
+    0x7, 0xf1, 0x0, 0x7, 0xf1, 0x0, 0x7, 0xf1, 0x0, 0x7, 0xf1, 0x0, 0x7, 0xf1, 0x0, 0x7,
+    0xf1, 0x0, 0x7, 0xf1, 0x0, 0x7, 0xf1, 0x0, 0x7, 0xf1, 0x16, 0x4d, 0xc0, 0x4e, 0xfd, 0x30,
+    0x0, 0x10, 0x0,
+
+    /* U+006B "k" */
+    0x7d, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0,
+    0x5, 0x72, 0x8f, 0x0, 0x7, 0xf7, 0x8, 0xf0, 0x8, 0xf7, 0x0, 0x8f, 0x9, 0xf7, 0x0, 0x8,
+    0xfb, 0xff, 0x40, 0x0, 0x8f, 0xe5, 0xce, 0x20, 0x8, 0xf4, 0x2, 0xec, 0x10, 0x8f, 0x0, 0x4,
+    0xfa, 0x8, 0xf0, 0x0, 0x7, 0xf6,
+
+    /* U+006C "l" */
+    0x7d, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
+
+    /* U+006D "m" */
+    0x47, 0x5, 0x87, 0x30, 0x4, 0x88, 0x40, 0x8, 0xeb, 0xfd, 0xff, 0x6a, 0xfd, 0xef, 0xa0, 0x8f,
+    0xb1, 0x1, 0xcf, 0xe3, 0x0, 0x9f, 0x48, 0xf3, 0x0, 0x6, 0xf7, 0x0, 0x2, 0xf7, 0x8f, 0x0,
+    0x0, 0x4f, 0x40, 0x0, 0xf, 0x88, 0xf0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0,
+    0x4f, 0x40, 0x0, 0xf, 0x88, 0xf0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x4f,
+    0x40, 0x0, 0xf, 0x80,
+
+    /* U+006E "n" */
+    0x47, 0x5, 0x88, 0x40, 0x8, 0xeb, 0xfd, 0xef, 0x90, 0x8f, 0xc2, 0x0, 0xaf, 0x38, 0xf3, 0x0,
+    0x2, 0xf7, 0x8f, 0x0, 0x0, 0x1f, 0x88, 0xf0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0xf, 0x88,
+    0xf0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0xf, 0x80,
+
+    /* U+006F "o" */
+    0x0, 0x4, 0x78, 0x50, 0x0, 0x1, 0xbf, 0xdd, 0xfd, 0x20, 0xa, 0xe4, 0x0, 0x3d, 0xd0, 0x2f,
+    0x70, 0x0, 0x5, 0xf4, 0x4f, 0x40, 0x0, 0x1, 0xf7, 0x4f, 0x50, 0x0, 0x3, 0xf6, 0xe, 0xb0,
+    0x0, 0x9, 0xf2, 0x5, 0xfb, 0x55, 0xaf, 0x80, 0x0, 0x4b, 0xee, 0xc6, 0x0,
+
+    /* U+0070 "p" */
+    0x47, 0x4, 0x87, 0x40, 0x0, 0x8e, 0xaf, 0xcd, 0xfb, 0x10, 0x8f, 0xd2, 0x0, 0x5f, 0xa0, 0x8f,
+    0x40, 0x0, 0x9, 0xf1, 0x8f, 0x0, 0x0, 0x5, 0xf3, 0x8f, 0x10, 0x0, 0x6, 0xf2, 0x8f, 0x70,
+    0x0, 0xc, 0xd0, 0x8f, 0xe9, 0x45, 0xcf, 0x50, 0x8f, 0x4c, 0xee, 0xb4, 0x0, 0x8f, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0071 "q" */
+    0x0, 0x5, 0x88, 0x40, 0x73, 0x1, 0xcf, 0xdd, 0xf9, 0xf7, 0xb, 0xe4, 0x0, 0x3d, 0xf7, 0x2f,
+    0x70, 0x0, 0x5, 0xf7, 0x4f, 0x40, 0x0, 0x1, 0xf7, 0x4f, 0x50, 0x0, 0x3, 0xf7, 0x1e, 0xb0,
+    0x0, 0x9, 0xf7, 0x6, 0xfb, 0x55, 0xae, 0xf7, 0x0, 0x5c, 0xee, 0xb4, 0xf7, 0x0, 0x0, 0x0,
+    0x1, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xf7,
+
+    /* U+0072 "r" */
+    0x47, 0x5, 0x88, 0xea, 0xfe, 0x8f, 0xd3, 0x8, 0xf4, 0x0, 0x8f, 0x10, 0x8, 0xf0, 0x0, 0x8f,
+    0x0, 0x8, 0xf0, 0x0, 0x8f, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x47, 0x86, 0x20, 0xb, 0xfc, 0xce, 0xf1, 0x4f, 0x60, 0x0, 0x30, 0x4f, 0x80, 0x0, 0x0,
+    0xa, 0xff, 0xc9, 0x30, 0x0, 0x26, 0x8d, 0xf4, 0x0, 0x0, 0x1, 0xf8, 0x4d, 0x75, 0x49, 0xf5,
+    0x3a, 0xde, 0xec, 0x60,
+
+    /* U+0074 "t" */
+    0x2, 0x51, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x5a, 0xf9, 0x75, 0x9, 0xdf, 0xcc, 0x80, 0x5, 0xf3,
+    0x0, 0x0, 0x5f, 0x30, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x4, 0xf4, 0x0, 0x0,
+    0x2f, 0xa4, 0x60, 0x0, 0x6d, 0xfd, 0x10,
+
+    /* U+0075 "u" */
+    0x47, 0x0, 0x0, 0x17, 0x39, 0xe0, 0x0, 0x3, 0xf5, 0x9e, 0x0, 0x0, 0x3f, 0x59, 0xe0, 0x0,
+    0x3, 0xf5, 0x9e, 0x0, 0x0, 0x3f, 0x59, 0xe0, 0x0, 0x4, 0xf5, 0x7f, 0x30, 0x0, 0x9f, 0x52,
+    0xed, 0x65, 0x9e, 0xf5, 0x4, 0xbe, 0xeb, 0x4f, 0x50,
+
+    /* U+0076 "v" */
+    0x75, 0x0, 0x0, 0x5, 0x69, 0xe1, 0x0, 0x1, 0xe8, 0x3f, 0x60, 0x0, 0x6f, 0x20, 0xbd, 0x0,
+    0xd, 0xa0, 0x4, 0xf4, 0x4, 0xf3, 0x0, 0xd, 0xb0, 0xbc, 0x0, 0x0, 0x6f, 0x5f, 0x50, 0x0,
+    0x1, 0xee, 0xd0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0,
+
+    /* U+0077 "w" */
+    0x65, 0x0, 0x0, 0x47, 0x0, 0x0, 0x17, 0x18, 0xd0, 0x0, 0xc, 0xf4, 0x0, 0x7, 0xe0, 0x3f,
+    0x40, 0x3, 0xfe, 0x90, 0x0, 0xc8, 0x0, 0xca, 0x0, 0x8d, 0x7e, 0x10, 0x3f, 0x30, 0x6, 0xe1,
+    0xe, 0x71, 0xf5, 0x9, 0xc0, 0x0, 0x1f, 0x65, 0xf1, 0xa, 0xb0, 0xe6, 0x0, 0x0, 0xab, 0xaa,
+    0x0, 0x5f, 0x6f, 0x10, 0x0, 0x5, 0xff, 0x40, 0x0, 0xee, 0xa0, 0x0, 0x0, 0xe, 0xd0, 0x0,
+    0x8, 0xf5, 0x0, 0x0,
+
+    /* U+0078 "x" */
+    0x37, 0x20, 0x0, 0x37, 0x21, 0xcc, 0x10, 0x1e, 0xa0, 0x2, 0xe9, 0xb, 0xd1, 0x0, 0x5, 0xfb,
+    0xe3, 0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x2, 0xee, 0xd1, 0x0, 0x1, 0xcc, 0x2e, 0xa0, 0x0,
+    0x9e, 0x20, 0x4f, 0x70, 0x6f, 0x50, 0x0, 0x8f, 0x40,
+
+    /* U+0079 "y" */
+    0x7, 0x50, 0x0, 0x0, 0x56, 0x9, 0xe1, 0x0, 0x1, 0xe8, 0x2, 0xf6, 0x0, 0x6, 0xf2, 0x0,
+    0xbd, 0x0, 0xc, 0x90, 0x0, 0x4f, 0x50, 0x4f, 0x30, 0x0, 0xc, 0xb0, 0xab, 0x0, 0x0, 0x6,
+    0xf5, 0xf4, 0x0, 0x0, 0x0, 0xee, 0xd0, 0x0, 0x0, 0x0, 0x8f, 0x60, 0x0, 0x0, 0x0, 0x9e,
+    0x10, 0x0, 0x9, 0x46, 0xf7, 0x0, 0x0, 0x2c, 0xff, 0x80, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0,
+    0x0,
+
+    /* U+007A "z" */
+    0x27, 0x77, 0x77, 0x74, 0x3c, 0xcc, 0xcd, 0xf8, 0x0, 0x0, 0x1d, 0xc1, 0x0, 0x0, 0xbe, 0x20,
+    0x0, 0x8, 0xf4, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x3, 0xe9, 0x0, 0x0, 0x1d, 0xe4, 0x44, 0x43,
+    0x5f, 0xff, 0xff, 0xfb,
+
+    /* U+007B "{" */
+    0x0, 0x1a, 0xd4, 0x0, 0x9f, 0x82, 0x0, 0xcc, 0x0, 0x0, 0xcb, 0x0, 0x0, 0xcb, 0x0, 0x0,
+    0xcb, 0x0, 0x1, 0xda, 0x0, 0x1f, 0xf4, 0x0, 0x4, 0xea, 0x0, 0x0, 0xcb, 0x0, 0x0, 0xcb,
+    0x0, 0x0, 0xcb, 0x0, 0x0, 0xcb, 0x0, 0x0, 0xae, 0x61, 0x0, 0x2c, 0xf5,
+
+    /* U+007C "|" */
+    0x4d, 0x15, 0xf2, 0x5f, 0x25, 0xf2, 0x5f, 0x25, 0xf2, 0x5f, 0x25, 0xf2, 0x5f, 0x25, 0xf2, 0x5f,
+    0x25, 0xf2, 0x5f, 0x25, 0xf2, 0x5f, 0x20,
+
+    /* U+007D "}" */
+    0x9c, 0x70, 0x4, 0xbf, 0x40, 0x2, 0xf6, 0x0, 0x1f, 0x70, 0x1, 0xf7, 0x0, 0x1f, 0x70, 0x1,
+    0xf8, 0x0, 0xa, 0xfa, 0x1, 0xfa, 0x30, 0x1f, 0x70, 0x1, 0xf7, 0x0, 0x1f, 0x70, 0x2, 0xf6,
+    0x3, 0x9f, 0x40, 0xae, 0x90, 0x0,
+
+    /* U+007E "~" */
+    0x4d, 0xe6, 0x0, 0x94, 0xd7, 0x5e, 0xb8, 0xe2, 0xa0, 0x1, 0x9b, 0x50,
+
+    /* U+00B0 "°" */
+    0x0, 0x24, 0x10, 0x7, 0xc9, 0xd4, 0x2c, 0x0, 0x3c, 0x4a, 0x0, 0xe, 0x1d, 0x30, 0x7a, 0x3,
+    0xbd, 0x91,
+
+    /* U+00E3 "ã" */
+    0x0, 0x5b, 0x60, 0x63, 0x0, 0xd, 0x4a, 0xcd, 0x10, 0x0, 0x20, 0x2, 0x10, 0x0, 0x3, 0x78,
+    0x72, 0x0, 0xa, 0xfd, 0xce, 0xf6, 0x0, 0x53, 0x0, 0x1c, 0xe0, 0x0, 0x0, 0x0, 0x6f, 0x20,
+    0x29, 0xcd, 0xde, 0xf3, 0xd, 0xc5, 0x33, 0x8f, 0x32, 0xf6, 0x0, 0x7, 0xf3, 0xe, 0xc3, 0x26,
+    0xef, 0x30, 0x4b, 0xee, 0xc7, 0xf3,
+
+    /* U+2022 "•" */
+    0x6c, 0x6d, 0xfe, 0x8f, 0x80,
+
+    /* U+F00D "" */
+    0x6, 0x20, 0x0, 0x0, 0x26, 0xa, 0xfe, 0x30, 0x0, 0x3e, 0xfa, 0xdf, 0xfe, 0x30, 0x3e, 0xff,
+    0xd3, 0xef, 0xfe, 0x5e, 0xff, 0xe3, 0x3, 0xef, 0xff, 0xff, 0xe3, 0x0, 0x3, 0xef, 0xff, 0xe3,
+    0x0, 0x0, 0x3e, 0xff, 0xfe, 0x30, 0x0, 0x3e, 0xff, 0xff, 0xfe, 0x30, 0x3e, 0xff, 0xe5, 0xef,
+    0xfe, 0x3d, 0xff, 0xe3, 0x3, 0xef, 0xfd, 0xaf, 0xe3, 0x0, 0x3, 0xef, 0xa0, 0x62, 0x0, 0x0,
+    0x2, 0x60,
+
+    /* U+F013 "" */
+    0x0, 0x0, 0x0, 0x8a, 0xa8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x30, 0x6, 0xff, 0xff, 0x60, 0x14, 0x0, 0x4, 0xfd, 0xcf, 0xff, 0xff, 0xfc, 0xdf, 0x40,
+    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x4f, 0xff, 0xff, 0xe9, 0x9e, 0xff, 0xff, 0xf4,
+    0x18, 0xff, 0xfe, 0x20, 0x2, 0xef, 0xff, 0x81, 0x0, 0xef, 0xf9, 0x0, 0x0, 0x9f, 0xfe, 0x0,
+    0x0, 0xef, 0xf9, 0x0, 0x0, 0x9f, 0xfe, 0x0, 0x18, 0xff, 0xfe, 0x20, 0x2, 0xef, 0xff, 0x81,
+    0x4f, 0xff, 0xff, 0xe9, 0x9e, 0xff, 0xff, 0xf4, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
+    0x4, 0xfd, 0xcf, 0xff, 0xff, 0xfc, 0xdf, 0x40, 0x0, 0x41, 0x6, 0xff, 0xff, 0x60, 0x14, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8a, 0xa8, 0x0, 0x0, 0x0,
+
+    /* U+F053 "" */
+    0x0, 0x0, 0x0, 0x1a, 0x50, 0x0, 0x0, 0x1, 0xdf, 0xf1, 0x0, 0x0, 0x1d, 0xff, 0x90, 0x0,
+    0x1, 0xdf, 0xf9, 0x0, 0x0, 0x1d, 0xff, 0x90, 0x0, 0x1, 0xdf, 0xf9, 0x0, 0x0, 0x1d, 0xff,
+    0x90, 0x0, 0x0, 0x1d, 0xff, 0x90, 0x0, 0x0, 0x1, 0xdf, 0xf9, 0x0, 0x0, 0x0, 0x1d, 0xff,
+    0x90, 0x0, 0x0, 0x1, 0xdf, 0xf9, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x90, 0x0, 0x0, 0x1, 0xdf,
+    0xf1, 0x0, 0x0, 0x0, 0x1a, 0x50,
+
+    /* U+F070 "" */
+    0x8c, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0x80, 0x59, 0xdf, 0xed, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xfe, 0xff, 0xc8, 0x8c, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x4, 0xef, 0xf8, 0x0, 0x0, 0x4e, 0xff,
+    0x70, 0x0, 0x0, 0x10, 0x2c, 0xff, 0x69, 0xe8, 0x4, 0xff, 0xf7, 0x0, 0x4, 0xd4, 0x0, 0x8f,
+    0xfe, 0xff, 0x80, 0xcf, 0xff, 0x40, 0xd, 0xff, 0x70, 0x5, 0xef, 0xff, 0xe0, 0x8f, 0xff, 0xd0,
+    0xd, 0xff, 0xf7, 0x0, 0x2d, 0xff, 0xe0, 0x8f, 0xff, 0xd0, 0x4, 0xff, 0xfc, 0x0, 0x1, 0xaf,
+    0xf8, 0xcf, 0xff, 0x40, 0x0, 0x7f, 0xff, 0x50, 0x0, 0x6, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x7,
+    0xff, 0xe4, 0x0, 0x0, 0x3d, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xc8, 0x82, 0x1, 0xbf,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x5a, 0xde, 0xfc, 0x10, 0x8, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4e, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xc8,
+
+    /* U+F0C7 "" */
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0xff, 0x10,
+    0x0, 0x0, 0x1, 0xff, 0xd2, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfc, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x22, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xf2, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x22, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8,
+
+    /* U+F15B "" */
+    0xdf, 0xff, 0xff, 0xf0, 0xd2, 0x0, 0xff, 0xff, 0xff, 0xf0, 0xfd, 0x20, 0xff, 0xff, 0xff, 0xf0,
+    0xff, 0xd2, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd,
+
+    /* U+F1EB "" */
+    0x0, 0x0, 0x4, 0x9b, 0xef, 0xfe, 0xb9, 0x40, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x70, 0x0, 0x4, 0xdf, 0xff, 0xfc, 0x98, 0x89, 0xcf, 0xff, 0xfd, 0x40, 0x6f, 0xff,
+    0xd6, 0x10, 0x0, 0x0, 0x1, 0x6d, 0xff, 0xf6, 0xcf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfc, 0x1a, 0x30, 0x0, 0x5a, 0xde, 0xed, 0xa5, 0x0, 0x3, 0xa1, 0x0, 0x0, 0x4d, 0xff,
+    0xff, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfe, 0xa8, 0x8a, 0xef, 0xff, 0x50, 0x0,
+    0x0, 0x2, 0xde, 0x71, 0x0, 0x0, 0x17, 0xed, 0x20, 0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0,
+    0x0, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xd4, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F240 "" */
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd, 0xff, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xff, 0xff, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80,
+
+    /* U+F241 "" */
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd, 0xff, 0xf,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
+    0x0, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0xff, 0xff, 0xf, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80,
+
+    /* U+F242 "" */
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd, 0xff, 0xf,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80,
+
+    /* U+F243 "" */
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd, 0xff, 0xf,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80,
+
+    /* U+F244 "" */
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfd,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x80,
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 69, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 69, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 18, .adv_w = 100, .box_w = 5, .box_h = 6, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 33, .adv_w = 180, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 99, .adv_w = 159, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 179, .adv_w = 216, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 257, .adv_w = 176, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 323, .adv_w = 54, .box_w = 2, .box_h = 6, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 329, .adv_w = 86, .box_w = 4, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 359, .adv_w = 87, .box_w = 4, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 389, .adv_w = 102, .box_w = 6, .box_h = 7, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 410, .adv_w = 149, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 442, .adv_w = 58, .box_w = 3, .box_h = 6, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 451, .adv_w = 98, .box_w = 6, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 460, .adv_w = 58, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 465, .adv_w = 90, .box_w = 8, .box_h = 16, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 529, .adv_w = 171, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 589, .adv_w = 95, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 619, .adv_w = 147, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 673, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 727, .adv_w = 171, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 793, .adv_w = 147, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 847, .adv_w = 158, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 907, .adv_w = 153, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 961, .adv_w = 165, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1021, .adv_w = 158, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1081, .adv_w = 58, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1095, .adv_w = 58, .box_w = 3, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1113, .adv_w = 149, .box_w = 8, .box_h = 7, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1141, .adv_w = 149, .box_w = 8, .box_h = 6, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1165, .adv_w = 149, .box_w = 8, .box_h = 7, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1193, .adv_w = 147, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1247, .adv_w = 265, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 1375, .adv_w = 187, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1447, .adv_w = 194, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1513, .adv_w = 185, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1579, .adv_w = 211, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1651, .adv_w = 172, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1705, .adv_w = 163, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1759, .adv_w = 198, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1825, .adv_w = 208, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1891, .adv_w = 79, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1909, .adv_w = 131, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1951, .adv_w = 184, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2017, .adv_w = 152, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2071, .adv_w = 244, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2149, .adv_w = 208, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2215, .adv_w = 215, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2293, .adv_w = 185, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2353, .adv_w = 215, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2458, .adv_w = 186, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2518, .adv_w = 159, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2578, .adv_w = 150, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2638, .adv_w = 202, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2704, .adv_w = 182, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2776, .adv_w = 288, .box_w = 18, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2884, .adv_w = 172, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2950, .adv_w = 166, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3016, .adv_w = 168, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3082, .adv_w = 85, .box_w = 4, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3112, .adv_w = 90, .box_w = 7, .box_h = 16, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 3168, .adv_w = 85, .box_w = 4, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3198, .adv_w = 149, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 3223, .adv_w = 128, .box_w = 8, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3227, .adv_w = 154, .box_w = 4, .box_h = 3, .ofs_x = 2, .ofs_y = 9},
+    {.bitmap_index = 3233, .adv_w = 153, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3274, .adv_w = 175, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3334, .adv_w = 146, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3375, .adv_w = 175, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3435, .adv_w = 157, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3480, .adv_w = 90, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3522, .adv_w = 177, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 3587, .adv_w = 174, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3641, .adv_w = 71, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3661, .adv_w = 73, .box_w = 6, .box_h = 17, .ofs_x = -2, .ofs_y = -4},
+    {.bitmap_index = 3712, .adv_w = 158, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3766, .adv_w = 71, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3778, .adv_w = 271, .box_w = 15, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3846, .adv_w = 174, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3887, .adv_w = 163, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3932, .adv_w = 175, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3992, .adv_w = 175, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 4052, .adv_w = 105, .box_w = 5, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4075, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4111, .adv_w = 106, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4150, .adv_w = 173, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4191, .adv_w = 143, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4232, .adv_w = 230, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4300, .adv_w = 141, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4341, .adv_w = 143, .box_w = 10, .box_h = 13, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 4406, .adv_w = 133, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4442, .adv_w = 90, .box_w = 6, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 4487, .adv_w = 77, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 4510, .adv_w = 90, .box_w = 5, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 4548, .adv_w = 149, .box_w = 8, .box_h = 3, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 4560, .adv_w = 107, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 4578, .adv_w = 153, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4632, .adv_w = 80, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 4637, .adv_w = 176, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4703, .adv_w = 256, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4831, .adv_w = 160, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4901, .adv_w = 320, .box_w = 20, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 5061, .adv_w = 224, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5159, .adv_w = 192, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 5255, .adv_w = 320, .box_w = 20, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5395, .adv_w = 320, .box_w = 20, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 5495, .adv_w = 320, .box_w = 20, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 5595, .adv_w = 320, .box_w = 20, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 5695, .adv_w = 320, .box_w = 20, .box_h = 10, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 5795, .adv_w = 320, .box_w = 20, .box_h = 10, .ofs_x = 0, .ofs_y = 1}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0x33, 0x1f72, 0xef5d, 0xef63, 0xefa3, 0xefc0, 0xf017,
+    0xf0ab, 0xf13b, 0xf190, 0xf191, 0xf192, 0xf193, 0xf194
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 176, .range_length = 61845, .glyph_id_start = 96,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 15, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17, 18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27, 28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37, 37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50, 51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58, 58, 59, 58, 60, 41, 0, 0, 9,
+    61, 45, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12, 18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25, 23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29, 29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0, 39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46, 46, 47, 48, 49, 0, 0, 35, 9,
+    50, 37, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 1, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 3, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0, 3, 0, 5, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 12, 0, 7, -6, 0, 0, 5, 0, -14, -15, 2, 12, 6,
+    4, -10, 2, 13, 1, 11, 3, 8, 0, -11, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 15, 2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5, 0, -8, 0, 0, 0, 0, 0, -5, 4, 5, 0, 0,
+    -3, 0, -2, 3, 0, -3, 0, -3, -1, -5, 0, 0, 0, 0, -3, 0,
+    0, -3, -4, 0, 0, -3, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -3, -3, 0, -4, 0, -7, 0, -31, 0, 0, -5, -13, 5, 8,
+    0, 0, -5, 3, 3, 8, 5, -4, 5, 0, 0, -15, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -9, 0, 0, 3, 0, 6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -7, -3, -13, 0, -10, -2, 0, 0, -8,
+    0, 1, 10, 0, -8, -2, -1, 1, 0, -4, 0, 0, -2, -19, 0, 3,
+    0, 8, -7, 0, -5, 0, -10, 3, 0, -20, -2, 10, 3, 0, 0, 0,
+    0, 0, 0, 3, 0, -3, -1, -3, 0, -10, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 8, 0, 3, 0, 0, -5, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 10, 2, 1, 0, 0,
+    0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 5,
+    3, 8, -3, 0, 0, 5, -3, -8, -35, 2, 7, 5, 1, -3, 0, 9,
+    0, 8, 0, 8, 0, -24, 0, -3, 8, 0, 8, -3, 5, 3, 0, 0,
+    1, -3, 0, 0, -4, 20, 0, 20, 0, 8, 0, 11, 3, 11, 4, 8,
+    0, 0, -4, -9, 0, 0, 0, -3, 1, -2, 0, 2, -5, -3, -5, 2,
+    0, -3, 0, 0, 0, -10, 2, -5, 0, -5, -8, 0, -6, -5, -8, 0,
+    0, -17, 0, 0, 0, 0, 3, 0, 0, 0, 0, 3, 0, -3, -6, -3,
+    -3, 0, 1, -14, 3, -16, 0, 0, 0, -8, -2, 0, 25, -3, -3, 3,
+    3, -2, 0, -3, 3, 0, 0, -14, -5, 8, 0, 15, -8, -2, -9, 0,
+    -9, 4, 0, -25, 0, 3, 3, 0, -3, 0, 3, 0, 0, -2, -3, -8,
+    0, -8, 0, -16, 0, 15, -5, 0, -9, 0, 8, 0, -17, -25, -17, -5,
+    8, 0, 0, -17, 0, 3, -6, 0, -4, 0, -5, -10, 0, -3, 8, 0,
+    8, 0, 8, 0, 0, 7, 8, -31, -17, 0, -17, 2, 1, -17, -17, -7,
+    -17, -8, -15, -8, -17, 12, 0, 2, 0, 0, 0, 0, 0, 2, 2, -3,
+    -5, 0, -1, -1, -3, 0, 0, -2, 0, 0, 0, -5, 0, -2, 0, -6,
+    -5, 0, -6, -8, -8, -5, 0, -5, 0, -5, 0, 0, 0, 0, -2, 0,
+    0, 3, 0, 2, -3, 2, 0, 1, 0, 0, 0, 3, -2, 0, 0, 0,
+    -2, 3, 3, -1, 0, 0, 0, -5, 0, -1, 0, 0, 0, 0, 0, 1,
+    0, 3, -2, 0, -3, 0, -4, 0, 0, -2, 0, 8, 0, 0, -3, 0,
+    0, 0, 0, 0, -1, 1, -2, 1, -2, 0, 0, -3, 0, -3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -3, -3, 0, 0, 0, 0,
+    0, 1, 0, 0, -2, 0, -3, -3, -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, -2, -3, -2, 0, -4, 0, -8, -2, -8,
+    5, 0, 0, -5, 3, 5, 7, 0, -6, -1, -3, 0, -1, -12, 3, -2,
+    2, -14, 3, 0, 0, 1, -13, 0, -14, -2, -22, -2, 0, -13, 0, 5,
+    7, 0, 3, 0, 0, 0, 0, 1, 0, -5, -3, -5, 0, -8, 0, 0,
+    0, -3, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, -1, 0, -1, -3,
+    0, 0, 0, 0, 0, 0, 0, -3, -3, 0, -2, -3, -2, 0, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, 0, -3,
+    0, -2, 0, -5, 3, 0, 0, -3, 1, 3, 3, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 2, 0, 0, -3, 0, -3, -2, -3, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, -2, 0, 0, 0, 0, -3, -4, -3,
+    0, -5, 0, 8, -2, 1, -8, 0, 0, 7, -13, -13, -11, -5, 3, 0,
+    -2, -17, -5, 0, -5, 0, -5, 4, -5, -16, 0, -7, 0, 0, 1, -1,
+    2, -2, 0, 3, 0, -8, -10, 0, -13, -6, -5, -6, -8, -3, -7, -1,
+    -5, -1, -7, 2, 0, 1, 0, -3, 0, 0, 0, 2, 0, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, -1, -3, 0,
+    -4, -6, -6, -1, 0, -8, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 1, -2, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    12, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -3, 0, 3, 0, 9,
+    -3, 0, -6, -2, -9, 0, 0, -5, 0, 3, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 2, -3, 2, 0, 0, -2, 0, 0, 0, -5, 0, 0, 3,
+    0, -13, -8, 0, 0, 0, -4, -13, 0, 0, -3, 3, 0, -7, -1, -11,
+    0, -7, 0, 0, -3, -5, -3, -3, -4, 0, 0, -5, 0, 0, -3, 0,
+    0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0, -5, 0, 0, 0, 0,
+    3, 0, 2, -5, -5, 0, -3, -3, -3, 0, 0, 0, 0, 0, 0, -8,
+    0, -3, 0, -4, -3, 0, -6, -6, -8, -2, 0, -5, 0, -8, 0, 0,
+    0, 0, 20, 0, 0, 1, 0, 0, -3, 0, 0, 3, 0, -11, 0, 0,
+    0, 0, 0, -24, -5, 8, 8, -2, -11, 0, 3, -4, 0, -13, -1, -3,
+    3, -18, -3, 3, 0, 4, -9, -4, -9, -8, -11, 0, 0, -15, 0, 15,
+    0, 0, -1, 0, 0, 0, -1, -1, -3, -7, -8, -7, -1, -24, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, -3, -4, 0, 0, -5,
+    0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -5, 0, 0, 5, -1, 3, 0, -6, 3, -2, -1, -7,
+    -3, 0, -3, -3, -2, 0, -4, -4, 0, 0, -2, -1, -2, -4, -3, 0,
+    0, -3, 0, 3, -2, 0, -6, 0, 0, 0, -5, 0, -4, 0, -4, 0,
+    -4, 3, 0, 0, 0, 0, 0, 0, 0, 0, -5, 3, 0, -4, 0, -2,
+    -3, -8, -2, -2, -2, -1, -2, -3, -1, 0, 0, 0, 0, 0, -3, -2,
+    -2, 0, 0, 0, 0, 3, -2, 0, -2, 0, 0, 0, -2, -3, -2, -2,
+    -3, -2, -2, 0, 2, 10, -1, 0, -7, 0, -2, 5, 0, -3, -11, -3,
+    4, 0, 0, -12, -4, 3, -4, 2, 0, -2, -2, -8, 0, -4, 1, 0,
+    0, -4, 0, 0, 0, 3, 3, -5, -5, 0, -4, -3, -4, -3, -3, 0,
+    -4, 1, -5, 1, -4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, 0, 0, -3, 0, 0, -3, -3, 0, 0, 0, 0, -3, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -4, 0,
+    -5, 0, 0, 0, -8, 0, 2, -6, 5, 1, -2, -12, 0, 0, -6, -3,
+    0, -10, -6, -7, 0, 0, -11, -3, -10, -10, -12, 0, -7, 0, 2, 17,
+    -3, 0, -6, -3, -1, -3, -4, -7, -5, -9, -10, -9, -6, -3, 0, 0,
+    -2, 0, 1, 0, 0, -18, -2, 8, 6, -6, -9, 0, 1, -8, 0, -13,
+    -2, -3, 5, -24, -3, 1, 0, 0, -17, -3, -13, -3, -19, 0, 0, -18,
+    0, 15, 1, 0, -2, 0, 0, 0, 0, -1, -2, -10, -2, -10, 0, -17,
+    0, 0, 0, 0, -8, 0, -2, 0, -1, -7, -12, 0, 0, -1, -4, -8,
+    -3, 0, -2, 0, 0, 0, 0, -12, -3, -8, -8, -2, -4, -6, -3, -4,
+    0, -5, -2, -8, -4, 0, -3, -5, -3, -5, 0, 1, 0, -2, -8, -2,
+    0, 5, 0, -5, 0, 0, 0, 0, 3, 0, 2, -5, 10, 0, -3, -3,
+    -3, 0, 0, 0, 0, 0, 0, -8, 0, -3, 0, -4, -3, 0, -6, -6,
+    -8, -2, 0, -5, 2, 10, 0, 0, 0, 0, 20, 0, 0, 1, 0, 0,
+    -3, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, -2, -5, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, -3, 0,
+    0, -5, -3, 0, 0, -5, 0, 4, -1, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 4, 5, 2, -2, 0, -8, -4, 0, 8, -8, -8,
+    -5, -5, 10, 5, 3, -22, -2, 5, -3, 0, -3, 3, -3, -9, 0, -3,
+    3, -3, -2, -8, -2, 0, 0, 8, 5, 0, -7, 0, -14, -3, 7, -3,
+    -10, 1, -3, -8, -8, -8, -3, 10, 3, 0, -4, 0, -7, 0, 2, 8,
+    -6, -9, -10, -6, 8, 0, 1, -19, -2, 3, -4, -2, -6, 0, -6, -9,
+    -4, -4, -2, 0, 0, -6, -5, -3, 0, 8, 6, -3, -14, 0, -14, -4,
+    0, -9, -15, -1, -8, -4, -8, -4, -7, 7, 0, 0, -3, 0, -5, -2,
+    0, -3, -5, 0, 4, -8, 3, 0, 0, -14, 0, -3, -6, -4, -2, -8,
+    -6, -8, -6, 0, -8, -3, -6, -5, -8, -3, 0, 0, 1, 12, -4, 0,
+    -8, -3, 0, -3, -5, -6, -7, -7, -10, -7, -3, -5, 5, 0, -4, 0,
+    -13, -3, 2, 5, -8, -9, -5, -8, 8, -3, 1, -24, -5, 5, -6, -4,
+    -9, 0, -8, -11, -3, -3, -2, -3, -5, -8, -1, 0, 0, 8, 7, -2,
+    -17, 0, -15, -6, 6, -10, -17, -5, -9, -11, -13, -11, -8, 5, 0, 0,
+    0, 0, -3, 0, 0, 3, -3, 5, 2, -5, 5, 0, 0, -8, -1, 0,
+    -1, 0, 1, 1, -2, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0,
+    2, 8, 1, 0, -3, 0, 0, 0, 0, -2, -2, -3, 0, -3, 0, 0,
+    1, 2, 0, 0, 0, 0, 2, 1, -2, 0, 10, 0, 5, 1, 1, -3,
+    0, 5, 0, 0, 0, 2, 0, 0, 0, 0, 5, 0, 6, 1, 7, 0,
+    0, 8, 0, 7, -2, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -15, 0, -3, 4, 0, 8, -35, 0, 25, 3, -5, -5, 3,
+    3, -2, 1, -13, 0, 0, 12, -15, -5, 8, 0, 8, -5, -3, -10, 5,
+    -5, 0, 0, -17, 10, 36, 0, 0, 0, 0, 31, 0, 0, 0, 0, 5,
+    0, 5, 0, -15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0,
+    0, -5, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, 5, -7, 0, 0, 1, -3, 0, 3,
+    33, -5, -2, 8, 7, -7, 3, 0, 0, 3, 3, -3, -8, 15, 8, 21,
+    0, -3, -3, 12, -2, 5, 0, -33, 7, 0, -3, 0, -7, 0, 28, 0,
+    3, -5, -7, -3, 9, 5, 7, 0, 0, 0, 0, -7, 0, 0, 0, -7,
+    0, 0, 0, 0, -6, -1, 0, 0, 0, -6, 0, -3, 0, -12, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -17, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, -3, 0, -3, 0, -5, 0, -4, 0, -7, 0, 0,
+    0, -4, 3, -3, 0, 0, -7, -3, -6, 0, 0, -7, 0, -3, 0, -12,
+    0, -3, 0, 0, -21, -5, -10, -3, -9, 0, 0, -17, 0, -7, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, -4, -5, -4, -2, -4, 0, 0, 0, 0,
+    -6, 0, -6, 3, -3, 5, 0, -2, -6, -2, -4, -5, 0, -3, -1, -2,
+    2, -7, -1, 0, 0, 0, -23, -2, -4, 0, -6, 0, -2, -12, -2, 0,
+    0, -2, -2, 0, 0, 0, 0, 2, 0, -2, -4, -2, -2, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+    0, -6, 0, -2, 0, 0, 0, -5, 3, 0, 0, 0, -7, -3, -5, 0,
+    0, -7, 0, -3, 0, -12, 0, 0, 0, 0, -25, 0, -5, -9, -13, 0,
+    0, -17, 0, -2, -4, 0, 0, 0, 0, 0, 0, 0, 0, -3, -4, -3,
+    -1, -4, 1, 0, 0, 4, -3, 0, 8, 13, -3, -3, -8, 3, 13, 4,
+    6, -7, 3, 11, 3, 7, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 16, 12, -5, -3, 0, -2, 20, 11, 20, 0, 0, 0, 3,
+    0, 3, 0, 9, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, -22, -3,
+    -2, -10, -13, 0, 0, -17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0,
+    -22, -3, -2, -10, -13, 0, 0, -10, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0,
+    -6, 3, 0, -3, 2, 5, 3, -8, 0, -1, -2, 3, 0, 2, 0, 0,
+    0, 0, -6, 0, -2, -2, -5, 0, -2, -10, 0, 16, -3, 0, -6, -2,
+    0, -2, -4, 0, -3, -7, -5, -7, -3, 0, 0, 0, -4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, -22, -3, -2, -10, -13, 0, 0, -17, 0, 0, 0, 0,
+    0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0,
+    -8, -3, -2, 8, -2, -3, -10, 1, -2, 1, -2, -7, 1, 6, 1, 2,
+    1, 2, -6, -10, -3, 0, -10, -5, -7, -11, -10, 0, -4, -5, -3, -3,
+    -2, -2, -3, -2, 0, -2, -1, 4, 0, 4, -2, 4, 0, 8, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -3, -3, 0, 0, -7,
+    0, -1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -15,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, 0, -3,
+    0, 0, 0, 0, -2, 0, 0, -4, -3, 3, 0, -4, -5, -2, 0, -7,
+    -2, -6, -2, -3, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -17, 0, 8, 0, 0, -5, 0, 0, 0, 0, -3, 0, -3, 0, -3,
+    0, -1, 0, 0, -2, 0, -6, 0, 0, 11, -3, -8, -8, 2, 3, 3,
+    -1, -7, 2, 4, 2, 8, 2, 8, -2, -7, 0, 0, -10, 0, 0, -8,
+    -7, 0, 0, -5, 0, -3, -4, 0, -4, 0, -4, 0, -2, 4, 0, -2,
+    -8, -2, -3, 9, 0, 0, -2, 0, -5, 0, 0, 3, -6, 0, 3, -3,
+    2, 0, 0, -8, 0, -2, -1, 0, -3, 3, -2, 0, 0, 0, -10, -3,
+    -6, 0, -8, 0, 0, -12, 0, 9, -3, 0, -5, 0, 2, 0, -3, 0,
+    -3, -8, 0, -8, -3, 3, 0, 0, 0, 0, -2, 0, 0, 3, -3, 1,
+    0, 0, -3, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -16, 0, 6, 0, 0, -2, 0, 0, 0,
+    0, 1, 0, -3, -3, -3, 0, 0, 0, 5, 5, 6, 0, 0, 0, 8,
+    0, -16, -15, 1, 11, 8, 4, -10, 2, 11, 0, 9, 0, 5, 3, -24,
+    0, -3, 10, 0, 7, -5, 5, 0, 0, 14, 0, 0, 0, 0, -4, 0,
+    0, 0, -1, 5, 0, 9, 3, 9, 0, 0
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 61,
+    .right_class_cnt     = 50,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = LV_FONT_FMT_TXT_PLAIN,
+    .cache = &cache
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t lv_font_montserrat_16 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 18,          /*The maximum line height required by the font*/
+    .base_line = 3,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
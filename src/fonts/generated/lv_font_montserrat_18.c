@@ -0,0 +1,2061 @@
+/*******************************************************************************
+ * Size: 18 px
+ * Bpp: 4
+ * Charset: text, 212 glyphs
+ * Generated by tools/fonts/gen_fonts.py from Montserrat-Medium.ttf and FontAwesome5-Solid+Brands+Regular.woff. Do not edit.
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x59, 0x48, 0xf6, 0x8f, 0x57, 0xf5, 0x7f, 0x46, 0xf4, 0x6f, 0x35, 0xf2, 0x4f, 0x20, 0x0, 0x2,
+    0x9, 0xf6, 0x8e, 0x60,
+
+    /* U+0022 "\"" */
+    0x86, 0x5, 0x8d, 0x90, 0x9d, 0xc9, 0x8, 0xdc, 0x80, 0x8c, 0xc8, 0x8, 0xc3, 0x20, 0x23,
+
+    /* U+0023 "#" */
+    0x0, 0x0, 0x83, 0x0, 0x29, 0x0, 0x0, 0x0, 0xf, 0x40, 0x5, 0xe0, 0x0, 0x0, 0x2, 0xf2,
+    0x0, 0x7c, 0x0, 0x0, 0x55, 0x7f, 0x65, 0x5b, 0xc5, 0x51, 0xd, 0xef, 0xfe, 0xee, 0xff, 0xee,
+    0x20, 0x0, 0x7c, 0x0, 0xc, 0x70, 0x0, 0x0, 0x9, 0xa0, 0x0, 0xe5, 0x0, 0x0, 0x0, 0xb8,
+    0x0, 0x1f, 0x30, 0x0, 0x48, 0x8e, 0xb8, 0x89, 0xf9, 0x85, 0x6, 0xbc, 0xfc, 0xbb, 0xdf, 0xbb,
+    0x70, 0x0, 0x2f, 0x20, 0x7, 0xd0, 0x0, 0x0, 0x4, 0xf1, 0x0, 0x8b, 0x0, 0x0, 0x0, 0x5e,
+    0x0, 0xa, 0x90, 0x0, 0x0,
+
+    /* U+0024 "$" */
+    0x0, 0x0, 0xa, 0x30, 0x0, 0x0, 0x0, 0x0, 0xd4, 0x0, 0x0, 0x0, 0x5, 0x9e, 0xc9, 0x50,
+    0x0, 0x1c, 0xfe, 0xfe, 0xff, 0xb0, 0xa, 0xf7, 0xd, 0x41, 0x66, 0x0, 0xed, 0x0, 0xd4, 0x0,
+    0x0, 0xd, 0xe1, 0xd, 0x40, 0x0, 0x0, 0x7f, 0xe7, 0xe4, 0x0, 0x0, 0x0, 0x7e, 0xff, 0xea,
+    0x40, 0x0, 0x0, 0x4, 0xed, 0xff, 0x90, 0x0, 0x0, 0xd, 0x43, 0xdf, 0x40, 0x0, 0x0, 0xd4,
+    0x6, 0xf6, 0x8, 0x20, 0xd, 0x40, 0x9f, 0x41, 0xef, 0xb7, 0xe9, 0xbf, 0xb0, 0x2, 0x8c, 0xff,
+    0xfd, 0x81, 0x0, 0x0, 0x0, 0xd4, 0x0, 0x0, 0x0, 0x0, 0xd, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x10, 0x0, 0x0,
+
+    /* U+0025 "%" */
+    0x0, 0x7a, 0x81, 0x0, 0x0, 0x19, 0x30, 0x0, 0xac, 0x6a, 0xd0, 0x0, 0x8, 0xc0, 0x0, 0x2f,
+    0x10, 0xd, 0x50, 0x4, 0xe3, 0x0, 0x4, 0xd0, 0x0, 0xa7, 0x1, 0xd7, 0x0, 0x0, 0x3e, 0x0,
+    0xb, 0x70, 0x9c, 0x0, 0x0, 0x0, 0xd6, 0x3, 0xe2, 0x4e, 0x20, 0x0, 0x0, 0x4, 0xee, 0xe6,
+    0x1d, 0x61, 0x8b, 0x92, 0x0, 0x0, 0x21, 0xa, 0xb0, 0xbb, 0x59, 0xd0, 0x0, 0x0, 0x5, 0xe2,
+    0x3e, 0x10, 0xd, 0x50, 0x0, 0x1, 0xe6, 0x5, 0xd0, 0x0, 0xa7, 0x0, 0x0, 0xaa, 0x0, 0x4e,
+    0x0, 0xc, 0x60, 0x0, 0x6e, 0x10, 0x0, 0xe6, 0x4, 0xe2, 0x0, 0x2e, 0x50, 0x0, 0x3, 0xce,
+    0xc4, 0x0,
+
+    /* U+0026 "&" */
+    0x0, 0x1, 0x8a, 0x94, 0x0, 0x0, 0x0, 0x2e, 0xd9, 0xbf, 0x60, 0x0, 0x0, 0x8f, 0x20, 0xa,
+    0xc0, 0x0, 0x0, 0x9f, 0x10, 0xb, 0xc0, 0x0, 0x0, 0x4f, 0x91, 0x9f, 0x50, 0x0, 0x0, 0x9,
+    0xfe, 0xe5, 0x0, 0x0, 0x0, 0x2b, 0xff, 0x80, 0x0, 0x0, 0x3, 0xec, 0x39, 0xf8, 0x1, 0xc4,
+    0xd, 0xd1, 0x0, 0x9f, 0x85, 0xf3, 0x2f, 0x80, 0x0, 0x9, 0xfe, 0xc0, 0x1f, 0xc0, 0x0, 0x0,
+    0xdf, 0x90, 0x9, 0xfc, 0x65, 0x7c, 0xfb, 0xf8, 0x0, 0x7d, 0xff, 0xd9, 0x30, 0x8a,
+
+    /* U+0027 "'" */
+    0x86, 0xd9, 0xc9, 0xc8, 0xc8, 0x32,
+
+    /* U+0028 "(" */
+    0x0, 0x15, 0x20, 0x9, 0xf2, 0x1, 0xf9, 0x0, 0x6f, 0x40, 0xb, 0xe0, 0x0, 0xeb, 0x0, 0x2f,
+    0x90, 0x3, 0xf7, 0x0, 0x4f, 0x60, 0x4, 0xf6, 0x0, 0x3f, 0x70, 0x2, 0xf8, 0x0, 0xe, 0xb0,
+    0x0, 0xbe, 0x0, 0x7, 0xf3, 0x0, 0x2f, 0x90, 0x0, 0x9e, 0x10, 0x1, 0x62,
+
+    /* U+0029 ")" */
+    0x25, 0x20, 0x1, 0xea, 0x0, 0x8, 0xf2, 0x0, 0x3f, 0x80, 0x0, 0xdc, 0x0, 0xa, 0xf0, 0x0,
+    0x7f, 0x30, 0x6, 0xf4, 0x0, 0x5f, 0x50, 0x5, 0xf5, 0x0, 0x6f, 0x40, 0x7, 0xf3, 0x0, 0xaf,
+    0x10, 0xd, 0xd0, 0x2, 0xf8, 0x0, 0x8f, 0x30, 0x1e, 0xa0, 0x2, 0x62, 0x0,
+
+    /* U+002A "*" */
+    0x0, 0x5, 0x10, 0x0, 0x0, 0xe2, 0x1, 0x7d, 0x4e, 0x4b, 0xa0, 0x7e, 0xff, 0x81, 0x7, 0xef,
+    0xf8, 0x17, 0xc4, 0xe4, 0xba, 0x0, 0xe, 0x20, 0x10, 0x0, 0x51, 0x0,
+
+    /* U+002B "+" */
+    0x0, 0x2, 0x40, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x8f,
+    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x45, 0x66, 0xbf, 0x66, 0x62, 0x0, 0x8, 0xf0, 0x0, 0x0,
+    0x0, 0x8f, 0x0, 0x0, 0x0, 0x5, 0xa0, 0x0, 0x0,
+
+    /* U+002C "," */
+    0x3, 0x30, 0x1f, 0xf2, 0xd, 0xf2, 0x8, 0xc0, 0xc, 0x70, 0x8, 0x20,
+
+    /* U+002D "-" */
+    0xaa, 0xaa, 0x9c, 0xcc, 0xca,
+
+    /* U+002E "." */
+    0x3, 0x30, 0x1f, 0xf2, 0x1d, 0xd1,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x0, 0x12, 0x0, 0x0, 0x0, 0xcc, 0x0, 0x0, 0x2, 0xf6, 0x0, 0x0, 0x8, 0xf1,
+    0x0, 0x0, 0xd, 0xb0, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0x8e, 0x10, 0x0, 0x0, 0xda, 0x0,
+    0x0, 0x4, 0xf5, 0x0, 0x0, 0x9, 0xe0, 0x0, 0x0, 0xe, 0x90, 0x0, 0x0, 0x5f, 0x40, 0x0,
+    0x0, 0xad, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x6, 0xf3, 0x0, 0x0, 0xb, 0xd0, 0x0, 0x0,
+    0x1f, 0x70, 0x0, 0x0, 0x4a, 0x20, 0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x1, 0x7a, 0xa7, 0x10, 0x0, 0x0, 0x4e, 0xfe, 0xef, 0xe4, 0x0, 0x1, 0xee, 0x40, 0x4,
+    0xee, 0x10, 0x8, 0xf5, 0x0, 0x0, 0x5f, 0x80, 0xd, 0xe0, 0x0, 0x0, 0xe, 0xd0, 0xf, 0xb0,
+    0x0, 0x0, 0xb, 0xf1, 0x2f, 0xa0, 0x0, 0x0, 0xa, 0xf2, 0x1f, 0xb0, 0x0, 0x0, 0xb, 0xf1,
+    0xe, 0xd0, 0x0, 0x0, 0xd, 0xe0, 0xa, 0xf2, 0x0, 0x0, 0x2f, 0xa0, 0x4, 0xfb, 0x10, 0x0,
+    0xbf, 0x40, 0x0, 0x9f, 0xd8, 0x8d, 0xf9, 0x0, 0x0, 0x6, 0xcf, 0xfc, 0x60, 0x0,
+
+    /* U+0031 "1" */
+    0x89, 0x99, 0x7c, 0xee, 0xfc, 0x0, 0xf, 0xc0, 0x0, 0xfc, 0x0, 0xf, 0xc0, 0x0, 0xfc, 0x0,
+    0xf, 0xc0, 0x0, 0xfc, 0x0, 0xf, 0xc0, 0x0, 0xfc, 0x0, 0xf, 0xc0, 0x0, 0xfc, 0x0, 0xf,
+    0xc0,
+
+    /* U+0032 "2" */
+    0x0, 0x59, 0xba, 0x82, 0x0, 0x2d, 0xff, 0xde, 0xff, 0x50, 0x5e, 0x61, 0x0, 0x5f, 0xe0, 0x1,
+    0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0xb, 0xf1, 0x0, 0x0, 0x0, 0x2f, 0xc0, 0x0, 0x0,
+    0x1, 0xcf, 0x30, 0x0, 0x0, 0x1c, 0xf5, 0x0, 0x0, 0x2, 0xdf, 0x50, 0x0, 0x0, 0x2d, 0xf4,
+    0x0, 0x0, 0x2, 0xde, 0x40, 0x0, 0x0, 0x2d, 0xfc, 0x88, 0x88, 0x86, 0x5f, 0xff, 0xff, 0xff,
+    0xfb,
+
+    /* U+0033 "3" */
+    0x39, 0x99, 0x99, 0x99, 0x90, 0x5e, 0xee, 0xee, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0,
+    0x0, 0x8, 0xf7, 0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0x3, 0xee, 0x30, 0x0, 0x0, 0x7,
+    0xff, 0xfc, 0x30, 0x0, 0x1, 0x23, 0x8f, 0xe1, 0x0, 0x0, 0x0, 0x8, 0xf6, 0x0, 0x0, 0x0,
+    0x6, 0xf7, 0x46, 0x0, 0x0, 0xb, 0xf4, 0xaf, 0xd9, 0x78, 0xdf, 0xb0, 0x17, 0xce, 0xff, 0xd8,
+    0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x19, 0x80, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x0, 0x8, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x2, 0xed, 0x10, 0x0, 0x0, 0x0, 0x1c,
+    0xe2, 0x1, 0x62, 0x0, 0x0, 0xaf, 0x50, 0x4, 0xf6, 0x0, 0x6, 0xf8, 0x0, 0x4, 0xf6, 0x0,
+    0x3f, 0xfa, 0xaa, 0xab, 0xfc, 0xa8, 0x4e, 0xee, 0xee, 0xee, 0xfe, 0xeb, 0x0, 0x0, 0x0, 0x5,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x0,
+
+    /* U+0035 "5" */
+    0x1, 0x99, 0x99, 0x99, 0x90, 0x3, 0xff, 0xee, 0xee, 0xe0, 0x5, 0xf5, 0x0, 0x0, 0x0, 0x6,
+    0xf4, 0x0, 0x0, 0x0, 0x8, 0xf2, 0x0, 0x0, 0x0, 0x9, 0xf9, 0x98, 0x51, 0x0, 0xb, 0xff,
+    0xff, 0xfe, 0x70, 0x0, 0x0, 0x1, 0x5d, 0xf4, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0,
+    0x2, 0xfa, 0x18, 0x10, 0x0, 0x8, 0xf7, 0x7f, 0xea, 0x78, 0xcf, 0xd1, 0x5, 0xbe, 0xff, 0xd9,
+    0x10,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x49, 0xba, 0x83, 0x0, 0x2, 0xcf, 0xed, 0xdf, 0xb0, 0x0, 0xcf, 0x71, 0x0, 0x12,
+    0x0, 0x7f, 0x70, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xfb, 0x5, 0x99, 0x72,
+    0x0, 0x1f, 0xbc, 0xfd, 0xdf, 0xf7, 0x1, 0xff, 0xd3, 0x0, 0x2d, 0xf3, 0xf, 0xf4, 0x0, 0x0,
+    0x4f, 0x80, 0xbf, 0x20, 0x0, 0x3, 0xf9, 0x6, 0xf8, 0x0, 0x0, 0x8f, 0x50, 0xa, 0xfa, 0x66,
+    0xaf, 0xc0, 0x0, 0x6, 0xce, 0xfd, 0x91, 0x0,
+
+    /* U+0037 "7" */
+    0x49, 0x99, 0x99, 0x99, 0x99, 0x7f, 0xfe, 0xee, 0xee, 0xff, 0x7f, 0x40, 0x0, 0x3, 0xfa, 0x7f,
+    0x40, 0x0, 0xa, 0xf3, 0x13, 0x10, 0x0, 0x2f, 0xb0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0,
+    0x1, 0xed, 0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0, 0xd, 0xe1, 0x0, 0x0, 0x0, 0x6f,
+    0x80, 0x0, 0x0, 0x0, 0xcf, 0x10, 0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x0,
+    0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x5, 0x9b, 0xa8, 0x20, 0x0, 0x1b, 0xfe, 0xbc, 0xff, 0x60, 0x7, 0xf9, 0x0, 0x2, 0xdf,
+    0x20, 0xbf, 0x10, 0x0, 0x7, 0xf5, 0x9, 0xf4, 0x0, 0x0, 0xaf, 0x30, 0x2e, 0xe7, 0x45, 0x9f,
+    0xa0, 0x0, 0x7f, 0xff, 0xff, 0xd2, 0x0, 0x8f, 0xb5, 0x33, 0x7e, 0xe2, 0x1f, 0xd0, 0x0, 0x0,
+    0x4f, 0x93, 0xfa, 0x0, 0x0, 0x1, 0xfb, 0x1e, 0xd1, 0x0, 0x0, 0x6f, 0x90, 0x7f, 0xd7, 0x56,
+    0xaf, 0xe2, 0x0, 0x5b, 0xef, 0xfd, 0x92, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x28, 0xaa, 0x82, 0x0, 0x0, 0x5f, 0xfc, 0xbe, 0xf6, 0x0, 0x1f, 0xd2, 0x0, 0x1b, 0xf4,
+    0x6, 0xf6, 0x0, 0x0, 0x2f, 0xb0, 0x7f, 0x50, 0x0, 0x1, 0xff, 0x14, 0xfb, 0x0, 0x0, 0x7f,
+    0xf2, 0xb, 0xfc, 0x77, 0xbf, 0xdf, 0x30, 0x8, 0xdf, 0xfc, 0x49, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x10, 0x0, 0x0, 0x0, 0x2f, 0xb0, 0x0, 0x0, 0x0, 0x1c, 0xf4, 0x0, 0x6b, 0x77, 0x9e,
+    0xf7, 0x0, 0x7, 0xef, 0xfe, 0xa4, 0x0, 0x0,
+
+    /* U+003A ":" */
+    0x6, 0x70, 0x2f, 0xf3, 0xa, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x30,
+    0x1f, 0xf2, 0x1d, 0xd1,
+
+    /* U+003B ";" */
+    0x6, 0x70, 0x2f, 0xf3, 0xa, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x30,
+    0x1f, 0xf2, 0xd, 0xf2, 0x8, 0xc0, 0xc, 0x70, 0x8, 0x20,
+
+    /* U+003C "<" */
+    0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x38, 0xe4, 0x0, 0x16, 0xcf, 0xe8, 0x13, 0x9e, 0xfa,
+    0x50, 0x0, 0xcf, 0x81, 0x0, 0x0, 0x8, 0xef, 0xa4, 0x0, 0x0, 0x1, 0x6c, 0xfd, 0x82, 0x0,
+    0x0, 0x3, 0x8e, 0xf4, 0x0, 0x0, 0x0, 0x5, 0x20,
+
+    /* U+003D "=" */
+    0x22, 0x22, 0x22, 0x22, 0x1c, 0xff, 0xff, 0xff, 0xf4, 0x34, 0x44, 0x44, 0x44, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xdd, 0xdd, 0xdd, 0xd4, 0x68, 0x88, 0x88, 0x88, 0x20,
+
+    /* U+003E ">" */
+    0x10, 0x0, 0x0, 0x0, 0xc, 0xb5, 0x0, 0x0, 0x0, 0x5b, 0xfe, 0x83, 0x0, 0x0, 0x2, 0x8d,
+    0xfc, 0x61, 0x0, 0x0, 0x4, 0xdf, 0x40, 0x0, 0x27, 0xdf, 0xc2, 0x5, 0xbf, 0xe9, 0x30, 0xb,
+    0xfb, 0x50, 0x0, 0x0, 0x62, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+003F "?" */
+    0x0, 0x59, 0xba, 0x82, 0x0, 0x2d, 0xfe, 0xcd, 0xff, 0x50, 0x7e, 0x60, 0x0, 0x5f, 0xe0, 0x1,
+    0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0xaf, 0x60, 0x0, 0x0,
+    0xb, 0xf7, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x0, 0xde, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x1, 0xee, 0x10, 0x0, 0x0, 0x1, 0xdd, 0x10,
+    0x0,
+
+    /* U+0040 "@" */
+    0x0, 0x0, 0x0, 0x58, 0xab, 0xa7, 0x30, 0x0, 0x0, 0x0, 0x0, 0x6e, 0xea, 0x87, 0x9b, 0xfc,
+    0x30, 0x0, 0x0, 0xa, 0xe6, 0x10, 0x0, 0x0, 0x29, 0xf6, 0x0, 0x0, 0x8e, 0x30, 0x0, 0x11,
+    0x0, 0x0, 0x5f, 0x40, 0x3, 0xf4, 0x0, 0x5d, 0xff, 0xc5, 0xbc, 0x8, 0xd0, 0x9, 0xc0, 0x6,
+    0xfc, 0x65, 0x8f, 0xec, 0x1, 0xe5, 0xe, 0x60, 0x1e, 0xb0, 0x0, 0x5, 0xfc, 0x0, 0xa9, 0x1f,
+    0x40, 0x5f, 0x50, 0x0, 0x0, 0xdc, 0x0, 0x8a, 0x2f, 0x30, 0x6f, 0x30, 0x0, 0x0, 0xbc, 0x0,
+    0x8b, 0x1f, 0x40, 0x5f, 0x50, 0x0, 0x0, 0xdc, 0x0, 0x9a, 0xd, 0x70, 0x1e, 0xc0, 0x0, 0x5,
+    0xfd, 0x0, 0xc7, 0x9, 0xc0, 0x6, 0xfc, 0x65, 0x9f, 0xcf, 0x69, 0xe1, 0x2, 0xf6, 0x0, 0x5c,
+    0xee, 0xc5, 0x2c, 0xfc, 0x40, 0x0, 0x7f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xfa, 0x30, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xfd, 0xbb, 0xce, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x25, 0x77, 0x64, 0x0, 0x0, 0x0,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x4, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x1d, 0xd0, 0x0, 0x0, 0x0, 0x3, 0xf9, 0x6,
+    0xf5, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x1, 0xec, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x8f, 0x40,
+    0x0, 0x0, 0x8f, 0x40, 0x0, 0x2f, 0xa0, 0x0, 0x1, 0xef, 0x99, 0x99, 0x9e, 0xf2, 0x0, 0x6,
+    0xfd, 0xdd, 0xdd, 0xdd, 0xf9, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0xcf, 0x10, 0x5f, 0x70, 0x0,
+    0x0, 0x0, 0x5f, 0x80, 0xcf, 0x10, 0x0, 0x0, 0x0, 0xd, 0xe1,
+
+    /* U+0042 "B" */
+    0x19, 0x99, 0x99, 0x98, 0x51, 0x0, 0x2f, 0xed, 0xdd, 0xdf, 0xfd, 0x30, 0x2f, 0xa0, 0x0, 0x0,
+    0x7f, 0xc0, 0x2f, 0xa0, 0x0, 0x0, 0xc, 0xf0, 0x2f, 0xa0, 0x0, 0x0, 0xd, 0xe0, 0x2f, 0xb2,
+    0x22, 0x24, 0xaf, 0x70, 0x2f, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x2f, 0xc5, 0x55, 0x56, 0x9f, 0xd1,
+    0x2f, 0xa0, 0x0, 0x0, 0x6, 0xf8, 0x2f, 0xa0, 0x0, 0x0, 0x2, 0xfa, 0x2f, 0xa0, 0x0, 0x0,
+    0x7, 0xf9, 0x2f, 0xc7, 0x77, 0x78, 0xbf, 0xe2, 0x2f, 0xff, 0xff, 0xfe, 0xd9, 0x20,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x16, 0x9b, 0xa7, 0x20, 0x0, 0x0, 0x7f, 0xff, 0xde, 0xff, 0x70, 0x0, 0x8f, 0xd5,
+    0x0, 0x4, 0xcd, 0x10, 0x4f, 0xc1, 0x0, 0x0, 0x0, 0x20, 0xb, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0x80, 0x0, 0x0, 0x79, 0x0, 0x2, 0xcf, 0xe9, 0x79, 0xdf, 0xd1, 0x0, 0x1,
+    0x7c, 0xef, 0xfc, 0x71, 0x0,
+
+    /* U+0044 "D" */
+    0x19, 0x99, 0x99, 0x87, 0x40, 0x0, 0x2, 0xff, 0xee, 0xef, 0xff, 0xd4, 0x0, 0x2f, 0xa0, 0x0,
+    0x2, 0x7e, 0xf6, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x2e, 0xf3, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x5f,
+    0x92, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xed, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0xde, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xb2, 0xfa, 0x0, 0x0, 0x0, 0xa,
+    0xf5, 0x2f, 0xa0, 0x0, 0x0, 0x1a, 0xfb, 0x2, 0xfd, 0x88, 0x89, 0xbf, 0xfa, 0x10, 0x2f, 0xff,
+    0xff, 0xed, 0xa4, 0x0, 0x0,
+
+    /* U+0045 "E" */
+    0x19, 0x99, 0x99, 0x99, 0x97, 0x2, 0xff, 0xee, 0xee, 0xee, 0xb0, 0x2f, 0xa0, 0x0, 0x0, 0x0,
+    0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2, 0xfb, 0x22, 0x22, 0x22,
+    0x0, 0x2f, 0xff, 0xff, 0xff, 0xf0, 0x2, 0xfc, 0x55, 0x55, 0x55, 0x0, 0x2f, 0xa0, 0x0, 0x0,
+    0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2, 0xfd, 0x88, 0x88,
+    0x88, 0x80, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x10,
+
+    /* U+0046 "F" */
+    0x19, 0x99, 0x99, 0x99, 0x97, 0x2f, 0xfe, 0xee, 0xee, 0xeb, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2f,
+    0xa0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xda,
+    0xaa, 0xaa, 0xa0, 0x2f, 0xfe, 0xee, 0xee, 0xe0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0,
+    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0,
+    0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x0, 0x16, 0x9b, 0xa7, 0x20, 0x0, 0x0, 0x7f, 0xff, 0xde, 0xff, 0x90, 0x0, 0x8f, 0xd5,
+    0x0, 0x3, 0xae, 0x30, 0x4f, 0xc1, 0x0, 0x0, 0x0, 0x20, 0xb, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x26, 0x21, 0xfb, 0x0,
+    0x0, 0x0, 0x6, 0xf5, 0xd, 0xe1, 0x0, 0x0, 0x0, 0x6f, 0x50, 0x7f, 0x90, 0x0, 0x0, 0x6,
+    0xf5, 0x1, 0xcf, 0x80, 0x0, 0x0, 0x7f, 0x50, 0x2, 0xcf, 0xe9, 0x78, 0xcf, 0xe3, 0x0, 0x0,
+    0x6b, 0xef, 0xfd, 0x92, 0x0,
+
+    /* U+0048 "H" */
+    0x19, 0x60, 0x0, 0x0, 0x1, 0x97, 0x2f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x2f, 0xa0, 0x0, 0x0,
+    0x1, 0xfb, 0x2f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x2f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x2f, 0xb3,
+    0x33, 0x33, 0x34, 0xfb, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x2f, 0xc6, 0x66, 0x66, 0x66, 0xfb,
+    0x2f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x2f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x2f, 0xa0, 0x0, 0x0,
+    0x1, 0xfb, 0x2f, 0xa0, 0x0, 0x0, 0x1, 0xfb, 0x2f, 0xa0, 0x0, 0x0, 0x1, 0xfb,
+
+    /* U+0049 "I" */
+    0x19, 0x62, 0xfa, 0x2f, 0xa2, 0xfa, 0x2f, 0xa2, 0xfa, 0x2f, 0xa2, 0xfa, 0x2f, 0xa2, 0xfa, 0x2f,
+    0xa2, 0xfa, 0x2f, 0xa0,
+
+    /* U+004A "J" */
+    0x8, 0x99, 0x99, 0x94, 0xd, 0xee, 0xef, 0xf7, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x5, 0xf7,
+    0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x5, 0xf7,
+    0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x6, 0xf6, 0x74, 0x0, 0xa, 0xf4, 0xdf, 0x97, 0xaf, 0xc0,
+    0x2a, 0xef, 0xea, 0x20,
+
+    /* U+004B "K" */
+    0x19, 0x60, 0x0, 0x0, 0x7, 0x93, 0x2f, 0xa0, 0x0, 0x0, 0x8f, 0x80, 0x2f, 0xa0, 0x0, 0x8,
+    0xf9, 0x0, 0x2f, 0xa0, 0x0, 0x7f, 0x90, 0x0, 0x2f, 0xa0, 0x7, 0xfa, 0x0, 0x0, 0x2f, 0xa0,
+    0x6f, 0xb0, 0x0, 0x0, 0x2f, 0xa6, 0xff, 0x80, 0x0, 0x0, 0x2f, 0xef, 0xcd, 0xf6, 0x0, 0x0,
+    0x2f, 0xfc, 0x12, 0xef, 0x30, 0x0, 0x2f, 0xd1, 0x0, 0x3f, 0xe2, 0x0, 0x2f, 0xa0, 0x0, 0x5,
+    0xfc, 0x10, 0x2f, 0xa0, 0x0, 0x0, 0x7f, 0xa0, 0x2f, 0xa0, 0x0, 0x0, 0x9, 0xf8,
+
+    /* U+004C "L" */
+    0x19, 0x60, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2f,
+    0xa0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xa0,
+    0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0,
+    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xd8, 0x88, 0x88, 0x84, 0x2f, 0xff, 0xff, 0xff,
+    0xf8,
+
+    /* U+004D "M" */
+    0x19, 0x50, 0x0, 0x0, 0x0, 0x0, 0x39, 0x32, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xc, 0xf4, 0x2f,
+    0xf9, 0x0, 0x0, 0x0, 0x6, 0xff, 0x42, 0xff, 0xf3, 0x0, 0x0, 0x1, 0xef, 0xf4, 0x2f, 0xae,
+    0xc0, 0x0, 0x0, 0x9f, 0x9f, 0x42, 0xf9, 0x6f, 0x60, 0x0, 0x3f, 0x87, 0xf4, 0x2f, 0x90, 0xce,
+    0x10, 0xb, 0xe1, 0x7f, 0x42, 0xf9, 0x3, 0xf9, 0x5, 0xf5, 0x7, 0xf4, 0x2f, 0x90, 0x9, 0xf3,
+    0xdb, 0x0, 0x7f, 0x42, 0xf9, 0x0, 0x1e, 0xef, 0x30, 0x7, 0xf4, 0x2f, 0x90, 0x0, 0x6f, 0x90,
+    0x0, 0x6f, 0x42, 0xf9, 0x0, 0x0, 0x71, 0x0, 0x6, 0xf4, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0x40,
+
+    /* U+004E "N" */
+    0x19, 0x50, 0x0, 0x0, 0x1, 0x97, 0x2f, 0xf4, 0x0, 0x0, 0x1, 0xfb, 0x2f, 0xfe, 0x20, 0x0,
+    0x1, 0xfb, 0x2f, 0xef, 0xc1, 0x0, 0x1, 0xfb, 0x2f, 0xa9, 0xfa, 0x0, 0x1, 0xfb, 0x2f, 0xa0,
+    0xbf, 0x70, 0x1, 0xfb, 0x2f, 0xa0, 0x1d, 0xf4, 0x1, 0xfb, 0x2f, 0xa0, 0x3, 0xfe, 0x21, 0xfb,
+    0x2f, 0xa0, 0x0, 0x6f, 0xc2, 0xfb, 0x2f, 0xa0, 0x0, 0x8, 0xfb, 0xfb, 0x2f, 0xa0, 0x0, 0x0,
+    0xbf, 0xfb, 0x2f, 0xa0, 0x0, 0x0, 0x1d, 0xfb, 0x2f, 0xa0, 0x0, 0x0, 0x3, 0xeb,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x16, 0x9b, 0xa7, 0x20, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xde, 0xff, 0x80, 0x0, 0x0,
+    0x8f, 0xd5, 0x0, 0x4, 0xcf, 0xa0, 0x0, 0x4f, 0xc1, 0x0, 0x0, 0x0, 0xbf, 0x60, 0xb, 0xf3,
+    0x0, 0x0, 0x0, 0x2, 0xfd, 0x0, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x1f, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0x31, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0xd, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0xde, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x1, 0xcf, 0x80, 0x0, 0x0,
+    0x6f, 0xe1, 0x0, 0x2, 0xcf, 0xd9, 0x79, 0xdf, 0xd3, 0x0, 0x0, 0x0, 0x6b, 0xef, 0xec, 0x71,
+    0x0, 0x0,
+
+    /* U+0050 "P" */
+    0x19, 0x99, 0x99, 0x86, 0x20, 0x2, 0xff, 0xee, 0xff, 0xff, 0x70, 0x2f, 0xa0, 0x0, 0x4, 0xcf,
+    0x62, 0xfa, 0x0, 0x0, 0x1, 0xed, 0x2f, 0xa0, 0x0, 0x0, 0xc, 0xf2, 0xfa, 0x0, 0x0, 0x0,
+    0xdf, 0x2f, 0xa0, 0x0, 0x0, 0x5f, 0xb2, 0xfc, 0x66, 0x67, 0xaf, 0xe3, 0x2f, 0xff, 0xff, 0xfe,
+    0xa2, 0x2, 0xfb, 0x33, 0x32, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0051 "Q" */
+    0x0, 0x0, 0x16, 0x9b, 0xa7, 0x20, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xde, 0xff, 0x80, 0x0, 0x0,
+    0x8f, 0xd5, 0x0, 0x4, 0xcf, 0xa0, 0x0, 0x4f, 0xc1, 0x0, 0x0, 0x0, 0xbf, 0x60, 0xb, 0xf3,
+    0x0, 0x0, 0x0, 0x2, 0xfd, 0x0, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x1f, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0x31, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf3, 0xd, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0xde, 0x10, 0x7f, 0x80, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x1, 0xcf, 0x80, 0x0, 0x0,
+    0x6f, 0xe1, 0x0, 0x2, 0xcf, 0xd9, 0x79, 0xdf, 0xe3, 0x0, 0x0, 0x1, 0x6c, 0xef, 0xfd, 0x81,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xd4, 0x1, 0x86, 0x0, 0x0, 0x0, 0x0, 0x4d, 0xfe, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0x76, 0x20,
+
+    /* U+0052 "R" */
+    0x19, 0x99, 0x99, 0x86, 0x20, 0x0, 0x2f, 0xfe, 0xef, 0xff, 0xf7, 0x0, 0x2f, 0xa0, 0x0, 0x4,
+    0xcf, 0x60, 0x2f, 0xa0, 0x0, 0x0, 0x1e, 0xd0, 0x2f, 0xa0, 0x0, 0x0, 0xc, 0xf0, 0x2f, 0xa0,
+    0x0, 0x0, 0xd, 0xe0, 0x2f, 0xa0, 0x0, 0x0, 0x5f, 0xb0, 0x2f, 0xc5, 0x55, 0x6a, 0xfe, 0x30,
+    0x2f, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x2f, 0xb2, 0x22, 0x4f, 0xc0, 0x0, 0x2f, 0xa0, 0x0, 0x7,
+    0xf8, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0xbf, 0x30, 0x2f, 0xa0, 0x0, 0x0, 0x2e, 0xd1,
+
+    /* U+0053 "S" */
+    0x0, 0x5, 0x9b, 0xb9, 0x50, 0x0, 0x1c, 0xfe, 0xcd, 0xff, 0xb0, 0xa, 0xf7, 0x0, 0x1, 0x66,
+    0x0, 0xed, 0x0, 0x0, 0x0, 0x0, 0xd, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe7, 0x30, 0x0,
+    0x0, 0x0, 0x7e, 0xff, 0xea, 0x40, 0x0, 0x0, 0x4, 0x8c, 0xff, 0x90, 0x0, 0x0, 0x0, 0x2,
+    0xcf, 0x40, 0x0, 0x0, 0x0, 0x6, 0xf6, 0x8, 0x20, 0x0, 0x0, 0x9f, 0x41, 0xef, 0xb7, 0x67,
+    0xbf, 0xb0, 0x2, 0x8c, 0xff, 0xfd, 0x81, 0x0,
+
+    /* U+0054 "T" */
+    0x89, 0x99, 0x99, 0x99, 0x99, 0x4d, 0xee, 0xef, 0xff, 0xee, 0xe7, 0x0, 0x0, 0x9f, 0x30, 0x0,
+    0x0, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30,
+    0x0, 0x0, 0x0, 0x9, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0, 0x9, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0x29, 0x50, 0x0, 0x0, 0x3, 0x94, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
+    0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
+    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf6,
+    0x2f, 0xa0, 0x0, 0x0, 0x6, 0xf5, 0xe, 0xe0, 0x0, 0x0, 0xa, 0xf3, 0x9, 0xf8, 0x0, 0x0,
+    0x4f, 0xc0, 0x1, 0xdf, 0xc8, 0x7a, 0xfe, 0x30, 0x0, 0x18, 0xdf, 0xfd, 0x92, 0x0,
+
+    /* U+0056 "V" */
+    0x89, 0x10, 0x0, 0x0, 0x0, 0x19, 0x68, 0xf6, 0x0, 0x0, 0x0, 0x7, 0xf5, 0x2f, 0xd0, 0x0,
+    0x0, 0x0, 0xdd, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x5f, 0x70, 0x3, 0xfb, 0x0, 0x0, 0xc, 0xe1,
+    0x0, 0xc, 0xf2, 0x0, 0x3, 0xf9, 0x0, 0x0, 0x5f, 0x90, 0x0, 0xaf, 0x20, 0x0, 0x0, 0xde,
+    0x10, 0x2f, 0xb0, 0x0, 0x0, 0x7, 0xf7, 0x8, 0xf4, 0x0, 0x0, 0x0, 0x1e, 0xd1, 0xed, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x2, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xf8, 0x0, 0x0, 0x0,
+
+    /* U+0057 "W" */
+    0x39, 0x50, 0x0, 0x0, 0x7, 0x91, 0x0, 0x0, 0x1, 0x95, 0x1f, 0xc0, 0x0, 0x0, 0x1e, 0xf6,
+    0x0, 0x0, 0x6, 0xf5, 0xb, 0xf2, 0x0, 0x0, 0x5f, 0xfb, 0x0, 0x0, 0xb, 0xe1, 0x6, 0xf7,
+    0x0, 0x0, 0xae, 0xaf, 0x10, 0x0, 0x1f, 0xa0, 0x1, 0xfc, 0x0, 0x1, 0xf9, 0x5f, 0x60, 0x0,
+    0x6f, 0x50, 0x0, 0xbf, 0x20, 0x6, 0xf4, 0xe, 0xb0, 0x0, 0xbe, 0x10, 0x0, 0x6f, 0x70, 0xb,
+    0xe0, 0x9, 0xf2, 0x1, 0xfa, 0x0, 0x0, 0x1f, 0xc0, 0x1f, 0x90, 0x4, 0xf6, 0x6, 0xf5, 0x0,
+    0x0, 0xb, 0xf2, 0x6f, 0x40, 0x0, 0xec, 0xb, 0xe1, 0x0, 0x0, 0x6, 0xf7, 0xce, 0x0, 0x0,
+    0x9f, 0x3f, 0xa0, 0x0, 0x0, 0x1, 0xfd, 0xf9, 0x0, 0x0, 0x4f, 0xdf, 0x50, 0x0, 0x0, 0x0,
+    0xbf, 0xf3, 0x0, 0x0, 0xe, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0, 0x9, 0xfa,
+    0x0, 0x0,
+
+    /* U+0058 "X" */
+    0x29, 0x70, 0x0, 0x0, 0x6, 0x93, 0xa, 0xf6, 0x0, 0x0, 0x3f, 0xb0, 0x1, 0xde, 0x20, 0x1,
+    0xde, 0x20, 0x0, 0x4f, 0xc0, 0xa, 0xf4, 0x0, 0x0, 0x8, 0xf8, 0x5f, 0x80, 0x0, 0x0, 0x0,
+    0xcf, 0xec, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfc, 0x0, 0x0,
+    0x0, 0x7, 0xf8, 0x7f, 0x90, 0x0, 0x0, 0x3f, 0xc0, 0xb, 0xf5, 0x0, 0x1, 0xde, 0x20, 0x1,
+    0xee, 0x20, 0xa, 0xf6, 0x0, 0x0, 0x4f, 0xc0, 0x6f, 0xa0, 0x0, 0x0, 0x8, 0xf8,
+
+    /* U+0059 "Y" */
+    0x89, 0x10, 0x0, 0x0, 0x2, 0x95, 0x6f, 0x80, 0x0, 0x0, 0xb, 0xe2, 0xc, 0xf2, 0x0, 0x0,
+    0x5f, 0x70, 0x3, 0xfb, 0x0, 0x1, 0xdc, 0x0, 0x0, 0x9f, 0x50, 0x8, 0xf4, 0x0, 0x0, 0x1e,
+    0xd1, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf8, 0xce, 0x10, 0x0, 0x0, 0x0, 0xbf, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
+
+    /* U+005A "Z" */
+    0x19, 0x99, 0x99, 0x99, 0x99, 0x91, 0x1e, 0xee, 0xee, 0xee, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x60, 0x0, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0,
+    0x3, 0xed, 0x10, 0x0, 0x0, 0x0, 0x1d, 0xe3, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0, 0x0,
+    0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x3, 0xfd, 0x10, 0x0,
+    0x0, 0x0, 0x1e, 0xfb, 0x88, 0x88, 0x88, 0x83, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf5,
+
+    /* U+005B "[" */
+    0x15, 0x55, 0x32, 0xff, 0xfa, 0x2f, 0xa1, 0x12, 0xf9, 0x0, 0x2f, 0x90, 0x2, 0xf9, 0x0, 0x2f,
+    0x90, 0x2, 0xf9, 0x0, 0x2f, 0x90, 0x2, 0xf9, 0x0, 0x2f, 0x90, 0x2, 0xf9, 0x0, 0x2f, 0x90,
+    0x2, 0xf9, 0x0, 0x2f, 0x90, 0x2, 0xf9, 0x10, 0x2f, 0xff, 0xa1, 0x66, 0x64,
+
+    /* U+005C "\\" */
+    0x22, 0x0, 0x0, 0x0, 0x7f, 0x20, 0x0, 0x0, 0x2f, 0x70, 0x0, 0x0, 0xb, 0xc0, 0x0, 0x0,
+    0x6, 0xf3, 0x0, 0x0, 0x1, 0xf8, 0x0, 0x0, 0x0, 0xad, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0,
+    0x0, 0x1e, 0x90, 0x0, 0x0, 0x9, 0xe0, 0x0, 0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0xea, 0x0,
+    0x0, 0x0, 0x9e, 0x10, 0x0, 0x0, 0x3f, 0x50, 0x0, 0x0, 0xd, 0xa0, 0x0, 0x0, 0x8, 0xf1,
+    0x0, 0x0, 0x2, 0xf6, 0x0, 0x0, 0x0, 0x97,
+
+    /* U+005D "]" */
+    0x45, 0x55, 0x1a, 0xff, 0xf2, 0x11, 0xaf, 0x20, 0x9, 0xf2, 0x0, 0x9f, 0x20, 0x9, 0xf2, 0x0,
+    0x9f, 0x20, 0x9, 0xf2, 0x0, 0x9f, 0x20, 0x9, 0xf2, 0x0, 0x9f, 0x20, 0x9, 0xf2, 0x0, 0x9f,
+    0x20, 0x9, 0xf2, 0x0, 0x9f, 0x20, 0x1a, 0xf2, 0xaf, 0xff, 0x24, 0x66, 0x61,
+
+    /* U+005E "^" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0xa, 0xf3, 0x0, 0x0, 0x2f, 0xd9, 0x0, 0x0, 0x8c, 0x4f, 0x10,
+    0x1, 0xe6, 0xd, 0x70, 0x6, 0xe1, 0x7, 0xd0, 0xc, 0x80, 0x1, 0xf5, 0x4f, 0x20, 0x0, 0x9b,
+    0x46, 0x0, 0x0, 0x27,
+
+    /* U+005F "_" */
+    0xff, 0xff, 0xff, 0xff, 0xf0,
+
+    /* U+0060 "`" */
+    0x34, 0x20, 0x2, 0xce, 0x30, 0x0, 0x9e, 0x30, 0x0, 0x11,
+
+    /* U+0061 "a" */
+    0x0, 0x27, 0x99, 0x72, 0x0, 0x8, 0xff, 0xde, 0xfe, 0x40, 0x5, 0x81, 0x0, 0x4f, 0xd0, 0x0,
+    0x0, 0x0, 0xa, 0xf2, 0x0, 0x26, 0x77, 0x7b, 0xf3, 0x6, 0xfe, 0xcb, 0xbd, 0xf3, 0xe, 0xd1,
+    0x0, 0x8, 0xf3, 0x1f, 0xa0, 0x0, 0xc, 0xf3, 0xc, 0xf7, 0x45, 0xbf, 0xf3, 0x2, 0x9d, 0xfe,
+    0x97, 0xf3,
+
+    /* U+0062 "b" */
+    0x25, 0x20, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0,
+    0x5, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x52, 0x79, 0x84, 0x0, 0x5, 0xfa, 0xef, 0xef, 0xfb,
+    0x10, 0x5f, 0xf9, 0x10, 0x18, 0xfb, 0x5, 0xfc, 0x0, 0x0, 0xa, 0xf3, 0x5f, 0x70, 0x0, 0x0,
+    0x5f, 0x75, 0xf6, 0x0, 0x0, 0x4, 0xf7, 0x5f, 0x90, 0x0, 0x0, 0x7f, 0x55, 0xfe, 0x30, 0x0,
+    0x2e, 0xe1, 0x5f, 0xde, 0x97, 0x9e, 0xf5, 0x5, 0xf5, 0x8d, 0xfe, 0xb4, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x2, 0x79, 0x85, 0x0, 0x0, 0x7f, 0xfe, 0xef, 0xc1, 0x6, 0xfb, 0x20, 0x6, 0xe5, 0xd,
+    0xe1, 0x0, 0x0, 0x10, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xb0,
+    0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x1, 0x82, 0x1, 0xdf, 0xa7, 0x8d, 0xf5, 0x0, 0x19, 0xdf,
+    0xeb, 0x40,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x5, 0x30, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xa0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x3, 0x79, 0x83, 0x1f, 0xa0, 0x9, 0xff, 0xef, 0xf9,
+    0xfa, 0x7, 0xfb, 0x20, 0x6, 0xff, 0xa0, 0xee, 0x10, 0x0, 0x8, 0xfa, 0x2f, 0x90, 0x0, 0x0,
+    0x2f, 0xa3, 0xf8, 0x0, 0x0, 0x2, 0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x5f, 0xa0, 0xbf, 0x50, 0x0,
+    0x1c, 0xfa, 0x2, 0xef, 0xa7, 0x8d, 0xdf, 0xa0, 0x2, 0x9d, 0xfe, 0xa2, 0xfa,
+
+    /* U+0065 "e" */
+    0x0, 0x3, 0x79, 0x83, 0x0, 0x0, 0x8, 0xff, 0xdf, 0xf9, 0x0, 0x7, 0xf9, 0x10, 0x18, 0xf7,
+    0x0, 0xec, 0x0, 0x0, 0xb, 0xe0, 0x2f, 0xb7, 0x77, 0x77, 0xbf, 0x33, 0xfe, 0xcc, 0xcc, 0xcc,
+    0xc3, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x5, 0x0, 0x2, 0xdf, 0xb7, 0x7b,
+    0xf6, 0x0, 0x1, 0x9d, 0xee, 0xc7, 0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x2, 0x66, 0x20, 0x5, 0xff, 0xfc, 0x0, 0xed, 0x21, 0x20, 0x1f, 0x90, 0x0, 0x69, 0xfc,
+    0x88, 0x3a, 0xdf, 0xed, 0xd5, 0x2, 0xf9, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x2, 0xf9, 0x0, 0x0,
+    0x2f, 0x90, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x2f, 0x90,
+    0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x3, 0x79, 0x84, 0x7, 0x60, 0x9, 0xff, 0xee, 0xfa, 0xdb, 0x8, 0xfb, 0x20, 0x5, 0xef,
+    0xb1, 0xed, 0x0, 0x0, 0x5, 0xfb, 0x3f, 0x80, 0x0, 0x0, 0xf, 0xb3, 0xf9, 0x0, 0x0, 0x0,
+    0xfb, 0x1e, 0xd1, 0x0, 0x0, 0x5f, 0xb0, 0x7f, 0xb2, 0x0, 0x5e, 0xfb, 0x0, 0x9f, 0xfe, 0xff,
+    0x9f, 0xb0, 0x0, 0x27, 0x98, 0x30, 0xfa, 0x0, 0x10, 0x0, 0x0, 0x5f, 0x80, 0x6e, 0x73, 0x11,
+    0x6e, 0xe2, 0x4, 0xcf, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x36, 0x76, 0x40, 0x0,
+
+    /* U+0068 "h" */
+    0x25, 0x20, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x5f,
+    0x50, 0x0, 0x0, 0x0, 0x5f, 0x52, 0x79, 0x84, 0x0, 0x5f, 0xae, 0xfe, 0xff, 0x90, 0x5f, 0xf8,
+    0x10, 0x2c, 0xf4, 0x5f, 0xb0, 0x0, 0x4, 0xf9, 0x5f, 0x60, 0x0, 0x1, 0xfa, 0x5f, 0x50, 0x0,
+    0x1, 0xfa, 0x5f, 0x50, 0x0, 0x1, 0xfa, 0x5f, 0x50, 0x0, 0x1, 0xfa, 0x5f, 0x50, 0x0, 0x1,
+    0xfa, 0x5f, 0x50, 0x0, 0x1, 0xfa,
+
+    /* U+0069 "i" */
+    0x29, 0x39, 0xf9, 0x39, 0x20, 0x0, 0x38, 0x35, 0xf5, 0x5f, 0x55, 0xf5, 0x5f, 0x55, 0xf5, 0x5f,
+    0x55, 0xf5, 0x5f, 0x55, 0xf5,
+
+    /* U+006A "j" */
+    0x0, 0x2, 0x93, 0x0, 0x8, 0xfb, 0x0, 0x2, 0x93, 0x0, 0x0, 0x0, 0x0, 0x2, 0x84, 0x0,
+    0x4, 0xf7, 0x0, 0x4, 0xf7, 0x0, 0x4, 0xf7, 0x0, 0x4, 0xf7, 0x0, 0x4, 0xf7, 0x0, 0x4,
+    0xf7, 0x0, 0x4, 0xf7, 0x0, 0x4, 0xf7, 0x0, 0x4, 0xf7, 0x0, 0x4, 0xf7, 0x12, 0xa, 0xf4,
+    0x7f, 0xff, 0xb0, 0x16, 0x75, 0x0,
+
+    /* U+006B "k" */
+    0x25, 0x20, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x5f,
+    0x50, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x6, 0x83, 0x5f, 0x50, 0x0, 0x8f, 0x90, 0x5f, 0x50,
+    0xa, 0xf9, 0x0, 0x5f, 0x51, 0xbf, 0x80, 0x0, 0x5f, 0x7c, 0xfd, 0x0, 0x0, 0x5f, 0xff, 0xcf,
+    0x80, 0x0, 0x5f, 0xf5, 0x1d, 0xf5, 0x0, 0x5f, 0x70, 0x2, 0xee, 0x20, 0x5f, 0x50, 0x0, 0x4f,
+    0xc1, 0x5f, 0x50, 0x0, 0x7, 0xfa,
+
+    /* U+006C "l" */
+    0x25, 0x25, 0xf5, 0x5f, 0x55, 0xf5, 0x5f, 0x55, 0xf5, 0x5f, 0x55, 0xf5, 0x5f, 0x55, 0xf5, 0x5f,
+    0x55, 0xf5, 0x5f, 0x55, 0xf5,
+
+    /* U+006D "m" */
+    0x38, 0x22, 0x79, 0x83, 0x0, 0x37, 0x98, 0x30, 0x5, 0xfa, 0xff, 0xef, 0xf6, 0x8f, 0xfe, 0xff,
+    0x70, 0x5f, 0xf8, 0x10, 0x4e, 0xff, 0x81, 0x4, 0xef, 0x25, 0xfa, 0x0, 0x0, 0x8f, 0xb0, 0x0,
+    0x7, 0xf6, 0x5f, 0x60, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x4f, 0x75, 0xf5, 0x0, 0x0, 0x5f, 0x60,
+    0x0, 0x4, 0xf7, 0x5f, 0x50, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x4f, 0x75, 0xf5, 0x0, 0x0, 0x5f,
+    0x60, 0x0, 0x4, 0xf7, 0x5f, 0x50, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x4f, 0x75, 0xf5, 0x0, 0x0,
+    0x5f, 0x60, 0x0, 0x4, 0xf7,
+
+    /* U+006E "n" */
+    0x38, 0x22, 0x79, 0x84, 0x0, 0x5f, 0x9f, 0xfe, 0xff, 0x90, 0x5f, 0xf8, 0x10, 0x2c, 0xf4, 0x5f,
+    0xb0, 0x0, 0x4, 0xf9, 0x5f, 0x60, 0x0, 0x1, 0xfa, 0x5f, 0x50, 0x0, 0x1, 0xfa, 0x5f, 0x50,
+    0x0, 0x1, 0xfa, 0x5f, 0x50, 0x0, 0x1, 0xfa, 0x5f, 0x50, 0x0, 0x1, 0xfa, 0x5f, 0x50, 0x0,
+    0x1, 0xfa,
+
+    /* U+006F "o" */
+    0x0, 0x2, 0x79, 0x85, 0x0, 0x0, 0x8, 0xff, 0xef, 0xfc, 0x20, 0x6, 0xfb, 0x20, 0x6, 0xfc,
+    0x0, 0xee, 0x10, 0x0, 0x8, 0xf5, 0x2f, 0x90, 0x0, 0x0, 0x2f, 0x93, 0xf8, 0x0, 0x0, 0x2,
+    0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x5f, 0x70, 0xaf, 0x50, 0x0, 0x1c, 0xf2, 0x2, 0xdf, 0xa7, 0x8d,
+    0xf6, 0x0, 0x1, 0x9d, 0xfe, 0xb4, 0x0,
+
+    /* U+0070 "p" */
+    0x38, 0x22, 0x79, 0x84, 0x0, 0x5, 0xf9, 0xef, 0xef, 0xfb, 0x10, 0x5f, 0xfa, 0x10, 0x18, 0xfb,
+    0x5, 0xfc, 0x0, 0x0, 0xa, 0xf3, 0x5f, 0x70, 0x0, 0x0, 0x5f, 0x75, 0xf6, 0x0, 0x0, 0x4,
+    0xf7, 0x5f, 0x90, 0x0, 0x0, 0x7f, 0x55, 0xfe, 0x30, 0x0, 0x2e, 0xe1, 0x5f, 0xee, 0x97, 0x9e,
+    0xf5, 0x5, 0xf6, 0x8d, 0xfe, 0xb4, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x2, 0x62, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0071 "q" */
+    0x0, 0x3, 0x79, 0x83, 0x8, 0x50, 0x9, 0xff, 0xef, 0xf8, 0xfa, 0x7, 0xfb, 0x20, 0x7, 0xff,
+    0xa0, 0xee, 0x10, 0x0, 0x8, 0xfa, 0x2f, 0x90, 0x0, 0x0, 0x3f, 0xa3, 0xf8, 0x0, 0x0, 0x2,
+    0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x5f, 0xa0, 0xbf, 0x50, 0x0, 0x1c, 0xfa, 0x2, 0xef, 0xa7, 0x8d,
+    0xef, 0xa0, 0x2, 0x9d, 0xfe, 0xa3, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0,
+    0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x1, 0x64,
+
+    /* U+0072 "r" */
+    0x38, 0x22, 0x77, 0x5f, 0x9e, 0xfc, 0x5f, 0xf9, 0x20, 0x5f, 0xb0, 0x0, 0x5f, 0x70, 0x0, 0x5f,
+    0x60, 0x0, 0x5f, 0x50, 0x0, 0x5f, 0x50, 0x0, 0x5f, 0x50, 0x0, 0x5f, 0x50, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x38, 0x98, 0x62, 0x0, 0x8f, 0xfd, 0xef, 0xe1, 0x2f, 0xb1, 0x0, 0x35, 0x3, 0xf9, 0x0,
+    0x0, 0x0, 0xd, 0xfb, 0x85, 0x10, 0x0, 0x18, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x14, 0xbf, 0x50,
+    0x20, 0x0, 0x5, 0xf7, 0x5f, 0xb7, 0x68, 0xdf, 0x21, 0x8c, 0xef, 0xeb, 0x30,
+
+    /* U+0074 "t" */
+    0x1, 0x96, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x69, 0xfc, 0x88, 0x3a, 0xdf, 0xed, 0xd5, 0x2, 0xf9,
+    0x0, 0x0, 0x2f, 0x90, 0x0, 0x2, 0xf9, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x2, 0xf9, 0x0, 0x0,
+    0x1f, 0xa0, 0x0, 0x0, 0xcf, 0x86, 0x70, 0x3, 0xbe, 0xfa,
+
+    /* U+0075 "u" */
+    0x48, 0x20, 0x0, 0x2, 0x84, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f,
+    0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x6f, 0x60,
+    0x0, 0x5, 0xf8, 0x3f, 0xb0, 0x0, 0x1c, 0xf8, 0xb, 0xfc, 0x78, 0xde, 0xf8, 0x1, 0x8d, 0xfe,
+    0xa3, 0xf8,
+
+    /* U+0076 "v" */
+    0x77, 0x0, 0x0, 0x0, 0x68, 0x9f, 0x30, 0x0, 0x1, 0xf9, 0x2f, 0xa0, 0x0, 0x8, 0xf3, 0xb,
+    0xf1, 0x0, 0xe, 0xb0, 0x4, 0xf7, 0x0, 0x6f, 0x50, 0x0, 0xce, 0x0, 0xcd, 0x0, 0x0, 0x6f,
+    0x54, 0xf7, 0x0, 0x0, 0x1e, 0xca, 0xe1, 0x0, 0x0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x2, 0xff,
+    0x20, 0x0,
+
+    /* U+0077 "w" */
+    0x67, 0x0, 0x0, 0x6, 0x80, 0x0, 0x0, 0x58, 0x8f, 0x20, 0x0, 0x1e, 0xf4, 0x0, 0x0, 0xda,
+    0x2f, 0x70, 0x0, 0x6f, 0xf9, 0x0, 0x4, 0xf5, 0xb, 0xd0, 0x0, 0xbc, 0x9e, 0x10, 0x9, 0xe0,
+    0x6, 0xf3, 0x2, 0xf6, 0x4f, 0x50, 0x1e, 0x80, 0x1, 0xe9, 0x8, 0xf1, 0xd, 0xb0, 0x5f, 0x30,
+    0x0, 0xae, 0xd, 0xa0, 0x7, 0xf2, 0xbc, 0x0, 0x0, 0x4f, 0x9f, 0x40, 0x2, 0xf9, 0xf7, 0x0,
+    0x0, 0xd, 0xfd, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0x5f, 0xa0, 0x0,
+
+    /* U+0078 "x" */
+    0x38, 0x50, 0x0, 0x5, 0x82, 0xb, 0xe3, 0x0, 0x3f, 0xa0, 0x1, 0xed, 0x11, 0xdd, 0x10, 0x0,
+    0x4f, 0xab, 0xe3, 0x0, 0x0, 0x7, 0xff, 0x50, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0, 0x2e,
+    0xcd, 0xd1, 0x0, 0x0, 0xce, 0x23, 0xfb, 0x0, 0x9, 0xf5, 0x0, 0x6f, 0x80, 0x5f, 0x80, 0x0,
+    0xa, 0xf5,
+
+    /* U+0079 "y" */
+    0x7, 0x70, 0x0, 0x0, 0x6, 0x80, 0x9f, 0x30, 0x0, 0x1, 0xf9, 0x2, 0xfa, 0x0, 0x0, 0x7f,
+    0x30, 0xa, 0xf2, 0x0, 0xe, 0xb0, 0x0, 0x4f, 0x80, 0x5, 0xf4, 0x0, 0x0, 0xce, 0x10, 0xcc,
+    0x0, 0x0, 0x5, 0xf6, 0x3f, 0x60, 0x0, 0x0, 0xd, 0xca, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xf7,
+    0x0, 0x0, 0x0, 0x1, 0xef, 0x10, 0x0, 0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x71, 0x1b, 0xf2,
+    0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x36, 0x62, 0x0, 0x0, 0x0,
+
+    /* U+007A "z" */
+    0x18, 0x88, 0x88, 0x88, 0x52, 0xdd, 0xdd, 0xde, 0xf8, 0x0, 0x0, 0x3, 0xec, 0x10, 0x0, 0x1,
+    0xde, 0x20, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x0, 0x8f, 0x60, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0,
+    0x3e, 0xc0, 0x0, 0x0, 0x1d, 0xf8, 0x66, 0x66, 0x54, 0xff, 0xff, 0xff, 0xfb,
+
+    /* U+007B "{" */
+    0x0, 0x4, 0x50, 0x1d, 0xff, 0x6, 0xf9, 0x10, 0x8f, 0x30, 0x8, 0xf3, 0x0, 0x8f, 0x30, 0x8,
+    0xf3, 0x0, 0x8f, 0x30, 0xae, 0xd0, 0xc, 0xfb, 0x0, 0x9, 0xf3, 0x0, 0x8f, 0x30, 0x8, 0xf3,
+    0x0, 0x8f, 0x30, 0x8, 0xf3, 0x0, 0x6f, 0x81, 0x1, 0xdf, 0xf0, 0x1, 0x46,
+
+    /* U+007C "|" */
+    0x15, 0x32, 0xf7, 0x2f, 0x72, 0xf7, 0x2f, 0x72, 0xf7, 0x2f, 0x72, 0xf7, 0x2f, 0x72, 0xf7, 0x2f,
+    0x72, 0xf7, 0x2f, 0x72, 0xf7, 0x2f, 0x72, 0xf7, 0x2f, 0x71, 0x63,
+
+    /* U+007D "}" */
+    0x45, 0x10, 0x0, 0xaf, 0xe4, 0x0, 0x15, 0xfb, 0x0, 0x0, 0xdd, 0x0, 0x0, 0xdd, 0x0, 0x0,
+    0xdd, 0x0, 0x0, 0xdd, 0x0, 0x0, 0xdd, 0x0, 0x0, 0x9f, 0xb3, 0x0, 0x7f, 0xd3, 0x0, 0xde,
+    0x0, 0x0, 0xdd, 0x0, 0x0, 0xdd, 0x0, 0x0, 0xdd, 0x0, 0x0, 0xdd, 0x0, 0x4, 0xfb, 0x0,
+    0xaf, 0xf4, 0x0, 0x45, 0x20, 0x0,
+
+    /* U+007E "~" */
+    0x19, 0xc9, 0x10, 0x8, 0x49, 0xd8, 0xdd, 0x44, 0xf3, 0xd5, 0x1, 0xaf, 0xfa, 0x1, 0x0, 0x0,
+    0x22, 0x0,
+
+    /* U+00A0 "" */
+
+    /* U+00A1 "¡" */
+    0x39, 0x2b, 0xf8, 0x49, 0x20, 0x0, 0x28, 0x15, 0xf2, 0x5f, 0x36, 0xf3, 0x6f, 0x47, 0xf5, 0x8f,
+    0x58, 0xf6, 0x6a, 0x40,
+
+    /* U+00A2 "¢" */
+    0x0, 0x0, 0xa, 0x20, 0x0, 0x0, 0x0, 0xe, 0x30, 0x0, 0x0, 0x2, 0x7f, 0xa5, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xc1, 0x6, 0xfc, 0x2e, 0x46, 0xf5, 0xe, 0xe1, 0xe, 0x30, 0x10, 0x2f, 0x90,
+    0xe, 0x30, 0x0, 0x3f, 0x80, 0xe, 0x30, 0x0, 0x1f, 0xb0, 0xe, 0x30, 0x0, 0xa, 0xf5, 0xe,
+    0x31, 0x92, 0x2, 0xdf, 0xae, 0xad, 0xf5, 0x0, 0x19, 0xdf, 0xec, 0x40, 0x0, 0x0, 0xe, 0x30,
+    0x0, 0x0, 0x0, 0xe, 0x30, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+
+    /* U+00A3 "£" */
+    0x0, 0x0, 0x5, 0x9b, 0xb9, 0x40, 0x0, 0x2, 0xdf, 0xfd, 0xef, 0xf3, 0x0, 0xd, 0xf6, 0x10,
+    0x2, 0x60, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0x40, 0x0, 0x0, 0x0, 0x6d, 0xef, 0xed, 0xdd, 0xd1, 0x0, 0x24, 0xaf, 0x74, 0x44, 0x40, 0x0,
+    0x0, 0x7f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x40, 0x0,
+    0x0, 0x0, 0x48, 0xcf, 0xa8, 0x88, 0x88, 0x81, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf1,
+
+    /* U+00A4 "¤" */
+    0x3, 0x0, 0x0, 0x0, 0x0, 0x12, 0x3f, 0x80, 0x26, 0x75, 0x11, 0xdc, 0x8, 0xfc, 0xff, 0xef,
+    0xed, 0xe3, 0x0, 0xcf, 0x71, 0x2, 0xaf, 0x60, 0x3, 0xf6, 0x0, 0x0, 0xb, 0xc0, 0x7, 0xe0,
+    0x0, 0x0, 0x5, 0xf2, 0x8, 0xd0, 0x0, 0x0, 0x3, 0xf2, 0x6, 0xf2, 0x0, 0x0, 0x7, 0xe1,
+    0x1, 0xdb, 0x10, 0x0, 0x3e, 0x90, 0x2, 0xdf, 0xd8, 0x7a, 0xff, 0x90, 0x2d, 0xe5, 0x9d, 0xec,
+    0x78, 0xf8, 0x1b, 0x20, 0x0, 0x0, 0x0, 0x78,
+
+    /* U+00A5 "¥" */
+    0x89, 0x10, 0x0, 0x0, 0x0, 0x29, 0x54, 0xf9, 0x0, 0x0, 0x0, 0xc, 0xe1, 0x9, 0xf5, 0x0,
+    0x0, 0x8, 0xf5, 0x0, 0xc, 0xe2, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x3e, 0xb0, 0x1, 0xdd, 0x10,
+    0x0, 0x0, 0x6f, 0x70, 0xaf, 0x30, 0x0, 0x0, 0x0, 0xaf, 0x9f, 0x70, 0x0, 0x0, 0x39, 0x9a,
+    0xff, 0xf9, 0x99, 0x0, 0x2, 0x66, 0x6b, 0xf8, 0x66, 0x60, 0x0, 0x12, 0x22, 0x9f, 0x52, 0x22,
+    0x0, 0x4, 0xdd, 0xde, 0xfe, 0xdd, 0xd1, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xf4, 0x0, 0x0, 0x0,
+
+    /* U+00A6 "¦" */
+    0x15, 0x32, 0xf7, 0x2f, 0x72, 0xf7, 0x2f, 0x72, 0xf7, 0x2e, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xc6, 0x2f, 0x72, 0xf7, 0x2f, 0x72, 0xf7, 0x2f, 0x71, 0x63,
+
+    /* U+00A7 "§" */
+    0x0, 0x27, 0xaa, 0x84, 0x0, 0x4f, 0xeb, 0xbd, 0xf5, 0xc, 0xc1, 0x0, 0x4, 0x0, 0xea, 0x0,
+    0x0, 0x0, 0x9, 0xfa, 0x51, 0x0, 0x0, 0x7f, 0xef, 0xfb, 0x30, 0x2f, 0x80, 0x16, 0xde, 0x15,
+    0xf3, 0x0, 0x3, 0xf5, 0x2f, 0xb3, 0x0, 0x6f, 0x30, 0x5d, 0xfd, 0xbf, 0x90, 0x0, 0x3, 0x7d,
+    0xf7, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x14, 0x0, 0x0, 0xbe, 0x5, 0xfd, 0xa9, 0xcf, 0x60, 0x4,
+    0x9b, 0xc9, 0x40, 0x0,
+
+    /* U+00A8 "¨" */
+    0x1, 0x0, 0x0, 0x1e, 0x80, 0xbd, 0x1a, 0x50, 0x79,
+
+    /* U+00A9 "©" */
+    0x0, 0x0, 0x16, 0x89, 0x73, 0x0, 0x0, 0x0, 0x6, 0xc7, 0x43, 0x5a, 0xb2, 0x0, 0x0, 0x89,
+    0x0, 0x0, 0x0, 0x4c, 0x20, 0x4, 0xb0, 0x18, 0xdf, 0xc5, 0x4, 0xb0, 0xb, 0x30, 0xae, 0x64,
+    0x8e, 0x10, 0xb3, 0xd, 0x3, 0xf4, 0x0, 0x1, 0x0, 0x66, 0x1b, 0x5, 0xf0, 0x0, 0x0, 0x0,
+    0x58, 0x1c, 0x4, 0xf2, 0x0, 0x0, 0x0, 0x67, 0xc, 0x11, 0xeb, 0x10, 0x28, 0x10, 0x94, 0x7,
+    0x70, 0x3d, 0xed, 0xfb, 0x11, 0xc0, 0x1, 0xc4, 0x0, 0x46, 0x30, 0x1b, 0x40, 0x0, 0x2c, 0x71,
+    0x0, 0x4, 0xc6, 0x0, 0x0, 0x0, 0x6b, 0xbb, 0xc8, 0x20, 0x0,
+
+    /* U+00AA "ª" */
+    0x1, 0x56, 0x40, 0x0, 0xda, 0x8d, 0xa0, 0x0, 0x0, 0x3f, 0x10, 0x9c, 0xcc, 0xf2, 0x4e, 0x0,
+    0x3f, 0x22, 0xea, 0x8c, 0xf2, 0x1, 0x55, 0x14, 0x0,
+
+    /* U+00AB "«" */
+    0x0, 0x2, 0x30, 0x13, 0x10, 0x2, 0xe7, 0xa, 0xd1, 0x1, 0xcb, 0x6, 0xf3, 0x0, 0x9e, 0x13,
+    0xf7, 0x0, 0x1d, 0xb0, 0x7f, 0x30, 0x0, 0x3f, 0x60, 0xbc, 0x10, 0x0, 0x7e, 0x31, 0xe9, 0x0,
+    0x0, 0x88, 0x4, 0xa2,
+
+    /* U+00AC "¬" */
+    0xcf, 0xff, 0xff, 0xff, 0x45, 0x66, 0x66, 0x68, 0xf4, 0x0, 0x0, 0x0, 0x4f, 0x40, 0x0, 0x0,
+    0x4, 0xf4, 0x0, 0x0, 0x0, 0x29, 0x20,
+
+    /* U+00AD "" */
+    0xaa, 0xaa, 0x9c, 0xcc, 0xca,
+
+    /* U+00AE "®" */
+    0x0, 0x0, 0x16, 0x89, 0x73, 0x0, 0x0, 0x0, 0x6, 0xc7, 0x43, 0x5a, 0xb2, 0x0, 0x0, 0x89,
+    0x0, 0x0, 0x0, 0x4c, 0x20, 0x4, 0xb0, 0x5d, 0xdd, 0xb5, 0x4, 0xb0, 0xb, 0x30, 0x5d, 0x22,
+    0x6e, 0x30, 0xb3, 0xd, 0x0, 0x5d, 0x0, 0xc, 0x60, 0x66, 0x1b, 0x0, 0x5d, 0x0, 0x4e, 0x40,
+    0x58, 0x1c, 0x0, 0x5f, 0xff, 0xf7, 0x0, 0x67, 0xc, 0x10, 0x5d, 0x0, 0xc6, 0x0, 0x94, 0x7,
+    0x70, 0x5d, 0x0, 0x3e, 0x21, 0xc0, 0x1, 0xc4, 0x24, 0x0, 0x3, 0x3b, 0x40, 0x0, 0x2c, 0x71,
+    0x0, 0x4, 0xc6, 0x0, 0x0, 0x0, 0x6b, 0xbb, 0xc8, 0x20, 0x0,
+
+    /* U+00AF "¯" */
+    0x5a, 0xaa, 0xaa, 0x34, 0x77, 0x77, 0x72,
+
+    /* U+00B0 "°" */
+    0x0, 0x6a, 0x92, 0x0, 0x9b, 0x57, 0xe3, 0x1e, 0x10, 0x7, 0x92, 0xd0, 0x0, 0x5a, 0xd, 0x50,
+    0x1c, 0x60, 0x3c, 0xde, 0x80, 0x0, 0x2, 0x10, 0x0,
+
+    /* U+00B1 "±" */
+    0x0, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0xb, 0xdd, 0xef,
+    0xdd, 0xd4, 0x68, 0x8c, 0xf8, 0x88, 0x20, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0,
+    0x0, 0x5a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x66, 0x66, 0x66, 0x62, 0xcf, 0xff, 0xff,
+    0xff, 0x40,
+
+    /* U+00B2 "²" */
+    0x1, 0x56, 0x51, 0x3, 0xec, 0xad, 0xd2, 0x3, 0x0, 0xd, 0x70, 0x0, 0x2, 0xe4, 0x0, 0x2,
+    0xd9, 0x0, 0x3, 0xe8, 0x0, 0x4, 0xe6, 0x0, 0x2, 0xff, 0xee, 0xec, 0x2, 0x22, 0x22, 0x10,
+
+    /* U+00B3 "³" */
+    0x15, 0x55, 0x55, 0x33, 0xaa, 0xac, 0xf5, 0x0, 0x1, 0xc8, 0x0, 0x1, 0xcb, 0x10, 0x0, 0x2a,
+    0xce, 0x40, 0x0, 0x0, 0x8c, 0x26, 0x10, 0x1a, 0xb3, 0xdf, 0xef, 0xc2, 0x0, 0x13, 0x10, 0x0,
+
+    /* U+00B4 "´" */
+    0x0, 0x34, 0x20, 0x5f, 0xa1, 0x5e, 0x60, 0x1, 0x10, 0x0,
+
+    /* U+00B5 "µ" */
+    0x38, 0x30, 0x0, 0x1, 0x85, 0x5f, 0x50, 0x0, 0x2, 0xf9, 0x5f, 0x50, 0x0, 0x2, 0xf9, 0x5f,
+    0x50, 0x0, 0x2, 0xf9, 0x5f, 0x50, 0x0, 0x2, 0xf9, 0x5f, 0x60, 0x0, 0x2, 0xf9, 0x5f, 0x70,
+    0x0, 0x4, 0xf9, 0x5f, 0xc0, 0x0, 0xb, 0xf9, 0x5f, 0xfc, 0x88, 0xce, 0xf9, 0x5f, 0x8b, 0xee,
+    0xb3, 0xf9, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0,
+    0x0, 0x26, 0x20, 0x0, 0x0, 0x0,
+
+    /* U+00B6 "¶" */
+    0x0, 0x14, 0x55, 0x55, 0x54, 0x7, 0xff, 0xff, 0xff, 0xfc, 0x5f, 0xff, 0xf8, 0x0, 0xac, 0x9f,
+    0xff, 0xf8, 0x0, 0xac, 0x9f, 0xff, 0xf8, 0x0, 0xac, 0x3f, 0xff, 0xf8, 0x0, 0xac, 0x4, 0xcf,
+    0xf8, 0x0, 0xac, 0x0, 0x0, 0xe8, 0x0, 0xac, 0x0, 0x0, 0xe8, 0x0, 0xac, 0x0, 0x0, 0xe8,
+    0x0, 0xac, 0x0, 0x0, 0xe8, 0x0, 0xac, 0x0, 0x0, 0xe8, 0x0, 0xac, 0x0, 0x0, 0xe8, 0x0,
+    0xac, 0x0, 0x0, 0xe8, 0x0, 0xac, 0x0, 0x0, 0xe8, 0x0, 0xac, 0x0, 0x0, 0x95, 0x0, 0x78,
+
+    /* U+00B7 "·" */
+    0x2, 0x9, 0xf6, 0xaf, 0x71, 0x40,
+
+    /* U+00B8 "¸" */
+    0x0, 0x20, 0x0, 0x4c, 0x0, 0x4, 0xad, 0x12, 0x24, 0xf2, 0x6d, 0xd7, 0x0,
+
+    /* U+00B9 "¹" */
+    0x25, 0x54, 0x0, 0x4a, 0xcc, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x7c, 0x0, 0x0,
+    0x7c, 0x0, 0x0, 0x7c, 0x0, 0x8e, 0xef, 0xe9, 0x12, 0x22, 0x21,
+
+    /* U+00BA "º" */
+    0x0, 0x36, 0x51, 0x0, 0x9e, 0x9b, 0xe3, 0x4e, 0x20, 0x8, 0xb6, 0xc0, 0x0, 0x5e, 0x3f, 0x30,
+    0x9, 0xb0, 0x8e, 0xbd, 0xd2, 0x0, 0x25, 0x40, 0x0,
+
+    /* U+00BB "»" */
+    0x13, 0x10, 0x32, 0x0, 0x1, 0xcb, 0x6, 0xf3, 0x0, 0x2, 0xe7, 0xa, 0xd1, 0x0, 0x6, 0xf4,
+    0x1d, 0xa0, 0x0, 0x2f, 0x80, 0x9e, 0x10, 0xc, 0xc0, 0x5f, 0x40, 0x8, 0xe2, 0x2e, 0x80, 0x2,
+    0xa4, 0x7, 0x90, 0x0,
+
+    /* U+00BC "¼" */
+    0x49, 0x97, 0x0, 0x0, 0x0, 0x3, 0x91, 0x0, 0x0, 0x37, 0xac, 0x0, 0x0, 0x0, 0xc, 0x80,
+    0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x8c, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x3,
+    0xe3, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x1d, 0x70, 0x0, 0x0, 0x0, 0x0, 0x7c, 0x0,
+    0x0, 0x8c, 0x0, 0x2, 0x71, 0x0, 0x13, 0x8d, 0x32, 0x4, 0xe2, 0x0, 0xc, 0x80, 0x0, 0x7d,
+    0xdd, 0xd9, 0x1d, 0x70, 0x0, 0x9c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9b, 0x0, 0x5, 0xe2, 0x23,
+    0x0, 0x0, 0x0, 0x4, 0xe2, 0x0, 0x2e, 0x50, 0x7a, 0x0, 0x0, 0x0, 0x1e, 0x60, 0x0, 0xaf,
+    0xcc, 0xee, 0xc2, 0x0, 0x0, 0xab, 0x0, 0x0, 0x23, 0x33, 0xab, 0x30, 0x0, 0x5, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x9a, 0x0,
+
+    /* U+00BD "½" */
+    0x49, 0x97, 0x0, 0x0, 0x0, 0x3, 0x91, 0x0, 0x3, 0x7a, 0xc0, 0x0, 0x0, 0x0, 0xc8, 0x0,
+    0x0, 0x0, 0x7c, 0x0, 0x0, 0x0, 0x8c, 0x0, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x0, 0x3e, 0x30,
+    0x0, 0x0, 0x0, 0x7c, 0x0, 0x0, 0x1d, 0x70, 0x0, 0x0, 0x0, 0x7, 0xc0, 0x0, 0x8, 0xc0,
+    0x37, 0x86, 0x10, 0x13, 0x8d, 0x32, 0x4, 0xe2, 0x5e, 0xa8, 0xcd, 0x17, 0xdd, 0xdd, 0x91, 0xd7,
+    0x0, 0x20, 0x0, 0xe5, 0x0, 0x0, 0x0, 0x9b, 0x0, 0x0, 0x0, 0x4f, 0x20, 0x0, 0x0, 0x4e,
+    0x20, 0x0, 0x0, 0x4e, 0x50, 0x0, 0x0, 0x1e, 0x60, 0x0, 0x0, 0x6e, 0x50, 0x0, 0x0, 0xa,
+    0xb0, 0x0, 0x0, 0x8e, 0x41, 0x10, 0x0, 0x5, 0xe2, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xb0,
+
+    /* U+00BE "¾" */
+    0x39, 0x99, 0x99, 0x40, 0x0, 0x0, 0x39, 0x10, 0x0, 0x2, 0x77, 0x7a, 0xf4, 0x0, 0x0, 0xc,
+    0x80, 0x0, 0x0, 0x0, 0x3, 0xe5, 0x0, 0x0, 0x8, 0xc0, 0x0, 0x0, 0x0, 0x1, 0xeb, 0x30,
+    0x0, 0x3, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x17, 0x8e, 0x70, 0x1, 0xd7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7c, 0x0, 0x8c, 0x0, 0x2, 0x71, 0x0, 0x39, 0x42, 0x4c, 0x90, 0x4e, 0x20, 0x0,
+    0xc8, 0x0, 0x2, 0x9d, 0xed, 0x81, 0x1d, 0x70, 0x0, 0x9c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xb0, 0x0, 0x5e, 0x22, 0x30, 0x0, 0x0, 0x0, 0x4, 0xe2, 0x0, 0x2e, 0x50, 0x7a, 0x0, 0x0,
+    0x0, 0x1, 0xe6, 0x0, 0xa, 0xfc, 0xce, 0xec, 0x20, 0x0, 0x0, 0xab, 0x0, 0x0, 0x23, 0x33,
+    0xab, 0x30, 0x0, 0x0, 0x5e, 0x20, 0x0, 0x0, 0x0, 0x9, 0xa0, 0x0,
+
+    /* U+00BF "¿" */
+    0x0, 0x4, 0x81, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0, 0x5, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0x82, 0x0, 0x0, 0x1, 0xde, 0x10, 0x0, 0x1, 0xbf, 0x60, 0x0, 0x0,
+    0xbf, 0x60, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0xb, 0xf1, 0x0, 0x0, 0x0, 0x9f, 0x80, 0x0,
+    0x2b, 0x92, 0xef, 0xdb, 0xcf, 0xf6, 0x1, 0x7b, 0xcb, 0x82, 0x0,
+
+    /* U+00C0 "À" */
+    0x0, 0x3, 0xdd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x54, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x1d, 0xd0, 0x0,
+    0x0, 0x0, 0x3, 0xf9, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x1, 0xec, 0x0, 0x0, 0x0,
+    0x1f, 0xa0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x2f, 0xa0, 0x0, 0x1, 0xef, 0x99,
+    0x99, 0x9e, 0xf2, 0x0, 0x6, 0xfd, 0xdd, 0xdd, 0xdd, 0xf9, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
+    0xcf, 0x10, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x5f, 0x80, 0xcf, 0x10, 0x0, 0x0, 0x0, 0xd, 0xe1,
+
+    /* U+00C1 "Á" */
+    0x0, 0x0, 0x0, 0x1b, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcc, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x1d, 0xd0, 0x0,
+    0x0, 0x0, 0x3, 0xf9, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x1, 0xec, 0x0, 0x0, 0x0,
+    0x1f, 0xa0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x2f, 0xa0, 0x0, 0x1, 0xef, 0x99,
+    0x99, 0x9e, 0xf2, 0x0, 0x6, 0xfd, 0xdd, 0xdd, 0xdd, 0xf9, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
+    0xcf, 0x10, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x5f, 0x80, 0xcf, 0x10, 0x0, 0x0, 0x0, 0xd, 0xe1,
+
+    /* U+00C2 "Â" */
+    0x0, 0x0, 0xa, 0xec, 0x10, 0x0, 0x0, 0x0, 0x0, 0xbd, 0x3b, 0xc1, 0x0, 0x0, 0x0, 0x2,
+    0x61, 0x0, 0x53, 0x0, 0x0, 0x0, 0x0, 0x4, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x1d, 0xd0, 0x0,
+    0x0, 0x0, 0x3, 0xf9, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x1, 0xec, 0x0, 0x0, 0x0,
+    0x1f, 0xa0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x2f, 0xa0, 0x0, 0x1, 0xef, 0x99,
+    0x99, 0x9e, 0xf2, 0x0, 0x6, 0xfd, 0xdd, 0xdd, 0xdd, 0xf9, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
+    0xcf, 0x10, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x5f, 0x80, 0xcf, 0x10, 0x0, 0x0, 0x0, 0xd, 0xe1,
+
+    /* U+00C3 "Ã" */
+    0x0, 0x0, 0xad, 0x70, 0x67, 0x0, 0x0, 0x0, 0x4, 0xc3, 0xbd, 0xe3, 0x0, 0x0, 0x0, 0x1,
+    0x20, 0x3, 0x20, 0x0, 0x0, 0x0, 0x0, 0x4, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x1d, 0xd0, 0x0,
+    0x0, 0x0, 0x3, 0xf9, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x1, 0xec, 0x0, 0x0, 0x0,
+    0x1f, 0xa0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x2f, 0xa0, 0x0, 0x1, 0xef, 0x99,
+    0x99, 0x9e, 0xf2, 0x0, 0x6, 0xfd, 0xdd, 0xdd, 0xdd, 0xf9, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
+    0xcf, 0x10, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x5f, 0x80, 0xcf, 0x10, 0x0, 0x0, 0x0, 0xd, 0xe1,
+
+    /* U+00C4 "Ä" */
+    0x0, 0x0, 0x97, 0x5, 0xa1, 0x0, 0x0, 0x0, 0x0, 0xda, 0x8, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x1d, 0xd0, 0x0,
+    0x0, 0x0, 0x3, 0xf9, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x1, 0xec, 0x0, 0x0, 0x0,
+    0x1f, 0xa0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x2f, 0xa0, 0x0, 0x1, 0xef, 0x99,
+    0x99, 0x9e, 0xf2, 0x0, 0x6, 0xfd, 0xdd, 0xdd, 0xdd, 0xf9, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0,
+    0xcf, 0x10, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x5f, 0x80, 0xcf, 0x10, 0x0, 0x0, 0x0, 0xd, 0xe1,
+
+    /* U+00C5 "Å" */
+    0x0, 0x0, 0x5, 0x96, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0x29, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x57, 0x5, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1c, 0x8c, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xbf, 0x60, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x1d, 0xd0, 0x0, 0x0, 0x0,
+    0x3, 0xf9, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x1, 0xec, 0x0, 0x0, 0x0, 0x1f, 0xa0,
+    0x0, 0x8f, 0x40, 0x0, 0x0, 0x8f, 0x40, 0x0, 0x2f, 0xa0, 0x0, 0x1, 0xef, 0x99, 0x99, 0x9e,
+    0xf2, 0x0, 0x6, 0xfd, 0xdd, 0xdd, 0xdd, 0xf9, 0x0, 0xd, 0xe0, 0x0, 0x0, 0x0, 0xcf, 0x10,
+    0x5f, 0x70, 0x0, 0x0, 0x0, 0x5f, 0x80, 0xcf, 0x10, 0x0, 0x0, 0x0, 0xd, 0xe1,
+
+    /* U+00C6 "Æ" */
+    0x0, 0x0, 0x0, 0x6, 0x99, 0x99, 0x99, 0x99, 0x95, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xfe, 0xee,
+    0xee, 0xe8, 0x0, 0x0, 0x0, 0xbe, 0x6f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf6, 0x5f,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xc0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0x40, 0x5f, 0x82, 0x22, 0x22, 0x20, 0x0, 0x2, 0xfa, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xc0, 0x0,
+    0xb, 0xe2, 0x0, 0x5f, 0xa5, 0x55, 0x55, 0x40, 0x0, 0x5f, 0xd9, 0x99, 0xbf, 0x70, 0x0, 0x0,
+    0x0, 0x1, 0xde, 0xdd, 0xdd, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x5f, 0x70,
+    0x0, 0x0, 0x0, 0x2f, 0xb0, 0x0, 0x0, 0x5f, 0xc8, 0x88, 0x88, 0x87, 0xbf, 0x20, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xff, 0xfd,
+
+    /* U+00C7 "Ç" */
+    0x0, 0x0, 0x16, 0x9b, 0xa7, 0x20, 0x0, 0x0, 0x7f, 0xff, 0xde, 0xff, 0x70, 0x0, 0x8f, 0xd5,
+    0x0, 0x4, 0xcd, 0x10, 0x4f, 0xc1, 0x0, 0x0, 0x0, 0x20, 0xb, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xdf, 0x80, 0x0, 0x0, 0x79, 0x0, 0x2, 0xcf, 0xe9, 0x79, 0xdf, 0xd1, 0x0, 0x1,
+    0x7c, 0xff, 0xfc, 0x71, 0x0, 0x0, 0x0, 0x7, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x21, 0x6e, 0x0, 0x0, 0x0, 0x0, 0x8, 0xdc, 0x50, 0x0, 0x0,
+
+    /* U+00C8 "È" */
+    0x0, 0x5e, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x16, 0x30, 0x0,
+    0x1, 0x99, 0x99, 0x99, 0x99, 0x70, 0x2f, 0xfe, 0xee, 0xee, 0xeb, 0x2, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xb2, 0x22, 0x22,
+    0x20, 0x2, 0xff, 0xff, 0xff, 0xff, 0x0, 0x2f, 0xc5, 0x55, 0x55, 0x50, 0x2, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd8, 0x88,
+    0x88, 0x88, 0x2, 0xff, 0xff, 0xff, 0xff, 0xf1,
+
+    /* U+00C9 "É" */
+    0x0, 0x0, 0x2, 0xdc, 0x20, 0x0, 0x0, 0x3, 0xea, 0x10, 0x0, 0x0, 0x0, 0x45, 0x0, 0x0,
+    0x1, 0x99, 0x99, 0x99, 0x99, 0x70, 0x2f, 0xfe, 0xee, 0xee, 0xeb, 0x2, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xb2, 0x22, 0x22,
+    0x20, 0x2, 0xff, 0xff, 0xff, 0xff, 0x0, 0x2f, 0xc5, 0x55, 0x55, 0x50, 0x2, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd8, 0x88,
+    0x88, 0x88, 0x2, 0xff, 0xff, 0xff, 0xff, 0xf1,
+
+    /* U+00CA "Ê" */
+    0x0, 0x2, 0xce, 0xa0, 0x0, 0x0, 0x2, 0xda, 0x3d, 0xa0, 0x0, 0x0, 0x45, 0x0, 0x16, 0x20,
+    0x1, 0x99, 0x99, 0x99, 0x99, 0x70, 0x2f, 0xfe, 0xee, 0xee, 0xeb, 0x2, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xb2, 0x22, 0x22,
+    0x20, 0x2, 0xff, 0xff, 0xff, 0xff, 0x0, 0x2f, 0xc5, 0x55, 0x55, 0x50, 0x2, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd8, 0x88,
+    0x88, 0x88, 0x2, 0xff, 0xff, 0xff, 0xff, 0xf1,
+
+    /* U+00CB "Ë" */
+    0x0, 0x1b, 0x40, 0x88, 0x0, 0x0, 0x2, 0xe7, 0xb, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x99, 0x99, 0x99, 0x99, 0x70, 0x2f, 0xfe, 0xee, 0xee, 0xeb, 0x2, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xb2, 0x22, 0x22,
+    0x20, 0x2, 0xff, 0xff, 0xff, 0xff, 0x0, 0x2f, 0xc5, 0x55, 0x55, 0x50, 0x2, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd8, 0x88,
+    0x88, 0x88, 0x2, 0xff, 0xff, 0xff, 0xff, 0xf1,
+
+    /* U+00CC "Ì" */
+    0x1b, 0xe4, 0x0, 0x9, 0xe4, 0x0, 0x4, 0x50, 0x1, 0x96, 0x0, 0x2f, 0xa0, 0x2, 0xfa, 0x0,
+    0x2f, 0xa0, 0x2, 0xfa, 0x0, 0x2f, 0xa0, 0x2, 0xfa, 0x0, 0x2f, 0xa0, 0x2, 0xfa, 0x0, 0x2f,
+    0xa0, 0x2, 0xfa, 0x0, 0x2f, 0xa0, 0x2, 0xfa,
+
+    /* U+00CD "Í" */
+    0x0, 0x9e, 0x70, 0x9e, 0x40, 0x26, 0x20, 0x1, 0x96, 0x0, 0x2f, 0xa0, 0x2, 0xfa, 0x0, 0x2f,
+    0xa0, 0x2, 0xfa, 0x0, 0x2f, 0xa0, 0x2, 0xfa, 0x0, 0x2f, 0xa0, 0x2, 0xfa, 0x0, 0x2f, 0xa0,
+    0x2, 0xfa, 0x0, 0x2f, 0xa0, 0x2, 0xfa, 0x0,
+
+    /* U+00CE "Î" */
+    0x0, 0x8e, 0xd3, 0x0, 0x8e, 0x49, 0xe3, 0x16, 0x20, 0x4, 0x50, 0x1, 0x96, 0x0, 0x0, 0x2f,
+    0xa0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x2f, 0xa0, 0x0,
+    0x2, 0xfa, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x2, 0xfa, 0x0, 0x0, 0x2f, 0xa0, 0x0, 0x2, 0xfa,
+    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x2, 0xfa, 0x0,
+
+    /* U+00CF "Ï" */
+    0x79, 0x3, 0xb2, 0xad, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x1, 0x96, 0x0, 0x2, 0xfa, 0x0, 0x2,
+    0xfa, 0x0, 0x2, 0xfa, 0x0, 0x2, 0xfa, 0x0, 0x2, 0xfa, 0x0, 0x2, 0xfa, 0x0, 0x2, 0xfa,
+    0x0, 0x2, 0xfa, 0x0, 0x2, 0xfa, 0x0, 0x2, 0xfa, 0x0, 0x2, 0xfa, 0x0, 0x2, 0xfa, 0x0,
+
+    /* U+00D0 "Ð" */
+    0x0, 0x99, 0x99, 0x99, 0x74, 0x0, 0x0, 0x0, 0xe, 0xfe, 0xee, 0xff, 0xfe, 0x60, 0x0, 0x0,
+    0xed, 0x0, 0x0, 0x26, 0xdf, 0x80, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x1, 0xcf, 0x40, 0x0, 0xed,
+    0x0, 0x0, 0x0, 0x3, 0xfb, 0x2, 0x2f, 0xe2, 0x22, 0x10, 0x0, 0xc, 0xf0, 0xcf, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0xaf, 0x24, 0x4f, 0xf4, 0x44, 0x20, 0x0, 0xb, 0xf1, 0x0, 0xed, 0x0, 0x0,
+    0x0, 0x1, 0xed, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x0, 0x8f, 0x70, 0x0, 0xed, 0x0, 0x0, 0x1,
+    0x8f, 0xc1, 0x0, 0xe, 0xe8, 0x88, 0x9b, 0xef, 0xc2, 0x0, 0x0, 0xef, 0xff, 0xff, 0xda, 0x50,
+    0x0, 0x0,
+
+    /* U+00D1 "Ñ" */
+    0x0, 0x2, 0xcd, 0x40, 0x93, 0x0, 0x0, 0x9, 0x84, 0xdc, 0xd1, 0x0, 0x0, 0x2, 0x10, 0x14,
+    0x10, 0x0, 0x19, 0x50, 0x0, 0x0, 0x1, 0x97, 0x2f, 0xf4, 0x0, 0x0, 0x1, 0xfb, 0x2f, 0xfe,
+    0x20, 0x0, 0x1, 0xfb, 0x2f, 0xef, 0xc1, 0x0, 0x1, 0xfb, 0x2f, 0xa9, 0xfa, 0x0, 0x1, 0xfb,
+    0x2f, 0xa0, 0xbf, 0x70, 0x1, 0xfb, 0x2f, 0xa0, 0x1d, 0xf4, 0x1, 0xfb, 0x2f, 0xa0, 0x3, 0xfe,
+    0x21, 0xfb, 0x2f, 0xa0, 0x0, 0x6f, 0xc2, 0xfb, 0x2f, 0xa0, 0x0, 0x8, 0xfb, 0xfb, 0x2f, 0xa0,
+    0x0, 0x0, 0xbf, 0xfb, 0x2f, 0xa0, 0x0, 0x0, 0x1d, 0xfb, 0x2f, 0xa0, 0x0, 0x0, 0x3, 0xeb,
+
+    /* U+00D2 "Ò" */
+    0x0, 0x0, 0x3d, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xd2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0x69, 0xba, 0x72, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfd, 0xef, 0xf8, 0x0, 0x0, 0x8, 0xfd, 0x50, 0x0, 0x4c, 0xfa, 0x0, 0x4, 0xfc, 0x10,
+    0x0, 0x0, 0xb, 0xf6, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0xf, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0x21, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x1f, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0x20, 0xde, 0x10, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x7,
+    0xf9, 0x0, 0x1c, 0xf8, 0x0, 0x0, 0x6, 0xfe, 0x10, 0x0, 0x2c, 0xfd, 0x97, 0x9d, 0xfd, 0x30,
+    0x0, 0x0, 0x6, 0xbe, 0xfe, 0xc7, 0x10, 0x0,
+
+    /* U+00D3 "Ó" */
+    0x0, 0x0, 0x0, 0x1, 0xbe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcc, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x35, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1, 0x69, 0xba, 0x72, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfd, 0xef, 0xf8, 0x0, 0x0, 0x8, 0xfd, 0x50, 0x0, 0x4c, 0xfa, 0x0, 0x4, 0xfc, 0x10,
+    0x0, 0x0, 0xb, 0xf6, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0xf, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0x21, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x1f, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0x20, 0xde, 0x10, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x7,
+    0xf9, 0x0, 0x1c, 0xf8, 0x0, 0x0, 0x6, 0xfe, 0x10, 0x0, 0x2c, 0xfd, 0x97, 0x9d, 0xfd, 0x30,
+    0x0, 0x0, 0x6, 0xbe, 0xfe, 0xc7, 0x10, 0x0,
+
+    /* U+00D4 "Ô" */
+    0x0, 0x0, 0x0, 0xae, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbc, 0x3b, 0xc1, 0x0, 0x0, 0x0,
+    0x0, 0x36, 0x10, 0x5, 0x30, 0x0, 0x0, 0x0, 0x1, 0x69, 0xba, 0x72, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfd, 0xef, 0xf8, 0x0, 0x0, 0x8, 0xfd, 0x50, 0x0, 0x4c, 0xfa, 0x0, 0x4, 0xfc, 0x10,
+    0x0, 0x0, 0xb, 0xf6, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0xf, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0x21, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x1f, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0x20, 0xde, 0x10, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x7,
+    0xf9, 0x0, 0x1c, 0xf8, 0x0, 0x0, 0x6, 0xfe, 0x10, 0x0, 0x2c, 0xfd, 0x97, 0x9d, 0xfd, 0x30,
+    0x0, 0x0, 0x6, 0xbe, 0xfe, 0xc7, 0x10, 0x0,
+
+    /* U+00D5 "Õ" */
+    0x0, 0x0, 0xa, 0xd7, 0x6, 0x70, 0x0, 0x0, 0x0, 0x5, 0xc3, 0xbd, 0xe3, 0x0, 0x0, 0x0,
+    0x0, 0x12, 0x0, 0x32, 0x0, 0x0, 0x0, 0x0, 0x1, 0x69, 0xba, 0x72, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfd, 0xef, 0xf8, 0x0, 0x0, 0x8, 0xfd, 0x50, 0x0, 0x4c, 0xfa, 0x0, 0x4, 0xfc, 0x10,
+    0x0, 0x0, 0xb, 0xf6, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0xf, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0x21, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x1f, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0x20, 0xde, 0x10, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x7,
+    0xf9, 0x0, 0x1c, 0xf8, 0x0, 0x0, 0x6, 0xfe, 0x10, 0x0, 0x2c, 0xfd, 0x97, 0x9d, 0xfd, 0x30,
+    0x0, 0x0, 0x6, 0xbe, 0xfe, 0xc7, 0x10, 0x0,
+
+    /* U+00D6 "Ö" */
+    0x0, 0x0, 0x9, 0x70, 0x5a, 0x10, 0x0, 0x0, 0x0, 0x0, 0xda, 0x8, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x69, 0xba, 0x72, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfd, 0xef, 0xf8, 0x0, 0x0, 0x8, 0xfd, 0x50, 0x0, 0x4c, 0xfa, 0x0, 0x4, 0xfc, 0x10,
+    0x0, 0x0, 0xb, 0xf6, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0xf, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0x21, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x1f, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0x20, 0xde, 0x10, 0x0, 0x0, 0x0, 0xd, 0xe0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x7,
+    0xf9, 0x0, 0x1c, 0xf8, 0x0, 0x0, 0x6, 0xfe, 0x10, 0x0, 0x2c, 0xfd, 0x97, 0x9d, 0xfd, 0x30,
+    0x0, 0x0, 0x6, 0xbe, 0xfe, 0xc7, 0x10, 0x0,
+
+    /* U+00D7 "×" */
+    0x42, 0x0, 0x6, 0xc, 0xe2, 0x9, 0xf5, 0x1d, 0xd9, 0xf7, 0x0, 0x2e, 0xf8, 0x0, 0x8, 0xfe,
+    0xd2, 0x8, 0xf7, 0x2d, 0xd2, 0xa7, 0x0, 0x2c, 0x30,
+
+    /* U+00D8 "Ø" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xc5, 0x0, 0x0, 0x1, 0x69, 0xba, 0x72, 0xab, 0x0, 0x0,
+    0x7, 0xff, 0xfd, 0xef, 0xff, 0x20, 0x0, 0x8, 0xfd, 0x50, 0x0, 0x6f, 0xfa, 0x0, 0x4, 0xfc,
+    0x10, 0x0, 0xc, 0x9b, 0xf6, 0x0, 0xbf, 0x30, 0x0, 0x9, 0xc0, 0x2f, 0xd0, 0xf, 0xd0, 0x0,
+    0x4, 0xe2, 0x0, 0xbf, 0x21, 0xfa, 0x0, 0x1, 0xe6, 0x0, 0x9, 0xf3, 0x1f, 0xb0, 0x0, 0xba,
+    0x0, 0x0, 0xaf, 0x20, 0xde, 0x10, 0x7d, 0x10, 0x0, 0xd, 0xe0, 0x7, 0xf8, 0x3e, 0x40, 0x0,
+    0x7, 0xf9, 0x0, 0x1c, 0xff, 0x80, 0x0, 0x6, 0xfe, 0x10, 0x0, 0x2f, 0xfe, 0x97, 0x9d, 0xfd,
+    0x30, 0x0, 0x5, 0xe8, 0xbe, 0xfe, 0xc7, 0x10, 0x0, 0x2, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x12, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00D9 "Ù" */
+    0x0, 0x8, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2, 0x62,
+    0x0, 0x0, 0x29, 0x50, 0x0, 0x0, 0x3, 0x94, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
+    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7,
+    0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
+    0x5, 0xf6, 0x2f, 0xa0, 0x0, 0x0, 0x6, 0xf5, 0xe, 0xe0, 0x0, 0x0, 0xa, 0xf3, 0x9, 0xf8,
+    0x0, 0x0, 0x4f, 0xc0, 0x1, 0xdf, 0xc8, 0x7a, 0xfe, 0x30, 0x0, 0x18, 0xdf, 0xfd, 0x92, 0x0,
+
+    /* U+00DA "Ú" */
+    0x0, 0x0, 0x0, 0x4e, 0xb1, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5, 0x40,
+    0x0, 0x0, 0x29, 0x50, 0x0, 0x0, 0x3, 0x94, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
+    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7,
+    0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
+    0x5, 0xf6, 0x2f, 0xa0, 0x0, 0x0, 0x6, 0xf5, 0xe, 0xe0, 0x0, 0x0, 0xa, 0xf3, 0x9, 0xf8,
+    0x0, 0x0, 0x4f, 0xc0, 0x1, 0xdf, 0xc8, 0x7a, 0xfe, 0x30, 0x0, 0x18, 0xdf, 0xfd, 0x92, 0x0,
+
+    /* U+00DB "Û" */
+    0x0, 0x0, 0x3e, 0xe7, 0x0, 0x0, 0x0, 0x4, 0xe8, 0x5e, 0x70, 0x0, 0x0, 0x5, 0x40, 0x2,
+    0x61, 0x0, 0x29, 0x50, 0x0, 0x0, 0x3, 0x94, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
+    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7,
+    0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
+    0x5, 0xf6, 0x2f, 0xa0, 0x0, 0x0, 0x6, 0xf5, 0xe, 0xe0, 0x0, 0x0, 0xa, 0xf3, 0x9, 0xf8,
+    0x0, 0x0, 0x4f, 0xc0, 0x1, 0xdf, 0xc8, 0x7a, 0xfe, 0x30, 0x0, 0x18, 0xdf, 0xfd, 0x92, 0x0,
+
+    /* U+00DC "Ü" */
+    0x0, 0x3, 0xb2, 0xa, 0x60, 0x0, 0x0, 0x5, 0xf4, 0x1e, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x29, 0x50, 0x0, 0x0, 0x3, 0x94, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
+    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7,
+    0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
+    0x5, 0xf6, 0x2f, 0xa0, 0x0, 0x0, 0x6, 0xf5, 0xe, 0xe0, 0x0, 0x0, 0xa, 0xf3, 0x9, 0xf8,
+    0x0, 0x0, 0x4f, 0xc0, 0x1, 0xdf, 0xc8, 0x7a, 0xfe, 0x30, 0x0, 0x18, 0xdf, 0xfd, 0x92, 0x0,
+
+    /* U+00DD "Ý" */
+    0x0, 0x0, 0x0, 0x8e, 0x70, 0x0, 0x0, 0x0, 0x9, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x26, 0x20,
+    0x0, 0x0, 0x89, 0x10, 0x0, 0x0, 0x2, 0x95, 0x6f, 0x80, 0x0, 0x0, 0xb, 0xe2, 0xc, 0xf2,
+    0x0, 0x0, 0x5f, 0x70, 0x3, 0xfb, 0x0, 0x1, 0xdc, 0x0, 0x0, 0x9f, 0x50, 0x8, 0xf4, 0x0,
+    0x0, 0x1e, 0xd1, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf8, 0xce, 0x10, 0x0, 0x0, 0x0, 0xbf, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
+
+    /* U+00DE "Þ" */
+    0x19, 0x60, 0x0, 0x0, 0x0, 0x2, 0xfb, 0x11, 0x10, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfd, 0x81,
+    0x2, 0xfd, 0x88, 0x89, 0xcf, 0xd2, 0x2f, 0xa0, 0x0, 0x0, 0x7f, 0xa2, 0xfa, 0x0, 0x0, 0x0,
+    0xde, 0x2f, 0xa0, 0x0, 0x0, 0xc, 0xf2, 0xfa, 0x0, 0x0, 0x1, 0xed, 0x2f, 0xa0, 0x0, 0x2,
+    0xaf, 0x82, 0xfe, 0xcc, 0xcd, 0xff, 0xa0, 0x2f, 0xeb, 0xbb, 0xa8, 0x40, 0x2, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xa0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00DF "ß" */
+    0x0, 0x3, 0x66, 0x40, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xd3, 0x0, 0xa, 0xf8, 0x21, 0x5e, 0xd0,
+    0x2, 0xfa, 0x0, 0x0, 0x7f, 0x40, 0x4f, 0x60, 0x0, 0x6, 0xf4, 0x5, 0xf5, 0x0, 0x0, 0xce,
+    0x10, 0x5f, 0x50, 0x18, 0xde, 0x50, 0x5, 0xf5, 0x4, 0xff, 0xfa, 0x10, 0x5f, 0x50, 0x1, 0x27,
+    0xfc, 0x5, 0xf5, 0x0, 0x0, 0x8, 0xf4, 0x5f, 0x50, 0x0, 0x0, 0x6f, 0x55, 0xf5, 0x0, 0x0,
+    0xa, 0xf3, 0x5f, 0x50, 0x77, 0x7b, 0xfa, 0x5, 0xf5, 0xd, 0xff, 0xd8, 0x10,
+
+    /* U+00E0 "à" */
+    0x0, 0x44, 0x10, 0x0, 0x0, 0x0, 0x3d, 0xd2, 0x0, 0x0, 0x0, 0x1, 0xbd, 0x20, 0x0, 0x0,
+    0x0, 0x1, 0x10, 0x0, 0x0, 0x27, 0x99, 0x72, 0x0, 0x8, 0xff, 0xde, 0xfe, 0x40, 0x5, 0x81,
+    0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x0, 0x26, 0x77, 0x7b, 0xf3, 0x6, 0xfe, 0xcb,
+    0xbd, 0xf3, 0xe, 0xd1, 0x0, 0x8, 0xf3, 0x1f, 0xa0, 0x0, 0xc, 0xf3, 0xc, 0xf7, 0x45, 0xbf,
+    0xf3, 0x2, 0x9d, 0xfe, 0x97, 0xf3,
+
+    /* U+00E1 "á" */
+    0x0, 0x0, 0x0, 0x34, 0x10, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x8e, 0x50, 0x0, 0x0,
+    0x0, 0x11, 0x0, 0x0, 0x0, 0x27, 0x99, 0x72, 0x0, 0x8, 0xff, 0xde, 0xfe, 0x40, 0x5, 0x81,
+    0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x0, 0x26, 0x77, 0x7b, 0xf3, 0x6, 0xfe, 0xcb,
+    0xbd, 0xf3, 0xe, 0xd1, 0x0, 0x8, 0xf3, 0x1f, 0xa0, 0x0, 0xc, 0xf3, 0xc, 0xf7, 0x45, 0xbf,
+    0xf3, 0x2, 0x9d, 0xfe, 0x97, 0xf3,
+
+    /* U+00E2 "â" */
+    0x0, 0x0, 0x34, 0x10, 0x0, 0x0, 0x6, 0xfd, 0xc1, 0x0, 0x0, 0x6e, 0x51, 0xbc, 0x10, 0x0,
+    0x11, 0x0, 0x1, 0x0, 0x0, 0x27, 0x99, 0x72, 0x0, 0x8, 0xff, 0xde, 0xfe, 0x40, 0x5, 0x81,
+    0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x0, 0x26, 0x77, 0x7b, 0xf3, 0x6, 0xfe, 0xcb,
+    0xbd, 0xf3, 0xe, 0xd1, 0x0, 0x8, 0xf3, 0x1f, 0xa0, 0x0, 0xc, 0xf3, 0xc, 0xf7, 0x45, 0xbf,
+    0xf3, 0x2, 0x9d, 0xfe, 0x97, 0xf3,
+
+    /* U+00E3 "ã" */
+    0x0, 0x2, 0x20, 0x1, 0x0, 0x0, 0x5e, 0xe8, 0x2d, 0x20, 0x0, 0xa4, 0x1a, 0xe9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0x99, 0x72, 0x0, 0x8, 0xff, 0xde, 0xfe, 0x40, 0x5, 0x81,
+    0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x0, 0x26, 0x77, 0x7b, 0xf3, 0x6, 0xfe, 0xcb,
+    0xbd, 0xf3, 0xe, 0xd1, 0x0, 0x8, 0xf3, 0x1f, 0xa0, 0x0, 0xc, 0xf3, 0xc, 0xf7, 0x45, 0xbf,
+    0xf3, 0x2, 0x9d, 0xfe, 0x97, 0xf3,
+
+    /* U+00E4 "ä" */
+    0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x3f, 0x50, 0xda, 0x0, 0x0, 0x2b, 0x30, 0x97, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0x99, 0x72, 0x0, 0x8, 0xff, 0xde, 0xfe, 0x40, 0x5, 0x81,
+    0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x0, 0x26, 0x77, 0x7b, 0xf3, 0x6, 0xfe, 0xcb,
+    0xbd, 0xf3, 0xe, 0xd1, 0x0, 0x8, 0xf3, 0x1f, 0xa0, 0x0, 0xc, 0xf3, 0xc, 0xf7, 0x45, 0xbf,
+    0xf3, 0x2, 0x9d, 0xfe, 0x97, 0xf3,
+
+    /* U+00E5 "å" */
+    0x0, 0x0, 0x68, 0x20, 0x0, 0x0, 0x8, 0x74, 0xc1, 0x0, 0x0, 0xb, 0x20, 0xa2, 0x0, 0x0,
+    0x5, 0xb8, 0xb0, 0x0, 0x0, 0x0, 0x24, 0x0, 0x0, 0x0, 0x27, 0x99, 0x72, 0x0, 0x8, 0xff,
+    0xde, 0xfe, 0x40, 0x5, 0x81, 0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x0, 0x26, 0x77,
+    0x7b, 0xf3, 0x6, 0xfe, 0xcb, 0xbd, 0xf3, 0xe, 0xd1, 0x0, 0x8, 0xf3, 0x1f, 0xa0, 0x0, 0xc,
+    0xf3, 0xc, 0xf7, 0x45, 0xbf, 0xf3, 0x2, 0x9d, 0xfe, 0x97, 0xf3,
+
+    /* U+00E6 "æ" */
+    0x0, 0x27, 0x99, 0x72, 0x0, 0x48, 0x97, 0x20, 0x0, 0x8f, 0xfe, 0xef, 0xe4, 0xbf, 0xed, 0xff,
+    0x60, 0x5, 0x81, 0x0, 0x4f, 0xff, 0x60, 0x2, 0xbf, 0x40, 0x0, 0x0, 0x0, 0xaf, 0x90, 0x0,
+    0x1, 0xeb, 0x0, 0x25, 0x77, 0x7b, 0xfa, 0x77, 0x77, 0x7d, 0xe0, 0x6f, 0xec, 0xcc, 0xdf, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xe, 0xd1, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0xcf,
+    0xe2, 0x0, 0x0, 0x40, 0xb, 0xf8, 0x45, 0xbf, 0x7f, 0xe9, 0x78, 0xdf, 0x20, 0x19, 0xdf, 0xeb,
+    0x30, 0x3a, 0xef, 0xeb, 0x40,
+
+    /* U+00E7 "ç" */
+    0x0, 0x2, 0x79, 0x85, 0x0, 0x0, 0x7f, 0xfe, 0xef, 0xc1, 0x6, 0xfb, 0x20, 0x6, 0xe5, 0xd,
+    0xe1, 0x0, 0x0, 0x10, 0x2f, 0x90, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0x1f, 0xb0,
+    0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x1, 0x82, 0x1, 0xdf, 0xa7, 0x8d, 0xf5, 0x0, 0x19, 0xdf,
+    0xeb, 0x40, 0x0, 0x0, 0x4c, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xd1, 0x0, 0x0, 0x2, 0x24, 0xf2,
+    0x0, 0x0, 0x6, 0xdd, 0x70, 0x0,
+
+    /* U+00E8 "è" */
+    0x0, 0x24, 0x20, 0x0, 0x0, 0x0, 0x1, 0xbe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7e, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x3, 0x79, 0x83, 0x0, 0x0, 0x8, 0xff, 0xdf, 0xf9,
+    0x0, 0x7, 0xf9, 0x10, 0x18, 0xf7, 0x0, 0xec, 0x0, 0x0, 0xb, 0xe0, 0x2f, 0xb7, 0x77, 0x77,
+    0xbf, 0x33, 0xfe, 0xcc, 0xcc, 0xcc, 0xc3, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0,
+    0x5, 0x0, 0x2, 0xdf, 0xb7, 0x7b, 0xf6, 0x0, 0x1, 0x9d, 0xee, 0xc7, 0x0,
+
+    /* U+00E9 "é" */
+    0x0, 0x0, 0x0, 0x24, 0x30, 0x0, 0x0, 0x0, 0x4e, 0xb1, 0x0, 0x0, 0x0, 0x4e, 0x80, 0x0,
+    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x3, 0x79, 0x83, 0x0, 0x0, 0x8, 0xff, 0xdf, 0xf9,
+    0x0, 0x7, 0xf9, 0x10, 0x18, 0xf7, 0x0, 0xec, 0x0, 0x0, 0xb, 0xe0, 0x2f, 0xb7, 0x77, 0x77,
+    0xbf, 0x33, 0xfe, 0xcc, 0xcc, 0xcc, 0xc3, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0,
+    0x5, 0x0, 0x2, 0xdf, 0xb7, 0x7b, 0xf6, 0x0, 0x1, 0x9d, 0xee, 0xc7, 0x0,
+
+    /* U+00EA "ê" */
+    0x0, 0x0, 0x24, 0x20, 0x0, 0x0, 0x0, 0x3e, 0xde, 0x30, 0x0, 0x0, 0x3e, 0x80, 0x8e, 0x30,
+    0x0, 0x1, 0x10, 0x0, 0x11, 0x0, 0x0, 0x3, 0x79, 0x83, 0x0, 0x0, 0x8, 0xff, 0xdf, 0xf9,
+    0x0, 0x7, 0xf9, 0x10, 0x18, 0xf7, 0x0, 0xec, 0x0, 0x0, 0xb, 0xe0, 0x2f, 0xb7, 0x77, 0x77,
+    0xbf, 0x33, 0xfe, 0xcc, 0xcc, 0xcc, 0xc3, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50, 0x0,
+    0x5, 0x0, 0x2, 0xdf, 0xb7, 0x7b, 0xf6, 0x0, 0x1, 0x9d, 0xee, 0xc7, 0x0,
+
+    /* U+00EB "ë" */
+    0x0, 0xe, 0x90, 0x9e, 0x10, 0x0, 0x0, 0x96, 0x5, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x37, 0x98, 0x30, 0x0, 0x0, 0x8f, 0xfd, 0xff, 0x90, 0x0, 0x7f, 0x91, 0x1, 0x8f,
+    0x70, 0xe, 0xc0, 0x0, 0x0, 0xbe, 0x2, 0xfb, 0x77, 0x77, 0x7b, 0xf3, 0x3f, 0xec, 0xcc, 0xcc,
+    0xcc, 0x31, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x50, 0x0, 0x2d, 0xfb, 0x77,
+    0xbf, 0x60, 0x0, 0x19, 0xde, 0xec, 0x70, 0x0,
+
+    /* U+00EC "ì" */
+    0x24, 0x20, 0x1, 0xbe, 0x40, 0x0, 0x8e, 0x40, 0x0, 0x11, 0x0, 0x38, 0x30, 0x5, 0xf5, 0x0,
+    0x5f, 0x50, 0x5, 0xf5, 0x0, 0x5f, 0x50, 0x5, 0xf5, 0x0, 0x5f, 0x50, 0x5, 0xf5, 0x0, 0x5f,
+    0x50, 0x5, 0xf5,
+
+    /* U+00ED "í" */
+    0x0, 0x24, 0x20, 0x4e, 0xb1, 0x4e, 0x80, 0x1, 0x10, 0x0, 0x38, 0x30, 0x5, 0xf5, 0x0, 0x5f,
+    0x50, 0x5, 0xf5, 0x0, 0x5f, 0x50, 0x5, 0xf5, 0x0, 0x5f, 0x50, 0x5, 0xf5, 0x0, 0x5f, 0x50,
+    0x5, 0xf5, 0x0,
+
+    /* U+00EE "î" */
+    0x2, 0x42, 0x1, 0xde, 0xd1, 0xbb, 0x1b, 0xb1, 0x0, 0x1, 0x3, 0x83, 0x0, 0x5f, 0x50, 0x5,
+    0xf5, 0x0, 0x5f, 0x50, 0x5, 0xf5, 0x0, 0x5f, 0x50, 0x5, 0xf5, 0x0, 0x5f, 0x50, 0x5, 0xf5,
+    0x0, 0x5f, 0x50,
+
+    /* U+00EF "ï" */
+    0x8e, 0x1e, 0x85, 0xa0, 0x95, 0x0, 0x0, 0x0, 0x38, 0x30, 0x5, 0xf5, 0x0, 0x5f, 0x50, 0x5,
+    0xf5, 0x0, 0x5f, 0x50, 0x5, 0xf5, 0x0, 0x5f, 0x50, 0x5, 0xf5, 0x0, 0x5f, 0x50, 0x5, 0xf5,
+    0x0,
+
+    /* U+00F0 "ð" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xfc, 0x64, 0x80, 0x2, 0xa7, 0x69, 0xff, 0xfa,
+    0x10, 0x0, 0x4a, 0xfd, 0x9f, 0x90, 0x0, 0x8f, 0xa4, 0x0, 0xaf, 0x20, 0x1, 0x10, 0x0, 0x4,
+    0xf7, 0x0, 0x29, 0xcd, 0xb6, 0x1f, 0xa0, 0x4e, 0xfb, 0x9b, 0xf9, 0xfb, 0xd, 0xe3, 0x0, 0x3,
+    0xef, 0xb2, 0xf9, 0x0, 0x0, 0x9, 0xf9, 0x3f, 0x90, 0x0, 0x0, 0x8f, 0x51, 0xed, 0x10, 0x0,
+    0x1d, 0xd1, 0x6, 0xfd, 0x75, 0x7d, 0xe4, 0x0, 0x5, 0xcf, 0xfe, 0xa3, 0x0,
+
+    /* U+00F1 "ñ" */
+    0x0, 0x2, 0x20, 0x1, 0x0, 0x0, 0x6e, 0xe7, 0x2e, 0x10, 0x0, 0xb3, 0x1a, 0xe8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x38, 0x22, 0x79, 0x84, 0x0, 0x5f, 0x9f, 0xfe, 0xff, 0x90, 0x5f, 0xf8,
+    0x10, 0x2c, 0xf4, 0x5f, 0xb0, 0x0, 0x4, 0xf9, 0x5f, 0x60, 0x0, 0x1, 0xfa, 0x5f, 0x50, 0x0,
+    0x1, 0xfa, 0x5f, 0x50, 0x0, 0x1, 0xfa, 0x5f, 0x50, 0x0, 0x1, 0xfa, 0x5f, 0x50, 0x0, 0x1,
+    0xfa, 0x5f, 0x50, 0x0, 0x1, 0xfa,
+
+    /* U+00F2 "ò" */
+    0x0, 0x24, 0x30, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5e, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0, 0x2, 0x79, 0x85, 0x0, 0x0, 0x8, 0xff, 0xef, 0xfc,
+    0x20, 0x6, 0xfb, 0x20, 0x6, 0xfc, 0x0, 0xee, 0x10, 0x0, 0x8, 0xf5, 0x2f, 0x90, 0x0, 0x0,
+    0x2f, 0x93, 0xf8, 0x0, 0x0, 0x2, 0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x5f, 0x70, 0xaf, 0x50, 0x0,
+    0x1c, 0xf2, 0x2, 0xdf, 0xa7, 0x8d, 0xf6, 0x0, 0x1, 0x9d, 0xfe, 0xb4, 0x0,
+
+    /* U+00F3 "ó" */
+    0x0, 0x0, 0x0, 0x14, 0x30, 0x0, 0x0, 0x0, 0x2d, 0xd2, 0x0, 0x0, 0x0, 0x2d, 0xa1, 0x0,
+    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x2, 0x79, 0x85, 0x0, 0x0, 0x8, 0xff, 0xef, 0xfc,
+    0x20, 0x6, 0xfb, 0x20, 0x6, 0xfc, 0x0, 0xee, 0x10, 0x0, 0x8, 0xf5, 0x2f, 0x90, 0x0, 0x0,
+    0x2f, 0x93, 0xf8, 0x0, 0x0, 0x2, 0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x5f, 0x70, 0xaf, 0x50, 0x0,
+    0x1c, 0xf2, 0x2, 0xdf, 0xa7, 0x8d, 0xf6, 0x0, 0x1, 0x9d, 0xfe, 0xb4, 0x0,
+
+    /* U+00F4 "ô" */
+    0x0, 0x0, 0x14, 0x30, 0x0, 0x0, 0x0, 0x1c, 0xdf, 0x50, 0x0, 0x0, 0x1d, 0xa1, 0x5e, 0x50,
+    0x0, 0x1, 0x10, 0x0, 0x11, 0x0, 0x0, 0x2, 0x79, 0x85, 0x0, 0x0, 0x8, 0xff, 0xef, 0xfc,
+    0x20, 0x6, 0xfb, 0x20, 0x6, 0xfc, 0x0, 0xee, 0x10, 0x0, 0x8, 0xf5, 0x2f, 0x90, 0x0, 0x0,
+    0x2f, 0x93, 0xf8, 0x0, 0x0, 0x2, 0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x5f, 0x70, 0xaf, 0x50, 0x0,
+    0x1c, 0xf2, 0x2, 0xdf, 0xa7, 0x8d, 0xf6, 0x0, 0x1, 0x9d, 0xfe, 0xb4, 0x0,
+
+    /* U+00F5 "õ" */
+    0x0, 0x1, 0x30, 0x0, 0x10, 0x0, 0x0, 0xcd, 0xc3, 0x79, 0x0, 0x0, 0x3b, 0x5, 0xdd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x79, 0x85, 0x0, 0x0, 0x8, 0xff, 0xef, 0xfc,
+    0x20, 0x6, 0xfb, 0x20, 0x6, 0xfc, 0x0, 0xee, 0x10, 0x0, 0x8, 0xf5, 0x2f, 0x90, 0x0, 0x0,
+    0x2f, 0x93, 0xf8, 0x0, 0x0, 0x2, 0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x5f, 0x70, 0xaf, 0x50, 0x0,
+    0x1c, 0xf2, 0x2, 0xdf, 0xa7, 0x8d, 0xf6, 0x0, 0x1, 0x9d, 0xfe, 0xb4, 0x0,
+
+    /* U+00F6 "ö" */
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xbc, 0x6, 0xf3, 0x0, 0x0, 0x7, 0x80, 0x4b, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x79, 0x85, 0x0, 0x0, 0x8, 0xff, 0xef, 0xfc,
+    0x20, 0x6, 0xfb, 0x20, 0x6, 0xfc, 0x0, 0xee, 0x10, 0x0, 0x8, 0xf5, 0x2f, 0x90, 0x0, 0x0,
+    0x2f, 0x93, 0xf8, 0x0, 0x0, 0x2, 0xfa, 0x1f, 0xb0, 0x0, 0x0, 0x5f, 0x70, 0xaf, 0x50, 0x0,
+    0x1c, 0xf2, 0x2, 0xdf, 0xa7, 0x8d, 0xf6, 0x0, 0x1, 0x9d, 0xfe, 0xb4, 0x0,
+
+    /* U+00F7 "÷" */
+    0x0, 0x7, 0xd1, 0x0, 0x0, 0x0, 0xaf, 0x30, 0x0, 0x0, 0x1, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x45, 0x66, 0x66, 0x66, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6b, 0x10, 0x0, 0x0, 0xb, 0xf3, 0x0, 0x0, 0x0, 0x13, 0x0, 0x0,
+
+    /* U+00F8 "ø" */
+    0x0, 0x0, 0x0, 0x0, 0x1a, 0x0, 0x0, 0x27, 0x98, 0x5b, 0x60, 0x0, 0x8f, 0xfe, 0xff, 0xf2,
+    0x0, 0x6f, 0xb2, 0x2, 0xff, 0xc0, 0xe, 0xe1, 0x0, 0xa6, 0x8f, 0x52, 0xf9, 0x0, 0x5b, 0x2,
+    0xf9, 0x3f, 0x80, 0x1d, 0x20, 0x2f, 0xa1, 0xfb, 0xa, 0x60, 0x5, 0xf7, 0xa, 0xfa, 0xb0, 0x1,
+    0xcf, 0x20, 0x2f, 0xfc, 0x78, 0xdf, 0x60, 0x0, 0xcf, 0xdf, 0xeb, 0x40, 0x0, 0x5b, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+00F9 "ù" */
+    0x0, 0x44, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xb1, 0x0, 0x0, 0x0, 0x2, 0xcb, 0x10, 0x0, 0x0,
+    0x0, 0x1, 0x0, 0x0, 0x48, 0x20, 0x0, 0x2, 0x84, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40,
+    0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0,
+    0x3, 0xf8, 0x6f, 0x60, 0x0, 0x5, 0xf8, 0x3f, 0xb0, 0x0, 0x1c, 0xf8, 0xb, 0xfc, 0x78, 0xde,
+    0xf8, 0x1, 0x8d, 0xfe, 0xa3, 0xf8,
+
+    /* U+00FA "ú" */
+    0x0, 0x0, 0x0, 0x44, 0x10, 0x0, 0x0, 0xa, 0xe6, 0x0, 0x0, 0x0, 0xad, 0x30, 0x0, 0x0,
+    0x0, 0x10, 0x0, 0x0, 0x48, 0x20, 0x0, 0x2, 0x84, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40,
+    0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0,
+    0x3, 0xf8, 0x6f, 0x60, 0x0, 0x5, 0xf8, 0x3f, 0xb0, 0x0, 0x1c, 0xf8, 0xb, 0xfc, 0x78, 0xde,
+    0xf8, 0x1, 0x8d, 0xfe, 0xa3, 0xf8,
+
+    /* U+00FB "û" */
+    0x0, 0x0, 0x44, 0x0, 0x0, 0x0, 0x8, 0xee, 0xa0, 0x0, 0x0, 0x9d, 0x32, 0xda, 0x0, 0x0,
+    0x10, 0x0, 0x1, 0x0, 0x48, 0x20, 0x0, 0x2, 0x84, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40,
+    0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0,
+    0x3, 0xf8, 0x6f, 0x60, 0x0, 0x5, 0xf8, 0x3f, 0xb0, 0x0, 0x1c, 0xf8, 0xb, 0xfc, 0x78, 0xde,
+    0xf8, 0x1, 0x8d, 0xfe, 0xa3, 0xf8,
+
+    /* U+00FC "ü" */
+    0x0, 0x1, 0x0, 0x10, 0x0, 0x0, 0x6f, 0x31, 0xe8, 0x0, 0x0, 0x4b, 0x11, 0xa5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x48, 0x20, 0x0, 0x2, 0x84, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40,
+    0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0,
+    0x3, 0xf8, 0x6f, 0x60, 0x0, 0x5, 0xf8, 0x3f, 0xb0, 0x0, 0x1c, 0xf8, 0xb, 0xfc, 0x78, 0xde,
+    0xf8, 0x1, 0x8d, 0xfe, 0xa3, 0xf8,
+
+    /* U+00FD "ý" */
+    0x0, 0x0, 0x0, 0x14, 0x40, 0x0, 0x0, 0x0, 0x1c, 0xd3, 0x0, 0x0, 0x0, 0x2d, 0xb1, 0x0,
+    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x7, 0x70, 0x0, 0x0, 0x6, 0x80, 0x9f, 0x30, 0x0, 0x1,
+    0xf9, 0x2, 0xfa, 0x0, 0x0, 0x7f, 0x30, 0xa, 0xf2, 0x0, 0xe, 0xb0, 0x0, 0x4f, 0x80, 0x5,
+    0xf4, 0x0, 0x0, 0xce, 0x10, 0xcc, 0x0, 0x0, 0x5, 0xf6, 0x3f, 0x60, 0x0, 0x0, 0xd, 0xca,
+    0xe0, 0x0, 0x0, 0x0, 0x7f, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xef, 0x10, 0x0, 0x0, 0x0, 0x2f,
+    0x90, 0x0, 0x0, 0x71, 0x1b, 0xf2, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x36, 0x62,
+    0x0, 0x0, 0x0,
+
+    /* U+00FE "þ" */
+    0x25, 0x20, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0,
+    0x5, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x52, 0x79, 0x84, 0x0, 0x5, 0xfa, 0xef, 0xef, 0xfb,
+    0x10, 0x5f, 0xfa, 0x10, 0x18, 0xfb, 0x5, 0xfc, 0x0, 0x0, 0xa, 0xf3, 0x5f, 0x70, 0x0, 0x0,
+    0x5f, 0x75, 0xf6, 0x0, 0x0, 0x4, 0xf7, 0x5f, 0x90, 0x0, 0x0, 0x7f, 0x55, 0xfe, 0x30, 0x0,
+    0x2e, 0xe1, 0x5f, 0xee, 0x97, 0x9e, 0xf5, 0x5, 0xf6, 0x8d, 0xfe, 0xb4, 0x0, 0x5f, 0x50, 0x0,
+    0x0, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x2, 0x62, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+00FF "ÿ" */
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0xad, 0x5, 0xf4, 0x0, 0x0, 0x6, 0x90, 0x3b, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x70, 0x0, 0x0, 0x6, 0x80, 0x9f, 0x30, 0x0, 0x1,
+    0xf9, 0x2, 0xfa, 0x0, 0x0, 0x7f, 0x30, 0xa, 0xf2, 0x0, 0xe, 0xb0, 0x0, 0x4f, 0x80, 0x5,
+    0xf4, 0x0, 0x0, 0xce, 0x10, 0xcc, 0x0, 0x0, 0x5, 0xf6, 0x3f, 0x60, 0x0, 0x0, 0xd, 0xca,
+    0xe0, 0x0, 0x0, 0x0, 0x7f, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xef, 0x10, 0x0, 0x0, 0x0, 0x2f,
+    0x90, 0x0, 0x0, 0x71, 0x1b, 0xf2, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x36, 0x62,
+    0x0, 0x0, 0x0,
+
+    /* U+2013 "–" */
+    0x88, 0x88, 0x88, 0x88, 0x8a, 0xaa, 0xaa, 0xaa, 0xaa,
+
+    /* U+2014 "—" */
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa,
+
+    /* U+2018 "‘" */
+    0x0, 0x50, 0x4, 0xe0, 0x9, 0xa0, 0xe, 0xb0, 0x2f, 0xf2, 0x7, 0x80,
+
+    /* U+2019 "’" */
+    0x4, 0x50, 0x1f, 0xf3, 0xc, 0xf2, 0x8, 0xc0, 0xc, 0x70, 0x8, 0x20,
+
+    /* U+201C "“" */
+    0x0, 0x50, 0x4, 0x30, 0x4e, 0x0, 0xd5, 0x9, 0xa0, 0x3f, 0x10, 0xeb, 0x8, 0xe3, 0x2f, 0xf2,
+    0xbf, 0x90, 0x78, 0x3, 0x92,
+
+    /* U+201D "”" */
+    0x4, 0x50, 0x26, 0x11, 0xff, 0x3a, 0xf9, 0xc, 0xf2, 0x6f, 0x80, 0x8c, 0x2, 0xf3, 0xc, 0x70,
+    0x6d, 0x0, 0x82, 0x5, 0x50,
+
+    /* U+2022 "•" */
+    0x18, 0x60, 0xaf, 0xf5, 0xbf, 0xf5, 0x29, 0x70,
+
+    /* U+2026 "…" */
+    0x3, 0x30, 0x2, 0x40, 0x1, 0x50, 0x1f, 0xf2, 0xd, 0xf5, 0xb, 0xf7, 0x1d, 0xd1, 0xb, 0xe3,
+    0x8, 0xe5,
+
+    /* U+20AC "€" */
+    0x0, 0x0, 0x0, 0x48, 0xab, 0x95, 0x0, 0x0, 0x0, 0x2c, 0xff, 0xee, 0xff, 0xc2, 0x0, 0x2,
+    0xef, 0x92, 0x0, 0x17, 0xf8, 0x0, 0xc, 0xf6, 0x0, 0x0, 0x0, 0x20, 0x1, 0x4f, 0xc1, 0x11,
+    0x11, 0x0, 0x0, 0x7e, 0xff, 0xfe, 0xee, 0xee, 0x30, 0x0, 0x0, 0x9f, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x48, 0xcf, 0xa8, 0x88, 0x88, 0x20, 0x0, 0x37, 0x9f, 0xc7, 0x77, 0x77, 0x10, 0x0, 0x0,
+    0x1e, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfd, 0x30, 0x0, 0x2, 0xb3, 0x0, 0x0, 0x7f,
+    0xfb, 0x88, 0xaf, 0xf7, 0x0, 0x0, 0x3, 0xad, 0xff, 0xea, 0x40,
+
+    /* U+F00D "" */
+    0x2c, 0xa1, 0x0, 0x0, 0x6, 0xd6, 0xd, 0xff, 0xb1, 0x0, 0x6, 0xff, 0xf3, 0xcf, 0xff, 0xb1,
+    0x6, 0xff, 0xff, 0x31, 0xcf, 0xff, 0xb7, 0xff, 0xff, 0x50, 0x1, 0xcf, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x1, 0xcf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x6, 0xff,
+    0xff, 0xff, 0xb1, 0x0, 0x6, 0xff, 0xff, 0xdf, 0xff, 0xb1, 0x6, 0xff, 0xff, 0x51, 0xcf, 0xff,
+    0xb1, 0xef, 0xff, 0x50, 0x1, 0xcf, 0xff, 0x58, 0xff, 0x50, 0x0, 0x1, 0xcf, 0xc1, 0x5, 0x30,
+    0x0, 0x0, 0x1, 0x61, 0x0,
+
+    /* U+F013 "" */
+    0x0, 0x0, 0x0, 0x5, 0x66, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x78, 0x17, 0xef, 0xff,
+    0xfe, 0x71, 0x87, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xc, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x4f, 0xff, 0xff, 0xfd, 0x88, 0xdf, 0xff, 0xff, 0xf4, 0x8,
+    0xff, 0xff, 0xc1, 0x0, 0x1c, 0xff, 0xff, 0x80, 0x0, 0xaf, 0xff, 0x50, 0x0, 0x5, 0xff, 0xfa,
+    0x0, 0x0, 0xbf, 0xff, 0x40, 0x0, 0x4, 0xff, 0xfb, 0x0, 0x1, 0xcf, 0xff, 0x80, 0x0, 0x8,
+    0xff, 0xfc, 0x10, 0x3e, 0xff, 0xff, 0xf7, 0x11, 0x7f, 0xff, 0xff, 0xe3, 0x1e, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe1, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x1, 0xde,
+    0x8e, 0xff, 0xff, 0xff, 0xe8, 0xed, 0x10, 0x0, 0x21, 0x1, 0x9f, 0xff, 0xf9, 0x10, 0x12, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xee, 0xc2, 0x0,
+    0x0, 0x0,
+
+    /* U+F053 "" */
+    0x0, 0x0, 0x0, 0x5, 0x10, 0x0, 0x0, 0x0, 0x9f, 0xc1, 0x0, 0x0, 0x9, 0xff, 0xf3, 0x0,
+    0x0, 0x9f, 0xff, 0x50, 0x0, 0x9, 0xff, 0xf5, 0x0, 0x0, 0x9f, 0xff, 0x50, 0x0, 0x9, 0xff,
+    0xf5, 0x0, 0x0, 0x9f, 0xff, 0x50, 0x0, 0x0, 0xef, 0xfd, 0x10, 0x0, 0x0, 0x3e, 0xff, 0xc1,
+    0x0, 0x0, 0x3, 0xef, 0xfc, 0x10, 0x0, 0x0, 0x3e, 0xff, 0xc1, 0x0, 0x0, 0x3, 0xef, 0xfc,
+    0x10, 0x0, 0x0, 0x3e, 0xff, 0xc1, 0x0, 0x0, 0x3, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x3d, 0x60,
+
+    /* U+F070 "" */
+    0x39, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0x60, 0x0, 0x15, 0x77, 0x64, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0x96, 0xcf, 0xff, 0xff, 0xfe, 0x92, 0x0, 0x0, 0x0, 0x0, 0x1a,
+    0xff, 0xff, 0xe8, 0x43, 0x5b, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf6, 0x0, 0x10,
+    0x6, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x10, 0x4, 0xef, 0xf8, 0x7f, 0xd4, 0x8, 0xff, 0xfb, 0x0,
+    0x0, 0x1d, 0x70, 0x1, 0xbf, 0xfe, 0xff, 0xe2, 0x1e, 0xff, 0xf7, 0x0, 0x9, 0xff, 0xa1, 0x0,
+    0x8f, 0xff, 0xff, 0x80, 0xcf, 0xff, 0xf2, 0x0, 0xcf, 0xff, 0xd2, 0x0, 0x5e, 0xff, 0xf9, 0xb,
+    0xff, 0xff, 0x50, 0x5, 0xff, 0xff, 0x60, 0x0, 0x2c, 0xff, 0xb1, 0xdf, 0xff, 0xc0, 0x0, 0xa,
+    0xff, 0xfc, 0x0, 0x0, 0x1a, 0xff, 0xdf, 0xff, 0xe2, 0x0, 0x0, 0xb, 0xff, 0xf6, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x19, 0xff, 0xf8, 0x10, 0x0, 0x3, 0xdf, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xcb, 0x80, 0x1, 0xbf, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x59, 0xde, 0xfe, 0x70, 0x0, 0x8f, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xe2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0,
+
+    /* U+F0C7 "" */
+    0x29, 0x99, 0x99, 0x99, 0x99, 0x98, 0x10, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
+    0xff, 0xb9, 0x99, 0x99, 0x99, 0xaf, 0xfd, 0x10, 0xff, 0x40, 0x0, 0x0, 0x0, 0xb, 0xff, 0xd1,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf9, 0xff, 0x40, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfb,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfb, 0xff, 0xed, 0xdd, 0xdd, 0xdd, 0xdf, 0xff, 0xfb,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xd7, 0x8e, 0xff, 0xff, 0xfb,
+    0xff, 0xff, 0xfe, 0x10, 0x3, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xef, 0xff, 0xfb,
+    0xff, 0xff, 0xfd, 0x0, 0x2, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xa3, 0x4c, 0xff, 0xff, 0xfb,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x1, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10,
+
+    /* U+F15B "" */
+    0x9b, 0xbb, 0xbb, 0xba, 0x9, 0x10, 0x0, 0xff, 0xff, 0xff, 0xfd, 0xf, 0xb1, 0x0, 0xff, 0xff,
+    0xff, 0xfd, 0xf, 0xfb, 0x10, 0xff, 0xff, 0xff, 0xfd, 0xf, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xfd,
+    0xb, 0xbb, 0xb5, 0xff, 0xff, 0xff, 0xfe, 0x32, 0x22, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x24, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x40,
+
+    /* U+F1EB "" */
+    0x0, 0x0, 0x0, 0x3, 0x58, 0x99, 0x97, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8d, 0xff,
+    0xff, 0xff, 0xff, 0xfb, 0x60, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd5, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xb7, 0x54, 0x34, 0x69, 0xdf, 0xff, 0xfb, 0x10, 0x8f, 0xff,
+    0xe7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4b, 0xff, 0xfd, 0x2b, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xf4, 0x1b, 0x60, 0x0, 0x5, 0x9d, 0xef, 0xdb, 0x72, 0x0, 0x2, 0xb5,
+    0x0, 0x0, 0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xdd, 0xef, 0xff, 0xfd, 0x30, 0x0, 0x0, 0x0, 0xc, 0xff, 0xb5, 0x10, 0x0, 0x28, 0xef,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x1b, 0x60, 0x0, 0x0, 0x0, 0x2, 0xb6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4e, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+F240 "" */
+    0x15, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x20, 0xb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0xff, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdf, 0xf6, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6, 0xff, 0x49,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd, 0xff, 0x8f, 0xf4, 0x9f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf0, 0x2c, 0xf8, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xbf,
+    0x8f, 0xf4, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x8e, 0xf8, 0xff, 0x45, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0xd, 0xff, 0x7f, 0xf8, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0xef, 0xb2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x5, 0xcd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd9, 0x0,
+
+    /* U+F241 "" */
+    0x15, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x20, 0xb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0xff, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdf, 0xf6, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6, 0xff, 0x49,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0xd, 0xff, 0x8f, 0xf4, 0x9f, 0xff, 0xff, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x2c, 0xf8, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0xbf,
+    0x8f, 0xf4, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x8e, 0xf8, 0xff, 0x45, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x50, 0x0, 0xd, 0xff, 0x7f, 0xf8, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0xef, 0xb2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x5, 0xcd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd9, 0x0,
+
+    /* U+F242 "" */
+    0x15, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x20, 0xb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0xff, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdf, 0xf6, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6, 0xff, 0x49,
+    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xd, 0xff, 0x8f, 0xf4, 0x9f, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x2c, 0xf8, 0xff, 0x49, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0x8f, 0xf4, 0x9f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x8e, 0xf8, 0xff, 0x45, 0x88, 0x88,
+    0x88, 0x82, 0x0, 0x0, 0x0, 0xd, 0xff, 0x7f, 0xf8, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0xef, 0xb2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x5, 0xcd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd9, 0x0,
+
+    /* U+F243 "" */
+    0x15, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x20, 0xb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0xff, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdf, 0xf6, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6, 0xff, 0x49,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x8f, 0xf4, 0x9f, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2c, 0xf8, 0xff, 0x49, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0x8f, 0xf4, 0x9f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8e, 0xf8, 0xff, 0x45, 0x88, 0x87,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x7f, 0xf8, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0xef, 0xb2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x5, 0xcd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd9, 0x0,
+
+    /* U+F244 "" */
+    0x15, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x20, 0xb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0xff, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdf, 0xf6, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2c, 0xf8, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8e, 0xf8, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x7f, 0xf8, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0xef, 0xb2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x5, 0xcd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd9, 0x0,
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 77, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 77, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 20, .adv_w = 113, .box_w = 5, .box_h = 6, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 35, .adv_w = 202, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 120, .adv_w = 179, .box_w = 11, .box_h = 18, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 219, .adv_w = 243, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 317, .adv_w = 198, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 395, .adv_w = 60, .box_w = 2, .box_h = 6, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 401, .adv_w = 97, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 446, .adv_w = 97, .box_w = 5, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 491, .adv_w = 115, .box_w = 7, .box_h = 8, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 519, .adv_w = 168, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 560, .adv_w = 65, .box_w = 4, .box_h = 6, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 572, .adv_w = 110, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 577, .adv_w = 65, .box_w = 4, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 583, .adv_w = 101, .box_w = 8, .box_h = 18, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 655, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 733, .adv_w = 107, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 766, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 831, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 896, .adv_w = 193, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 974, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1039, .adv_w = 178, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1111, .adv_w = 172, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1176, .adv_w = 185, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1248, .adv_w = 178, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1320, .adv_w = 65, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1340, .adv_w = 65, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1366, .adv_w = 168, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1407, .adv_w = 168, .box_w = 9, .box_h = 7, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1439, .adv_w = 168, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1480, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1545, .adv_w = 298, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 1698, .adv_w = 211, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1789, .adv_w = 218, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1867, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1952, .adv_w = 238, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2037, .adv_w = 193, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2109, .adv_w = 183, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2174, .adv_w = 222, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2259, .adv_w = 234, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2337, .adv_w = 89, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2357, .adv_w = 148, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2409, .adv_w = 207, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2487, .adv_w = 171, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2552, .adv_w = 275, .box_w = 15, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2650, .adv_w = 234, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2728, .adv_w = 242, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2826, .adv_w = 208, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2898, .adv_w = 242, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3018, .adv_w = 209, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3096, .adv_w = 179, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3168, .adv_w = 169, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3240, .adv_w = 228, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3318, .adv_w = 205, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3403, .adv_w = 324, .box_w = 20, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3533, .adv_w = 194, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3611, .adv_w = 186, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3689, .adv_w = 189, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3767, .adv_w = 96, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 3812, .adv_w = 101, .box_w = 8, .box_h = 18, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 3884, .adv_w = 96, .box_w = 5, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 3929, .adv_w = 168, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 3965, .adv_w = 144, .box_w = 9, .box_h = 1, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3970, .adv_w = 173, .box_w = 5, .box_h = 4, .ofs_x = 2, .ofs_y = 10},
+    {.bitmap_index = 3980, .adv_w = 172, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4030, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4107, .adv_w = 164, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4157, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4234, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4289, .adv_w = 102, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4338, .adv_w = 199, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 4415, .adv_w = 196, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4485, .adv_w = 80, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4506, .adv_w = 82, .box_w = 6, .box_h = 18, .ofs_x = -2, .ofs_y = -4},
+    {.bitmap_index = 4560, .adv_w = 177, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4630, .adv_w = 80, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4651, .adv_w = 304, .box_w = 17, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4736, .adv_w = 196, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4786, .adv_w = 183, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4841, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 4918, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 4995, .adv_w = 118, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5025, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5070, .adv_w = 119, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5112, .adv_w = 195, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5162, .adv_w = 161, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5212, .adv_w = 259, .box_w = 16, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5292, .adv_w = 159, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5342, .adv_w = 161, .box_w = 11, .box_h = 14, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 5419, .adv_w = 150, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5464, .adv_w = 101, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 5509, .adv_w = 86, .box_w = 3, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 5536, .adv_w = 101, .box_w = 6, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 5590, .adv_w = 168, .box_w = 9, .box_h = 4, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 5608, .adv_w = 77, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5608, .adv_w = 77, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 5628, .adv_w = 164, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5703, .adv_w = 186, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5781, .adv_w = 202, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5853, .adv_w = 204, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5938, .adv_w = 86, .box_w = 3, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 5965, .adv_w = 144, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 6033, .adv_w = 173, .box_w = 6, .box_h = 3, .ofs_x = 2, .ofs_y = 11},
+    {.bitmap_index = 6042, .adv_w = 231, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6133, .adv_w = 116, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 6158, .adv_w = 145, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 6194, .adv_w = 168, .box_w = 9, .box_h = 5, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 6217, .adv_w = 110, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 6222, .adv_w = 231, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6313, .adv_w = 173, .box_w = 7, .box_h = 2, .ofs_x = 2, .ofs_y = 11},
+    {.bitmap_index = 6320, .adv_w = 121, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 6345, .adv_w = 168, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6395, .adv_w = 124, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 6427, .adv_w = 124, .box_w = 7, .box_h = 9, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 6459, .adv_w = 173, .box_w = 5, .box_h = 4, .ofs_x = 4, .ofs_y = 10},
+    {.bitmap_index = 6469, .adv_w = 196, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 6539, .adv_w = 187, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 6619, .adv_w = 77, .box_w = 3, .box_h = 4, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 6625, .adv_w = 173, .box_w = 5, .box_h = 5, .ofs_x = 3, .ofs_y = -4},
+    {.bitmap_index = 6638, .adv_w = 124, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 6665, .adv_w = 120, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 6690, .adv_w = 145, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 6726, .adv_w = 298, .box_w = 18, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6843, .adv_w = 298, .box_w = 17, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6954, .adv_w = 298, .box_w = 19, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7078, .adv_w = 165, .box_w = 9, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 7137, .adv_w = 211, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7249, .adv_w = 211, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7361, .adv_w = 211, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7473, .adv_w = 211, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7585, .adv_w = 211, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7697, .adv_w = 211, .box_w = 14, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7823, .adv_w = 302, .box_w = 18, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7940, .adv_w = 208, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 8051, .adv_w = 193, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8139, .adv_w = 193, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8227, .adv_w = 193, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8315, .adv_w = 193, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8403, .adv_w = 89, .box_w = 5, .box_h = 16, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8443, .adv_w = 89, .box_w = 5, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8483, .adv_w = 89, .box_w = 7, .box_h = 16, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8539, .adv_w = 89, .box_w = 6, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8587, .adv_w = 240, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8685, .adv_w = 234, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8781, .adv_w = 242, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8901, .adv_w = 242, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9021, .adv_w = 242, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9141, .adv_w = 242, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9261, .adv_w = 242, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9381, .adv_w = 168, .box_w = 7, .box_h = 7, .ofs_x = 2, .ofs_y = 3},
+    {.bitmap_index = 9406, .adv_w = 242, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 9526, .adv_w = 228, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9622, .adv_w = 228, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9718, .adv_w = 228, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9814, .adv_w = 228, .box_w = 12, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9910, .adv_w = 186, .box_w = 12, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10006, .adv_w = 208, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10078, .adv_w = 195, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 10155, .adv_w = 172, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10225, .adv_w = 172, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10295, .adv_w = 172, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10365, .adv_w = 172, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10435, .adv_w = 172, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10505, .adv_w = 172, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10580, .adv_w = 285, .box_w = 17, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10665, .adv_w = 164, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 10735, .adv_w = 176, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10812, .adv_w = 176, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10889, .adv_w = 176, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10966, .adv_w = 176, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11038, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 11073, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11108, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11143, .adv_w = 80, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11176, .adv_w = 184, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11253, .adv_w = 196, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11323, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11400, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11477, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11554, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11631, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11708, .adv_w = 168, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 11753, .adv_w = 183, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 11825, .adv_w = 195, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11895, .adv_w = 195, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11965, .adv_w = 195, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12035, .adv_w = 195, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12105, .adv_w = 161, .box_w = 11, .box_h = 18, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 12204, .adv_w = 196, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 12303, .adv_w = 161, .box_w = 11, .box_h = 18, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 12402, .adv_w = 144, .box_w = 9, .box_h = 2, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 12411, .adv_w = 288, .box_w = 18, .box_h = 2, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 12429, .adv_w = 65, .box_w = 4, .box_h = 6, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 12441, .adv_w = 65, .box_w = 4, .box_h = 6, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 12453, .adv_w = 120, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 12474, .adv_w = 120, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 8},
+    {.bitmap_index = 12495, .adv_w = 90, .box_w = 4, .box_h = 4, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 12503, .adv_w = 199, .box_w = 12, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12521, .adv_w = 232, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12612, .adv_w = 198, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12697, .adv_w = 288, .box_w = 18, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 12859, .adv_w = 180, .box_w = 10, .box_h = 16, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 12939, .adv_w = 360, .box_w = 23, .box_h = 19, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13158, .adv_w = 252, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 13294, .adv_w = 216, .box_w = 14, .box_h = 19, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 13427, .adv_w = 360, .box_w = 23, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 13623, .adv_w = 360, .box_w = 23, .box_h = 12, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 13761, .adv_w = 360, .box_w = 23, .box_h = 12, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 13899, .adv_w = 360, .box_w = 23, .box_h = 12, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 14037, .adv_w = 360, .box_w = 23, .box_h = 12, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 14175, .adv_w = 360, .box_w = 23, .box_h = 12, .ofs_x = 0, .ofs_y = 1}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_2[] = {
+    0x0, 0x1, 0x5, 0x6, 0x9, 0xa, 0xf, 0x13,
+    0x99, 0xcffa, 0xd000, 0xd040, 0xd05d, 0xd0b4, 0xd148, 0xd1d8,
+    0xd22d, 0xd22e, 0xd22f, 0xd230, 0xd231
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 160, .range_length = 96, .glyph_id_start = 96,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 8211, .range_length = 53810, .glyph_id_start = 192,
+        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 21, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17, 18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27, 28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37, 37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50, 51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58, 58, 59, 58, 60, 41, 0, 0, 9,
+    0, 61, 47, 62, 63, 64, 0, 65, 0, 22, 8, 66, 0, 9, 22, 0,
+    67, 0, 0, 0, 0, 51, 29, 9, 0, 0, 8, 9, 0, 0, 0, 68,
+    23, 23, 23, 23, 23, 23, 26, 25, 26, 26, 26, 26, 29, 29, 29, 29,
+    22, 29, 22, 22, 22, 22, 22, 0, 22, 30, 30, 30, 30, 39, 69, 46,
+    45, 45, 45, 45, 45, 45, 49, 47, 49, 49, 49, 49, 51, 51, 70, 51,
+    71, 45, 46, 46, 46, 46, 46, 9, 46, 51, 51, 51, 51, 58, 46, 58,
+    0, 0, 72, 73, 72, 73, 9, 10, 25, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12, 18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25, 23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29, 29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0, 39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46, 46, 47, 48, 49, 0, 0, 35, 9,
+    0, 50, 39, 51, 52, 53, 0, 54, 0, 23, 8, 9, 9, 9, 23, 0,
+    55, 0, 0, 0, 0, 42, 56, 9, 0, 0, 8, 57, 0, 0, 0, 58,
+    24, 24, 24, 24, 24, 24, 24, 23, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 23, 23, 23, 23, 23, 0, 23, 28, 28, 28, 28, 31, 25, 38,
+    37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 39, 39, 59, 42, 60, 61,
+    62, 42, 39, 39, 39, 39, 39, 9, 39, 45, 45, 45, 45, 46, 38, 46,
+    0, 0, 63, 64, 63, 64, 9, 10, 52, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 1, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 3, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 7, 6, 0, 3, 0, 6, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 13, 0, 8, -6, 0, 0, 6, 0, -16, -17, 2, 14, 6, 5, -12,
+    2, 14, 1, 12, 3, 9, 0, -12, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 17, 2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -6, 6, 0, 6, 13, 0, -12, 0, 0, 0, 0, 0, 0,
+    0, -9, 0, 0, 0, 0, 0, -6, 5, 6, 0, 0, -3, 0, -2, 3,
+    0, -3, 0, -3, -1, -6, 0, 0, 0, 0, -3, 0, 0, -4, -4, 0,
+    0, -3, 0, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3,
+    0, -1, 0, 0, 0, 0, -4, 0, 0, -3, 0, 0, 0, 0, -7, -3,
+    0, -8, 0, -35, 0, 0, -6, -14, 6, 9, 0, 0, -6, 3, 3, 10,
+    6, -5, 6, 0, 0, -16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -11, 0, 0, 3, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -8, 0, 0, 0, 0, 0, 0, 7, -6, -6,
+    -3, -14, 0, -12, -2, 0, 0, -9, 0, 1, 11, 0, -9, -2, -1, 1,
+    0, -5, 0, 0, -2, -21, 0, 3, 0, 9, -8, 0, -6, 0, -12, 3,
+    0, -23, -2, 11, 3, 0, 0, 0, 0, 0, 0, 3, 0, -4, -1, -4,
+    0, -3, 0, 0, 0, 0, -12, -13, 0, -1, 0, 0, 0, 0, -9, -7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 3, 0, 0, -6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0,
+    0, 11, 2, 1, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -11, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 6, 3, 9, -3, 0, 0, 6, -3, -10, -39, 2, 8, 6, 1, -4,
+    0, 10, 0, 9, 0, 9, 0, -27, 0, -3, 9, 0, 10, -3, 6, 3,
+    0, 0, 1, -3, 0, 0, -5, 23, 0, 23, 0, 9, 0, 12, 4, 12,
+    5, 0, 0, 2, 0, 0, 9, 11, 4, -24, 23, 23, 23, -5, 9, 9,
+    0, 0, -5, -11, 0, 0, 0, -3, 1, -2, 0, 2, -5, -4, -6, 2,
+    0, -3, 0, 0, 0, -12, 2, -5, 0, -6, -10, 0, -7, -5, -9, 0,
+    0, -19, 0, 0, 0, 0, 3, 0, 0, 0, 0, 3, 0, -4, -7, -4,
+    -4, 0, 0, 2, -7, 3, 0, -25, -3, 0, 0, 0, 0, 3, 0, 0,
+    1, -16, 3, -18, 0, 0, 0, -10, -2, 0, 29, -3, -4, 3, 3, -3,
+    0, -4, 3, 0, 0, -15, -6, 10, 0, 16, -9, -2, -11, 0, -11, 5,
+    0, -28, 0, 3, 3, 0, -3, 0, 3, 0, 0, -2, -3, -10, 0, -10,
+    0, 1, 0, -3, -9, 0, -18, -37, 1, 3, 0, 0, 0, -3, -5, -5,
+    0, 17, -6, 0, -11, 0, 10, 0, -20, -28, -20, -6, 9, 0, 0, -19,
+    0, 3, -7, 0, -4, 0, -6, -12, 0, -3, 9, 0, 9, 0, 9, 0,
+    0, 7, 9, -35, -19, 0, -19, 2, 1, -19, -19, -8, -19, -9, -17, -9,
+    -19, -19, -3, 0, 12, -6, 14, 0, -14, -22, -19, -19, -19, -14, 14, 15,
+    0, 2, 0, 0, 0, 0, 0, 2, 2, -3, -6, 0, -1, -1, -3, 0,
+    0, -2, 0, 0, 0, -6, 0, -2, 0, -7, -6, 0, -7, -10, -10, -5,
+    0, -6, 0, -6, 0, 0, 0, 0, -2, 0, 0, 3, 0, 2, -3, 2,
+    0, 0, 0, 0, -3, 0, 1, 0, 0, -9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, -2, 0, 0, 0, -2, 3, 3, -1, 0, 0, 0, -5,
+    0, -1, 0, 0, 0, 0, 0, 1, 0, 4, -2, 0, -3, 0, -5, 0,
+    0, -2, 0, 9, 0, 0, -3, 0, 0, 0, 0, 0, -1, 1, -2, 1,
+    -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0,
+    0, -3, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0,
+    -3, -3, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, -3, -3, -3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -4, -2,
+    0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -9, -2, -9, 6, 0, 0, -6, 3, 6, 8, 0, -7, -1, -3, 0,
+    -1, -14, 3, -2, 2, -15, 3, 0, 0, 1, -15, 0, -15, -2, -25, -2,
+    0, -14, 0, 6, 8, 0, 4, 0, 0, 0, 0, 1, 0, -5, -4, -5,
+    0, 0, 3, 3, -3, 6, -9, -5, 0, 3, 0, 0, 0, 4, -7, -3,
+    0, 0, 0, -3, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, -1, 0,
+    -1, -4, 0, 0, 0, 0, 0, 0, 0, -3, -3, 0, -2, -3, -2, 0,
+    0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2,
+    0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -6, 3, 0, 0, -3, 1, 3, 3, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 2, 0, 0, -3, 0, -3, -2, -3, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, -2, 0, 0, 0, 0, -3, -4, -3,
+    0, 0, 0, 3, 0, 6, -5, 0, 0, 0, 0, 0, 0, 2, -3, 0,
+    0, 9, -2, 1, -9, 0, 0, 8, -14, -15, -12, -6, 3, 0, -2, -19,
+    -5, 0, -5, 0, -6, 4, -5, -18, 0, -8, 0, 0, 1, -1, 2, -2,
+    0, 3, 0, -9, -11, 0, -14, -7, -6, -7, -9, -3, -8, -1, -5, -1,
+    -8, -8, -4, -6, 4, -3, 2, 8, -5, -18, -7, -7, -7, -14, 3, 6,
+    0, 1, 0, -3, 0, 0, 0, 2, 0, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, 0, -1, 0, -1, -3, 0, -5, -6, -6, -1,
+    0, -9, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, -2, 1,
+    0, 0, 0, 0, -3, 3, 0, 0, 0, -6, 0, 0, 0, 0, -1, 0,
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, -3, 0, 3, 0, 11, -3, 0, -7, -2, -11, 0,
+    0, -5, 0, 3, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, -3, 2,
+    0, 0, 0, 0, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 0, -5, 0, 0, 3, 0, -14, -9, 0, 0, 0, -4, -14,
+    0, 0, -3, 3, 0, -8, -1, -12, 0, -8, 0, 0, -4, -5, -4, -3,
+    -5, 0, 0, -5, 0, 0, -3, 0, 0, 0, 0, 0, 0, 3, 0, 3,
+    0, -2, 0, 0, -4, 0, 3, 0, 3, -31, 0, 0, 0, -3, 7, 7,
+    0, -5, 0, 0, 0, 0, 3, 0, 2, -6, -6, 0, -3, -3, -3, 0,
+    0, 0, 0, 0, 0, -9, 0, -3, 0, -4, -3, 0, -6, -7, -9, -2,
+    0, -6, 0, -9, 0, 0, 0, 0, 23, 0, 0, 1, 0, 0, -4, 0,
+    0, 0, 0, 0, 0, 0, 3, 0, 0, -6, 0, 0, 0, 0, -3, -4,
+    0, -12, 0, 0, 0, 0, 0, -27, -5, 10, 9, -2, -12, 0, 3, -4,
+    0, -14, -1, -4, 3, -20, -3, 4, 0, 4, -10, -4, -11, -10, -12, 0,
+    0, -17, 0, 16, 0, 0, -1, 0, 0, 0, -1, -1, -3, -8, -10, -8,
+    -1, 3, 0, 0, 0, 0, -27, -23, 3, 6, 0, 0, 0, -1, -10, -10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, -3, -4, 0,
+    0, -6, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -1,
+    0, 0, -1, 0, -6, 0, 0, 6, -1, 4, 0, -6, 3, -2, -1, -7,
+    -3, 0, -4, -3, -2, 0, -4, -5, 0, 0, -2, -1, -2, -5, -3, 0,
+    0, -3, 0, 3, -2, 0, -6, 0, 0, 0, -6, 0, -5, 0, -5, 0,
+    -5, -3, 0, 0, 0, -2, 3, 2, -1, -3, 0, 0, 0, -6, 1, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, -6, 3, 0, -4, 0, -2, -3, -9,
+    -2, -2, -2, -1, -2, -3, -1, 0, 0, 0, 0, 0, -3, -2, -2, 0,
+    0, 0, 0, 3, -2, 0, -2, 0, 0, 0, -2, -3, -2, -3, -3, -3,
+    -3, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0,
+    2, 12, -1, 0, -8, 0, -2, 6, 0, -3, -12, -4, 4, 0, 0, -14,
+    -5, 3, -5, 2, 0, -2, -2, -9, 0, -4, 1, 0, 0, -5, 0, 0,
+    0, 3, 3, -6, -5, 0, -5, -3, -4, -3, -3, 0, -5, 1, -5, 1,
+    -5, -3, 0, 0, 0, -2, 9, 3, -4, -14, -3, 3, 1, -5, 5, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -4, 0, 0, -3, -3, 0,
+    0, 0, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, -6, 0, 0, 0, -10, 0, 2, -6, 6, 1, -2, -14,
+    0, 0, -6, -3, 0, -12, -7, -8, 0, 0, -12, -3, -12, -11, -14, 0,
+    -7, 0, 2, 19, -4, 0, -7, -3, -1, -3, -5, -8, -5, -11, -12, -11,
+    -7, 0, 0, 0, 0, 0, -3, -2, -1, 0, -3, -3, -3, -7, -5, 0,
+    0, 0, -2, 0, 1, 0, 0, -20, -3, 9, 6, -6, -11, 0, 1, -9,
+    0, -14, -2, -3, 6, -26, -4, 1, 0, 0, -19, -3, -15, -3, -21, 0,
+    0, -20, 0, 17, 1, 0, -2, 0, 0, 0, 0, -1, -2, -11, -2, -11,
+    0, 0, 0, 0, 0, 0, -19, -22, 2, 0, 0, 0, 0, -2, -12, -14,
+    0, 0, 0, 0, -9, 0, -3, 0, -1, -8, -14, 0, 0, -1, -4, -9,
+    -3, 0, -2, 0, 0, 0, 0, -13, -3, -10, -9, -2, -5, -7, -3, -5,
+    0, -6, -3, -10, -4, 0, -3, -5, -3, -5, 0, 1, 0, -2, -10, -2,
+    0, 0, 0, 0, 0, 0, 6, 0, 0, -15, -5, -5, -5, -3, 0, 3,
+    0, -5, 0, 0, 0, 0, 3, 0, 2, -6, 12, 0, -3, -3, -3, 0,
+    0, 0, 0, 0, 0, -9, 0, -3, 0, -4, -3, 0, -6, -7, -9, -2,
+    0, -6, 2, 12, 0, 0, 0, 0, 23, 0, 0, 1, 0, 0, -4, 0,
+    0, 0, 0, 0, 0, 0, 3, 0, 0, -6, 0, 0, 0, 0, -3, -4,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -6,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, -3, -3, 0, 0, -6, -3, 0,
+    0, -6, 0, 5, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, -3, 0, 0, 0, 0, 1, 0,
+    6, 2, -3, 0, -9, -5, 0, 9, -10, -9, -6, -6, 12, 5, 3, -25,
+    -2, 6, -3, 0, -3, 3, -3, -10, 0, -3, 3, -4, -2, -9, -2, 0,
+    0, 9, 6, 0, -8, 0, -16, -4, 8, -4, -11, 1, -4, -10, -10, -10,
+    -3, -6, 0, 0, 0, 0, 12, 9, -4, -16, 3, 10, 5, -16, 8, 8,
+    3, 0, -4, 0, -8, 0, 2, 10, -7, -11, -12, -7, 9, 0, 1, -21,
+    -2, 3, -5, -2, -7, 0, -6, -11, -4, -4, -2, 0, 0, -7, -6, -3,
+    0, 9, 7, -3, -16, 0, -16, -4, 0, -10, -17, -1, -9, -5, -10, -5,
+    -8, -9, 0, 0, 0, 0, 8, 6, -4, -21, 5, 10, 5, -16, 5, 9,
+    0, 0, -4, 0, -6, -3, 0, -3, -5, 0, 5, -10, 3, 0, 0, -15,
+    0, -3, -6, -5, -2, -9, -7, -10, -7, 0, -9, -3, -7, -5, -9, -3,
+    0, 0, 1, 14, -5, 0, -9, -3, 0, -3, -6, -7, -8, -8, -11, -8,
+    -4, -3, 0, 0, 0, 0, -6, 0, -2, 1, -3, -3, -3, -9, 0, 2,
+    6, 0, -4, 0, -14, -3, 2, 6, -9, -11, -6, -10, 10, -3, 1, -27,
+    -5, 6, -6, -5, -11, 0, -9, -12, -3, -3, -2, -3, -6, -9, -1, 0,
+    0, 9, 8, -2, -19, 0, -17, -7, 7, -11, -20, -6, -10, -12, -14, -12,
+    -10, -12, 0, 0, 0, -6, 6, 6, -5, -24, 10, 8, 7, -17, 3, 8,
+    0, 0, 0, 0, -3, 0, 0, 3, -3, 6, 2, -5, 6, 0, 0, -9,
+    -1, 0, -1, 0, 1, 1, -2, 0, 0, 0, 0, 0, 0, -3, 0, 0,
+    0, 0, 2, 9, 1, 0, -3, 0, 0, 0, 0, -2, -2, -3, 0, -3,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0,
+    1, 2, 0, 0, 0, 0, 2, 1, -2, 0, 11, 0, 5, 1, 1, -4,
+    0, 6, 0, 0, 0, 2, 0, 0, 0, 0, 6, 0, 7, 1, 8, 0,
+    0, 9, 0, 8, -3, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 4, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -17, 0, -3, 5, 0, 9, -39, 0, 29, 3, -6, -6, 3, 3, -2,
+    1, -14, 0, 0, 14, -17, -6, 9, 0, 9, -6, -3, -12, 6, -6, 0,
+    0, -20, 11, 40, 0, 0, 0, 0, 35, 0, 0, 0, 0, 6, 0, 6,
+    0, 12, 0, 0, 0, 9, -17, -9, 3, 9, 0, 0, 0, 0, -15, -15,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, -5, -3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 6, -8, 0, 0, 1, -3, 0, 3, 37, -6, -2, 9, 8, -8,
+    3, 0, 0, 3, 3, -4, -9, 16, 9, 24, 0, -3, -3, 14, -2, 6,
+    0, -37, 8, 0, -3, 0, -8, 0, 31, 0, 3, -6, -8, -4, 11, 6,
+    7, 3, 5, -2, -3, 8, 0, -20, 3, 0, 0, 0, 0, -8, 0, 0,
+    0, 0, 0, -8, 0, 0, 0, -8, 0, 0, 0, 0, -6, -1, 0, 0,
+    0, -6, 0, -3, 0, -14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -19, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -3, 0, -3,
+    0, 0, 0, 0, 0, 0, -5, -6, 0, 0, 0, 0, 0, 1, -3, -2,
+    0, -4, 0, -8, 0, 0, 0, -5, 3, -3, 0, 0, -8, -3, -7, 0,
+    0, -8, 0, -3, 0, -14, 0, -3, 0, 0, -23, -5, -12, -3, -10, 0,
+    0, -19, 0, -8, -1, 0, 0, 0, 0, 0, 0, 0, 0, -4, -5, -4,
+    -2, 0, 0, 0, 0, 0, -5, -7, 0, -3, 0, 0, 0, 0, -3, -1,
+    0, 0, 0, 0, -6, 0, -6, 4, -3, 6, 0, -2, -7, -2, -5, -5,
+    0, -3, -1, -2, 2, -8, -1, 0, 0, 0, -25, -2, -4, 0, -6, 0,
+    -2, -14, -3, 0, 0, -2, -2, 0, 0, 0, 0, 2, 0, -2, -5, -2,
+    -2, 0, 0, 0, 0, -3, 5, 0, 0, -2, 0, 0, 0, -2, 5, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -6, 0, -2, 0, 0, 0, -6, 3, 0, 0, 0, -8, -3, -6, 0,
+    0, -8, 0, -3, 0, -14, 0, 0, 0, 0, -28, 0, -6, -11, -14, 0,
+    0, -19, 0, -2, -4, 0, 0, 0, 0, 0, 0, 0, 0, -3, -4, -3,
+    -1, 0, 0, 0, 0, 0, -4, -6, 0, -3, 0, 0, 0, 0, -3, -1,
+    1, 0, 0, 5, -4, 0, 9, 14, -3, -3, -9, 3, 14, 5, 6, -8,
+    3, 12, 3, 8, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 18, 14, -5, -3, 0, -2, 23, 12, 23, 0, 0, 0, 3, 0, 3,
+    0, 0, 0, 0, 0, 0, 11, 12, -1, -4, 19, 14, 17, -2, 14, 20,
+    0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, -24, -3, -2, -12, -14, 0,
+    0, -19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, -24, -3, -2, -12, -14, 0,
+    0, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, -7, 3, 0, -3, 2, 5, 3, -9,
+    0, -1, -2, 3, 0, 2, 0, 0, 0, 0, -7, 0, -3, -2, -6, 0,
+    -3, -12, 0, 18, -3, 0, -6, -2, 0, -2, -5, 0, -3, -8, -6, -8,
+    -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -6, 1, 0,
+    0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, -24, -3, -2, -12, -14, 0,
+    0, -19, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -5, 0, -9, -3, -3, 9, -3, -3, -12, 1, -2, 1, -2, -8,
+    1, 6, 1, 2, 1, 2, -7, -12, -3, 0, -11, -5, -8, -12, -11, 0,
+    -5, -6, -3, -4, -2, -2, -3, -2, 0, -2, -1, 4, 0, 4, -2, 4,
+    0, 0, 0, 0, 0, 3, 9, 9, 1, -11, -2, -2, -2, -3, 10, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -3, -3, 0,
+    0, -8, 0, -1, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3,
+    0, 0, 0, 0, 0, 0, -4, -7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, -5, -3, 3, 0, -5, -5, -2, 0, -8,
+    -2, -6, -2, -3, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -19, 0, 9, 0, 0, -5, 0, 0, 0, 0, -4, 0, -3, 0, -3,
+    0, 0, 0, 0, 0, -3, -1, -6, 0, 0, 0, 0, 0, -5, -2, 0,
+    0, 0, -2, 0, -7, 0, 0, 12, -4, -10, -9, 2, 3, 3, -1, -8,
+    2, 4, 2, 9, 2, 10, -2, -8, 0, 0, -12, 0, 0, -9, -8, 0,
+    0, -6, 0, -4, -5, 0, -4, 0, -4, 0, -2, 4, 0, -2, -9, -2,
+    -3, 0, 0, 0, 0, 0, 11, 9, 0, -10, 0, 0, 0, -4, 10, 5,
+    0, 0, -3, 0, -6, 0, 0, 4, -7, 0, 3, -3, 2, 0, 0, -10,
+    0, -2, -1, 0, -3, 3, -2, 0, 0, 0, -12, -3, -6, 0, -9, 0,
+    0, -14, 0, 11, -3, 0, -5, 0, 2, 0, -3, 0, -3, -9, 0, -9,
+    -3, 0, 0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 0, -5, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 3, -4, 1, 0, 0, -3, -2, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -18, 0, 6, 0, 0, -2, 0, 0, 0, 0, 1, 0, -3, -3, -3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 12, 0, -6, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 3, 0, 3, -6, 0, -9, -3, -12, 0,
+    0, -16, 1, 3, 0, 0, 0, 0, 20, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, -3, 0, -11, 0, 0, 7, -9, -1, 3, -11, 5, -3, -3, -10,
+    -4, 2, -10, -6, -9, 0, -4, -13, 0, -6, 0, 0, 0, -3, 3, 0,
+    0, 5, 1, 5, -12, 0, -9, -6, -7, -6, -12, -6, -8, -6, -7, -6,
+    -12, -7, 0, 0, 0, -3, 0, 3, -4, -6, -6, 8, 2, -9, -1, 1,
+    0, 0, 0, 0, 0, 0, 0, 2, 2, -3, 0, 0, 0, -2, 0, 0,
+    0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0,
+    3, 6, 0, 0, 0, 0, 4, 0, -7, -9, -9, -3, 9, 0, 3, -3,
+    0, 8, -3, 0, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 4, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -6, 0, 0, 0, 0, 0, 0, 0, -12, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 6, 0, 0, 0, 0, 5,
+    0, 2, 3, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 3, 3,
+    0, 0, 0, 0, 0, 0, 0, 4, -3, 1, 3, 0, -1, 0, 0, 2,
+    2, 0, 0, 0, 0, -3, 0, 3, 0, 9, -4, 0, -4, -2, -5, 0,
+    0, -16, 0, 3, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 6, 6, 7, 0, 0, 0, 9, 0, -18, -16, 1, 12, 9, 5, -12,
+    2, 12, 0, 11, 0, 6, 3, -27, 0, -3, 12, 0, 8, -6, 6, 0,
+    0, 15, 0, 0, 0, 0, -5, 0, 0, 0, -1, 6, 0, 11, 3, 11,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -18, 0, 0, 0, -5, 0, 0,
+    -1, -10, 0, -17, -5, 0, 0, -24, -12, 1, 12, -14, -12, 0, 0, -12,
+    0, -12, -12, 0, -1, -38, -15, 4, 0, 0, -17, -10, -20, 2, -22, 0,
+    0, -27, 2, 14, -5, 0, -10, -3, 20, -3, -2, -3, -14, -14, 2, -7,
+    0, 0, 2, -5, -14, 1, -17, -25, -3, -7, -3, -3, -3, -10, -7, -6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -7, -9, 0, -6, -7, -6, 0,
+    -3, 0, 0, 0, 0, -9, 0, -9, 0, -12, -7, 0, -3, -9, -9, -5,
+    0, -12, 0, -9, -3, 0, 0, 0, -3, 0, 0, 1, 0, 0, -3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -7, 0, 0, 0, 0, 0, 0,
+    0, 0, -5, 0, 0, 0, 0, 23, 0, 0, 0, 0, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 12, 0, 0, 0, 0, -24, -3, -2, -12, -14, 0,
+    0, -19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3, 0, -5, 0, 2, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, -6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6, 0, 0, -2, 0, 0, 0, 0, 0, 3,
+    1, 0, 3, 12, -3, 0, 0, 9, 0, -5, -15, 0, 11, 3, 5, -11,
+    0, 12, -1, 9, 0, 11, 0, -10, 0, -1, 8, 0, 5, 0, 3, 0,
+    0, 15, 0, 0, -2, 0, -3, 9, 0, 9, 0, 5, 0, 10, 0, 10,
+    0, 1, 0, 0, 0, 3, 0, 11, 0, -9, 9, 9, 9, -3, 8, 8,
+    1, 0, 3, 12, -3, 0, 0, 9, 0, -5, -15, 0, 14, 6, 5, -16,
+    0, 8, 0, 3, 0, 11, 0, -10, 0, -1, 8, 0, 9, 2, 8, 0,
+    0, 15, 0, 0, -3, 0, -8, 0, 0, 0, -5, 1, 0, 5, 0, 5,
+    0, 1, 0, 0, 2, 3, 0, 11, 0, -9, 0, 0, 0, -8, 8, 8
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 73,
+    .right_class_cnt     = 64,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 3,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = LV_FONT_FMT_TXT_PLAIN,
+    .cache = &cache
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t lv_font_montserrat_18 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 21,          /*The maximum line height required by the font*/
+    .base_line = 4,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
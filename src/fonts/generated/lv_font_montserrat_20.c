@@ -0,0 +1,1241 @@
+/*******************************************************************************
+ * Size: 20 px
+ * Bpp: 4
+ * Charset: ascii, 109 glyphs
+ * Generated by tools/fonts/gen_fonts.py from Montserrat-Medium.ttf and FontAwesome5-Solid+Brands+Regular.woff. Do not edit.
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x6f, 0xc6, 0xfb, 0x5f, 0xb5, 0xfa, 0x4f, 0xa3, 0xf9, 0x3f, 0x82, 0xf8, 0x2f, 0x71, 0x94, 0x0,
+    0x1, 0x62, 0x8f, 0xd5, 0xea,
+
+    /* U+0022 "\"" */
+    0xbe, 0x2, 0xf8, 0xbe, 0x1, 0xf8, 0xad, 0x1, 0xf7, 0xad, 0x1, 0xf7, 0xac, 0x0, 0xf7, 0x45,
+    0x0, 0x63,
+
+    /* U+0023 "#" */
+    0x0, 0x0, 0x7e, 0x0, 0x4, 0xf2, 0x0, 0x0, 0x0, 0x9d, 0x0, 0x6, 0xf0, 0x0, 0x0, 0x0,
+    0xbb, 0x0, 0x8, 0xd0, 0x0, 0x5, 0x66, 0xdc, 0x66, 0x6c, 0xd6, 0x63, 0xc, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0x1, 0x12, 0xf6, 0x11, 0x1e, 0x81, 0x10, 0x0, 0x3, 0xf3, 0x0, 0xf, 0x60,
+    0x0, 0x0, 0x5, 0xf1, 0x0, 0x2f, 0x40, 0x0, 0x1, 0x17, 0xe1, 0x11, 0x5f, 0x31, 0x10, 0x7f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x36, 0x6d, 0xc6, 0x66, 0xbe, 0x66, 0x50, 0x0, 0xd, 0x90,
+    0x0, 0xac, 0x0, 0x0, 0x0, 0xe, 0x70, 0x0, 0xba, 0x0, 0x0, 0x0, 0x1f, 0x50, 0x0, 0xd8,
+    0x0, 0x0,
+
+    /* U+0024 "$" */
+    0x0, 0x0, 0x2, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xe1,
+    0x0, 0x0, 0x0, 0x19, 0xef, 0xff, 0xea, 0x30, 0x1, 0xdf, 0xdc, 0xfa, 0xdf, 0xd0, 0x8, 0xfa,
+    0x5, 0xe0, 0x4, 0x50, 0xc, 0xf3, 0x5, 0xe0, 0x0, 0x0, 0xb, 0xf5, 0x5, 0xe0, 0x0, 0x0,
+    0x6, 0xfe, 0x87, 0xe0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf9, 0x51, 0x0, 0x0, 0x2, 0x7c, 0xff,
+    0xfe, 0x40, 0x0, 0x0, 0x5, 0xe5, 0xbf, 0xf2, 0x0, 0x0, 0x5, 0xe0, 0x9, 0xf8, 0x0, 0x0,
+    0x5, 0xe0, 0x6, 0xf8, 0xb, 0x81, 0x5, 0xe0, 0x1c, 0xf5, 0x1d, 0xff, 0xbb, 0xfa, 0xef, 0xa0,
+    0x1, 0x6b, 0xef, 0xfe, 0xc7, 0x0, 0x0, 0x0, 0x5, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x40, 0x0, 0x0,
+
+    /* U+0025 "%" */
+    0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xb1, 0x0, 0x0, 0x1d, 0xa0,
+    0x0, 0xb, 0xc2, 0x2c, 0xb0, 0x0, 0x9, 0xd1, 0x0, 0x2, 0xf4, 0x0, 0x4f, 0x10, 0x4, 0xf4,
+    0x0, 0x0, 0x3f, 0x10, 0x1, 0xf3, 0x1, 0xd9, 0x0, 0x0, 0x3, 0xf2, 0x0, 0x2f, 0x20, 0x9d,
+    0x10, 0x0, 0x0, 0xd, 0x80, 0x8, 0xd0, 0x5f, 0x40, 0x0, 0x0, 0x0, 0x4f, 0xbb, 0xf4, 0x1e,
+    0x80, 0x37, 0x61, 0x0, 0x0, 0x27, 0x72, 0xa, 0xc0, 0x6f, 0xbc, 0xe3, 0x0, 0x0, 0x0, 0x5,
+    0xf3, 0x1e, 0x60, 0xa, 0xb0, 0x0, 0x0, 0x2, 0xe7, 0x5, 0xf0, 0x0, 0x4f, 0x10, 0x0, 0x0,
+    0xbc, 0x0, 0x5e, 0x0, 0x3, 0xf1, 0x0, 0x0, 0x6e, 0x20, 0x3, 0xf1, 0x0, 0x6e, 0x0, 0x0,
+    0x2e, 0x70, 0x0, 0xc, 0xa2, 0x3d, 0x90, 0x0, 0xc, 0xb0, 0x0, 0x0, 0x2b, 0xee, 0x91, 0x0,
+
+    /* U+0026 "&" */
+    0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xfe, 0x90, 0x0, 0x0, 0x0, 0x1e,
+    0xe7, 0x59, 0xf8, 0x0, 0x0, 0x0, 0x5f, 0x80, 0x0, 0xcd, 0x0, 0x0, 0x0, 0x5f, 0x80, 0x1,
+    0xeb, 0x0, 0x0, 0x0, 0x1e, 0xe2, 0x2b, 0xf4, 0x0, 0x0, 0x0, 0x5, 0xfd, 0xee, 0x50, 0x0,
+    0x0, 0x0, 0x4, 0xef, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xc8, 0xfd, 0x20, 0x7, 0x30, 0x7,
+    0xfa, 0x0, 0x6f, 0xd2, 0x1f, 0x90, 0xe, 0xe1, 0x0, 0x6, 0xfd, 0x9f, 0x40, 0x1f, 0xd0, 0x0,
+    0x0, 0x6f, 0xfc, 0x0, 0xe, 0xf4, 0x0, 0x0, 0x3e, 0xfd, 0x20, 0x5, 0xff, 0xa7, 0x8a, 0xfe,
+    0x8f, 0xd2, 0x0, 0x4b, 0xef, 0xed, 0x82, 0x5, 0xc1,
+
+    /* U+0027 "'" */
+    0xbe, 0xbe, 0xad, 0xad, 0xac, 0x45,
+
+    /* U+0028 "(" */
+    0x0, 0xb, 0xb0, 0x6, 0xf7, 0x0, 0xde, 0x10, 0x3f, 0xa0, 0x7, 0xf6, 0x0, 0xaf, 0x30, 0xd,
+    0xf0, 0x0, 0xfd, 0x0, 0x1f, 0xd0, 0x1, 0xfc, 0x0, 0x1f, 0xd0, 0x0, 0xfd, 0x0, 0xd, 0xf0,
+    0x0, 0xaf, 0x30, 0x7, 0xf5, 0x0, 0x3f, 0xa0, 0x0, 0xde, 0x10, 0x6, 0xf7, 0x0, 0xa, 0xa0,
+
+    /* U+0029 ")" */
+    0x2d, 0x90, 0x0, 0xbf, 0x30, 0x4, 0xf9, 0x0, 0xe, 0xe0, 0x0, 0x9f, 0x40, 0x6, 0xf7, 0x0,
+    0x4f, 0xa0, 0x2, 0xfb, 0x0, 0x1f, 0xc0, 0x1, 0xfd, 0x0, 0x1f, 0xc0, 0x2, 0xfb, 0x0, 0x4f,
+    0xa0, 0x6, 0xf7, 0x0, 0x9f, 0x40, 0xe, 0xe0, 0x4, 0xf9, 0x0, 0xbf, 0x20, 0x2b, 0x80, 0x0,
+
+    /* U+002A "*" */
+    0x0, 0x8, 0x80, 0x0, 0x14, 0x9, 0x90, 0x41, 0x5f, 0xaa, 0xaa, 0xf6, 0x3, 0xbf, 0xfb, 0x30,
+    0x6, 0xef, 0xfe, 0x60, 0x6e, 0x79, 0x97, 0xe6, 0x1, 0x9, 0x90, 0x10, 0x0, 0x6, 0x60, 0x0,
+
+    /* U+002B "+" */
+    0x0, 0x0, 0x64, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0xfa, 0x0, 0x0, 0x8c, 0xcc, 0xfe, 0xcc, 0xc4, 0x8c, 0xcc, 0xfe, 0xcc, 0xc4, 0x0, 0x0,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x64,
+    0x0, 0x0,
+
+    /* U+002C "," */
+    0x58, 0x1f, 0xf8, 0xbf, 0x75, 0xf2, 0x9c, 0xa, 0x60,
+
+    /* U+002D "-" */
+    0x45, 0x55, 0x52, 0xdf, 0xff, 0xf8, 0x45, 0x55, 0x53,
+
+    /* U+002E "." */
+    0x58, 0x1f, 0xf8, 0xbe, 0x50,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x0, 0x1d, 0x80, 0x0, 0x0, 0x6, 0xf5, 0x0, 0x0, 0x0, 0xce, 0x0, 0x0, 0x0,
+    0x2f, 0x90, 0x0, 0x0, 0x7, 0xf4, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0,
+    0x0, 0x8, 0xf3, 0x0, 0x0, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x9, 0xf2,
+    0x0, 0x0, 0x0, 0xec, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0xa, 0xf1, 0x0, 0x0, 0x1,
+    0xeb, 0x0, 0x0, 0x0, 0x6f, 0x60, 0x0, 0x0, 0xb, 0xe1, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0,
+    0x0, 0x5d, 0x40, 0x0, 0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xfc, 0x50, 0x0, 0x3, 0xef, 0xda, 0xbf,
+    0xf7, 0x0, 0xd, 0xf7, 0x0, 0x3, 0xef, 0x40, 0x6f, 0xb0, 0x0, 0x0, 0x5f, 0xb0, 0xbf, 0x40,
+    0x0, 0x0, 0xe, 0xf1, 0xef, 0x10, 0x0, 0x0, 0xb, 0xf4, 0xff, 0x0, 0x0, 0x0, 0xa, 0xf5,
+    0xff, 0x0, 0x0, 0x0, 0xa, 0xf5, 0xef, 0x10, 0x0, 0x0, 0xb, 0xf4, 0xbf, 0x40, 0x0, 0x0,
+    0xe, 0xf1, 0x6f, 0xb0, 0x0, 0x0, 0x5f, 0xb0, 0xd, 0xf7, 0x0, 0x3, 0xef, 0x40, 0x3, 0xef,
+    0xda, 0xbf, 0xf7, 0x0, 0x0, 0x29, 0xef, 0xeb, 0x50, 0x0,
+
+    /* U+0031 "1" */
+    0xdf, 0xff, 0xf4, 0x9b, 0xbe, 0xf4, 0x0, 0xa, 0xf4, 0x0, 0xa, 0xf4, 0x0, 0xa, 0xf4, 0x0,
+    0xa, 0xf4, 0x0, 0xa, 0xf4, 0x0, 0xa, 0xf4, 0x0, 0xa, 0xf4, 0x0, 0xa, 0xf4, 0x0, 0xa,
+    0xf4, 0x0, 0xa, 0xf4, 0x0, 0xa, 0xf4, 0x0, 0xa, 0xf4,
+
+    /* U+0032 "2" */
+    0x0, 0x0, 0x12, 0x10, 0x0, 0x0, 0x29, 0xef, 0xff, 0xc5, 0x0, 0x4e, 0xfe, 0xba, 0xcf, 0xf7,
+    0x3, 0xd6, 0x0, 0x0, 0x6f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0xd,
+    0xf2, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x0, 0x0, 0x1, 0xdf, 0x50, 0x0, 0x0, 0x1, 0xdf,
+    0x70, 0x0, 0x0, 0x2, 0xdf, 0x80, 0x0, 0x0, 0x2, 0xdf, 0x70, 0x0, 0x0, 0x2, 0xdf, 0x70,
+    0x0, 0x0, 0x3, 0xef, 0x60, 0x0, 0x0, 0x2, 0xef, 0xeb, 0xbb, 0xbb, 0xb9, 0x4f, 0xff, 0xff,
+    0xff, 0xff, 0xc0,
+
+    /* U+0033 "3" */
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0x3, 0xbb, 0xbb, 0xbb, 0xef, 0xc0, 0x0, 0x0, 0x0, 0x3e, 0xe2,
+    0x0, 0x0, 0x0, 0x1d, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xf7, 0x0, 0x0, 0x0, 0x9, 0xfa, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xfd, 0x70, 0x0, 0x0, 0x7, 0x79, 0xef, 0xb0, 0x0, 0x0, 0x0, 0x1,
+    0xdf, 0x40, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x75, 0xb3, 0x0, 0x0,
+    0x3e, 0xf3, 0x9f, 0xfd, 0xaa, 0xcf, 0xf8, 0x0, 0x5b, 0xef, 0xfe, 0xb5, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x7, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd1, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xee, 0x30, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xfc, 0x0, 0x13, 0x10, 0x0, 0x0, 0x3e, 0xe2, 0x0, 0x6f, 0x70,
+    0x0, 0x1, 0xdf, 0x40, 0x0, 0x6f, 0x70, 0x0, 0xb, 0xf9, 0x22, 0x22, 0x7f, 0x82, 0x20, 0x3f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x28, 0x88, 0x88, 0x88, 0xbf, 0xc8, 0x81, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0x70, 0x0,
+
+    /* U+0035 "5" */
+    0x0, 0xef, 0xff, 0xff, 0xff, 0x0, 0x1f, 0xeb, 0xbb, 0xbb, 0xb0, 0x2, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa6, 0x65, 0x20,
+    0x0, 0x8, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x35, 0x55, 0x68, 0xcf, 0xe2, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0x80, 0x0, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xa2, 0xd5, 0x0, 0x0,
+    0x2d, 0xf6, 0x6f, 0xfe, 0xba, 0xbf, 0xfc, 0x0, 0x3a, 0xdf, 0xff, 0xc7, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x1, 0x21, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xfe, 0x90, 0x1, 0xcf, 0xea, 0x9a, 0xda,
+    0x0, 0xcf, 0xa1, 0x0, 0x0, 0x10, 0x5f, 0xc0, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0x11, 0x47, 0x74, 0x0, 0xf, 0xf4, 0xdf, 0xff, 0xfd, 0x40, 0xff, 0xec, 0x52, 0x49,
+    0xfe, 0x2e, 0xfd, 0x10, 0x0, 0x8, 0xf9, 0xcf, 0x70, 0x0, 0x0, 0x3f, 0xb7, 0xf8, 0x0, 0x0,
+    0x4, 0xfb, 0x1e, 0xe3, 0x0, 0x1, 0xbf, 0x60, 0x5e, 0xfa, 0x79, 0xdf, 0xb0, 0x0, 0x39, 0xdf,
+    0xfd, 0x70, 0x0,
+
+    /* U+0037 "7" */
+    0x6f, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x6f, 0xdb, 0xbb, 0xbb, 0xcf, 0xf1, 0x6f, 0x80, 0x0, 0x0,
+    0x6f, 0xa0, 0x6f, 0x80, 0x0, 0x0, 0xdf, 0x30, 0x14, 0x20, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x60, 0x0,
+    0x0, 0x0, 0x2, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x6,
+    0xfb, 0x0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x0, 0x1, 0x21, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xff, 0xd7, 0x0, 0x0, 0xcf, 0xd9, 0x79,
+    0xef, 0xb0, 0x6, 0xfc, 0x10, 0x0, 0x1d, 0xf4, 0x9, 0xf6, 0x0, 0x0, 0x8, 0xf7, 0x7, 0xf9,
+    0x0, 0x0, 0xa, 0xf5, 0x2, 0xef, 0x72, 0x13, 0x9f, 0xd1, 0x0, 0x3e, 0xff, 0xff, 0xfd, 0x20,
+    0x2, 0xdf, 0xd9, 0x89, 0xdf, 0xc1, 0xb, 0xf7, 0x0, 0x0, 0x9, 0xf9, 0x1f, 0xe0, 0x0, 0x0,
+    0x1, 0xfe, 0x1f, 0xe0, 0x0, 0x0, 0x1, 0xfe, 0xc, 0xf8, 0x0, 0x0, 0x9, 0xfa, 0x3, 0xef,
+    0xc9, 0x79, 0xdf, 0xd2, 0x0, 0x29, 0xdf, 0xff, 0xd9, 0x10,
+
+    /* U+0039 "9" */
+    0x0, 0x0, 0x12, 0x10, 0x0, 0x0, 0x0, 0x4c, 0xff, 0xfd, 0x60, 0x0, 0x6, 0xff, 0xa7, 0x9d,
+    0xf9, 0x0, 0x1e, 0xe3, 0x0, 0x1, 0xbf, 0x50, 0x5f, 0x90, 0x0, 0x0, 0x3f, 0xd0, 0x6f, 0x90,
+    0x0, 0x0, 0x2f, 0xf2, 0x4f, 0xd1, 0x0, 0x0, 0x8f, 0xf4, 0xc, 0xfc, 0x52, 0x39, 0xfe, 0xf5,
+    0x1, 0xbf, 0xff, 0xff, 0x8a, 0xf5, 0x0, 0x3, 0x67, 0x62, 0xb, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xa0, 0x0, 0x10, 0x0, 0x6, 0xff, 0x20, 0x5, 0xeb,
+    0x9a, 0xdf, 0xe5, 0x0, 0x5, 0xdf, 0xfe, 0xd8, 0x20, 0x0,
+
+    /* U+003A ":" */
+    0x6, 0xa2, 0x1f, 0xf8, 0xb, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0x81, 0xf, 0xf8, 0xb, 0xe5,
+
+    /* U+003B ";" */
+    0x6, 0xa2, 0x1f, 0xf8, 0xb, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0x81, 0xf, 0xf8, 0xb, 0xf7, 0x5, 0xf2, 0x9, 0xc0, 0xa, 0x60,
+
+    /* U+003C "<" */
+    0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x4a, 0xf5, 0x0, 0x2, 0x8d, 0xfe, 0x91, 0x5,
+    0xbf, 0xfb, 0x50, 0x0, 0xaf, 0xd7, 0x20, 0x0, 0x0, 0xaf, 0xd7, 0x20, 0x0, 0x0, 0x5, 0xbf,
+    0xfb, 0x50, 0x0, 0x0, 0x2, 0x8d, 0xfe, 0x91, 0x0, 0x0, 0x0, 0x4a, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x22,
+
+    /* U+003D "=" */
+    0x22, 0x22, 0x22, 0x22, 0x21, 0xaf, 0xff, 0xff, 0xff, 0xf5, 0x46, 0x66, 0x66, 0x66, 0x62, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x46, 0x66, 0x66, 0x66, 0x62, 0xaf, 0xff,
+    0xff, 0xff, 0xf5, 0x22, 0x22, 0x22, 0x22, 0x21,
+
+    /* U+003E ">" */
+    0x30, 0x0, 0x0, 0x0, 0x0, 0xae, 0x82, 0x0, 0x0, 0x0, 0x4b, 0xff, 0xb5, 0x10, 0x0, 0x0,
+    0x27, 0xdf, 0xe9, 0x30, 0x0, 0x0, 0x4, 0x9e, 0xf4, 0x0, 0x0, 0x4, 0x9e, 0xf4, 0x0, 0x27,
+    0xdf, 0xe9, 0x30, 0x4b, 0xff, 0xb5, 0x10, 0x0, 0xae, 0x82, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+003F "?" */
+    0x0, 0x0, 0x12, 0x10, 0x0, 0x0, 0x29, 0xef, 0xff, 0xd6, 0x0, 0x4e, 0xfd, 0x99, 0xbf, 0xf7,
+    0x5, 0xd5, 0x0, 0x0, 0x6f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0, 0x0, 0x2f,
+    0xe0, 0x0, 0x0, 0x0, 0x1c, 0xf6, 0x0, 0x0, 0x0, 0x1c, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xf8,
+    0x0, 0x0, 0x0, 0x4, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x49, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x16, 0x20, 0x0, 0x0, 0x0, 0x9, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0x90, 0x0, 0x0,
+
+    /* U+0040 "@" */
+    0x0, 0x0, 0x0, 0x0, 0x12, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x6b, 0xef, 0xff, 0xea,
+    0x50, 0x0, 0x0, 0x0, 0x5, 0xee, 0xa6, 0x43, 0x46, 0xaf, 0xc3, 0x0, 0x0, 0x7, 0xfa, 0x10,
+    0x0, 0x0, 0x0, 0x2b, 0xe4, 0x0, 0x5, 0xf8, 0x0, 0x0, 0x11, 0x0, 0x1, 0x9, 0xe2, 0x1,
+    0xea, 0x0, 0x7, 0xdf, 0xfd, 0x66, 0xf5, 0xc, 0xb0, 0x6f, 0x20, 0xa, 0xfd, 0x87, 0xaf, 0xdf,
+    0x50, 0x4f, 0x3b, 0xc0, 0x5, 0xfb, 0x0, 0x0, 0x4f, 0xf5, 0x0, 0xe7, 0xe8, 0x0, 0xbf, 0x20,
+    0x0, 0x0, 0xaf, 0x50, 0xb, 0x9f, 0x70, 0xd, 0xd0, 0x0, 0x0, 0x6, 0xf5, 0x0, 0xaa, 0xf7,
+    0x0, 0xdd, 0x0, 0x0, 0x0, 0x6f, 0x50, 0xb, 0xae, 0x90, 0xb, 0xf2, 0x0, 0x0, 0xa, 0xf5,
+    0x0, 0xc8, 0xac, 0x0, 0x5f, 0xb1, 0x0, 0x5, 0xff, 0x60, 0x2f, 0x45, 0xf3, 0x0, 0xaf, 0xd8,
+    0x7a, 0xfa, 0xfd, 0x7c, 0xc0, 0xd, 0xc0, 0x0, 0x7c, 0xee, 0xc6, 0x7, 0xee, 0xa2, 0x0, 0x3f,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xd4, 0x0, 0x0, 0x0, 0x11, 0x0,
+    0x0, 0x0, 0x0, 0x2b, 0xfd, 0x97, 0x78, 0xae, 0x70, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8b, 0xdd,
+    0xca, 0x61, 0x0, 0x0, 0x0,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0xdf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xf9, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfa, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0x30, 0x9f, 0x50, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0x3, 0xfc, 0x0, 0x0, 0x0, 0x9, 0xf5,
+    0x0, 0xb, 0xf4, 0x0, 0x0, 0x2, 0xfd, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0, 0x8f, 0x82, 0x22,
+    0x22, 0xdf, 0x20, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x7, 0xfb, 0x88, 0x88, 0x88,
+    0x8e, 0xf1, 0x0, 0xdf, 0x20, 0x0, 0x0, 0x0, 0x8f, 0x80, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0x2,
+    0xfe, 0x1c, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf6,
+
+    /* U+0042 "B" */
+    0xdf, 0xff, 0xff, 0xfe, 0xb5, 0x0, 0xd, 0xfa, 0x99, 0x9a, 0xcf, 0xf9, 0x0, 0xdf, 0x10, 0x0,
+    0x0, 0x3e, 0xf3, 0xd, 0xf1, 0x0, 0x0, 0x0, 0xaf, 0x50, 0xdf, 0x10, 0x0, 0x0, 0xb, 0xf4,
+    0xd, 0xf1, 0x0, 0x0, 0x18, 0xfd, 0x0, 0xdf, 0xee, 0xee, 0xef, 0xfd, 0x20, 0xd, 0xfb, 0xbb,
+    0xbb, 0xce, 0xfc, 0x20, 0xdf, 0x10, 0x0, 0x0, 0x9, 0xfb, 0xd, 0xf1, 0x0, 0x0, 0x0, 0xe,
+    0xf1, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xef, 0x1d, 0xf1, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0xdf, 0xa9,
+    0x99, 0x9a, 0xdf, 0xf5, 0xd, 0xff, 0xff, 0xff, 0xed, 0x93, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x0, 0x12, 0x10, 0x0, 0x0, 0x0, 0x39, 0xef, 0xff, 0xd8, 0x10, 0x0, 0x7f, 0xfe,
+    0xba, 0xbe, 0xfe, 0x30, 0x7f, 0xf7, 0x10, 0x0, 0x18, 0xe4, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x1,
+    0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x20, 0x7, 0xff,
+    0x71, 0x0, 0x1, 0x9e, 0x40, 0x7, 0xff, 0xeb, 0xab, 0xff, 0xe3, 0x0, 0x3, 0x8d, 0xef, 0xec,
+    0x81, 0x0,
+
+    /* U+0044 "D" */
+    0xdf, 0xff, 0xff, 0xed, 0xa4, 0x0, 0x0, 0xdf, 0xbb, 0xbb, 0xce, 0xff, 0xb2, 0x0, 0xdf, 0x10,
+    0x0, 0x0, 0x4c, 0xfd, 0x10, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xbf, 0xa0, 0xdf, 0x10, 0x0, 0x0,
+    0x0, 0x1e, 0xf2, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xa, 0xf6, 0xdf, 0x10, 0x0, 0x0, 0x0, 0x7,
+    0xf8, 0xdf, 0x10, 0x0, 0x0, 0x0, 0x7, 0xf8, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xa, 0xf6, 0xdf,
+    0x10, 0x0, 0x0, 0x0, 0x1e, 0xf2, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xbf, 0xa0, 0xdf, 0x10, 0x0,
+    0x0, 0x4c, 0xfd, 0x10, 0xdf, 0xbb, 0xbb, 0xce, 0xff, 0xb2, 0x0, 0xdf, 0xff, 0xff, 0xed, 0xa4,
+    0x0, 0x0,
+
+    /* U+0045 "E" */
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xd, 0xfb, 0xbb, 0xbb, 0xbb, 0xb0, 0xdf, 0x10, 0x0, 0x0, 0x0,
+    0xd, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xee, 0xee, 0xee, 0xe2, 0xd, 0xfb, 0xbb, 0xbb, 0xbb, 0x10, 0xdf, 0x10, 0x0, 0x0,
+    0x0, 0xd, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xbb, 0xbb, 0xbb, 0xbb, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xf4,
+
+    /* U+0046 "F" */
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xbb, 0xbb, 0xbb, 0xbb, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf,
+    0x10, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x76,
+    0x66, 0x66, 0x61, 0xdf, 0xff, 0xff, 0xff, 0xf2, 0xdf, 0x65, 0x55, 0x55, 0x51, 0xdf, 0x10, 0x0,
+    0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0,
+    0x0, 0xdf, 0x10, 0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x0, 0x0, 0x12, 0x10, 0x0, 0x0, 0x0, 0x39, 0xef, 0xff, 0xd9, 0x20, 0x0, 0x7f, 0xfe,
+    0xba, 0xbe, 0xfe, 0x50, 0x7f, 0xf7, 0x10, 0x0, 0x17, 0xe5, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x1,
+    0x9, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0xff, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xbd, 0xf3, 0x0, 0x0, 0x0, 0x3,
+    0xfb, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x3f, 0xb2, 0xff, 0x40, 0x0, 0x0, 0x3, 0xfb, 0x7, 0xff,
+    0x71, 0x0, 0x0, 0x7f, 0xb0, 0x7, 0xff, 0xeb, 0xab, 0xef, 0xf7, 0x0, 0x2, 0x8c, 0xef, 0xfd,
+    0x93, 0x0,
+
+    /* U+0048 "H" */
+    0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x2d, 0xf1, 0x0, 0x0, 0x0, 0xd, 0xf2, 0xdf, 0x10, 0x0,
+    0x0, 0x0, 0xdf, 0x2d, 0xf1, 0x0, 0x0, 0x0, 0xd, 0xf2, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf,
+    0x2d, 0xf1, 0x0, 0x0, 0x0, 0xd, 0xf2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2d, 0xfc, 0xbb,
+    0xbb, 0xbb, 0xbe, 0xf2, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x2d, 0xf1, 0x0, 0x0, 0x0, 0xd,
+    0xf2, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x2d, 0xf1, 0x0, 0x0, 0x0, 0xd, 0xf2, 0xdf, 0x10,
+    0x0, 0x0, 0x0, 0xdf, 0x2d, 0xf1, 0x0, 0x0, 0x0, 0xd, 0xf2,
+
+    /* U+0049 "I" */
+    0xdf, 0x1d, 0xf1, 0xdf, 0x1d, 0xf1, 0xdf, 0x1d, 0xf1, 0xdf, 0x1d, 0xf1, 0xdf, 0x1d, 0xf1, 0xdf,
+    0x1d, 0xf1, 0xdf, 0x1d, 0xf1,
+
+    /* U+004A "J" */
+    0x0, 0xbf, 0xff, 0xff, 0xf4, 0x0, 0x8b, 0xbb, 0xbe, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0,
+    0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0,
+    0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x0,
+    0xb, 0xf4, 0x0, 0x0, 0x0, 0xc, 0xf3, 0x9, 0xa1, 0x0, 0x4f, 0xe0, 0x1c, 0xfd, 0x9a, 0xff,
+    0x80, 0x1, 0x8d, 0xff, 0xc6, 0x0,
+
+    /* U+004B "K" */
+    0xdf, 0x10, 0x0, 0x0, 0x1b, 0xf8, 0xd, 0xf1, 0x0, 0x0, 0xb, 0xf8, 0x0, 0xdf, 0x10, 0x0,
+    0xb, 0xf9, 0x0, 0xd, 0xf1, 0x0, 0xa, 0xfa, 0x0, 0x0, 0xdf, 0x10, 0xa, 0xfa, 0x0, 0x0,
+    0xd, 0xf1, 0xa, 0xfb, 0x0, 0x0, 0x0, 0xdf, 0x29, 0xff, 0x40, 0x0, 0x0, 0xd, 0xfa, 0xfe,
+    0xfd, 0x10, 0x0, 0x0, 0xdf, 0xfd, 0x2b, 0xfc, 0x0, 0x0, 0xd, 0xfd, 0x20, 0x1c, 0xfa, 0x0,
+    0x0, 0xdf, 0x30, 0x0, 0x2d, 0xf7, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x3e, 0xf5, 0x0, 0xdf, 0x10,
+    0x0, 0x0, 0x4f, 0xe3, 0xd, 0xf1, 0x0, 0x0, 0x0, 0x6f, 0xd1,
+
+    /* U+004C "L" */
+    0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf,
+    0x10, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x10,
+    0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0,
+    0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0xdf, 0xbb, 0xbb, 0xbb,
+    0xb8, 0xdf, 0xff, 0xff, 0xff, 0xfa,
+
+    /* U+004D "M" */
+    0xde, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfd, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xdf,
+    0xf3, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfd, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xdf, 0x9f,
+    0x60, 0x0, 0x0, 0x4f, 0xae, 0xfd, 0xf1, 0xee, 0x10, 0x0, 0xd, 0xe2, 0xef, 0xdf, 0x6, 0xf9,
+    0x0, 0x7, 0xf7, 0xe, 0xfd, 0xf0, 0xc, 0xf3, 0x2, 0xed, 0x0, 0xef, 0xdf, 0x0, 0x3f, 0xc0,
+    0xaf, 0x40, 0xe, 0xfd, 0xf0, 0x0, 0x9f, 0x9f, 0xa0, 0x0, 0xef, 0xdf, 0x0, 0x1, 0xef, 0xe2,
+    0x0, 0xe, 0xfd, 0xf0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0xef, 0xdf, 0x0, 0x0, 0x4, 0x0, 0x0,
+    0xe, 0xfd, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+
+    /* U+004E "N" */
+    0xde, 0x30, 0x0, 0x0, 0x0, 0xdf, 0x2d, 0xfd, 0x10, 0x0, 0x0, 0xd, 0xf2, 0xdf, 0xfb, 0x0,
+    0x0, 0x0, 0xdf, 0x2d, 0xfe, 0xf8, 0x0, 0x0, 0xd, 0xf2, 0xdf, 0x4e, 0xf5, 0x0, 0x0, 0xdf,
+    0x2d, 0xf1, 0x5f, 0xe3, 0x0, 0xd, 0xf2, 0xdf, 0x10, 0x8f, 0xd1, 0x0, 0xdf, 0x2d, 0xf1, 0x0,
+    0xbf, 0xb0, 0xd, 0xf2, 0xdf, 0x10, 0x1, 0xdf, 0x90, 0xdf, 0x2d, 0xf1, 0x0, 0x3, 0xef, 0x6d,
+    0xf2, 0xdf, 0x10, 0x0, 0x5, 0xff, 0xef, 0x2d, 0xf1, 0x0, 0x0, 0x8, 0xff, 0xf2, 0xdf, 0x10,
+    0x0, 0x0, 0xa, 0xff, 0x2d, 0xf1, 0x0, 0x0, 0x0, 0x1d, 0xf2,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x0, 0x12, 0x10, 0x0, 0x0, 0x0, 0x0, 0x39, 0xef, 0xff, 0xd8, 0x20, 0x0, 0x0,
+    0x7f, 0xfe, 0xba, 0xbf, 0xfe, 0x50, 0x0, 0x7f, 0xf7, 0x10, 0x0, 0x18, 0xff, 0x40, 0x2f, 0xf4,
+    0x0, 0x0, 0x0, 0x7, 0xfe, 0x19, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf6, 0xdf, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xaf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfc, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xcd, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x9f, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0x62, 0xff, 0x40, 0x0, 0x0, 0x0, 0x7f, 0xe1, 0x7, 0xff, 0x71, 0x0, 0x1, 0x8f,
+    0xf4, 0x0, 0x7, 0xff, 0xeb, 0xab, 0xff, 0xe5, 0x0, 0x0, 0x2, 0x8c, 0xef, 0xec, 0x71, 0x0,
+    0x0,
+
+    /* U+0050 "P" */
+    0xdf, 0xff, 0xff, 0xec, 0x71, 0x0, 0xdf, 0xbb, 0xbb, 0xcf, 0xfd, 0x20, 0xdf, 0x10, 0x0, 0x1,
+    0xaf, 0xc0, 0xdf, 0x10, 0x0, 0x0, 0xd, 0xf3, 0xdf, 0x10, 0x0, 0x0, 0xa, 0xf5, 0xdf, 0x10,
+    0x0, 0x0, 0xa, 0xf5, 0xdf, 0x10, 0x0, 0x0, 0x1e, 0xf2, 0xdf, 0x10, 0x0, 0x15, 0xdf, 0xa0,
+    0xdf, 0xff, 0xff, 0xff, 0xfa, 0x10, 0xdf, 0xcb, 0xbb, 0xa8, 0x30, 0x0, 0xdf, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x10,
+    0x0, 0x0, 0x0, 0x0,
+
+    /* U+0051 "Q" */
+    0x0, 0x0, 0x0, 0x12, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3, 0x9e, 0xff, 0xfd, 0x82, 0x0, 0x0,
+    0x0, 0x7f, 0xfe, 0xba, 0xbf, 0xfe, 0x50, 0x0, 0x7, 0xff, 0x71, 0x0, 0x1, 0x8f, 0xf4, 0x0,
+    0x2f, 0xf4, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x10, 0x9f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60,
+    0xdf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xc0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xa0,
+    0x8f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x2f, 0xf4, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x10,
+    0x6, 0xff, 0x71, 0x0, 0x1, 0x8f, 0xf4, 0x0, 0x0, 0x6f, 0xfe, 0xba, 0xbf, 0xfe, 0x50, 0x0,
+    0x0, 0x2, 0x8d, 0xef, 0xfd, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfd, 0x40, 0x3, 0xb1,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0xdf, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8b, 0xb8, 0x10,
+
+    /* U+0052 "R" */
+    0xdf, 0xff, 0xff, 0xec, 0x71, 0x0, 0xdf, 0xbb, 0xbb, 0xcf, 0xfd, 0x20, 0xdf, 0x10, 0x0, 0x1,
+    0xaf, 0xc0, 0xdf, 0x10, 0x0, 0x0, 0xd, 0xf3, 0xdf, 0x10, 0x0, 0x0, 0xa, 0xf5, 0xdf, 0x10,
+    0x0, 0x0, 0xa, 0xf5, 0xdf, 0x10, 0x0, 0x0, 0x1e, 0xf2, 0xdf, 0x10, 0x0, 0x15, 0xdf, 0xa0,
+    0xdf, 0xee, 0xef, 0xff, 0xfa, 0x0, 0xdf, 0xbb, 0xbb, 0xdf, 0x90, 0x0, 0xdf, 0x10, 0x0, 0x1e,
+    0xf3, 0x0, 0xdf, 0x10, 0x0, 0x4, 0xfd, 0x10, 0xdf, 0x10, 0x0, 0x0, 0x9f, 0x90, 0xdf, 0x10,
+    0x0, 0x0, 0x1d, 0xf4,
+
+    /* U+0053 "S" */
+    0x0, 0x0, 0x1, 0x21, 0x0, 0x0, 0x0, 0x18, 0xef, 0xff, 0xea, 0x30, 0x1, 0xdf, 0xd9, 0x89,
+    0xdf, 0xd0, 0x8, 0xfa, 0x0, 0x0, 0x3, 0x50, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xd9, 0x51, 0x0,
+    0x0, 0x2, 0x7b, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x14, 0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x6, 0xf8, 0xb, 0x81, 0x0, 0x0, 0x1c, 0xf5, 0x1d, 0xff,
+    0xb9, 0x8a, 0xef, 0xa0, 0x1, 0x6b, 0xef, 0xfe, 0xc7, 0x0,
+
+    /* U+0054 "T" */
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xab, 0xbb, 0xcf, 0xeb, 0xbb, 0xb7, 0x0, 0x0, 0x2f, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xd0, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0xff, 0x0, 0x0, 0x0, 0x2, 0xfc, 0xff, 0x0, 0x0, 0x0, 0x2, 0xfc, 0xff, 0x0, 0x0, 0x0,
+    0x2, 0xfc, 0xff, 0x0, 0x0, 0x0, 0x2, 0xfc, 0xff, 0x0, 0x0, 0x0, 0x2, 0xfc, 0xff, 0x0,
+    0x0, 0x0, 0x2, 0xfc, 0xff, 0x0, 0x0, 0x0, 0x2, 0xfc, 0xff, 0x0, 0x0, 0x0, 0x2, 0xfc,
+    0xff, 0x10, 0x0, 0x0, 0x3, 0xfc, 0xdf, 0x30, 0x0, 0x0, 0x5, 0xfa, 0x9f, 0x80, 0x0, 0x0,
+    0xa, 0xf6, 0x3f, 0xf5, 0x0, 0x0, 0x7f, 0xe1, 0x7, 0xff, 0xda, 0xad, 0xfe, 0x40, 0x0, 0x3a,
+    0xef, 0xfd, 0x92, 0x0,
+
+    /* U+0056 "V" */
+    0xcf, 0x50, 0x0, 0x0, 0x0, 0x1, 0xee, 0x15, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x90, 0xd,
+    0xf4, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x4, 0xfb, 0x0, 0x1, 0xef,
+    0x20, 0x0, 0x0, 0xbf, 0x40, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0, 0x2f, 0xe1,
+    0x0, 0x9, 0xf6, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x1, 0xfe, 0x10, 0x0, 0x0, 0x4, 0xfd, 0x0,
+    0x7f, 0x80, 0x0, 0x0, 0x0, 0xd, 0xf5, 0xe, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xb6, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xdf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0, 0x0,
+
+    /* U+0057 "W" */
+    0x3f, 0xd0, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x3, 0xfb, 0xd, 0xf3, 0x0, 0x0, 0x2,
+    0xff, 0xb0, 0x0, 0x0, 0x8, 0xf6, 0x8, 0xf8, 0x0, 0x0, 0x7, 0xff, 0xf2, 0x0, 0x0, 0xd,
+    0xf1, 0x3, 0xfd, 0x0, 0x0, 0xc, 0xf8, 0xf7, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0xdf, 0x30, 0x0,
+    0x2f, 0xb2, 0xfc, 0x0, 0x0, 0x8f, 0x60, 0x0, 0x8f, 0x80, 0x0, 0x7f, 0x50, 0xcf, 0x20, 0x0,
+    0xdf, 0x10, 0x0, 0x3f, 0xd0, 0x0, 0xcf, 0x10, 0x7f, 0x70, 0x3, 0xfb, 0x0, 0x0, 0xd, 0xf3,
+    0x3, 0xfa, 0x0, 0x2f, 0xc0, 0x8, 0xf6, 0x0, 0x0, 0x8, 0xf8, 0x8, 0xf5, 0x0, 0xc, 0xf2,
+    0xd, 0xf1, 0x0, 0x0, 0x3, 0xfd, 0xd, 0xe1, 0x0, 0x7, 0xf7, 0x3f, 0xb0, 0x0, 0x0, 0x0,
+    0xdf, 0x6f, 0xa0, 0x0, 0x2, 0xfc, 0x8f, 0x60, 0x0, 0x0, 0x0, 0x8f, 0xef, 0x50, 0x0, 0x0,
+    0xbf, 0xef, 0x10, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xf9, 0x0, 0x0, 0x0, 0x1f, 0xf6, 0x0, 0x0,
+
+    /* U+0058 "X" */
+    0x2e, 0xf4, 0x0, 0x0, 0x0, 0xaf, 0x70, 0x5f, 0xd1, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x9f, 0xa0,
+    0x0, 0x3f, 0xe1, 0x0, 0x1, 0xdf, 0x60, 0x1c, 0xf4, 0x0, 0x0, 0x3, 0xfe, 0x39, 0xf8, 0x0,
+    0x0, 0x0, 0x7, 0xfd, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x20, 0x0, 0x0, 0x0, 0x1,
+    0xdf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x9e, 0xf3, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x6f, 0xd1,
+    0x0, 0x0, 0x3f, 0xe2, 0x0, 0xaf, 0xa0, 0x0, 0x1d, 0xf5, 0x0, 0x1, 0xdf, 0x60, 0xa, 0xfa,
+    0x0, 0x0, 0x3, 0xfe, 0x26, 0xfd, 0x10, 0x0, 0x0, 0x7, 0xfc,
+
+    /* U+0059 "Y" */
+    0xcf, 0x50, 0x0, 0x0, 0x0, 0x4f, 0xb3, 0xfe, 0x10, 0x0, 0x0, 0xd, 0xf2, 0x8, 0xf9, 0x0,
+    0x0, 0x7, 0xf8, 0x0, 0x1d, 0xf3, 0x0, 0x2, 0xed, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0xbf, 0x40,
+    0x0, 0x0, 0xbf, 0x60, 0x5f, 0xa0, 0x0, 0x0, 0x2, 0xfe, 0x2d, 0xe2, 0x0, 0x0, 0x0, 0x8,
+    0xfe, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x70, 0x0, 0x0,
+
+    /* U+005A "Z" */
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xbb, 0xbb, 0xbb, 0xbb, 0xdf, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x1d, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xb, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x3, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x1,
+    0xdf, 0x50, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfe,
+    0xbb, 0xbb, 0xbb, 0xbb, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
+
+    /* U+005B "[" */
+    0xbd, 0xdd, 0x4d, 0xfb, 0xb3, 0xdf, 0x0, 0xd, 0xf0, 0x0, 0xdf, 0x0, 0xd, 0xf0, 0x0, 0xdf,
+    0x0, 0xd, 0xf0, 0x0, 0xdf, 0x0, 0xd, 0xf0, 0x0, 0xdf, 0x0, 0xd, 0xf0, 0x0, 0xdf, 0x0,
+    0xd, 0xf0, 0x0, 0xdf, 0x0, 0xd, 0xf0, 0x0, 0xdf, 0x0, 0xd, 0xfc, 0xc3, 0xab, 0xbb, 0x30,
+
+    /* U+005C "\\" */
+    0x8d, 0x20, 0x0, 0x0, 0x4, 0xf7, 0x0, 0x0, 0x0, 0xe, 0xc0, 0x0, 0x0, 0x0, 0x9f, 0x20,
+    0x0, 0x0, 0x3, 0xf8, 0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x0, 0x0, 0x8f, 0x30, 0x0, 0x0,
+    0x3, 0xf9, 0x0, 0x0, 0x0, 0xc, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x0, 0x2, 0xf9,
+    0x0, 0x0, 0x0, 0xb, 0xe1, 0x0, 0x0, 0x0, 0x6f, 0x50, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x0,
+    0x0, 0xb, 0xf1, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x1, 0xeb, 0x0, 0x0, 0x0, 0xa,
+    0xf2, 0x0, 0x0, 0x0, 0x4d, 0x60,
+
+    /* U+005D "]" */
+    0x8d, 0xdd, 0x77, 0xbd, 0xf8, 0x0, 0x5f, 0x80, 0x5, 0xf8, 0x0, 0x5f, 0x80, 0x5, 0xf8, 0x0,
+    0x5f, 0x80, 0x5, 0xf8, 0x0, 0x5f, 0x80, 0x5, 0xf8, 0x0, 0x5f, 0x80, 0x5, 0xf8, 0x0, 0x5f,
+    0x80, 0x5, 0xf8, 0x0, 0x5f, 0x80, 0x5, 0xf8, 0x0, 0x5f, 0x88, 0xcd, 0xf8, 0x7b, 0xbb, 0x60,
+
+    /* U+005E "^" */
+    0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0, 0x0, 0xa, 0xdf, 0x50, 0x0, 0x2, 0xf6,
+    0xbb, 0x0, 0x0, 0x8e, 0x15, 0xf3, 0x0, 0xe, 0x80, 0xd, 0x90, 0x6, 0xf2, 0x0, 0x7e, 0x10,
+    0xcb, 0x0, 0x1, 0xf7, 0x3f, 0x50, 0x0, 0xa, 0xd1, 0x20, 0x0, 0x0, 0x12,
+
+    /* U+005F "_" */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0x22, 0x22, 0x22, 0x22,
+
+    /* U+0060 "`" */
+    0x3b, 0xb2, 0x0, 0x3, 0xde, 0x30, 0x0, 0x1a, 0xc2,
+
+    /* U+0061 "a" */
+    0x1, 0x69, 0xa9, 0x61, 0x0, 0x5e, 0xff, 0xff, 0xfe, 0x30, 0x4c, 0x51, 0x2, 0xaf, 0xc0, 0x0,
+    0x0, 0x0, 0xd, 0xf1, 0x0, 0x1, 0x12, 0x2b, 0xf3, 0x8, 0xdf, 0xff, 0xff, 0xf3, 0x9f, 0xb6,
+    0x44, 0x4c, 0xf3, 0xef, 0x10, 0x0, 0xb, 0xf3, 0xef, 0x10, 0x0, 0x3f, 0xf3, 0x8f, 0xd7, 0x69,
+    0xee, 0xf3, 0x7, 0xdf, 0xed, 0x79, 0xf3,
+
+    /* U+0062 "b" */
+    0x2d, 0x90, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x59, 0xa9, 0x40, 0x0, 0x3f, 0xcb,
+    0xff, 0xff, 0xfc, 0x20, 0x3f, 0xff, 0x71, 0x3, 0xbf, 0xc0, 0x3f, 0xf6, 0x0, 0x0, 0xc, 0xf5,
+    0x3f, 0xe0, 0x0, 0x0, 0x5, 0xfa, 0x3f, 0xb0, 0x0, 0x0, 0x3, 0xfc, 0x3f, 0xc0, 0x0, 0x0,
+    0x4, 0xfb, 0x3f, 0xf2, 0x0, 0x0, 0x9, 0xf8, 0x3f, 0xfc, 0x10, 0x0, 0x5f, 0xe2, 0x3f, 0xce,
+    0xea, 0x9c, 0xff, 0x50, 0x3f, 0xa3, 0xae, 0xfd, 0xa3, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x1, 0x69, 0xa9, 0x50, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xb1, 0x2, 0xef, 0x82, 0x2, 0xaf,
+    0x70, 0xaf, 0x70, 0x0, 0x0, 0x40, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x2, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0x0, 0x0, 0x0, 0x6, 0xfd, 0x20, 0x0,
+    0x4d, 0x40, 0x9, 0xff, 0xa9, 0xbf, 0xf4, 0x0, 0x5, 0xbe, 0xfe, 0xa3, 0x0,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xda, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x1, 0x69, 0xa8, 0x21, 0xfc, 0x0, 0x5e,
+    0xff, 0xff, 0xf8, 0xfc, 0x3, 0xff, 0x82, 0x3, 0xaf, 0xfc, 0xb, 0xf7, 0x0, 0x0, 0xb, 0xfc,
+    0xf, 0xe0, 0x0, 0x0, 0x4, 0xfc, 0x2f, 0xc0, 0x0, 0x0, 0x2, 0xfc, 0x1f, 0xd0, 0x0, 0x0,
+    0x3, 0xfc, 0xd, 0xf3, 0x0, 0x0, 0x8, 0xfc, 0x7, 0xfd, 0x20, 0x0, 0x4f, 0xfc, 0x0, 0xaf,
+    0xfa, 0x9c, 0xfc, 0xfc, 0x0, 0x6, 0xce, 0xfd, 0x81, 0xfc,
+
+    /* U+0065 "e" */
+    0x0, 0x1, 0x69, 0xa8, 0x20, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xf8, 0x0, 0x3, 0xfe, 0x61, 0x3,
+    0xcf, 0x60, 0xa, 0xf5, 0x0, 0x0, 0x1e, 0xe0, 0xf, 0xd1, 0x11, 0x11, 0x19, 0xf4, 0x2f, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x1f, 0xd5, 0x55, 0x55, 0x55, 0x52, 0xd, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xfc, 0x20, 0x0, 0x19, 0x10, 0x0, 0x9f, 0xfb, 0x9a, 0xef, 0x70, 0x0, 0x5, 0xbe, 0xfe,
+    0xc5, 0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x6, 0xce, 0xc6, 0x0, 0x5f, 0xea, 0xc6, 0x0, 0xcf, 0x30, 0x0, 0x0, 0xdf, 0x0, 0x0,
+    0x69, 0xef, 0x99, 0x91, 0xaf, 0xff, 0xff, 0xf1, 0x0, 0xdf, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0,
+    0x0, 0xdf, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0,
+    0x0, 0xdf, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x1, 0x69, 0xa8, 0x30, 0x89, 0x0, 0x5e, 0xff, 0xff, 0xf9, 0xde, 0x4, 0xff, 0x72, 0x2,
+    0x8f, 0xfe, 0xc, 0xf5, 0x0, 0x0, 0x8, 0xfe, 0x1f, 0xe0, 0x0, 0x0, 0x1, 0xfe, 0x2f, 0xc0,
+    0x0, 0x0, 0x0, 0xee, 0xf, 0xe0, 0x0, 0x0, 0x2, 0xfe, 0xb, 0xf7, 0x0, 0x0, 0x9, 0xfe,
+    0x3, 0xef, 0x94, 0x24, 0xbf, 0xfe, 0x0, 0x3d, 0xff, 0xff, 0xe6, 0xee, 0x0, 0x0, 0x47, 0x86,
+    0x11, 0xfd, 0x0, 0x10, 0x0, 0x0, 0x5, 0xfa, 0x2, 0xe7, 0x10, 0x0, 0x4e, 0xf5, 0x4, 0xef,
+    0xfd, 0xce, 0xff, 0x80, 0x0, 0x16, 0xac, 0xdc, 0x94, 0x0,
+
+    /* U+0068 "h" */
+    0x2d, 0x90, 0x0, 0x0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0,
+    0x3, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x59, 0xa9, 0x40, 0x3, 0xfc, 0xcf, 0xff, 0xff,
+    0xa0, 0x3f, 0xfe, 0x61, 0x15, 0xef, 0x63, 0xff, 0x40, 0x0, 0x6, 0xfb, 0x3f, 0xd0, 0x0, 0x0,
+    0x1f, 0xd3, 0xfb, 0x0, 0x0, 0x1, 0xfd, 0x3f, 0xb0, 0x0, 0x0, 0x1f, 0xd3, 0xfb, 0x0, 0x0,
+    0x1, 0xfd, 0x3f, 0xb0, 0x0, 0x0, 0x1f, 0xd3, 0xfb, 0x0, 0x0, 0x1, 0xfd, 0x3f, 0xb0, 0x0,
+    0x0, 0x1f, 0xd0,
+
+    /* U+0069 "i" */
+    0x1, 0x4, 0xfd, 0x6f, 0xe0, 0x42, 0x0, 0x2, 0x97, 0x3f, 0xb3, 0xfb, 0x3f, 0xb3, 0xfb, 0x3f,
+    0xb3, 0xfb, 0x3f, 0xb3, 0xfb, 0x3f, 0xb3, 0xfb,
+
+    /* U+006A "j" */
+    0x0, 0x0, 0x11, 0x0, 0x0, 0x3f, 0xd1, 0x0, 0x5, 0xff, 0x10, 0x0, 0x4, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x19, 0x80, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x1, 0xfd, 0x0,
+    0x0, 0x1f, 0xd0, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x1f,
+    0xd0, 0x0, 0x1, 0xfd, 0x0, 0x0, 0x1f, 0xd0, 0x0, 0x2, 0xfc, 0x1, 0x0, 0x5f, 0xa0, 0x8d,
+    0xcf, 0xf4, 0x6, 0xbd, 0xb4, 0x0,
+
+    /* U+006B "k" */
+    0x2d, 0x90, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x79, 0x50, 0x3f, 0xb0,
+    0x0, 0xa, 0xfa, 0x0, 0x3f, 0xb0, 0x1, 0xbf, 0xa0, 0x0, 0x3f, 0xb0, 0x1c, 0xfa, 0x0, 0x0,
+    0x3f, 0xb2, 0xdf, 0xa0, 0x0, 0x0, 0x3f, 0xdd, 0xff, 0xd1, 0x0, 0x0, 0x3f, 0xff, 0x7a, 0xfb,
+    0x0, 0x0, 0x3f, 0xf6, 0x1, 0xdf, 0x80, 0x0, 0x3f, 0xb0, 0x0, 0x2e, 0xf5, 0x0, 0x3f, 0xb0,
+    0x0, 0x4, 0xfe, 0x20, 0x3f, 0xb0, 0x0, 0x0, 0x7f, 0xd1,
+
+    /* U+006C "l" */
+    0x2d, 0x93, 0xfb, 0x3f, 0xb3, 0xfb, 0x3f, 0xb3, 0xfb, 0x3f, 0xb3, 0xfb, 0x3f, 0xb3, 0xfb, 0x3f,
+    0xb3, 0xfb, 0x3f, 0xb3, 0xfb, 0x3f, 0xb0,
+
+    /* U+006D "m" */
+    0x29, 0x60, 0x69, 0xa8, 0x30, 0x2, 0x7a, 0xa7, 0x20, 0x3, 0xfb, 0xcf, 0xff, 0xff, 0x65, 0xef,
+    0xff, 0xfe, 0x40, 0x3f, 0xfe, 0x51, 0x27, 0xff, 0xfd, 0x41, 0x29, 0xfe, 0x3, 0xff, 0x30, 0x0,
+    0xa, 0xfe, 0x20, 0x0, 0xc, 0xf4, 0x3f, 0xd0, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x8f, 0x63,
+    0xfb, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x8, 0xf6, 0x3f, 0xb0, 0x0, 0x0, 0x5f, 0x90, 0x0,
+    0x0, 0x8f, 0x63, 0xfb, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x8, 0xf6, 0x3f, 0xb0, 0x0, 0x0,
+    0x5f, 0x90, 0x0, 0x0, 0x8f, 0x63, 0xfb, 0x0, 0x0, 0x5, 0xf9, 0x0, 0x0, 0x8, 0xf6, 0x3f,
+    0xb0, 0x0, 0x0, 0x5f, 0x90, 0x0, 0x0, 0x8f, 0x60,
+
+    /* U+006E "n" */
+    0x29, 0x60, 0x59, 0xa9, 0x40, 0x3, 0xfb, 0xcf, 0xff, 0xff, 0xa0, 0x3f, 0xfe, 0x61, 0x15, 0xef,
+    0x63, 0xff, 0x40, 0x0, 0x6, 0xfb, 0x3f, 0xd0, 0x0, 0x0, 0x1f, 0xd3, 0xfb, 0x0, 0x0, 0x1,
+    0xfd, 0x3f, 0xb0, 0x0, 0x0, 0x1f, 0xd3, 0xfb, 0x0, 0x0, 0x1, 0xfd, 0x3f, 0xb0, 0x0, 0x0,
+    0x1f, 0xd3, 0xfb, 0x0, 0x0, 0x1, 0xfd, 0x3f, 0xb0, 0x0, 0x0, 0x1f, 0xd0,
+
+    /* U+006F "o" */
+    0x0, 0x1, 0x69, 0xa8, 0x40, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xfb, 0x20, 0x3, 0xef, 0x82, 0x3,
+    0xaf, 0xc0, 0xa, 0xf7, 0x0, 0x0, 0xb, 0xf6, 0xf, 0xe0, 0x0, 0x0, 0x4, 0xfb, 0x2f, 0xc0,
+    0x0, 0x0, 0x2, 0xfc, 0x1f, 0xd0, 0x0, 0x0, 0x3, 0xfb, 0xd, 0xf3, 0x0, 0x0, 0x8, 0xf8,
+    0x6, 0xfd, 0x20, 0x0, 0x4f, 0xe2, 0x0, 0x9f, 0xfa, 0x9b, 0xff, 0x50, 0x0, 0x5, 0xbe, 0xfd,
+    0xa3, 0x0,
+
+    /* U+0070 "p" */
+    0x29, 0x60, 0x59, 0xa9, 0x40, 0x0, 0x3f, 0xab, 0xff, 0xff, 0xfc, 0x20, 0x3f, 0xff, 0x71, 0x3,
+    0xbf, 0xc0, 0x3f, 0xf6, 0x0, 0x0, 0xc, 0xf5, 0x3f, 0xe0, 0x0, 0x0, 0x5, 0xfa, 0x3f, 0xb0,
+    0x0, 0x0, 0x3, 0xfc, 0x3f, 0xc0, 0x0, 0x0, 0x4, 0xfb, 0x3f, 0xf2, 0x0, 0x0, 0x9, 0xf8,
+    0x3f, 0xfc, 0x10, 0x0, 0x5f, 0xe2, 0x3f, 0xde, 0xea, 0x9c, 0xff, 0x50, 0x3f, 0xb3, 0xae, 0xfd,
+    0xa3, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x2b, 0x80, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0071 "q" */
+    0x0, 0x1, 0x69, 0xa8, 0x20, 0x97, 0x0, 0x5e, 0xff, 0xff, 0xf7, 0xfc, 0x3, 0xff, 0x82, 0x3,
+    0xbf, 0xfc, 0xb, 0xf7, 0x0, 0x0, 0xb, 0xfc, 0xf, 0xe0, 0x0, 0x0, 0x4, 0xfc, 0x2f, 0xc0,
+    0x0, 0x0, 0x2, 0xfc, 0x1f, 0xd0, 0x0, 0x0, 0x3, 0xfc, 0xd, 0xf3, 0x0, 0x0, 0x8, 0xfc,
+    0x7, 0xfd, 0x20, 0x0, 0x4f, 0xfc, 0x0, 0xaf, 0xfa, 0x9c, 0xfc, 0xfc, 0x0, 0x6, 0xce, 0xfd,
+    0x82, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xb9,
+
+    /* U+0072 "r" */
+    0x29, 0x60, 0x59, 0x53, 0xfa, 0xbf, 0xf8, 0x3f, 0xff, 0x73, 0x13, 0xff, 0x50, 0x0, 0x3f, 0xe0,
+    0x0, 0x3, 0xfb, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x3, 0xfb, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x3,
+    0xfb, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x27, 0xaa, 0x96, 0x10, 0x5, 0xff, 0xff, 0xff, 0xd0, 0x1e, 0xe5, 0x0, 0x26, 0x50, 0x2f,
+    0xc0, 0x0, 0x0, 0x0, 0x1e, 0xf9, 0x30, 0x0, 0x0, 0x4, 0xef, 0xff, 0xc8, 0x10, 0x0, 0x14,
+    0x7a, 0xef, 0xd1, 0x0, 0x0, 0x0, 0xa, 0xf6, 0x6, 0x10, 0x0, 0xa, 0xf5, 0x5f, 0xeb, 0x99,
+    0xcf, 0xd1, 0x7, 0xce, 0xfe, 0xd9, 0x20,
+
+    /* U+0074 "t" */
+    0x0, 0xce, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x69, 0xef, 0x99, 0x91, 0xaf, 0xff, 0xff, 0xf1,
+    0x0, 0xdf, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0,
+    0x0, 0xdf, 0x0, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x0, 0xcf, 0x30, 0x0, 0x0, 0x8f, 0xd8, 0xa6,
+    0x0, 0x8, 0xdf, 0xe7,
+
+    /* U+0075 "u" */
+    0x39, 0x60, 0x0, 0x0, 0x29, 0x64, 0xfa, 0x0, 0x0, 0x3, 0xfb, 0x4f, 0xa0, 0x0, 0x0, 0x3f,
+    0xb4, 0xfa, 0x0, 0x0, 0x3, 0xfb, 0x4f, 0xa0, 0x0, 0x0, 0x3f, 0xb4, 0xfa, 0x0, 0x0, 0x3,
+    0xfb, 0x4f, 0xa0, 0x0, 0x0, 0x4f, 0xb3, 0xfc, 0x0, 0x0, 0x8, 0xfb, 0xe, 0xf5, 0x0, 0x3,
+    0xef, 0xb0, 0x6f, 0xfb, 0x9b, 0xfd, 0xfb, 0x0, 0x5b, 0xef, 0xd8, 0x3f, 0xb0,
+
+    /* U+0076 "v" */
+    0x89, 0x10, 0x0, 0x0, 0x7, 0x91, 0x8f, 0x60, 0x0, 0x0, 0x2f, 0xb0, 0x2f, 0xd0, 0x0, 0x0,
+    0x9f, 0x40, 0xa, 0xf4, 0x0, 0x1, 0xed, 0x0, 0x4, 0xfb, 0x0, 0x7, 0xf6, 0x0, 0x0, 0xcf,
+    0x20, 0xd, 0xe1, 0x0, 0x0, 0x6f, 0x90, 0x5f, 0x80, 0x0, 0x0, 0xe, 0xe1, 0xcf, 0x20, 0x0,
+    0x0, 0x7, 0xfa, 0xfa, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xc0,
+    0x0, 0x0,
+
+    /* U+0077 "w" */
+    0x79, 0x10, 0x0, 0x0, 0x88, 0x0, 0x0, 0x0, 0x97, 0x7f, 0x50, 0x0, 0x3, 0xff, 0x40, 0x0,
+    0x4, 0xf7, 0x2f, 0xb0, 0x0, 0x9, 0xff, 0x90, 0x0, 0xa, 0xf1, 0xb, 0xf1, 0x0, 0xe, 0xcc,
+    0xe1, 0x0, 0x1e, 0xb0, 0x5, 0xf7, 0x0, 0x5f, 0x66, 0xf5, 0x0, 0x6f, 0x50, 0x1, 0xec, 0x0,
+    0xbe, 0x11, 0xfb, 0x0, 0xbe, 0x0, 0x0, 0x9f, 0x22, 0xfa, 0x0, 0xaf, 0x22, 0xf9, 0x0, 0x0,
+    0x4f, 0x87, 0xf4, 0x0, 0x4f, 0x78, 0xf3, 0x0, 0x0, 0xd, 0xdd, 0xd0, 0x0, 0xd, 0xdd, 0xd0,
+    0x0, 0x0, 0x7, 0xff, 0x70, 0x0, 0x8, 0xff, 0x70, 0x0, 0x0, 0x2, 0xff, 0x20, 0x0, 0x2,
+    0xff, 0x20, 0x0,
+
+    /* U+0078 "x" */
+    0x39, 0x80, 0x0, 0x0, 0x79, 0x30, 0xaf, 0x70, 0x0, 0x6f, 0xa0, 0x1, 0xdf, 0x40, 0x3e, 0xd1,
+    0x0, 0x3, 0xed, 0x2d, 0xe3, 0x0, 0x0, 0x6, 0xfe, 0xf6, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xf4, 0x0, 0x0, 0x2, 0xee, 0x4e, 0xe2, 0x0, 0x0, 0xcf, 0x50, 0x5f,
+    0xc0, 0x0, 0x8f, 0x80, 0x0, 0x8f, 0x90, 0x5f, 0xc0, 0x0, 0x0, 0xcf, 0x60,
+
+    /* U+0079 "y" */
+    0x8, 0x91, 0x0, 0x0, 0x0, 0x79, 0x10, 0x8f, 0x70, 0x0, 0x0, 0x2f, 0xb0, 0x2, 0xfd, 0x0,
+    0x0, 0x9, 0xf4, 0x0, 0xa, 0xf5, 0x0, 0x1, 0xec, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x7f, 0x60,
+    0x0, 0x0, 0xcf, 0x30, 0xd, 0xe0, 0x0, 0x0, 0x5, 0xf9, 0x5, 0xf7, 0x0, 0x0, 0x0, 0xd,
+    0xf1, 0xbe, 0x10, 0x0, 0x0, 0x0, 0x7f, 0xaf, 0x90, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x40, 0x0, 0x0, 0x4, 0x0,
+    0x4f, 0xb0, 0x0, 0x0, 0x3, 0xfe, 0xcf, 0xe3, 0x0, 0x0, 0x0, 0x17, 0xcd, 0xa3, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+007A "z" */
+    0x19, 0x99, 0x99, 0x99, 0x95, 0x1f, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x5f, 0xc1, 0x0,
+    0x0, 0x3, 0xee, 0x20, 0x0, 0x0, 0x1d, 0xf4, 0x0, 0x0, 0x0, 0xbf, 0x60, 0x0, 0x0, 0x9,
+    0xf9, 0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0x3, 0xfe, 0x20, 0x0, 0x0, 0x1d, 0xfb, 0x99,
+    0x99, 0x96, 0x3f, 0xff, 0xff, 0xff, 0xfa,
+
+    /* U+007B "{" */
+    0x0, 0x2a, 0xc8, 0x0, 0xdf, 0xd7, 0x3, 0xfd, 0x0, 0x4, 0xfa, 0x0, 0x4, 0xfa, 0x0, 0x4,
+    0xfa, 0x0, 0x4, 0xfa, 0x0, 0x4, 0xfa, 0x0, 0x4a, 0xf8, 0x0, 0xdf, 0xe1, 0x0, 0x4a, 0xf8,
+    0x0, 0x4, 0xfa, 0x0, 0x4, 0xfa, 0x0, 0x4, 0xfa, 0x0, 0x4, 0xfa, 0x0, 0x4, 0xfa, 0x0,
+    0x3, 0xfd, 0x10, 0x0, 0xcf, 0xe8, 0x0, 0x18, 0xb7,
+
+    /* U+007C "|" */
+    0xbb, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xaa,
+
+    /* U+007D "}" */
+    0x8c, 0xa2, 0x0, 0x7d, 0xfd, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x9f, 0x40, 0x0, 0x9f, 0x40, 0x0,
+    0x9f, 0x40, 0x0, 0x9f, 0x40, 0x0, 0x9f, 0x50, 0x0, 0x8f, 0xa4, 0x0, 0x1d, 0xfd, 0x0, 0x7f,
+    0xa4, 0x0, 0x9f, 0x50, 0x0, 0x9f, 0x40, 0x0, 0x9f, 0x40, 0x0, 0x9f, 0x40, 0x0, 0xaf, 0x40,
+    0x1, 0xdf, 0x30, 0x8e, 0xfd, 0x0, 0x7b, 0x82, 0x0,
+
+    /* U+007E "~" */
+    0x5, 0xa9, 0x20, 0x0, 0x74, 0x5f, 0xde, 0xe6, 0x2, 0xf5, 0xab, 0x1, 0xaf, 0xde, 0xd1, 0x74,
+    0x0, 0x5, 0xa9, 0x20,
+
+    /* U+00B0 "°" */
+    0x0, 0x1, 0x10, 0x0, 0x1, 0x9f, 0xfc, 0x30, 0x9, 0xb1, 0x7, 0xe1, 0xf, 0x20, 0x0, 0xc6,
+    0x1f, 0x10, 0x0, 0xb6, 0xb, 0x80, 0x3, 0xf2, 0x2, 0xdd, 0xbe, 0x60, 0x0, 0x4, 0x52, 0x0,
+
+    /* U+2022 "•" */
+    0x3, 0x40, 0x5f, 0xf9, 0x9f, 0xfd, 0x5f, 0xf9, 0x2, 0x40,
+
+    /* U+F00D "" */
+    0x3, 0x40, 0x0, 0x0, 0x0, 0x5, 0x20, 0x5f, 0xf7, 0x0, 0x0, 0x0, 0xbf, 0xe2, 0xef, 0xff,
+    0x70, 0x0, 0xb, 0xff, 0xfa, 0xaf, 0xff, 0xf7, 0x0, 0xbf, 0xff, 0xf6, 0xb, 0xff, 0xff, 0x8b,
+    0xff, 0xff, 0x70, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0x70,
+    0x0, 0x0, 0x1, 0xef, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0xf7, 0x0, 0xb, 0xff, 0xff, 0x8b, 0xff, 0xff, 0x70, 0xaf, 0xff, 0xf7,
+    0x0, 0xbf, 0xff, 0xf6, 0xef, 0xff, 0x70, 0x0, 0xb, 0xff, 0xfa, 0x5f, 0xf7, 0x0, 0x0, 0x0,
+    0xbf, 0xe2, 0x3, 0x40, 0x0, 0x0, 0x0, 0x5, 0x20,
+
+    /* U+F013 "" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x2b, 0xff, 0xff, 0xb2, 0x0, 0x20, 0x0, 0x0, 0x8f, 0x87, 0xff, 0xff, 0xff, 0xff, 0x79,
+    0xf8, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xb, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x3f, 0xff, 0xff, 0xff, 0xc7, 0x7c, 0xff, 0xff, 0xff, 0xf3,
+    0x7, 0xef, 0xff, 0xfa, 0x0, 0x0, 0xaf, 0xff, 0xfe, 0x70, 0x0, 0x6f, 0xff, 0xf1, 0x0, 0x0,
+    0x1f, 0xff, 0xf6, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0x0, 0x0, 0xe, 0xff, 0xf7, 0x0, 0x0, 0x6f,
+    0xff, 0xf1, 0x0, 0x0, 0x1f, 0xff, 0xf6, 0x0, 0x7, 0xef, 0xff, 0xfa, 0x0, 0x0, 0xaf, 0xff,
+    0xfe, 0x70, 0x3f, 0xff, 0xff, 0xff, 0xc7, 0x7c, 0xff, 0xff, 0xff, 0xf3, 0xb, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x8f, 0x97, 0xff, 0xff, 0xff, 0xff, 0x78, 0xf8, 0x0, 0x0, 0x2, 0x0, 0x2b, 0xff, 0xff,
+    0xb2, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+F053 "" */
+    0x0, 0x0, 0x0, 0x5, 0xe8, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf5, 0x0, 0x0, 0x5, 0xff, 0xfe,
+    0x20, 0x0, 0x5, 0xff, 0xfe, 0x30, 0x0, 0x5, 0xff, 0xfe, 0x30, 0x0, 0x5, 0xff, 0xfe, 0x30,
+    0x0, 0x5, 0xff, 0xfe, 0x30, 0x0, 0x5, 0xff, 0xfe, 0x30, 0x0, 0x0, 0xdf, 0xff, 0x60, 0x0,
+    0x0, 0x5, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x5, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x5, 0xff, 0xfe,
+    0x30, 0x0, 0x0, 0x5, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x5, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x5,
+    0xff, 0xfe, 0x20, 0x0, 0x0, 0x5, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x5, 0xe8, 0x0,
+
+    /* U+F070 "" */
+    0x16, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfc, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x70, 0x4, 0x8c, 0xef, 0xec, 0x94, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5e, 0xff, 0xbd, 0xff, 0xff, 0xef, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xff, 0xc5, 0x10, 0x4, 0xbf, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xf6,
+    0x1, 0x32, 0x0, 0x9f, 0xff, 0xd2, 0x0, 0x0, 0x1, 0x0, 0x7, 0xff, 0xf9, 0x4f, 0xfa, 0x10,
+    0xbf, 0xff, 0xd1, 0x0, 0x0, 0xba, 0x10, 0x4, 0xef, 0xfd, 0xff, 0xfa, 0x4, 0xff, 0xff, 0xb0,
+    0x0, 0x6f, 0xfd, 0x30, 0x1, 0xbf, 0xff, 0xff, 0xf2, 0xf, 0xff, 0xff, 0x60, 0xb, 0xff, 0xff,
+    0x60, 0x0, 0x8f, 0xff, 0xff, 0x30, 0xef, 0xff, 0xfa, 0x0, 0x6f, 0xff, 0xff, 0x10, 0x0, 0x5e,
+    0xff, 0xf2, 0xf, 0xff, 0xff, 0x60, 0x0, 0xbf, 0xff, 0xf4, 0x0, 0x0, 0x2c, 0xff, 0xd8, 0xff,
+    0xff, 0xb0, 0x0, 0x1, 0xdf, 0xff, 0xc0, 0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
+    0x2, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x6, 0xff, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff,
+    0xc4, 0x0, 0x0, 0x3, 0xdf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xed, 0x40,
+    0x1, 0xbf, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xec, 0x20, 0x0, 0x7f, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x10,
+
+    /* U+F0C7 "" */
+    0x3, 0x44, 0x44, 0x44, 0x44, 0x44, 0x30, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x10, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x0, 0xff, 0xa4, 0x44, 0x44, 0x44,
+    0x44, 0xbf, 0xfc, 0x10, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xc1, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf6, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf8, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf8, 0xff, 0xeb, 0xbb, 0xbb, 0xbb, 0xbb, 0xef, 0xff,
+    0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xff,
+    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x8f, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0x60,
+    0x0, 0xd, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0x50, 0x0, 0xc, 0xff, 0xff, 0xf8, 0xff, 0xff,
+    0xff, 0x90, 0x0, 0x2f, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf9, 0x56, 0xdf, 0xff, 0xff, 0xf8,
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe2, 0x3, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x10,
+
+    /* U+F15B "" */
+    0x58, 0x88, 0x88, 0x88, 0x60, 0x60, 0x0, 0xf, 0xff, 0xff, 0xff, 0xfb, 0xf, 0x90, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0xff, 0x90, 0xf, 0xff, 0xff, 0xff, 0xfb, 0xf, 0xff, 0x90, 0xff, 0xff,
+    0xff, 0xff, 0xb0, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xfb, 0x8, 0x88, 0x87, 0xff, 0xff, 0xff,
+    0xff, 0xe5, 0x44, 0x44, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x58, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x50,
+
+    /* U+F1EB "" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x23, 0x33, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0x8c, 0xef, 0xff, 0xff, 0xec, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xed, 0xef, 0xff, 0xff, 0xff,
+    0xd4, 0x0, 0x8, 0xff, 0xff, 0xfb, 0x63, 0x0, 0x0, 0x3, 0x6b, 0xff, 0xff, 0xf8, 0xa, 0xff,
+    0xff, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9f, 0xff, 0xfa, 0xaf, 0xfd, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xa0, 0xaa, 0x10, 0x0, 0x5, 0x9c, 0xef, 0xec, 0x95,
+    0x0, 0x0, 0x1a, 0xa0, 0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xfa, 0x63, 0x23, 0x6a, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xa2, 0x0, 0x0,
+    0x0, 0x2, 0xaf, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x41,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7b, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xe4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+F240 "" */
+    0x3a, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x91, 0xd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0xff, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbe, 0xfc, 0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xfe, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb, 0xff, 0xff, 0xf8,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x39, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x8f, 0xff, 0xf8, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0x39, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfe, 0xff, 0xdb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xfc, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x3a, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0x91, 0x0,
+
+    /* U+F241 "" */
+    0x3a, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x91, 0xd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0xff, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbe, 0xfc, 0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xfe, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xb, 0xff, 0xff, 0xf8,
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x39, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x8f, 0xff, 0xf8, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0x0, 0x0, 0x39, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0xb, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfe, 0xff, 0xdb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xfc, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x3a, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0x91, 0x0,
+
+    /* U+F242 "" */
+    0x3a, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x91, 0xd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0xff, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbe, 0xfc, 0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xfe, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf8,
+    0x4f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x39, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf8, 0x4f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x39, 0xff, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfe, 0xff, 0xdb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xfc, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x3a, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0x91, 0x0,
+
+    /* U+F243 "" */
+    0x3a, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x91, 0xd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0xff, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbe, 0xfc, 0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xfe, 0xff, 0x84, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf8,
+    0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0xff, 0xff, 0x84, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf8, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x39, 0xff, 0xff, 0x84, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfe, 0xff, 0xdb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xfc, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x3a, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0x91, 0x0,
+
+    /* U+F244 "" */
+    0x3a, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x91, 0xd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0xff, 0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbe, 0xfc, 0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xfe, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x39, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfe, 0xff, 0xdb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xfc, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x3a, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0x91, 0x0,
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 86, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 86, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 21, .adv_w = 125, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 8},
+    {.bitmap_index = 39, .adv_w = 225, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 137, .adv_w = 199, .box_w = 12, .box_h = 20, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 257, .adv_w = 270, .box_w = 17, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 385, .adv_w = 220, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 490, .adv_w = 67, .box_w = 2, .box_h = 6, .ofs_x = 1, .ofs_y = 8},
+    {.bitmap_index = 496, .adv_w = 108, .box_w = 5, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 544, .adv_w = 108, .box_w = 5, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 592, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 624, .adv_w = 186, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 674, .adv_w = 73, .box_w = 3, .box_h = 6, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 683, .adv_w = 123, .box_w = 6, .box_h = 3, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 692, .adv_w = 73, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 697, .adv_w = 113, .box_w = 9, .box_h = 19, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 783, .adv_w = 213, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 873, .adv_w = 118, .box_w = 6, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 915, .adv_w = 184, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 998, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1075, .adv_w = 214, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1173, .adv_w = 184, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1250, .adv_w = 197, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1333, .adv_w = 191, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1417, .adv_w = 206, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1507, .adv_w = 197, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1597, .adv_w = 73, .box_w = 4, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1619, .adv_w = 73, .box_w = 4, .box_h = 14, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1647, .adv_w = 186, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1697, .adv_w = 186, .box_w = 10, .box_h = 8, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1737, .adv_w = 186, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1787, .adv_w = 183, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1870, .adv_w = 331, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 2051, .adv_w = 234, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2156, .adv_w = 242, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2247, .adv_w = 231, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2345, .adv_w = 264, .box_w = 14, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2443, .adv_w = 214, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2520, .adv_w = 203, .box_w = 10, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2590, .adv_w = 247, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2688, .adv_w = 260, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2779, .adv_w = 99, .box_w = 3, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2800, .adv_w = 164, .box_w = 10, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2870, .adv_w = 230, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2961, .adv_w = 190, .box_w = 10, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3031, .adv_w = 306, .box_w = 15, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3136, .adv_w = 260, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3227, .adv_w = 269, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3340, .adv_w = 231, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3424, .adv_w = 269, .box_w = 16, .box_h = 18, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3568, .adv_w = 233, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3652, .adv_w = 199, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3742, .adv_w = 188, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3826, .adv_w = 253, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3910, .adv_w = 228, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4015, .adv_w = 360, .box_w = 22, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4169, .adv_w = 215, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4260, .adv_w = 207, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4351, .adv_w = 210, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4442, .adv_w = 107, .box_w = 5, .box_h = 19, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 4490, .adv_w = 113, .box_w = 9, .box_h = 19, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 4576, .adv_w = 107, .box_w = 5, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 4624, .adv_w = 187, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 4669, .adv_w = 160, .box_w = 10, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4679, .adv_w = 192, .box_w = 6, .box_h = 3, .ofs_x = 2, .ofs_y = 12},
+    {.bitmap_index = 4688, .adv_w = 191, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4743, .adv_w = 218, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4833, .adv_w = 183, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4894, .adv_w = 218, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4984, .adv_w = 196, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5050, .adv_w = 113, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5110, .adv_w = 221, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 5200, .adv_w = 218, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5283, .adv_w = 89, .box_w = 3, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5307, .adv_w = 91, .box_w = 7, .box_h = 20, .ofs_x = -2, .ofs_y = -4},
+    {.bitmap_index = 5377, .adv_w = 197, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5467, .adv_w = 89, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5490, .adv_w = 338, .box_w = 19, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5595, .adv_w = 218, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5656, .adv_w = 203, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5722, .adv_w = 218, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 5812, .adv_w = 218, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 5902, .adv_w = 131, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5941, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5996, .adv_w = 132, .box_w = 8, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6048, .adv_w = 217, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6109, .adv_w = 179, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6175, .adv_w = 288, .box_w = 18, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6274, .adv_w = 177, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6335, .adv_w = 179, .box_w = 13, .box_h = 15, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 6433, .adv_w = 167, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6488, .adv_w = 112, .box_w = 6, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 6545, .adv_w = 96, .box_w = 2, .box_h = 19, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 6564, .adv_w = 112, .box_w = 6, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 6621, .adv_w = 186, .box_w = 10, .box_h = 4, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 6641, .adv_w = 134, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 6673, .adv_w = 100, .box_w = 4, .box_h = 5, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 6683, .adv_w = 220, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6788, .adv_w = 320, .box_w = 20, .box_h = 21, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6998, .adv_w = 200, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 7092, .adv_w = 400, .box_w = 25, .box_h = 21, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7355, .adv_w = 280, .box_w = 18, .box_h = 19, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 7526, .adv_w = 240, .box_w = 15, .box_h = 21, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 7684, .adv_w = 400, .box_w = 25, .box_h = 19, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 7922, .adv_w = 400, .box_w = 25, .box_h = 13, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 8085, .adv_w = 400, .box_w = 25, .box_h = 13, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 8248, .adv_w = 400, .box_w = 25, .box_h = 13, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 8411, .adv_w = 400, .box_w = 25, .box_h = 13, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 8574, .adv_w = 400, .box_w = 25, .box_h = 13, .ofs_x = 0, .ofs_y = 1}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_1[] = {
+    0x0, 0x1f72, 0xef5d, 0xef63, 0xefa3, 0xefc0, 0xf017, 0xf0ab,
+    0xf13b, 0xf190, 0xf191, 0xf192, 0xf193, 0xf194
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 176, .range_length = 61845, .glyph_id_start = 96,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 14, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17, 18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27, 28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37, 37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50, 51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58, 58, 59, 58, 60, 41, 0, 0, 9,
+    61, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12, 18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25, 23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29, 29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0, 39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46, 46, 47, 48, 49, 0, 0, 35, 9,
+    50, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 1, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 3, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 7, 6, 0, 3, 0, 6, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 14, 0, 9, -7, 0, 0, 6, 0, -18, -19, 2, 15, 7,
+    5, -13, 2, 16, 1, 13, 3, 10, 0, -14, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 19, 3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6, 0, -10, 0, 0, 0, 0, 0, -6, 5, 6, 0, 0,
+    -3, 0, -2, 3, 0, -3, 0, -3, -2, -6, 0, 0, 0, 0, -3, 0,
+    0, -4, -5, 0, 0, -3, 0, -6, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -3, -3, 0, -5, 0, -9, 0, -39, 0, 0, -6, -16, 6, 10,
+    0, 0, -6, 3, 3, 11, 6, -5, 6, 0, 0, -18, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -12, 0, 0, 4, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -9, -4, -16, 0, -13, -2, 0, 0, -10,
+    0, 1, 12, 0, -10, -3, -1, 1, 0, -5, 0, 0, -2, -24, 0, 4,
+    0, 10, -9, 0, -6, 0, -13, 4, 0, -26, -3, 12, 3, 0, 0, 0,
+    0, 0, 0, 3, 0, -4, -1, -4, 0, -13, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 11, 0, 3, 0, 0, -6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 12, 3, 1, 0, 0,
+    0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -12, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 6,
+    3, 10, -3, 0, 0, 6, -3, -11, -44, 2, 9, 6, 1, -4, 0, 12,
+    0, 10, 0, 10, 0, -30, 0, -4, 10, 0, 11, -3, 6, 3, 0, 0,
+    1, -3, 0, 0, -5, 26, 0, 26, 0, 10, 0, 13, 4, 13, 5, 10,
+    0, 0, -5, -12, 0, 0, 0, -3, 1, -2, 0, 2, -6, -4, -6, 2,
+    0, -3, 0, 0, 0, -13, 2, -6, 0, -6, -11, 0, -7, -6, -10, 0,
+    0, -21, 0, 0, 0, 0, 3, 0, 0, 0, 0, 3, 0, -4, -7, -4,
+    -4, 0, 1, -18, 3, -20, 0, 0, 0, -11, -2, 0, 32, -4, -4, 3,
+    3, -3, 0, -4, 3, 0, 0, -17, -6, 11, 0, 18, -10, -3, -12, 0,
+    -12, 5, 0, -31, 0, 3, 3, 0, -4, 0, 3, 0, 0, -2, -4, -11,
+    0, -11, 0, -20, 0, 19, -6, 0, -12, 0, 11, 0, -22, -31, -22, -6,
+    10, 0, 0, -21, 0, 4, -7, 0, -5, 0, -6, -13, 0, -3, 10, 0,
+    10, 0, 10, 0, 0, 8, 10, -39, -21, 0, -21, 3, 1, -21, -21, -9,
+    -21, -10, -19, -10, -21, 15, 0, 2, 0, 0, 0, 0, 0, 2, 2, -4,
+    -6, 0, -1, -1, -3, 0, 0, -2, 0, 0, 0, -6, 0, -3, 0, -7,
+    -6, 0, -8, -11, -11, -6, 0, -6, 0, -6, 0, 0, 0, 0, -3, 0,
+    0, 3, 0, 2, -3, 2, 0, 1, 0, 0, 0, 3, -2, 0, 0, 0,
+    -2, 3, 3, -1, 0, 0, 0, -6, 0, -1, 0, 0, 0, 0, 0, 1,
+    0, 4, -2, 0, -4, 0, -5, 0, 0, -2, 0, 10, 0, 0, -3, 0,
+    0, 0, 0, 0, -1, 1, -2, 1, -2, 0, 0, -3, 0, -3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, -2, 0, -3, -4, 0, 0, 0, 0,
+    0, 1, 0, 0, -2, 0, -3, -3, -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, -2, -4, -2, 0, -5, 0, -10, -2, -10,
+    6, 0, 0, -6, 3, 6, 9, 0, -8, -1, -4, 0, -1, -15, 3, -2,
+    2, -17, 3, 0, 0, 1, -17, 0, -17, -3, -28, -2, 0, -16, 0, 6,
+    9, 0, 4, 0, 0, 0, 0, 1, 0, -6, -4, -6, 0, -10, 0, 0,
+    0, -3, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2, -2, 0, -2, -4,
+    0, 0, 0, 0, 0, 0, 0, -3, -3, 0, -2, -4, -3, 0, 0, -3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, 0, -4,
+    0, -2, 0, -6, 3, 0, 0, -4, 2, 3, 3, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 2, 0, 0, -3, 0, -3, -2, -4, 0,
+    0, 0, 0, 0, 0, 0, 3, 0, -3, 0, 0, 0, 0, -4, -5, -4,
+    0, -6, 0, 10, -2, 1, -10, 0, 0, 9, -16, -17, -13, -6, 3, 0,
+    -3, -21, -6, 0, -6, 0, -6, 5, -6, -20, 0, -9, 0, 0, 2, -1,
+    3, -2, 0, 3, 0, -10, -12, 0, -16, -8, -7, -8, -10, -4, -9, -1,
+    -6, -1, -9, 2, 0, 1, 0, -3, 0, 0, 0, 2, 0, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -2, 0, -1, -3, 0,
+    -5, -7, -7, -1, 0, -10, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0,
+    0, 1, -2, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    15, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -3, 0, 3, 0, 12,
+    -3, 0, -7, -2, -12, 0, 0, -6, 0, 3, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 2, -3, 2, 0, 0, -2, 0, 0, 0, -6, 0, 0, 4,
+    0, -16, -10, 0, 0, 0, -5, -16, 0, 0, -3, 3, 0, -9, -1, -14,
+    0, -9, 0, 0, -4, -6, -4, -3, -5, 0, 0, -6, 0, 0, -3, 0,
+    0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0, -6, 0, 0, 0, 0,
+    4, 0, 2, -6, -6, 0, -3, -3, -4, 0, 0, 0, 0, 0, 0, -10,
+    0, -3, 0, -5, -3, 0, -7, -8, -10, -3, 0, -6, 0, -10, 0, 0,
+    0, 0, 26, 0, 0, 2, 0, 0, -4, 0, 0, 3, 0, -14, 0, 0,
+    0, 0, 0, -30, -6, 11, 10, -3, -13, 0, 3, -5, 0, -16, -2, -4,
+    3, -22, -3, 4, 0, 5, -11, -5, -12, -11, -13, 0, 0, -19, 0, 18,
+    0, 0, -2, 0, 0, 0, -2, -2, -3, -9, -11, -9, -1, -30, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -2, -3, -5, 0, 0, -6,
+    0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -6, 0, 0, 6, -1, 4, 0, -7, 3, -2, -1, -8,
+    -3, 0, -4, -3, -2, 0, -5, -5, 0, 0, -3, -1, -2, -5, -4, 0,
+    0, -3, 0, 3, -2, 0, -7, 0, 0, 0, -6, 0, -5, 0, -5, 0,
+    -5, 3, 0, 0, 0, 0, 0, 0, 0, 0, -6, 3, 0, -4, 0, -2,
+    -4, -10, -2, -2, -2, -1, -2, -4, -1, 0, 0, 0, 0, 0, -3, -3,
+    -3, 0, 0, 0, 0, 4, -2, 0, -2, 0, 0, 0, -2, -4, -2, -3,
+    -4, -3, -3, 0, 3, 13, -1, 0, -9, 0, -2, 6, 0, -3, -13, -4,
+    5, 0, 0, -15, -5, 3, -5, 2, 0, -2, -3, -10, 0, -5, 2, 0,
+    0, -5, 0, 0, 0, 3, 3, -6, -6, 0, -5, -3, -5, -3, -3, 0,
+    -5, 2, -6, 2, -5, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -5, 0, 0, -4, 0, 0, -3, -3, 0, 0, 0, 0, -3, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -5, 0,
+    -6, 0, 0, 0, -11, 0, 2, -7, 6, 1, -2, -15, 0, 0, -7, -3,
+    0, -13, -8, -9, 0, 0, -14, -3, -13, -12, -15, 0, -8, 0, 3, 21,
+    -4, 0, -7, -3, -1, -3, -5, -9, -6, -12, -13, -12, -7, -3, 0, 0,
+    -2, 0, 1, 0, 0, -22, -3, 10, 7, -7, -12, 0, 1, -10, 0, -16,
+    -2, -3, 6, -29, -4, 1, 0, 0, -21, -4, -17, -3, -23, 0, 0, -22,
+    0, 19, 1, 0, -2, 0, 0, 0, 0, -2, -2, -12, -2, -12, 0, -21,
+    0, 0, 0, 0, -10, 0, -3, 0, -1, -9, -15, 0, 0, -2, -5, -10,
+    -3, 0, -2, 0, 0, 0, 0, -14, -3, -11, -10, -3, -5, -8, -3, -5,
+    0, -6, -3, -11, -5, 0, -4, -6, -3, -6, 0, 2, 0, -2, -11, -2,
+    0, 6, 0, -6, 0, 0, 0, 0, 4, 0, 2, -6, 13, 0, -3, -3,
+    -4, 0, 0, 0, 0, 0, 0, -10, 0, -3, 0, -5, -3, 0, -7, -8,
+    -10, -3, 0, -6, 3, 13, 0, 0, 0, 0, 26, 0, 0, 2, 0, 0,
+    -4, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, -2, -6, 0, 0, 0, 0, 0, -2, 0, 0, 0, -3, -3, 0,
+    0, -6, -3, 0, 0, -6, 0, 5, -2, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 5, 6, 3, -3, 0, -10, -5, 0, 10, -11, -10,
+    -6, -6, 13, 6, 3, -28, -2, 6, -3, 0, -3, 4, -3, -11, 0, -3,
+    3, -4, -3, -10, -3, 0, 0, 10, 6, 0, -9, 0, -18, -4, 9, -4,
+    -12, 1, -4, -11, -11, -11, -3, 13, 3, 0, -5, 0, -9, 0, 3, 11,
+    -7, -12, -13, -8, 10, 0, 1, -23, -3, 3, -5, -2, -7, 0, -7, -12,
+    -5, -5, -3, 0, 0, -7, -7, -3, 0, 10, 7, -3, -18, 0, -18, -4,
+    0, -11, -19, -1, -10, -5, -11, -5, -9, 9, 0, 0, -4, 0, -6, -3,
+    0, -3, -6, 0, 5, -11, 3, 0, 0, -17, 0, -3, -7, -5, -2, -10,
+    -8, -11, -7, 0, -10, -3, -7, -6, -10, -3, 0, 0, 1, 15, -5, 0,
+    -10, -3, 0, -3, -6, -7, -9, -9, -12, -9, -4, -6, 6, 0, -5, 0,
+    -16, -4, 2, 6, -10, -12, -6, -11, 11, -3, 2, -30, -6, 6, -7, -5,
+    -12, 0, -10, -13, -4, -3, -3, -3, -7, -10, -1, 0, 0, 10, 9, -2,
+    -21, 0, -19, -7, 8, -12, -22, -6, -11, -13, -16, -13, -11, 6, 0, 0,
+    0, 0, -4, 0, 0, 3, -4, 6, 2, -6, 6, 0, 0, -10, -1, 0,
+    -1, 0, 1, 1, -3, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0,
+    3, 10, 1, 0, -4, 0, 0, 0, 0, -2, -2, -4, 0, -4, 0, 0,
+    1, 3, 0, 0, 0, 0, 3, 1, -3, 0, 12, 0, 6, 1, 1, -4,
+    0, 6, 0, 0, 0, 3, 0, 0, 0, 0, 6, 0, 7, 1, 9, 0,
+    0, 10, 0, 9, -3, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -19, 0, -3, 5, 0, 10, -44, 0, 32, 4, -6, -6, 3,
+    3, -2, 1, -16, 0, 0, 15, -19, -6, 10, 0, 10, -6, -3, -13, 6,
+    -6, 0, 0, -22, 12, 45, 0, 0, 0, 0, 38, 0, 0, 0, 0, 6,
+    0, 6, 0, -19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0,
+    0, -6, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, 6, -9, 0, 0, 1, -3, 0, 3,
+    41, -6, -3, 10, 9, -9, 3, 0, 0, 3, 3, -4, -10, 18, 10, 26,
+    0, -3, -3, 15, -2, 6, 0, -42, 9, 0, -3, 0, -9, 0, 35, 0,
+    3, -6, -9, -4, 12, 6, 8, 0, 0, 0, 0, -9, 0, 0, 0, -9,
+    0, 0, 0, 0, -7, -2, 0, 0, 0, -7, 0, -4, 0, -15, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -21, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, -3, 0, -3, 0, -6, 0, -5, 0, -9, 0, 0,
+    0, -5, 3, -4, 0, 0, -9, -3, -7, 0, 0, -9, 0, -3, 0, -15,
+    0, -4, 0, 0, -26, -6, -13, -4, -12, 0, 0, -21, 0, -9, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, -5, -6, -5, -3, -5, 0, 0, 0, 0,
+    -7, 0, -7, 4, -4, 6, 0, -2, -7, -2, -5, -6, 0, -4, -2, -2,
+    2, -9, -1, 0, 0, 0, -28, -3, -4, 0, -7, 0, -2, -15, -3, 0,
+    0, -2, -3, 0, 0, 0, 0, 2, 0, -2, -5, -2, -2, 5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+    0, -7, 0, -2, 0, 0, 0, -6, 3, 0, 0, 0, -9, -3, -6, 0,
+    0, -9, 0, -3, 0, -15, 0, 0, 0, 0, -31, 0, -6, -12, -16, 0,
+    0, -21, 0, -2, -5, 0, 0, 0, 0, 0, 0, 0, 0, -3, -5, -3,
+    -2, -5, 1, 0, 0, 5, -4, 0, 10, 16, -3, -3, -10, 4, 16, 5,
+    7, -9, 4, 13, 4, 9, 7, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 20, 15, -6, -3, 0, -3, 26, 14, 26, 0, 0, 0, 3,
+    0, 3, 0, 12, 0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, -27, -4,
+    -3, -13, -16, 0, 0, -21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0,
+    -27, -4, -3, -13, -16, 0, 0, -13, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0,
+    -7, 3, 0, -3, 3, 6, 3, -10, 0, -1, -3, 3, 0, 3, 0, 0,
+    0, 0, -8, 0, -3, -2, -6, 0, -3, -13, 0, 20, -3, 0, -7, -2,
+    0, -2, -5, 0, -3, -9, -6, -9, -4, 0, 0, 0, -5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, -27, -4, -3, -13, -16, 0, 0, -21, 0, 0, 0, 0,
+    0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0,
+    -10, -4, -3, 10, -3, -3, -13, 1, -2, 1, -2, -9, 1, 7, 1, 3,
+    1, 3, -8, -13, -4, 0, -12, -6, -9, -13, -12, 0, -5, -6, -4, -4,
+    -3, -2, -4, -2, 0, -2, -1, 5, 0, 5, -2, 5, 0, 10, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -3, -3, 0, 0, -9,
+    0, -2, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -19,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, 0, -4,
+    0, 0, 0, 0, -3, 0, 0, -5, -3, 3, 0, -5, -6, -2, 0, -9,
+    -2, -7, -2, -4, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -21, 0, 10, 0, 0, -6, 0, 0, 0, 0, -4, 0, -3, 0, -3,
+    0, -2, 0, 0, -2, 0, -7, 0, 0, 13, -4, -11, -10, 2, 4, 4,
+    -1, -9, 2, 5, 2, 10, 2, 11, -2, -9, 0, 0, -13, 0, 0, -10,
+    -9, 0, 0, -6, 0, -4, -5, 0, -5, 0, -5, 0, -2, 5, 0, -3,
+    -10, -3, -3, 12, 0, 0, -3, 0, -6, 0, 0, 4, -7, 0, 3, -3,
+    3, 0, 0, -11, 0, -2, -1, 0, -3, 4, -3, 0, 0, 0, -13, -4,
+    -7, 0, -10, 0, 0, -15, 0, 12, -3, 0, -6, 0, 2, 0, -3, 0,
+    -3, -10, 0, -10, -3, 3, 0, 0, 0, 0, -2, 0, 0, 3, -4, 1,
+    0, 0, -4, -2, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -20, 0, 7, 0, 0, -3, 0, 0, 0,
+    0, 1, 0, -3, -3, -3, 0, 0, 0, 6, 6, 7, 0, 0, 0, 10,
+    0, -20, -18, 1, 14, 10, 5, -13, 2, 13, 0, 12, 0, 6, 3, -30,
+    0, -3, 13, 0, 9, -6, 6, 0, 0, 17, 0, 0, 0, 0, -5, 0,
+    0, 0, -1, 6, 0, 12, 3, 12, 0, 0
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 61,
+    .right_class_cnt     = 50,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = LV_FONT_FMT_TXT_PLAIN,
+    .cache = &cache
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t lv_font_montserrat_20 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 22,          /*The maximum line height required by the font*/
+    .base_line = 4,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -2,
+    .underline_thickness = 1,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
@@ -0,0 +1,2461 @@
+/*******************************************************************************
+ * Size: 28 px
+ * Bpp: 4
+ * Charset: text, 212 glyphs
+ * Generated by tools/fonts/gen_fonts.py from Montserrat-Medium.ttf and FontAwesome5-Solid+Brands+Regular.woff. Do not edit.
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x79, 0x91, 0xdb, 0x34, 0xe0, 0x1, 0x10, 0x1, 0xc0, 0x31, 0x80, 0x4, 0x3, 0x8, 0x0, 0xc0,
+    0x21, 0xf0, 0xe, 0x10, 0x10, 0x8, 0xc0, 0xc0, 0x4d, 0xc1, 0x32, 0x80, 0x38, 0x54, 0xc3, 0x6b,
+    0x14, 0xc0, 0x1a, 0xe2, 0x56,
+
+    /* U+0022 "\"" */
+    0x29, 0x90, 0x80, 0xcc, 0x88, 0x59, 0x80, 0x3, 0x66, 0x0, 0x7f, 0xf0, 0xcc, 0x2, 0x10, 0x0,
+    0x80, 0x63, 0x0, 0xff, 0x84, 0x0, 0x20, 0x1, 0x31, 0x30, 0x8, 0x44, 0x0,
+
+    /* U+0023 "#" */
+    0x0, 0xf2, 0xca, 0x0, 0x63, 0x96, 0x0, 0xfe, 0xf6, 0x0, 0xe4, 0x6e, 0x0, 0xfe, 0x60, 0x70,
+    0xd, 0xe1, 0xc0, 0x1f, 0xc4, 0x4, 0x1, 0x88, 0xc, 0x3, 0xf0, 0x8e, 0x0, 0xcc, 0xc, 0x1,
+    0x8e, 0x23, 0x0, 0x22, 0x38, 0x82, 0xa2, 0x20, 0x67, 0x79, 0x80, 0x5d, 0xf8, 0x41, 0x9d, 0xcc,
+    0xd, 0x11, 0x20, 0x24, 0x46, 0x60, 0x28, 0x8a, 0x40, 0xdd, 0xe3, 0xd, 0x77, 0xd8, 0xe, 0xfc,
+    0x1, 0xc4, 0x6, 0x1, 0x8c, 0x8, 0x3, 0xf9, 0x81, 0x80, 0x37, 0x7, 0x80, 0x7f, 0x10, 0x10,
+    0x6, 0x20, 0x20, 0xe, 0x11, 0x88, 0x44, 0x2, 0x39, 0x80, 0x47, 0x2, 0x77, 0x5a, 0x3, 0xdd,
+    0xc6, 0x17, 0xdd, 0x0, 0x4, 0x60, 0x8, 0x47, 0x80, 0x2, 0x38, 0x13, 0xba, 0x80, 0x7e, 0xed,
+    0x80, 0x7d, 0xd8, 0x3, 0xb8, 0x38, 0x3, 0x30, 0x30, 0x7, 0xf1, 0x81, 0x0, 0x62, 0x3, 0x0,
+    0xfe, 0x60, 0x70, 0xd, 0xc1, 0xc0, 0x1f, 0xc4, 0x4, 0x1, 0x88, 0x8, 0x3, 0x80,
+
+    /* U+0024 "$" */
+    0x0, 0xf0, 0xf5, 0x80, 0x7f, 0xf0, 0x84, 0x3, 0xff, 0xa0, 0x91, 0x40, 0xb7, 0x2c, 0x20, 0x1c,
+    0x79, 0x6e, 0x80, 0x28, 0xd3, 0xd2, 0x20, 0x3, 0xd3, 0x1, 0x40, 0x25, 0x20, 0x3, 0x10, 0x3,
+    0xc4, 0x1f, 0xe8, 0x1a, 0xb7, 0x19, 0xc, 0xc, 0xc0, 0xb0, 0x20, 0x1c, 0x73, 0x60, 0x6, 0x0,
+    0x60, 0x7, 0xff, 0xf, 0x80, 0x3f, 0xf2, 0x0, 0x1d, 0x40, 0x3f, 0xe1, 0x70, 0x5, 0x64, 0x80,
+    0x7f, 0xa1, 0xc0, 0x6, 0xe0, 0xb4, 0xc2, 0x1, 0xe8, 0xc6, 0x10, 0x0, 0xac, 0xf4, 0x88, 0x7,
+    0x1c, 0xf6, 0x0, 0x80, 0x4d, 0x84, 0x1, 0xf1, 0x2, 0xf4, 0x90, 0x14, 0x80, 0x7f, 0x85, 0xb0,
+    0x81, 0x8, 0x3, 0xfe, 0x15, 0x0, 0x8, 0x10, 0x7, 0xf8, 0x40, 0x2, 0x9b, 0x2, 0x1, 0xf1,
+    0xb8, 0x11, 0x38, 0x1f, 0xe9, 0x94, 0x1d, 0x67, 0x4, 0x20, 0x2d, 0x40, 0x56, 0x6c, 0xe, 0x98,
+    0x1, 0x2a, 0x3, 0x58, 0xe8, 0x20, 0x10, 0x9b, 0xeb, 0x0, 0x63, 0x8b, 0xee, 0x2, 0x76, 0x41,
+    0x0, 0x7f, 0xf7, 0x47, 0x24, 0x3, 0xe0,
+
+    /* U+0025 "%" */
+    0x0, 0x1c, 0xdd, 0x28, 0x7, 0xf3, 0xc9, 0x80, 0x67, 0xc6, 0x62, 0x55, 0x0, 0x3e, 0x58, 0x53,
+    0x0, 0x8e, 0xb, 0x75, 0xea, 0xa6, 0x0, 0xe1, 0xb0, 0xf0, 0xd, 0x41, 0x24, 0x3, 0x63, 0x40,
+    0x1d, 0x63, 0x6, 0x1, 0x90, 0x50, 0x2, 0x15, 0x31, 0x0, 0x99, 0x51, 0xc0, 0x38, 0xcc, 0x1,
+    0xc2, 0x6, 0x0, 0x28, 0x19, 0x0, 0xf1, 0x98, 0x3, 0x84, 0xc, 0x1, 0x23, 0x4, 0x1, 0xe7,
+    0x13, 0x0, 0x85, 0x48, 0x41, 0x91, 0xc, 0x1, 0xf7, 0x4, 0x8, 0x2, 0x6, 0x80, 0xa0, 0x64,
+    0x3, 0xf2, 0x32, 0x7d, 0xeb, 0x23, 0x87, 0xd, 0x90, 0x23, 0xb9, 0x0, 0x34, 0xc8, 0x98, 0x62,
+    0x81, 0xcd, 0x54, 0x37, 0x68, 0x85, 0xd8, 0x40, 0x26, 0xcd, 0xc7, 0x13, 0x81, 0xb0, 0xb4, 0x6d,
+    0xd3, 0x25, 0x80, 0x7f, 0x78, 0x58, 0x92, 0xa4, 0x91, 0x25, 0x14, 0x80, 0x3e, 0x83, 0x65, 0x4,
+    0xd, 0x0, 0xda, 0x8, 0x1, 0xe3, 0x72, 0x80, 0x0, 0x81, 0x0, 0x62, 0xe, 0x0, 0xe1, 0xe0,
+    0x91, 0x0, 0xc2, 0x1, 0x84, 0x3, 0xe8, 0x26, 0x40, 0x8, 0x83, 0x40, 0x36, 0x86, 0x80, 0x64,
+    0x62, 0x80, 0xc, 0x82, 0xc2, 0x0, 0x16, 0x14, 0x0, 0x86, 0x43, 0x84, 0x3, 0xc, 0xe, 0x44,
+    0x30, 0x60, 0x40, 0x28, 0x27, 0x30, 0xf, 0x35, 0xb3, 0x6b, 0x60,
+
+    /* U+0026 "&" */
+    0x0, 0xe5, 0x9b, 0xb4, 0xa0, 0x7, 0xf8, 0x72, 0x99, 0x10, 0xd7, 0x20, 0x1f, 0xd4, 0x60, 0xf7,
+    0x66, 0x6, 0x60, 0x7, 0xc4, 0x81, 0x10, 0x44, 0x4a, 0x86, 0x80, 0x7c, 0xc0, 0x4, 0x0, 0xda,
+    0xe, 0x1, 0xf3, 0x80, 0x18, 0x3, 0x58, 0x30, 0x7, 0xc6, 0x41, 0x2, 0x3, 0x46, 0x12, 0x1,
+    0xfa, 0x0, 0xa9, 0x31, 0x42, 0x8c, 0x3, 0xf2, 0xb8, 0x25, 0x91, 0x2d, 0x40, 0x3f, 0x84, 0x40,
+    0x10, 0xe2, 0x0, 0x7f, 0x1e, 0x30, 0x18, 0xd, 0x80, 0x61, 0x10, 0x4, 0x9a, 0x44, 0xcc, 0x30,
+    0x2d, 0x80, 0x4d, 0xd2, 0x3, 0x42, 0x78, 0x61, 0x2c, 0x9, 0x60, 0xb, 0x1, 0x6, 0x10, 0xf1,
+    0x0, 0xa5, 0x81, 0x2c, 0xcc, 0x18, 0x1a, 0x2, 0x60, 0x1d, 0x2e, 0x9, 0xa0, 0x48, 0x1, 0x8,
+    0x7, 0xd0, 0xe0, 0x21, 0x0, 0xd, 0x0, 0x40, 0x7, 0xdc, 0x1, 0x70, 0x83, 0x8, 0x3d, 0x20,
+    0x88, 0x9b, 0x24, 0x8, 0x12, 0x84, 0x5a, 0x20, 0xb7, 0xdc, 0xd9, 0x30, 0x7d, 0x80, 0x49, 0x3,
+    0xf7, 0x31, 0x0, 0x9, 0xbe, 0xc0, 0x3c, 0x9c, 0x80,
+
+    /* U+0027 "'" */
+    0x29, 0x90, 0x89, 0x98, 0x1, 0xfc, 0x20, 0x1, 0x0, 0xf0, 0x81, 0x89, 0x80,
+
+    /* U+0028 "(" */
+    0x0, 0x8f, 0x30, 0x80, 0x14, 0x18, 0xa0, 0x0, 0xd0, 0x28, 0x2, 0xa0, 0x16, 0x0, 0x9c, 0x10,
+    0x40, 0x8, 0x21, 0xe0, 0x16, 0x0, 0x10, 0x2, 0x30, 0x21, 0x0, 0x94, 0x18, 0x2, 0x11, 0x1,
+    0x80, 0x44, 0x0, 0xf0, 0x9, 0xc0, 0x2, 0x1, 0xe3, 0x0, 0x84, 0x3, 0xc2, 0x1, 0xe7, 0x0,
+    0x18, 0x4, 0x20, 0x1, 0x0, 0x8c, 0x1, 0xc0, 0x10, 0x90, 0x10, 0x6, 0x70, 0x50, 0xd, 0xa0,
+    0x24, 0x1, 0x28, 0x1, 0x40, 0x22, 0x30, 0xb0, 0xd, 0x40, 0x66, 0x0, 0x98, 0x82, 0x40, 0x35,
+    0x82, 0x98, 0x4, 0xd7, 0x61,
+
+    /* U+0029 ")" */
+    0xac, 0x80, 0xb, 0x4d, 0xcc, 0x0, 0xc2, 0x12, 0x0, 0x16, 0x5, 0x20, 0x6, 0x0, 0x14, 0x0,
+    0x82, 0x18, 0x1, 0x38, 0x20, 0x80, 0x3c, 0x0, 0x40, 0x2, 0x0, 0x28, 0x1, 0x40, 0x1c, 0x0,
+    0x10, 0x1, 0x0, 0x42, 0x2, 0x1, 0x18, 0x38, 0x7, 0xfc, 0xe0, 0x11, 0x80, 0x80, 0x42, 0x6,
+    0x0, 0x20, 0x0, 0x80, 0x1c, 0x1, 0xa0, 0x2, 0x0, 0x38, 0x3, 0x0, 0x48, 0x5, 0x1, 0xc0,
+    0xe, 0x0, 0xd0, 0x6, 0x81, 0x20, 0x22, 0x2, 0xc0, 0x1e, 0x4, 0xc0, 0xf, 0xbf, 0x0, 0x80,
+
+    /* U+002A "*" */
+    0x0, 0xc7, 0x8a, 0x1, 0xfc, 0x66, 0x0, 0xeb, 0x50, 0xe, 0x3b, 0x24, 0x45, 0x5a, 0x87, 0x56,
+    0x22, 0x5a, 0xa9, 0x20, 0xea, 0x76, 0xc0, 0x54, 0xe0, 0x12, 0x6a, 0x0, 0x13, 0x1c, 0x2, 0x4c,
+    0x50, 0x4b, 0x36, 0xa0, 0x88, 0x1d, 0x3a, 0x36, 0x4b, 0x0, 0xbe, 0x33, 0x2, 0x4c, 0x3, 0x8a,
+    0x44, 0x3, 0xa, 0x90, 0x6,
+
+    /* U+002B "+" */
+    0x0, 0xf7, 0x71, 0x40, 0x3f, 0xe1, 0x10, 0x7, 0xff, 0x90, 0xb7, 0x78, 0x1, 0x7b, 0xb9, 0x80,
+    0x8b, 0x80, 0x2, 0x45, 0x80, 0xea, 0xb8, 0x0, 0xf5, 0x59, 0x5, 0x57, 0x80, 0x1a, 0xab, 0x88,
+    0x3, 0xff, 0xc9, 0x54, 0x70, 0xe,
+
+    /* U+002C "," */
+    0x7, 0x92, 0x78, 0x6f, 0xe0, 0x1, 0x50, 0x81, 0x99, 0xc2, 0x81, 0x1, 0xc8, 0x88, 0x28, 0x1a,
+    0x0,
+
+    /* U+002D "-" */
+    0x5d, 0xdf, 0x88, 0xc8, 0xbe, 0x5, 0x88, 0xf8, 0xc0,
+
+    /* U+002E "." */
+    0x7, 0x92, 0x88, 0x37, 0x90, 0x0, 0xa4, 0x86, 0x0,
+
+    /* U+002F "/" */
+    0x0, 0xfe, 0x69, 0x70, 0xf, 0xe8, 0x6f, 0x0, 0xfc, 0x82, 0x14, 0x1, 0xfb, 0x40, 0xc8, 0x3,
+    0xe1, 0x70, 0xb0, 0xf, 0xc8, 0x20, 0xa0, 0x1f, 0xbc, 0x10, 0x80, 0x3e, 0x15, 0xd, 0x0, 0xfc,
+    0xe0, 0x7, 0x0, 0xfd, 0xa0, 0xa2, 0x1, 0xf1, 0x20, 0x78, 0x7, 0xe5, 0x1, 0x40, 0xf, 0xd6,
+    0x8, 0x20, 0x1f, 0x11, 0x87, 0x0, 0x7e, 0xa0, 0x14, 0x0, 0xfc, 0xa0, 0xe0, 0x1f, 0x8c, 0x82,
+    0x80, 0x3f, 0x58, 0x11, 0x80, 0x7e, 0x60, 0x50, 0xf, 0xc8, 0x21, 0x40, 0x1f, 0xb4, 0xc, 0x80,
+    0x3f, 0x38, 0x58, 0x7, 0xe5, 0x10, 0x50, 0xf, 0xde, 0x8, 0x40, 0x1f, 0xa, 0x86, 0x80, 0x7e,
+    0x70, 0x3, 0x80, 0x7f, 0x34, 0x8, 0x7, 0xe0,
+
+    /* U+0030 "0" */
+    0x0, 0xe4, 0x9b, 0xcb, 0x72, 0x0, 0xfc, 0x59, 0x6c, 0x86, 0x91, 0xb0, 0x1, 0xe2, 0xc3, 0x0,
+    0x1a, 0x10, 0x1, 0xec, 0x3, 0xbc, 0x41, 0x77, 0x2f, 0x6c, 0x81, 0x20, 0x2, 0x72, 0x5, 0xa2,
+    0x0, 0x93, 0xc4, 0x1c, 0x80, 0x14, 0x0, 0x80, 0xf, 0x14, 0x0, 0x28, 0xc, 0x81, 0x48, 0x3,
+    0xe6, 0x10, 0x50, 0x50, 0x6, 0x0, 0x7f, 0x28, 0x10, 0xf0, 0x0, 0x80, 0x3f, 0x88, 0x0, 0x42,
+    0x0, 0x70, 0xf, 0xe1, 0x0, 0x39, 0x80, 0x7f, 0xef, 0x0, 0x9, 0x80, 0x1c, 0x3, 0xfb, 0xc0,
+    0x3, 0xc0, 0x1, 0x0, 0xfe, 0x20, 0x3, 0x18, 0x3, 0x40, 0x3f, 0x9c, 0x4, 0x94, 0x41, 0x40,
+    0x3f, 0x19, 0x2, 0x0, 0xb8, 0x13, 0x0, 0x7d, 0x0, 0xf, 0x0, 0x58, 0x2, 0x50, 0x3, 0xa1,
+    0x0, 0xd4, 0x0, 0x52, 0x0, 0xba, 0x65, 0x7c, 0x70, 0x1e, 0x0, 0xcd, 0x0, 0x5, 0x9a, 0x83,
+    0x2, 0xd2, 0x0, 0xe7, 0xd6, 0x20, 0x0, 0x9c, 0x61, 0x80, 0x7c, 0x53, 0xbf, 0xdc, 0xc7, 0x10,
+    0xc,
+
+    /* U+0031 "1" */
+    0x79, 0x9f, 0x25, 0xb3, 0x78, 0x98, 0x8b, 0x0, 0x55, 0xbb, 0x40, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xd8,
+
+    /* U+0032 "2" */
+    0x0, 0x85, 0xa6, 0xf2, 0xe5, 0x44, 0x3, 0x86, 0x3a, 0x59, 0xd, 0x1a, 0xb1, 0x0, 0x21, 0xd7,
+    0x0, 0x12, 0x29, 0x80, 0xa, 0xd0, 0x0, 0xa4, 0x9, 0x9b, 0x75, 0x9c, 0xa0, 0x8, 0x0, 0x26,
+    0xbd, 0x98, 0x6, 0x1a, 0x20, 0x32, 0x0, 0x1c, 0x0, 0x7e, 0x40, 0x3, 0x0, 0x7f, 0xf0, 0xdc,
+    0x3, 0xff, 0x20, 0x9, 0x0, 0x7f, 0xca, 0x40, 0xe2, 0x1, 0xfe, 0x3b, 0x1, 0xb0, 0xf, 0xf1,
+    0xe8, 0x85, 0x10, 0x7, 0xf1, 0xe8, 0x85, 0x20, 0x7, 0xf1, 0xe8, 0x85, 0x28, 0x7, 0xf2, 0x68,
+    0x85, 0x28, 0x7, 0xf2, 0x50, 0x8a, 0xd4, 0x3, 0xf9, 0x6c, 0x45, 0x48, 0x1, 0xfc, 0xb4, 0x3,
+    0xa8, 0x1, 0xfc, 0xb4, 0x0, 0x44, 0x3b, 0xfe, 0x10, 0xb0, 0x9, 0x62, 0x3f, 0x8c, 0x3, 0xff,
+    0x88,
+
+    /* U+0033 "3" */
+    0x9, 0x9f, 0xfe, 0x8, 0x1, 0xd9, 0xbf, 0xf0, 0x0, 0x8b, 0xf8, 0x40, 0x6, 0x0, 0xcd, 0xdf,
+    0xbc, 0x0, 0x3c, 0x1, 0xfc, 0x3c, 0x21, 0xa4, 0x1, 0xfd, 0x66, 0x12, 0x60, 0x1f, 0xd0, 0xa0,
+    0xcc, 0x0, 0xfe, 0x57, 0x4, 0x90, 0xf, 0xe3, 0xb0, 0x7, 0x8, 0x7, 0xf2, 0x8, 0x2, 0xba,
+    0x8c, 0x3, 0xe1, 0x22, 0x8, 0x1, 0x75, 0x40, 0x3c, 0xdb, 0xae, 0xc6, 0x1, 0xb1, 0x0, 0xfe,
+    0x39, 0x60, 0x16, 0x0, 0xff, 0xac, 0x1, 0xa0, 0x1f, 0xf1, 0x80, 0x4, 0x8, 0x3, 0xf9, 0x0,
+    0x4, 0x4c, 0x92, 0x0, 0xf1, 0x40, 0x3, 0x60, 0x5b, 0x6d, 0xd5, 0x16, 0x70, 0x81, 0x11, 0x6,
+    0x0, 0x48, 0xab, 0xa6, 0x10, 0x4a, 0x2, 0xcb, 0x63, 0x10, 0x8, 0x96, 0xac, 0x40, 0x24, 0x9c,
+    0xef, 0xef, 0xda, 0x50, 0x8,
+
+    /* U+0034 "4" */
+    0x0, 0xfe, 0x19, 0x94, 0x0, 0x7f, 0xf0, 0xa9, 0x99, 0x80, 0x1f, 0xfc, 0x18, 0x40, 0x84, 0x0,
+    0xff, 0xca, 0xe0, 0x8e, 0x1, 0xff, 0x8a, 0xc0, 0xa8, 0x3, 0xff, 0xf, 0x88, 0xb8, 0x40, 0x3f,
+    0xf5, 0x90, 0x41, 0x80, 0x7f, 0xe7, 0x50, 0x66, 0x0, 0x7f, 0xe4, 0x80, 0x39, 0x0, 0x9d, 0xca,
+    0x1, 0xe2, 0xa0, 0x1e, 0x0, 0xd3, 0x1e, 0x1, 0xee, 0x10, 0xa2, 0x0, 0xff, 0xd2, 0x61, 0x8,
+    0x1, 0xff, 0x99, 0x80, 0x48, 0x67, 0xe1, 0x1, 0x33, 0x86, 0x0, 0x5, 0x99, 0xf0, 0x1, 0x33,
+    0x27, 0x0, 0xff, 0xe3, 0x6e, 0x67, 0xf8, 0x0, 0x99, 0x93, 0x99, 0xff, 0x88, 0x0, 0x26, 0x70,
+    0x80, 0x7f, 0xfa, 0x80,
+
+    /* U+0035 "5" */
+    0x0, 0xc, 0xcf, 0xfc, 0x1, 0x89, 0x9b, 0xfe, 0x0, 0xce, 0x0, 0x22, 0xfe, 0x0, 0xc4, 0x0,
+    0xed, 0xdf, 0xc0, 0x18, 0x40, 0x2, 0x1, 0xff, 0xb8, 0x0, 0x40, 0x1f, 0xf8, 0xc0, 0x40, 0x3f,
+    0xf8, 0x2c, 0x4, 0x1, 0xff, 0xc1, 0x10, 0x2c, 0xc5, 0xda, 0x58, 0x40, 0x3c, 0x40, 0x26, 0x64,
+    0x43, 0x4f, 0x48, 0x80, 0x42, 0xab, 0xc8, 0x60, 0x13, 0x68, 0x4, 0x35, 0x5d, 0x79, 0xf4, 0x20,
+    0x6e, 0x1, 0xff, 0x2e, 0x80, 0x28, 0x3, 0xff, 0x19, 0x80, 0x84, 0x3, 0xff, 0x38, 0x6, 0x20,
+    0xf, 0xe1, 0x50, 0x11, 0x4, 0xe2, 0x0, 0x7d, 0x62, 0xe, 0x8, 0x83, 0xbc, 0x85, 0x45, 0x8d,
+    0x50, 0x1b, 0x4, 0x70, 0x1, 0xbd, 0x5d, 0x39, 0x0, 0xd1, 0x0, 0x23, 0x5d, 0x4, 0x2, 0x14,
+    0x8f, 0x40, 0xc, 0x51, 0x7d, 0xfd, 0xfd, 0x6e, 0x20, 0x10,
+
+    /* U+0036 "6" */
+    0x0, 0xe1, 0x59, 0xbc, 0xc5, 0x39, 0x0, 0x79, 0xfe, 0x99, 0xc, 0xcb, 0x1a, 0x80, 0x1a, 0xa0,
+    0x40, 0x95, 0x94, 0xc0, 0x90, 0x2, 0x95, 0x2, 0xbd, 0xa9, 0xac, 0xee, 0x0, 0x48, 0xc0, 0x78,
+    0x80, 0x1c, 0x26, 0x1, 0x78, 0x3, 0xc4, 0x3, 0xfc, 0x48, 0x8, 0x60, 0x1f, 0xf3, 0x80, 0x34,
+    0x3, 0xff, 0x68, 0x0, 0x80, 0xe3, 0x37, 0x2d, 0x84, 0x2, 0x10, 0x3, 0xce, 0x39, 0x91, 0xa4,
+    0xfa, 0x80, 0xc, 0x1, 0xec, 0xb, 0x13, 0x6, 0x3, 0x4a, 0x6, 0x0, 0x31, 0xca, 0x76, 0x7c,
+    0x90, 0x4, 0x0, 0x80, 0x54, 0x60, 0x1c, 0xcc, 0x2, 0x4d, 0x0, 0xa, 0x0, 0x7d, 0xa0, 0x3,
+    0x70, 0x1, 0x80, 0x7f, 0xe2, 0x40, 0x22, 0x0, 0x7c, 0x60, 0x2, 0xf, 0x0, 0x48, 0x7, 0x8a,
+    0x40, 0x50, 0x11, 0x81, 0x35, 0x88, 0x49, 0xf0, 0x42, 0x4, 0x1, 0x2e, 0x5, 0x3b, 0xdb, 0x2,
+    0x10, 0xc0, 0x1a, 0x35, 0x88, 0x2, 0x26, 0xc7, 0x0, 0xf1, 0x4e, 0xff, 0x7e, 0xc9, 0x80, 0x40,
+
+    /* U+0037 "7" */
+    0x19, 0x9f, 0xfe, 0x13, 0x1b, 0x37, 0xff, 0xb, 0xc0, 0x21, 0x22, 0xfc, 0x20, 0x1, 0x0, 0x9b,
+    0x77, 0xf1, 0x0, 0x28, 0x3, 0xfe, 0x43, 0x5, 0x20, 0xf, 0xfb, 0xc0, 0x12, 0x7, 0x54, 0xb0,
+    0xf, 0x1a, 0x2, 0x18, 0xa, 0xa8, 0xc0, 0x3d, 0x40, 0xf, 0x0, 0xff, 0x85, 0x80, 0x90, 0x3,
+    0xfe, 0x90, 0x5, 0x80, 0x7f, 0xc2, 0xc0, 0x2e, 0x1, 0xff, 0x38, 0x83, 0x8, 0x7, 0xfd, 0x60,
+    0x9, 0x0, 0xff, 0x94, 0x81, 0x84, 0x3, 0xfe, 0x90, 0x5, 0x0, 0x7f, 0xc8, 0x60, 0x86, 0x1,
+    0xff, 0x70, 0x3, 0xc0, 0x3f, 0xe2, 0x50, 0x34, 0x0, 0xff, 0xac, 0x1, 0x40, 0x1f, 0xf0, 0xb8,
+    0x13, 0x0, 0x7c,
+
+    /* U+0038 "8" */
+    0x0, 0xc7, 0x17, 0x98, 0xb8, 0x30, 0xf, 0x15, 0xe3, 0xa1, 0x99, 0x1f, 0x2c, 0x80, 0x22, 0xf4,
+    0x1, 0x68, 0x83, 0x8, 0x27, 0x90, 0x2, 0xc8, 0x17, 0xe5, 0xdd, 0x3e, 0xc0, 0x50, 0x0, 0x70,
+    0x1a, 0x10, 0xc, 0x32, 0x40, 0x80, 0x22, 0x5, 0x0, 0xfc, 0xe0, 0x23, 0x81, 0x80, 0x3f, 0x30,
+    0x8, 0x81, 0xc0, 0x9c, 0x3, 0xcc, 0x60, 0xe0, 0x8, 0x20, 0x8b, 0x64, 0x43, 0x5c, 0x81, 0x40,
+    0x0, 0x71, 0x1, 0x26, 0xed, 0x28, 0x9, 0x82, 0x0, 0x1b, 0x40, 0x8, 0x44, 0x1, 0x25, 0x88,
+    0x2, 0x94, 0x12, 0xff, 0xb9, 0xf6, 0x80, 0xba, 0xc, 0x80, 0xb6, 0x80, 0x19, 0x2d, 0x40, 0xdb,
+    0x0, 0x12, 0x1, 0xfa, 0x0, 0x18, 0x20, 0x2, 0x0, 0xfc, 0x60, 0x6, 0x10, 0x2, 0x80, 0x7e,
+    0x20, 0x3, 0x78, 0x2, 0x4, 0x3, 0xc3, 0xe0, 0xc, 0x53, 0x3, 0xc7, 0x31, 0x11, 0xbe, 0x18,
+    0x1b, 0x6, 0xa0, 0x14, 0x67, 0x73, 0x20, 0x80, 0xf4, 0x0, 0x37, 0x4a, 0x42, 0x0, 0x12, 0x5a,
+    0xc1, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0xc5, 0x15, 0x97, 0x4c, 0x20, 0x1e, 0x19, 0xd7, 0x53, 0x45, 0x9f, 0x60, 0xe, 0xa6, 0x1,
+    0x68, 0x75, 0x11, 0x4c, 0x0, 0x50, 0x80, 0xbf, 0x2f, 0x15, 0x86, 0xe, 0xa0, 0x6, 0x2, 0xb1,
+    0x0, 0xc5, 0xa2, 0x10, 0x4, 0x20, 0x82, 0x1, 0xe1, 0x70, 0x24, 0x10, 0x0, 0x80, 0x7e, 0x10,
+    0x6, 0x10, 0x0, 0xc0, 0x3f, 0x20, 0x0, 0xc4, 0xc1, 0x10, 0x1, 0xe6, 0x30, 0x3, 0x4, 0x80,
+    0x2e, 0x8, 0x0, 0x73, 0x20, 0x8, 0xc1, 0x60, 0x0, 0xfb, 0xfe, 0xc6, 0x9, 0x20, 0x30, 0x3,
+    0xda, 0x0, 0x72, 0x63, 0x18, 0x7, 0x25, 0xf6, 0x5e, 0x75, 0x98, 0x88, 0x18, 0x3, 0x84, 0xd0,
+    0xc4, 0x0, 0xa0, 0xc, 0x0, 0xff, 0xdc, 0x0, 0x40, 0xf, 0xf9, 0x14, 0x10, 0xc0, 0x3f, 0xcb,
+    0x40, 0x8, 0x0, 0x9f, 0x1d, 0xd, 0x1a, 0xe8, 0x42, 0x4c, 0x2, 0xa3, 0x8b, 0xcb, 0x94, 0x1,
+    0xa6, 0x0, 0xd6, 0x62, 0x1, 0xa, 0x4f, 0xa8, 0x7, 0x36, 0x77, 0xf7, 0xf5, 0xb0, 0x80, 0x60,
+
+    /* U+003A ":" */
+    0x2c, 0xe6, 0xb3, 0x18, 0x0, 0xd0, 0xa7, 0x43, 0x58, 0x80, 0x1f, 0xfc, 0xd7, 0x92, 0x88, 0x37,
+    0x90, 0x0, 0xa4, 0x86, 0x0,
+
+    /* U+003B ";" */
+    0x2c, 0xe6, 0xb3, 0x18, 0x0, 0xd0, 0xa7, 0x43, 0x58, 0x80, 0x1f, 0xfc, 0xd7, 0x92, 0x78, 0x6f,
+    0xe0, 0x1, 0x50, 0x81, 0x99, 0xc2, 0x81, 0x1, 0xc8, 0x88, 0x28, 0x1a, 0x0,
+
+    /* U+003C "<" */
+    0x0, 0xff, 0x8e, 0x58, 0x3, 0xf0, 0xb6, 0x61, 0x80, 0x3e, 0x39, 0xf9, 0x30, 0x45, 0x0, 0x85,
+    0xf3, 0xc, 0x25, 0x1b, 0x66, 0x9, 0x5d, 0x6, 0xb, 0x7a, 0xe4, 0x0, 0x2b, 0x50, 0x39, 0xea,
+    0x40, 0xf, 0xc5, 0x4e, 0x20, 0x1f, 0x1a, 0x81, 0x4f, 0xd2, 0x0, 0x78, 0x6b, 0xa0, 0x85, 0x6f,
+    0x5c, 0x80, 0x38, 0x5f, 0x71, 0x84, 0xa3, 0x6d, 0x40, 0x3c, 0x73, 0xf2, 0x60, 0x94, 0xc0, 0x1f,
+    0xb, 0x66, 0x18, 0x40, 0x3f, 0xe3, 0x9f, 0x40,
+
+    /* U+003D "=" */
+    0x3, 0x3f, 0xfc, 0x25, 0x99, 0xff, 0x9c, 0x3, 0xff, 0x84, 0x5f, 0xff, 0xf9, 0x80, 0x3f, 0xfb,
+    0xc3, 0x33, 0xff, 0x90, 0xd9, 0xbf, 0xf1, 0x1b, 0x37, 0xfe, 0x20,
+
+    /* U+003E ">" */
+    0x2b, 0x50, 0xf, 0xfc, 0x95, 0xd0, 0x40, 0x1f, 0x8d, 0x84, 0x4f, 0xb6, 0xa0, 0x1e, 0x19, 0xf9,
+    0x40, 0x4a, 0xe8, 0x20, 0xe, 0x16, 0xbd, 0x72, 0x17, 0xdb, 0x61, 0x0, 0xe2, 0x8d, 0xb5, 0x4,
+    0x97, 0x0, 0xfc, 0x9c, 0x80, 0x1f, 0xc5, 0x1b, 0x68, 0x6, 0xa0, 0x10, 0xad, 0xeb, 0x90, 0xbe,
+    0xe1, 0x81, 0xcf, 0xd2, 0x2, 0x57, 0x41, 0x0, 0xb, 0x18, 0x44, 0xfb, 0x6a, 0x1, 0xf2, 0x57,
+    0x41, 0x0, 0x7c, 0x7b, 0x6a, 0x1, 0xfe,
+
+    /* U+003F "?" */
+    0x0, 0x85, 0xaa, 0xf2, 0xe5, 0x84, 0x3, 0xc, 0x74, 0xaa, 0x1a, 0x34, 0xfa, 0x80, 0x7, 0x1c,
+    0x0, 0x6c, 0xc5, 0x10, 0x1a, 0x40, 0x72, 0x5, 0xdc, 0x99, 0x57, 0xa8, 0x2, 0x1, 0xb2, 0x28,
+    0x80, 0x30, 0xd0, 0x81, 0x88, 0x1b, 0x80, 0x7e, 0x50, 0x1, 0x80, 0x7f, 0xcc, 0x2, 0x40, 0x1f,
+    0xe6, 0x20, 0x70, 0xf, 0xf2, 0xc8, 0x14, 0x0, 0x7f, 0x35, 0x1, 0x78, 0x80, 0x7e, 0x69, 0x2,
+    0xf2, 0x0, 0xfc, 0x30, 0x3, 0xe4, 0x1, 0xfc, 0xc2, 0x12, 0x40, 0x1f, 0xf1, 0x99, 0x0, 0x3f,
+    0xe7, 0xcc, 0x18, 0x7, 0xff, 0x38, 0x55, 0x0, 0x3f, 0xf5, 0x52, 0xd4, 0x3, 0xfe, 0x50, 0x6,
+    0x80, 0x7f, 0xcc, 0x25, 0x60, 0x1c,
+
+    /* U+0040 "@" */
+    0x0, 0xfe, 0x47, 0xab, 0xcb, 0xa8, 0x41, 0x0, 0xff, 0xe1, 0xc, 0x75, 0xc2, 0xa1, 0xa2, 0xbd,
+    0xfc, 0x90, 0x7, 0xfc, 0xde, 0xe2, 0xb3, 0x9b, 0xdb, 0x92, 0xc0, 0xda, 0xe0, 0x1f, 0xd3, 0x21,
+    0x6d, 0xa6, 0x32, 0x12, 0x36, 0x9f, 0x81, 0x8b, 0x10, 0xf, 0x53, 0xd, 0xc9, 0x0, 0x7f, 0xb,
+    0xe1, 0xa5, 0x0, 0x73, 0x28, 0xea, 0x0, 0x71, 0x10, 0x3, 0x8, 0x8b, 0x4d, 0x1c, 0x2, 0x18,
+    0xb, 0x30, 0x9, 0x2f, 0xf7, 0x5d, 0x46, 0x1f, 0xd0, 0x3c, 0x30, 0x40, 0x9, 0x15, 0x50, 0x5,
+    0x36, 0x80, 0x10, 0xae, 0x30, 0x6, 0x29, 0xb, 0x0, 0x30, 0x48, 0x5, 0xc, 0x7, 0x5d, 0xfb,
+    0x3, 0x22, 0x1, 0x98, 0x5c, 0xc, 0x48, 0xc0, 0x4, 0xe0, 0x7a, 0xa2, 0x4, 0xfa, 0x20, 0x1c,
+    0x2a, 0x28, 0x80, 0x70, 0x9, 0x40, 0x1c, 0x20, 0x1c, 0x72, 0x1, 0xec, 0x3, 0xf0, 0xd0, 0xb,
+    0x0, 0xc8, 0x3, 0xe6, 0x0, 0xf0, 0x87, 0x88, 0x8, 0x4, 0xc0, 0xa0, 0x1f, 0x84, 0x40, 0x1c,
+    0x60, 0x20, 0x1, 0x0, 0xff, 0xe5, 0x88, 0x83, 0xc0, 0x26, 0x5, 0x0, 0xfc, 0x22, 0x0, 0xe3,
+    0xf, 0xe0, 0x20, 0xb, 0x0, 0xc8, 0x3, 0xe6, 0x0, 0xf7, 0x81, 0xa0, 0x20, 0x4, 0xa0, 0xe,
+    0x10, 0xe, 0x38, 0x0, 0xe1, 0x70, 0x52, 0x20, 0xa8, 0x0, 0xa0, 0xf, 0x18, 0x84, 0xe3, 0x0,
+    0x81, 0x48, 0x6c, 0x58, 0x42, 0x82, 0x40, 0x27, 0x70, 0x14, 0xef, 0x63, 0x84, 0xc0, 0x16, 0xf2,
+    0x94, 0x0, 0x18, 0x8d, 0xc0, 0x28, 0xb6, 0x21, 0x11, 0x36, 0x32, 0xc1, 0x1, 0x36, 0x8, 0x0,
+    0x64, 0x21, 0x80, 0x24, 0x9d, 0xee, 0x6c, 0x98, 0x1, 0xf7, 0xf6, 0x44, 0x3, 0x24, 0x84, 0xc0,
+    0x80, 0x7f, 0xf2, 0x9a, 0x85, 0xf1, 0x84, 0x3, 0xe1, 0x60, 0xf, 0xfc, 0xb8, 0x85, 0x3f, 0x70,
+    0xec, 0xf3, 0x9d, 0x28, 0x1, 0xff, 0x8a, 0xf1, 0x41, 0x1e, 0x26, 0x18, 0xc5, 0x98, 0x1, 0xff,
+    0xc2, 0x3a, 0xec, 0xa9, 0x89, 0xad, 0xe9, 0x20, 0xf, 0x80,
+
+    /* U+0041 "A" */
+    0x0, 0xfc, 0x73, 0x27, 0x0, 0xff, 0xe2, 0xcb, 0x32, 0x8, 0x3, 0xff, 0x86, 0x4a, 0x1, 0x58,
+    0x7, 0xff, 0xe, 0x80, 0x6, 0xe, 0x20, 0x1f, 0xfc, 0x11, 0x60, 0x5f, 0x1, 0x60, 0xf, 0xfe,
+    0xb, 0x8, 0x49, 0x98, 0x24, 0x3, 0xff, 0x83, 0x40, 0x66, 0x9, 0x1, 0x60, 0xf, 0xf9, 0x88,
+    0x24, 0x0, 0xa4, 0x16, 0x1, 0xff, 0x50, 0x12, 0x80, 0x54, 0x4, 0x80, 0x1f, 0xc8, 0x61, 0x40,
+    0x19, 0x84, 0x3c, 0x3, 0xfb, 0xc0, 0x58, 0x3, 0xb, 0x82, 0x18, 0x7, 0xc6, 0x80, 0xe2, 0x1,
+    0xd6, 0x0, 0x90, 0xf, 0xa8, 0x1, 0xa4, 0x5e, 0x3, 0x5, 0x20, 0xe, 0x26, 0x0, 0x5e, 0xef,
+    0xc6, 0x0, 0xb0, 0xe, 0xa0, 0xf, 0xfe, 0x13, 0x88, 0x4, 0x2c, 0x7, 0xbd, 0xdf, 0xd0, 0x2,
+    0xc0, 0x13, 0x8, 0x51, 0x8, 0xff, 0x30, 0x84, 0x80, 0x54, 0x2, 0xe0, 0x1f, 0xe1, 0x60, 0x16,
+    0x5, 0x20, 0x61, 0x0, 0xff, 0xa4, 0x1, 0x61, 0x20, 0x9, 0x0, 0xff, 0xc2, 0xa0, 0x48,
+
+    /* U+0042 "B" */
+    0x19, 0x9f, 0xe8, 0x74, 0x10, 0xe, 0x66, 0xfe, 0x78, 0xbf, 0x70, 0xf, 0xa, 0xaf, 0x90, 0x40,
+    0x62, 0x80, 0x39, 0x6a, 0xbd, 0x7d, 0x42, 0xa, 0xa0, 0xf, 0xfe, 0xa, 0xd8, 0x3, 0x0, 0x3f,
+    0xf8, 0x48, 0x0, 0x20, 0xf, 0xfe, 0x11, 0x80, 0x8, 0x3, 0xff, 0x85, 0x60, 0xc, 0x0, 0xe1,
+    0x1f, 0x12, 0xdb, 0x2, 0x28, 0x6, 0x4e, 0xef, 0x6d, 0x20, 0x2d, 0x0, 0x7f, 0xf1, 0x12, 0x44,
+    0x3, 0x1e, 0x67, 0xae, 0x9c, 0x85, 0xe8, 0x3, 0x39, 0x9f, 0x91, 0x63, 0x10, 0x11, 0x40, 0x3f,
+    0xf8, 0x23, 0x0, 0xf, 0x0, 0xff, 0xe1, 0x10, 0x1, 0x80, 0x3f, 0xf8, 0x44, 0x0, 0x60, 0xf,
+    0xfe, 0x8, 0xc0, 0x3, 0x40, 0x27, 0x44, 0xf9, 0x63, 0xd0, 0x9, 0x80, 0x23, 0xbb, 0xfa, 0x9c,
+    0x40, 0xfc, 0x40, 0x3f, 0xe1, 0x36, 0xac, 0x20,
+
+    /* U+0043 "C" */
+    0x0, 0xf0, 0xac, 0xde, 0x5d, 0x39, 0x80, 0x7c, 0x31, 0xf4, 0xc8, 0x68, 0xb1, 0x96, 0x60, 0x18,
+    0xf1, 0xc4, 0x0, 0x6a, 0x84, 0x0, 0x4c, 0x60, 0x1, 0xe9, 0x1, 0x4f, 0x65, 0x5e, 0xe9, 0x80,
+    0x14, 0x3, 0xc2, 0xb, 0x8c, 0x20, 0x18, 0xa6, 0xd3, 0x42, 0x48, 0x12, 0x84, 0x3, 0xf2, 0x58,
+    0x89, 0x80, 0x12, 0x1, 0xff, 0xc1, 0x51, 0x6, 0x20, 0xf, 0xfe, 0xe, 0x0, 0x30, 0x3, 0xff,
+    0x84, 0x20, 0x6, 0x0, 0xff, 0xea, 0x8, 0x1, 0xc0, 0x3f, 0xf8, 0x5c, 0x0, 0x30, 0xf, 0xfe,
+    0x12, 0x0, 0x28, 0x3, 0xff, 0x84, 0x48, 0x4, 0xe0, 0x1f, 0xfc, 0x28, 0x0, 0x42, 0x80, 0x7f,
+    0xa, 0x80, 0xe, 0x0, 0x15, 0x2, 0x1, 0xe3, 0xda, 0x80, 0x3, 0xb8, 0x0, 0xff, 0x2c, 0x8a,
+    0xf7, 0x86, 0x6, 0x1, 0x45, 0x8, 0xb, 0x4d, 0xd4, 0x20, 0x1, 0xec, 0x3, 0x2f, 0x52, 0x90,
+    0x4, 0x28, 0xfb, 0x0, 0x1f, 0x2d, 0x6f, 0xf7, 0xf5, 0xc1, 0x0, 0x0,
+
+    /* U+0044 "D" */
+    0x19, 0x9f, 0xe8, 0x63, 0x0, 0xfc, 0xcd, 0xfc, 0xf3, 0x9a, 0xe0, 0x1f, 0x84, 0x8b, 0xc2, 0x0,
+    0x28, 0xd3, 0x0, 0xf2, 0xee, 0xfb, 0xb6, 0x8, 0xb, 0x50, 0x3, 0xff, 0x82, 0x4f, 0x8c, 0x3,
+    0x44, 0x1, 0xff, 0xc2, 0x19, 0x60, 0x18, 0x0, 0xff, 0xe2, 0x41, 0x2, 0x90, 0x7, 0xff, 0xc,
+    0x68, 0x0, 0x80, 0x1f, 0xfc, 0x44, 0x0, 0x60, 0x7, 0xff, 0x10, 0x80, 0x2, 0x1, 0xff, 0xd8,
+    0x30, 0x0, 0x80, 0x7f, 0xf1, 0x1c, 0x0, 0x40, 0x1f, 0xfc, 0x4e, 0x0, 0x60, 0x7, 0xff, 0xd,
+    0x50, 0xd, 0x0, 0x3f, 0xf8, 0x49, 0x60, 0x9, 0x0, 0xff, 0xe0, 0x8c, 0x58, 0x83, 0xa8, 0x6,
+    0x67, 0x7f, 0x45, 0xf3, 0x80, 0x1e, 0x0, 0x38, 0xa2, 0x3c, 0xe8, 0x0, 0x2b, 0x80, 0xf, 0xfe,
+    0x8, 0x9b, 0x5e, 0xa0, 0x6,
+
+    /* U+0045 "E" */
+    0x19, 0x9f, 0xfe, 0xb, 0x80, 0x19, 0xbf, 0xf8, 0x36, 0x1, 0x84, 0x8b, 0xfc, 0xc0, 0x19, 0x77,
+    0x7f, 0xd4, 0x1, 0xff, 0xf8, 0x72, 0x2f, 0xe1, 0x0, 0xe3, 0xdd, 0xfe, 0x80, 0xf, 0xfe, 0x49,
+    0xdd, 0xff, 0x80, 0x39, 0xd1, 0x3f, 0x88, 0x3, 0xff, 0xf2, 0xce, 0xff, 0xf0, 0x80, 0x45, 0x11,
+    0xff, 0x18, 0x7, 0xff, 0x10,
+
+    /* U+0046 "F" */
+    0x19, 0x9f, 0xfe, 0xb, 0x83, 0x37, 0xff, 0x6, 0xc0, 0x21, 0x22, 0xff, 0x30, 0x4, 0xbb, 0xbf,
+    0xea, 0x0, 0xff, 0xff, 0x80, 0x4e, 0xab, 0xfc, 0x60, 0x18, 0xea, 0xbf, 0xc0, 0x1f, 0xfc, 0x74,
+    0xee, 0xfe, 0x80, 0xe, 0x11, 0xff, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xf8, 0x80,
+
+    /* U+0047 "G" */
+    0x0, 0xf0, 0xac, 0xde, 0x62, 0xa0, 0xc0, 0x3f, 0xc, 0x7d, 0x32, 0x19, 0x95, 0xf3, 0x54, 0x3,
+    0x8f, 0x1c, 0x40, 0x6, 0x88, 0x30, 0x1, 0x54, 0x80, 0x47, 0xa4, 0x5, 0x3d, 0x97, 0x6c, 0xe8,
+    0x10, 0x72, 0x1, 0xe1, 0x5, 0xc6, 0x10, 0xc, 0x2f, 0x89, 0x84, 0x12, 0x40, 0x94, 0x20, 0x1f,
+    0x8a, 0xc8, 0x5, 0x80, 0x12, 0x1, 0xff, 0xc2, 0x51, 0x6, 0x20, 0xf, 0xfe, 0x16, 0x0, 0x30,
+    0x3, 0xff, 0x86, 0x20, 0x6, 0x0, 0xff, 0xe9, 0x3f, 0x70, 0xc4, 0x0, 0xe0, 0x1f, 0xf8, 0x44,
+    0x1c, 0x0, 0xc0, 0xf, 0xfe, 0x1a, 0x0, 0x14, 0x3, 0xff, 0x86, 0x4a, 0x4, 0xe0, 0x1f, 0xfc,
+    0x39, 0x0, 0x42, 0x80, 0x7f, 0xf0, 0x8e, 0x0, 0x15, 0x2, 0x1, 0xe1, 0xd0, 0xe, 0x78, 0x0,
+    0x3f, 0xcb, 0x2a, 0x9a, 0xbd, 0x40, 0x3c, 0xf6, 0x40, 0x2d, 0x35, 0x49, 0x51, 0x3, 0xc3, 0x0,
+    0xc9, 0xb4, 0xa4, 0x1, 0x9, 0xad, 0xe1, 0x80, 0x7c, 0xb5, 0xbf, 0xdf, 0xd9, 0x48, 0x1,
+
+    /* U+0048 "H" */
+    0x19, 0x93, 0x80, 0x7f, 0xd3, 0x27, 0x6, 0x66, 0x0, 0x7f, 0xcc, 0xcb, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xf6, 0x1c, 0xcf, 0xfe, 0x0, 0xf1, 0xe6, 0x7f, 0xc0, 0x1f, 0xfc, 0xc3, 0xbb, 0xff, 0x80,
+    0x3c, 0xe8, 0x9f, 0xf0, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xd4,
+
+    /* U+0049 "I" */
+    0x19, 0x93, 0x83, 0x33, 0x0, 0x3f, 0xff, 0x80,
+
+    /* U+004A "J" */
+    0x0, 0x14, 0xcf, 0xf2, 0x80, 0x19, 0xbf, 0xd8, 0x0, 0x72, 0x2f, 0x80, 0x38, 0xf7, 0x7d, 0xc0,
+    0x1f, 0xff, 0xf0, 0xf, 0xff, 0xd0, 0x80, 0xc, 0x3, 0xca, 0x0, 0xe0, 0x7c, 0x50, 0xe, 0xa0,
+    0x2, 0xc, 0x85, 0x51, 0x4d, 0x70, 0xc1, 0x8, 0x68, 0x41, 0x6b, 0x28, 0xc0, 0xa4, 0x0, 0x98,
+    0xe4, 0x0, 0x13, 0x7c, 0x20, 0x8, 0xa3, 0x7f, 0xb9, 0x90, 0x20, 0x0,
+
+    /* U+004B "K" */
+    0x19, 0x93, 0x80, 0x7f, 0xa2, 0x64, 0x60, 0xcc, 0xc0, 0xf, 0xea, 0x76, 0x13, 0x0, 0xff, 0xd4,
+    0xa0, 0xd0, 0x1, 0xff, 0xa5, 0x41, 0xa4, 0x3, 0xff, 0x4b, 0x2, 0xc8, 0x7, 0xfe, 0x96, 0x4,
+    0xa0, 0xf, 0xfd, 0xc, 0x9, 0x40, 0x1f, 0xfa, 0x1c, 0xe, 0x84, 0x3, 0xfe, 0x77, 0x1, 0xe8,
+    0x80, 0x7f, 0xcf, 0x0, 0xb, 0x10, 0xf, 0xf9, 0xe0, 0x2, 0x84, 0x0, 0xff, 0x2c, 0x0, 0xb0,
+    0x2, 0x88, 0x3, 0xf8, 0x40, 0x76, 0x58, 0x7, 0xc4, 0x3, 0xf8, 0x74, 0xc2, 0x50, 0xa, 0x80,
+    0x3f, 0xe, 0x98, 0x5, 0x44, 0x9, 0x0, 0x1f, 0x29, 0x80, 0x61, 0xf1, 0x7, 0x60, 0xf, 0xfe,
+    0x9, 0x68, 0x84, 0xa0, 0x7, 0xff, 0x4, 0xec, 0x1, 0x44, 0x1, 0xff, 0xc1, 0x58, 0x1, 0xe1,
+    0x0, 0xff, 0xe0, 0xbb, 0x1, 0xd8,
+
+    /* U+004C "L" */
+    0x19, 0x93, 0x80, 0x7f, 0xe6, 0x66, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0,
+    0xf, 0xfe, 0x13, 0x3b, 0xff, 0x88, 0x2, 0x28, 0x8f, 0xf3, 0x80, 0x7f, 0xf0, 0xc0,
+
+    /* U+004D "M" */
+    0x19, 0x92, 0x0, 0x7f, 0xf0, 0xda, 0x5c, 0x19, 0x92, 0x1, 0xff, 0xc2, 0x39, 0x6b, 0x0, 0x89,
+    0xc0, 0x3f, 0xf8, 0x30, 0x1, 0xf4, 0x90, 0x7, 0xfc, 0xa8, 0x1, 0xf0, 0xc0, 0x7, 0xf8, 0x60,
+    0x3, 0xf9, 0x50, 0x3, 0xfa, 0x48, 0x3, 0xe5, 0x10, 0x90, 0xf, 0xc4, 0xc0, 0xc2, 0x1, 0xc7,
+    0x60, 0x4e, 0x1, 0xf4, 0x8, 0xa0, 0x3, 0xe5, 0x40, 0x91, 0x0, 0xe4, 0x50, 0x81, 0x0, 0xfd,
+    0x0, 0x36, 0x1, 0xd0, 0x6, 0xc0, 0x1f, 0xc6, 0xe0, 0xa8, 0x1, 0x39, 0x84, 0x0, 0x7f, 0xd2,
+    0x21, 0x0, 0x1, 0x90, 0x54, 0x0, 0xff, 0x86, 0xc0, 0xd8, 0x20, 0x45, 0x0, 0x1f, 0xfc, 0x15,
+    0x40, 0x84, 0x60, 0x92, 0x0, 0xff, 0xe1, 0x40, 0xd, 0x81, 0x38, 0x6, 0x30, 0xf, 0xf1, 0xb8,
+    0x5, 0x20, 0x1f, 0xfc, 0x59, 0x10, 0x54, 0x0, 0xff, 0xe2, 0x8d, 0x34, 0x0, 0x7f, 0xf1, 0xd2,
+    0x48, 0x3, 0xff, 0xa6,
+
+    /* U+004E "N" */
+    0x19, 0x92, 0x0, 0x7f, 0xd3, 0x27, 0x6, 0x65, 0x18, 0x7, 0xf9, 0x99, 0x60, 0x10, 0xf0, 0x80,
+    0x7f, 0xf1, 0xa, 0x80, 0x3f, 0xf8, 0xa9, 0x0, 0x1f, 0xfc, 0x22, 0x10, 0x75, 0x0, 0xff, 0xe0,
+    0xb5, 0x80, 0x2c, 0xc0, 0x3f, 0xf8, 0x2a, 0xe0, 0x3c, 0x20, 0x1f, 0xfc, 0x18, 0x40, 0x2a, 0x0,
+    0xff, 0xe1, 0x51, 0x2, 0x40, 0x7, 0xff, 0x4, 0x78, 0x41, 0xd4, 0x3, 0xff, 0x82, 0x76, 0x0,
+    0xb3, 0x0, 0xff, 0xe0, 0xab, 0x80, 0xf0, 0x80, 0x7f, 0xf0, 0x61, 0x0, 0xa8, 0x3, 0xff, 0x85,
+    0x44, 0x9, 0x20, 0x1f, 0xfc, 0x11, 0xe1, 0x6, 0x0, 0xff, 0xe1, 0x1d, 0x80, 0x7f, 0xf1, 0x55,
+    0xc0, 0x3f, 0xf8, 0xb0, 0xa0, 0x1f, 0xfc, 0x5b, 0x20, 0x0,
+
+    /* U+004F "O" */
+    0x0, 0xf0, 0xac, 0xde, 0x62, 0x9c, 0xc0, 0x3f, 0xe1, 0x8f, 0xa6, 0x43, 0x32, 0xc6, 0x61, 0x0,
+    0x3f, 0x1e, 0x38, 0x80, 0xd, 0x50, 0x80, 0x7, 0x72, 0x1, 0xe3, 0xd2, 0x2, 0x9f, 0xca, 0xbd,
+    0xd3, 0x0, 0x1a, 0x80, 0x30, 0xf0, 0x82, 0xe3, 0x0, 0x71, 0x4d, 0x88, 0x2b, 0x0, 0x4c, 0x40,
+    0x94, 0x20, 0x1f, 0x92, 0x80, 0x10, 0x20, 0x32, 0x0, 0x90, 0xf, 0xf9, 0x1c, 0x5, 0x81, 0x44,
+    0x18, 0x80, 0x3f, 0xf5, 0x0, 0x2c, 0x30, 0x1, 0x80, 0x1f, 0xfc, 0x12, 0x30, 0x31, 0x10, 0x1,
+    0x80, 0x3f, 0xf8, 0x4c, 0x0, 0x30, 0xf, 0xfe, 0x50, 0x80, 0x1c, 0x3, 0xff, 0x84, 0x20, 0x3,
+    0xe0, 0x1, 0x80, 0x7f, 0xf0, 0x94, 0x4, 0x48, 0x0, 0xa0, 0xf, 0xfe, 0xa, 0x88, 0x20, 0x12,
+    0x81, 0x38, 0x7, 0xfc, 0x30, 0x0, 0x90, 0x4, 0x80, 0x21, 0x40, 0x3f, 0xd4, 0x40, 0x86, 0x0,
+    0x38, 0x0, 0x54, 0x8, 0x7, 0x8f, 0x10, 0x6, 0x80, 0x33, 0xc0, 0x1, 0xfe, 0x59, 0x15, 0xef,
+    0xc, 0xb, 0x4, 0x3, 0x9e, 0xc8, 0x5, 0xa6, 0xea, 0x10, 0x0, 0xb8, 0x40, 0x1f, 0x26, 0xd2,
+    0x90, 0x4, 0x28, 0xfb, 0x42, 0x1, 0xfe, 0x5a, 0xdf, 0xef, 0xeb, 0x82, 0x0, 0xf0,
+
+    /* U+0050 "P" */
+    0x19, 0x9f, 0xd0, 0xe8, 0x1, 0xe6, 0x6f, 0xcf, 0x17, 0xce, 0x1, 0xe1, 0x22, 0xe1, 0x0, 0xc,
+    0x60, 0x80, 0x65, 0xdd, 0xee, 0xe4, 0x90, 0x1d, 0x80, 0x7f, 0xc2, 0xd8, 0x40, 0xa6, 0x1, 0xff,
+    0x86, 0xc0, 0x16, 0x1, 0xff, 0xc1, 0x40, 0x1, 0x0, 0x7f, 0xf0, 0x4c, 0x0, 0x20, 0x1f, 0xfc,
+    0x12, 0x0, 0x8, 0x7, 0xff, 0x6, 0x40, 0x18, 0x1, 0xff, 0xa1, 0x40, 0x5c, 0x2, 0x66, 0xf3,
+    0xce, 0xb8, 0x2, 0x84, 0x2, 0x29, 0x9e, 0x86, 0x20, 0x2b, 0x40, 0xf, 0xf8, 0x52, 0x71, 0x0,
+    0x39, 0x3b, 0xbb, 0xfa, 0xd8, 0x40, 0x3e, 0x11, 0xe0, 0xf, 0xff, 0xf8, 0x0,
+
+    /* U+0051 "Q" */
+    0x0, 0xf0, 0xac, 0xde, 0x62, 0x9c, 0xc0, 0x3f, 0xe1, 0x8f, 0xa6, 0x43, 0x32, 0xc6, 0x61, 0x0,
+    0x3f, 0x1e, 0x38, 0x80, 0xd, 0x50, 0x80, 0x7, 0x72, 0x1, 0xe3, 0xd2, 0x2, 0x9f, 0xca, 0xbd,
+    0xd3, 0x0, 0x1a, 0x80, 0x30, 0xf0, 0x82, 0xe3, 0x0, 0x71, 0x4d, 0x88, 0x2b, 0x0, 0x4c, 0x40,
+    0x94, 0x20, 0x1f, 0x92, 0x80, 0x10, 0x20, 0x32, 0x0, 0x90, 0xf, 0xf9, 0x1c, 0x5, 0x81, 0x44,
+    0x18, 0x80, 0x3f, 0xf5, 0x0, 0x2c, 0x30, 0x1, 0x80, 0x1f, 0xfc, 0x12, 0x30, 0x31, 0x10, 0x1,
+    0x80, 0x3f, 0xf8, 0x4c, 0x0, 0x30, 0xf, 0xfe, 0x50, 0x80, 0x1c, 0x3, 0xff, 0x84, 0x20, 0x3,
+    0xe0, 0x1, 0x80, 0x7f, 0xf0, 0x94, 0x4, 0x48, 0x0, 0xa0, 0xf, 0xfe, 0xa, 0x88, 0x20, 0x12,
+    0x81, 0x38, 0x7, 0xfc, 0x30, 0x0, 0xe0, 0x4, 0x80, 0x21, 0x40, 0x3f, 0xd4, 0x40, 0x88, 0x0,
+    0x1c, 0x0, 0x2a, 0x4, 0x3, 0xc7, 0x88, 0x5, 0x40, 0x19, 0xdc, 0x0, 0x7f, 0x96, 0x45, 0x7b,
+    0xc3, 0x2, 0xf1, 0x0, 0xe8, 0xa2, 0x1, 0x69, 0xba, 0x84, 0x0, 0x36, 0x10, 0x7, 0xcb, 0xb4,
+    0xa4, 0x1, 0x85, 0xf2, 0x44, 0x3, 0xfc, 0xb5, 0xbf, 0x0, 0x16, 0x18, 0x4, 0x34, 0x60, 0x1f,
+    0xe7, 0x90, 0x1b, 0xb3, 0x2c, 0x62, 0xf0, 0x7, 0xfc, 0xd8, 0x40, 0x93, 0x4e, 0x43, 0x20, 0x1f,
+    0xf8, 0xf6, 0x94, 0x88, 0x91, 0xe8,
+
+    /* U+0052 "R" */
+    0x19, 0x9f, 0xd0, 0xe8, 0x1, 0xe6, 0x6f, 0xcf, 0x17, 0xce, 0x1, 0xe1, 0x22, 0xe1, 0x0, 0xc,
+    0x60, 0x80, 0x65, 0xdd, 0xee, 0xe4, 0x90, 0x1d, 0x80, 0x7f, 0xc2, 0xd8, 0x40, 0xa6, 0x1, 0xff,
+    0x86, 0xc0, 0x16, 0x1, 0xff, 0xc1, 0x40, 0x1, 0x0, 0x7f, 0xf0, 0x4c, 0x0, 0x20, 0x1f, 0xfc,
+    0x12, 0x0, 0x8, 0x7, 0xff, 0x6, 0x40, 0x18, 0x1, 0xff, 0xa1, 0x40, 0x5c, 0x2, 0x75, 0x5e,
+    0x69, 0xd7, 0x0, 0x50, 0x80, 0x47, 0x55, 0xd2, 0xc4, 0x5, 0x68, 0x1, 0xff, 0xc1, 0x4d, 0x40,
+    0xe, 0x4e, 0xee, 0xf3, 0x4, 0x30, 0xf, 0x84, 0x78, 0x38, 0x43, 0x84, 0x3, 0xff, 0x14, 0x1,
+    0x40, 0x7, 0xff, 0x5, 0x90, 0x19, 0x40, 0x3f, 0xf8, 0x34, 0x21, 0x64, 0x1, 0xff, 0x86, 0xc0,
+    0x64,
+
+    /* U+0053 "S" */
+    0x0, 0xc9, 0x17, 0x98, 0xb9, 0x61, 0x0, 0xe3, 0xcb, 0x74, 0x33, 0x23, 0x4f, 0x48, 0x80, 0xf,
+    0x4c, 0x5, 0x19, 0x8a, 0x40, 0x6, 0x20, 0x7, 0x88, 0x3f, 0xdc, 0xca, 0xb7, 0x19, 0xc, 0xc,
+    0xc0, 0xb0, 0x20, 0x1c, 0x73, 0x60, 0x6, 0x0, 0x60, 0x7, 0xff, 0xf, 0xc0, 0x3f, 0xf2, 0x0,
+    0x19, 0x40, 0x3f, 0xe1, 0x70, 0x5, 0x63, 0x98, 0x7, 0xf4, 0x38, 0x0, 0xe3, 0x3a, 0x98, 0x40,
+    0x3d, 0x18, 0xc2, 0x0, 0x15, 0x9e, 0x91, 0x0, 0xe3, 0x9e, 0xc8, 0x41, 0x0, 0x36, 0x10, 0x7,
+    0xc6, 0xf7, 0xf4, 0x40, 0x52, 0x1, 0xfe, 0x15, 0xc2, 0x4, 0x20, 0xf, 0xf8, 0x50, 0x0, 0x20,
+    0x60, 0x1f, 0xfc, 0x11, 0x4c, 0x81, 0x0, 0xf8, 0xd8, 0x8, 0x9c, 0xf, 0xf4, 0xc8, 0x66, 0x59,
+    0xc0, 0x4, 0x5, 0xa8, 0xa, 0xcd, 0xe6, 0x29, 0x80, 0x10, 0xa0, 0x35, 0xae, 0x82, 0x1, 0x9,
+    0xbe, 0xb8, 0x6, 0x28, 0xbe, 0xfe, 0xfe, 0xc8, 0x20, 0x8,
+
+    /* U+0054 "T" */
+    0x89, 0x9f, 0xfe, 0x19, 0xab, 0x37, 0xff, 0x14, 0x8b, 0xc0, 0x1, 0x22, 0xf0, 0xde, 0xef, 0x70,
+    0x1, 0xf7, 0x7c, 0x80, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xc6,
+
+    /* U+0055 "U" */
+    0x29, 0x92, 0x80, 0x7f, 0x8e, 0x64, 0x62, 0xcc, 0xc0, 0xf, 0xf2, 0xb3, 0x40, 0x1f, 0xff, 0xf0,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0x48, 0x40, 0x6, 0x1, 0xfe, 0x10, 0x0, 0x98, 0x1, 0x80, 0x3f,
+    0xdc, 0x0, 0x71, 0x20, 0x31, 0x0, 0xfe, 0x40, 0x13, 0x5, 0x0, 0x48, 0x7, 0xe5, 0x20, 0x40,
+    0x5, 0x0, 0x1d, 0x80, 0x3c, 0x96, 0x0, 0x90, 0x1, 0x48, 0x2, 0x71, 0xd5, 0x4d, 0x76, 0x10,
+    0x73, 0x0, 0x9a, 0x44, 0xe, 0x2a, 0x92, 0x80, 0x8, 0x80, 0x7, 0x37, 0xc2, 0x8, 0x0, 0x4d,
+    0xf5, 0xc0, 0x20,
+
+    /* U+0056 "V" */
+    0x89, 0x90, 0x80, 0x7f, 0xf0, 0x66, 0x4e, 0xc, 0xd0, 0x7, 0xfe, 0x56, 0x60, 0x50, 0x2, 0x80,
+    0x3f, 0xf7, 0x0, 0xb1, 0x28, 0x12, 0x80, 0x7f, 0x8d, 0x1, 0xc4, 0x24, 0x1, 0x20, 0x1f, 0xe9,
+    0x0, 0x50, 0x0, 0xcc, 0x6, 0x60, 0xf, 0xc4, 0xa0, 0x86, 0x1, 0x48, 0x2, 0x40, 0x3f, 0x50,
+    0x3, 0xc0, 0x32, 0x90, 0x29, 0x0, 0x78, 0x58, 0x9, 0x0, 0x3a, 0x80, 0x14, 0x1, 0xe7, 0x10,
+    0xb0, 0xf, 0x30, 0x83, 0x8, 0x7, 0x58, 0xb, 0x80, 0x78, 0x5c, 0x5, 0xc0, 0x32, 0x10, 0x30,
+    0x80, 0x7d, 0x60, 0xb, 0x0, 0xde, 0x0, 0xa0, 0xf, 0xc4, 0x80, 0x48, 0x0, 0x34, 0x5, 0x20,
+    0xf, 0xef, 0x0, 0x78, 0x2, 0x80, 0x12, 0x1, 0xfe, 0x43, 0x4, 0x31, 0x60, 0x33, 0x0, 0x7f,
+    0xd4, 0x0, 0xa9, 0x0, 0x48, 0x7, 0xfe, 0x61, 0x6, 0x60, 0x12, 0x80, 0x7f, 0xf0, 0x58, 0x0,
+    0x21, 0x40, 0x1f, 0xfc, 0x29, 0x0, 0x85, 0x80, 0x3f, 0xf8, 0x42, 0xc0, 0x7, 0x10, 0xf, 0x80,
+
+    /* U+0057 "W" */
+    0x99, 0x40, 0x7, 0xf9, 0x66, 0x44, 0x1, 0xfc, 0x33, 0x25, 0x26, 0x72, 0x0, 0xfe, 0x96, 0x65,
+    0x0, 0x7f, 0x3b, 0x30, 0x74, 0x0, 0xa0, 0x1f, 0x88, 0xc0, 0xa, 0x1, 0xfd, 0xa0, 0x28, 0xe0,
+    0xb, 0x0, 0xfc, 0xa0, 0x11, 0x18, 0x7, 0xc2, 0x80, 0xe0, 0x28, 0x6, 0x40, 0x1f, 0x58, 0x10,
+    0x2, 0xc0, 0x3e, 0x70, 0x6, 0x80, 0x34, 0x0, 0xa0, 0x1e, 0x33, 0x5, 0x98, 0x28, 0x7, 0xda,
+    0x2, 0x80, 0x7, 0x0, 0x58, 0x7, 0xac, 0x0, 0xf6, 0x4, 0x60, 0x1c, 0x28, 0xe, 0x1, 0xa,
+    0x1, 0x90, 0x7, 0x28, 0x20, 0xa8, 0x2, 0xc0, 0x39, 0xc0, 0x1a, 0x1, 0xb4, 0x0, 0xa0, 0x18,
+    0xc8, 0x34, 0x8, 0xc1, 0x40, 0x3b, 0x40, 0x50, 0x3, 0x38, 0x2, 0xc0, 0x35, 0x80, 0x1c, 0x1,
+    0x60, 0x48, 0x1, 0x12, 0x3, 0x80, 0x70, 0xa0, 0x19, 0x0, 0x4a, 0xa, 0x20, 0x5, 0x0, 0x68,
+    0x4, 0xa0, 0xd, 0x0, 0xf6, 0x80, 0x14, 0x0, 0x84, 0x1e, 0x1, 0x12, 0x3, 0x80, 0x56, 0x2,
+    0x80, 0x1e, 0x70, 0x5, 0x80, 0x34, 0x5, 0x0, 0x36, 0x80, 0xa0, 0x11, 0x83, 0x80, 0x7c, 0x28,
+    0x6, 0x40, 0xe0, 0x82, 0x1, 0x9c, 0x1, 0xa0, 0xa0, 0xd, 0x0, 0xfd, 0xa0, 0x5, 0x41, 0xf,
+    0x0, 0xe1, 0x40, 0x70, 0xb0, 0x14, 0x0, 0xfc, 0xe0, 0xb, 0xe0, 0x14, 0x0, 0xf6, 0x80, 0xb1,
+    0x83, 0x80, 0x7f, 0xa, 0x1, 0xa0, 0x20, 0x80, 0x79, 0xc0, 0x10, 0x0, 0xd0, 0xf, 0xf6, 0x80,
+    0x4, 0x38, 0x3, 0xe1, 0x40, 0x10, 0x14, 0x0, 0xff, 0x38, 0x4, 0x28, 0x1, 0xfb, 0x40, 0x27,
+    0x0, 0xff, 0x85, 0x0, 0xe, 0x1, 0xfc, 0xe0, 0x16, 0x80, 0x78,
+
+    /* U+0058 "X" */
+    0x8, 0x99, 0x10, 0x7, 0xf1, 0xcc, 0x9c, 0x1, 0xcc, 0xce, 0x0, 0xfc, 0x3e, 0xcc, 0x40, 0x3,
+    0x28, 0x1c, 0x0, 0x7d, 0x6, 0x10, 0x60, 0x15, 0x90, 0x3a, 0x0, 0x72, 0xb0, 0x23, 0x80, 0x61,
+    0xe0, 0x5, 0x8, 0x4, 0x56, 0x5, 0x40, 0x1e, 0x38, 0x1, 0xa0, 0xa, 0x44, 0x24, 0x40, 0x3e,
+    0x74, 0x4, 0x70, 0x74, 0x7, 0x40, 0xf, 0xe9, 0x10, 0x86, 0x80, 0x38, 0x0, 0xff, 0x15, 0x80,
+    0x24, 0x7, 0x80, 0x3f, 0xf2, 0xb0, 0x5, 0x64, 0x1, 0xff, 0xc1, 0x30, 0xb, 0x40, 0x3f, 0xf8,
+    0x2c, 0xa0, 0x13, 0xa0, 0x7, 0xfc, 0x70, 0x5, 0x60, 0xa, 0x10, 0xf, 0xe1, 0xe1, 0x9, 0x48,
+    0x1, 0xa0, 0xf, 0xe8, 0x20, 0x74, 0x7, 0x40, 0x47, 0x0, 0xf9, 0x58, 0xe, 0x0, 0x2a, 0x10,
+    0x83, 0x0, 0xe2, 0xb0, 0x1e, 0x0, 0xc3, 0x40, 0xe, 0x10, 0xd, 0xc2, 0x10, 0x40, 0x1c, 0x8e,
+    0x5, 0x60, 0x14, 0x18, 0x2b, 0x0, 0x7d, 0x6, 0xa, 0xc0, 0x8e, 0x5, 0x60, 0x1f, 0xdc, 0x21,
+    0x4,
+
+    /* U+0059 "Y" */
+    0x89, 0x90, 0x80, 0x7f, 0xcf, 0x32, 0x1f, 0x66, 0x48, 0x7, 0xf8, 0xe1, 0x84, 0x4e, 0x60, 0xe6,
+    0x1, 0xfd, 0xe0, 0x52, 0x0, 0xf0, 0x4, 0x0, 0x7e, 0x73, 0x8, 0x10, 0x1, 0xb0, 0x23, 0x0,
+    0x78, 0x64, 0x11, 0x40, 0x34, 0x8, 0x40, 0x80, 0x75, 0x88, 0x48, 0x7, 0xc, 0x0, 0xc0, 0x6,
+    0x45, 0x7, 0x20, 0xf, 0x31, 0x83, 0x18, 0x5, 0x20, 0x52, 0x1, 0xfb, 0xc0, 0x1e, 0x0, 0x72,
+    0x8, 0x10, 0xf, 0xc6, 0xe0, 0x6c, 0x52, 0x8, 0xa0, 0x1f, 0xe9, 0x20, 0x89, 0x11, 0x48, 0x7,
+    0xfc, 0x30, 0x2, 0x81, 0x24, 0x1, 0xff, 0x95, 0x0, 0x4, 0xe0, 0x1f, 0xfc, 0x2e, 0x0, 0x50,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xc6,
+
+    /* U+005A "Z" */
+    0x59, 0x9f, 0xfe, 0x19, 0x63, 0x37, 0xff, 0xc, 0x44, 0x45, 0xff, 0x8, 0x0, 0x4a, 0x37, 0x7f,
+    0xde, 0x1, 0x50, 0x80, 0x7f, 0xdc, 0x21, 0x8, 0x1, 0xff, 0x49, 0x82, 0xb8, 0x7, 0xfc, 0xec,
+    0x7, 0x60, 0x1f, 0xf2, 0x40, 0xf, 0x8, 0x7, 0xf8, 0xa8, 0x1, 0x44, 0x1, 0xfe, 0x1e, 0x10,
+    0x84, 0x0, 0xff, 0xac, 0xc1, 0x9c, 0x3, 0xfe, 0x75, 0x3, 0x90, 0xf, 0xf9, 0x20, 0x7, 0x80,
+    0x3f, 0xe2, 0xa0, 0x5, 0x10, 0x7, 0xf8, 0x7c, 0x42, 0x50, 0x3, 0xfe, 0xb2, 0x6, 0x60, 0x7,
+    0xfd, 0xa, 0x7, 0x20, 0x1f, 0xf2, 0xb8, 0x1, 0x1d, 0xff, 0xe4, 0x90, 0x9, 0xe2, 0x3f, 0xed,
+    0x0, 0xff, 0xe2, 0x80,
+
+    /* U+005B "[" */
+    0x1c, 0xce, 0x90, 0x33, 0xe5, 0x0, 0x8e, 0x21, 0x20, 0x12, 0xbb, 0x94, 0x3, 0xff, 0xfe, 0x1,
+    0xff, 0xf8, 0x6e, 0xe5, 0x80, 0x61, 0x13, 0x8d, 0xdf, 0x78,
+
+    /* U+005C "\\" */
+    0x89, 0x40, 0xf, 0xe2, 0x6f, 0x0, 0xfe, 0xf0, 0x42, 0x0, 0xfc, 0x82, 0xa, 0x1, 0xf8, 0x5c,
+    0x2c, 0x3, 0xfb, 0x40, 0xc8, 0x3, 0xf2, 0x8, 0x50, 0x7, 0xf3, 0x82, 0x80, 0x7f, 0x50, 0x11,
+    0x80, 0x7e, 0x32, 0xa, 0x0, 0xfe, 0x50, 0x70, 0xf, 0xea, 0x1, 0x40, 0xf, 0xc4, 0x61, 0xa0,
+    0x1f, 0xd6, 0xe, 0x20, 0x1f, 0x94, 0x5, 0x0, 0x3f, 0x12, 0x7, 0x80, 0x7f, 0x68, 0x28, 0x80,
+    0x7e, 0x70, 0x3, 0x80, 0x7e, 0x15, 0xd, 0x0, 0xfe, 0xf0, 0x42, 0x0, 0xfc, 0x82, 0xa, 0x1,
+    0xf8, 0x50, 0x2c, 0x3, 0xfb, 0x80, 0xc8, 0x3, 0xf2, 0x8, 0x50, 0x7, 0xf3, 0x82, 0x80, 0x7f,
+    0x50, 0x11, 0x80, 0x7e, 0x36, 0x68,
+
+    /* U+005D "]" */
+    0x5c, 0xce, 0x42, 0x33, 0xe2, 0x48, 0x83, 0x0, 0x46, 0xee, 0xc0, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xe1, 0xfb, 0x96, 0x1, 0x84, 0x60, 0x9, 0x6e, 0xf9, 0x0,
+
+    /* U+005E "^" */
+    0x0, 0xc3, 0x32, 0x40, 0xf, 0xe7, 0x66, 0x40, 0x7, 0xf5, 0x80, 0x99, 0x80, 0x3e, 0x42, 0x39,
+    0xa, 0x0, 0xfb, 0x82, 0x98, 0x5c, 0x40, 0x38, 0x94, 0x5c, 0x5c, 0x58, 0x3, 0xa8, 0x18, 0x42,
+    0x82, 0x80, 0x30, 0xb0, 0x50, 0x0, 0xcc, 0x4a, 0x1, 0x38, 0xa1, 0x0, 0x54, 0x1c, 0x1, 0x50,
+    0x70, 0x6, 0x71, 0x42, 0x4, 0x32, 0x50, 0xc, 0x2c, 0x16, 0x1c, 0x14, 0x1, 0xea, 0x7, 0x10,
+
+    /* U+005F "_" */
+    0xff, 0xff, 0xe1, 0x33, 0x7f, 0xf0, 0x80,
+
+    /* U+0060 "`" */
+    0x39, 0xa9, 0x10, 0x8, 0xf1, 0x1b, 0x44, 0x2, 0x5c, 0x33, 0x68, 0x80, 0x45, 0xac, 0x78, 0x40,
+
+    /* U+0061 "a" */
+    0x0, 0xb, 0xd6, 0xf7, 0x36, 0x4c, 0x3, 0x47, 0x42, 0x90, 0x88, 0x9b, 0x20, 0x2, 0x50, 0x15,
+    0x89, 0x92, 0x80, 0x1d, 0x80, 0x10, 0xff, 0x4e, 0xcc, 0xab, 0x0, 0x58, 0x1, 0x60, 0x40, 0x39,
+    0x18, 0x8, 0x80, 0x1f, 0xef, 0x0, 0x30, 0x4, 0x4c, 0xf1, 0x1b, 0x40, 0x2, 0x5, 0x7b, 0x30,
+    0xef, 0x90, 0x2, 0x1f, 0x40, 0x48, 0x99, 0xcc, 0x1, 0x39, 0x4, 0x5b, 0xb3, 0x6f, 0x0, 0xb8,
+    0x0, 0xa0, 0x1e, 0x10, 0xf, 0x30, 0x7, 0x14, 0x80, 0x56, 0x0, 0x94, 0x0, 0xb, 0x60, 0x80,
+    0x46, 0xe0, 0x57, 0xfd, 0xc9, 0x16, 0x0, 0xd1, 0x6a, 0x40, 0x2, 0x5c, 0xd0, 0x8,
+
+    /* U+0062 "b" */
+    0x5c, 0xc1, 0x80, 0x7f, 0xe2, 0x33, 0x38, 0x7, 0xff, 0xfc, 0x3, 0xcb, 0x7b, 0xdb, 0x6c, 0x1,
+    0xf0, 0xe5, 0x21, 0x9, 0x24, 0xe9, 0x80, 0x75, 0x98, 0x2c, 0x4b, 0x90, 0x16, 0x98, 0x6, 0x12,
+    0xca, 0x76, 0x8d, 0x60, 0x1f, 0x0, 0xc3, 0xe6, 0x1, 0xd2, 0x80, 0x6a, 0x1, 0x39, 0x0, 0x7d,
+    0x0, 0xf, 0x0, 0xb0, 0x3, 0xf1, 0x88, 0x38, 0x4, 0x20, 0x1f, 0xc4, 0x6, 0x1, 0x8, 0x7,
+    0xf1, 0x1, 0x80, 0x5a, 0x1, 0xf8, 0x84, 0x1c, 0x2, 0x61, 0x0, 0xfa, 0xc0, 0x18, 0x1, 0xd,
+    0x8, 0x7, 0x3b, 0x0, 0xb8, 0x4, 0x29, 0xee, 0x86, 0xd7, 0x0, 0xa, 0x10, 0xa, 0x88, 0x62,
+    0xf2, 0x50, 0x6, 0x90, 0x3, 0x36, 0x39, 0x88, 0x11, 0xc6, 0x28, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0xc9, 0x3b, 0xdc, 0xc9, 0x30, 0xc, 0x37, 0x66, 0x21, 0x11, 0xb6, 0x48, 0x0, 0x71, 0x0,
+    0x5a, 0x64, 0xc2, 0xd, 0x21, 0x64, 0xb, 0xf2, 0xcc, 0x9c, 0x30, 0x13, 0x50, 0x3a, 0x10, 0xc,
+    0x5b, 0x91, 0x60, 0x8, 0x0, 0xf8, 0x4c, 0xc, 0x0, 0x80, 0x1f, 0xe7, 0x1, 0x0, 0xff, 0x9c,
+    0x4, 0x3, 0xfe, 0x20, 0x1, 0x80, 0x7f, 0xb4, 0x1, 0x20, 0x1f, 0x8, 0x81, 0xc, 0x16, 0x0,
+    0x38, 0x6f, 0xd8, 0x38, 0x41, 0xf1, 0x91, 0xf, 0x8a, 0x38, 0x5, 0xa4, 0x7, 0x37, 0x68, 0x20,
+    0x4b, 0x0, 0x1e, 0xd2, 0x90, 0x88, 0x96, 0xac, 0x40,
+
+    /* U+0064 "d" */
+    0x0, 0xff, 0xc5, 0x98, 0x60, 0xf, 0xfe, 0x9, 0x9b, 0x80, 0x3f, 0xff, 0xb, 0x5b, 0xdb, 0x6c,
+    0x1, 0xf1, 0x65, 0x29, 0x9, 0x24, 0xe3, 0x0, 0x62, 0xf3, 0x1, 0x69, 0x85, 0x13, 0xa0, 0xd,
+    0x24, 0xb, 0xf2, 0xcf, 0x58, 0x62, 0x1, 0x22, 0x0, 0xe8, 0x40, 0x31, 0x68, 0x80, 0x58, 0x0,
+    0x80, 0xf, 0x85, 0x80, 0x23, 0x0, 0x20, 0x7, 0xec, 0x0, 0x9c, 0x4, 0x3, 0xf9, 0x80, 0x27,
+    0x1, 0x0, 0xfe, 0x10, 0x8, 0x80, 0x8, 0x1, 0xf9, 0x0, 0x2c, 0x0, 0x78, 0x7, 0xc3, 0x40,
+    0x12, 0x90, 0x24, 0x0, 0x70, 0xd9, 0x0, 0x6e, 0x10, 0x7c, 0x64, 0x43, 0xe2, 0x88, 0x6, 0x3a,
+    0x10, 0x39, 0xbb, 0x41, 0xd, 0x0, 0x72, 0x7c, 0x21, 0x0, 0x9b, 0xfa, 0x0, 0x40,
+
+    /* U+0065 "e" */
+    0x0, 0xcb, 0x5b, 0xdc, 0xb6, 0x10, 0xe, 0x2c, 0xa5, 0x21, 0x12, 0x4e, 0x20, 0x4, 0x5e, 0x60,
+    0x93, 0x52, 0xa0, 0x54, 0x60, 0x9, 0x20, 0x9b, 0x65, 0x6a, 0xb1, 0x17, 0x1, 0xa0, 0x33, 0x0,
+    0x39, 0x2c, 0x9, 0xac, 0x1, 0x60, 0x1f, 0x29, 0x6, 0x18, 0xa, 0xbb, 0xfe, 0x10, 0x77, 0x0,
+    0xc4, 0x7f, 0x18, 0x1b, 0x80, 0xc4, 0x7f, 0xd2, 0x40, 0x2a, 0xef, 0xff, 0x68, 0x2, 0xc0, 0x3f,
+    0xe4, 0x30, 0x67, 0x0, 0xf1, 0xd8, 0x80, 0x38, 0x42, 0x31, 0xd0, 0xd6, 0xb1, 0x28, 0x0, 0x5a,
+    0x40, 0x71, 0x79, 0x4a, 0x3, 0xe0, 0x11, 0xe5, 0x29, 0x8, 0xa, 0x3f, 0xa0, 0x0,
+
+    /* U+0066 "f" */
+    0x0, 0xc2, 0xf9, 0xdb, 0x68, 0x1, 0xe, 0xc1, 0x89, 0x27, 0x0, 0x52, 0x60, 0x95, 0x45, 0xe0,
+    0x9, 0x40, 0xad, 0x55, 0x48, 0x1, 0x10, 0x20, 0x7, 0xc2, 0x1, 0xf9, 0xf7, 0x0, 0xf, 0xbb,
+    0x58, 0x71, 0x10, 0x0, 0x24, 0x53, 0x5, 0x4c, 0x80, 0x9, 0x33, 0x40, 0x1b, 0x38, 0x0, 0x99,
+    0xa5, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xf8, 0xc0,
+
+    /* U+0067 "g" */
+    0x0, 0xcb, 0x5b, 0xdc, 0xb7, 0x10, 0xad, 0x90, 0x1, 0xe5, 0x29, 0x8, 0x92, 0x3d, 0x18, 0x88,
+    0x7, 0xa6, 0x2, 0xd3, 0x26, 0x11, 0x51, 0x0, 0x5e, 0x20, 0xdf, 0x2c, 0xc9, 0xe6, 0x11, 0x0,
+    0x14, 0xc1, 0x64, 0x40, 0x3a, 0x54, 0x2, 0xc0, 0x4, 0x80, 0x7e, 0x90, 0x9, 0x40, 0x6, 0x1,
+    0xf8, 0xc4, 0x3, 0x8, 0x7, 0xff, 0x5, 0x80, 0x44, 0x1, 0xf8, 0x44, 0x0, 0xd0, 0x3, 0x0,
+    0x7e, 0x60, 0x9, 0x84, 0x21, 0x0, 0x3c, 0x90, 0x1, 0xc, 0x0, 0x2e, 0xc, 0x0, 0x71, 0x60,
+    0x1c, 0xce, 0x0, 0x7c, 0xff, 0x63, 0x83, 0x8, 0x6, 0x8b, 0x40, 0xe, 0x29, 0x90, 0x80, 0x72,
+    0x5f, 0x5d, 0x53, 0x74, 0xc2, 0x0, 0x20, 0xe, 0x14, 0x55, 0x10, 0x1, 0x0, 0x1c, 0x3, 0x22,
+    0x1, 0xf0, 0xc0, 0x1, 0x42, 0x1b, 0xe5, 0x4, 0x0, 0x2d, 0x84, 0xc, 0x40, 0x10, 0xb5, 0xf7,
+    0x69, 0x20, 0x38, 0x0, 0x4e, 0x28, 0x80, 0x4, 0x40, 0x2, 0x8c, 0x10, 0x8, 0xeb, 0xb2, 0xa6,
+    0x55, 0x9a, 0xe0, 0x10,
+
+    /* U+0068 "h" */
+    0x5c, 0xc1, 0x80, 0x7f, 0xc4, 0x66, 0x70, 0xf, 0xff, 0xf8, 0x35, 0xef, 0x6d, 0x28, 0x7, 0x87,
+    0x25, 0x8, 0x49, 0x6a, 0x82, 0x1, 0xac, 0xc5, 0xa2, 0xa, 0x0, 0x58, 0x0, 0xc2, 0x9f, 0x2e,
+    0xea, 0xc1, 0x6, 0x20, 0x8, 0xa8, 0x40, 0x31, 0xc8, 0x1, 0x0, 0x25, 0x10, 0xf, 0x20, 0x3,
+    0x80, 0x2d, 0x0, 0xf8, 0x80, 0x2, 0x1, 0x8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xba,
+
+    /* U+0069 "i" */
+    0x2, 0x10, 0x7d, 0xe5, 0xa0, 0x7, 0xa0, 0x3, 0xe7, 0x35, 0x40, 0xc8, 0x3, 0x9b, 0x74, 0x62,
+    0x44, 0x70, 0xf, 0xff, 0x40,
+
+    /* U+006A "j" */
+    0x0, 0xf0, 0x90, 0x7, 0x97, 0xb5, 0xc0, 0x3b, 0x80, 0x16, 0x1, 0xd8, 0x0, 0xb0, 0xe, 0x7c,
+    0xc3, 0x80, 0x78, 0xcc, 0x1, 0xff, 0xc3, 0x4d, 0xd2, 0x80, 0x70, 0x91, 0xc, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xe6, 0x30, 0xe, 0x20, 0x0, 0x82, 0x80, 0xa, 0x80, 0xa, 0x55, 0xfb, 0xa2, 0x6,
+    0x17, 0x0, 0x10, 0x1, 0xa4, 0x17, 0xaa, 0x6b, 0x64, 0x0,
+
+    /* U+006B "k" */
+    0x5c, 0xc1, 0x80, 0x7f, 0xc4, 0x66, 0x70, 0xf, 0xff, 0xf8, 0x7, 0x8b, 0x37, 0x8, 0x3, 0xf8,
+    0xf0, 0xcd, 0x4, 0x1, 0xf9, 0x34, 0x45, 0x48, 0x1, 0xf9, 0x6c, 0x45, 0xa8, 0x1, 0xf9, 0xa8,
+    0x7, 0x4c, 0x3, 0xf4, 0x48, 0xe, 0x98, 0x7, 0xe9, 0x70, 0x3, 0x98, 0x7, 0xe8, 0x60, 0x9,
+    0x90, 0x3, 0xf1, 0x81, 0xc8, 0x2, 0x88, 0x3, 0xf2, 0x6b, 0x38, 0xf, 0x8, 0x7, 0x96, 0xc4,
+    0x21, 0x0, 0xec, 0x3, 0xdc, 0x1, 0xa8, 0x81, 0x5c, 0x3, 0xfc, 0x3c, 0x21, 0x8, 0x1, 0xfe,
+    0x3b, 0x0, 0x51, 0x0, 0x7f, 0x95, 0xc0, 0x78,
+
+    /* U+006C "l" */
+    0x5c, 0xc1, 0x91, 0x99, 0xc0, 0x3f, 0xff, 0xe0,
+
+    /* U+006D "m" */
+    0x6d, 0xd1, 0xb, 0xdf, 0x73, 0x64, 0x80, 0x22, 0x8c, 0xee, 0x64, 0x10, 0x4, 0x24, 0x46, 0xc8,
+    0x41, 0x11, 0x36, 0xb0, 0x36, 0x39, 0x88, 0x8d, 0xf1, 0x40, 0x3a, 0x88, 0x5a, 0x1c, 0xc0, 0x13,
+    0x12, 0x22, 0x68, 0x73, 0x1, 0xa3, 0x0, 0xc2, 0xbf, 0x2f, 0x18, 0xe0, 0x7, 0x5, 0xf9, 0x78,
+    0xc6, 0x0, 0x48, 0x6, 0x2b, 0x10, 0xd, 0x4, 0x0, 0x2a, 0x10, 0xd, 0x24, 0x8, 0x1, 0x94,
+    0x40, 0x3c, 0x80, 0xa, 0x0, 0xf9, 0x0, 0x48, 0x2, 0xd0, 0xf, 0x84, 0x0, 0x60, 0x1f, 0x8,
+    0x0, 0x40, 0x21, 0x0, 0xfb, 0xc0, 0xe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xf7,
+    0xc0,
+
+    /* U+006E "n" */
+    0x6d, 0xd1, 0x3, 0x5e, 0xf6, 0xd2, 0x80, 0x42, 0x44, 0x6d, 0x94, 0x21, 0x25, 0xaa, 0x8, 0x6,
+    0xa2, 0x16, 0x88, 0x28, 0x1, 0x60, 0x3, 0xa, 0x7c, 0xbb, 0xab, 0x4, 0x18, 0x80, 0x22, 0xa1,
+    0x0, 0xc7, 0x20, 0x4, 0x0, 0x94, 0x40, 0x3c, 0x80, 0xe, 0x0, 0xb4, 0x3, 0xe2, 0x0, 0x8,
+    0x4, 0x20, 0x1f, 0xff, 0xf0, 0xf, 0xfe, 0xe8,
+
+    /* U+006F "o" */
+    0x0, 0xc9, 0x3b, 0xdc, 0xc9, 0x30, 0xf, 0xd, 0xd9, 0x88, 0x44, 0x6d, 0x92, 0x1, 0x87, 0x10,
+    0x5, 0xa6, 0x14, 0x41, 0xac, 0x2, 0xb2, 0x5, 0xf9, 0x67, 0xac, 0x30, 0x47, 0x3, 0x50, 0x3a,
+    0x10, 0xc, 0x5a, 0x21, 0x23, 0x60, 0x8, 0x0, 0xf8, 0x58, 0x5, 0xc, 0x0, 0x80, 0x1f, 0xb0,
+    0x1, 0xae, 0x2, 0x1, 0xfc, 0xc0, 0x1, 0x70, 0x10, 0xf, 0xe1, 0x0, 0x9, 0x0, 0x10, 0x3,
+    0xf2, 0x0, 0x37, 0x40, 0xf, 0x0, 0xf8, 0x68, 0x0, 0x88, 0x30, 0x48, 0x0, 0xe1, 0xb2, 0x6,
+    0x10, 0xe1, 0x7, 0xc6, 0x44, 0x3e, 0x28, 0x1c, 0x0, 0xb, 0x48, 0xe, 0x6e, 0xd0, 0x40, 0x9a,
+    0x20, 0x11, 0xe4, 0xa9, 0x8, 0x89, 0x6a, 0xc4, 0x0,
+
+    /* U+0070 "p" */
+    0x6d, 0xd1, 0x2, 0xde, 0xf6, 0xdb, 0x0, 0x61, 0x22, 0xe, 0x52, 0x10, 0x92, 0x4e, 0x98, 0x7,
+    0x71, 0x82, 0xc4, 0xb9, 0x1, 0x69, 0x80, 0x62, 0x26, 0x53, 0xb4, 0x6b, 0x0, 0xf8, 0x6, 0x1e,
+    0x30, 0xe, 0x94, 0x3, 0x50, 0x9, 0xcc, 0x3, 0xe8, 0x0, 0x78, 0x5, 0x80, 0x1f, 0x8c, 0x41,
+    0xc0, 0x21, 0x0, 0xfe, 0x20, 0x30, 0x8, 0x40, 0x3f, 0x88, 0xc, 0x2, 0xd0, 0xf, 0xc4, 0x20,
+    0xe0, 0x13, 0x8, 0x7, 0xd6, 0x0, 0xc0, 0x8, 0x68, 0x40, 0x39, 0xd8, 0x5, 0xc0, 0x32, 0x7b,
+    0xa1, 0xb5, 0xc0, 0x2, 0x84, 0x2, 0x92, 0x18, 0xbc, 0x94, 0x1, 0xa4, 0x0, 0xc5, 0x8e, 0x62,
+    0x4, 0x71, 0x8a, 0x1, 0xe1, 0x8c, 0xef, 0xdc, 0x72, 0x0, 0xff, 0xfb, 0xad, 0xd9, 0x40, 0x3f,
+    0xf0,
+
+    /* U+0071 "q" */
+    0x0, 0xcb, 0x5b, 0xdb, 0x6c, 0x0, 0xdd, 0x38, 0x0, 0xb2, 0x94, 0x84, 0x92, 0x70, 0x8a, 0xf0,
+    0x2f, 0x30, 0x16, 0x98, 0x50, 0x3f, 0x0, 0xd2, 0x40, 0xbf, 0x2c, 0xf5, 0xa6, 0x40, 0x12, 0x20,
+    0xe, 0x84, 0x3, 0x17, 0x8, 0x5, 0x80, 0x8, 0x0, 0xf8, 0x98, 0x2, 0x30, 0x2, 0x0, 0x7e,
+    0xc0, 0x9, 0xc0, 0x40, 0x3f, 0x98, 0x2, 0x70, 0x10, 0xf, 0xe1, 0x0, 0x88, 0x0, 0x80, 0x1f,
+    0x90, 0x2, 0xc0, 0x7, 0x80, 0x7c, 0x34, 0x1, 0x29, 0x2, 0x40, 0x7, 0xd, 0x90, 0x6, 0xe1,
+    0x7, 0xc6, 0x44, 0x3e, 0x28, 0x7, 0x1d, 0x8, 0x1c, 0xdd, 0xa0, 0x86, 0x80, 0x39, 0x3e, 0x10,
+    0x80, 0x4d, 0xfd, 0xc0, 0x3c, 0x2f, 0x7b, 0xfd, 0x90, 0x20, 0x1f, 0xff, 0xf0, 0xe, 0x3b, 0xb5,
+    0x0,
+
+    /* U+0072 "r" */
+    0x6d, 0xd1, 0x3, 0x5e, 0xc0, 0x91, 0x7, 0x25, 0x8, 0x3, 0x71, 0x81, 0xae, 0x80, 0x44, 0x4c,
+    0xc5, 0x28, 0x4, 0x3e, 0x60, 0x1e, 0x72, 0x0, 0xfb, 0x0, 0x3f, 0x8, 0x7, 0xff, 0xe0,
+
+    /* U+0073 "s" */
+    0x0, 0x8a, 0x33, 0xba, 0xb8, 0x30, 0xc, 0xfa, 0xe6, 0x23, 0x23, 0xe4, 0x0, 0x12, 0x0, 0x5a,
+    0x6a, 0x58, 0x42, 0x80, 0x1c, 0x0, 0xc9, 0x65, 0x69, 0xfb, 0x20, 0x3, 0x1, 0x10, 0x3, 0x85,
+    0x0, 0x27, 0x2, 0x60, 0xf, 0xf7, 0x0, 0x27, 0xa9, 0xd0, 0x40, 0x39, 0x68, 0x40, 0x56, 0x2f,
+    0xad, 0x0, 0x32, 0xfd, 0xba, 0x8, 0x1, 0x2d, 0xc0, 0x30, 0xa4, 0x5f, 0x6c, 0x8, 0x48, 0x80,
+    0x7e, 0x27, 0x60, 0x12, 0x4, 0x40, 0x7, 0xc4, 0x0, 0x10, 0x8b, 0xc8, 0x43, 0x32, 0x4a, 0x81,
+    0x91, 0x4, 0xd, 0xef, 0x31, 0x6c, 0x5, 0xc0, 0x59, 0x2a, 0x42, 0x2, 0x4b, 0x38, 0x40,
+
+    /* U+0074 "t" */
+    0x0, 0x84, 0x60, 0xf, 0x87, 0xb9, 0x0, 0x1f, 0xfc, 0xf7, 0xdc, 0x0, 0x3e, 0xed, 0x61, 0xc4,
+    0x40, 0x0, 0x91, 0x4c, 0x15, 0x32, 0x0, 0x24, 0xcd, 0x0, 0x6c, 0xe0, 0x2, 0x66, 0x94, 0x3,
+    0xff, 0xf8, 0x60, 0x1f, 0x8, 0x81, 0xc0, 0x3f, 0x28, 0x14, 0x99, 0x9c, 0xc0, 0x28, 0x0, 0x36,
+    0x62, 0x28, 0x2, 0x3c, 0x52, 0x1, 0x2f,
+
+    /* U+0075 "u" */
+    0x7d, 0xd0, 0x80, 0x7c, 0x9b, 0xa5, 0xe2, 0x20, 0x7, 0xe1, 0x22, 0x18, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0x8c, 0x60, 0x1f, 0x18, 0x4, 0x20, 0x1, 0x0, 0xfb, 0x80, 0x2e, 0x0, 0x20, 0x7, 0xca,
+    0x1, 0x20, 0x2, 0x48, 0x3, 0xa4, 0x80, 0x22, 0x50, 0x1c, 0x85, 0x47, 0xc6, 0x0, 0xeb, 0x40,
+    0x17, 0xab, 0x83, 0x19, 0x0, 0xc3, 0x74, 0xa4, 0x2, 0x6d, 0xea, 0x1,
+
+    /* U+0076 "v" */
+    0xbd, 0xb0, 0xf, 0xe2, 0xdd, 0x36, 0x12, 0x28, 0x7, 0xea, 0x22, 0x23, 0x8, 0x70, 0x7, 0xc2,
+    0xc0, 0xa4, 0x2e, 0x8, 0x60, 0x1e, 0x71, 0x9, 0x0, 0x58, 0x2, 0x80, 0x3d, 0x60, 0x66, 0x0,
+    0x12, 0x3, 0x88, 0x6, 0x42, 0x9, 0x0, 0xde, 0x2, 0xc0, 0x1b, 0xc0, 0x94, 0x3, 0x21, 0x5,
+    0x0, 0x46, 0x81, 0x40, 0x1e, 0xb0, 0x25, 0x0, 0x50, 0xb, 0x0, 0x79, 0xc4, 0x38, 0x5, 0xc1,
+    0xc4, 0x3, 0xc2, 0xc0, 0x86, 0xc2, 0x16, 0x1, 0xfa, 0x80, 0x15, 0x40, 0x42, 0x0, 0xfc, 0x4a,
+    0xc, 0x41, 0xe0, 0x1f, 0xe9, 0x0, 0x89, 0x0, 0x3f, 0xc6, 0x60, 0x5, 0x80, 0x78,
+
+    /* U+0077 "w" */
+    0x9d, 0xb0, 0xf, 0xd1, 0xb8, 0x1, 0xf9, 0xf6, 0xf0, 0x90, 0xc0, 0x3c, 0x2c, 0x46, 0x80, 0x1f,
+    0x51, 0x1a, 0x88, 0x50, 0x7, 0x9c, 0x40, 0x1c, 0x1, 0xe4, 0x20, 0xa0, 0x70, 0x70, 0xf, 0x68,
+    0x4, 0x82, 0x1, 0xdc, 0x8, 0x41, 0x40, 0x28, 0x1, 0x89, 0x2, 0x40, 0x5c, 0x3, 0xa, 0x6,
+    0x80, 0xc, 0x83, 0x80, 0x35, 0x0, 0xb2, 0x6, 0x80, 0x67, 0x11, 0x38, 0x5, 0x40, 0xa2, 0x1,
+    0x28, 0x30, 0x70, 0x21, 0x0, 0x5a, 0x8, 0x20, 0x12, 0x80, 0x1c, 0x0, 0x84, 0x14, 0x8, 0x20,
+    0xa0, 0x2, 0x40, 0xe0, 0xc, 0x48, 0x1a, 0x0, 0xe0, 0x42, 0x1, 0x70, 0xa0, 0x5, 0x1, 0x20,
+    0x7, 0x70, 0x21, 0xa, 0x86, 0x80, 0x54, 0x4, 0x80, 0xa0, 0xa0, 0x1e, 0x41, 0x5, 0x70, 0x17,
+    0x0, 0x8c, 0xc1, 0xa8, 0x41, 0x40, 0x1e, 0x17, 0xa, 0xa0, 0x38, 0x80, 0x6b, 0x7, 0xe0, 0x32,
+    0x0, 0xfb, 0x40, 0x8c, 0x28, 0x3, 0x98, 0x5, 0x42, 0x80, 0x3f, 0x21, 0x0, 0x8, 0xc0, 0x38,
+    0x54, 0x0, 0x2e, 0x1, 0xfc, 0xa0, 0xa, 0x0, 0xfb, 0xc0, 0x8, 0x20, 0x18,
+
+    /* U+0078 "x" */
+    0x1c, 0xdc, 0x10, 0xf, 0x36, 0xe9, 0x46, 0x48, 0xec, 0x3, 0x8e, 0x49, 0x94, 0x15, 0xc1, 0x5c,
+    0x2, 0x1e, 0x2, 0xa0, 0xa, 0x10, 0x21, 0x0, 0x14, 0x41, 0xc2, 0x1, 0xa8, 0x42, 0x45, 0xd0,
+    0x24, 0xc0, 0x38, 0x68, 0xb, 0x60, 0x19, 0x80, 0x1f, 0x24, 0x1, 0x81, 0xc0, 0x7, 0xf3, 0x88,
+    0x2, 0x44, 0x3, 0xfa, 0x44, 0x1, 0x62, 0x1, 0xf9, 0x58, 0x14, 0x45, 0x40, 0x1f, 0x1d, 0x81,
+    0xd4, 0x2, 0x40, 0x7, 0xf, 0x8, 0xb8, 0x19, 0x80, 0xea, 0x1, 0xac, 0x82, 0xc8, 0x1, 0x6,
+    0x16, 0x40, 0x7, 0x50, 0x75, 0x0, 0x87, 0x84, 0x5e, 0x29, 0x0, 0x90, 0x1, 0xc5, 0x60, 0x56,
+
+    /* U+0079 "y" */
+    0xb, 0xdb, 0x0, 0xfe, 0x2d, 0xd3, 0x6, 0x12, 0x28, 0x7, 0xea, 0x22, 0x20, 0x30, 0x87, 0x0,
+    0x7c, 0x2c, 0xa, 0x40, 0x2e, 0x8, 0x60, 0x1e, 0x71, 0x9, 0x0, 0xac, 0x1, 0x20, 0x1e, 0xa0,
+    0x43, 0x0, 0x89, 0x41, 0x44, 0x3, 0x21, 0x87, 0x0, 0x77, 0x0, 0x24, 0x3, 0x70, 0x12, 0x80,
+    0x72, 0x18, 0x30, 0x4, 0x4a, 0x16, 0x1, 0xf5, 0x0, 0xb0, 0x2, 0x80, 0x5c, 0x3, 0xe6, 0x10,
+    0xa0, 0x16, 0x6, 0x10, 0xf, 0xd2, 0x6, 0x8e, 0x21, 0x20, 0x1f, 0xcc, 0x21, 0xd6, 0xc, 0x20,
+    0x1f, 0xc2, 0xe0, 0xa4, 0x14, 0x1, 0xff, 0x58, 0x4, 0x86, 0x1, 0xff, 0x12, 0x0, 0x3c, 0x3,
+    0xff, 0x82, 0xe0, 0x48, 0x1, 0xff, 0x94, 0xc2, 0xc0, 0x3f, 0x4a, 0x80, 0xe, 0xc0, 0x98, 0x3,
+    0xe4, 0x6a, 0xee, 0x60, 0x84, 0x80, 0x7e, 0x73, 0x1, 0x10, 0x15, 0xa0, 0x7, 0xe3, 0xcc, 0x4c,
+    0xaf, 0x50, 0x3, 0xf8,
+
+    /* U+007A "z" */
+    0x9d, 0xdf, 0xf9, 0x8, 0xbf, 0xf0, 0xfc, 0xcf, 0xcc, 0x0, 0x34, 0x43, 0x37, 0x91, 0xc0, 0x78,
+    0x40, 0x3e, 0xe1, 0xa, 0x20, 0xf, 0xa4, 0xc2, 0x10, 0x3, 0xe7, 0x60, 0x57, 0x0, 0xf9, 0x20,
+    0xe, 0xc0, 0x3e, 0x2a, 0x1, 0xe1, 0x0, 0xf0, 0xf0, 0x85, 0x10, 0x7, 0xd6, 0x61, 0x28, 0x1,
+    0xf3, 0xa8, 0x33, 0x0, 0x3e, 0x48, 0x2, 0xd3, 0x3f, 0x8a, 0x40, 0x5, 0x79, 0x9f, 0x50, 0x7,
+    0xff, 0x4,
+
+    /* U+007B "{" */
+    0x0, 0xc5, 0x17, 0x86, 0x1, 0x26, 0xba, 0x1b, 0x80, 0x50, 0x0, 0x48, 0x60, 0x0, 0x98, 0x1d,
+    0xb9, 0x0, 0xc, 0x0, 0x80, 0x1f, 0xfe, 0x61, 0x0, 0xfc, 0xc0, 0xf, 0x0, 0x97, 0x28, 0x5,
+    0x40, 0x23, 0x30, 0x1, 0x88, 0x2, 0x58, 0x30, 0x74, 0x0, 0x8d, 0xfc, 0x0, 0x60, 0x1c, 0x20,
+    0xf, 0x0, 0xff, 0xf4, 0x88, 0x7, 0x10, 0x83, 0x98, 0x7, 0x38, 0xe, 0x7a, 0x0, 0x50, 0xc0,
+    0x1f, 0xc, 0xf6, 0x5a, 0x80,
+
+    /* U+007C "|" */
+    0x1c, 0xc2, 0x81, 0x9c, 0x1, 0xff, 0xff, 0x0, 0xff, 0xe4, 0x8d, 0xd9, 0x0,
+
+    /* U+007D "}" */
+    0x5c, 0xb8, 0x20, 0xc, 0x46, 0x8f, 0x84, 0x1, 0x24, 0x18, 0xc, 0x0, 0x46, 0xf8, 0x40, 0x80,
+    0x1e, 0x70, 0x10, 0xf, 0xff, 0x81, 0x80, 0xc, 0x3, 0xb4, 0x1, 0xb8, 0x40, 0x12, 0x28, 0x9,
+    0x88, 0x4, 0xea, 0x9, 0x4, 0x1, 0x70, 0x2, 0x9c, 0x40, 0x23, 0x0, 0x8, 0x7, 0xff, 0x98,
+    0x40, 0x3e, 0x54, 0x2, 0x0, 0x9f, 0xe8, 0x1, 0x40, 0x1e, 0x17, 0x70, 0x4, 0xb7, 0x9f, 0x0,
+    0x18,
+
+    /* U+007E "~" */
+    0x0, 0x84, 0xc4, 0x3, 0xc2, 0x0, 0x1a, 0xec, 0xf8, 0x0, 0xc7, 0xd2, 0x16, 0xa0, 0x22, 0x7c,
+    0x20, 0x5, 0x87, 0xa, 0x8e, 0x75, 0x91, 0xe4, 0x53, 0x82, 0xa8, 0x18, 0xc1, 0x31, 0x5, 0xd4,
+    0x20, 0x9a, 0x68, 0x2, 0x1b, 0xb3, 0xbb, 0x1c, 0x0,
+
+    /* U+00A0 "" */
+
+    /* U+00A1 "¡" */
+    0x6e, 0xc1, 0x91, 0x36, 0x20, 0x0, 0xfb, 0xcb, 0x14, 0x30, 0x7, 0x1d, 0x40, 0x32, 0xa8, 0xc,
+    0xc, 0x4, 0x3, 0x84, 0x3c, 0x3, 0xc2, 0x20, 0x1, 0x80, 0x63, 0x0, 0x8, 0x80, 0xe, 0x1,
+    0x9c, 0x0, 0x3d, 0xba, 0x40,
+
+    /* U+00A2 "¢" */
+    0x0, 0xf8, 0xc8, 0x3, 0xfe, 0x2c, 0x80, 0xf, 0xfe, 0xca, 0x4f, 0x82, 0xe4, 0x98, 0x6, 0x1b,
+    0xb3, 0x10, 0x0, 0xdb, 0x20, 0x0, 0x38, 0x80, 0x2a, 0x4, 0xa2, 0xf, 0x1, 0x64, 0xb, 0xf0,
+    0xf, 0x58, 0x60, 0x3, 0x50, 0x3a, 0x10, 0xc, 0x5b, 0x91, 0x60, 0x8, 0x0, 0xf8, 0x4c, 0xc,
+    0x0, 0x80, 0x1f, 0xe7, 0x1, 0x0, 0xff, 0x9c, 0x4, 0x3, 0xfe, 0x20, 0x1, 0x80, 0x7f, 0xb4,
+    0x1, 0x20, 0x1f, 0x8, 0x81, 0x10, 0xa, 0xe0, 0x1c, 0x37, 0xec, 0x12, 0x21, 0x18, 0xa0, 0xcf,
+    0x8a, 0x38, 0x5, 0x84, 0x7, 0x0, 0x70, 0x40, 0x96, 0x0, 0x2d, 0x93, 0x10, 0x0, 0xa5, 0x58,
+    0x80, 0x66, 0xcc, 0x2, 0xf5, 0xa8, 0x7, 0xff, 0x60, 0xb2, 0x0, 0x38,
+
+    /* U+00A3 "£" */
+    0x0, 0xfc, 0x91, 0x79, 0x8b, 0x96, 0x10, 0xf, 0x8f, 0x2d, 0xd0, 0xcc, 0x8d, 0x3e, 0xa0, 0x1c,
+    0x98, 0x60, 0x3, 0x44, 0x18, 0x80, 0x80, 0x71, 0x50, 0x1, 0xfb, 0x2e, 0xd9, 0xd6, 0xaa, 0x0,
+    0xd4, 0x20, 0xf0, 0x20, 0x1c, 0x94, 0x1, 0xca, 0x3, 0x20, 0x1f, 0xfc, 0x11, 0x20, 0x51, 0x0,
+    0xff, 0xe0, 0x98, 0x0, 0x40, 0x3f, 0xfa, 0x25, 0x76, 0x90, 0x2, 0x5d, 0xfc, 0x20, 0x19, 0x12,
+    0x0, 0xa, 0x27, 0xc6, 0x1, 0x16, 0xeb, 0x0, 0x9, 0xbb, 0xf1, 0x0, 0x62, 0x20, 0x80, 0x4,
+    0x8b, 0xe0, 0xf, 0xff, 0xf8, 0xb, 0xb9, 0x40, 0xc, 0xef, 0xfe, 0x23, 0x88, 0x80, 0x7, 0x11,
+    0xfe, 0x60, 0xf, 0xfe, 0x30,
+
+    /* U+00A4 "¤" */
+    0x19, 0x0, 0xff, 0xe0, 0x9b, 0x86, 0xb5, 0x88, 0x4, 0x6a, 0x84, 0x1, 0x26, 0xc3, 0x58, 0x25,
+    0x14, 0xf6, 0x55, 0xee, 0x99, 0x28, 0x49, 0x1e, 0x1, 0x35, 0x84, 0x4, 0x40, 0x53, 0x62, 0x5e,
+    0x40, 0xee, 0x0, 0xc, 0xf7, 0x5a, 0xc0, 0x17, 0x90, 0x4, 0x80, 0x58, 0xc2, 0x0, 0x29, 0xa0,
+    0x2, 0x80, 0x48, 0x61, 0xc4, 0x1, 0xe5, 0x70, 0x90, 0xb, 0x41, 0xc, 0x3, 0xf4, 0x80, 0x98,
+    0x0, 0x80, 0xc0, 0x3f, 0x84, 0xc1, 0x80, 0x37, 0x80, 0x7f, 0xe3, 0x0, 0x10, 0x68, 0x7, 0xf0,
+    0x90, 0x10, 0x3, 0x1, 0x48, 0x3, 0xf3, 0x88, 0x90, 0x0, 0xa4, 0x1c, 0x20, 0x1e, 0x38, 0x9,
+    0x0, 0xd4, 0x7, 0x88, 0x1, 0xb, 0xe0, 0x83, 0x0, 0x49, 0x20, 0x2, 0xbe, 0xcd, 0xe8, 0x0,
+    0xa8, 0x41, 0x28, 0x4a, 0xd0, 0x4, 0xc8, 0x6, 0x20, 0x9, 0xa3, 0x22, 0x5e, 0x97, 0xb5, 0x13,
+    0x7c, 0xee, 0x90, 0x36, 0xf4, 0xc2, 0x0, 0x12, 0xbb, 0x20, 0x4, 0xd4, 0xce,
+
+    /* U+00A5 "¥" */
+    0x89, 0x90, 0x80, 0x7f, 0xe1, 0x99, 0x36, 0xb3, 0x2c, 0x3, 0xff, 0x53, 0x3a, 0x2b, 0x2, 0xa8,
+    0x3, 0xfc, 0xe8, 0x10, 0x41, 0x4, 0x16, 0x40, 0x1f, 0x8e, 0x1, 0x58, 0x0, 0x3c, 0x3, 0xc0,
+    0x1f, 0xf, 0x0, 0xd8, 0x6, 0x38, 0x3, 0x80, 0xf, 0x41, 0x5, 0x8, 0x7, 0x3a, 0x3, 0x98,
+    0x6, 0x56, 0x7, 0x40, 0xf, 0xa4, 0x43, 0x84, 0x0, 0x56, 0x7, 0x0, 0x1f, 0x8a, 0xc0, 0xac,
+    0x1, 0x22, 0x2e, 0x0, 0xff, 0x2b, 0x2, 0xa9, 0xd0, 0x20, 0x80, 0x3f, 0xe8, 0x20, 0xb8, 0x5,
+    0x60, 0xf, 0xc9, 0x77, 0x50, 0x0, 0x40, 0xd, 0x77, 0x88, 0x3, 0xb, 0x36, 0x1, 0x0, 0x10,
+    0xb3, 0x60, 0xe, 0x5d, 0xde, 0x90, 0x4, 0xee, 0xf1, 0x0, 0x7f, 0xf3, 0x17, 0x77, 0xa4, 0x1,
+    0x5b, 0xbc, 0x60, 0x18, 0x59, 0xb8, 0xc0, 0x4, 0xcd, 0xc2, 0x1, 0x92, 0xef, 0xa8, 0x1, 0x17,
+    0x7c, 0x40, 0x1f, 0xfd, 0xe0,
+
+    /* U+00A6 "¦" */
+    0x1c, 0xc2, 0x81, 0x9c, 0x1, 0xff, 0xd4, 0x1f, 0xf3, 0x0, 0x7f, 0xf2, 0x59, 0x84, 0x33, 0x24,
+    0x0, 0xff, 0xea, 0xd, 0xd9, 0x0,
+
+    /* U+00A7 "§" */
+    0x0, 0xc4, 0xf5, 0x76, 0xa7, 0x30, 0xe, 0x9d, 0x85, 0x44, 0x2c, 0x66, 0x4, 0x1, 0x2c, 0x6,
+    0xf3, 0xe, 0x60, 0x22, 0x2, 0x60, 0x7c, 0x86, 0x78, 0xcc, 0x48, 0x1, 0xc0, 0x12, 0x1, 0xe3,
+    0x40, 0x0, 0x80, 0x14, 0x3, 0xfc, 0xa2, 0x14, 0xe4, 0x1, 0xf8, 0x68, 0x6, 0x37, 0x21, 0x0,
+    0x3d, 0xe0, 0x1, 0x3, 0x7b, 0xd4, 0x0, 0x9d, 0x6, 0xbb, 0x65, 0x40, 0xad, 0x0, 0x14, 0xc,
+    0xa0, 0x4d, 0x5a, 0x41, 0x0, 0x3, 0xe, 0x0, 0xe2, 0xb0, 0x20, 0x1, 0x5, 0x8, 0x7, 0x8,
+    0x6, 0xa0, 0x3c, 0x73, 0x0, 0x15, 0x3, 0x80, 0x1a, 0x4, 0xa3, 0x3a, 0xf0, 0x89, 0x0, 0x13,
+    0xfc, 0xa0, 0x89, 0x4, 0x24, 0x40, 0x30, 0xb5, 0xf5, 0xb0, 0x2, 0x40, 0x3f, 0x92, 0x68, 0x9,
+    0x0, 0x3f, 0xca, 0x0, 0x20, 0x3, 0xa8, 0x7, 0x94, 0x0, 0x40, 0x33, 0x5d, 0x4e, 0xcf, 0x74,
+    0x8, 0x80, 0x16, 0x11, 0x2c, 0x4c, 0x20, 0x25, 0x0, 0x51, 0xf4, 0xc8, 0x68, 0xf7, 0x61, 0x0,
+
+    /* U+00A8 "¨" */
+    0x4, 0x20, 0x8, 0xcc, 0xf, 0x78, 0x20, 0x99, 0x84, 0xf0, 0x13, 0x1, 0x0, 0xc, 0xc5, 0x90,
+    0x2c, 0xc9, 0x40,
+
+    /* U+00A9 "©" */
+    0x0, 0xf0, 0xa4, 0x4d, 0x4b, 0x10, 0x7, 0xfc, 0x2f, 0xf6, 0x67, 0xaf, 0x6d, 0x0, 0x3f, 0x16,
+    0xcc, 0x75, 0xd4, 0xd6, 0xe0, 0xdc, 0x0, 0x78, 0xb1, 0xfd, 0x84, 0x3, 0x8e, 0xa8, 0xd2, 0x1,
+    0xdc, 0xb6, 0x20, 0x4, 0x78, 0x73, 0x0, 0x2d, 0x33, 0x0, 0x27, 0x2a, 0x0, 0x1e, 0x5c, 0x3c,
+    0x65, 0x88, 0x23, 0xc0, 0x80, 0x26, 0x42, 0x5, 0xa6, 0x51, 0x30, 0x49, 0xa0, 0x9, 0x6, 0x4,
+    0x16, 0x0, 0x48, 0xa6, 0x3b, 0x3e, 0x37, 0x0, 0x5, 0xf0, 0xc, 0x84, 0x9, 0x2, 0x44, 0x2,
+    0x19, 0x20, 0xb, 0x14, 0x39, 0x80, 0xe, 0x6, 0x40, 0x1f, 0xe1, 0x18, 0x4, 0x3, 0x38, 0x7,
+    0xff, 0x8, 0x58, 0x0, 0x20, 0xa0, 0x1f, 0xf0, 0x80, 0xf1, 0x0, 0x10, 0x44, 0xc0, 0x1c, 0x60,
+    0x1b, 0x4c, 0x10, 0x54, 0x1, 0x1, 0x2e, 0x20, 0x31, 0x94, 0x1, 0x2a, 0x1, 0x2c, 0x80, 0x19,
+    0xc2, 0x3b, 0xf9, 0xc7, 0xc0, 0xa, 0x54, 0x0, 0x83, 0x70, 0x4, 0x62, 0x90, 0x93, 0x62, 0x80,
+    0xdb, 0x90, 0x0, 0xa6, 0x14, 0x0, 0x75, 0xbd, 0xb2, 0x40, 0x3a, 0x52, 0x1, 0x9a, 0x2a, 0x44,
+    0x3, 0xe5, 0xf0, 0xd1, 0x0, 0xe7, 0xb4, 0xf9, 0x54, 0x34, 0x7c, 0xa6, 0xd1, 0x0, 0xf9, 0x36,
+    0xce, 0x2b, 0x27, 0x2f, 0x60, 0x40, 0x30,
+
+    /* U+00AA "ª" */
+    0x5, 0xad, 0xd6, 0x40, 0x83, 0xd3, 0xa2, 0x5, 0xf4, 0x1a, 0xf6, 0x65, 0xa8, 0x6a, 0x28, 0x2,
+    0x31, 0x81, 0xd, 0x77, 0x67, 0x0, 0x52, 0xce, 0x6e, 0x9c, 0x0, 0xa2, 0xe6, 0x44, 0x10, 0x2,
+    0x8c, 0xa2, 0x25, 0x80, 0x14, 0xad, 0x76, 0x28, 0x0, 0xd, 0x76, 0xf5, 0xbf, 0xb8,
+
+    /* U+00AB "«" */
+    0x0, 0x86, 0xf1, 0x80, 0xf, 0x94, 0x1, 0x5a, 0x3, 0x2, 0x41, 0xc8, 0x1, 0x94, 0x78, 0xa,
+    0x82, 0xc, 0xe, 0x42, 0xc8, 0x24, 0x51, 0xc0, 0x78, 0x19, 0x42, 0x10, 0x68, 0x1, 0x24, 0x30,
+    0x4, 0xe1, 0x2, 0x0, 0xa1, 0x14, 0x81, 0x28, 0x58, 0x80, 0xa, 0x81, 0xd0, 0x2c, 0x89, 0x0,
+    0x12, 0x38, 0x50, 0x8b, 0x85, 0x98, 0x1, 0x42, 0xd, 0x1, 0xc0, 0x41, 0x0, 0x54, 0x4a, 0xc0,
+    0xcc, 0x9,
+
+    /* U+00AC "¬" */
+    0x2e, 0xef, 0xfc, 0xc0, 0x23, 0xff, 0x80, 0xee, 0xff, 0xc0, 0x10, 0xa2, 0x7f, 0x84, 0x3, 0xff,
+    0xd7, 0x56, 0x80,
+
+    /* U+00AD "" */
+    0x5d, 0xdf, 0x88, 0xc8, 0xbe, 0x5, 0x88, 0xf8, 0xc0,
+
+    /* U+00AE "®" */
+    0x0, 0xf0, 0xa4, 0x4d, 0x4b, 0x10, 0x7, 0xfc, 0x2f, 0xf6, 0x67, 0xaf, 0x6d, 0x0, 0x3f, 0x16,
+    0xcc, 0x75, 0xd4, 0xd6, 0xe0, 0xdc, 0x0, 0x78, 0xb1, 0xfd, 0x84, 0x3, 0x8e, 0xa8, 0xd2, 0x1,
+    0xdc, 0xb6, 0x28, 0xcd, 0x94, 0x80, 0xb, 0x4c, 0xc0, 0x9, 0xca, 0x80, 0x1f, 0x33, 0xab, 0x6c,
+    0x41, 0x1e, 0x4, 0x1, 0x32, 0x10, 0xd, 0x79, 0x8a, 0x44, 0x50, 0x2, 0x41, 0x81, 0x5, 0x80,
+    0x39, 0x8c, 0xcb, 0x66, 0x84, 0x2, 0xf8, 0x6, 0x42, 0x1, 0xfe, 0x50, 0x60, 0x6, 0x28, 0x73,
+    0x0, 0x7f, 0x85, 0x1, 0x80, 0x2, 0x30, 0x8, 0x7, 0x95, 0x67, 0xc2, 0x52, 0x0, 0xe1, 0x60,
+    0xf, 0x45, 0x52, 0x9, 0xe8, 0x2, 0x10, 0x1e, 0x20, 0xf, 0x56, 0x61, 0x43, 0x40, 0x36, 0x98,
+    0x20, 0xa8, 0x7, 0x39, 0x9a, 0xca, 0xc4, 0x2, 0x54, 0x2, 0x59, 0x0, 0xfc, 0x30, 0x30, 0x0,
+    0x52, 0xa0, 0x4, 0x1b, 0x80, 0x8, 0xc0, 0x32, 0xb2, 0x98, 0xdb, 0x90, 0x0, 0xa6, 0x14, 0x27,
+    0x8, 0x3, 0x4e, 0x16, 0x94, 0x80, 0x66, 0x8a, 0x91, 0x0, 0xf9, 0x7c, 0x34, 0x40, 0x39, 0xed,
+    0x3e, 0x55, 0xd, 0x1f, 0x29, 0xb4, 0x40, 0x3e, 0x4d, 0xb3, 0x8a, 0xc9, 0xcb, 0xd8, 0x10, 0xc,
+
+    /* U+00AF "¯" */
+    0x2a, 0xaf, 0xd2, 0xa, 0xbf, 0x9c,
+
+    /* U+00B0 "°" */
+    0x0, 0x14, 0x5d, 0x38, 0x80, 0x4b, 0x8c, 0xee, 0x8c, 0x20, 0x2b, 0x2c, 0xc6, 0xd9, 0xf0, 0x50,
+    0xf1, 0x0, 0x12, 0x4d, 0x8, 0xa0, 0xc, 0x80, 0x40, 0x60, 0x1c, 0xe0, 0xf, 0x16, 0x0, 0xde,
+    0x8, 0xa7, 0x30, 0x8b, 0x68, 0xe4, 0x1a, 0xaf, 0x74, 0xb1, 0x0, 0x0, 0xd6, 0xdd, 0xbd, 0xc0,
+    0x0,
+
+    /* U+00B1 "±" */
+    0x0, 0xf1, 0x10, 0x40, 0x3f, 0xed, 0xd2, 0x0, 0x7f, 0xf9, 0x11, 0x38, 0x1, 0xa8, 0x98, 0x89,
+    0x77, 0xc0, 0x7, 0xbb, 0xc8, 0x2, 0x3c, 0x0, 0x11, 0xe0, 0x2e, 0xee, 0x0, 0x5f, 0x76, 0x60,
+    0xf, 0xff, 0x21, 0x98, 0x40, 0x3f, 0xec, 0xc2, 0x0, 0x7f, 0xf2, 0xc, 0xff, 0xf0, 0x96, 0x67,
+    0xfe, 0x70, 0xf, 0xfe, 0x10,
+
+    /* U+00B2 "²" */
+    0x5, 0xad, 0xda, 0x8c, 0x1, 0x54, 0x50, 0x13, 0x5c, 0x60, 0x24, 0xdd, 0x67, 0x48, 0x40, 0x45,
+    0x90, 0x4, 0xc2, 0x30, 0x7, 0x8c, 0x48, 0x40, 0x38, 0xb8, 0x20, 0x3, 0x8f, 0xca, 0x14, 0x3,
+    0x26, 0x94, 0xb8, 0x6, 0x5b, 0xb, 0x60, 0xc, 0xf4, 0x5a, 0x80, 0x1a, 0x20, 0x0, 0xfc, 0xcc,
+    0xe2, 0x44, 0x1, 0x1e, 0xf0,
+
+    /* U+00B3 "³" */
+    0xa, 0xcc, 0xfc, 0x20, 0x23, 0xe2, 0x32, 0x0, 0x5e, 0xee, 0xf0, 0x1d, 0x10, 0xe, 0x2f, 0x1a,
+    0x30, 0xe, 0x1f, 0x2a, 0x40, 0xf, 0x49, 0x4, 0x49, 0x0, 0x76, 0xbb, 0xb, 0x61, 0x0, 0x65,
+    0x89, 0xc6, 0x1a, 0x0, 0xfd, 0x80, 0x21, 0x2c, 0x1, 0x87, 0x83, 0xc5, 0xe7, 0xf2, 0xf3, 0xd1,
+    0xe, 0x3f, 0x8, 0x4a, 0x4b, 0x36, 0x20,
+
+    /* U+00B4 "´" */
+    0x0, 0x8a, 0x6a, 0x48, 0x0, 0x78, 0xcf, 0x44, 0x7, 0xa2, 0xb8, 0x60, 0x7a, 0x31, 0x42, 0x0,
+
+    /* U+00B5 "µ" */
+    0x6d, 0xd1, 0x80, 0x7c, 0x5b, 0xa7, 0x12, 0x23, 0x80, 0x7c, 0x24, 0x4f, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xf5, 0x44, 0x3, 0xe5, 0x0, 0xf6, 0x0, 0x7d, 0xa0, 0x1e, 0x64, 0x0, 0xe7, 0x40, 0xf,
+    0xae, 0x55, 0x1a, 0xe0, 0x40, 0x3c, 0x60, 0xd5, 0x72, 0x81, 0x60, 0x1e, 0x89, 0x41, 0x2, 0x5c,
+    0x50, 0xf, 0x9a, 0xfb, 0xf6, 0x8c, 0x3f, 0xd0, 0x1, 0xff, 0xf0, 0x5b, 0xb2, 0x80, 0x7f, 0xc0,
+
+    /* U+00B6 "¶" */
+    0x0, 0x89, 0xea, 0xf3, 0x3f, 0x10, 0x2, 0x76, 0x15, 0xc, 0xff, 0x8, 0x4b, 0x0, 0x72, 0x55,
+    0x60, 0x8, 0x98, 0x3, 0xc4, 0xab, 0x20, 0x4, 0x80, 0x1f, 0xfd, 0x32, 0x0, 0xff, 0xe1, 0xa1,
+    0x0, 0x7f, 0xf0, 0xf8, 0x40, 0x3f, 0xf8, 0x47, 0x8a, 0x20, 0x1f, 0xfc, 0x12, 0xaf, 0xd4, 0x0,
+    0xff, 0xe0, 0x89, 0x8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xdd, 0xc6, 0xf0, 0x8,
+    0x59, 0x82,
+
+    /* U+00B7 "·" */
+    0x2, 0x86, 0x0, 0x63, 0xcb, 0x10, 0x80, 0x38, 0x94, 0x6, 0xc2, 0xb3, 0xcc,
+
+    /* U+00B8 "¸" */
+    0x0, 0x9, 0x80, 0x74, 0x68, 0x7, 0x20, 0x49, 0x0, 0x56, 0xcc, 0xf0, 0x9, 0xa0, 0xc8, 0x8b,
+    0x2f, 0x26, 0x24, 0x47, 0x86, 0x4d, 0x7, 0xee, 0x7d, 0x98, 0x0,
+
+    /* U+00B9 "¹" */
+    0x6c, 0xcc, 0xc0, 0x18, 0x44, 0x47, 0xc0, 0x13, 0x6e, 0xa4, 0x3, 0xff, 0xf1, 0x39, 0x8a, 0x5,
+    0xcc, 0x20, 0x8, 0x80, 0x80, 0x46,
+
+    /* U+00BA "º" */
+    0x0, 0x9a, 0xf7, 0x54, 0x80, 0x10, 0xdc, 0xab, 0xa, 0xdc, 0x0, 0x25, 0x17, 0xef, 0x34, 0x9d,
+    0x1, 0x86, 0xc4, 0x0, 0x50, 0x1c, 0x22, 0x21, 0x0, 0xce, 0xc, 0x20, 0x40, 0x1c, 0xc0, 0xc0,
+    0xa3, 0x0, 0x10, 0xc0, 0x78, 0x41, 0x3e, 0x44, 0xe1, 0xaa, 0x80, 0xb1, 0x89, 0xd8, 0x22, 0x80,
+    0x21, 0x9e, 0xeb, 0x5c, 0x0,
+
+    /* U+00BB "»" */
+    0x9c, 0x90, 0x2, 0xe6, 0x8, 0x2, 0xb2, 0x66, 0x2, 0xb9, 0xc8, 0x4, 0x56, 0x10, 0x61, 0x42,
+    0x90, 0x1, 0x2b, 0xf, 0x8, 0xa8, 0x1d, 0x0, 0x28, 0x22, 0x58, 0x23, 0x85, 0x10, 0x0, 0x64,
+    0x15, 0x2, 0x8, 0x6c, 0x2, 0xf0, 0x44, 0x3, 0x10, 0xd0, 0x2, 0x10, 0x68, 0xe, 0x2, 0xc,
+    0x11, 0xc2, 0x84, 0x5c, 0x2c, 0xc0, 0x1a, 0x8, 0x40, 0x82, 0x38, 0x0, 0x58, 0x23, 0x82, 0xb9,
+    0x70, 0x80, 0x0,
+
+    /* U+00BC "¼" */
+    0x59, 0x9c, 0xa0, 0x1f, 0xf0, 0xcc, 0x84, 0x3, 0xda, 0xcd, 0xb4, 0x3, 0xfe, 0xb6, 0xe1, 0x0,
+    0xf4, 0x7f, 0xa0, 0x3, 0xff, 0x2a, 0x8d, 0xc0, 0x3f, 0xf9, 0x43, 0x63, 0xc0, 0x1f, 0xfc, 0xbb,
+    0x18, 0x20, 0xf, 0xfe, 0x53, 0x2a, 0x30, 0x7, 0xff, 0x28, 0xa0, 0x64, 0x3, 0xff, 0x97, 0x23,
+    0x4, 0x1, 0xff, 0xca, 0x64, 0x56, 0x0, 0xc3, 0x32, 0x10, 0xf, 0xfe, 0x11, 0x40, 0xd8, 0x7,
+    0x5b, 0x70, 0x80, 0x4f, 0x32, 0xb0, 0x49, 0x91, 0x80, 0x38, 0x6c, 0x40, 0x33, 0x2a, 0x38, 0x6,
+    0xc6, 0x61, 0x81, 0xb3, 0x40, 0xe6, 0xaa, 0x0, 0xc7, 0x23, 0x40, 0x1d, 0x7f, 0xff, 0x29, 0xc1,
+    0x58, 0x6, 0x1e, 0xa, 0x10, 0xf, 0xfe, 0x17, 0x84, 0x88, 0x6, 0xb2, 0x84, 0x9, 0xa0, 0xf,
+    0xfa, 0xd, 0x90, 0x3, 0x32, 0xa3, 0x80, 0x11, 0x0, 0x1f, 0xe3, 0x72, 0x80, 0xc, 0x72, 0x18,
+    0xcd, 0x18, 0x33, 0x4, 0x3, 0xc3, 0xc1, 0x22, 0x1, 0x90, 0x1, 0x13, 0x30, 0x8a, 0x64, 0x40,
+    0x1e, 0x82, 0x74, 0x0, 0xe5, 0xcc, 0xf0, 0xe, 0x60, 0x80, 0x39, 0x18, 0xa4, 0x3, 0xc4, 0x67,
+    0xe0, 0x1, 0x98, 0x40, 0x30, 0xc8, 0x70, 0x80, 0x7f, 0xf1, 0x80,
+
+    /* U+00BD "½" */
+    0x59, 0x9c, 0xa0, 0x1f, 0xf0, 0xcc, 0x84, 0x3, 0xb5, 0x9b, 0x68, 0x7, 0xfd, 0x6d, 0xc2, 0x1,
+    0xd1, 0xfe, 0x80, 0xf, 0xfc, 0xaa, 0x37, 0x0, 0xff, 0xe4, 0x8d, 0x8f, 0x0, 0x7f, 0xf2, 0xac,
+    0x60, 0x80, 0x3f, 0xf9, 0x2c, 0xa8, 0xc0, 0x1f, 0xfc, 0x92, 0x81, 0x90, 0xf, 0xfe, 0x54, 0x8c,
+    0x10, 0x7, 0xff, 0x25, 0x91, 0x58, 0xe, 0x2a, 0xe9, 0xc4, 0x3, 0xff, 0x82, 0x50, 0x36, 0x13,
+    0x8e, 0xab, 0x47, 0x98, 0x3c, 0xca, 0xc1, 0x26, 0x46, 0x0, 0xe1, 0xb1, 0x11, 0x1d, 0xff, 0x71,
+    0x87, 0xc3, 0x19, 0x86, 0x6, 0xcd, 0x3, 0x9a, 0xa8, 0x6, 0xf1, 0x0, 0x3, 0x20, 0x61, 0x7f,
+    0xff, 0x29, 0xc1, 0x58, 0x7, 0xf1, 0x81, 0x0, 0x7f, 0xbc, 0x24, 0x40, 0x3f, 0xf, 0x84, 0x0,
+    0x7f, 0x41, 0xb2, 0x0, 0x7e, 0x2c, 0x37, 0x50, 0xf, 0xc6, 0xe5, 0x0, 0x1f, 0x8f, 0xa, 0x20,
+    0x1, 0xf8, 0x78, 0x24, 0x40, 0x3e, 0x4d, 0x1a, 0x70, 0xf, 0xe8, 0x27, 0x40, 0xf, 0x9a, 0xc2,
+    0xd4, 0x3, 0xf9, 0x18, 0xa4, 0x3, 0xe7, 0x90, 0x2d, 0x99, 0xca, 0x1, 0x86, 0x43, 0x84, 0x3,
+    0xeb, 0x0, 0x1b, 0x37, 0x68,
+
+    /* U+00BE "¾" */
+    0x8, 0x99, 0xfc, 0x20, 0x1f, 0x86, 0x64, 0x20, 0x1f, 0x2b, 0x37, 0xe0, 0xf, 0xeb, 0x6e, 0x10,
+    0xf, 0xb7, 0xff, 0x71, 0x85, 0x8, 0x7, 0xca, 0xa3, 0x70, 0xf, 0xfc, 0x3a, 0x72, 0xa0, 0x1f,
+    0xd, 0x8f, 0x0, 0x7f, 0xf0, 0x68, 0xe1, 0x80, 0x3f, 0x58, 0xc1, 0x0, 0x7f, 0xe8, 0x40, 0xd6,
+    0x0, 0xf9, 0x95, 0x18, 0x3, 0xff, 0x83, 0xc8, 0x69, 0x38, 0x20, 0x18, 0xa0, 0x64, 0x3, 0xff,
+    0x84, 0xd7, 0x9e, 0x86, 0xc0, 0x1a, 0x46, 0x8, 0x3, 0xff, 0x8a, 0x3c, 0x1a, 0x1, 0x32, 0x2b,
+    0x0, 0x61, 0x99, 0x8, 0x6, 0x63, 0x0, 0xef, 0xd, 0x0, 0x14, 0xd, 0x80, 0x75, 0xb7, 0x8,
+    0x4, 0x33, 0x98, 0x98, 0x9d, 0x52, 0x60, 0x7, 0xd, 0x88, 0x6, 0x65, 0x47, 0x0, 0xc3, 0x8a,
+    0x4c, 0xec, 0x6d, 0x82, 0xe, 0x6a, 0xa0, 0xc, 0x72, 0x34, 0x1, 0xe3, 0xae, 0xe6, 0xf7, 0x24,
+    0x40, 0xe0, 0xac, 0x3, 0xf, 0x5, 0x8, 0x7, 0xf0, 0x90, 0x80, 0x6f, 0x9, 0x10, 0xd, 0x65,
+    0x8, 0x13, 0x40, 0x1f, 0xfc, 0x18, 0x36, 0x40, 0xc, 0xca, 0x8e, 0x0, 0x44, 0x0, 0x7f, 0xe3,
+    0x72, 0x80, 0xc, 0x72, 0x18, 0xcd, 0x18, 0x33, 0x4, 0x3, 0xf0, 0xf0, 0x48, 0x80, 0x64, 0x0,
+    0x44, 0xcc, 0x22, 0x99, 0x10, 0x7, 0xe8, 0x27, 0x40, 0xe, 0x5c, 0xcf, 0x0, 0xe6, 0x8, 0x3,
+    0xe4, 0x62, 0x90, 0xf, 0x11, 0x9f, 0x80, 0x6, 0x61, 0x0, 0xf0, 0xc8, 0x70, 0x80, 0x7f, 0xf1,
+    0x80,
+
+    /* U+00BF "¿" */
+    0x0, 0xe1, 0xbe, 0x60, 0xf, 0xf9, 0x90, 0x64, 0x3, 0xfe, 0x10, 0x1, 0x0, 0x7f, 0xcd, 0x2f,
+    0xe0, 0x1f, 0xf9, 0xa0, 0x80, 0x3f, 0xf9, 0xc5, 0x54, 0x60, 0xf, 0xf9, 0x15, 0x5c, 0x1, 0xfe,
+    0x1b, 0x0, 0x50, 0x7, 0xf0, 0xe9, 0x4, 0x10, 0x7, 0xe2, 0xc3, 0x8, 0x70, 0xf, 0xc3, 0xe4,
+    0x12, 0xe0, 0x1f, 0xd2, 0x41, 0xc, 0x1, 0xfe, 0x60, 0x27, 0x0, 0xff, 0x8, 0x80, 0x40, 0x3f,
+    0xe1, 0x10, 0x19, 0x80, 0x3c, 0x39, 0x22, 0xe, 0x0, 0xd7, 0x21, 0x11, 0xc7, 0x9b, 0x30, 0x20,
+    0xc0, 0x63, 0x7b, 0x98, 0xe2, 0x10, 0xe0, 0x3b, 0x4, 0x1, 0xc2, 0xba, 0xe0, 0x10, 0xbe, 0xea,
+    0xea, 0x99, 0xd4, 0x40, 0x0,
+
+    /* U+00C0 "À" */
+    0x0, 0xe4, 0xcd, 0xb1, 0x0, 0xff, 0xe2, 0x24, 0x1a, 0x61, 0x0, 0x7f, 0xf1, 0x13, 0xd0, 0xbc,
+    0x80, 0x3f, 0xf8, 0x83, 0x6e, 0x30, 0x20, 0x1f, 0xfc, 0x58, 0xca, 0x10, 0xf, 0xfe, 0x21, 0xcc,
+    0x9c, 0x3, 0xff, 0x8b, 0x2c, 0xc8, 0x20, 0xf, 0xfe, 0x19, 0x28, 0x5, 0x60, 0x1f, 0xfc, 0x3a,
+    0x0, 0x18, 0x38, 0x80, 0x7f, 0xf0, 0x45, 0x81, 0x7c, 0x5, 0x80, 0x3f, 0xf8, 0x2c, 0x21, 0x26,
+    0x60, 0x90, 0xf, 0xfe, 0xd, 0x1, 0x98, 0x24, 0x5, 0x80, 0x3f, 0xe6, 0x20, 0x90, 0x2, 0x90,
+    0x58, 0x7, 0xfd, 0x40, 0x4a, 0x1, 0x50, 0x12, 0x0, 0x7f, 0x21, 0x85, 0x0, 0x66, 0x10, 0xf0,
+    0xf, 0xef, 0x1, 0x60, 0xc, 0x2e, 0x8, 0x60, 0x1f, 0x1a, 0x3, 0x88, 0x7, 0x58, 0x2, 0x40,
+    0x3e, 0xa0, 0x6, 0x91, 0x78, 0xc, 0x14, 0x80, 0x38, 0x98, 0x1, 0x7b, 0xbf, 0x18, 0x2, 0xc0,
+    0x3a, 0x80, 0x3f, 0xf8, 0x4e, 0x20, 0x10, 0xb0, 0x1e, 0xef, 0xfa, 0x0, 0x58, 0x2, 0x61, 0xa,
+    0x22, 0xff, 0x30, 0x84, 0x80, 0x54, 0x2, 0xe0, 0x1f, 0xe1, 0x60, 0x16, 0x5, 0x20, 0x61, 0x0,
+    0xff, 0xa4, 0x1, 0x61, 0x20, 0x9, 0x0, 0xff, 0xc2, 0xa0, 0x48,
+
+    /* U+00C1 "Á" */
+    0x0, 0xff, 0x9b, 0x75, 0x42, 0x1, 0xff, 0xc3, 0x79, 0x24, 0xa1, 0x0, 0xff, 0xe1, 0x3c, 0x4,
+    0xc8, 0x3, 0xff, 0x86, 0xb6, 0x98, 0xc0, 0x1f, 0xfc, 0x45, 0xcb, 0x30, 0xf, 0xfe, 0x29, 0xcc,
+    0x9c, 0x3, 0xff, 0x8b, 0x2c, 0xc8, 0x20, 0xf, 0xfe, 0x19, 0x28, 0x5, 0x60, 0x1f, 0xfc, 0x3a,
+    0x0, 0x18, 0x38, 0x80, 0x7f, 0xf0, 0x45, 0x81, 0x7c, 0x5, 0x80, 0x3f, 0xf8, 0x2c, 0x21, 0x26,
+    0x60, 0x90, 0xf, 0xfe, 0xd, 0x1, 0x98, 0x24, 0x5, 0x80, 0x3f, 0xe6, 0x20, 0x90, 0x2, 0x90,
+    0x58, 0x7, 0xfd, 0x40, 0x4a, 0x1, 0x50, 0x12, 0x0, 0x7f, 0x21, 0x85, 0x0, 0x66, 0x10, 0xf0,
+    0xf, 0xef, 0x1, 0x60, 0xc, 0x2e, 0x8, 0x60, 0x1f, 0x1a, 0x3, 0x88, 0x7, 0x58, 0x2, 0x40,
+    0x3e, 0xa0, 0x6, 0x91, 0x78, 0xc, 0x14, 0x80, 0x38, 0x98, 0x1, 0x7b, 0xbf, 0x18, 0x2, 0xc0,
+    0x3a, 0x80, 0x3f, 0xf8, 0x4e, 0x20, 0x10, 0xb0, 0x1e, 0xef, 0xfa, 0x0, 0x58, 0x2, 0x61, 0xa,
+    0x22, 0xff, 0x30, 0x84, 0x80, 0x54, 0x2, 0xe0, 0x1f, 0xe1, 0x60, 0x16, 0x5, 0x20, 0x61, 0x0,
+    0xff, 0xa4, 0x1, 0x61, 0x20, 0x9, 0x0, 0xff, 0xc2, 0xa0, 0x48,
+
+    /* U+00C2 "Â" */
+    0x0, 0xfc, 0xdb, 0xab, 0x10, 0xf, 0xfe, 0x1b, 0x49, 0x2, 0x68, 0x80, 0x7f, 0xf0, 0x5a, 0x46,
+    0xf1, 0x4f, 0x44, 0x3, 0xfe, 0x4a, 0x4d, 0x41, 0xa7, 0xb, 0x0, 0xff, 0x93, 0x2c, 0xc0, 0x28,
+    0xca, 0x0, 0xff, 0xe1, 0x1c, 0xc9, 0xc0, 0x3f, 0xf8, 0xb2, 0xcc, 0x82, 0x0, 0xff, 0xe1, 0x92,
+    0x80, 0x56, 0x1, 0xff, 0xc3, 0xa0, 0x1, 0x83, 0x88, 0x7, 0xff, 0x4, 0x58, 0x17, 0xc0, 0x58,
+    0x3, 0xff, 0x82, 0xc2, 0x12, 0x66, 0x9, 0x0, 0xff, 0xe0, 0xd0, 0x19, 0x82, 0x40, 0x58, 0x3,
+    0xfe, 0x62, 0x9, 0x0, 0x29, 0x5, 0x80, 0x7f, 0xd4, 0x4, 0xa0, 0x15, 0x1, 0x20, 0x7, 0xf2,
+    0x18, 0x50, 0x6, 0x61, 0xf, 0x0, 0xfe, 0xf0, 0x16, 0x0, 0xc2, 0xe0, 0x86, 0x1, 0xf1, 0xa0,
+    0x38, 0x80, 0x75, 0x80, 0x24, 0x3, 0xea, 0x0, 0x69, 0x17, 0x80, 0xc1, 0x48, 0x3, 0x89, 0x80,
+    0x17, 0xbb, 0xf1, 0x80, 0x2c, 0x3, 0xa8, 0x3, 0xff, 0x84, 0xe2, 0x1, 0xb, 0x1, 0xee, 0xff,
+    0xa0, 0x5, 0x80, 0x26, 0x10, 0xa2, 0x2f, 0xf3, 0x8, 0x48, 0x5, 0x40, 0x2e, 0x1, 0xfe, 0x16,
+    0x1, 0x60, 0x52, 0x6, 0x10, 0xf, 0xfa, 0x40, 0x16, 0x12, 0x0, 0x90, 0xf, 0xfc, 0x2a, 0x4,
+    0x80,
+
+    /* U+00C3 "Ã" */
+    0x0, 0xf1, 0x56, 0x38, 0x4, 0xd0, 0x1, 0xff, 0xbd, 0x4a, 0x30, 0x86, 0xcc, 0x3, 0xfe, 0x42,
+    0x9e, 0xa2, 0xde, 0x2e, 0x0, 0xff, 0xcc, 0xe0, 0xb8, 0xcb, 0x4a, 0x1, 0xff, 0x24, 0x88, 0x0,
+    0xa6, 0x94, 0x3, 0xff, 0x86, 0x73, 0x27, 0x0, 0xff, 0xe2, 0xcb, 0x32, 0x8, 0x3, 0xff, 0x86,
+    0x4a, 0x1, 0x58, 0x7, 0xff, 0xe, 0x80, 0x6, 0xe, 0x20, 0x1f, 0xfc, 0x11, 0x60, 0x5f, 0x1,
+    0x60, 0xf, 0xfe, 0xb, 0x8, 0x49, 0x98, 0x24, 0x3, 0xff, 0x83, 0x40, 0x66, 0x9, 0x1, 0x60,
+    0xf, 0xf9, 0x88, 0x24, 0x0, 0xa4, 0x16, 0x1, 0xff, 0x50, 0x12, 0x80, 0x54, 0x4, 0x80, 0x1f,
+    0xc8, 0x61, 0x40, 0x19, 0x84, 0x3c, 0x3, 0xfb, 0xc0, 0x58, 0x3, 0xb, 0x82, 0x18, 0x7, 0xc6,
+    0x80, 0xe2, 0x1, 0xd6, 0x0, 0x90, 0xf, 0xa8, 0x1, 0xa4, 0x5e, 0x3, 0x5, 0x20, 0xe, 0x26,
+    0x0, 0x5e, 0xef, 0xc6, 0x0, 0xb0, 0xe, 0xa0, 0xf, 0xfe, 0x13, 0x88, 0x4, 0x2c, 0x7, 0xbb,
+    0xfe, 0x80, 0x16, 0x0, 0x98, 0x42, 0x88, 0xbf, 0xcc, 0x21, 0x20, 0x15, 0x0, 0xb8, 0x7, 0xf8,
+    0x58, 0x5, 0x81, 0x48, 0x18, 0x40, 0x3f, 0xe9, 0x0, 0x58, 0x48, 0x2, 0x40, 0x3f, 0xf0, 0xa8,
+    0x12, 0x0,
+
+    /* U+00C4 "Ä" */
+    0x0, 0xf1, 0x41, 0x80, 0x5, 0xd4, 0x3, 0xff, 0x83, 0xf, 0xa0, 0x6, 0x8a, 0x30, 0xf, 0xfc,
+    0x60, 0x60, 0x1, 0x0, 0x8, 0x7, 0xfe, 0x9b, 0xc0, 0x3, 0x5e, 0x90, 0x7, 0xff, 0x5, 0x4,
+    0x2, 0x42, 0x0, 0xff, 0xe1, 0x9c, 0xc9, 0xc0, 0x3f, 0xf8, 0xb2, 0xcc, 0x82, 0x0, 0xff, 0xe1,
+    0x92, 0x80, 0x56, 0x1, 0xff, 0xc3, 0xa0, 0x1, 0x83, 0x88, 0x7, 0xff, 0x4, 0x58, 0x17, 0xc0,
+    0x58, 0x3, 0xff, 0x82, 0xc2, 0x12, 0x66, 0x9, 0x0, 0xff, 0xe0, 0xd0, 0x19, 0x82, 0x40, 0x58,
+    0x3, 0xfe, 0x62, 0x9, 0x0, 0x29, 0x5, 0x80, 0x7f, 0xd4, 0x4, 0xa0, 0x15, 0x1, 0x20, 0x7,
+    0xf2, 0x18, 0x50, 0x6, 0x61, 0xf, 0x0, 0xfe, 0xf0, 0x16, 0x0, 0xc2, 0xe0, 0x86, 0x1, 0xf1,
+    0xa0, 0x38, 0x80, 0x75, 0x80, 0x24, 0x3, 0xea, 0x0, 0x69, 0x17, 0x80, 0xc1, 0x48, 0x3, 0x89,
+    0x80, 0x17, 0xbb, 0xf1, 0x80, 0x2c, 0x3, 0xa8, 0x3, 0xff, 0x84, 0xe2, 0x1, 0xb, 0x1, 0xee,
+    0xff, 0xa0, 0x5, 0x80, 0x26, 0x10, 0xa2, 0x2f, 0xf3, 0x8, 0x48, 0x5, 0x40, 0x2e, 0x1, 0xfe,
+    0x16, 0x1, 0x60, 0x52, 0x6, 0x10, 0xf, 0xfa, 0x40, 0x16, 0x12, 0x0, 0x90, 0xf, 0xfc, 0x2a,
+    0x4, 0x80,
+
+    /* U+00C5 "Å" */
+    0x0, 0xfc, 0x2a, 0xe6, 0x1, 0xff, 0xc4, 0x1c, 0x8b, 0xc7, 0x0, 0xff, 0xe1, 0xc3, 0x6e, 0x54,
+    0x10, 0x7, 0xff, 0x9, 0x70, 0x0, 0xa0, 0xc0, 0x1f, 0xfc, 0x26, 0xd0, 0x1, 0x83, 0x0, 0x7f,
+    0xf0, 0xa1, 0x2e, 0x75, 0xc8, 0x3, 0xff, 0x84, 0x59, 0x81, 0xa8, 0x0, 0xff, 0xe2, 0x13, 0xc2,
+    0x0, 0x7f, 0xf1, 0x4e, 0x64, 0xe0, 0x1f, 0xfc, 0x59, 0x66, 0x41, 0x0, 0x7f, 0xf0, 0xc9, 0x40,
+    0x2b, 0x0, 0xff, 0xe1, 0xd0, 0x0, 0xc1, 0xc4, 0x3, 0xff, 0x82, 0x2c, 0xb, 0xe0, 0x2c, 0x1,
+    0xff, 0xc1, 0x61, 0x9, 0x33, 0x4, 0x80, 0x7f, 0xf0, 0x68, 0xc, 0xc1, 0x20, 0x2c, 0x1, 0xff,
+    0x31, 0x4, 0x80, 0x14, 0x82, 0xc0, 0x3f, 0xea, 0x2, 0x50, 0xa, 0x80, 0x90, 0x3, 0xf9, 0xc,
+    0x28, 0x3, 0x30, 0x87, 0x80, 0x7f, 0x78, 0xb, 0x0, 0x61, 0x70, 0x43, 0x0, 0xf8, 0xd0, 0x1c,
+    0x40, 0x3a, 0xc0, 0x12, 0x1, 0xf5, 0x0, 0x34, 0x8b, 0xc0, 0x60, 0xa4, 0x1, 0xc4, 0xc0, 0xb,
+    0xdd, 0xf8, 0xc0, 0x16, 0x1, 0xd4, 0x1, 0xff, 0xc2, 0x71, 0x0, 0x85, 0x80, 0xf7, 0x7f, 0xd0,
+    0x2, 0xc0, 0x13, 0x8, 0x51, 0x17, 0xf9, 0x84, 0x24, 0x2, 0xa0, 0x17, 0x0, 0xff, 0xb, 0x0,
+    0xb0, 0x29, 0x3, 0x8, 0x7, 0xfd, 0x20, 0xb, 0x9, 0x0, 0x48, 0x7, 0xfe, 0x15, 0x2, 0x40,
+
+    /* U+00C6 "Æ" */
+    0x0, 0xff, 0x96, 0x67, 0xff, 0x86, 0x60, 0x1f, 0xe1, 0xb6, 0x6f, 0xfe, 0x20, 0x7, 0xfa, 0x4,
+    0x4, 0x0, 0x45, 0xff, 0x8, 0x7, 0xf1, 0xb0, 0x34, 0x80, 0x27, 0x77, 0xfc, 0x80, 0x1f, 0xde,
+    0x3, 0x0, 0x1f, 0xfc, 0xb6, 0x30, 0x81, 0x0, 0xff, 0xe5, 0xc, 0x1, 0xb0, 0x7, 0xff, 0x2e,
+    0x4, 0x3c, 0x3, 0xff, 0x96, 0x6c, 0xc, 0x60, 0x1c, 0x45, 0xfe, 0x0, 0xfd, 0xe0, 0x30, 0x1,
+    0xe9, 0xdd, 0xfe, 0x20, 0xf, 0x31, 0x84, 0x88, 0x7, 0xff, 0x28, 0x60, 0x9, 0xc0, 0x3e, 0x8b,
+    0xbf, 0xe2, 0x0, 0xe9, 0x10, 0xb2, 0x2e, 0xf0, 0x1, 0xa2, 0x7f, 0x0, 0x71, 0xb8, 0x2, 0x77,
+    0x79, 0xc0, 0x3f, 0xf8, 0xb0, 0x1, 0xff, 0xce, 0x54, 0x7, 0xee, 0xf9, 0xc0, 0x3f, 0xf8, 0x63,
+    0x0, 0x52, 0x23, 0xf7, 0x80, 0x7f, 0xf0, 0xe4, 0x82, 0x4, 0x3, 0xfd, 0xae, 0xff, 0xe5, 0x27,
+    0x4, 0x50, 0xf, 0xf9, 0xa2, 0x3f, 0xdd, 0x20, 0x8, 0x0, 0xff, 0xe6, 0x0,
+
+    /* U+00C7 "Ç" */
+    0x0, 0xf0, 0xac, 0xde, 0x5d, 0x39, 0x80, 0x7c, 0x31, 0xf4, 0xc8, 0x68, 0xb1, 0x96, 0x60, 0x18,
+    0xf1, 0xc4, 0x0, 0x6a, 0x84, 0x0, 0x4c, 0x60, 0x1, 0xe9, 0x1, 0x4f, 0x65, 0x5e, 0xe9, 0x80,
+    0x14, 0x3, 0xc2, 0xb, 0x8c, 0x20, 0x18, 0xa6, 0xd3, 0x42, 0x48, 0x12, 0x84, 0x3, 0xf2, 0x58,
+    0x89, 0x80, 0x12, 0x1, 0xff, 0xc1, 0x51, 0x6, 0x20, 0xf, 0xfe, 0xe, 0x0, 0x30, 0x3, 0xff,
+    0x84, 0x20, 0x6, 0x0, 0xff, 0xea, 0x8, 0x1, 0xc0, 0x3f, 0xf8, 0x5c, 0x0, 0x30, 0xf, 0xfe,
+    0x12, 0x0, 0x28, 0x3, 0xff, 0x84, 0x48, 0x4, 0xe0, 0x1f, 0xfc, 0x28, 0x0, 0x42, 0x80, 0x7f,
+    0xa, 0x80, 0xe, 0x0, 0x15, 0x2, 0x1, 0xe3, 0xda, 0x80, 0x3, 0xb8, 0x0, 0xff, 0x2c, 0x8a,
+    0xf7, 0x86, 0x6, 0x1, 0x45, 0x8, 0xb, 0x4d, 0xd4, 0x20, 0x1, 0xec, 0x3, 0x2f, 0x52, 0x90,
+    0x4, 0x28, 0xfb, 0x0, 0x1f, 0x2d, 0x6a, 0x17, 0xf5, 0xc1, 0x0, 0x7f, 0xca, 0x10, 0x20, 0x1f,
+    0xfc, 0x11, 0x84, 0x7a, 0x0, 0xff, 0xe0, 0x8b, 0x48, 0xa0, 0x7, 0xfe, 0x79, 0x7a, 0x13, 0x0,
+    0xff, 0xdc, 0xd0, 0xaa, 0xe0, 0xf, 0xfd, 0x3f, 0xdf, 0x44, 0x1, 0xc0,
+
+    /* U+00C8 "È" */
+    0x0, 0xa3, 0x75, 0x0, 0x1f, 0xfa, 0x14, 0x9e, 0x40, 0x3f, 0xf4, 0x58, 0xb4, 0x80, 0x7f, 0xe4,
+    0xc4, 0x57, 0x0, 0xff, 0xc5, 0x78, 0xe0, 0x1e, 0x19, 0x9f, 0xfe, 0xb, 0x80, 0x19, 0xbf, 0xf8,
+    0x36, 0x1, 0x84, 0x8b, 0xfc, 0xc0, 0x19, 0x77, 0x7f, 0xd4, 0x1, 0xff, 0xf8, 0x72, 0x2f, 0xe1,
+    0x0, 0xe3, 0xdd, 0xfe, 0x80, 0xf, 0xfe, 0x49, 0xdd, 0xff, 0x80, 0x39, 0xd1, 0x3f, 0x88, 0x3,
+    0xff, 0xf2, 0xce, 0xff, 0xf0, 0x80, 0x45, 0x11, 0xff, 0x18, 0x7, 0xff, 0x10,
+
+    /* U+00C9 "É" */
+    0x0, 0xfc, 0x35, 0xba, 0x60, 0xf, 0xf0, 0xd2, 0x9c, 0x30, 0x7, 0xf0, 0xea, 0x1e, 0x28, 0x7,
+    0xfa, 0x1, 0xb4, 0x80, 0x3f, 0xe9, 0xc9, 0x10, 0xf, 0xc, 0xcf, 0xff, 0x5, 0xc0, 0xc, 0xdf,
+    0xfc, 0x1b, 0x0, 0xc2, 0x45, 0xfe, 0x60, 0xc, 0xbb, 0xbf, 0xea, 0x0, 0xff, 0xfc, 0x39, 0x17,
+    0xf0, 0x80, 0x71, 0xee, 0xff, 0x40, 0x7, 0xff, 0x24, 0xee, 0xff, 0xc0, 0x1c, 0xe8, 0x9f, 0xc4,
+    0x1, 0xff, 0xf9, 0x67, 0x7f, 0xf8, 0x40, 0x22, 0x88, 0xff, 0x8c, 0x3, 0xff, 0x88,
+
+    /* U+00CA "Ê" */
+    0x0, 0xf5, 0x6e, 0xa0, 0x3, 0xfc, 0x36, 0xa0, 0x6f, 0x0, 0x1f, 0x86, 0x90, 0xf3, 0x49, 0xe0,
+    0x3, 0xe8, 0x76, 0xc1, 0x3f, 0x44, 0x30, 0x7, 0xa7, 0x24, 0x2, 0x2b, 0xc6, 0x0, 0x86, 0x67,
+    0xff, 0x82, 0xe0, 0x6, 0x6f, 0xfe, 0xd, 0x80, 0x61, 0x22, 0xff, 0x30, 0x6, 0x5d, 0xdf, 0xf5,
+    0x0, 0x7f, 0xfe, 0x1c, 0x8b, 0xf8, 0x40, 0x38, 0xf7, 0x7f, 0xa0, 0x3, 0xff, 0x92, 0x77, 0x7f,
+    0xe0, 0xe, 0x74, 0x4f, 0xe2, 0x0, 0xff, 0xfc, 0xb3, 0xbf, 0xfc, 0x20, 0x11, 0x44, 0x7f, 0xc6,
+    0x1, 0xff, 0xc4,
+
+    /* U+00CB "Ë" */
+    0x0, 0xc8, 0xe2, 0x0, 0x38, 0x20, 0xf, 0x86, 0xe2, 0x0, 0xe, 0x7e, 0x0, 0xfc, 0x20, 0x20,
+    0x6, 0x7, 0x0, 0xf8, 0x72, 0xe0, 0x1, 0x57, 0x40, 0x1f, 0x89, 0x0, 0x21, 0x41, 0x0, 0xc3,
+    0x33, 0xff, 0xc1, 0x70, 0x3, 0x37, 0xff, 0x6, 0xc0, 0x30, 0x91, 0x7f, 0x98, 0x3, 0x2e, 0xef,
+    0xfa, 0x80, 0x3f, 0xff, 0xe, 0x45, 0xfc, 0x20, 0x1c, 0x7b, 0xbf, 0xd0, 0x1, 0xff, 0xc9, 0x3b,
+    0xbf, 0xf0, 0x7, 0x3a, 0x27, 0xf1, 0x0, 0x7f, 0xfe, 0x59, 0xdf, 0xfe, 0x10, 0x8, 0xa2, 0x3f,
+    0xe3, 0x0, 0xff, 0xe2, 0x0,
+
+    /* U+00CC "Ì" */
+    0x4c, 0xdc, 0x20, 0x9, 0x3c, 0xf, 0xc8, 0x2, 0x3c, 0x52, 0xc3, 0x0, 0x86, 0xa0, 0xa0, 0x40,
+    0x33, 0xe5, 0x88, 0x4, 0x33, 0x27, 0x0, 0xe6, 0x66, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0x40,
+
+    /* U+00CD "Í" */
+    0x0, 0x97, 0x75, 0x42, 0x0, 0x5a, 0x27, 0xb1, 0x6, 0xa0, 0x8a, 0x10, 0x4a, 0x3b, 0x70, 0x9,
+    0x33, 0x8, 0x1, 0x86, 0x64, 0xe0, 0x1c, 0xcc, 0xc0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xf4,
+
+    /* U+00CE "Î" */
+    0x0, 0x97, 0x75, 0x84, 0x1, 0xcb, 0x44, 0x7, 0xe4, 0x1, 0x2d, 0x5, 0x6b, 0x17, 0x90, 0x1c,
+    0x9e, 0x28, 0x4c, 0xc, 0x9, 0xe6, 0xc, 0x2, 0x7c, 0xa1, 0x0, 0x86, 0x64, 0xe0, 0x1f, 0x99,
+    0x98, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xfa, 0x0,
+
+    /* U+00CF "Ï" */
+    0x17, 0x40, 0x9, 0x98, 0x11, 0xb, 0x10, 0x69, 0x92, 0x8, 0x8, 0x0, 0x80, 0xf, 0x17, 0x82,
+    0x9, 0x98, 0x30, 0x42, 0x0, 0x8c, 0xc0, 0x10, 0xcc, 0x9c, 0x3, 0xcc, 0xcc, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xf8, 0x60,
+
+    /* U+00D0 "Ð" */
+    0x0, 0xa2, 0x67, 0xf4, 0x31, 0x80, 0x7f, 0x95, 0x9b, 0xf3, 0xce, 0x74, 0x8, 0x7, 0xf8, 0x8b,
+    0xc2, 0x0, 0x17, 0xf5, 0x0, 0xfc, 0x3b, 0xbe, 0xee, 0x49, 0x80, 0xd3, 0x0, 0x7f, 0xf0, 0xc5,
+    0xb2, 0x0, 0x12, 0x80, 0x1f, 0xfc, 0x57, 0x90, 0x4, 0x80, 0x7f, 0xf1, 0x99, 0x0, 0x94, 0x3,
+    0xff, 0x8d, 0xe0, 0xf, 0x11, 0x8c, 0x4, 0x7e, 0x0, 0xf2, 0x8, 0x3d, 0xf7, 0x4, 0x1, 0xdd,
+    0xd2, 0x1, 0xf1, 0x81, 0x80, 0x7f, 0xf1, 0xc4, 0x6, 0xf7, 0x42, 0x0, 0xdd, 0xe9, 0x0, 0xf8,
+    0x80, 0x44, 0x44, 0x30, 0x12, 0x2e, 0x10, 0xf, 0x10, 0x82, 0x80, 0x7f, 0xf1, 0xa8, 0x1, 0x80,
+    0x1f, 0xfc, 0x52, 0x60, 0x3, 0x0, 0x7f, 0xf1, 0xb, 0xc4, 0x1c, 0x40, 0x3f, 0xf8, 0x42, 0xd8,
+    0x40, 0x70, 0x1, 0xe1, 0x77, 0xf4, 0x57, 0xc8, 0x82, 0x68, 0x7, 0xe8, 0x8f, 0x3a, 0x88, 0xc,
+    0xd8, 0x80, 0x7f, 0xf0, 0x84, 0xda, 0xb9, 0x80, 0x30,
+
+    /* U+00D1 "Ñ" */
+    0x0, 0xe2, 0xac, 0x81, 0x0, 0x2c, 0x80, 0x7f, 0x72, 0x93, 0xe1, 0x8c, 0xa0, 0x7, 0xe3, 0x33,
+    0xf5, 0x9e, 0x71, 0xd8, 0x7, 0xf3, 0x50, 0x27, 0xba, 0xcb, 0x0, 0x7e, 0x39, 0x20, 0x0, 0xc5,
+    0x30, 0x7, 0xc, 0xc9, 0x0, 0x3f, 0xe9, 0x93, 0x83, 0x32, 0x8c, 0x3, 0xfc, 0xcc, 0xb0, 0x8,
+    0x78, 0x40, 0x3f, 0xf8, 0x85, 0x40, 0x1f, 0xfc, 0x54, 0x80, 0xf, 0xfe, 0x11, 0x8, 0x3a, 0x80,
+    0x7f, 0xf0, 0x5a, 0xc0, 0x16, 0x60, 0x1f, 0xfc, 0x15, 0x70, 0x1e, 0x10, 0xf, 0xfe, 0xc, 0x20,
+    0x15, 0x0, 0x7f, 0xf0, 0xa8, 0x81, 0x20, 0x3, 0xff, 0x82, 0x3c, 0x20, 0xea, 0x1, 0xff, 0xc1,
+    0x3b, 0x0, 0x59, 0x80, 0x7f, 0xf0, 0x55, 0xc0, 0x78, 0x40, 0x3f, 0xf8, 0x30, 0x80, 0x54, 0x1,
+    0xff, 0xc2, 0xa2, 0x4, 0x90, 0xf, 0xfe, 0x8, 0xf0, 0x83, 0x0, 0x7f, 0xf0, 0x8e, 0xc0, 0x3f,
+    0xf8, 0xaa, 0xe0, 0x1f, 0xfc, 0x58, 0x50, 0xf, 0xfe, 0x2d, 0x90, 0x0,
+
+    /* U+00D2 "Ò" */
+    0x0, 0xe1, 0x9d, 0xd3, 0x0, 0x7f, 0xf1, 0x46, 0x50, 0xa5, 0xc0, 0x3f, 0xf8, 0xd3, 0x43, 0x10,
+    0x0, 0xff, 0xe3, 0x2e, 0xa2, 0x18, 0x3, 0xff, 0x8c, 0x77, 0x8c, 0x1, 0xff, 0xc3, 0x15, 0x9b,
+    0xcc, 0x53, 0x98, 0x7, 0xfc, 0x31, 0xf4, 0xc8, 0x66, 0x58, 0xcc, 0x20, 0x7, 0xe3, 0xc7, 0x10,
+    0x1, 0xaa, 0x10, 0x0, 0xee, 0x40, 0x3c, 0x7a, 0x40, 0x53, 0xf9, 0x57, 0xba, 0x60, 0x3, 0x50,
+    0x6, 0x1e, 0x10, 0x5c, 0x60, 0xe, 0x29, 0xb1, 0x5, 0x60, 0x9, 0x88, 0x12, 0x84, 0x3, 0xf2,
+    0x50, 0x2, 0x4, 0x6, 0x40, 0x12, 0x1, 0xff, 0x23, 0x80, 0xb0, 0x28, 0x83, 0x10, 0x7, 0xfe,
+    0xa0, 0x5, 0x86, 0x0, 0x30, 0x3, 0xff, 0x82, 0x46, 0x6, 0x22, 0x0, 0x30, 0x7, 0xff, 0x9,
+    0x80, 0x6, 0x1, 0xff, 0xca, 0x10, 0x3, 0x80, 0x7f, 0xf0, 0x84, 0x0, 0x7c, 0x0, 0x30, 0xf,
+    0xfe, 0x12, 0x80, 0x89, 0x0, 0x14, 0x1, 0xff, 0xc1, 0x51, 0x4, 0x2, 0x50, 0x27, 0x0, 0xff,
+    0x86, 0x0, 0x12, 0x0, 0x90, 0x4, 0x28, 0x7, 0xfa, 0x88, 0x10, 0xc0, 0x7, 0x0, 0xa, 0x81,
+    0x0, 0xf1, 0xe2, 0x0, 0xd0, 0x6, 0x78, 0x0, 0x3f, 0xcb, 0x22, 0xbd, 0xe1, 0x81, 0x60, 0x80,
+    0x73, 0xd9, 0x0, 0xb4, 0xdd, 0x42, 0x0, 0x17, 0x8, 0x3, 0xe4, 0xda, 0x52, 0x0, 0x85, 0x1f,
+    0x68, 0x40, 0x3f, 0xcb, 0x5b, 0xfd, 0xfd, 0x70, 0x40, 0x1e,
+
+    /* U+00D3 "Ó" */
+    0x0, 0xff, 0x86, 0xf7, 0x14, 0x3, 0xff, 0x88, 0x3a, 0x87, 0xa, 0x1, 0xff, 0xc3, 0x2c, 0x33,
+    0x62, 0x0, 0x7f, 0xf0, 0xc6, 0x5, 0xf0, 0x80, 0x3f, 0xf8, 0x83, 0x59, 0x0, 0x1f, 0xfc, 0x41,
+    0x59, 0xbc, 0xc5, 0x39, 0x80, 0x7f, 0xc3, 0x1f, 0x4c, 0x86, 0x65, 0x8c, 0xc2, 0x0, 0x7e, 0x3c,
+    0x71, 0x0, 0x1a, 0xa1, 0x0, 0xe, 0xe4, 0x3, 0xc7, 0xa4, 0x5, 0x3f, 0x95, 0x7b, 0xa6, 0x0,
+    0x35, 0x0, 0x61, 0xe1, 0x5, 0xc6, 0x0, 0xe2, 0x9b, 0x10, 0x56, 0x0, 0x98, 0x81, 0x28, 0x40,
+    0x3f, 0x25, 0x0, 0x20, 0x40, 0x64, 0x1, 0x20, 0x1f, 0xf2, 0x38, 0xb, 0x2, 0x88, 0x31, 0x0,
+    0x7f, 0xea, 0x0, 0x58, 0x60, 0x3, 0x0, 0x3f, 0xf8, 0x24, 0x60, 0x62, 0x20, 0x3, 0x0, 0x7f,
+    0xf0, 0x98, 0x0, 0x60, 0x1f, 0xfc, 0xa1, 0x0, 0x38, 0x7, 0xff, 0x8, 0x40, 0x7, 0xc0, 0x3,
+    0x0, 0xff, 0xe1, 0x28, 0x8, 0x90, 0x1, 0x40, 0x1f, 0xfc, 0x15, 0x10, 0x40, 0x25, 0x2, 0x70,
+    0xf, 0xf8, 0x60, 0x1, 0x20, 0x9, 0x0, 0x42, 0x80, 0x7f, 0xa8, 0x81, 0xc, 0x0, 0x70, 0x0,
+    0xa8, 0x10, 0xf, 0x1e, 0x20, 0xd, 0x0, 0x67, 0x80, 0x3, 0xfc, 0xb2, 0x2b, 0xde, 0x18, 0x16,
+    0x8, 0x7, 0x3d, 0x90, 0xb, 0x4d, 0xd4, 0x20, 0x1, 0x70, 0x80, 0x3e, 0x4d, 0xa5, 0x20, 0x8,
+    0x51, 0xf6, 0x84, 0x3, 0xfc, 0xb5, 0xbf, 0xdf, 0xd7, 0x4, 0x1, 0xe0,
+
+    /* U+00D4 "Ô" */
+    0x0, 0xfc, 0x37, 0xba, 0x60, 0xf, 0xfe, 0x20, 0xea, 0x1, 0x4b, 0x80, 0x7f, 0xf0, 0x87, 0x4d,
+    0x32, 0xc6, 0x1c, 0x3, 0xff, 0x83, 0x0, 0xf6, 0x29, 0x89, 0x6a, 0x1, 0xff, 0xa7, 0x20, 0x2,
+    0x2b, 0xc5, 0x0, 0xff, 0xc2, 0xb3, 0x79, 0x8a, 0x73, 0x0, 0xff, 0x86, 0x3e, 0x99, 0xc, 0xcb,
+    0x19, 0x84, 0x0, 0xfc, 0x78, 0xe2, 0x0, 0x35, 0x42, 0x0, 0x1d, 0xc8, 0x7, 0x8f, 0x48, 0xa,
+    0x7f, 0x2a, 0xf7, 0x4c, 0x0, 0x6a, 0x0, 0xc3, 0xc2, 0xb, 0x8c, 0x1, 0xc5, 0x36, 0x20, 0xac,
+    0x1, 0x31, 0x2, 0x50, 0x80, 0x7e, 0x4a, 0x0, 0x40, 0x80, 0xc8, 0x2, 0x40, 0x3f, 0xe4, 0x70,
+    0x16, 0x5, 0x10, 0x62, 0x0, 0xff, 0xd4, 0x0, 0xb0, 0xc0, 0x6, 0x0, 0x7f, 0xf0, 0x48, 0xc0,
+    0xc4, 0x40, 0x6, 0x0, 0xff, 0xe1, 0x30, 0x0, 0xc0, 0x3f, 0xf9, 0x42, 0x0, 0x70, 0xf, 0xfe,
+    0x10, 0x80, 0xf, 0x80, 0x6, 0x1, 0xff, 0xc2, 0x50, 0x11, 0x20, 0x2, 0x80, 0x3f, 0xf8, 0x2a,
+    0x20, 0x80, 0x4a, 0x4, 0xe0, 0x1f, 0xf0, 0xc0, 0x2, 0x40, 0x12, 0x0, 0x85, 0x0, 0xff, 0x51,
+    0x2, 0x18, 0x0, 0xe0, 0x1, 0x50, 0x20, 0x1e, 0x3c, 0x40, 0x1a, 0x0, 0xcf, 0x0, 0x7, 0xf9,
+    0x64, 0x57, 0xbc, 0x30, 0x2c, 0x10, 0xe, 0x7b, 0x20, 0x16, 0x9b, 0xa8, 0x40, 0x2, 0xe1, 0x0,
+    0x7c, 0x9b, 0x4a, 0x40, 0x10, 0xa3, 0xed, 0x8, 0x7, 0xf9, 0x6b, 0x7f, 0xbf, 0xae, 0x8, 0x3,
+    0xc0,
+
+    /* U+00D5 "Õ" */
+    0x0, 0xf9, 0xb2, 0xcc, 0x0, 0x32, 0x80, 0x1f, 0xf9, 0x64, 0x97, 0x1c, 0x1d, 0x80, 0x3f, 0xf8,
+    0x3c, 0x5f, 0xe5, 0x8f, 0x92, 0x40, 0xf, 0xfc, 0x76, 0x22, 0xaa, 0x2b, 0x78, 0x7, 0xff, 0x6,
+    0x18, 0x2, 0x5a, 0x92, 0x0, 0xff, 0xe0, 0x8a, 0xcd, 0xe6, 0x29, 0xcc, 0x3, 0xfe, 0x18, 0xfa,
+    0x64, 0x33, 0x2c, 0x66, 0x10, 0x3, 0xf1, 0xe3, 0x88, 0x0, 0xd5, 0x8, 0x0, 0x77, 0x20, 0x1e,
+    0x3d, 0x20, 0x29, 0xfc, 0xab, 0xdd, 0x30, 0x1, 0xa8, 0x3, 0xf, 0x8, 0x2e, 0x30, 0x7, 0x14,
+    0xd8, 0x82, 0xb0, 0x4, 0xc4, 0x9, 0x42, 0x1, 0xf9, 0x28, 0x1, 0x2, 0x3, 0x20, 0x9, 0x0,
+    0xff, 0x91, 0xc0, 0x58, 0x14, 0x41, 0x88, 0x3, 0xff, 0x50, 0x2, 0xc3, 0x0, 0x18, 0x1, 0xff,
+    0xc1, 0x23, 0x3, 0x11, 0x0, 0x18, 0x3, 0xff, 0x84, 0xc0, 0x3, 0x0, 0xff, 0xe5, 0x8, 0x1,
+    0xc0, 0x3f, 0xf8, 0x42, 0x0, 0x3e, 0x0, 0x18, 0x7, 0xff, 0x9, 0x40, 0x44, 0x80, 0xa, 0x0,
+    0xff, 0xe0, 0xa8, 0x82, 0x1, 0x28, 0x13, 0x80, 0x7f, 0xc3, 0x0, 0x9, 0x0, 0x48, 0x2, 0x14,
+    0x3, 0xfd, 0x44, 0x8, 0x60, 0x3, 0x80, 0x5, 0x40, 0x80, 0x78, 0xf1, 0x0, 0x68, 0x3, 0x3c,
+    0x0, 0x1f, 0xe5, 0x91, 0x5e, 0xf0, 0xc0, 0xb0, 0x40, 0x39, 0xec, 0x80, 0x5a, 0x6e, 0xa1, 0x0,
+    0xb, 0x84, 0x1, 0xf2, 0x6d, 0x29, 0x0, 0x42, 0x8f, 0xb4, 0x20, 0x1f, 0xe5, 0xad, 0xfe, 0xfe,
+    0xb8, 0x20, 0xf,
+
+    /* U+00D6 "Ö" */
+    0x0, 0xf9, 0x5c, 0x40, 0x7, 0x4, 0x1, 0xff, 0xc1, 0x2a, 0x89, 0x0, 0x6b, 0xc8, 0x7, 0xff,
+    0x4, 0xc4, 0x38, 0x0, 0x60, 0x20, 0x1f, 0xfc, 0x11, 0xcb, 0x60, 0x6, 0x5d, 0x0, 0x7f, 0xf0,
+    0x89, 0x0, 0x21, 0x40, 0xf, 0xfe, 0x10, 0xac, 0xde, 0x62, 0x9c, 0xc0, 0x3f, 0xe1, 0x8f, 0xa6,
+    0x43, 0x32, 0xc6, 0x61, 0x0, 0x3f, 0x1e, 0x38, 0x80, 0xd, 0x50, 0x80, 0x7, 0x72, 0x1, 0xe3,
+    0xd2, 0x2, 0x9f, 0xca, 0xbd, 0xd3, 0x0, 0x1a, 0x80, 0x30, 0xf0, 0x82, 0xe3, 0x0, 0x71, 0x4d,
+    0x88, 0x2b, 0x0, 0x4c, 0x40, 0x94, 0x20, 0x1f, 0x92, 0x80, 0x10, 0x20, 0x32, 0x0, 0x90, 0xf,
+    0xf9, 0x1c, 0x5, 0x81, 0x44, 0x18, 0x80, 0x3f, 0xf5, 0x0, 0x2c, 0x30, 0x1, 0x80, 0x1f, 0xfc,
+    0x12, 0x30, 0x31, 0x10, 0x1, 0x80, 0x3f, 0xf8, 0x4c, 0x0, 0x30, 0xf, 0xfe, 0x50, 0x80, 0x1c,
+    0x3, 0xff, 0x84, 0x20, 0x3, 0xe0, 0x1, 0x80, 0x7f, 0xf0, 0x94, 0x4, 0x48, 0x0, 0xa0, 0xf,
+    0xfe, 0xa, 0x88, 0x20, 0x12, 0x81, 0x38, 0x7, 0xfc, 0x30, 0x0, 0x90, 0x4, 0x80, 0x21, 0x40,
+    0x3f, 0xd4, 0x40, 0x86, 0x0, 0x38, 0x0, 0x54, 0x8, 0x7, 0x8f, 0x10, 0x6, 0x80, 0x33, 0xc0,
+    0x1, 0xfe, 0x59, 0x15, 0xef, 0xc, 0xb, 0x4, 0x3, 0x9e, 0xc8, 0x5, 0xa6, 0xea, 0x10, 0x0,
+    0xb8, 0x40, 0x1f, 0x26, 0xd2, 0x90, 0x4, 0x28, 0xfb, 0x42, 0x1, 0xfe, 0x5a, 0xdf, 0xef, 0xeb,
+    0x82, 0x0, 0xf0,
+
+    /* U+00D7 "×" */
+    0x2c, 0x20, 0xe, 0xb5, 0x9, 0x3f, 0x20, 0xa, 0xd2, 0x8a, 0x44, 0xbc, 0x82, 0xd0, 0x24, 0x89,
+    0x82, 0x5f, 0x68, 0x12, 0xc0, 0x2, 0xd1, 0x24, 0x9, 0x60, 0xc, 0x6a, 0x0, 0x14, 0x0, 0xea,
+    0x40, 0x11, 0x79, 0x0, 0x54, 0xa1, 0x3a, 0x25, 0xe4, 0x14, 0xa1, 0x2c, 0x7a, 0x25, 0xe3, 0x81,
+    0xc, 0x0, 0x3d, 0x17, 0x16, 0xc7, 0x0, 0xc7, 0xb4, 0x0,
+
+    /* U+00D8 "Ø" */
+    0x0, 0xff, 0xe2, 0x8c, 0x40, 0x40, 0x3f, 0xf8, 0xd6, 0xe0, 0x20, 0x1f, 0xa, 0xcd, 0xe6, 0x29,
+    0xcc, 0x15, 0x47, 0x0, 0x1e, 0x18, 0xfa, 0x64, 0x33, 0x2c, 0x67, 0x50, 0xf0, 0x7, 0x8f, 0x1c,
+    0x40, 0x6, 0xa8, 0x40, 0x1, 0x0, 0x10, 0x7, 0x1e, 0x90, 0x14, 0xfe, 0x55, 0xee, 0x80, 0x21,
+    0xa0, 0xc, 0x3c, 0x20, 0xb8, 0xc0, 0x1c, 0xc0, 0x19, 0x58, 0x2, 0x62, 0x4, 0xa1, 0x0, 0xe1,
+    0x90, 0xcb, 0x0, 0x40, 0x80, 0xc8, 0x2, 0x40, 0x3e, 0xb2, 0x83, 0x47, 0x1, 0x60, 0x51, 0x6,
+    0x20, 0xf, 0x32, 0xa3, 0x80, 0x28, 0x1, 0x61, 0x80, 0xc, 0x0, 0xf1, 0xc0, 0xc8, 0x4, 0x46,
+    0x6, 0x22, 0x0, 0x30, 0x7, 0xf, 0x8d, 0x90, 0x6, 0x60, 0x1, 0x80, 0x7f, 0x41, 0xb2, 0x80,
+    0x7f, 0x8, 0x1, 0xc0, 0x32, 0xb1, 0x40, 0x7, 0x84, 0x0, 0x7c, 0x0, 0x30, 0x8, 0xac, 0x38,
+    0x40, 0x3c, 0xa0, 0x22, 0x40, 0x5, 0x0, 0x52, 0x30, 0x60, 0x1e, 0x51, 0x4, 0x2, 0x50, 0x27,
+    0x7, 0x44, 0x38, 0x7, 0x86, 0x0, 0x12, 0x0, 0x90, 0x4, 0x44, 0x34, 0x1, 0xf5, 0x10, 0x21,
+    0x80, 0xe, 0x0, 0xe, 0x16, 0x20, 0x1c, 0x78, 0x80, 0x34, 0x1, 0x9e, 0x0, 0x2b, 0x96, 0x45,
+    0x7b, 0xc3, 0x2, 0xc1, 0x0, 0xe2, 0x0, 0x85, 0xa6, 0xea, 0x10, 0x0, 0xb8, 0x40, 0x1c, 0x56,
+    0x39, 0x4a, 0x40, 0x10, 0xa3, 0xed, 0x8, 0x7, 0xb8, 0x60, 0xd6, 0xb7, 0xfb, 0xfa, 0xe0, 0x80,
+    0x3e, 0x50, 0x66, 0x0, 0x70, 0x80, 0x7f, 0xc0,
+
+    /* U+00D9 "Ù" */
+    0x0, 0xcd, 0xba, 0xa0, 0xf, 0xfe, 0x13, 0x41, 0xad, 0x88, 0x7, 0xff, 0x5, 0x74, 0x92, 0x84,
+    0x3, 0xff, 0x82, 0x78, 0xcf, 0x0, 0x1f, 0xfc, 0x21, 0x9c, 0x90, 0xf, 0x8a, 0x64, 0xa0, 0x1f,
+    0xe3, 0x99, 0x18, 0xb3, 0x30, 0x3, 0xfc, 0xac, 0xd0, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1,
+    0xff, 0xd2, 0x10, 0x1, 0x80, 0x7f, 0x84, 0x0, 0x26, 0x0, 0x60, 0xf, 0xf7, 0x0, 0x1c, 0x48,
+    0xc, 0x40, 0x3f, 0x90, 0x4, 0xc1, 0x40, 0x12, 0x1, 0xf9, 0x48, 0x10, 0x1, 0x40, 0x7, 0x60,
+    0xf, 0x25, 0x80, 0x24, 0x0, 0x52, 0x0, 0x9c, 0x75, 0x53, 0x5d, 0x84, 0x1c, 0xc0, 0x26, 0x91,
+    0x3, 0x8a, 0xa4, 0xa0, 0x2, 0x20, 0x1, 0xcd, 0xf0, 0x82, 0x0, 0x13, 0x7d, 0x70, 0x8,
+
+    /* U+00DA "Ú" */
+    0x0, 0xff, 0x46, 0xea, 0x0, 0x3f, 0xf8, 0x32, 0xe5, 0x50, 0x1, 0xff, 0xa9, 0x86, 0xdc, 0x3,
+    0xff, 0x3b, 0x26, 0x20, 0x7, 0xff, 0x5, 0xf2, 0xc8, 0x3, 0xe2, 0x99, 0x28, 0x7, 0xf8, 0xe6,
+    0x46, 0x2c, 0xcc, 0x0, 0xff, 0x2b, 0x34, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xf4,
+    0x84, 0x0, 0x60, 0x1f, 0xe1, 0x0, 0x9, 0x80, 0x18, 0x3, 0xfd, 0xc0, 0x7, 0x12, 0x3, 0x10,
+    0xf, 0xe4, 0x1, 0x30, 0x50, 0x4, 0x80, 0x7e, 0x52, 0x4, 0x0, 0x50, 0x1, 0xd8, 0x3, 0xc9,
+    0x60, 0x9, 0x0, 0x14, 0x80, 0x27, 0x1d, 0x54, 0xd7, 0x61, 0x7, 0x30, 0x9, 0xa4, 0x40, 0xe2,
+    0xa9, 0x28, 0x0, 0x88, 0x0, 0x73, 0x7c, 0x20, 0x80, 0x4, 0xdf, 0x5c, 0x2,
+
+    /* U+00DB "Û" */
+    0x0, 0xfa, 0x37, 0x54, 0x1, 0xff, 0xc1, 0x87, 0x30, 0x5b, 0x0, 0xff, 0xa5, 0xcb, 0x7c, 0xd2,
+    0xc4, 0x3, 0xf3, 0x2a, 0x61, 0x96, 0xb3, 0xc8, 0x7, 0xe6, 0xcb, 0x10, 0x0, 0xce, 0x40, 0x6,
+    0x29, 0x92, 0x80, 0x7f, 0x8e, 0x64, 0x62, 0xcc, 0xc0, 0xf, 0xf2, 0xb3, 0x40, 0x1f, 0xff, 0xf0,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0x48, 0x40, 0x6, 0x1, 0xfe, 0x10, 0x0, 0x98, 0x1, 0x80, 0x3f,
+    0xdc, 0x0, 0x71, 0x20, 0x31, 0x0, 0xfe, 0x40, 0x13, 0x5, 0x0, 0x48, 0x7, 0xe5, 0x20, 0x40,
+    0x5, 0x0, 0x1d, 0x80, 0x3c, 0x96, 0x0, 0x90, 0x1, 0x48, 0x2, 0x71, 0xd5, 0x4d, 0x76, 0x10,
+    0x73, 0x0, 0x9a, 0x44, 0xe, 0x2a, 0x92, 0x80, 0x8, 0x80, 0x7, 0x37, 0xc2, 0x8, 0x0, 0x4d,
+    0xf5, 0xc0, 0x20,
+
+    /* U+00DC "Ü" */
+    0x0, 0xe3, 0x82, 0x0, 0xb, 0xa0, 0x7, 0xfb, 0x9f, 0x80, 0x11, 0xb, 0x10, 0xf, 0xe6, 0x7,
+    0x0, 0x8, 0x8, 0x80, 0x3f, 0xaa, 0xe8, 0x1, 0x17, 0xe0, 0x1f, 0xe1, 0x41, 0x0, 0x90, 0x40,
+    0x38, 0xa6, 0x4a, 0x1, 0xfe, 0x39, 0x91, 0x8b, 0x33, 0x0, 0x3f, 0xca, 0xcd, 0x0, 0x7f, 0xff,
+    0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xfd, 0x21, 0x0, 0x18, 0x7, 0xf8, 0x40, 0x2, 0x60, 0x6, 0x0,
+    0xff, 0x70, 0x1, 0xc4, 0x80, 0xc4, 0x3, 0xf9, 0x0, 0x4c, 0x14, 0x1, 0x20, 0x1f, 0x94, 0x81,
+    0x0, 0x14, 0x0, 0x76, 0x0, 0xf2, 0x58, 0x2, 0x40, 0x5, 0x20, 0x9, 0xc7, 0x55, 0x35, 0xd8,
+    0x41, 0xcc, 0x2, 0x69, 0x10, 0x38, 0xaa, 0x4a, 0x0, 0x22, 0x0, 0x1c, 0xdf, 0x8, 0x20, 0x1,
+    0x37, 0xd7, 0x0, 0x80,
+
+    /* U+00DD "Ý" */
+    0x0, 0xff, 0x46, 0xea, 0x0, 0x3f, 0xf8, 0x52, 0xe5, 0x50, 0x1, 0xff, 0xc1, 0xa6, 0x1b, 0x70,
+    0xf, 0xfe, 0xb, 0xb2, 0x62, 0x0, 0x7f, 0xf0, 0x9f, 0x2c, 0x80, 0x3f, 0x44, 0xc8, 0x40, 0x3f,
+    0xe7, 0x99, 0xf, 0xb3, 0x24, 0x3, 0xfc, 0x70, 0xc2, 0x27, 0x30, 0x73, 0x0, 0xfe, 0xf0, 0x29,
+    0x0, 0x78, 0x2, 0x0, 0x3f, 0x39, 0x84, 0x8, 0x0, 0xd8, 0x11, 0x80, 0x3c, 0x32, 0x8, 0xa0,
+    0x1a, 0x4, 0x20, 0x40, 0x3a, 0xc4, 0x24, 0x3, 0x86, 0x0, 0x60, 0x3, 0x22, 0x83, 0x90, 0x7,
+    0x98, 0xc1, 0x8c, 0x2, 0x90, 0x29, 0x0, 0xfd, 0xe0, 0xf, 0x0, 0x39, 0x4, 0x8, 0x7, 0xe3,
+    0x70, 0x36, 0x29, 0x4, 0x50, 0xf, 0xf4, 0x90, 0x44, 0x88, 0xa4, 0x3, 0xfe, 0x18, 0x1, 0x40,
+    0x92, 0x0, 0xff, 0xca, 0x80, 0x2, 0x70, 0xf, 0xfe, 0x17, 0x0, 0x28, 0x3, 0xff, 0xfe, 0x1,
+    0xff, 0xe3,
+
+    /* U+00DE "Þ" */
+    0x19, 0x93, 0x80, 0x7f, 0xf0, 0x99, 0x98, 0x1, 0xff, 0xc4, 0x73, 0x3e, 0x21, 0x0, 0xfe, 0x3c,
+    0xce, 0xde, 0xd8, 0x20, 0xf, 0xfe, 0x11, 0x3e, 0x30, 0x7, 0x1d, 0xdf, 0x54, 0x18, 0xc, 0xb0,
+    0x6, 0x74, 0x4e, 0x57, 0xc9, 0x0, 0x40, 0x80, 0x7f, 0xe6, 0x60, 0xb, 0x80, 0x7f, 0xf0, 0x68,
+    0x1, 0x80, 0x1f, 0xfc, 0x12, 0x0, 0x8, 0x7, 0xff, 0x4, 0xc0, 0x2, 0x1, 0xff, 0xc1, 0x40,
+    0x1, 0x0, 0x7f, 0xe2, 0x80, 0x5, 0x80, 0x7f, 0x89, 0xf0, 0x41, 0x8c, 0x2, 0x4e, 0xee, 0xfd,
+    0x81, 0x5, 0x90, 0xe, 0x11, 0xe0, 0x8, 0xa6, 0x80, 0x38, 0x9d, 0xf4, 0x42, 0xb7, 0x4c, 0x1,
+    0xe6, 0x88, 0xce, 0xe5, 0x20, 0xf, 0xfe, 0xd8,
+
+    /* U+00DF "ß" */
+    0x0, 0xcb, 0x59, 0xdb, 0x6c, 0x20, 0x1e, 0x2c, 0xa5, 0x31, 0x24, 0x9c, 0x30, 0xc, 0x38, 0x60,
+    0x4f, 0x30, 0x60, 0x5a, 0x40, 0x15, 0x88, 0x3e, 0xc3, 0x3e, 0x48, 0xd, 0x80, 0x5, 0x40, 0xe0,
+    0x3, 0x98, 0xc1, 0xc0, 0xa, 0x0, 0xa0, 0xf, 0x94, 0x4, 0x40, 0x40, 0x2, 0x0, 0xf8, 0xc0,
+    0x44, 0x2, 0x1, 0xfc, 0x28, 0x8, 0x1, 0xff, 0x16, 0x88, 0x48, 0x7, 0xf4, 0x5e, 0x98, 0xd1,
+    0x80, 0x7e, 0x17, 0x40, 0xb, 0x44, 0x3, 0xf0, 0xa1, 0x90, 0xb, 0xe1, 0x80, 0x7e, 0xbc, 0xde,
+    0x70, 0x2e, 0x10, 0xf, 0xf0, 0xc4, 0x0, 0x9c, 0x3, 0xff, 0x30, 0x3, 0x0, 0x3f, 0xf0, 0x80,
+    0x7f, 0xf0, 0xcc, 0x0, 0x60, 0x1f, 0xfa, 0x0, 0x1a, 0x1, 0xe6, 0x43, 0x46, 0xc4, 0x4, 0x40,
+    0x7, 0xa6, 0xf2, 0xe4, 0xc0, 0xe8, 0x3, 0xc4, 0x62, 0x2, 0x49, 0x38, 0x20,
+
+    /* U+00E0 "à" */
+    0x0, 0x2d, 0x51, 0xc0, 0x3f, 0xca, 0x4b, 0x12, 0x1, 0xfe, 0x8b, 0x16, 0xa0, 0xf, 0xf2, 0x61,
+    0xad, 0x0, 0x7f, 0x8b, 0x3e, 0x80, 0x3f, 0xf9, 0x22, 0xf5, 0xbd, 0xcd, 0x93, 0x0, 0xd1, 0xd0,
+    0xa4, 0x22, 0x26, 0xc8, 0x0, 0x94, 0x5, 0x62, 0x64, 0xa0, 0x7, 0x60, 0x4, 0x3f, 0xd3, 0xb3,
+    0x2a, 0xc0, 0x16, 0x0, 0x58, 0x10, 0xe, 0x46, 0x2, 0x20, 0x7, 0xfb, 0xc0, 0xc, 0x1, 0x13,
+    0x3c, 0x46, 0xd0, 0x0, 0x81, 0x5e, 0xcc, 0x3b, 0xe4, 0x0, 0x87, 0xd0, 0x12, 0x26, 0x73, 0x0,
+    0x4e, 0x41, 0x16, 0xec, 0xdb, 0xc0, 0x2e, 0x0, 0x28, 0x7, 0x84, 0x3, 0xcc, 0x1, 0xc5, 0x20,
+    0x15, 0x80, 0x25, 0x0, 0x2, 0xd8, 0x20, 0x11, 0xb8, 0x15, 0xff, 0x72, 0x45, 0x80, 0x34, 0x5a,
+    0x90, 0x0, 0x97, 0x34, 0x2,
+
+    /* U+00E1 "á" */
+    0x0, 0xfc, 0xb5, 0x48, 0x0, 0xfe, 0x5a, 0x51, 0x90, 0xf, 0xcd, 0x40, 0xf6, 0x20, 0x1f, 0x34,
+    0x8d, 0xc0, 0x7, 0xf3, 0x7f, 0x20, 0x7, 0xff, 0x24, 0x5e, 0xb7, 0xb9, 0xb2, 0x60, 0x1a, 0x3a,
+    0x14, 0x84, 0x44, 0xd9, 0x0, 0x12, 0x80, 0xac, 0x4c, 0x94, 0x0, 0xec, 0x0, 0x87, 0xfa, 0x76,
+    0x65, 0x58, 0x2, 0xc0, 0xb, 0x2, 0x1, 0xc8, 0xc0, 0x44, 0x0, 0xff, 0x78, 0x1, 0x80, 0x22,
+    0x67, 0x88, 0xda, 0x0, 0x10, 0x2b, 0xd9, 0x87, 0x7c, 0x80, 0x10, 0xfa, 0x2, 0x44, 0xce, 0x60,
+    0x9, 0xc8, 0x22, 0xdd, 0x9b, 0x78, 0x5, 0xc0, 0x5, 0x0, 0xf0, 0x80, 0x79, 0x80, 0x38, 0xa4,
+    0x2, 0xb0, 0x4, 0xa0, 0x0, 0x5b, 0x4, 0x2, 0x37, 0x2, 0xbf, 0xee, 0x48, 0xb0, 0x6, 0x8b,
+    0x52, 0x0, 0x12, 0xe6, 0x80, 0x40,
+
+    /* U+00E2 "â" */
+    0x0, 0xe4, 0xaa, 0x38, 0x7, 0xf2, 0xda, 0xaa, 0x24, 0x3, 0xe5, 0xa0, 0x9c, 0x26, 0x90, 0xe,
+    0x5a, 0x1b, 0x63, 0xc3, 0x69, 0x0, 0xcb, 0xfc, 0x80, 0x1, 0xcf, 0x90, 0xf, 0xfe, 0x30, 0xbd,
+    0x6f, 0x73, 0x64, 0xc0, 0x34, 0x74, 0x29, 0x8, 0x89, 0xb2, 0x0, 0x25, 0x1, 0x58, 0x99, 0x28,
+    0x1, 0xd8, 0x1, 0xf, 0xf4, 0xec, 0xca, 0xb0, 0x5, 0x80, 0x16, 0x4, 0x3, 0x91, 0x80, 0x88,
+    0x1, 0xfe, 0xf0, 0x3, 0x0, 0x44, 0xcf, 0x11, 0xb4, 0x0, 0x20, 0x57, 0xb3, 0xe, 0xf9, 0x0,
+    0x21, 0xf4, 0x4, 0x89, 0x9c, 0xc0, 0x13, 0x90, 0x45, 0xbb, 0x36, 0xf0, 0xb, 0x80, 0xa, 0x1,
+    0xe1, 0x0, 0xf3, 0x0, 0x71, 0x48, 0x5, 0x60, 0x9, 0x40, 0x0, 0xb6, 0x8, 0x4, 0x6e, 0x5,
+    0x7f, 0xdc, 0x91, 0x60, 0xd, 0x16, 0xa4, 0x0, 0x25, 0xcd, 0x0, 0x80,
+
+    /* U+00E3 "ã" */
+    0x0, 0x86, 0x25, 0x0, 0x24, 0x50, 0xe, 0xd7, 0x6b, 0x80, 0x19, 0xf0, 0xc, 0xa7, 0x1a, 0xcf,
+    0xb8, 0x5e, 0x1, 0x8c, 0xce, 0x53, 0x42, 0x10, 0xa0, 0x19, 0xb0, 0x2, 0x5c, 0xd7, 0x0, 0xff,
+    0xe3, 0x8b, 0xd6, 0xf7, 0x36, 0x4c, 0x3, 0x47, 0x42, 0x90, 0x88, 0x9b, 0x20, 0x2, 0x50, 0x15,
+    0x89, 0x92, 0x80, 0x1d, 0x80, 0x10, 0xff, 0x4e, 0xcc, 0xab, 0x0, 0x58, 0x1, 0x60, 0x40, 0x39,
+    0x18, 0x8, 0x80, 0x1f, 0xef, 0x0, 0x30, 0x4, 0x4c, 0xf1, 0x1b, 0x40, 0x2, 0x5, 0x7b, 0x30,
+    0xef, 0x90, 0x2, 0x1f, 0x40, 0x48, 0x99, 0xcc, 0x1, 0x39, 0x4, 0x5b, 0xb3, 0x6f, 0x0, 0xb8,
+    0x0, 0xa0, 0x1e, 0x10, 0xf, 0x30, 0x7, 0x14, 0x80, 0x56, 0x0, 0x94, 0x0, 0xb, 0x60, 0x80,
+    0x46, 0xe0, 0x57, 0xfd, 0xc9, 0x16, 0x0, 0xd1, 0x6a, 0x40, 0x2, 0x5c, 0xd0, 0x8,
+
+    /* U+00E4 "ä" */
+    0x0, 0x85, 0x44, 0x2, 0x42, 0x0, 0xf5, 0x53, 0x40, 0xf, 0x78, 0x20, 0x1c, 0xe0, 0x20, 0xe,
+    0x1, 0x0, 0xf7, 0x47, 0x0, 0x22, 0x16, 0x20, 0x1c, 0x4e, 0x60, 0x1, 0x74, 0x0, 0xff, 0xe3,
+    0x8b, 0xd6, 0xf7, 0x36, 0x4c, 0x3, 0x47, 0x42, 0x90, 0x88, 0x9b, 0x20, 0x2, 0x50, 0x15, 0x89,
+    0x92, 0x80, 0x1d, 0x80, 0x10, 0xff, 0x4e, 0xcc, 0xab, 0x0, 0x58, 0x1, 0x60, 0x40, 0x39, 0x18,
+    0x8, 0x80, 0x1f, 0xef, 0x0, 0x30, 0x4, 0x4c, 0xf1, 0x1b, 0x40, 0x2, 0x5, 0x7b, 0x30, 0xef,
+    0x90, 0x2, 0x1f, 0x40, 0x48, 0x99, 0xcc, 0x1, 0x39, 0x4, 0x5b, 0xb3, 0x6f, 0x0, 0xb8, 0x0,
+    0xa0, 0x1e, 0x10, 0xf, 0x30, 0x7, 0x14, 0x80, 0x56, 0x0, 0x94, 0x0, 0xb, 0x60, 0x80, 0x46,
+    0xe0, 0x57, 0xfd, 0xc9, 0x16, 0x0, 0xd1, 0x6a, 0x40, 0x2, 0x5c, 0xd0, 0x8,
+
+    /* U+00E5 "å" */
+    0x0, 0xe3, 0x9a, 0x60, 0xf, 0xe4, 0xc0, 0x28, 0x80, 0x7, 0xe8, 0x79, 0x8a, 0x71, 0x0, 0xf8,
+    0xb4, 0x0, 0xa0, 0x40, 0x1f, 0x27, 0x8, 0x30, 0x98, 0x7, 0xd0, 0xff, 0xb3, 0x40, 0x1f, 0x8b,
+    0x2a, 0x7d, 0x0, 0x3f, 0xc8, 0x81, 0x0, 0xf8, 0x5e, 0xb7, 0xb9, 0xb2, 0x60, 0x1a, 0x3a, 0x14,
+    0x84, 0x44, 0xd9, 0x0, 0x12, 0x80, 0xac, 0x4c, 0x94, 0x0, 0xec, 0x0, 0x87, 0xfa, 0x76, 0x65,
+    0x58, 0x2, 0xc0, 0xb, 0x2, 0x1, 0xc8, 0xc0, 0x44, 0x0, 0xff, 0x78, 0x1, 0x80, 0x22, 0x67,
+    0x88, 0xda, 0x0, 0x10, 0x2b, 0xd9, 0x87, 0x7c, 0x80, 0x10, 0xfa, 0x2, 0x44, 0xce, 0x60, 0x9,
+    0xc8, 0x22, 0xdd, 0x9b, 0x78, 0x5, 0xc0, 0x5, 0x0, 0xf0, 0x80, 0x79, 0x80, 0x38, 0xa4, 0x2,
+    0xb0, 0x4, 0xa0, 0x0, 0x5b, 0x4, 0x2, 0x37, 0x2, 0xbf, 0xee, 0x48, 0xb0, 0x6, 0x8b, 0x52,
+    0x0, 0x12, 0xe6, 0x80, 0x40,
+
+    /* U+00E6 "æ" */
+    0x0, 0xb, 0xde, 0xf7, 0x36, 0x4c, 0x2, 0x17, 0xce, 0xe6, 0xc9, 0x80, 0x74, 0x74, 0x21, 0x8,
+    0x89, 0xb1, 0xc1, 0xbe, 0xc, 0x44, 0x4d, 0x92, 0x1, 0x94, 0x5, 0x62, 0x64, 0xa0, 0x8, 0x99,
+    0x8, 0x9a, 0xa8, 0xe4, 0xd, 0x60, 0x14, 0x3f, 0xd3, 0xb3, 0x2a, 0xc0, 0xc, 0x7, 0x92, 0xaa,
+    0x8c, 0x50, 0x47, 0x0, 0x2c, 0x8, 0x7, 0x23, 0x0, 0x7, 0x88, 0x3, 0xd, 0x18, 0x48, 0x7,
+    0xfd, 0xe0, 0x7, 0x20, 0xf, 0xa8, 0x5, 0x0, 0x22, 0x57, 0x88, 0xd8, 0x0, 0x28, 0x8f, 0xde,
+    0x0, 0x30, 0x2b, 0xda, 0x87, 0x7c, 0xa0, 0x4, 0x77, 0xfc, 0xc0, 0x10, 0xfa, 0x2, 0x44, 0xce,
+    0x50, 0x2, 0xcc, 0xff, 0xc8, 0xe4, 0x11, 0x6e, 0xcd, 0xb0, 0x0, 0x6c, 0xdf, 0xf1, 0xf0, 0x1,
+    0x40, 0x3d, 0xc0, 0x7, 0x20, 0xf, 0xfb, 0xc0, 0xc, 0x1, 0xc4, 0xc0, 0x1, 0xf2, 0x0, 0xf4,
+    0xb0, 0x1, 0x0, 0x12, 0x80, 0x12, 0xf8, 0x93, 0x1, 0x64, 0xa9, 0xa3, 0xeb, 0x4a, 0x1, 0xc0,
+    0x15, 0xff, 0x7d, 0x11, 0x3e, 0x5c, 0x5, 0xab, 0x2e, 0x8, 0x15, 0x0, 0xf, 0x8c, 0x42, 0x32,
+    0x46, 0x10, 0x46, 0x31, 0x88, 0x9, 0x2d, 0xd0, 0x0,
+
+    /* U+00E7 "ç" */
+    0x0, 0xc9, 0x3b, 0xdc, 0xc9, 0x30, 0xc, 0x37, 0x66, 0x21, 0x11, 0xb6, 0x48, 0x0, 0x71, 0x0,
+    0x5a, 0x64, 0xc2, 0xd, 0x21, 0x64, 0xb, 0xf2, 0xcc, 0x9c, 0x30, 0x13, 0x50, 0x3a, 0x10, 0xc,
+    0x5b, 0x91, 0x60, 0x8, 0x0, 0xf8, 0x4c, 0xc, 0x0, 0x80, 0x1f, 0xe7, 0x1, 0x0, 0xff, 0x9c,
+    0x4, 0x3, 0xfe, 0x20, 0x1, 0x80, 0x7f, 0xb4, 0x1, 0x20, 0x1f, 0x8, 0x81, 0xc, 0x16, 0x0,
+    0x38, 0x6f, 0xd8, 0x38, 0x41, 0xf1, 0x91, 0xf, 0x8a, 0x38, 0x5, 0xa4, 0x7, 0x37, 0x68, 0x20,
+    0x4b, 0x0, 0x1e, 0xd2, 0x88, 0x0, 0x96, 0xac, 0x40, 0x32, 0xd3, 0x8f, 0xed, 0x28, 0x7, 0xe4,
+    0x9, 0x20, 0xf, 0xf5, 0xb3, 0x3c, 0x3, 0xfc, 0xd0, 0x64, 0x40, 0xf, 0x96, 0x5e, 0x4c, 0x48,
+    0x3, 0xe2, 0x78, 0x64, 0xd0, 0xf, 0xcf, 0xdc, 0xfb, 0x30, 0xc,
+
+    /* U+00E8 "è" */
+    0x0, 0x14, 0xd4, 0x90, 0x7, 0xf8, 0xa9, 0xdb, 0xc, 0x3, 0xfc, 0x78, 0x83, 0xa6, 0x1, 0xfe,
+    0x1b, 0x81, 0xd3, 0x0, 0xff, 0x9f, 0xf8, 0xc0, 0x3f, 0xf9, 0x8b, 0x5b, 0xdc, 0xb6, 0x10, 0xe,
+    0x2c, 0xa5, 0x21, 0x12, 0x4e, 0x20, 0x4, 0x5e, 0x60, 0x93, 0x52, 0xa0, 0x54, 0x60, 0x9, 0x20,
+    0x9b, 0x65, 0x6a, 0xb1, 0x17, 0x1, 0xa0, 0x33, 0x0, 0x39, 0x2c, 0x9, 0xac, 0x1, 0x60, 0x1f,
+    0x29, 0x6, 0x18, 0xa, 0xbb, 0xfe, 0x10, 0x77, 0x0, 0xc4, 0x7f, 0x18, 0x1b, 0x80, 0xc4, 0x7f,
+    0xd2, 0x40, 0x2a, 0xef, 0xff, 0x68, 0x2, 0xc0, 0x3f, 0xe4, 0x30, 0x67, 0x0, 0xf1, 0xd8, 0x80,
+    0x38, 0x42, 0x31, 0xd0, 0xd6, 0xb1, 0x28, 0x0, 0x5a, 0x40, 0x71, 0x79, 0x4a, 0x3, 0xe0, 0x11,
+    0xe5, 0x29, 0x8, 0xa, 0x3f, 0xa0, 0x0,
+
+    /* U+00E9 "é" */
+    0x0, 0xfc, 0x33, 0x52, 0x60, 0x1f, 0xc3, 0xac, 0x98, 0x60, 0x1f, 0x87, 0x4c, 0xd8, 0xa0, 0x1f,
+    0x8b, 0xd, 0xb4, 0x80, 0x3f, 0x8b, 0x7e, 0x44, 0x3, 0xff, 0x98, 0xb5, 0xbd, 0xcb, 0x61, 0x0,
+    0xe2, 0xca, 0x52, 0x11, 0x24, 0xe2, 0x0, 0x45, 0xe6, 0x9, 0x35, 0x2a, 0x5, 0x46, 0x0, 0x92,
+    0x9, 0xb6, 0x56, 0xab, 0x11, 0x70, 0x1a, 0x3, 0x30, 0x3, 0x92, 0xc0, 0x9a, 0xc0, 0x16, 0x1,
+    0xf2, 0x90, 0x61, 0x80, 0xab, 0xbf, 0xe1, 0x7, 0x70, 0xc, 0x47, 0xf1, 0x81, 0xb8, 0xc, 0x47,
+    0xfd, 0x24, 0x2, 0xae, 0xff, 0xf6, 0x80, 0x2c, 0x3, 0xfe, 0x43, 0x6, 0x70, 0xf, 0x1d, 0x88,
+    0x3, 0x84, 0x23, 0x1d, 0xd, 0x6b, 0x12, 0x80, 0x5, 0xa4, 0x7, 0x17, 0x94, 0xa0, 0x3e, 0x1,
+    0x1e, 0x52, 0x90, 0x80, 0xa3, 0xfa, 0x0,
+
+    /* U+00EA "ê" */
+    0x0, 0xe1, 0x9a, 0x92, 0x0, 0xfe, 0x1d, 0x65, 0x6f, 0x20, 0xf, 0x87, 0x4d, 0x39, 0x8b, 0x8,
+    0x3, 0x87, 0x4d, 0xac, 0x66, 0x7, 0xc, 0x3, 0xe, 0x7c, 0x80, 0x4f, 0xfc, 0x60, 0x1f, 0xfc,
+    0x95, 0xad, 0xee, 0x5b, 0x8, 0x7, 0x16, 0x52, 0x90, 0x89, 0x27, 0x10, 0x2, 0x2f, 0x30, 0x49,
+    0xa9, 0x50, 0x2a, 0x30, 0x4, 0x90, 0x4d, 0xb2, 0xb5, 0x58, 0x8b, 0x80, 0xd0, 0x19, 0x80, 0x1c,
+    0x96, 0x4, 0xd6, 0x0, 0xb0, 0xf, 0x94, 0x83, 0xc, 0x5, 0x5d, 0xff, 0x8, 0x3b, 0x80, 0x62,
+    0x3f, 0x8c, 0xd, 0xc0, 0x62, 0x3f, 0xe9, 0x20, 0x15, 0x77, 0xff, 0xb4, 0x1, 0x60, 0x1f, 0xf2,
+    0x18, 0x33, 0x80, 0x78, 0xec, 0x40, 0x1c, 0x21, 0x18, 0xe8, 0x6b, 0x58, 0x94, 0x0, 0x2d, 0x20,
+    0x38, 0xbc, 0xa5, 0x1, 0xf0, 0x8, 0xf2, 0x94, 0x84, 0x5, 0x1f, 0xd0, 0x0,
+
+    /* U+00EB "ë" */
+    0x0, 0xc6, 0x60, 0x8, 0x90, 0x3, 0xe4, 0xcc, 0x20, 0xe, 0x5b, 0x80, 0x78, 0x40, 0x2, 0x6,
+    0x21, 0xe0, 0x1e, 0x59, 0x92, 0x81, 0x5c, 0x48, 0x7, 0xcc, 0xc0, 0x9, 0x1c, 0x40, 0x3f, 0xf9,
+    0x4b, 0x5b, 0xdc, 0xb6, 0x10, 0xe, 0x2c, 0xa5, 0x21, 0x12, 0x4e, 0x20, 0x4, 0x5e, 0x60, 0x93,
+    0x52, 0xa0, 0x54, 0x60, 0x9, 0x20, 0x9b, 0x65, 0x6a, 0xb1, 0x17, 0x1, 0xa0, 0x33, 0x0, 0x39,
+    0x2c, 0x9, 0xac, 0x1, 0x60, 0x1f, 0x29, 0x6, 0x18, 0xa, 0xbb, 0xfe, 0x10, 0x77, 0x0, 0xc4,
+    0x7f, 0x18, 0x1b, 0x80, 0xc4, 0x7f, 0xd2, 0x40, 0x2a, 0xef, 0xff, 0x68, 0x2, 0xc0, 0x3f, 0xe4,
+    0x30, 0x67, 0x0, 0xf1, 0xd8, 0x80, 0x38, 0x42, 0x31, 0xd0, 0xd6, 0xb1, 0x28, 0x0, 0x5a, 0x40,
+    0x71, 0x79, 0x4a, 0x3, 0xe0, 0x11, 0xe5, 0x29, 0x8, 0xa, 0x3f, 0xa0, 0x0,
+
+    /* U+00EC "ì" */
+    0x8a, 0xa2, 0x80, 0x52, 0xb, 0x4c, 0x0, 0x1a, 0x80, 0x96, 0x0, 0x9e, 0xc6, 0x5c, 0x2, 0x4e,
+    0xf7, 0x0, 0xff, 0x36, 0xe8, 0xc0, 0x21, 0x22, 0x38, 0x7, 0xff, 0xfc, 0x3, 0xff, 0x88,
+
+    /* U+00ED "í" */
+    0x0, 0x9e, 0xa8, 0xc0, 0x9, 0x85, 0x26, 0x9, 0x61, 0xa8, 0xa, 0x63, 0xc5, 0x0, 0x57, 0xe1,
+    0x0, 0x7f, 0x9b, 0x74, 0x60, 0x10, 0x91, 0x1c, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xc7,
+
+    /* U+00EE "î" */
+    0x0, 0x9a, 0xa8, 0x80, 0x19, 0x65, 0x55, 0x44, 0x0, 0x3b, 0xa, 0x71, 0xf1, 0x2e, 0x19, 0x58,
+    0x62, 0xa2, 0xdf, 0x60, 0x4, 0xfd, 0x80, 0x7f, 0xe6, 0xdd, 0x18, 0x7, 0x9, 0x11, 0xc0, 0x3f,
+    0xff, 0xe0, 0x1f, 0xfe, 0x0,
+
+    /* U+00EF "ï" */
+    0x3, 0x20, 0x1, 0x90, 0x2e, 0x69, 0x2e, 0x69, 0x18, 0x0, 0x4c, 0x0, 0x2d, 0x34, 0x6d, 0x34,
+    0x60, 0xca, 0x0, 0x65, 0x0, 0xff, 0x9b, 0x74, 0x60, 0x18, 0x48, 0x8e, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xe9, 0x80,
+
+    /* U+00F0 "ð" */
+    0x0, 0x88, 0xd1, 0x6, 0x20, 0x1f, 0x97, 0xb7, 0x2e, 0xd9, 0xd8, 0xc0, 0x72, 0x60, 0x1, 0x10,
+    0x7, 0x8e, 0x7b, 0x1a, 0x40, 0xb, 0x19, 0xdf, 0xeb, 0x20, 0x0, 0x83, 0x58, 0x0, 0x5c, 0xc1,
+    0xb2, 0xc8, 0x10, 0x0, 0x80, 0x18, 0xa7, 0xe4, 0xca, 0x3a, 0xe4, 0xa, 0x40, 0x33, 0xa, 0xde,
+    0xb8, 0x83, 0x18, 0x30, 0x4, 0x55, 0xb4, 0x80, 0x1d, 0x60, 0x28, 0x1, 0x29, 0x9, 0xa1, 0x0,
+    0x48, 0x0, 0x30, 0x9, 0xb3, 0xb2, 0xf7, 0xa4, 0x48, 0x1, 0xc0, 0x37, 0x26, 0x1, 0x85, 0xb0,
+    0xc0, 0x6, 0x14, 0x80, 0x75, 0xdf, 0xd4, 0x65, 0xc0, 0x1, 0x54, 0x4, 0xc5, 0x10, 0x15, 0xc4,
+    0x30, 0x0, 0xf8, 0x2, 0x0, 0x3e, 0x90, 0x8, 0xd8, 0x4, 0xc0, 0x3e, 0x23, 0x0, 0x78, 0x7,
+    0xff, 0xd, 0x14, 0x4, 0xc0, 0x3e, 0x23, 0x4, 0x2d, 0x0, 0x78, 0x80, 0x70, 0xf0, 0x3, 0xc1,
+    0x14, 0xf, 0x18, 0x84, 0x9b, 0xc, 0x1d, 0x0, 0x16, 0x80, 0x53, 0xbd, 0xb2, 0x40, 0xf0, 0x1,
+    0xd, 0xd2, 0x88, 0x4, 0x6f, 0xb0, 0x1, 0xe5, 0xae, 0xfe, 0xfc, 0x82, 0x0, 0xc0,
+
+    /* U+00F1 "ñ" */
+    0x0, 0xcb, 0x2e, 0x20, 0x1, 0x62, 0x0, 0xe6, 0xa6, 0x8c, 0x20, 0x69, 0x0, 0xf5, 0x96, 0xd1,
+    0xee, 0x41, 0x90, 0x7, 0xd, 0x92, 0xe2, 0x8a, 0x70, 0x7, 0xb1, 0x80, 0x5, 0x5b, 0x64, 0x1,
+    0xff, 0xc6, 0x6d, 0xd1, 0x3, 0x5e, 0xf6, 0xd2, 0x80, 0x42, 0x44, 0x6d, 0x94, 0x21, 0x25, 0xaa,
+    0x8, 0x6, 0xa2, 0x16, 0x88, 0x28, 0x1, 0x60, 0x3, 0xa, 0x7c, 0xbb, 0xab, 0x4, 0x18, 0x80,
+    0x22, 0xa1, 0x0, 0xc7, 0x20, 0x4, 0x0, 0x94, 0x40, 0x3c, 0x80, 0xe, 0x0, 0xb4, 0x3, 0xe2,
+    0x0, 0x8, 0x4, 0x20, 0x1f, 0xff, 0xf0, 0xf, 0xfe, 0xe8,
+
+    /* U+00F2 "ò" */
+    0x0, 0xa2, 0xa8, 0xa0, 0x1f, 0xfa, 0x45, 0x69, 0x80, 0x3f, 0xe1, 0xb8, 0x9, 0x60, 0xf, 0xfc,
+    0xf6, 0x32, 0xe0, 0x1f, 0xf9, 0x3b, 0xdc, 0x3, 0xff, 0x9c, 0x93, 0xbd, 0xcc, 0x93, 0x0, 0xf0,
+    0xdd, 0x98, 0x84, 0x46, 0xd9, 0x20, 0x18, 0x71, 0x0, 0x5a, 0x61, 0x44, 0x1a, 0xc0, 0x2b, 0x20,
+    0x5f, 0x96, 0x7a, 0xc3, 0x4, 0x70, 0x35, 0x3, 0xa1, 0x0, 0xc5, 0xa2, 0x12, 0x36, 0x0, 0x80,
+    0xf, 0x85, 0x80, 0x50, 0xc0, 0x8, 0x1, 0xfb, 0x0, 0x1a, 0xe0, 0x20, 0x1f, 0xcc, 0x0, 0x17,
+    0x1, 0x0, 0xfe, 0x10, 0x0, 0x90, 0x1, 0x0, 0x3f, 0x20, 0x3, 0x74, 0x0, 0xf0, 0xf, 0x86,
+    0x80, 0x8, 0x83, 0x4, 0x80, 0xe, 0x1b, 0x20, 0x61, 0xe, 0x10, 0x7c, 0x64, 0x43, 0xe2, 0x81,
+    0xc0, 0x0, 0xb4, 0x80, 0xe6, 0xed, 0x4, 0x9, 0xa2, 0x1, 0x1e, 0x4a, 0x90, 0x88, 0x96, 0xac,
+    0x40, 0x0,
+
+    /* U+00F3 "ó" */
+    0x0, 0xfe, 0x7a, 0xa3, 0x0, 0x7f, 0xd3, 0xa, 0x4c, 0x1, 0xfe, 0xa6, 0x1a, 0x80, 0xf, 0xf5,
+    0x29, 0xe2, 0x80, 0x7f, 0xd5, 0xf8, 0x40, 0x1f, 0xfc, 0xe4, 0x9d, 0xee, 0x64, 0x98, 0x7, 0x86,
+    0xec, 0xc4, 0x22, 0x36, 0xc9, 0x0, 0xc3, 0x88, 0x2, 0xd3, 0xa, 0x20, 0xd6, 0x1, 0x59, 0x2,
+    0xfc, 0xb3, 0xd6, 0x18, 0x23, 0x81, 0xa8, 0x1d, 0x8, 0x6, 0x2d, 0x10, 0x91, 0xb0, 0x4, 0x0,
+    0x7c, 0x2c, 0x2, 0x86, 0x0, 0x40, 0xf, 0xd8, 0x0, 0xd7, 0x1, 0x0, 0xfe, 0x60, 0x0, 0xb8,
+    0x8, 0x7, 0xf0, 0x80, 0x4, 0x80, 0x8, 0x1, 0xf9, 0x0, 0x1b, 0xa0, 0x7, 0x80, 0x7c, 0x34,
+    0x0, 0x44, 0x18, 0x24, 0x0, 0x70, 0xd9, 0x3, 0x8, 0x70, 0x83, 0xe3, 0x22, 0x1f, 0x14, 0xe,
+    0x0, 0x5, 0xa4, 0x7, 0x37, 0x68, 0x20, 0x4d, 0x10, 0x8, 0xf2, 0x54, 0x84, 0x44, 0xb5, 0x62,
+    0x0,
+
+    /* U+00F4 "ô" */
+    0x0, 0xf3, 0xd5, 0x14, 0x3, 0xfe, 0x98, 0x55, 0x52, 0x80, 0x7f, 0x4b, 0x16, 0x48, 0x52, 0x80,
+    0x7d, 0x2c, 0x7e, 0x6d, 0x63, 0x4c, 0x1, 0xe9, 0xfc, 0x20, 0x2, 0x77, 0xb0, 0x7, 0xff, 0x2d,
+    0x27, 0x7b, 0x99, 0x26, 0x1, 0xe1, 0xbb, 0x31, 0x8, 0x8d, 0xb2, 0x40, 0x30, 0xe2, 0x0, 0xb4,
+    0xc2, 0x88, 0x35, 0x80, 0x56, 0x40, 0xbf, 0x2c, 0xf5, 0x86, 0x8, 0xe0, 0x6a, 0x7, 0x42, 0x1,
+    0x8b, 0x44, 0x24, 0x6c, 0x1, 0x0, 0x1f, 0xb, 0x0, 0xa1, 0x80, 0x10, 0x3, 0xf6, 0x0, 0x35,
+    0xc0, 0x40, 0x3f, 0x98, 0x0, 0x2e, 0x2, 0x1, 0xfc, 0x20, 0x1, 0x20, 0x2, 0x0, 0x7e, 0x40,
+    0x6, 0xe8, 0x1, 0xe0, 0x1f, 0xd, 0x0, 0x11, 0x6, 0x9, 0x0, 0x1c, 0x36, 0x40, 0xc2, 0x1c,
+    0x20, 0xf8, 0xc8, 0x87, 0xc5, 0x3, 0x80, 0x1, 0x69, 0x1, 0xcd, 0xda, 0x8, 0x13, 0x44, 0x2,
+    0x3c, 0x95, 0x21, 0x11, 0x2d, 0x58, 0x80, 0x0,
+
+    /* U+00F5 "õ" */
+    0x0, 0xc7, 0x30, 0x40, 0x13, 0x18, 0x7, 0x8b, 0x59, 0xf1, 0x40, 0xe5, 0x40, 0x3d, 0x63, 0x78,
+    0x55, 0x9a, 0x2e, 0x1, 0xf3, 0x21, 0xe3, 0x89, 0x50, 0x80, 0x7a, 0x64, 0x1, 0x46, 0xe2, 0x0,
+    0x7f, 0xf3, 0x12, 0x77, 0xb9, 0x92, 0x60, 0x1e, 0x1b, 0xb3, 0x10, 0x88, 0xdb, 0x24, 0x3, 0xe,
+    0x20, 0xb, 0x4c, 0x28, 0x83, 0x58, 0x5, 0x64, 0xb, 0xf2, 0xcf, 0x58, 0x60, 0x8e, 0x6, 0xa0,
+    0x74, 0x20, 0x18, 0xb4, 0x42, 0x46, 0xc0, 0x10, 0x1, 0xf0, 0xb0, 0xa, 0x18, 0x1, 0x0, 0x3f,
+    0x60, 0x3, 0x5c, 0x4, 0x3, 0xf9, 0x80, 0x2, 0xe0, 0x20, 0x1f, 0xc2, 0x0, 0x12, 0x0, 0x20,
+    0x7, 0xe4, 0x0, 0x6e, 0x80, 0x1e, 0x1, 0xf0, 0xd0, 0x1, 0x10, 0x60, 0x90, 0x1, 0xc3, 0x64,
+    0xc, 0x21, 0xc2, 0xf, 0x8c, 0x88, 0x7c, 0x50, 0x38, 0x0, 0x16, 0x90, 0x1c, 0xdd, 0xa0, 0x81,
+    0x34, 0x40, 0x23, 0xc9, 0x52, 0x11, 0x12, 0xd5, 0x88, 0x0,
+
+    /* U+00F6 "ö" */
+    0x0, 0xc4, 0x80, 0x10, 0xa8, 0x80, 0x7c, 0x39, 0x70, 0x0, 0xaa, 0x80, 0x3f, 0x8, 0x8, 0x1,
+    0x81, 0xc0, 0x3e, 0x1b, 0x88, 0x0, 0x3e, 0x38, 0x3, 0xf2, 0x38, 0x80, 0x9, 0xc8, 0x3, 0xff,
+    0x98, 0x93, 0xbd, 0xcc, 0x93, 0x0, 0xf0, 0xdd, 0x98, 0x84, 0x46, 0xd9, 0x20, 0x18, 0x71, 0x0,
+    0x5a, 0x61, 0x44, 0x1a, 0xc0, 0x2b, 0x20, 0x5f, 0x96, 0x7a, 0xc3, 0x4, 0x70, 0x35, 0x3, 0xa1,
+    0x0, 0xc5, 0xa2, 0x12, 0x36, 0x0, 0x80, 0xf, 0x85, 0x80, 0x50, 0xc0, 0x8, 0x1, 0xfb, 0x0,
+    0x1a, 0xe0, 0x20, 0x1f, 0xcc, 0x0, 0x17, 0x1, 0x0, 0xfe, 0x10, 0x0, 0x90, 0x1, 0x0, 0x3f,
+    0x20, 0x3, 0x74, 0x0, 0xf0, 0xf, 0x86, 0x80, 0x8, 0x83, 0x4, 0x80, 0xe, 0x1b, 0x20, 0x61,
+    0xe, 0x10, 0x7c, 0x64, 0x43, 0xe2, 0x81, 0xc0, 0x0, 0xb4, 0x80, 0xe6, 0xed, 0x4, 0x9, 0xa2,
+    0x1, 0x1e, 0x4a, 0x90, 0x88, 0x96, 0xac, 0x40, 0x0,
+
+    /* U+00F7 "÷" */
+    0x0, 0xe1, 0xce, 0x40, 0xf, 0xf3, 0x98, 0xf8, 0x7, 0xf9, 0x40, 0x6, 0x1, 0xfe, 0x3c, 0xb8,
+    0x0, 0xff, 0x8d, 0x0, 0x3f, 0xf9, 0x5, 0xbb, 0xff, 0x98, 0x8, 0xbf, 0xf0, 0x1d, 0x57, 0xfe,
+    0x41, 0x55, 0xff, 0xc4, 0x1, 0xff, 0xc7, 0x1c, 0xd4, 0x0, 0xff, 0x39, 0x97, 0x80, 0x7f, 0x94,
+    0x0, 0x60, 0x1f, 0xe3, 0xca, 0x80, 0xe,
+
+    /* U+00F8 "ø" */
+    0x0, 0xff, 0xc3, 0x6e, 0x1, 0xff, 0xc1, 0x85, 0x50, 0x7, 0x24, 0xef, 0x73, 0x25, 0xda, 0x8,
+    0x2, 0x1b, 0xb3, 0x10, 0x88, 0xda, 0x1, 0x80, 0x21, 0xc4, 0x1, 0x69, 0x85, 0x0, 0xac, 0x2,
+    0xb2, 0x5, 0xf9, 0x67, 0xe0, 0x9, 0x1c, 0xd, 0x40, 0xe8, 0x40, 0x3, 0x29, 0xc2, 0x12, 0x36,
+    0x0, 0x80, 0xd, 0x7, 0x22, 0xc0, 0x28, 0x60, 0x4, 0x0, 0x91, 0xa0, 0x83, 0x0, 0x1a, 0xe0,
+    0x20, 0x10, 0xca, 0x30, 0x1, 0x80, 0x2, 0xe0, 0x20, 0x14, 0x1c, 0x80, 0x42, 0x0, 0x12, 0x0,
+    0x20, 0x23, 0x41, 0x0, 0x48, 0x0, 0xdd, 0x0, 0x3c, 0x65, 0x18, 0x2, 0x1a, 0x0, 0x22, 0xc,
+    0x13, 0x8e, 0x40, 0x21, 0xb2, 0x6, 0x10, 0xe1, 0x0, 0xa, 0x24, 0xf8, 0xa0, 0x70, 0x0, 0x2d,
+    0x0, 0xa6, 0xed, 0x4, 0x9, 0xa2, 0x1, 0x50, 0x3a, 0x90, 0x88, 0x96, 0xac, 0x40, 0x24, 0x69,
+    0x8a, 0xde, 0xe6, 0xd2, 0x80, 0x77, 0x2b, 0x0, 0x7f, 0xe0,
+
+    /* U+00F9 "ù" */
+    0x0, 0x1c, 0xd4, 0x88, 0x7, 0xf8, 0xf1, 0x1b, 0x44, 0x3, 0xfc, 0xb8, 0x66, 0xc2, 0x0, 0xff,
+    0x16, 0xb1, 0x79, 0x0, 0x7f, 0x86, 0x7f, 0x48, 0x3, 0xff, 0x90, 0xfb, 0xa1, 0x0, 0xf9, 0x37,
+    0x4b, 0xc4, 0x40, 0xf, 0xc2, 0x44, 0x30, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x18, 0xc0, 0x3e, 0x30,
+    0x8, 0x40, 0x2, 0x1, 0xf7, 0x0, 0x5c, 0x0, 0x40, 0xf, 0x94, 0x2, 0x40, 0x4, 0x90, 0x7,
+    0x49, 0x0, 0x44, 0xa0, 0x39, 0xa, 0x8f, 0x8c, 0x1, 0xd6, 0x80, 0x2f, 0x57, 0x6, 0x32, 0x1,
+    0x86, 0xe9, 0x48, 0x4, 0xdb, 0xd4, 0x2,
+
+    /* U+00FA "ú" */
+    0x0, 0xfc, 0x53, 0x52, 0x40, 0x1f, 0xc7, 0x8c, 0xf4, 0x40, 0x1f, 0x8f, 0x45, 0x30, 0xc0, 0x3f,
+    0x1e, 0x8c, 0x58, 0x80, 0x7f, 0x1f, 0x7b, 0x80, 0x7f, 0xf2, 0x5f, 0x74, 0x20, 0x1f, 0x26, 0xe9,
+    0x78, 0x88, 0x1, 0xf8, 0x48, 0x86, 0x1, 0xff, 0xff, 0x0, 0xff, 0xe3, 0x18, 0x7, 0xc6, 0x1,
+    0x8, 0x0, 0x40, 0x3e, 0xe0, 0xb, 0x80, 0x8, 0x1, 0xf2, 0x80, 0x48, 0x0, 0x92, 0x0, 0xe9,
+    0x20, 0x8, 0x94, 0x7, 0x21, 0x51, 0xf1, 0x80, 0x3a, 0xd0, 0x5, 0xea, 0xe0, 0xc6, 0x40, 0x30,
+    0xdd, 0x29, 0x0, 0x9b, 0x7a, 0x80, 0x40,
+
+    /* U+00FB "û" */
+    0x0, 0xe2, 0x9a, 0x91, 0x0, 0xfe, 0x2f, 0x65, 0x6d, 0x10, 0xf, 0x8b, 0x9, 0xb9, 0xf, 0x44,
+    0x3, 0x8f, 0x6, 0x24, 0x6d, 0x8f, 0x44, 0x3, 0x1f, 0x7b, 0x80, 0x53, 0xf8, 0x20, 0x1f, 0xfc,
+    0x57, 0xdd, 0x8, 0x7, 0xc9, 0xba, 0x5e, 0x22, 0x0, 0x7e, 0x12, 0x21, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xf8, 0xc6, 0x1, 0xf1, 0x80, 0x42, 0x0, 0x10, 0xf, 0xb8, 0x2, 0xe0, 0x2, 0x0, 0x7c,
+    0xa0, 0x12, 0x0, 0x24, 0x80, 0x3a, 0x48, 0x2, 0x25, 0x1, 0xc8, 0x54, 0x7c, 0x60, 0xe, 0xb4,
+    0x1, 0x7a, 0xb8, 0x31, 0x90, 0xc, 0x37, 0x4a, 0x40, 0x26, 0xde, 0xa0, 0x10,
+
+    /* U+00FC "ü" */
+    0x0, 0xc8, 0x40, 0x11, 0x98, 0x3, 0xe7, 0xbc, 0x10, 0x4c, 0xc2, 0x0, 0x7b, 0xc0, 0x4c, 0x4,
+    0x0, 0x20, 0x1e, 0x98, 0xb2, 0x5, 0x99, 0x28, 0x7, 0x85, 0xd0, 0x2, 0x66, 0x0, 0x7f, 0xf1,
+    0xdf, 0x74, 0x20, 0x1f, 0x26, 0xe9, 0x78, 0x88, 0x1, 0xf8, 0x48, 0x86, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xe3, 0x18, 0x7, 0xc6, 0x1, 0x8, 0x0, 0x40, 0x3e, 0xe0, 0xb, 0x80, 0x8, 0x1, 0xf2,
+    0x80, 0x48, 0x0, 0x92, 0x0, 0xe9, 0x20, 0x8, 0x94, 0x7, 0x21, 0x51, 0xf1, 0x80, 0x3a, 0xd0,
+    0x5, 0xea, 0xe0, 0xc6, 0x40, 0x30, 0xdd, 0x29, 0x0, 0x9b, 0x7a, 0x80, 0x40,
+
+    /* U+00FD "ý" */
+    0x0, 0xfe, 0x29, 0xa9, 0x20, 0xf, 0xf8, 0xbd, 0x9e, 0x88, 0x3, 0xfc, 0x78, 0x49, 0x86, 0x1,
+    0xfe, 0x3d, 0x17, 0xb1, 0x0, 0xff, 0x8f, 0xbe, 0x0, 0x3f, 0xf9, 0xb7, 0xb6, 0x1, 0xfc, 0x5b,
+    0xa6, 0xc, 0x24, 0x50, 0xf, 0xd4, 0x44, 0x40, 0x61, 0xe, 0x0, 0xf8, 0x58, 0x14, 0x80, 0x5c,
+    0x10, 0xc0, 0x3c, 0xe2, 0x12, 0x1, 0x58, 0x2, 0x40, 0x3d, 0x40, 0x86, 0x1, 0x12, 0x82, 0x88,
+    0x6, 0x43, 0xe, 0x0, 0xee, 0x0, 0x48, 0x6, 0xe0, 0x25, 0x0, 0xe4, 0x30, 0x60, 0x8, 0x94,
+    0x2c, 0x3, 0xea, 0x1, 0x60, 0x5, 0x0, 0xb8, 0x7, 0xcc, 0x21, 0x40, 0x2c, 0xc, 0x20, 0x1f,
+    0xa4, 0xd, 0x1c, 0x42, 0x40, 0x3f, 0x98, 0x43, 0xac, 0x18, 0x40, 0x3f, 0x85, 0xc1, 0x48, 0x28,
+    0x3, 0xfe, 0xb0, 0x9, 0xc, 0x3, 0xfe, 0x24, 0x0, 0x78, 0x7, 0xff, 0x5, 0xc0, 0x90, 0x3,
+    0xff, 0x29, 0x85, 0x80, 0x7e, 0x95, 0x0, 0x1d, 0x81, 0x30, 0x7, 0xc8, 0xd5, 0xdc, 0xc1, 0x9,
+    0x0, 0xfc, 0xe6, 0x2, 0x20, 0x2b, 0x40, 0xf, 0xc7, 0x98, 0x99, 0x5e, 0xa0, 0x7, 0xf0,
+
+    /* U+00FE "þ" */
+    0x5c, 0xc1, 0x80, 0x7f, 0xe2, 0x33, 0x38, 0x7, 0xff, 0xfc, 0x3, 0xcb, 0x7b, 0xdb, 0x6c, 0x1,
+    0xf0, 0xe5, 0x21, 0x9, 0x24, 0xe9, 0x80, 0x75, 0x98, 0x2c, 0x4b, 0x90, 0x16, 0x98, 0x6, 0x12,
+    0xca, 0x76, 0x8d, 0x60, 0x1f, 0x0, 0xc3, 0xc6, 0x1, 0xd2, 0x80, 0x6a, 0x1, 0x39, 0x80, 0x7d,
+    0x0, 0xf, 0x0, 0xb0, 0x3, 0xf1, 0x88, 0x38, 0x4, 0x20, 0x1f, 0xc4, 0x6, 0x1, 0x8, 0x7,
+    0xf1, 0x1, 0x80, 0x5a, 0x1, 0xf8, 0x84, 0x1c, 0x2, 0x61, 0x0, 0xfa, 0xc0, 0x18, 0x1, 0xd,
+    0x8, 0x7, 0x3b, 0x0, 0xb8, 0x6, 0x4f, 0x74, 0x36, 0xb8, 0x0, 0x50, 0x80, 0x52, 0x43, 0x17,
+    0x92, 0x80, 0x34, 0x80, 0x18, 0xb1, 0xcc, 0x40, 0x8e, 0x31, 0x40, 0x3c, 0x31, 0x9d, 0xfb, 0x8e,
+    0x40, 0x1f, 0xff, 0x75, 0xbb, 0x28, 0x7, 0xfe,
+
+    /* U+00FF "ÿ" */
+    0x0, 0xe4, 0x20, 0x8, 0xcc, 0x1, 0xfc, 0xd7, 0xa4, 0x7, 0x98, 0x40, 0xf, 0xc2, 0x0, 0x10,
+    0x70, 0x1, 0x0, 0x7e, 0x68, 0xa3, 0x4, 0xa9, 0x60, 0xf, 0xc2, 0xea, 0x1, 0x2b, 0x0, 0x7f,
+    0xf2, 0xef, 0x6c, 0x3, 0xf8, 0xb7, 0x4c, 0x18, 0x48, 0xa0, 0x1f, 0xa8, 0x88, 0x80, 0xc2, 0x1c,
+    0x1, 0xf0, 0xb0, 0x29, 0x0, 0xb8, 0x21, 0x80, 0x79, 0xc4, 0x24, 0x2, 0xb0, 0x4, 0x80, 0x7a,
+    0x81, 0xc, 0x2, 0x25, 0x5, 0x10, 0xc, 0x86, 0x1c, 0x1, 0xdc, 0x0, 0x90, 0xd, 0xc0, 0x4a,
+    0x1, 0xc8, 0x60, 0xc0, 0x11, 0x28, 0x58, 0x7, 0xd4, 0x2, 0xc0, 0xa, 0x1, 0x70, 0xf, 0x98,
+    0x42, 0x80, 0x58, 0x18, 0x40, 0x3f, 0x48, 0x1a, 0x38, 0x84, 0x80, 0x7f, 0x30, 0x87, 0x58, 0x30,
+    0x80, 0x7f, 0xb, 0x82, 0x90, 0x50, 0x7, 0xfd, 0x60, 0x12, 0x18, 0x7, 0xfc, 0x48, 0x0, 0xf0,
+    0xf, 0xfe, 0xb, 0x81, 0x20, 0x7, 0xfe, 0x53, 0xb, 0x0, 0xfd, 0x2a, 0x0, 0x3b, 0x2, 0x60,
+    0xf, 0x91, 0xab, 0xb9, 0x82, 0x12, 0x1, 0xf9, 0xcc, 0x4, 0x40, 0x56, 0x80, 0x1f, 0x8f, 0x31,
+    0x32, 0xbd, 0x40, 0xf, 0xe0,
+
+    /* U+2013 "–" */
+    0x99, 0xff, 0xe1, 0x33, 0x7f, 0xf0, 0xae, 0xff, 0xf8, 0x40,
+
+    /* U+2014 "—" */
+    0x99, 0xff, 0xe8, 0x33, 0x7f, 0xf4, 0x2e, 0xff, 0xfa, 0x0,
+
+    /* U+2018 "‘" */
+    0x1, 0xb9, 0x4, 0x40, 0x87, 0x86, 0x8a, 0x2, 0x20, 0x44, 0x58, 0x3, 0xc6, 0x0, 0x39, 0x21,
+    0x80,
+
+    /* U+2019 "’" */
+    0x2b, 0xd5, 0xa4, 0x2b, 0x0, 0x86, 0x4c, 0x10, 0x58, 0x34, 0x10, 0x1c, 0xc5, 0x5, 0x8b, 0x80,
+
+    /* U+201C "“" */
+    0x1, 0xb9, 0x0, 0xa7, 0x4, 0x11, 0x2, 0x0, 0x16, 0x11, 0x7, 0x86, 0x80, 0x10, 0x10, 0x5,
+    0x1, 0x0, 0x1e, 0x18, 0x8, 0x22, 0x20, 0x15, 0x2, 0xc, 0x1, 0xe0, 0x40, 0x4, 0x19, 0x80,
+    0x6, 0x1, 0xcf, 0x24, 0x30, 0xa, 0x80, 0xa8,
+
+    /* U+201D "”" */
+    0x2b, 0xd5, 0x0, 0x4e, 0xc8, 0x52, 0x15, 0x82, 0x31, 0x32, 0x0, 0x42, 0x1, 0xe9, 0x30, 0x40,
+    0x47, 0x0, 0x28, 0xb0, 0x68, 0x3, 0x81, 0x44, 0x10, 0x1c, 0x1, 0x81, 0xe0, 0x62, 0x82, 0x0,
+    0x71, 0x40, 0x62, 0xe0, 0x1, 0x3, 0x88, 0x0,
+
+    /* U+2022 "•" */
+    0x0, 0x9, 0x88, 0x1, 0x7b, 0x3c, 0xc2, 0xc0, 0x3, 0x2, 0x20, 0x9, 0x84, 0xc0, 0x24, 0xe,
+    0x53, 0x78,
+
+    /* U+2026 "…" */
+    0x7, 0x92, 0x0, 0x8e, 0x58, 0x3, 0x3c, 0x94, 0x41, 0xbc, 0x0, 0x3a, 0xd2, 0xa0, 0x8, 0x83,
+    0x79, 0x0, 0x8, 0x0, 0x62, 0x0, 0x20, 0x1, 0x0, 0xa, 0x48, 0x60, 0x0, 0x4a, 0x26, 0xa0,
+    0xe, 0x21, 0x80,
+
+    /* U+20AC "€" */
+    0x0, 0xff, 0x1c, 0x56, 0x62, 0xa1, 0x0, 0x3f, 0xf2, 0xee, 0x3a, 0x99, 0x95, 0xef, 0x58, 0x3,
+    0xfa, 0xa8, 0x40, 0x2, 0x45, 0x30, 0x1, 0x4d, 0x8, 0x7, 0xad, 0x40, 0xf, 0xba, 0xba, 0xce,
+    0x92, 0x5, 0x20, 0xe, 0x84, 0x2, 0xc8, 0x20, 0xc, 0x2d, 0x89, 0x66, 0x1, 0x8d, 0xc0, 0x78,
+    0xc0, 0x3f, 0xd, 0xa0, 0x7, 0x50, 0x2, 0x4c, 0x3, 0xff, 0x82, 0x31, 0x13, 0x80, 0x3a, 0x23,
+    0xe7, 0x0, 0xf1, 0xbb, 0xc2, 0x0, 0x67, 0x7f, 0xa8, 0x3, 0xc5, 0xdc, 0xa0, 0x3, 0x77, 0x7e,
+    0xc0, 0xf, 0x84, 0x60, 0x0, 0x8f, 0xf8, 0x3, 0xc5, 0x54, 0xf0, 0x2, 0xd5, 0x7e, 0x90, 0xf,
+    0x91, 0xa, 0x0, 0x24, 0x4f, 0xca, 0x1, 0xe2, 0xee, 0x90, 0x1, 0x5d, 0xdf, 0x60, 0x7, 0xfb,
+    0x80, 0x10, 0x1, 0xff, 0xc6, 0x53, 0x3, 0xa0, 0xf, 0xf2, 0x88, 0x7, 0xb8, 0x41, 0x6c, 0xc0,
+    0x3c, 0x33, 0x5a, 0x20, 0x1c, 0x5a, 0x20, 0x99, 0x6e, 0xa8, 0xd3, 0xec, 0x4, 0x40, 0xf, 0x1e,
+    0x20, 0x1, 0x22, 0xae, 0x58, 0x40, 0xf0, 0xc0, 0x3e, 0x2b, 0xb3, 0x98, 0x80, 0x4, 0x9a, 0xb0,
+    0x80,
+
+    /* U+F00D "" */
+    0x0, 0x8, 0x80, 0x3f, 0xf0, 0x80, 0x66, 0xef, 0x50, 0xf, 0xe2, 0xde, 0x90, 0x3, 0x48, 0xd,
+    0x28, 0x7, 0xc5, 0xe4, 0xd, 0x41, 0x0, 0x1a, 0x94, 0x3, 0x8b, 0xc8, 0x2, 0x53, 0x20, 0xe,
+    0xa5, 0x0, 0x8b, 0xc8, 0x3, 0x9, 0x71, 0x0, 0x75, 0x28, 0x17, 0x90, 0x7, 0x58, 0x97, 0x90,
+    0x7, 0x53, 0x79, 0x0, 0x75, 0x28, 0x0, 0xbc, 0x80, 0x3a, 0x48, 0x3, 0xa9, 0x40, 0x31, 0x79,
+    0x0, 0x7f, 0xa9, 0x40, 0x3c, 0x5e, 0x40, 0x1f, 0xa9, 0x40, 0x3f, 0x14, 0x80, 0x7c, 0xea, 0x1,
+    0xfc, 0x52, 0x1, 0xf3, 0xa8, 0x7, 0xe2, 0xf2, 0x0, 0xfd, 0x4a, 0x1, 0xe2, 0xf2, 0x0, 0xff,
+    0x52, 0x80, 0x62, 0xf2, 0x0, 0xe9, 0x20, 0xe, 0xa5, 0x0, 0x17, 0x90, 0x7, 0x53, 0x79, 0x0,
+    0x75, 0x28, 0x71, 0x0, 0x75, 0x28, 0x17, 0x90, 0x7, 0x58, 0x90, 0x7, 0x52, 0x80, 0x45, 0xe4,
+    0x1, 0x84, 0xa0, 0x3, 0x52, 0x80, 0x71, 0x79, 0x0, 0x4a, 0x6d, 0x20, 0x34, 0xa0, 0x1f, 0x17,
+    0x90, 0x35, 0x0, 0x1b, 0xbd, 0x40, 0x3f, 0x8b, 0x7a, 0x40, 0x0,
+
+    /* U+F013 "" */
+    0x0, 0xfe, 0x4c, 0xef, 0xf7, 0x62, 0x0, 0x7f, 0xf1, 0xb0, 0xc4, 0x0, 0x27, 0x80, 0x1f, 0xfe,
+    0x2, 0x0, 0xf1, 0x0, 0x7f, 0xc5, 0x8e, 0x0, 0x6e, 0x50, 0xf, 0x2f, 0x30, 0x1, 0xf4, 0x80,
+    0x21, 0xf3, 0x8d, 0xb9, 0x10, 0xf, 0xc3, 0x37, 0xb0, 0x5e, 0x20, 0x8, 0x20, 0x1, 0x20, 0x7,
+    0xfe, 0x42, 0x0, 0x14, 0x1, 0x30, 0x7, 0xff, 0x29, 0x8a, 0xc0, 0x3f, 0xf9, 0x96, 0xe0, 0x1f,
+    0xc5, 0x39, 0x89, 0x20, 0xf, 0xe7, 0xa2, 0x0, 0xf8, 0xf1, 0x8c, 0xcd, 0x86, 0x1, 0xf1, 0x52,
+    0x6b, 0x0, 0x7b, 0x84, 0x3, 0xf, 0x0, 0x79, 0xb5, 0x0, 0x1e, 0x1, 0xc6, 0x40, 0x1e, 0x23,
+    0x0, 0xef, 0x0, 0xc2, 0x1, 0xcc, 0x1, 0xf9, 0x80, 0x38, 0x40, 0x30, 0x80, 0x73, 0x0, 0x7e,
+    0x60, 0xe, 0x10, 0xd, 0xe0, 0x1c, 0x64, 0x1, 0xe2, 0x30, 0xe, 0xf0, 0x2, 0x6b, 0x0, 0x7b,
+    0x84, 0x3, 0xf, 0x0, 0x79, 0xb5, 0x28, 0x80, 0x3e, 0x3c, 0x63, 0x33, 0x61, 0x80, 0x7c, 0x54,
+    0xe0, 0x1f, 0xc5, 0x39, 0x89, 0x20, 0xf, 0xe7, 0xb0, 0xf, 0xfe, 0x65, 0x93, 0x0, 0x7f, 0xf2,
+    0x98, 0x82, 0x8, 0x0, 0x48, 0x1, 0xff, 0x90, 0x80, 0x5, 0x0, 0x1, 0xf2, 0x8d, 0xb9, 0x10,
+    0xf, 0xc3, 0x37, 0xb0, 0x7e, 0x20, 0x11, 0x6b, 0x80, 0x1b, 0x94, 0x3, 0xcb, 0xcc, 0x0, 0x7c,
+    0x20, 0xf, 0xf8, 0x80, 0x3c, 0x40, 0x1f, 0xfe, 0xc, 0x31, 0x0, 0x9, 0xe0, 0x7, 0xf0,
+
+    /* U+F053 "" */
+    0x0, 0xff, 0x85, 0x84, 0x3, 0xfe, 0x2c, 0x9d, 0x10, 0xf, 0xe2, 0xf2, 0x3, 0xd0, 0xf, 0xc5,
+    0xe4, 0x1, 0x8, 0x7, 0xc5, 0xe4, 0x1, 0xf, 0x0, 0x78, 0xbc, 0x80, 0x21, 0xd3, 0x0, 0xe2,
+    0xf2, 0x0, 0x87, 0x4c, 0x3, 0x8b, 0xc8, 0x2, 0x1d, 0x30, 0xe, 0x2f, 0x20, 0x8, 0x74, 0xc0,
+    0x38, 0xbc, 0x80, 0x21, 0xd3, 0x0, 0xe2, 0xf2, 0x0, 0x87, 0x4c, 0x3, 0x8b, 0xc8, 0x2, 0x1d,
+    0x30, 0xf, 0x29, 0x0, 0x68, 0x30, 0xf, 0x94, 0x80, 0x34, 0x18, 0x7, 0xc5, 0xe4, 0x1, 0xe,
+    0x98, 0x7, 0xc5, 0xe4, 0x1, 0xe, 0x98, 0x7, 0xc5, 0xe4, 0x1, 0xe, 0x98, 0x7, 0xc5, 0xe4,
+    0x1, 0xe, 0x98, 0x7, 0xc5, 0xe4, 0x1, 0xe, 0x98, 0x7, 0xc5, 0xe4, 0x1, 0xe, 0x98, 0x7,
+    0xc5, 0xe4, 0x1, 0xe, 0x98, 0x7, 0xc5, 0xe4, 0x1, 0xf, 0x0, 0x7e, 0x2f, 0x20, 0x8, 0x40,
+    0x3f, 0x8b, 0xc8, 0xf, 0x40, 0x3f, 0xc5, 0x93, 0xa2,
+
+    /* U+F070 "" */
+    0x5, 0x40, 0xf, 0xfe, 0xa2, 0x55, 0xc0, 0x7, 0xff, 0x4e, 0x80, 0xf, 0x62, 0x1, 0xff, 0xd1,
+    0x60, 0x9, 0x30, 0xc0, 0x3f, 0xfa, 0x11, 0x42, 0x0, 0x2c, 0x70, 0xc, 0x4d, 0x59, 0xdf, 0xdb,
+    0x70, 0x80, 0x1f, 0xfc, 0x15, 0xd2, 0x0, 0xa2, 0x85, 0xf7, 0x52, 0xa6, 0x20, 0x24, 0x8f, 0x7a,
+    0xe2, 0x1, 0xff, 0x1e, 0x28, 0x4, 0xbd, 0x4, 0x1, 0xa, 0x2a, 0x10, 0x4, 0x51, 0xec, 0x1,
+    0xff, 0xd, 0x40, 0x7, 0xc7, 0x5d, 0x75, 0x7b, 0x88, 0x1, 0xc, 0xd8, 0x80, 0x7f, 0xcf, 0x62,
+    0x1, 0x8b, 0x14, 0x3, 0x8e, 0xe0, 0x3, 0x26, 0x10, 0x7, 0xfc, 0x9e, 0x80, 0x11, 0x61, 0x3,
+    0xdc, 0xa8, 0x1, 0xe0, 0x3, 0x16, 0x10, 0x7, 0xc2, 0x20, 0x0, 0xdb, 0x80, 0x47, 0x88, 0x8,
+    0xd5, 0x62, 0xe, 0x80, 0x18, 0x7c, 0x40, 0x3d, 0x78, 0x60, 0x14, 0x50, 0x80, 0x6, 0xec, 0x1,
+    0x25, 0x0, 0x20, 0x3, 0x8a, 0x80, 0x39, 0x54, 0x5a, 0xa0, 0x12, 0xe1, 0x80, 0x46, 0x1, 0x91,
+    0x40, 0xc8, 0x3, 0x91, 0x80, 0x21, 0xb0, 0x0, 0xd4, 0x80, 0x45, 0xac, 0x1, 0xfb, 0x0, 0xc,
+    0x1, 0xe8, 0x10, 0x1, 0x8, 0x6, 0x6c, 0x20, 0x0, 0xcc, 0x80, 0x3e, 0x20, 0x0, 0x80, 0x78,
+    0x48, 0x0, 0x42, 0x1, 0xc7, 0x20, 0x19, 0xb0, 0x80, 0x38, 0x80, 0x2, 0x1, 0xe1, 0x20, 0x0,
+    0xc0, 0x7, 0x94, 0x3, 0x8f, 0x10, 0x3, 0x29, 0x2, 0x80, 0x7a, 0xc4, 0x2, 0x64, 0x0, 0xe1,
+    0x40, 0xe, 0x1b, 0x80, 0x8, 0xf2, 0x4, 0x3, 0x95, 0x40, 0x1d, 0x44, 0x1, 0xd0, 0x1, 0xf3,
+    0xd8, 0x80, 0x5, 0xc0, 0x38, 0xec, 0x3, 0xc3, 0xe2, 0x1, 0x8d, 0xc0, 0x3e, 0x4c, 0x30, 0xf,
+    0x8b, 0x84, 0x3, 0xe2, 0xc2, 0x0, 0xd0, 0xe0, 0x1f, 0x16, 0x30, 0x7, 0x17, 0x90, 0x7, 0xf1,
+    0x62, 0x0, 0x68, 0xb4, 0x0, 0xfa, 0x68, 0x40, 0x22, 0x40, 0xf, 0xf8, 0x6e, 0x44, 0x2, 0x4b,
+    0xeb, 0xab, 0x50, 0x9, 0x74, 0x80, 0x29, 0xa1, 0x0, 0xff, 0x9b, 0xe0, 0x80, 0x21, 0x45, 0x4a,
+    0x80, 0x8, 0xf1, 0x40, 0x25, 0xc2, 0x0, 0xff, 0x85, 0xf6, 0xdd, 0x8, 0x40, 0x48, 0x88, 0x1,
+    0xd, 0x40, 0x4, 0x58, 0xa0, 0x1f, 0xfc, 0x14, 0x8b, 0xde, 0xfe, 0xda, 0x40, 0xe, 0x7b, 0x20,
+    0x0, 0xd4, 0x0, 0x7f, 0xf4, 0x13, 0x10, 0x2, 0x60, 0xf, 0xfe, 0x88, 0xdb, 0x80, 0x28, 0x3,
+    0xff, 0xa7, 0x17, 0x48,
+
+    /* U+F0C7 "" */
+    0x7, 0xbb, 0xff, 0xe2, 0x30, 0x7, 0xa2, 0x8, 0x9f, 0xfc, 0x49, 0x90, 0x7, 0x30, 0x7, 0xff,
+    0x19, 0xa4, 0x3, 0x8, 0x0, 0x51, 0x3f, 0xf1, 0x80, 0x4d, 0x20, 0x1e, 0x6b, 0xbf, 0xfd, 0x8c,
+    0x1, 0x34, 0x80, 0x7f, 0xf1, 0xc4, 0x3, 0x34, 0x80, 0x7f, 0xf3, 0x19, 0x0, 0x3f, 0xf9, 0x86,
+    0x1, 0xff, 0xcc, 0xf0, 0xf, 0xfe, 0x81, 0xa2, 0x7f, 0xf0, 0x4c, 0x3, 0xde, 0x1, 0x25, 0xdf,
+    0xff, 0x5, 0x0, 0x3d, 0xe0, 0x1f, 0xff, 0x4, 0xab, 0x81, 0x0, 0xfe, 0xf0, 0xf, 0xe6, 0xb5,
+    0x47, 0xc1, 0x0, 0xfd, 0xe0, 0x1f, 0x86, 0x0, 0x31, 0x48, 0x7, 0xef, 0x0, 0xfc, 0x42, 0x1,
+    0xc6, 0x1, 0xfb, 0xc0, 0x3f, 0x8, 0x7, 0x84, 0x3, 0xff, 0x8a, 0x48, 0x1, 0xdc, 0x1, 0xff,
+    0xc6, 0x94, 0x0, 0xc, 0xa0, 0x7, 0xff, 0x18, 0xaf, 0x73, 0xd8, 0x3, 0xfc, 0x20, 0x1f, 0xe2,
+    0x31, 0x0, 0xff, 0x73, 0x0, 0x7f, 0xf2, 0x85, 0x22, 0x8, 0x9f, 0xfc, 0x86, 0xd2,
+
+    /* U+F15B "" */
+    0x37, 0x88, 0xff, 0x10, 0x38, 0x80, 0x76, 0xc3, 0xbf, 0xf9, 0x82, 0x34, 0x40, 0x30, 0x80, 0x7f,
+    0xf0, 0x8f, 0x44, 0x3, 0xff, 0x8e, 0x7a, 0x20, 0x1f, 0xfc, 0x73, 0xd1, 0x0, 0xff, 0xe3, 0x9e,
+    0x88, 0x7, 0xff, 0x1c, 0xe8, 0x3, 0xff, 0x84, 0xef, 0xec, 0x0, 0xff, 0xc6, 0x11, 0x1e, 0x70,
+    0xf, 0xfd, 0x19, 0x77, 0xf0, 0x7, 0xff, 0x4, 0xd1, 0x3e, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff,
+    0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xfe, 0xc0, 0x80, 0x7f, 0xf1, 0xc7, 0x61, 0xdf,
+    0xff, 0x8b, 0x1a,
+
+    /* U+F1EB "" */
+    0x0, 0xff, 0x85, 0x1a, 0x6a, 0xf2, 0xea, 0x59, 0x4, 0x3, 0xff, 0x8e, 0x4f, 0x9d, 0x72, 0xca,
+    0x86, 0x8a, 0xd3, 0x7d, 0x8e, 0x40, 0x1f, 0xfc, 0x24, 0xbd, 0x83, 0x0, 0xff, 0xe0, 0x9c, 0x6d,
+    0xa0, 0x7, 0xf8, 0xf2, 0xd0, 0x3, 0xff, 0x8e, 0x97, 0x86, 0x1, 0xe1, 0x8c, 0x30, 0xf, 0xc4,
+    0x8a, 0xb2, 0x10, 0x7, 0xe3, 0xc8, 0x10, 0x8, 0xb5, 0xc0, 0x3c, 0x71, 0x7d, 0xb7, 0x55, 0x5e,
+    0xf5, 0xc1, 0x80, 0x79, 0xf4, 0x81, 0x30, 0xc0, 0x39, 0xb3, 0xe, 0x82, 0x1, 0xf0, 0xa3, 0xe6,
+    0x18, 0x3, 0x8f, 0x12, 0x84, 0x3, 0x26, 0x49, 0x80, 0x7f, 0xf0, 0xce, 0x71, 0x0, 0x30, 0xd4,
+    0x80, 0x69, 0xb3, 0x0, 0xff, 0xe3, 0x9d, 0xc8, 0x6, 0x97, 0x80, 0x2c, 0x60, 0xf, 0x24, 0x5e,
+    0xf7, 0xf6, 0xdc, 0x20, 0x7, 0x9b, 0x8, 0x21, 0xc1, 0xef, 0xc, 0x3, 0xc, 0x6d, 0xba, 0x10,
+    0x80, 0x92, 0x3d, 0xec, 0x8, 0x6, 0x3c, 0xb7, 0x0, 0x90, 0x40, 0x33, 0x7b, 0x90, 0x7, 0xfc,
+    0x4f, 0xec, 0x1, 0x85, 0x0, 0x3f, 0xd, 0x48, 0x80, 0x7f, 0xf0, 0xc6, 0x68, 0x40, 0x3f, 0xf5,
+    0x28, 0x7, 0x91, 0xe2, 0x61, 0xd0, 0x3, 0xcb, 0x40, 0x1f, 0xf8, 0xc0, 0x31, 0x47, 0x5c, 0x3b,
+    0x3c, 0x5f, 0x41, 0x0, 0x63, 0x0, 0xff, 0xd0, 0xc0, 0x6, 0xc7, 0x10, 0xf, 0x85, 0xf1, 0x80,
+    0xd, 0x0, 0x1f, 0xfc, 0x19, 0x95, 0xc8, 0x80, 0x7f, 0xc3, 0x37, 0x32, 0x0, 0xff, 0xe1, 0xb2,
+    0x0, 0x78, 0x4c, 0x40, 0x3c, 0x8c, 0x1, 0xff, 0xcb, 0x9e, 0xce, 0x90, 0xf, 0xfe, 0x8c, 0x30,
+    0x4, 0xd0, 0x1, 0xff, 0xd0, 0x50, 0xe, 0x50, 0xf, 0xfe, 0x81, 0x80, 0x71, 0x80, 0x7f, 0xf4,
+    0x14, 0x3, 0x94, 0x3, 0xff, 0xa1, 0x2, 0x1, 0xc, 0x0, 0x7f, 0xf4, 0xf, 0x19, 0x1b, 0xc,
+    0x3, 0xff, 0x84,
+
+    /* U+F240 "" */
+    0x1, 0x34, 0x4f, 0xfe, 0x80, 0x80, 0x47, 0xf9, 0x77, 0xff, 0xd0, 0xe6, 0x0, 0x78, 0x80, 0x7f,
+    0xf4, 0xa4, 0x40, 0xc0, 0x3f, 0xfa, 0x8a, 0x1, 0x9a, 0xef, 0xff, 0x9b, 0x0, 0x14, 0x30, 0x4,
+    0x28, 0x9f, 0xfc, 0xd3, 0x0, 0x8e, 0x40, 0x3a, 0xff, 0xff, 0xf9, 0x40, 0x1f, 0xfd, 0x87, 0x42,
+    0x0, 0xff, 0xea, 0x1d, 0xa8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0x9e, 0x76, 0xa0, 0x1f, 0xfd, 0x47,
+    0x42, 0x0, 0xfd, 0x7f, 0xff, 0xfc, 0xa0, 0xf, 0xf0, 0xa2, 0x7f, 0xf3, 0x4c, 0x2, 0x39, 0x0,
+    0x9a, 0xef, 0xff, 0x9b, 0x0, 0x14, 0x31, 0x80, 0x7f, 0xf5, 0x14, 0x3c, 0x40, 0x3f, 0xfa, 0x52,
+    0x20, 0x7f, 0x97, 0x7f, 0xfd, 0xe, 0x60, 0x0,
+
+    /* U+F241 "" */
+    0x1, 0x34, 0x4f, 0xfe, 0x80, 0x80, 0x47, 0xf9, 0x77, 0xff, 0xd0, 0xe6, 0x0, 0x78, 0x80, 0x7f,
+    0xf4, 0xa4, 0x40, 0xc0, 0x3f, 0xfa, 0x8a, 0x1, 0x9a, 0xef, 0xff, 0x9b, 0x0, 0x14, 0x30, 0x4,
+    0x28, 0x9f, 0xfc, 0xd3, 0x0, 0x8e, 0x40, 0x3a, 0xff, 0xff, 0xf8, 0x96, 0x1, 0xff, 0xdd, 0x74,
+    0x20, 0xf, 0xfe, 0xa1, 0xda, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xf9, 0xe7, 0x6a, 0x1, 0xff, 0xd4,
+    0x74, 0x20, 0xf, 0xd7, 0xff, 0xff, 0xc4, 0xb0, 0xf, 0xfe, 0x18, 0xa2, 0x7f, 0xf3, 0x4c, 0x2,
+    0x39, 0x0, 0x9a, 0xef, 0xff, 0x9b, 0x0, 0x14, 0x31, 0x80, 0x7f, 0xf5, 0x14, 0x3c, 0x40, 0x3f,
+    0xfa, 0x52, 0x20, 0x7f, 0x97, 0x7f, 0xfd, 0xe, 0x60, 0x0,
+
+    /* U+F242 "" */
+    0x1, 0x34, 0x4f, 0xfe, 0x80, 0x80, 0x47, 0xf9, 0x77, 0xff, 0xd0, 0xe6, 0x0, 0x78, 0x80, 0x7f,
+    0xf4, 0xa4, 0x40, 0xc0, 0x3f, 0xfa, 0x8a, 0x1, 0x9a, 0xef, 0xff, 0x9b, 0x0, 0x14, 0x30, 0x4,
+    0x28, 0x9f, 0xfc, 0xd3, 0x0, 0x8e, 0x40, 0x3a, 0xff, 0xff, 0xe8, 0x0, 0xff, 0xf1, 0x3a, 0x10,
+    0x7, 0xff, 0x50, 0xed, 0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xfc, 0xf3, 0xb5, 0x0, 0xff, 0xea, 0x3a,
+    0x10, 0x7, 0xeb, 0xff, 0xff, 0xa0, 0x3, 0xff, 0x90, 0x28, 0x9f, 0xfc, 0xd3, 0x0, 0x8e, 0x40,
+    0x26, 0xbb, 0xff, 0xe6, 0xc0, 0x5, 0xc, 0x60, 0x1f, 0xfd, 0x45, 0xf, 0x10, 0xf, 0xfe, 0x94,
+    0x88, 0x1f, 0xe5, 0xdf, 0xff, 0x43, 0x98, 0x0,
+
+    /* U+F243 "" */
+    0x1, 0x34, 0x4f, 0xfe, 0x80, 0x80, 0x47, 0xf9, 0x77, 0xff, 0xd0, 0xe6, 0x0, 0x78, 0x80, 0x7f,
+    0xf4, 0xa4, 0x40, 0xc0, 0x3f, 0xfa, 0x8a, 0x1, 0x9a, 0xef, 0xff, 0x9b, 0x0, 0x14, 0x30, 0x4,
+    0x28, 0x9f, 0xfc, 0xd3, 0x0, 0x8e, 0x40, 0x3a, 0xff, 0xfc, 0x80, 0x1f, 0xfe, 0x77, 0x42, 0x0,
+    0xff, 0xea, 0x1d, 0xa8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0x9e, 0x76, 0xa0, 0x1f, 0xfd, 0x47, 0x42,
+    0x0, 0xfd, 0x7f, 0xfe, 0x40, 0xf, 0xfe, 0x68, 0xa2, 0x7f, 0xf3, 0x4c, 0x2, 0x39, 0x0, 0x9a,
+    0xef, 0xff, 0x9b, 0x0, 0x14, 0x31, 0x80, 0x7f, 0xf5, 0x14, 0x3c, 0x40, 0x3f, 0xfa, 0x52, 0x20,
+    0x7f, 0x97, 0x7f, 0xfd, 0xe, 0x60, 0x0,
+
+    /* U+F244 "" */
+    0x1, 0x34, 0x4f, 0xfe, 0x80, 0x80, 0x47, 0xf9, 0x77, 0xff, 0xd0, 0xe6, 0x0, 0x78, 0x80, 0x7f,
+    0xf4, 0xa4, 0x40, 0xc0, 0x3f, 0xfa, 0x8a, 0x1, 0x9a, 0xef, 0xff, 0x9b, 0x0, 0x14, 0x30, 0x4,
+    0x28, 0x9f, 0xfc, 0xd3, 0x0, 0x8e, 0x40, 0x3f, 0xfe, 0x8e, 0x84, 0x1, 0xff, 0xd4, 0x3b, 0x50,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0x3c, 0xed, 0x40, 0x3f, 0xfa, 0x8e, 0x84, 0x1, 0xff, 0xdd, 0x14,
+    0x4f, 0xfe, 0x69, 0x80, 0x47, 0x20, 0x13, 0x5d, 0xff, 0xf3, 0x60, 0x2, 0x86, 0x30, 0xf, 0xfe,
+    0xa2, 0x87, 0x88, 0x7, 0xff, 0x4a, 0x44, 0xf, 0xf2, 0xef, 0xff, 0xa1, 0xcc, 0x0,
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 121, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 120, .box_w = 4, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 37, .adv_w = 175, .box_w = 9, .box_h = 8, .ofs_x = 1, .ofs_y = 12},
+    {.bitmap_index = 66, .adv_w = 315, .box_w = 19, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 208, .adv_w = 278, .box_w = 16, .box_h = 27, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 359, .adv_w = 378, .box_w = 22, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 546, .adv_w = 307, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 699, .adv_w = 94, .box_w = 4, .box_h = 8, .ofs_x = 1, .ofs_y = 12},
+    {.bitmap_index = 712, .adv_w = 151, .box_w = 7, .box_h = 27, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 797, .adv_w = 151, .box_w = 6, .box_h = 27, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 877, .adv_w = 179, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 10},
+    {.bitmap_index = 930, .adv_w = 261, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 968, .adv_w = 102, .box_w = 4, .box_h = 8, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 985, .adv_w = 172, .box_w = 9, .box_h = 3, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 994, .adv_w = 102, .box_w = 4, .box_h = 4, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1003, .adv_w = 158, .box_w = 12, .box_h = 27, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 1107, .adv_w = 299, .box_w = 17, .box_h = 21, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1252, .adv_w = 166, .box_w = 8, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1269, .adv_w = 257, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1382, .adv_w = 256, .box_w = 15, .box_h = 21, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1499, .adv_w = 300, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1599, .adv_w = 257, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1721, .adv_w = 276, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1865, .adv_w = 268, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1964, .adv_w = 289, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2110, .adv_w = 276, .box_w = 16, .box_h = 21, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 2254, .adv_w = 102, .box_w = 4, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2275, .adv_w = 102, .box_w = 4, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 2304, .adv_w = 261, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 2376, .adv_w = 261, .box_w = 14, .box_h = 10, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 2403, .adv_w = 261, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 2474, .adv_w = 257, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2576, .adv_w = 463, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 2858, .adv_w = 328, .box_w = 21, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3001, .adv_w = 339, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3121, .adv_w = 324, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3261, .adv_w = 370, .box_w = 20, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3378, .adv_w = 300, .box_w = 16, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3431, .adv_w = 284, .box_w = 15, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3476, .adv_w = 346, .box_w = 19, .box_h = 21, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 3619, .adv_w = 364, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3661, .adv_w = 139, .box_w = 4, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3669, .adv_w = 230, .box_w = 13, .box_h = 21, .ofs_x = -1, .ofs_y = -1},
+    {.bitmap_index = 3729, .adv_w = 322, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3847, .adv_w = 266, .box_w = 15, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3877, .adv_w = 428, .box_w = 22, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4009, .adv_w = 364, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4115, .adv_w = 376, .box_w = 22, .box_h = 21, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4289, .adv_w = 323, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4382, .adv_w = 376, .box_w = 22, .box_h = 24, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 4580, .adv_w = 326, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4693, .adv_w = 278, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 4831, .adv_w = 263, .box_w = 17, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4863, .adv_w = 354, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4946, .adv_w = 319, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5090, .adv_w = 504, .box_w = 30, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5325, .adv_w = 302, .box_w = 19, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5470, .adv_w = 290, .box_w = 19, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5572, .adv_w = 294, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5672, .adv_w = 149, .box_w = 7, .box_h = 27, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 5698, .adv_w = 158, .box_w = 12, .box_h = 27, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 5800, .adv_w = 149, .box_w = 7, .box_h = 27, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 5826, .adv_w = 261, .box_w = 13, .box_h = 12, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 5890, .adv_w = 224, .box_w = 14, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 5897, .adv_w = 269, .box_w = 8, .box_h = 4, .ofs_x = 3, .ofs_y = 17},
+    {.bitmap_index = 5913, .adv_w = 268, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6007, .adv_w = 306, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6115, .adv_w = 256, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6204, .adv_w = 306, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6314, .adv_w = 274, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6408, .adv_w = 158, .box_w = 11, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6464, .adv_w = 309, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 6612, .adv_w = 305, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6674, .adv_w = 125, .box_w = 4, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6695, .adv_w = 127, .box_w = 9, .box_h = 28, .ofs_x = -3, .ofs_y = -6},
+    {.bitmap_index = 6753, .adv_w = 276, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6841, .adv_w = 125, .box_w = 4, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6849, .adv_w = 474, .box_w = 26, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6946, .adv_w = 305, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7002, .adv_w = 284, .box_w = 16, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7107, .adv_w = 306, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 7220, .adv_w = 306, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 7333, .adv_w = 184, .box_w = 9, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7364, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7459, .adv_w = 185, .box_w = 11, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7514, .adv_w = 303, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7574, .adv_w = 250, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7668, .adv_w = 403, .box_w = 25, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7825, .adv_w = 247, .box_w = 15, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7921, .adv_w = 250, .box_w = 17, .box_h = 21, .ofs_x = -1, .ofs_y = -6},
+    {.bitmap_index = 8053, .adv_w = 233, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8119, .adv_w = 157, .box_w = 9, .box_h = 27, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 8188, .adv_w = 134, .box_w = 4, .box_h = 27, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 8201, .adv_w = 157, .box_w = 9, .box_h = 27, .ofs_x = 0, .ofs_y = -6},
+    {.bitmap_index = 8266, .adv_w = 261, .box_w = 14, .box_h = 6, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 8307, .adv_w = 121, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8307, .adv_w = 120, .box_w = 4, .box_h = 20, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 8344, .adv_w = 256, .box_w = 14, .box_h = 23, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 8452, .adv_w = 289, .box_w = 18, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8553, .adv_w = 314, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8694, .adv_w = 317, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8827, .adv_w = 134, .box_w = 4, .box_h = 27, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 8849, .adv_w = 224, .box_w = 14, .box_h = 23, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8993, .adv_w = 269, .box_w = 9, .box_h = 4, .ofs_x = 4, .ofs_y = 17},
+    {.bitmap_index = 9012, .adv_w = 359, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9195, .adv_w = 181, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 11},
+    {.bitmap_index = 9241, .adv_w = 226, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 9307, .adv_w = 261, .box_w = 14, .box_h = 8, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 9326, .adv_w = 172, .box_w = 9, .box_h = 3, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 9335, .adv_w = 359, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9511, .adv_w = 269, .box_w = 10, .box_h = 2, .ofs_x = 3, .ofs_y = 18},
+    {.bitmap_index = 9517, .adv_w = 188, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 10},
+    {.bitmap_index = 9566, .adv_w = 261, .box_w = 14, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9619, .adv_w = 193, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 9},
+    {.bitmap_index = 9672, .adv_w = 193, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 9},
+    {.bitmap_index = 9727, .adv_w = 269, .box_w = 8, .box_h = 4, .ofs_x = 6, .ofs_y = 17},
+    {.bitmap_index = 9743, .adv_w = 306, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 9807, .adv_w = 290, .box_w = 16, .box_h = 24, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9873, .adv_w = 120, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 9886, .adv_w = 269, .box_w = 7, .box_h = 8, .ofs_x = 5, .ofs_y = -7},
+    {.bitmap_index = 9913, .adv_w = 193, .box_w = 9, .box_h = 12, .ofs_x = 2, .ofs_y = 9},
+    {.bitmap_index = 9935, .adv_w = 187, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 11},
+    {.bitmap_index = 9988, .adv_w = 226, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 10055, .adv_w = 463, .box_w = 27, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10226, .adv_w = 463, .box_w = 26, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10391, .adv_w = 463, .box_w = 29, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10600, .adv_w = 257, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 10701, .adv_w = 328, .box_w = 21, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10872, .adv_w = 328, .box_w = 21, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11043, .adv_w = 328, .box_w = 21, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11220, .adv_w = 328, .box_w = 21, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11398, .adv_w = 328, .box_w = 21, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11576, .adv_w = 328, .box_w = 21, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11768, .adv_w = 469, .box_w = 28, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11909, .adv_w = 324, .box_w = 18, .box_h = 27, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 12081, .adv_w = 300, .box_w = 16, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12158, .adv_w = 300, .box_w = 16, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12236, .adv_w = 300, .box_w = 16, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12319, .adv_w = 300, .box_w = 16, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12404, .adv_w = 139, .box_w = 8, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 12436, .adv_w = 139, .box_w = 8, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12467, .adv_w = 139, .box_w = 11, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 12510, .adv_w = 139, .box_w = 9, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12549, .adv_w = 374, .box_w = 22, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12686, .adv_w = 364, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12826, .adv_w = 376, .box_w = 22, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 13028, .adv_w = 376, .box_w = 22, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 13232, .adv_w = 376, .box_w = 22, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 13441, .adv_w = 376, .box_w = 22, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 13652, .adv_w = 376, .box_w = 22, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 13863, .adv_w = 261, .box_w = 11, .box_h = 11, .ofs_x = 3, .ofs_y = 4},
+    {.bitmap_index = 13921, .adv_w = 376, .box_w = 22, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 14137, .adv_w = 354, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14248, .adv_w = 354, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14357, .adv_w = 354, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14472, .adv_w = 354, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14588, .adv_w = 290, .box_w = 19, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14718, .adv_w = 323, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14822, .adv_w = 303, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14947, .adv_w = 268, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15064, .adv_w = 268, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15182, .adv_w = 268, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15306, .adv_w = 268, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15432, .adv_w = 268, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15557, .adv_w = 268, .box_w = 14, .box_h = 23, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15690, .adv_w = 443, .box_w = 26, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15859, .adv_w = 256, .box_w = 14, .box_h = 22, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 15982, .adv_w = 274, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16101, .adv_w = 274, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16220, .adv_w = 274, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16345, .adv_w = 274, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16470, .adv_w = 125, .box_w = 7, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 16501, .adv_w = 125, .box_w = 7, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 16531, .adv_w = 125, .box_w = 9, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 16568, .adv_w = 125, .box_w = 8, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16603, .adv_w = 287, .box_w = 16, .box_h = 22, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 16761, .adv_w = 305, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 16851, .adv_w = 284, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16981, .adv_w = 284, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 17110, .adv_w = 284, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 17246, .adv_w = 284, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 17384, .adv_w = 284, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 17521, .adv_w = 261, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 17576, .adv_w = 284, .box_w = 16, .box_h = 19, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 17714, .adv_w = 303, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17801, .adv_w = 303, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17888, .adv_w = 303, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17981, .adv_w = 303, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 18074, .adv_w = 250, .box_w = 17, .box_h = 27, .ofs_x = -1, .ofs_y = -6},
+    {.bitmap_index = 18233, .adv_w = 306, .box_w = 16, .box_h = 27, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 18353, .adv_w = 250, .box_w = 17, .box_h = 27, .ofs_x = -1, .ofs_y = -6},
+    {.bitmap_index = 18518, .adv_w = 224, .box_w = 14, .box_h = 3, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 18528, .adv_w = 448, .box_w = 28, .box_h = 3, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 18538, .adv_w = 102, .box_w = 4, .box_h = 8, .ofs_x = 1, .ofs_y = 13},
+    {.bitmap_index = 18555, .adv_w = 102, .box_w = 4, .box_h = 8, .ofs_x = 1, .ofs_y = 13},
+    {.bitmap_index = 18571, .adv_w = 186, .box_w = 10, .box_h = 8, .ofs_x = 1, .ofs_y = 13},
+    {.bitmap_index = 18611, .adv_w = 186, .box_w = 10, .box_h = 8, .ofs_x = 1, .ofs_y = 13},
+    {.bitmap_index = 18651, .adv_w = 141, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 18669, .adv_w = 310, .box_w = 17, .box_h = 4, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 18704, .adv_w = 362, .box_w = 22, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 18865, .adv_w = 308, .box_w = 20, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 19020, .adv_w = 448, .box_w = 26, .box_h = 27, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 19227, .adv_w = 280, .box_w = 15, .box_h = 25, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 19364, .adv_w = 560, .box_w = 35, .box_h = 29, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 19704, .adv_w = 392, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 19846, .adv_w = 336, .box_w = 21, .box_h = 29, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 19929, .adv_w = 560, .box_w = 35, .box_h = 25, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 20188, .adv_w = 560, .box_w = 35, .box_h = 19, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 20292, .adv_w = 560, .box_w = 35, .box_h = 19, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 20398, .adv_w = 560, .box_w = 35, .box_h = 19, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 20502, .adv_w = 560, .box_w = 35, .box_h = 19, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 20605, .adv_w = 560, .box_w = 35, .box_h = 19, .ofs_x = 0, .ofs_y = 1}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_2[] = {
+    0x0, 0x1, 0x5, 0x6, 0x9, 0xa, 0xf, 0x13,
+    0x99, 0xcffa, 0xd000, 0xd040, 0xd05d, 0xd0b4, 0xd148, 0xd1d8,
+    0xd22d, 0xd22e, 0xd22f, 0xd230, 0xd231
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 160, .range_length = 96, .glyph_id_start = 96,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 8211, .range_length = 53810, .glyph_id_start = 192,
+        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 21, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17, 18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27, 28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37, 37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50, 51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58, 58, 59, 58, 60, 41, 0, 0, 9,
+    0, 61, 47, 62, 63, 64, 0, 65, 0, 22, 8, 66, 0, 9, 22, 0,
+    67, 0, 0, 0, 0, 51, 29, 9, 0, 0, 8, 9, 0, 0, 0, 68,
+    23, 23, 23, 23, 23, 23, 26, 25, 26, 26, 26, 26, 29, 29, 29, 29,
+    22, 29, 22, 22, 22, 22, 22, 0, 22, 30, 30, 30, 30, 39, 69, 46,
+    45, 45, 45, 45, 45, 45, 49, 47, 49, 49, 49, 49, 51, 51, 70, 51,
+    71, 45, 46, 46, 46, 46, 46, 9, 46, 51, 51, 51, 51, 58, 46, 58,
+    0, 0, 72, 73, 72, 73, 9, 10, 25, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5, 2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12, 18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25, 23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29, 29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0, 39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46, 46, 47, 48, 49, 0, 0, 35, 9,
+    0, 50, 39, 51, 52, 53, 0, 54, 0, 23, 8, 9, 9, 9, 23, 0,
+    55, 0, 0, 0, 0, 42, 56, 9, 0, 0, 8, 57, 0, 0, 0, 58,
+    24, 24, 24, 24, 24, 24, 24, 23, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 23, 23, 23, 23, 23, 0, 23, 28, 28, 28, 28, 31, 25, 38,
+    37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 39, 39, 59, 42, 60, 61,
+    62, 42, 39, 39, 39, 39, 39, 9, 39, 45, 45, 45, 45, 46, 38, 46,
+    0, 0, 63, 64, 63, 64, 9, 10, 52, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 1, 0, 0, 0, 0, 0, 3, 0, 1, 0, 0, 4, 0, 0, 0,
+    0, 3, 0, 0, 0, 0, 0, 0, 0, 10, 9, 0, 4, 0, 9, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 20, 0, 12, -10, 0, 0, 9, 0, -25, -27, 3, 21, 10, 8, -18,
+    3, 22, 1, 19, 4, 14, 0, -19, 0, 0, 4, 0, 0, 0, 0, 0,
+    0, 27, 4, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -9, 9, 0, 9, 21, 0, -19, 0, 0, 0, 0, 0, 0,
+    0, -13, 0, 0, 0, 0, 0, -9, 8, 9, 0, 0, -4, 0, -3, 4,
+    0, -4, 0, -4, -2, -9, 0, 0, 0, 0, -4, 0, 0, -6, -7, 0,
+    0, -4, 0, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4,
+    0, -1, 0, 0, 0, 0, -7, 0, 0, -4, 0, 0, 0, 0, -11, -4,
+    0, -12, 0, -54, 0, 0, -9, -22, 9, 13, 0, 0, -9, 4, 4, 15,
+    9, -8, 9, 0, 0, -26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -17, 0, 0, 5, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -12, 0, 0, 0, 0, 0, 0, 10, -9, -9,
+    -5, -22, 0, -18, -3, 0, 0, -13, 0, 1, 17, 0, -13, -4, -1, 1,
+    0, -8, 0, 0, -3, -33, 0, 5, 0, 14, -12, 0, -9, 0, -18, 5,
+    0, -36, -4, 17, 4, 0, 0, 0, 0, 0, 0, 4, 0, -6, -1, -6,
+    0, -4, 0, 0, 0, 0, -18, -20, 0, -1, 0, 0, 0, 0, -14, -12,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 4, 0, 0, -9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0,
+    0, 17, 4, 1, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -17, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 9, 4, 13, -4, 0, 0, 9, -4, -15, -61, 3, 12, 9, 1, -6,
+    0, 16, 0, 14, 0, 14, 0, -42, 0, -5, 13, 0, 15, -4, 9, 4,
+    0, 0, 1, -4, 0, 0, -8, 36, 0, 36, 0, 13, 0, 19, 6, 19,
+    8, 0, 0, 3, 0, 0, 13, 17, 6, -37, 36, 36, 36, -8, 13, 13,
+    0, 0, -8, -17, 0, 0, 0, -4, 1, -3, 0, 3, -8, -6, -9, 3,
+    0, -4, 0, 0, 0, -18, 3, -8, 0, -9, -15, 0, -10, -8, -14, 0,
+    0, -29, 0, 0, 0, 0, 4, 0, 0, 0, 0, 4, 0, -6, -10, -6,
+    -6, 0, 0, 3, -10, 4, 0, -39, -4, 0, 0, 0, 0, 4, 0, 0,
+    1, -25, 4, -28, 0, 0, 0, -15, -3, 0, 44, -5, -6, 4, 4, -4,
+    0, -6, 4, 0, 0, -24, -9, 15, 0, 26, -14, -4, -17, 0, -17, 8,
+    0, -43, 0, 4, 4, 0, -5, 0, 4, 0, 0, -3, -5, -15, 0, -15,
+    0, 1, 0, -4, -13, 0, -28, -58, 1, 4, 0, 0, 0, -5, -8, -8,
+    0, 27, -9, 0, -17, 0, 15, 0, -30, -43, -30, -9, 13, 0, 0, -30,
+    0, 5, -10, 0, -7, 0, -9, -18, 0, -4, 13, 0, 13, 0, 13, 0,
+    0, 12, 13, -55, -30, 0, -30, 4, 1, -30, -30, -12, -30, -13, -26, -13,
+    -30, -29, -4, 0, 18, -9, 21, 0, -22, -34, -30, -30, -30, -21, 22, 23,
+    0, 3, 0, 0, 0, 0, 0, 3, 3, -5, -9, 0, -1, -1, -4, 0,
+    0, -3, 0, 0, 0, -9, 0, -4, 0, -10, -9, 0, -11, -15, -15, -9,
+    0, -9, 0, -9, 0, 0, 0, 0, -4, 0, 0, 4, 0, 3, -4, 3,
+    0, 0, 0, 0, -5, 0, 1, 0, 0, -13, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, -3, 0, 0, 0, -3, 4, 4, -1, 0, 0, 0, -9,
+    0, -1, 0, 0, 0, 0, 0, 1, 0, 6, -3, 0, -5, 0, -8, 0,
+    0, -3, 0, 13, 0, 0, -4, 0, 0, 0, 0, 0, -1, 1, -3, 1,
+    -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0,
+    0, -4, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0,
+    -4, -5, 0, 0, 0, 0, 0, 1, 0, 0, -3, 0, -4, -4, -4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -3, -6, -3,
+    0, 0, 0, 0, 0, 0, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -13, -3, -13, 9, 0, 0, -9, 4, 9, 12, 0, -11, -1, -5, 0,
+    -1, -21, 4, -3, 3, -24, 4, 0, 0, 1, -23, 0, -24, -4, -39, -3,
+    0, -22, 0, 9, 13, 0, 6, 0, 0, 0, 0, 1, 0, -8, -6, -8,
+    0, 0, 4, 4, -4, 9, -13, -8, 0, 4, 0, 0, 0, 6, -10, -4,
+    0, 0, 0, -4, 0, 0, 0, -4, 0, 0, 0, 0, 0, -2, -2, 0,
+    -2, -6, 0, 0, 0, 0, 0, 0, 0, -4, -4, 0, -3, -5, -4, 0,
+    0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4,
+    0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, -9, 4, 0, 0, -5, 2, 4, 4, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, 0, 0, 3, 0, 0, -4, 0, -4, -3, -5, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, -4, 0, 0, 0, 0, -5, -7, -5,
+    0, 0, 0, 4, 0, 9, -9, 0, 0, 0, 0, 0, 0, 4, -4, 0,
+    0, 13, -3, 1, -14, 0, 0, 12, -22, -23, -19, -9, 4, 0, -4, -29,
+    -8, 0, -8, 0, -9, 7, -8, -29, 0, -12, 0, 0, 2, -1, 4, -3,
+    0, 4, 0, -13, -17, 0, -22, -11, -9, -11, -13, -5, -12, -1, -9, -1,
+    -12, -12, -6, -9, 6, -4, 3, 12, -8, -28, -11, -11, -11, -22, 4, 9,
+    0, 1, 0, -4, 0, 0, 0, 3, 0, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -4, 0, -2, 0, -1, -4, 0, -8, -10, -10, -1,
+    0, -13, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 2, -3, 2,
+    0, 0, 0, 0, -4, 4, 0, 0, 0, -9, 0, 0, 0, 0, -2, 0,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, 0, -4, 0, 4, 0, 17, -4, 0, -10, -3, -17, 0,
+    0, -8, 0, 4, 0, 0, 0, 0, 0, 0, 0, 4, 0, 3, -4, 3,
+    0, 0, 0, 0, -18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -3, 0, 0, 0, -9, 0, 0, 5, 0, -22, -13, 0, 0, 0, -7, -22,
+    0, 0, -4, 4, 0, -12, -1, -19, 0, -13, 0, 0, -6, -8, -6, -4,
+    -7, 0, 0, -9, 0, 0, -4, 0, 0, 0, 0, 0, 0, 4, 0, 4,
+    0, -3, 0, 0, -7, 0, 4, 0, 4, -48, 0, 0, 0, -4, 10, 10,
+    0, -8, 0, 0, 0, 0, 5, 0, 3, -9, -9, 0, -4, -4, -5, 0,
+    0, 0, 0, 0, 0, -13, 0, -4, 0, -7, -4, 0, -10, -11, -13, -4,
+    0, -9, 0, -13, 0, 0, 0, 0, 36, 0, 0, 2, 0, 0, -6, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, -9, 0, 0, 0, 0, -5, -7,
+    0, -19, 0, 0, 0, 0, 0, -42, -8, 15, 13, -4, -19, 0, 4, -7,
+    0, -22, -2, -6, 4, -31, -4, 6, 0, 7, -16, -7, -17, -15, -19, 0,
+    0, -27, 0, 26, 0, 0, -2, 0, 0, 0, -2, -2, -4, -12, -15, -12,
+    -1, 4, 0, 0, 0, 0, -42, -36, 5, 9, 0, 0, 0, -2, -15, -15,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -2, -4, -7, 0,
+    0, -9, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -1,
+    0, 0, -1, 0, -9, 0, 0, 9, -1, 6, 0, -10, 4, -3, -1, -12,
+    -4, 0, -6, -4, -3, 0, -7, -8, 0, 0, -4, -1, -3, -8, -5, 0,
+    0, -4, 0, 4, -3, 0, -10, 0, 0, 0, -9, 0, -8, 0, -8, 0,
+    -8, -4, 0, 0, 0, -3, 4, 3, -1, -5, 0, 0, 0, -10, 1, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, -9, 4, 0, -6, 0, -3, -5, -14,
+    -3, -3, -3, -1, -3, -5, -1, 0, 0, 0, 0, 0, -4, -4, -4, 0,
+    0, 0, 0, 5, -3, 0, -3, 0, 0, 0, -3, -5, -3, -4, -5, -4,
+    -4, -3, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0,
+    4, 18, -1, 0, -12, 0, -3, 9, 0, -4, -19, -6, 7, 0, 0, -21,
+    -8, 4, -8, 3, 0, -3, -4, -14, 0, -7, 2, 0, 0, -8, 0, 0,
+    0, 4, 4, -9, -9, 0, -8, -4, -7, -4, -4, 0, -8, 2, -9, 2,
+    -8, -4, 0, 0, 0, -3, 13, 4, -6, -21, -4, 5, 2, -8, 8, 12,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -7, 0, 0, -6, 0, 0, -4, -4, 0,
+    0, 0, 0, -4, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, -7, 0, -9, 0, 0, 0, -15, 0, 3, -10, 9, 1, -3, -21,
+    0, 0, -10, -4, 0, -18, -11, -13, 0, 0, -19, -4, -18, -17, -22, 0,
+    -12, 0, 4, 30, -6, 0, -10, -4, -1, -4, -8, -12, -8, -17, -18, -17,
+    -10, 0, 0, 0, 0, 0, -4, -4, -1, 0, -4, -4, -4, -10, -8, 0,
+    0, 0, -3, 0, 1, 0, 0, -31, -4, 13, 10, -10, -17, 0, 1, -14,
+    0, -22, -3, -4, 9, -41, -6, 1, 0, 0, -29, -5, -23, -4, -33, 0,
+    0, -31, 0, 26, 1, 0, -3, 0, 0, 0, 0, -2, -3, -17, -3, -17,
+    0, 0, 0, 0, 0, 0, -29, -35, 3, 0, 0, 0, 0, -3, -19, -21,
+    0, 0, 0, 0, -14, 0, -4, 0, -1, -13, -21, 0, 0, -2, -7, -13,
+    -4, 0, -3, 0, 0, 0, 0, -20, -4, -15, -14, -4, -8, -11, -4, -8,
+    0, -9, -4, -15, -7, 0, -5, -9, -4, -9, 0, 2, 0, -3, -15, -3,
+    0, 0, 0, 0, 0, 0, 9, 0, 0, -23, -9, -9, -9, -5, 0, 4,
+    0, -8, 0, 0, 0, 0, 5, 0, 3, -9, 18, 0, -4, -4, -5, 0,
+    0, 0, 0, 0, 0, -13, 0, -4, 0, -7, -4, 0, -10, -11, -13, -4,
+    0, -9, 4, 18, 0, 0, 0, 0, 36, 0, 0, 2, 0, 0, -6, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, -9, 0, 0, 0, 0, -5, -7,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -3, -9,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, -4, -4, 0, 0, -9, -4, 0,
+    0, -9, 0, 8, -2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 0, 0, -4, 0, 0, 0, 0, 2, 0,
+    9, 4, -4, 0, -14, -7, 0, 13, -15, -14, -9, -9, 18, 8, 4, -39,
+    -3, 9, -4, 0, -4, 5, -4, -16, 0, -4, 4, -6, -4, -13, -4, 0,
+    0, 13, 9, 0, -13, 0, -25, -6, 13, -6, -17, 1, -6, -15, -15, -15,
+    -4, -9, 0, 0, 0, 0, 18, 13, -6, -26, 5, 15, 8, -25, 12, 12,
+    4, 0, -7, 0, -12, 0, 4, 15, -10, -17, -18, -11, 13, 0, 1, -33,
+    -4, 4, -8, -3, -10, 0, -10, -17, -7, -7, -4, 0, 0, -10, -9, -4,
+    0, 13, 10, -4, -25, 0, -25, -6, 0, -16, -26, -1, -14, -8, -15, -8,
+    -13, -13, 0, 0, 0, 0, 12, 10, -6, -32, 8, 16, 9, -25, 9, 14,
+    0, 0, -6, 0, -9, -4, 0, -4, -8, 0, 8, -15, 4, 0, 0, -24,
+    0, -4, -10, -8, -3, -13, -11, -15, -10, 0, -13, -4, -10, -9, -13, -4,
+    0, 0, 1, 21, -8, 0, -13, -4, 0, -4, -9, -10, -12, -13, -17, -13,
+    -6, -4, 0, 0, 0, 0, -9, 0, -4, 1, -4, -4, -4, -13, 0, 3,
+    9, 0, -7, 0, -22, -5, 3, 9, -14, -17, -9, -15, 15, -4, 2, -42,
+    -8, 9, -10, -8, -17, 0, -13, -19, -5, -4, -4, -4, -9, -13, -1, 0,
+    0, 13, 13, -3, -29, 0, -27, -10, 11, -17, -30, -9, -16, -19, -22, -19,
+    -15, -18, 0, 0, 0, -9, 9, 10, -8, -37, 15, 13, 11, -27, 5, 12,
+    0, 0, 0, 0, -5, 0, 0, 4, -5, 9, 3, -9, 9, 0, 0, -14,
+    -1, 0, -1, 0, 1, 1, -4, 0, 0, 0, 0, 0, 0, -4, 0, 0,
+    0, 0, 4, 13, 1, 0, -5, 0, 0, 0, 0, -3, -3, -5, 0, -5,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0,
+    1, 4, 0, 0, 0, 0, 4, 1, -4, 0, 17, 0, 8, 1, 1, -6,
+    0, 9, 0, 0, 0, 4, 0, 0, 0, 0, 9, 0, 10, 1, 13, 0,
+    0, 13, 0, 13, -4, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 6, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -27, 0, -4, 8, 0, 13, -61, 0, 44, 5, -9, -9, 4, 4, -3,
+    1, -22, 0, 0, 22, -27, -9, 13, 0, 13, -9, -4, -18, 9, -9, 0,
+    0, -30, 17, 63, 0, 0, 0, 0, 54, 0, 0, 0, 0, 9, 0, 9,
+    0, 18, 0, 0, 0, 13, -27, -13, 4, 13, 0, 0, 0, 0, -23, -23,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -7, 0, 0, -9, -4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 9, -12, 0, 0, 1, -4, 0, 4, 58, -9, -4, 14, 12, -12,
+    4, 0, 0, 4, 4, -6, -13, 26, 13, 37, 0, -4, -4, 21, -3, 9,
+    0, -58, 13, 0, -4, 0, -12, 0, 48, 0, 4, -9, -12, -6, 17, 9,
+    12, 5, 8, -3, -4, 12, 0, -32, 4, 0, 0, 0, 0, -12, 0, 0,
+    0, 0, 0, -13, 0, 0, 0, -12, 0, 0, 0, 0, -10, -2, 0, 0,
+    0, -10, 0, -5, 0, -21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -30, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -4, 0, -4,
+    0, 0, 0, 0, 0, 0, -9, -10, 0, 0, 0, 0, 0, 1, -5, -3,
+    0, -7, 0, -12, 0, 0, 0, -8, 4, -5, 0, 0, -12, -4, -10, 0,
+    0, -12, 0, -4, 0, -21, 0, -5, 0, 0, -36, -9, -18, -5, -16, 0,
+    0, -30, 0, -12, -2, 0, 0, 0, 0, 0, 0, 0, 0, -7, -8, -7,
+    -4, 0, 0, 0, 0, 0, -8, -10, 0, -4, 0, 0, 0, 0, -5, -1,
+    0, 0, 0, 0, -10, 0, -10, 6, -5, 9, 0, -3, -10, -3, -8, -9,
+    0, -5, -2, -3, 3, -12, -1, 0, 0, 0, -39, -4, -6, 0, -10, 0,
+    -3, -21, -4, 0, 0, -3, -4, 0, 0, 0, 0, 3, 0, -3, -8, -3,
+    -3, 0, 0, 0, 0, -4, 8, 0, 0, -3, 0, 0, 0, -4, 8, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -10, 0, -3, 0, 0, 0, -9, 4, 0, 0, 0, -12, -4, -9, 0,
+    0, -13, 0, -4, 0, -21, 0, 0, 0, 0, -43, 0, -9, -17, -22, 0,
+    0, -30, 0, -3, -7, 0, 0, 0, 0, 0, 0, 0, 0, -4, -7, -4,
+    -2, 0, 0, 0, 0, 0, -7, -9, 0, -4, 0, 0, 0, 0, -5, -1,
+    1, 0, 0, 8, -6, 0, 14, 22, -4, -4, -13, 5, 22, 8, 10, -12,
+    5, 19, 5, 13, 10, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 28, 21, -8, -4, 0, -4, 36, 19, 36, 0, 0, 0, 4, 0, 4,
+    0, 0, 0, 0, 0, 0, 17, 19, -1, -6, 30, 22, 27, -4, 22, 32,
+    0, 0, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0,
+    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, -38, -5, -4, -18, -22, 0,
+    0, -30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0,
+    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, -38, -5, -4, -18, -22, 0,
+    0, -18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, 0, 0, 0, -10, 4, 0, -4, 4, 8, 4, -13,
+    0, -1, -4, 4, 0, 4, 0, 0, 0, 0, -11, 0, -4, -3, -9, 0,
+    -4, -18, 0, 28, -4, 0, -10, -3, 0, -3, -8, 0, -4, -13, -9, -13,
+    -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, -3, -10, 1, 0,
+    0, 0, -7, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0,
+    0, 0, 0, 0, 0, 6, 0, 0, 0, 0, -38, -5, -4, -18, -22, 0,
+    0, -30, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -7, 0, -14, -5, -4, 13, -4, -4, -18, 1, -3, 1, -3, -12,
+    1, 10, 1, 4, 1, 4, -11, -18, -5, 0, -17, -9, -12, -19, -17, 0,
+    -7, -9, -5, -6, -4, -3, -5, -3, 0, -3, -1, 7, 0, 7, -3, 7,
+    0, 0, 0, 0, 0, 4, 14, 13, 1, -17, -3, -3, -3, -5, 15, 15,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -4, -4, 0,
+    0, -12, 0, -2, 0, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, -4,
+    0, 0, 0, 0, 0, 0, -6, -10, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, 0, 0, -8, -4, 4, 0, -8, -9, -3, 0, -13,
+    -3, -10, -3, -5, 0, -8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -30, 0, 14, 0, 0, -8, 0, 0, 0, 0, -6, 0, -4, 0, -4,
+    0, 0, 0, 0, 0, -4, -2, -9, 0, 0, 0, 0, 0, -8, -3, 0,
+    0, 0, -3, 0, -10, 0, 0, 19, -6, -15, -14, 3, 5, 5, -1, -13,
+    3, 7, 3, 13, 3, 15, -3, -12, 0, 0, -18, 0, 0, -13, -12, 0,
+    0, -9, 0, -6, -8, 0, -7, 0, -7, 0, -3, 7, 0, -4, -13, -4,
+    -4, 0, 0, 0, 0, 0, 17, 13, 0, -15, 0, 0, 0, -7, 15, 8,
+    0, 0, -4, 0, -9, 0, 0, 6, -10, 0, 4, -4, 4, 0, 0, -15,
+    0, -3, -1, 0, -4, 5, -4, 0, 0, 0, -18, -5, -10, 0, -13, 0,
+    0, -21, 0, 17, -4, 0, -8, 0, 3, 0, -4, 0, -4, -13, 0, -13,
+    -4, 0, 0, 0, 0, 0, 4, 1, 0, 0, 0, 0, 0, -8, 0, 0,
+    0, 0, 0, 0, -3, 0, 0, 4, -6, 1, 0, 0, -5, -3, 0, -5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -28, 0, 10, 0, 0, -4, 0, 0, 0, 0, 1, 0, -4, -4, -4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 18, 0, -9, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 4, 0, 4, -9, 0, -13, -4, -18, 0,
+    0, -25, 1, 5, 0, 0, 0, 0, 30, 0, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, -4, 0, -17, 0, 0, 12, -13, -1, 5, -17, 8, -4, -4, -15,
+    -6, 3, -15, -9, -13, 0, -6, -20, 0, -9, 0, 0, 0, -4, 4, 0,
+    0, 8, 1, 8, -18, 0, -13, -9, -11, -9, -18, -9, -12, -9, -11, -9,
+    -18, -11, 0, 0, 0, -4, 0, 5, -6, -10, -9, 13, 4, -13, -1, 1,
+    0, 0, 0, 0, 0, 0, 0, 3, 3, -4, 0, 0, 0, -4, 0, 0,
+    0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0,
+    5, 9, 0, 0, 0, 0, 6, 0, -10, -13, -13, -5, 13, 0, 4, -4,
+    0, 12, -4, 0, -18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 22, 6, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -9, 0, 0, 0, 0, 0, 0, 0, -18, 0, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 10, 0, 0, 0, 0, 8,
+    0, 3, 4, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 6, -4, 1, 4, 0, -1, 0, 0, 3,
+    3, 0, 0, 0, 0, -4, 0, 5, 0, 13, -6, 0, -6, -4, -8, 0,
+    0, -26, 0, 4, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+    0, 9, 9, 10, 0, 0, 0, 13, 0, -28, -26, 1, 19, 13, 8, -18,
+    3, 19, 0, 17, 0, 9, 4, -42, 0, -4, 18, 0, 12, -9, 9, 0,
+    0, 24, 0, 0, 0, 0, -8, 0, 0, 0, -1, 9, 0, 17, 4, 17,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -28, 0, 0, 0, -8, 0, 0,
+    -1, -15, 0, -27, -8, 0, 0, -37, -18, 1, 18, -22, -19, 0, 0, -19,
+    0, -19, -19, 0, -1, -60, -24, 6, 0, 0, -26, -16, -30, 4, -35, 0,
+    0, -42, 4, 22, -8, 0, -15, -5, 31, -5, -3, -5, -22, -22, 4, -10,
+    0, 0, 4, -9, -22, 1, -26, -39, -4, -12, -5, -5, -5, -15, -10, -9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -10, -13, 0, -9, -11, -9, 0,
+    -4, 0, 0, 0, 0, -13, 0, -13, 0, -18, -11, 0, -4, -13, -13, -8,
+    0, -18, 0, -13, -4, 0, 0, 0, -4, 0, 0, 2, 0, 0, -4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -11, 0, 0, 0, 0, 0, 0,
+    0, 0, -7, 0, 0, 0, 0, 36, 0, 0, 0, 0, -3, 0, 0, 0,
+    0, 0, 0, 0, 0, 18, 0, 0, 0, 0, -38, -5, -4, -18, -22, 0,
+    0, -30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 0, -8, 0, 3, 0, 0, -3, 0,
+    0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, 0, -9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 0, 0, -3, 0, 0, 0, 0, 0, 4,
+    1, 0, 4, 18, -5, 0, 0, 13, 0, -8, -23, 0, 17, 5, 9, -17,
+    0, 19, -2, 14, 0, 17, 0, -15, 0, -1, 12, 0, 9, 0, 5, 0,
+    0, 23, 0, 0, -3, 0, -5, 13, 0, 13, 0, 8, 0, 15, 0, 15,
+    0, 1, 0, 0, 0, 4, 0, 17, 0, -13, 13, 13, 13, -5, 13, 13,
+    1, 0, 4, 18, -5, 0, 0, 13, 0, -8, -23, 0, 21, 9, 8, -26,
+    0, 12, 0, 4, 0, 17, 0, -15, 0, -1, 12, 0, 14, 3, 12, 0,
+    0, 23, 0, 0, -4, 0, -12, 0, 0, 0, -8, 1, 0, 8, 0, 8,
+    0, 1, 0, 0, 4, 4, 0, 17, 0, -13, 0, 0, 0, -12, 13, 13
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 73,
+    .right_class_cnt     = 64,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 3,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = LV_FONT_FMT_TXT_COMPRESSED,
+    .cache = &cache
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t lv_font_montserrat_28 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 30,          /*The maximum line height required by the font*/
+    .base_line = 5,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -2,
+    .underline_thickness = 1,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
@@ -0,0 +1,567 @@
+/*******************************************************************************
+ * Size: 36 px
+ * Bpp: 4
+ * Charset: digits, 33 glyphs
+ * Generated by tools/fonts/gen_fonts.py from Montserrat-Medium.ttf and FontAwesome5-Solid+Brands+Regular.woff. Do not edit.
+ ******************************************************************************/
+
+#include "lvgl.h"
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0025 "%" */
+    0x0, 0xc4, 0xac, 0x80, 0x1f, 0xfc, 0x12, 0x33, 0x0, 0x78, 0xaf, 0x6a, 0x6f, 0x54, 0x3, 0xfc,
+    0x59, 0x89, 0x0, 0xe2, 0xf4, 0x4, 0x52, 0x25, 0x30, 0x7, 0xf4, 0x88, 0xac, 0x3, 0xa0, 0x87,
+    0x2e, 0xb5, 0x82, 0x8, 0x3, 0xe7, 0x40, 0xb1, 0x0, 0xc4, 0xa1, 0x66, 0x1, 0x49, 0xd, 0x0,
+    0x78, 0xa0, 0x15, 0x40, 0x1c, 0xa0, 0x2a, 0x1, 0xca, 0x8, 0x1, 0xee, 0x2, 0xb0, 0xf, 0x70,
+    0x28, 0x7, 0xb4, 0x8, 0x3, 0xa0, 0xc2, 0x44, 0x3, 0xc6, 0x2, 0x1, 0xe1, 0x1, 0x0, 0xc6,
+    0xe0, 0xc8, 0x1, 0xf1, 0x80, 0x80, 0x78, 0x40, 0x40, 0x37, 0x1, 0x40, 0x7, 0xef, 0x5, 0x0,
+    0xf6, 0x81, 0x0, 0x50, 0x41, 0x22, 0x1, 0xf9, 0x0, 0x54, 0x3, 0xa, 0x85, 0x80, 0x11, 0xc1,
+    0xd0, 0x3, 0xf8, 0x94, 0x2d, 0x0, 0x3, 0x64, 0x2c, 0x3, 0x20, 0x70, 0x1, 0xff, 0x59, 0xd,
+    0xe5, 0xfa, 0x85, 0x88, 0x41, 0x7, 0x80, 0x48, 0xee, 0x51, 0x0, 0xc3, 0x8a, 0x6, 0x82, 0x76,
+    0xa0, 0x8c, 0x10, 0x60, 0x7b, 0x71, 0xa, 0xf6, 0x0, 0xc3, 0x5d, 0x76, 0xdc, 0x40, 0x19, 0x3,
+    0x70, 0x3d, 0x21, 0x66, 0x18, 0xcb, 0x80, 0x70, 0xa2, 0x8, 0x2, 0xb2, 0x1e, 0x0, 0x78, 0x9f,
+    0xcc, 0xb1, 0x82, 0x8, 0x3, 0xfc, 0xaa, 0x9, 0x20, 0x33, 0x7, 0x88, 0x5, 0x24, 0x14, 0x1,
+    0xfc, 0x36, 0x8, 0xe0, 0x4, 0x2, 0x30, 0xe, 0x50, 0x40, 0xf, 0xeb, 0x11, 0x48, 0x5, 0xc0,
+    0xe0, 0x1e, 0xe0, 0x20, 0xf, 0xcc, 0xa1, 0x4, 0x1, 0x18, 0x7, 0xe3, 0x1, 0x0, 0xf8, 0xa0,
+    0x11, 0x80, 0x31, 0x80, 0x80, 0x78, 0xc0, 0x40, 0x3e, 0x91, 0x14, 0x80, 0x77, 0x82, 0x80, 0x7b,
+    0x1, 0x40, 0x3c, 0xc8, 0x16, 0x40, 0x1c, 0x80, 0x2a, 0x1, 0x89, 0x3, 0x40, 0x38, 0xa0, 0x15,
+    0x40, 0x1e, 0x26, 0xb, 0x50, 0x1, 0x70, 0x93, 0x80, 0x77, 0x8, 0xac, 0x3, 0xf4, 0x20, 0xd7,
+    0x6e, 0x8c, 0x78, 0x40, 0x33, 0x98, 0x50, 0x80, 0x7e, 0x1b, 0x93, 0x3, 0x27, 0xf3, 0x0,
+
+    /* U+002B "+" */
+    0x0, 0xf9, 0xde, 0x0, 0xff, 0xe0, 0x8c, 0x44, 0x1, 0xff, 0xff, 0x0, 0xff, 0xe2, 0xcf, 0xff,
+    0x70, 0x5, 0xff, 0xe8, 0x0, 0xff, 0xe2, 0xf1, 0x17, 0x80, 0x22, 0x2f, 0x7b, 0xee, 0xf6, 0x0,
+    0x5b, 0xbe, 0x70, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x10, 0x6e, 0xe0, 0xf, 0x80,
+
+    /* U+002C "," */
+    0x2, 0x9a, 0x40, 0x1f, 0x65, 0xb2, 0x28, 0x2, 0x41, 0x0, 0xe2, 0x80, 0x9, 0x1, 0xc8, 0x10,
+    0x80, 0x88, 0x1a, 0x0, 0x40, 0x3, 0x80, 0x30, 0x10, 0x40, 0x8, 0x1a, 0x1, 0x66, 0xb0, 0x0,
+
+    /* U+002D "-" */
+    0x56, 0x6f, 0xc9, 0x73, 0x3f, 0xbc, 0x3, 0xfc, 0xec, 0xdf, 0xb0,
+
+    /* U+002E "." */
+    0x2, 0x9a, 0x40, 0x1c, 0x65, 0xb2, 0x51, 0x0, 0x91, 0xc0, 0x31, 0x9a, 0x4, 0x4c, 0xa0,
+
+    /* U+0030 "0" */
+    0x0, 0xfc, 0x4a, 0xee, 0x52, 0x0, 0xff, 0xe1, 0x36, 0xea, 0xa2, 0x15, 0xba, 0x60, 0xf, 0xf0,
+    0xdc, 0x90, 0x7, 0x8a, 0x70, 0x40, 0x3e, 0x1c, 0x40, 0x8, 0x4c, 0xc2, 0x1, 0x1e, 0x8, 0x7,
+    0xa8, 0x80, 0x7, 0x7d, 0x98, 0xeb, 0x30, 0x1, 0x50, 0x7, 0x32, 0x0, 0x13, 0x50, 0x3, 0x26,
+    0x20, 0x1, 0x18, 0x3, 0x58, 0x0, 0x68, 0x40, 0x3e, 0xa1, 0x0, 0x40, 0x4, 0xa4, 0x0, 0x81,
+    0x0, 0xfc, 0x30, 0x0, 0x15, 0x0, 0x78, 0x4, 0xe0, 0x1f, 0xe7, 0x0, 0xbc, 0x0, 0xe0, 0x4,
+    0x10, 0xf, 0xf0, 0xa0, 0x1, 0xc0, 0x48, 0x0, 0x60, 0x1f, 0xf8, 0xc0, 0x4, 0x26, 0x1, 0x70,
+    0x7, 0xfe, 0xe0, 0x8, 0x84, 0x3, 0xff, 0x88, 0x60, 0x19, 0xc0, 0x23, 0x0, 0xff, 0xe2, 0x3b,
+    0x80, 0x23, 0x0, 0xff, 0xc6, 0x1, 0x38, 0x80, 0x42, 0x1, 0xff, 0xc4, 0x12, 0x0, 0xb8, 0x3,
+    0xff, 0x78, 0x4, 0x60, 0x60, 0x5, 0x0, 0xff, 0xca, 0x0, 0x21, 0x5, 0x0, 0x19, 0x0, 0x7f,
+    0x88, 0xc0, 0x8, 0x0, 0xa0, 0xa, 0x80, 0x3f, 0xd4, 0x1, 0x68, 0x0, 0xcc, 0x0, 0x62, 0x0,
+    0xfc, 0x4c, 0x0, 0x34, 0x0, 0xa0, 0x0, 0x3e, 0x40, 0x1e, 0x2f, 0x10, 0x4, 0x0, 0x64, 0x60,
+    0x1, 0x63, 0x90, 0x0, 0x9f, 0x8, 0x0, 0xc8, 0x1, 0xd2, 0x80, 0x1, 0x8d, 0xfe, 0xd8, 0x10,
+    0x2, 0x48, 0x7, 0xd6, 0xc0, 0x1c, 0x20, 0x19, 0xac, 0x3, 0xfa, 0x75, 0xcc, 0x40, 0x2, 0x6f,
+    0xb2, 0x1, 0xff, 0x14, 0x67, 0x7f, 0x73, 0x20, 0x80, 0x3c,
+
+    /* U+0031 "1" */
+    0x23, 0x3f, 0xc5, 0x39, 0x9f, 0xa8, 0x3, 0xfc, 0x23, 0xe0, 0xd, 0x5d, 0xdc, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xff, 0x80, 0x7f, 0xfd, 0x0,
+
+    /* U+0032 "2" */
+    0x0, 0xf1, 0x2b, 0x3b, 0x94, 0xc0, 0x3f, 0xc3, 0x1b, 0xaa, 0x98, 0x85, 0x67, 0x40, 0x80, 0x79,
+    0xfd, 0xc8, 0x3, 0xe1, 0x7c, 0x30, 0xd, 0x50, 0x20, 0x11, 0x1a, 0x18, 0x80, 0x45, 0xa4, 0x0,
+    0x34, 0x0, 0xb, 0xee, 0xb2, 0xf3, 0xa8, 0x80, 0x3, 0x0, 0x3, 0xd1, 0x2c, 0x82, 0x0, 0xe5,
+    0xf1, 0x0, 0x28, 0x80, 0xf, 0x30, 0x40, 0x1f, 0x8a, 0x40, 0x25, 0x0, 0x88, 0x40, 0x3f, 0xc6,
+    0x1, 0x8, 0x7, 0xff, 0xc, 0x40, 0x21, 0x0, 0xff, 0xe1, 0xe8, 0x4, 0xc0, 0x1f, 0xfc, 0x35,
+    0x0, 0x19, 0x0, 0x7f, 0xf0, 0xa0, 0x80, 0x14, 0x1, 0xff, 0xc2, 0x57, 0x0, 0x1b, 0x0, 0x7f,
+    0xf0, 0x52, 0x80, 0x3, 0xc0, 0x1f, 0xfc, 0x15, 0xb0, 0x0, 0xe9, 0x0, 0x7f, 0xe5, 0xa0, 0x0,
+    0xe9, 0x80, 0x7f, 0xe6, 0xa0, 0x0, 0xe9, 0x80, 0x7f, 0xe6, 0x90, 0x0, 0xe9, 0x80, 0x7f, 0xe7,
+    0x90, 0x1, 0x61, 0x80, 0x7f, 0xe7, 0x80, 0x1, 0x79, 0x0, 0x7f, 0xe8, 0x80, 0x0, 0xbc, 0x80,
+    0x3f, 0xf4, 0x38, 0x0, 0xbc, 0x80, 0x3f, 0xf4, 0xb8, 0x0, 0xb8, 0x8, 0xbf, 0xc2, 0x10, 0xc0,
+    0x11, 0x66, 0xef, 0xfc, 0xc0, 0x40, 0x1f, 0xfd, 0xa0,
+
+    /* U+0033 "3" */
+    0x2, 0x33, 0xff, 0xe2, 0x0, 0x23, 0x33, 0xff, 0x87, 0xa0, 0x1f, 0xfc, 0x93, 0x11, 0xff, 0x80,
+    0x32, 0x80, 0x27, 0xbb, 0xfd, 0x84, 0x0, 0x2a, 0x0, 0xff, 0xe0, 0xf1, 0x0, 0xf0, 0x80, 0x7f,
+    0xe9, 0x30, 0x5, 0x98, 0x7, 0xfe, 0x76, 0x0, 0x3a, 0x80, 0x7f, 0xe4, 0x80, 0x2, 0x40, 0x7,
+    0xfe, 0x2a, 0x0, 0x15, 0x0, 0x7f, 0xe1, 0xf1, 0x1, 0xf1, 0x0, 0xff, 0xd6, 0x40, 0x2, 0x53,
+    0x0, 0xff, 0xce, 0x1, 0x1c, 0x66, 0xb0, 0x7, 0xff, 0x14, 0xa6, 0xc4, 0x3, 0xf7, 0x65, 0xd4,
+    0x20, 0x4, 0x96, 0x1, 0xf8, 0xcc, 0x8a, 0xf7, 0x82, 0x0, 0x54, 0x0, 0xff, 0xe0, 0x9e, 0x80,
+    0x5c, 0x1, 0xff, 0xc2, 0x33, 0x0, 0x1c, 0x3, 0xff, 0x86, 0xc0, 0x3, 0x0, 0xff, 0xe1, 0x88,
+    0x0, 0xc0, 0xc8, 0x3, 0xfe, 0x24, 0x0, 0x30, 0x7e, 0x38, 0x80, 0x7e, 0x19, 0x0, 0xb5, 0x8c,
+    0x63, 0xe1, 0x4, 0x2, 0x26, 0xc4, 0x0, 0x1b, 0x0, 0x61, 0x7b, 0xef, 0xef, 0xd9, 0x20, 0x0,
+    0xf0, 0x36, 0x20, 0x7, 0x84, 0x3, 0x8f, 0x8, 0x0, 0x77, 0x8e, 0xa4, 0x20, 0x10, 0x9b, 0x5e,
+    0x10, 0x7, 0x1c, 0x56, 0xf7, 0xf7, 0xf6, 0x4a, 0x0, 0x60,
+
+    /* U+0034 "4" */
+    0x0, 0xff, 0xe0, 0x91, 0x9c, 0x1, 0xff, 0xc6, 0x4d, 0xcc, 0x50, 0x7, 0xff, 0x14, 0xa8, 0x0,
+    0x72, 0x1, 0xff, 0xc4, 0x1e, 0x10, 0x1e, 0x0, 0xff, 0xe2, 0xd9, 0x80, 0x28, 0x80, 0x3f, 0xf8,
+    0x8c, 0xa0, 0x8, 0x40, 0xf, 0xfe, 0x21, 0xc8, 0x1, 0x1c, 0x3, 0xff, 0x88, 0x3c, 0x0, 0x2a,
+    0x0, 0xff, 0xe2, 0xd1, 0x0, 0x38, 0x40, 0x3f, 0xf8, 0x90, 0x80, 0x9, 0x30, 0xf, 0xfe, 0x22,
+    0xb8, 0x1, 0x98, 0x1, 0xff, 0xc4, 0x2b, 0x0, 0x1c, 0x0, 0x66, 0xbb, 0x50, 0x7, 0xe1, 0xf1,
+    0x1, 0xe1, 0x0, 0xdc, 0x88, 0x70, 0xf, 0xd6, 0x40, 0xa, 0x20, 0xf, 0xfe, 0x23, 0xa8, 0x1,
+    0xd0, 0x3, 0xff, 0x88, 0x90, 0x0, 0x48, 0x0, 0xff, 0xe2, 0x15, 0x0, 0x5c, 0x89, 0xf8, 0x80,
+    0x6, 0x89, 0x8e, 0xc4, 0x2, 0xab, 0xbf, 0xca, 0x0, 0x1b, 0xbd, 0x20, 0x1f, 0xfc, 0xb1, 0x33,
+    0xff, 0xe0, 0x88, 0x4, 0x67, 0x8a, 0x33, 0x3f, 0xf8, 0x2e, 0x0, 0x2c, 0xcd, 0x0, 0x1f, 0xff,
+    0xf0, 0xf, 0xfe, 0xe0,
+
+    /* U+0035 "5" */
+    0x0, 0x84, 0xcf, 0xff, 0x84, 0x1, 0xcb, 0x99, 0xff, 0xc2, 0x0, 0xe2, 0x0, 0xff, 0xe3, 0x88,
+    0x4, 0x23, 0xff, 0x0, 0x77, 0x0, 0x13, 0xbb, 0xfe, 0x0, 0xe3, 0x0, 0x8, 0x7, 0xff, 0x11,
+    0x80, 0x4, 0x1, 0xff, 0xc4, 0x10, 0x7, 0x80, 0x7f, 0xf1, 0x8, 0x0, 0x40, 0x1f, 0xfc, 0x31,
+    0x0, 0x84, 0x3, 0xff, 0x86, 0x40, 0x18, 0x8a, 0x10, 0xf, 0xf9, 0x80, 0x2b, 0xdd, 0xbb, 0xf6,
+    0x94, 0x40, 0x3c, 0x60, 0x1f, 0xc4, 0xb5, 0xea, 0x1, 0xc2, 0x1, 0xff, 0x86, 0x9c, 0x3, 0x3f,
+    0xff, 0xdb, 0x70, 0x40, 0x14, 0x20, 0x7, 0xfc, 0x48, 0xfa, 0xe0, 0x14, 0x0, 0x7f, 0xf0, 0xe1,
+    0x0, 0x6, 0x40, 0x1f, 0xfc, 0x3e, 0x0, 0x9c, 0x3, 0xff, 0x86, 0xc0, 0x11, 0x80, 0x7f, 0xf0,
+    0xd8, 0x2, 0x30, 0x2, 0x80, 0x7f, 0xef, 0x0, 0x9c, 0x1a, 0xac, 0x80, 0x3f, 0x99, 0x40, 0x6,
+    0x43, 0x0, 0x9b, 0x6c, 0x40, 0x10, 0xad, 0xc8, 0x5, 0x0, 0x66, 0x0, 0x92, 0x77, 0xfb, 0xfa,
+    0x90, 0x2, 0x74, 0x2, 0xc7, 0x10, 0xe, 0x10, 0xe, 0x19, 0x80, 0x8, 0x63, 0xe5, 0x8c, 0x40,
+    0x31, 0x24, 0x7b, 0x0, 0x78, 0x5a, 0x73, 0xbf, 0xb9, 0xfb, 0x6e, 0x20, 0x18,
+
+    /* U+0036 "6" */
+    0x0, 0xfe, 0x25, 0x67, 0x73, 0x18, 0x7, 0xfc, 0x2f, 0xba, 0xa9, 0x88, 0x4e, 0x75, 0x18, 0x7,
+    0xcb, 0xf0, 0x40, 0x1f, 0xa, 0xc8, 0x7, 0xa2, 0x84, 0x2, 0x24, 0x65, 0x41, 0x0, 0x48, 0x7,
+    0x33, 0x80, 0x4d, 0xba, 0xb9, 0xab, 0xeb, 0x73, 0x0, 0xc5, 0x20, 0x1, 0xb9, 0x20, 0xf, 0x24,
+    0x0, 0x74, 0x80, 0x54, 0x80, 0x1f, 0xfc, 0x22, 0x40, 0x3, 0xa0, 0x7, 0xff, 0xe, 0x80, 0x2a,
+    0x0, 0xff, 0xe2, 0x20, 0x0, 0xc8, 0x3, 0xff, 0x88, 0x60, 0x4, 0x0, 0xc2, 0x68, 0x82, 0x0,
+    0xf8, 0x80, 0x2e, 0x1, 0x7c, 0xec, 0xbb, 0x6f, 0x49, 0x0, 0x61, 0x0, 0xc9, 0xf0, 0x60, 0x1c,
+    0x2d, 0xac, 0x1, 0x38, 0x5, 0xf6, 0x20, 0x3, 0x55, 0x18, 0x6, 0x97, 0x0, 0x38, 0x4, 0xc0,
+    0x6, 0xec, 0xaa, 0x67, 0x38, 0x5, 0x6, 0x2, 0x1, 0xd3, 0x21, 0x0, 0xc3, 0x14, 0x1, 0x48,
+    0x18, 0x6, 0x46, 0x0, 0xfc, 0xaa, 0x0, 0x28, 0x8c, 0x1, 0x70, 0x7, 0xfb, 0x0, 0x22, 0x4,
+    0x0, 0x98, 0x3, 0xfc, 0x40, 0x1d, 0x80, 0x13, 0x0, 0x7f, 0x88, 0x2, 0x10, 0x71, 0x0, 0x78,
+    0x7, 0xfb, 0x40, 0x2, 0x40, 0x2c, 0x0, 0x56, 0x0, 0xfc, 0xa8, 0x0, 0x70, 0xa, 0xc, 0x1,
+    0x32, 0x20, 0xc, 0x31, 0x40, 0x1, 0xb0, 0xd, 0xc4, 0x0, 0x6d, 0xca, 0xa5, 0xf3, 0x80, 0x54,
+    0x40, 0x18, 0xb1, 0x80, 0x23, 0x55, 0x20, 0x4, 0x56, 0x80, 0x1e, 0x19, 0xd8, 0x41, 0x0, 0x89,
+    0x67, 0x10, 0x3, 0xf8, 0x9e, 0xfb, 0xfb, 0xf6, 0x98, 0x40, 0x30,
+
+    /* U+0037 "7" */
+    0x33, 0xff, 0xe3, 0x86, 0xe6, 0x7f, 0xf1, 0x84, 0x3, 0xff, 0x98, 0x23, 0xff, 0x0, 0x42, 0x20,
+    0x9, 0xfb, 0xbf, 0xda, 0x1, 0x30, 0x7, 0xff, 0xe, 0x40, 0x2a, 0x0, 0xff, 0xe1, 0x12, 0x80,
+    0x18, 0x80, 0x3f, 0xf8, 0x54, 0x1, 0x50, 0x2, 0x26, 0x56, 0x1, 0xf8, 0x58, 0x0, 0x86, 0x0,
+    0x66, 0x8c, 0x3, 0xf3, 0x8, 0x3, 0xc0, 0x3f, 0xf8, 0x74, 0x0, 0x24, 0x0, 0xff, 0xe1, 0x29,
+    0x0, 0x2c, 0x3, 0xff, 0x87, 0x20, 0x1, 0x60, 0xf, 0xfe, 0x12, 0x18, 0x2, 0x40, 0x3f, 0xf8,
+    0x7e, 0x0, 0x16, 0x0, 0xff, 0xe1, 0x1a, 0x0, 0x1c, 0x40, 0x3f, 0xf8, 0x54, 0x1, 0x58, 0x7,
+    0xff, 0x8, 0x98, 0x0, 0x84, 0x1, 0xff, 0xc2, 0xa0, 0xb, 0xc0, 0x3f, 0xf8, 0x42, 0xc0, 0x3,
+    0x40, 0xf, 0xfe, 0x13, 0x88, 0x2, 0x40, 0x3f, 0xf8, 0x76, 0x0, 0x25, 0x0, 0xff, 0xe1, 0x29,
+    0x0, 0x28, 0x3, 0xff, 0x87, 0x20, 0x1, 0x60, 0xf, 0xfe, 0x12, 0x18, 0x1, 0xc4, 0x3, 0xff,
+    0x85, 0xc0, 0x15, 0x80, 0x7f, 0x80,
+
+    /* U+0038 "8" */
+    0x0, 0xf8, 0x95, 0x9d, 0xca, 0x60, 0x1f, 0xf0, 0xc6, 0xea, 0xa6, 0x21, 0x59, 0xd2, 0x40, 0x1f,
+    0x27, 0xb9, 0x0, 0x7c, 0x2d, 0x8c, 0x1, 0xc7, 0x42, 0x0, 0x15, 0x78, 0x75, 0x10, 0x0, 0xca,
+    0x80, 0x6f, 0x10, 0x3, 0x7d, 0x43, 0xc5, 0x74, 0x0, 0x56, 0x20, 0x3, 0x30, 0x1, 0x64, 0x40,
+    0x3c, 0xf0, 0x0, 0x17, 0x0, 0x20, 0x5, 0x20, 0x1f, 0xce, 0x20, 0xf, 0x0, 0xf1, 0x0, 0x7f,
+    0x8c, 0x0, 0x60, 0x1, 0x0, 0x88, 0x3, 0xfc, 0x60, 0x3, 0x0, 0x20, 0x5, 0x20, 0x1f, 0xce,
+    0x20, 0xc, 0x0, 0x13, 0x0, 0x16, 0x44, 0x3, 0x85, 0xe0, 0x0, 0x6a, 0x1, 0x42, 0x0, 0x1b,
+    0xee, 0x1e, 0x2b, 0xe0, 0x0, 0x5a, 0x1, 0x86, 0xdc, 0x0, 0x28, 0xf0, 0xea, 0x20, 0x6, 0xc1,
+    0x0, 0xe7, 0x60, 0xf, 0xf9, 0xe4, 0x3, 0xaa, 0x4, 0x0, 0x91, 0x57, 0x50, 0xa2, 0x2, 0xf8,
+    0x20, 0x7, 0x50, 0x1, 0xed, 0xba, 0xa2, 0xbd, 0x62, 0x80, 0xe, 0xc0, 0x12, 0x0, 0x2d, 0x20,
+    0xf, 0x8a, 0x90, 0x0, 0xa4, 0x82, 0x0, 0xb1, 0x0, 0xff, 0x40, 0x4, 0xa4, 0x1, 0x28, 0x7,
+    0xfc, 0x40, 0x17, 0x98, 0x4, 0xe0, 0x1f, 0xf1, 0x80, 0x66, 0x0, 0xb4, 0x3, 0xfe, 0x40, 0xb,
+    0x8c, 0x80, 0xc, 0x80, 0x1f, 0xc7, 0x0, 0x12, 0x5, 0x80, 0x57, 0x2, 0x1, 0xc2, 0xfa, 0x20,
+    0x7, 0x20, 0x66, 0x0, 0x4f, 0xd9, 0x75, 0x4c, 0xe8, 0x10, 0x2, 0x40, 0x5, 0x32, 0x10, 0x8,
+    0xd1, 0x54, 0x60, 0x19, 0xec, 0x3, 0x9b, 0xe5, 0x48, 0x3, 0x89, 0x23, 0x60, 0x3, 0xe1, 0x6a,
+    0xdf, 0xf7, 0x73, 0xf6, 0xdc, 0x80, 0x30,
+
+    /* U+0039 "9" */
+    0x0, 0xf1, 0xb3, 0xb9, 0x8c, 0x3, 0xfe, 0x18, 0xec, 0x98, 0x84, 0xe7, 0x49, 0x0, 0x7c, 0x9e,
+    0xe2, 0x1, 0xe1, 0x6c, 0x60, 0xe, 0x3b, 0x10, 0x1, 0x34, 0x41, 0x8c, 0x0, 0x32, 0xc0, 0x10,
+    0xf0, 0x5, 0x1b, 0x2e, 0xe9, 0xcb, 0x20, 0x4, 0x98, 0x1, 0xc8, 0x1, 0x2e, 0x1, 0xe4, 0xc2,
+    0x0, 0x70, 0x3, 0x40, 0x4, 0xc0, 0x1f, 0x86, 0x0, 0x4, 0x80, 0xa0, 0x4, 0x0, 0xff, 0x20,
+    0x5, 0xc0, 0x20, 0x1, 0x0, 0xff, 0x8, 0x4, 0x80, 0x20, 0x2, 0x0, 0xff, 0x10, 0x4, 0x24,
+    0xa0, 0x4, 0x10, 0xf, 0xea, 0x0, 0xcf, 0xa0, 0x1, 0xa0, 0xf, 0xca, 0xe0, 0x18, 0xd8, 0xc0,
+    0x9, 0x8a, 0x20, 0x11, 0xd5, 0x0, 0x38, 0x43, 0x84, 0x0, 0x75, 0xdb, 0xae, 0xc5, 0x0, 0x48,
+    0x7, 0x16, 0x18, 0x6, 0x22, 0x8, 0x0, 0xad, 0x40, 0x21, 0x0, 0x16, 0x5a, 0x90, 0x4, 0x2b,
+    0x38, 0x80, 0x18, 0xc0, 0x32, 0x56, 0xff, 0x7f, 0x53, 0x8, 0x28, 0x4, 0xe0, 0x1f, 0x84, 0x3,
+    0xde, 0x0, 0x12, 0x0, 0xff, 0xe1, 0xb, 0x80, 0x10, 0x3, 0xff, 0x86, 0xc2, 0x0, 0xe0, 0xf,
+    0xfe, 0x11, 0xc0, 0x0, 0xd0, 0x3, 0xff, 0x82, 0x9a, 0x1, 0x78, 0x6, 0x89, 0x30, 0xe, 0x4a,
+    0xb1, 0x0, 0x41, 0x80, 0x42, 0xcc, 0xcf, 0xdc, 0xdf, 0xb5, 0x0, 0x9d, 0xc0, 0x19, 0x84, 0x2,
+    0x23, 0x20, 0xc, 0x57, 0x0, 0x1c, 0xf2, 0x82, 0x1, 0x84, 0xda, 0xf5, 0x0, 0x3e, 0x6b, 0xef,
+    0xee, 0x7f, 0x64, 0xa0, 0x7, 0xc0,
+
+    /* U+003A ":" */
+    0x0, 0x11, 0x80, 0x53, 0xb9, 0x60, 0x6c, 0x0, 0x45, 0x70, 0xc, 0x6a, 0x40, 0x1, 0x41, 0xf7,
+    0x6d, 0x20, 0x28, 0x93, 0x0, 0xff, 0xf3, 0x14, 0xd2, 0x0, 0xe3, 0x2d, 0x92, 0x88, 0x4, 0x8e,
+    0x1, 0x8c, 0xd0, 0x22, 0x65,
+
+    /* U+0043 "C" */
+    0x0, 0xff, 0xa, 0x33, 0xb9, 0x90, 0x40, 0x3f, 0xf8, 0x4b, 0x7d, 0x73, 0x10, 0x9b, 0xec, 0x71,
+    0x0, 0xfe, 0x5d, 0xa4, 0x0, 0xfc, 0x71, 0xec, 0x1, 0xf5, 0x50, 0x80, 0x31, 0x1a, 0x18, 0x80,
+    0x43, 0x34, 0x1, 0x86, 0xd4, 0x2, 0x39, 0xed, 0xcb, 0xce, 0xb5, 0x0, 0x95, 0x80, 0x28, 0x40,
+    0x0, 0xce, 0x30, 0x80, 0x72, 0x56, 0x10, 0x3b, 0x0, 0x15, 0x80, 0x3, 0xac, 0x1, 0xfe, 0x3f,
+    0x88, 0x0, 0x50, 0x1, 0x51, 0x80, 0x7f, 0xe2, 0x70, 0x9, 0x48, 0x0, 0xc8, 0x1, 0xff, 0xc6,
+    0xf0, 0xa, 0xc0, 0x3f, 0xf8, 0xe8, 0x0, 0x42, 0x0, 0xff, 0xe3, 0x10, 0x80, 0xc, 0x3, 0xff,
+    0x8e, 0x20, 0x17, 0x0, 0x7f, 0xf1, 0xdc, 0x2, 0x30, 0xf, 0xfe, 0x3b, 0x80, 0x46, 0x1, 0xff,
+    0xc7, 0x20, 0xb, 0x80, 0x3f, 0xf8, 0xe2, 0x40, 0x4, 0x0, 0xff, 0xe4, 0x20, 0x0, 0xcc, 0x1,
+    0xff, 0xc7, 0xd0, 0xa, 0x0, 0x3f, 0xf8, 0xe8, 0x60, 0x4, 0x60, 0xf, 0xfe, 0x3f, 0x80, 0x52,
+    0xc0, 0x1f, 0xf9, 0x28, 0x40, 0x23, 0x80, 0xa, 0x64, 0x20, 0x1f, 0xcf, 0x6b, 0x42, 0x1, 0x3b,
+    0x80, 0x26, 0xf9, 0x41, 0x0, 0x9, 0xbe, 0xc0, 0x1, 0x1c, 0x3, 0x44, 0x0, 0x21, 0x6b, 0xef,
+    0xee, 0x64, 0x10, 0x5, 0x2c, 0x1, 0xcf, 0xa8, 0x1, 0xe1, 0x0, 0xe4, 0xc6, 0x0, 0xf8, 0xaf,
+    0x61, 0x48, 0x3, 0x12, 0x3d, 0xd8, 0xc0, 0x3f, 0xc4, 0xf5, 0xbf, 0xdc, 0xfd, 0xb8, 0x40, 0xc,
+
+    /* U+0046 "F" */
+    0x13, 0x3f, 0xfe, 0x29, 0x13, 0x33, 0xff, 0x8b, 0x40, 0x1f, 0xfc, 0xb1, 0x1f, 0xfe, 0x10, 0x7,
+    0x47, 0x77, 0xff, 0x6, 0x0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0x2e, 0x44, 0xff, 0xc0, 0x1e, 0x7b,
+    0xbf, 0xfc, 0x1, 0xff, 0xcd, 0x23, 0x3f, 0xfc, 0x1, 0xeb, 0xcc, 0xff, 0xc0, 0x1f, 0xff, 0xf0,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0x2c,
+
+    /* U+00B0 "°" */
+    0x0, 0xc2, 0x8c, 0x82, 0x1, 0xf4, 0x7d, 0xcd, 0xf4, 0x88, 0x6, 0xc7, 0x5, 0x75, 0x16, 0xd1,
+    0x0, 0x41, 0x9b, 0x2a, 0x2b, 0xcc, 0xd6, 0x2, 0xc1, 0xc4, 0x1, 0xf, 0x2, 0x92, 0x8a, 0x10,
+    0x7, 0x12, 0x3, 0x88, 0x8, 0x7, 0xc4, 0x6, 0x20, 0xc0, 0x1f, 0x10, 0x1a, 0x89, 0x98, 0x3,
+    0x8d, 0x1, 0x6, 0x43, 0x50, 0x2, 0x3e, 0x7, 0x10, 0x75, 0x1b, 0xca, 0xcc, 0x12, 0x40, 0x5,
+    0x50, 0x46, 0xa6, 0x31, 0x60, 0x1c, 0xfb, 0xab, 0xde, 0x70, 0x8,
+
+    /* U+00E3 "ã" */
+    0x0, 0xe3, 0x77, 0x10, 0x6, 0x24, 0x20, 0xf, 0x2e, 0x44, 0x35, 0xc0, 0x2b, 0xb2, 0x80, 0x70,
+    0xd8, 0x1a, 0x4, 0x51, 0xab, 0x82, 0x0, 0x73, 0x8a, 0x65, 0xd8, 0x57, 0x28, 0x50, 0xc0, 0x38,
+    0x4b, 0x40, 0x9, 0xea, 0x2, 0xb4, 0x1, 0xe7, 0xd6, 0x0, 0x86, 0xbf, 0xa8, 0x40, 0x3f, 0xfa,
+    0x4, 0x68, 0x62, 0x1, 0xfc, 0x2f, 0x9f, 0xb9, 0x79, 0xd8, 0xe2, 0x1, 0x86, 0x3a, 0xc, 0x3,
+    0xc7, 0x18, 0x40, 0x13, 0x38, 0x6, 0x24, 0x31, 0x0, 0x8b, 0xc4, 0x0, 0xc4, 0x9, 0x5d, 0xb7,
+    0x9d, 0x86, 0x0, 0x28, 0x0, 0xc, 0x5d, 0x94, 0x40, 0x31, 0xe9, 0x0, 0x1c, 0x2, 0x54, 0x0,
+    0xfc, 0x36, 0x0, 0x13, 0x0, 0xff, 0xe0, 0xa0, 0x4, 0xc0, 0x1f, 0xfc, 0x13, 0x0, 0x8c, 0x2,
+    0x16, 0xad, 0xef, 0xfe, 0xe0, 0xf, 0x27, 0xca, 0x90, 0x80, 0x7f, 0xc7, 0x62, 0x0, 0x36, 0x77,
+    0xf0, 0x7, 0x40, 0x0, 0x73, 0x13, 0x11, 0xd2, 0x1, 0x85, 0x0, 0x10, 0x60, 0x1f, 0xf8, 0xc0,
+    0x22, 0x0, 0xfc, 0xa0, 0x18, 0xc0, 0x23, 0x0, 0xf8, 0x60, 0x3, 0x9, 0x80, 0x24, 0xc0, 0x38,
+    0xf4, 0xc0, 0x3a, 0x40, 0x3, 0x97, 0xf, 0x17, 0x86, 0x22, 0x0, 0xcb, 0x22, 0x0, 0x47, 0x87,
+    0x40, 0x1a, 0x30, 0xe, 0x6c, 0x84, 0x20, 0x11, 0x23, 0xfa, 0x0, 0x60,
+
+    /* U+F00D "" */
+    0x0, 0x3e, 0x59, 0x0, 0x7f, 0xf0, 0x53, 0x30, 0x80, 0x14, 0x40, 0xd3, 0xc, 0x3, 0xfe, 0x5b,
+    0x33, 0x5a, 0x83, 0xb8, 0x2, 0x1d, 0x30, 0xf, 0xe5, 0xa0, 0xd, 0x49, 0x20, 0x1c, 0x3a, 0x60,
+    0x1f, 0x2d, 0x0, 0x7b, 0x8c, 0x3, 0xc3, 0xa6, 0x1, 0xcb, 0x40, 0x1f, 0x1c, 0x0, 0x7c, 0x3a,
+    0x60, 0x12, 0xd0, 0x7, 0xc3, 0x6b, 0x40, 0x1f, 0xe, 0x98, 0x2d, 0x0, 0x7c, 0x3a, 0x40, 0xb4,
+    0x1, 0xf0, 0xeb, 0xd0, 0x7, 0xc3, 0xa6, 0x1, 0x2d, 0x0, 0x7c, 0x30, 0x1, 0xf0, 0xe9, 0x80,
+    0x72, 0xd0, 0x7, 0xff, 0x8, 0x74, 0xc0, 0x3e, 0x5a, 0x0, 0xff, 0xc3, 0xa6, 0x1, 0xfc, 0xb4,
+    0x1, 0xfe, 0x1d, 0x30, 0xf, 0xf9, 0x58, 0x3, 0xfa, 0xcc, 0x3, 0xff, 0x2b, 0x0, 0x7f, 0x59,
+    0x80, 0x7f, 0xcb, 0x40, 0x1f, 0xe1, 0xd3, 0x0, 0xfe, 0x5a, 0x0, 0xff, 0xc3, 0xa6, 0x1, 0xf2,
+    0xd0, 0x7, 0xff, 0x8, 0x74, 0xc0, 0x39, 0x68, 0x3, 0xe1, 0x80, 0xf, 0x87, 0x4c, 0x2, 0x5a,
+    0x0, 0xf8, 0x75, 0xe8, 0x3, 0xe1, 0xd3, 0x5, 0xa0, 0xf, 0x87, 0x4c, 0x16, 0x80, 0x3e, 0x1d,
+    0x28, 0x0, 0xf8, 0x74, 0xc0, 0x25, 0xa0, 0xf, 0x86, 0xcc, 0x3, 0xc3, 0xa6, 0x1, 0xcb, 0x40,
+    0x1f, 0x1c, 0x80, 0x70, 0xe9, 0x80, 0x7c, 0xb4, 0x1, 0xee, 0x77, 0x0, 0x43, 0xa6, 0x1, 0xfc,
+    0xb4, 0x1, 0xa9, 0x2, 0x20, 0x69, 0x86, 0x1, 0xff, 0x2d, 0x99, 0xad, 0x40,
+
+    /* U+F013 "" */
+    0x0, 0xff, 0xc5, 0x17, 0xbb, 0xae, 0x8, 0x3, 0xff, 0x98, 0xae, 0x84, 0x59, 0x1d, 0x40, 0x3f,
+    0xf9, 0x9e, 0x1, 0xfb, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xcc, 0xa0, 0x19, 0x71, 0xc0, 0x3f, 0x3e,
+    0x28, 0x6, 0x57, 0x0, 0xf9, 0xe6, 0xac, 0xc6, 0xa8, 0x60, 0x1f, 0xe3, 0xaa, 0x9, 0xe5, 0x43,
+    0x80, 0x72, 0x40, 0x1, 0x33, 0xd4, 0x3, 0xff, 0x84, 0xbf, 0x86, 0x0, 0x84, 0x0, 0xd2, 0x1,
+    0xc2, 0x1, 0xff, 0xc4, 0x10, 0xe, 0x90, 0x9, 0xc8, 0x3, 0xff, 0xa0, 0x4e, 0x0, 0x90, 0xf,
+    0xfe, 0x94, 0x82, 0x88, 0x7, 0xff, 0x8, 0x44, 0x1, 0xff, 0xc2, 0x15, 0xf0, 0xf, 0xfc, 0x31,
+    0xbd, 0xcd, 0x81, 0x0, 0xff, 0xdf, 0x8, 0x1, 0xfe, 0x1d, 0x72, 0x0, 0x13, 0xe8, 0x80, 0x7f,
+    0x92, 0xa, 0xe8, 0x80, 0x3f, 0x51, 0x80, 0x78, 0xe8, 0x3, 0xf1, 0x55, 0x90, 0x1, 0x60, 0x3,
+    0xe3, 0x40, 0xf, 0xc8, 0x60, 0x1f, 0x42, 0x80, 0x71, 0x80, 0x7d, 0x60, 0x1f, 0xeb, 0x0, 0xf8,
+    0xc0, 0x3c, 0x20, 0x1f, 0x8, 0x7, 0xf8, 0x40, 0x3e, 0x10, 0xf, 0x8, 0x7, 0xc2, 0x1, 0xfe,
+    0x10, 0xf, 0x84, 0x3, 0xc6, 0x1, 0xf5, 0x80, 0x7f, 0xac, 0x3, 0xe3, 0x0, 0xe5, 0x80, 0xf,
+    0x8d, 0x0, 0x3f, 0x21, 0x80, 0x7d, 0xa, 0x0, 0x2b, 0xa2, 0x0, 0xfd, 0x46, 0x1, 0xe3, 0xa0,
+    0xf, 0xc5, 0x56, 0x50, 0x80, 0x1f, 0xe1, 0xd7, 0x20, 0x1, 0x3e, 0x88, 0x7, 0xf9, 0x23, 0xc0,
+    0x3f, 0xf0, 0xc6, 0xf7, 0x36, 0x4, 0x3, 0xff, 0x7a, 0x88, 0x7, 0xff, 0x8, 0x44, 0x1, 0xff,
+    0xc2, 0x15, 0x9, 0x0, 0xff, 0xe9, 0x48, 0x1, 0xc8, 0x3, 0xff, 0xa0, 0x4e, 0x1, 0x48, 0x7,
+    0x8, 0x7, 0xff, 0x10, 0x40, 0x3a, 0x40, 0x32, 0x40, 0x0, 0xf3, 0xd4, 0x3, 0xff, 0x84, 0xbf,
+    0x88, 0x0, 0x84, 0x0, 0xe7, 0x8a, 0xc3, 0x1a, 0xa1, 0x80, 0x7f, 0x8e, 0xa8, 0x27, 0x75, 0xe,
+    0x1, 0xf3, 0xa8, 0x6, 0x5c, 0x70, 0xf, 0xcf, 0x8a, 0x1, 0x95, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xde, 0x1, 0xfb, 0xc0, 0x3f, 0xf9, 0x8a, 0xe8, 0x45, 0x91, 0xd4, 0x3, 0xff,
+
+    /* U+F053 "" */
+    0x0, 0xff, 0xe1, 0xce, 0x28, 0x7, 0xff, 0x12, 0xd8, 0xe9, 0x40, 0x3f, 0xf8, 0x56, 0x80, 0x15,
+    0x20, 0x7, 0xfe, 0xb4, 0x0, 0xec, 0x0, 0xff, 0xad, 0x0, 0x38, 0x6c, 0x3, 0xfd, 0x68, 0x1,
+    0xc3, 0x46, 0x1, 0xfd, 0x68, 0x1, 0xc3, 0x48, 0x1, 0xfd, 0x68, 0x1, 0xc3, 0x48, 0x1, 0xfd,
+    0x68, 0x1, 0xc3, 0x48, 0x1, 0xfd, 0x68, 0x1, 0xc3, 0x48, 0x1, 0xfd, 0x68, 0x1, 0xc3, 0x48,
+    0x1, 0xfd, 0x68, 0x1, 0xc3, 0x48, 0x1, 0xfd, 0x68, 0x1, 0xc3, 0x48, 0x1, 0xfd, 0x68, 0x1,
+    0xc3, 0x48, 0x1, 0xfd, 0x48, 0x1, 0xc3, 0x48, 0x1, 0xfc, 0x2a, 0x1, 0xe9, 0x40, 0xf, 0xf0,
+    0xa8, 0x7, 0xa5, 0x0, 0x3f, 0xea, 0x40, 0xe, 0x1a, 0x40, 0xf, 0xfa, 0xd0, 0x3, 0x86, 0x90,
+    0x3, 0xfe, 0xb4, 0x0, 0xe1, 0xa4, 0x0, 0xff, 0xad, 0x0, 0x38, 0x69, 0x0, 0x3f, 0xeb, 0x40,
+    0xe, 0x1a, 0x40, 0xf, 0xfa, 0xd0, 0x3, 0x86, 0x90, 0x3, 0xfe, 0xb4, 0x0, 0xe1, 0xa4, 0x0,
+    0xff, 0xad, 0x0, 0x38, 0x69, 0x0, 0x3f, 0xeb, 0x40, 0xe, 0x1a, 0x40, 0xf, 0xfa, 0xd0, 0x3,
+    0x86, 0x8c, 0x3, 0xfe, 0xb4, 0x0, 0xe1, 0xb0, 0xf, 0xfd, 0x68, 0x1, 0xd8, 0x1, 0xff, 0xc1,
+    0xb4, 0x0, 0xa9, 0x0, 0x3f, 0xf8, 0x56, 0xc7, 0x4a, 0x0,
+
+    /* U+F070 "" */
+    0x1, 0x72, 0x0, 0xff, 0xee, 0x8e, 0xc6, 0x20, 0x7, 0xff, 0x72, 0xc, 0x6, 0xdc, 0x3, 0xff,
+    0xb6, 0xe0, 0x1a, 0x2c, 0x40, 0x3f, 0xfb, 0x36, 0x20, 0x19, 0x30, 0xc0, 0x3f, 0xfb, 0xb, 0xa4,
+    0x1, 0x8b, 0x18, 0x3, 0xc2, 0xb1, 0x7b, 0xdf, 0xdb, 0x92, 0xc4, 0x1, 0xff, 0xc5, 0x3c, 0x50,
+    0xe, 0x99, 0x8, 0xb, 0x5f, 0x53, 0xa1, 0x8, 0x9, 0x1b, 0x4e, 0xe3, 0x88, 0x7, 0xff, 0xc,
+    0x6a, 0x0, 0x39, 0xb6, 0x3e, 0x50, 0x3, 0xff, 0x82, 0x71, 0xd0, 0x20, 0x1f, 0xfc, 0x37, 0xb2,
+    0x0, 0xc6, 0xe2, 0x1, 0xc2, 0xb1, 0x30, 0xc4, 0x1, 0xe7, 0xf6, 0x0, 0xff, 0xe1, 0xa6, 0x20,
+    0x7, 0xf1, 0xd7, 0x53, 0xb3, 0xce, 0xe2, 0x0, 0x70, 0xcd, 0x8, 0x7, 0xff, 0x8, 0x6d, 0xc0,
+    0x3e, 0x7c, 0x50, 0xf, 0x8e, 0xe8, 0x3, 0xcb, 0x84, 0x1, 0xff, 0xc3, 0x8a, 0x10, 0xe, 0x53,
+    0x0, 0x88, 0xc8, 0x3, 0x2d, 0x80, 0x78, 0xb0, 0xc0, 0x3f, 0xf8, 0x6b, 0x86, 0x1, 0x8b, 0x18,
+    0x7, 0x31, 0xbd, 0x2, 0x0, 0x4a, 0x0, 0xf0, 0xe9, 0x0, 0x7f, 0x9, 0x0, 0x62, 0xd6, 0x0,
+    0xe9, 0xa0, 0x40, 0x0, 0xbe, 0x10, 0x1, 0x50, 0x3, 0xc3, 0xe2, 0x1, 0xfa, 0x31, 0x40, 0x30,
+    0xcc, 0x80, 0x39, 0x75, 0x80, 0x31, 0x78, 0x80, 0x20, 0x3, 0xe2, 0xb0, 0xf, 0x95, 0x86, 0xa0,
+    0x3, 0x9b, 0x8, 0x3, 0x19, 0x80, 0x38, 0xa4, 0x0, 0x64, 0x1, 0xf2, 0xa8, 0x3, 0x86, 0xc0,
+    0x27, 0xb1, 0x0, 0xc7, 0x88, 0x1, 0xff, 0x30, 0x4, 0x80, 0x1f, 0xac, 0x40, 0x34, 0x88, 0x6,
+    0x4f, 0x40, 0xc, 0x37, 0x0, 0x1f, 0xe1, 0x20, 0x7, 0x0, 0x7e, 0x19, 0x0, 0xc6, 0x1, 0xe1,
+    0xb7, 0x0, 0xe7, 0xb1, 0x0, 0xfe, 0x10, 0x0, 0x80, 0x7f, 0x18, 0x6, 0x30, 0xf, 0xd0, 0xe0,
+    0x1c, 0x98, 0x60, 0x1f, 0x84, 0x0, 0x20, 0x1f, 0xc6, 0x1, 0xa4, 0x40, 0x3f, 0x68, 0x7, 0x8b,
+    0x18, 0x3, 0xe3, 0x0, 0x70, 0x7, 0xe2, 0x90, 0xc, 0x36, 0x1, 0xf9, 0xc0, 0x3f, 0x4d, 0x8,
+    0x7, 0x61, 0x83, 0x80, 0x7e, 0x81, 0x0, 0xe5, 0x50, 0x7, 0xc4, 0x80, 0x1f, 0x97, 0x48, 0x3,
+    0x16, 0x48, 0x80, 0x7c, 0xca, 0x1, 0xf5, 0x90, 0x7, 0xde, 0x1, 0xfc, 0x78, 0xa0, 0x1c, 0xc0,
+    0x1f, 0x1c, 0x80, 0x7e, 0x1f, 0x10, 0xf, 0x23, 0x0, 0x7f, 0xd, 0x40, 0x7, 0xfc, 0x5a, 0x1,
+    0xfe, 0x2d, 0x10, 0xf, 0x42, 0x0, 0x7f, 0x9e, 0xc8, 0x3, 0xf1, 0x78, 0x80, 0x7f, 0xc7, 0x84,
+    0x1, 0xc3, 0x6c, 0x1, 0xfe, 0x4c, 0x40, 0xf, 0xf, 0x90, 0x7, 0xff, 0x4, 0xb1, 0x40, 0x3d,
+    0x36, 0x60, 0x1f, 0xc3, 0x6e, 0x1, 0xc3, 0x22, 0x1, 0xff, 0xc2, 0x1a, 0x91, 0x0, 0xe4, 0xcd,
+    0x97, 0x67, 0x60, 0xe, 0x8a, 0x10, 0xc, 0x98, 0x60, 0x1f, 0xfc, 0x36, 0xf7, 0x0, 0xf1, 0x34,
+    0x4c, 0x4d, 0x8, 0x6, 0x5c, 0x30, 0xc, 0x58, 0xc0, 0x1f, 0xfc, 0x31, 0x8e, 0x83, 0x0, 0xfe,
+    0x5d, 0x20, 0xc, 0x5a, 0xc0, 0x1d, 0x34, 0x20, 0x1f, 0xfc, 0x31, 0x7c, 0xd9, 0x63, 0x21, 0x1,
+    0x24, 0x57, 0x0, 0xe1, 0x99, 0x0, 0x72, 0xe1, 0x80, 0x7f, 0xf1, 0x49, 0xa7, 0x37, 0xbf, 0xb6,
+    0xe5, 0x40, 0x3e, 0x6c, 0x20, 0xc, 0x5a, 0xa0, 0x1f, 0xfd, 0x83, 0xc4, 0x0, 0xc3, 0x60, 0x1f,
+    0xfd, 0x91, 0xb8, 0x0, 0xce, 0x1, 0xff, 0xdb, 0x7b, 0x10, 0x38, 0x0, 0xff, 0xee, 0x26, 0x46,
+    0x88,
+
+    /* U+F0C7 "" */
+    0x0, 0x12, 0x27, 0xff, 0x1c, 0xc4, 0x3, 0xfa, 0xb6, 0xef, 0xff, 0x8f, 0x9e, 0xa0, 0x1f, 0x42,
+    0x80, 0x7f, 0xf2, 0x46, 0x98, 0x3, 0xcc, 0x1, 0xff, 0xcc, 0x96, 0x0, 0xe1, 0x0, 0xff, 0xe6,
+    0xcb, 0x0, 0x7e, 0x4b, 0xbf, 0xfe, 0x25, 0x10, 0x6, 0x96, 0x0, 0xf8, 0xd1, 0x3f, 0xf8, 0x8a,
+    0xa0, 0xe, 0x96, 0x0, 0xff, 0xe9, 0xcb, 0x0, 0x7f, 0xf4, 0xe4, 0x80, 0x3f, 0xfa, 0x68, 0x1,
+    0xff, 0xd3, 0x10, 0xf, 0xfe, 0x9f, 0x80, 0x7f, 0xfe, 0x1e, 0xef, 0xff, 0x8a, 0xe0, 0x1f, 0xfc,
+    0x24, 0x4f, 0xfe, 0x28, 0x7, 0xff, 0xfc, 0x3, 0xff, 0x82, 0x26, 0x40, 0x1f, 0xfc, 0xf1, 0xae,
+    0xcd, 0xd2, 0x80, 0x7f, 0xf3, 0x75, 0x40, 0x22, 0xa5, 0x0, 0xff, 0xbc, 0x3, 0xfe, 0x63, 0x0,
+    0xf4, 0x0, 0x7f, 0xde, 0x1, 0xff, 0x60, 0x7, 0xc4, 0x40, 0xf, 0xfe, 0x50, 0x80, 0x7e, 0x10,
+    0xf, 0xfe, 0x51, 0x80, 0x7e, 0x20, 0xf, 0xfe, 0x55, 0x0, 0x7c, 0xa2, 0x1, 0xff, 0xca, 0x2a,
+    0x0, 0xe3, 0xb0, 0xf, 0xfe, 0x62, 0xeb, 0xa2, 0xce, 0x8, 0x7, 0xff, 0x34, 0xa2, 0xe9, 0x80,
+    0x3f, 0xf8, 0x3e, 0x20, 0x1f, 0xfd, 0x21, 0x60, 0xf, 0xfe, 0x88, 0xa4, 0x28, 0x7, 0xff, 0x3c,
+    0x68, 0x82, 0xb6, 0xef, 0xff, 0x9b, 0x9c, 0x80,
+
+    /* U+F15B "" */
+    0x17, 0x7f, 0xfe, 0x13, 0x0, 0x1c, 0x80, 0x3e, 0xd8, 0x8f, 0xfe, 0x16, 0x80, 0x23, 0xc, 0x3,
+    0xc6, 0x1, 0xff, 0xc6, 0x1d, 0x30, 0xf, 0xfe, 0x68, 0xe9, 0x80, 0x7f, 0xf3, 0x47, 0x4c, 0x3,
+    0xff, 0x9a, 0x3a, 0x60, 0x1f, 0xfc, 0xd1, 0xd3, 0x0, 0xff, 0xe6, 0x8e, 0x98, 0x7, 0xff, 0x34,
+    0x78, 0x3, 0xff, 0x8c, 0xef, 0xfa, 0x80, 0x3f, 0xf8, 0x6c, 0x0, 0x88, 0xfc, 0xe0, 0x1f, 0xfc,
+    0x32, 0x94, 0x4f, 0xf0, 0x7, 0xff, 0x11, 0xae, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xff, 0x26, 0x1, 0xff, 0xcd, 0x3d, 0x88, 0xff, 0xe6, 0xe8,
+
+    /* U+F1EB "" */
+    0x0, 0xff, 0xe3, 0x91, 0xa2, 0x46, 0x40, 0x1f, 0xfd, 0x41, 0x48, 0xbd, 0xfd, 0xcb, 0xbb, 0x37,
+    0xf6, 0xe1, 0x4, 0x3, 0xff, 0x96, 0x2d, 0x5f, 0x6e, 0x84, 0x1, 0xfc, 0x48, 0xf7, 0xf4, 0xc2,
+    0x1, 0xff, 0xc6, 0x29, 0xf9, 0x51, 0x0, 0xff, 0xe2, 0x8a, 0xcf, 0xc9, 0x0, 0x7f, 0xf0, 0x8a,
+    0x75, 0x84, 0x3, 0xff, 0x96, 0x2d, 0xb2, 0x40, 0x1f, 0xf4, 0x6b, 0x0, 0x7f, 0xf4, 0x5b, 0x60,
+    0x3, 0xf1, 0xe3, 0x80, 0x7f, 0xc4, 0xaf, 0x13, 0x34, 0x3a, 0x90, 0x7, 0xfc, 0xf8, 0x60, 0x1c,
+    0xd8, 0x60, 0x1f, 0x89, 0xaf, 0xb6, 0xa1, 0xd9, 0xa7, 0x8a, 0xde, 0xb6, 0x20, 0xf, 0xc7, 0x8c,
+    0x1, 0x4c, 0x80, 0x3f, 0x2d, 0xec, 0xa0, 0x80, 0x7f, 0xc2, 0x93, 0xb6, 0xa0, 0x1f, 0xa6, 0x41,
+    0x4c, 0x1, 0xf2, 0xed, 0x20, 0x7, 0xff, 0x1d, 0x2b, 0x54, 0x3, 0xe6, 0xa7, 0x0, 0xf1, 0x5d,
+    0x10, 0x7, 0xff, 0x2c, 0xaa, 0xc8, 0x3, 0xcf, 0xc2, 0x1, 0x9b, 0x10, 0x3, 0xff, 0x9e, 0x98,
+    0xc0, 0x18, 0x78, 0xf4, 0x40, 0x13, 0x21, 0x0, 0xfc, 0x6d, 0x39, 0xbd, 0xfd, 0xb9, 0x2c, 0x60,
+    0x1f, 0x86, 0x64, 0x0, 0x1d, 0x30, 0x3d, 0x4b, 0x60, 0xf, 0x89, 0xf7, 0x25, 0x8c, 0x84, 0x4,
+    0x8d, 0xa7, 0x35, 0xc8, 0x3, 0xe6, 0xb4, 0xd3, 0x0, 0x8e, 0xd0, 0x3, 0xc3, 0x1b, 0x4, 0x1,
+    0xff, 0xc1, 0x28, 0xd8, 0x10, 0xf, 0x25, 0x98, 0x7, 0xfe, 0x6f, 0x70, 0xf, 0xfe, 0x3b, 0xfb,
+    0x0, 0x7f, 0xf1, 0x86, 0x64, 0x20, 0x1f, 0xfc, 0x91, 0x99, 0x8, 0x7, 0xff, 0x13, 0x58, 0x3,
+    0xf8, 0x51, 0x56, 0x41, 0x0, 0xfe, 0x6d, 0x0, 0xff, 0xe1, 0x89, 0x80, 0x7c, 0x73, 0xbd, 0x75,
+    0x55, 0xf6, 0xc9, 0x80, 0x7c, 0x62, 0x1, 0xff, 0xc2, 0x1a, 0x0, 0xe3, 0xbc, 0x62, 0x0, 0xf8,
+    0x9b, 0x2c, 0xc0, 0x3a, 0x84, 0x3, 0xff, 0x86, 0xb4, 0x1, 0x4e, 0x20, 0x7, 0xff, 0x5, 0x32,
+    0x40, 0x2a, 0x50, 0xf, 0xfe, 0x2a, 0xda, 0xe3, 0x0, 0x7f, 0xf1, 0x5b, 0x16, 0xd4, 0x3, 0xff,
+    0x8e, 0x94, 0x60, 0x1f, 0xfc, 0x73, 0xa4, 0x0, 0xff, 0xe9, 0x24, 0xdc, 0xa0, 0x7, 0xff, 0x6e,
+    0x6d, 0x91, 0xae, 0x40, 0x3f, 0xfb, 0x2c, 0xc0, 0xe, 0x66, 0x0, 0x7f, 0xf6, 0x28, 0x3, 0xea,
+    0x0, 0xff, 0xec, 0x10, 0x7, 0xc4, 0x1, 0xff, 0xff, 0x0, 0xf3, 0x80, 0x7c, 0xe0, 0x1f, 0xfd,
+    0x8b, 0x10, 0xe, 0x1b, 0x0, 0xff, 0xec, 0x16, 0x18, 0x4, 0x78, 0x40, 0x1f, 0xfd, 0x92, 0xcd,
+    0xcd, 0xc2, 0x0, 0xff, 0xe3, 0x80,
+
+    /* U+F240 "" */
+    0x3, 0x9b, 0xbf, 0xfe, 0xcc, 0x8, 0x4, 0x98, 0xc8, 0x9f, 0xfd, 0x97, 0xc1, 0x0, 0x40, 0x7,
+    0xff, 0x70, 0xa4, 0x0, 0x60, 0x1f, 0xfd, 0xd3, 0x0, 0xf1, 0x22, 0x7f, 0xf5, 0x44, 0x2, 0x73,
+    0x0, 0xe5, 0xbb, 0xff, 0xea, 0xa8, 0x4, 0x79, 0x40, 0x1f, 0xfe, 0x5, 0x0, 0xf2, 0x7f, 0xff,
+    0xf4, 0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xfc, 0x58, 0xb6, 0x0, 0xff, 0xef, 0x1a, 0x8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xda, 0x68, 0x20, 0x1f, 0xfd, 0xe8, 0xb6, 0x0, 0xff, 0xf5, 0xa7, 0xff, 0xff,
+    0x44, 0x3, 0xff, 0xd2, 0xa0, 0x19, 0x6e, 0xff, 0xfa, 0xaa, 0x1, 0x1e, 0x50, 0x6, 0x24, 0x4f,
+    0xfe, 0xa8, 0x80, 0x4e, 0x60, 0x60, 0x1f, 0xfd, 0xd3, 0x0, 0x40, 0x7, 0xff, 0x70, 0xa4, 0x0,
+    0x98, 0xc8, 0x9f, 0xfd, 0x97, 0xc1, 0x0,
+
+    /* U+F241 "" */
+    0x3, 0x9b, 0xbf, 0xfe, 0xcc, 0x8, 0x4, 0x98, 0xc8, 0x9f, 0xfd, 0x97, 0xc1, 0x0, 0x40, 0x7,
+    0xff, 0x70, 0xa4, 0x0, 0x60, 0x1f, 0xfd, 0xd3, 0x0, 0xf1, 0x22, 0x7f, 0xf5, 0x44, 0x2, 0x73,
+    0x0, 0xe5, 0xbb, 0xff, 0xea, 0xa8, 0x4, 0x79, 0x40, 0x1f, 0xfe, 0x5, 0x0, 0xf2, 0x7f, 0xff,
+    0xf2, 0x90, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xcb, 0x8b, 0x60, 0xf, 0xfe, 0xf1, 0xa0, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xfd, 0xa6, 0x82, 0x1, 0xff, 0xde, 0x8b, 0x60, 0xf, 0xff, 0x5a, 0x7f, 0xff,
+    0xf2, 0x90, 0x3, 0xff, 0xde, 0xa0, 0x19, 0x6e, 0xff, 0xfa, 0xaa, 0x1, 0x1e, 0x50, 0x6, 0x24,
+    0x4f, 0xfe, 0xa8, 0x80, 0x4e, 0x60, 0x60, 0x1f, 0xfd, 0xd3, 0x0, 0x40, 0x7, 0xff, 0x70, 0xa4,
+    0x0, 0x98, 0xc8, 0x9f, 0xfd, 0x97, 0xc1, 0x0,
+
+    /* U+F242 "" */
+    0x3, 0x9b, 0xbf, 0xfe, 0xcc, 0x8, 0x4, 0x98, 0xc8, 0x9f, 0xfd, 0x97, 0xc1, 0x0, 0x40, 0x7,
+    0xff, 0x70, 0xa4, 0x0, 0x60, 0x1f, 0xfd, 0xd3, 0x0, 0xf1, 0x22, 0x7f, 0xf5, 0x44, 0x2, 0x73,
+    0x0, 0xe5, 0xbb, 0xff, 0xea, 0xa8, 0x4, 0x79, 0x40, 0x1f, 0xfe, 0x5, 0x0, 0xf2, 0x7f, 0xff,
+    0xf0, 0xe0, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xd2, 0x8b, 0x60, 0xf, 0xfe, 0xf1, 0xa0, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xfd, 0xa6, 0x82, 0x1, 0xff, 0xde, 0x8b, 0x60, 0xf, 0xff, 0x5a, 0x7f, 0xff,
+    0xf0, 0xe0, 0x3, 0xff, 0xec, 0xa0, 0x19, 0x6e, 0xff, 0xfa, 0xaa, 0x1, 0x1e, 0x50, 0x6, 0x24,
+    0x4f, 0xfe, 0xa8, 0x80, 0x4e, 0x60, 0x60, 0x1f, 0xfd, 0xd3, 0x0, 0x40, 0x7, 0xff, 0x70, 0xa4,
+    0x0, 0x98, 0xc8, 0x9f, 0xfd, 0x97, 0xc1, 0x0,
+
+    /* U+F243 "" */
+    0x3, 0x9b, 0xbf, 0xfe, 0xcc, 0x8, 0x4, 0x98, 0xc8, 0x9f, 0xfd, 0x97, 0xc1, 0x0, 0x40, 0x7,
+    0xff, 0x70, 0xa4, 0x0, 0x60, 0x1f, 0xfd, 0xd3, 0x0, 0xf1, 0x22, 0x7f, 0xf5, 0x44, 0x2, 0x73,
+    0x0, 0xe5, 0xbb, 0xff, 0xea, 0xa8, 0x4, 0x79, 0x40, 0x1f, 0xfe, 0x5, 0x0, 0xf2, 0x7f, 0xfe,
+    0xb0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x66, 0x2d, 0x80, 0x3f, 0xfb, 0xc6, 0x82, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xf6, 0x9a, 0x8, 0x7, 0xff, 0x7a, 0x2d, 0x80, 0x3f, 0xfd, 0x69, 0xff, 0xfa, 0xc0,
+    0x3f, 0xff, 0xaa, 0x1, 0x96, 0xef, 0xff, 0xaa, 0xa0, 0x11, 0xe5, 0x0, 0x62, 0x44, 0xff, 0xea,
+    0x88, 0x4, 0xe6, 0x6, 0x1, 0xff, 0xdd, 0x30, 0x4, 0x0, 0x7f, 0xf7, 0xa, 0x40, 0x9, 0x8c,
+    0x89, 0xff, 0xd9, 0x7c, 0x10, 0x0,
+
+    /* U+F244 "" */
+    0x3, 0x9b, 0xbf, 0xfe, 0xcc, 0x8, 0x4, 0x98, 0xc8, 0x9f, 0xfd, 0x97, 0xc1, 0x0, 0x40, 0x7,
+    0xff, 0x70, 0xa4, 0x0, 0x60, 0x1f, 0xfd, 0xd3, 0x0, 0xf1, 0x22, 0x7f, 0xf5, 0x44, 0x2, 0x73,
+    0x0, 0xe5, 0xbb, 0xff, 0xea, 0xa8, 0x4, 0x79, 0x40, 0x1f, 0xfe, 0x5, 0x0, 0xff, 0xff, 0x80,
+    0x7f, 0xfa, 0x62, 0xd8, 0x3, 0xff, 0xbc, 0x68, 0x20, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0x69, 0xa0,
+    0x80, 0x7f, 0xf7, 0xa2, 0xd8, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xf3, 0x50, 0xc, 0xb7, 0x7f, 0xfd,
+    0x55, 0x0, 0x8f, 0x28, 0x3, 0x12, 0x27, 0xff, 0x54, 0x40, 0x27, 0x30, 0x30, 0xf, 0xfe, 0xe9,
+    0x80, 0x20, 0x3, 0xff, 0xb8, 0x52, 0x0, 0x4c, 0x64, 0x4f, 0xfe, 0xcb, 0xe0, 0x80, 0x0,
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 155, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 486, .box_w = 28, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 287, .adv_w = 335, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 332, .adv_w = 131, .box_w = 6, .box_h = 11, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 364, .adv_w = 221, .box_w = 10, .box_h = 4, .ofs_x = 2, .ofs_y = 8},
+    {.bitmap_index = 375, .adv_w = 131, .box_w = 6, .box_h = 5, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 390, .adv_w = 384, .box_w = 22, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 608, .adv_w = 213, .box_w = 10, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 631, .adv_w = 331, .box_w = 20, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 800, .adv_w = 329, .box_w = 19, .box_h = 27, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 970, .adv_w = 385, .box_w = 23, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1118, .adv_w = 331, .box_w = 20, .box_h = 27, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 1291, .adv_w = 355, .box_w = 21, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1510, .adv_w = 344, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1660, .adv_w = 371, .box_w = 21, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1891, .adv_w = 355, .box_w = 20, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2105, .adv_w = 131, .box_w = 6, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2142, .adv_w = 416, .box_w = 24, .box_h = 27, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 2350, .adv_w = 366, .box_w = 19, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 2404, .adv_w = 241, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 13},
+    {.bitmap_index = 2479, .adv_w = 344, .box_w = 18, .box_h = 27, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2667, .adv_w = 396, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 2872, .adv_w = 576, .box_w = 34, .box_h = 35, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 3173, .adv_w = 360, .box_w = 20, .box_h = 31, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3359, .adv_w = 720, .box_w = 45, .box_h = 37, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 3840, .adv_w = 504, .box_w = 32, .box_h = 33, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 4024, .adv_w = 432, .box_w = 27, .box_h = 37, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 4131, .adv_w = 720, .box_w = 45, .box_h = 33, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 4489, .adv_w = 720, .box_w = 45, .box_h = 23, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 4608, .adv_w = 720, .box_w = 45, .box_h = 23, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 4728, .adv_w = 720, .box_w = 45, .box_h = 23, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 4848, .adv_w = 720, .box_w = 45, .box_h = 23, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 4966, .adv_w = 720, .box_w = 45, .box_h = 23, .ofs_x = 0, .ofs_y = 2}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_0[] = {
+    0x0, 0x5, 0xb, 0xc, 0xd, 0xe
+};
+
+static const uint16_t unicode_list_2[] = {
+    0x0, 0x3, 0x6d, 0xa0, 0xefca, 0xefd0, 0xf010, 0xf02d,
+    0xf084, 0xf118, 0xf1a8, 0xf1fd, 0xf1fe, 0xf1ff, 0xf200, 0xf201
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 15, .glyph_id_start = 1,
+        .unicode_list = unicode_list_0, .glyph_id_ofs_list = NULL, .list_length = 6, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    },
+    {
+        .range_start = 48, .range_length = 11, .glyph_id_start = 7,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 67, .range_length = 61954, .glyph_id_start = 18,
+        .unicode_list = unicode_list_2, .glyph_id_ofs_list = NULL, .list_length = 16, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 1, 2, 3, 2, 3, 4, 0, 5, 6, 7, 8, 9, 10, 11,
+    4, 12, 13, 14, 15, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 1, 2, 3, 2, 3, 4, 5, 6, 7, 8, 9, 4, 10, 11,
+    12, 13, 14, 0, 15, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    -70, 12, 17, 0, -12, 6, 6, 19, 12, -10, 12, 0, 0, 0, -16, 7,
+    -21, 2, -4, 4, -10, -7, -12, 4, 0, -6, 0, 0, 0, 4, 0, 0,
+    -36, -4, 0, -7, -7, 6, 6, -5, 0, -7, 6, 0, 0, -12, -36, 6,
+    0, 4, -7, 0, -2, -2, -6, 0, 0, -4, 0, 0, 0, 0, 2, 0,
+    6, -4, 6, -2, 0, 0, 0, -11, 0, -2, 0, 0, 0, 0, 0, 0,
+    -6, 0, 0, 0, 0, -3, -3, 0, -6, -7, 0, 0, 0, 0, -9, 0,
+    -17, 6, 12, 0, -14, -2, -7, 0, -2, -27, 6, -4, 4, 6, -17, 16,
+    -6, 0, 0, 0, 0, -3, -3, 0, -3, -7, 0, 0, 0, 0, -7, 0,
+    -12, 3, 6, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, -11, 0,
+    2, -29, -30, -12, 6, 0, -5, -37, -10, 0, -10, 0, -12, -10, 3, -22,
+    -6, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+    0, -2, 7, -13, 6, -4, -2, -15, -6, 0, -7, -6, -4, -9, 6, -4,
+    0, 0, -6, -7, 9, 1, 0, -27, -10, 6, -10, 4, 0, -5, 17, -11,
+    13, 0, -36, 2, 25, 17, 10, -23, 4, 24, 0, 21, 0, 6, 0, 0,
+    -16, 0, 0, 0, -13, -3, 0, 0, 0, -13, 0, -7, 0, 0, -11, 0
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 16,
+    .right_class_cnt     = 16,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 3,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = LV_FONT_FMT_TXT_COMPRESSED,
+    .cache = &cache
+};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t lv_font_montserrat_36 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 40,          /*The maximum line height required by the font*/
+    .base_line = 7,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -3,
+    .underline_thickness = 2,
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+};
@@ -0,0 +1,75 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * Gravação de traços de entrada
+ *
+ * Com -DINPUT_TRACE_RECORD=1 nas build_flags, cada entrada que os apps recebem
+ * (tecla, movimento/clique do trackball, toque) é escrita na serial no formato
+ * do simulador de host (tools/simulator), com o millis() do momento:
+ *
+ *   @trace 15234 ball down
+ *   @trace 15710 key w
+ *   @trace 16002 touch 22 20
+ *   @trace 16090 release
+ *
+ * O traço é o log da serial filtrado:
+ *   pio device monitor | grep --line-buffered '^@trace ' | cut -c8- > fluxo.trace
+ *
+ * Desligado (padrão), as macros não geram código.
+ *
+ * Exemplo de uso:
+ *
+ * inline char get_key() {
+ *     ...
+ *     INPUT_TRACE_KEY(key);
+ * }
+ */
+
+#ifndef INPUT_TRACE_RECORD
+#define INPUT_TRACE_RECORD 0
+#endif
+
+#if INPUT_TRACE_RECORD
+
+namespace InputTrace {
+
+/**
+ * @brief Tecla: caracteres visíveis como estão, os demais em hexadecimal.
+ */
+inline void key(char c) {
+    if (c > ' ' && c < 127) Serial.printf("@trace %lu key %c\n", (unsigned long)millis(), c);
+    else Serial.printf("@trace %lu key 0x%02x\n", (unsigned long)millis(), (uint8_t)c);
+}
+
+inline void ball(const char* what) {
+    Serial.printf("@trace %lu ball %s\n", (unsigned long)millis(), what);
+}
+
+/**
+ * @brief Toque: só grava quando o estado ou o ponto muda.
+ */
+inline void touch(bool pressed, int16_t x, int16_t y) {
+    static bool last_pressed = false;
+    static int16_t last_x = -1, last_y = -1;
+    if (pressed == last_pressed && (!pressed || (x == last_x && y == last_y))) return;
+    last_pressed = pressed;
+    last_x = x;
+    last_y = y;
+    if (pressed) Serial.printf("@trace %lu touch %d %d\n", (unsigned long)millis(), x, y);
+    else Serial.printf("@trace %lu release\n", (unsigned long)millis());
+}
+
+} // namespace InputTrace
+
+#define INPUT_TRACE_KEY(c) InputTrace::key(c)
+#define INPUT_TRACE_BALL(what) InputTrace::ball(what)
+#define INPUT_TRACE_TOUCH(pressed, x, y) InputTrace::touch(pressed, x, y)
+
+#else
+
+#define INPUT_TRACE_KEY(c) ((void)0)
+#define INPUT_TRACE_BALL(what) ((void)0)
+#define INPUT_TRACE_TOUCH(pressed, x, y) ((void)0)
+
+#endif
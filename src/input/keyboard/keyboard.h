@@ -29,6 +29,7 @@
 #include <Arduino.h>
 #include "hardware/TDECK_PINS.h"
 #include <Wire.h>
+#include "input/input_trace.h"
 
 namespace Keyboard {
 
@@ -51,7 +52,9 @@ inline void init() {
 inline char get_key() {
     Wire.requestFrom(TDECK_KEYBOARD_ADDR, 1);
     if (Wire.available() > 0) {
-        return Wire.read();
+        char key = Wire.read();
+        if (key) INPUT_TRACE_KEY(key);
+        return key;
     } else {
         return 0;
     }
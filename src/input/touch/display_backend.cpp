@@ -0,0 +1,30 @@
+#include "display_backend.h"
+#include "hardware/TDECK_PINS.h"
+
+namespace DisplayBackend {
+
+/*O backlight do T-Deck tem DISPLAY_BRIGHTNESS_STEPS degraus, trocados por pulsos no pino*/
+void set_brightness(uint8_t value) {
+    static uint8_t level = 0;
+    if (value == 0) {
+        digitalWrite(TDECK_TFT_BACKLIGHT, LOW);
+        delay(3);
+        level = 0;
+        return;
+    }
+    if (level == 0) {
+        digitalWrite(TDECK_TFT_BACKLIGHT, HIGH);
+        level = DISPLAY_BRIGHTNESS_STEPS;
+        delayMicroseconds(30);
+    }
+    int from = DISPLAY_BRIGHTNESS_STEPS - level;
+    int to = DISPLAY_BRIGHTNESS_STEPS - value;
+    int num = (DISPLAY_BRIGHTNESS_STEPS + to - from) % DISPLAY_BRIGHTNESS_STEPS;
+    for (int i = 0; i < num; ++i) {
+        digitalWrite(TDECK_TFT_BACKLIGHT, LOW);
+        digitalWrite(TDECK_TFT_BACKLIGHT, HIGH);
+    }
+    level = value;
+}
+
+} // namespace DisplayBackend
@@ -0,0 +1,103 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+
+/**
+ * DisplayBackend - O caminho dos comandos e pixels até o ST7789
+ *
+ * O DisplayTouch só fala com o painel por aqui, e o backend é escolhido no
+ * build (DISPLAY_BACKEND):
+ *
+ * - DISPLAY_BACKEND_TFT_ESPI (padrão): o TFT_eSPI roda a sequência de init e
+ *   a rotação; depois comandos e pixels vão pelo SpiBus, com prioridade sobre
+ *   o SD e em pedaços de SPI_BUS_CHUNK pelos buffers de rebote na SRAM.
+ *   Se o SpiBus::begin() falhar, o TFT_eSPI continua desenhando sozinho
+ *   (pushColors, com o done na própria chamada).
+ * - DISPLAY_BACKEND_ESP_LCD: o esp_lcd do IDF (panel IO SPI e o driver
+ *   ST7789). O display sai do SpiBus (SpiBus::release) e vira um dispositivo
+ *   próprio do spi_master no mesmo barramento: o IDF alterna entre ele e os
+ *   do árbitro, sem a prioridade do SpiBus, e a ocupação do TFT no Monitor
+ *   fica em zero.
+ *
+ * Tudo vai para o painel na ordem das chamadas. set_window() e um push() com
+ * os pixels da janela desenham uma janela; command() manda um comando com os
+ * parâmetros (VSCRDEF, VSCSAD, COLMOD...), que são copiados. O `done` de uma
+ * chamada vem depois que ela e todas as anteriores chegaram ao painel, fora da
+ * tarefa do LVGL: na tarefa do SpiBus, na interrupção do fim do DMA (esp_lcd)
+ * ou, para um command() do esp_lcd e sem o SpiBus, na própria chamada. Os pixels precisam
+ * viver até o done, e cabem DISPLAY_BACKEND_QUEUE chamadas entre dois done.
+ *
+ * O brilho é do T-Deck (pulsos no pino do backlight), igual nos dois.
+ *
+ * display_bench.h mede os dois no aparelho (DISPLAY_BENCH).
+ *
+ * 🖥️ Exemplo de uso:
+ *
+ * DisplayBackend::init(1);                    // Paisagem
+ * DisplayBackend::set_window(&area);
+ * DisplayBackend::push(pixels, lv_area_get_size(&area) * 2, flush_done, drv);
+ * DisplayBackend::set_brightness(16);
+ */
+
+#define DISPLAY_BACKEND_TFT_ESPI 1
+#define DISPLAY_BACKEND_ESP_LCD  2
+
+#ifndef DISPLAY_BACKEND
+#define DISPLAY_BACKEND DISPLAY_BACKEND_TFT_ESPI
+#endif
+
+/*Chamadas em andamento: comporta um flush inteiro (COLMOD, as janelas do TftScroll e os comandos da rolagem)*/
+#ifndef DISPLAY_BACKEND_QUEUE
+#define DISPLAY_BACKEND_QUEUE 16
+#endif
+
+#define DISPLAY_BRIGHTNESS_STEPS 16
+
+#if DISPLAY_BACKEND == DISPLAY_BACKEND_TFT_ESPI
+#include <TFT_eSPI.h>
+#endif
+
+namespace DisplayBackend {
+
+typedef void (*done_cb_t)(void* user);
+
+const char* name();
+
+/**
+ * @brief Configura o painel na `rotation` (a do TFT_eSPI), com a tela preta,
+ * e liga o SpiBus. Os pinos de energia e os CS já precisam estar em nível alto.
+ */
+void init(uint8_t rotation);
+uint8_t rotation();
+
+/**
+ * @brief Comando `cmd` com `len` bytes de parâmetros (até 8).
+ */
+void command(uint8_t cmd, const uint8_t* params, uint8_t len, done_cb_t done = nullptr, void* user = nullptr);
+
+/**
+ * @brief Janela (CASET/RASET) do próximo push, em coordenadas do painel já rodado.
+ */
+void set_window(const lv_area_t* area);
+
+/**
+ * @brief Manda `len` bytes de pixels para a janela (RAMWR). Volta logo; `done`
+ * vem quando eles chegaram ao painel.
+ */
+void push(const void* pixels, uint32_t len, done_cb_t done = nullptr, void* user = nullptr);
+
+/**
+ * @brief Brilho entre 0 (apagado) e DISPLAY_BRIGHTNESS_STEPS (máximo).
+ */
+void set_brightness(uint8_t value);
+
+/**
+ * @brief Clock do SPI do painel, em Hz.
+ */
+uint32_t clock_hz();
+
+#if DISPLAY_BACKEND == DISPLAY_BACKEND_TFT_ESPI
+extern TFT_eSPI tft;    // Só para o init e, no host, para ler o framebuffer
+#endif
+
+} // namespace DisplayBackend
@@ -0,0 +1,133 @@
+#include "display_backend.h"
+
+#if DISPLAY_BACKEND == DISPLAY_BACKEND_ESP_LCD
+#include <esp_lcd_panel_io.h>
+#include <esp_lcd_panel_ops.h>
+#include <esp_lcd_panel_vendor.h>
+#include "hardware/TDECK_PINS.h"
+#include "system/spi_bus.h"
+
+namespace {
+
+esp_lcd_panel_io_handle_t io = nullptr;
+esp_lcd_panel_handle_t panel = nullptr;
+uint8_t current_rotation = 0;
+
+// O esp_lcd avisa o fim de cada tx_color, na ordem em que foram enfileirados:
+// os `done` dos push() esperam aqui, um por push, na mesma ordem.
+struct Pending {
+    DisplayBackend::done_cb_t done;
+    void* user;
+};
+
+Pending pending[DISPLAY_BACKEND_QUEUE];
+volatile uint8_t pending_head = 0;
+volatile uint8_t pending_tail = 0;
+
+// Roda na interrupção do fim do DMA
+bool IRAM_ATTR color_done(esp_lcd_panel_io_handle_t, void*, void*) {
+    Pending p = pending[pending_tail];
+    pending_tail = (pending_tail + 1) % DISPLAY_BACKEND_QUEUE;
+    if (p.done) p.done(p.user);
+    return false;
+}
+
+void put_range(uint8_t* out, uint16_t from, uint16_t to) {
+    out[0] = from >> 8;
+    out[1] = from & 0xFF;
+    out[2] = to >> 8;
+    out[3] = to & 0xFF;
+}
+
+} // namespace
+
+namespace DisplayBackend {
+
+const char* name() {
+    return "esp_lcd";
+}
+
+void init(uint8_t rotation) {
+    // O barramento continua do SpiBus (SD e rádio); o display vira outro dispositivo do spi_master nele
+    SpiBus::begin();
+    SpiBus::release(SPI_BUS_TFT);
+
+    esp_lcd_panel_io_spi_config_t io_cfg = {};
+    io_cfg.cs_gpio_num = TDECK_TFT_CS;
+    io_cfg.dc_gpio_num = TDECK_TFT_DC;
+    io_cfg.spi_mode = 0;
+    io_cfg.pclk_hz = SPI_BUS_TFT_HZ;
+    io_cfg.trans_queue_depth = 10;
+    io_cfg.on_color_trans_done = color_done;
+    io_cfg.lcd_cmd_bits = 8;
+    io_cfg.lcd_param_bits = 8;
+    ESP_ERROR_CHECK(esp_lcd_new_panel_io_spi((esp_lcd_spi_bus_handle_t)SPI2_HOST, &io_cfg, &io));
+
+    esp_lcd_panel_dev_config_t panel_cfg = {};
+    panel_cfg.reset_gpio_num = -1;
+    panel_cfg.color_space = ESP_LCD_COLOR_SPACE_RGB;
+    panel_cfg.bits_per_pixel = 16;
+    ESP_ERROR_CHECK(esp_lcd_new_panel_st7789(io, &panel_cfg, &panel));
+    esp_lcd_panel_reset(panel);
+    esp_lcd_panel_init(panel);
+    esp_lcd_panel_invert_color(panel, true);
+
+    // O mesmo MADCTL das rotações do TFT_eSPI: o TftScroll conta com ele
+    current_rotation = rotation & 3;
+    switch (current_rotation) {
+    case 1:
+        esp_lcd_panel_swap_xy(panel, true);
+        esp_lcd_panel_mirror(panel, true, false);
+        break;
+    case 2:
+        esp_lcd_panel_mirror(panel, true, true);
+        break;
+    case 3:
+        esp_lcd_panel_swap_xy(panel, true);
+        esp_lcd_panel_mirror(panel, false, true);
+        break;
+    default:
+        break;
+    }
+
+    // Tela preta, uma linha por vez a partir de um buffer na SRAM
+    lv_coord_t w = current_rotation & 1 ? TFT_HEIGHT : TFT_WIDTH;
+    lv_coord_t h = current_rotation & 1 ? TFT_WIDTH : TFT_HEIGHT;
+    static uint16_t black[TFT_HEIGHT];
+    for (lv_coord_t y = 0; y < h; y++) esp_lcd_panel_draw_bitmap(panel, 0, y, w, y + 1, black);
+    esp_lcd_panel_disp_off(panel, false);
+}
+
+uint8_t rotation() {
+    return current_rotation;
+}
+
+void command(uint8_t cmd, const uint8_t* params, uint8_t len, done_cb_t done, void* user) {
+    // tx_param espera os pixels enfileirados e manda por polling: já chegou ao painel na volta
+    esp_lcd_panel_io_tx_param(io, cmd, len ? params : nullptr, len);
+    if (done) done(user);
+}
+
+void set_window(const lv_area_t* area) {
+    uint8_t range[4];
+    put_range(range, area->x1, area->x2);
+    esp_lcd_panel_io_tx_param(io, 0x2A, range, 4); // CASET
+    put_range(range, area->y1, area->y2);
+    esp_lcd_panel_io_tx_param(io, 0x2B, range, 4); // RASET
+}
+
+void push(const void* pixels, uint32_t len, done_cb_t done, void* user) {
+    pending[pending_head] = Pending{done, user};
+    pending_head = (pending_head + 1) % DISPLAY_BACKEND_QUEUE;
+    // Pixels fora da SRAM (o buffer do LVGL na PSRAM) são copiados pelo
+    // spi_master para um buffer de DMA a cada pedaço de max_transfer_sz
+    esp_lcd_panel_io_tx_color(io, 0x2C, pixels, len); // RAMWR
+}
+
+uint32_t clock_hz() {
+    return SPI_BUS_TFT_HZ;
+}
+
+} // namespace DisplayBackend
+
+#endif // DISPLAY_BACKEND == DISPLAY_BACKEND_ESP_LCD
@@ -0,0 +1,150 @@
+#include "display_backend.h"
+
+#if DISPLAY_BACKEND == DISPLAY_BACKEND_TFT_ESPI
+#include <SPI.h>
+#include <string.h>
+#include "hardware/TDECK_PINS.h"
+#include "system/pda_log.h"
+#include "system/spi_bus.h"
+
+namespace {
+
+// Uma chamada são até cinco transferências do SpiBus: os bytes de comando (DC
+// baixo) e os parâmetros copiados ficam junto delas até o on_done.
+struct Op {
+    SpiBus::Transfer xfers[5];
+    uint8_t cmds[3];
+    uint8_t params[8];
+    uint8_t count;
+    DisplayBackend::done_cb_t done;
+    void* user;
+};
+
+Op ops[DISPLAY_BACKEND_QUEUE];
+uint8_t next_op = 0;
+lv_area_t window;   // A última set_window(): sem o SpiBus o push() a aplica pelo TFT_eSPI
+
+Op& begin_op(DisplayBackend::done_cb_t done, void* user) {
+    Op& op = ops[next_op];
+    next_op = (next_op + 1) % DISPLAY_BACKEND_QUEUE;
+    op.count = 0;
+    op.done = done;
+    op.user = user;
+    return op;
+}
+
+void add(Op& op, const void* data, uint32_t len, uint8_t flags) {
+    op.xfers[op.count++] = SpiBus::Transfer{data, nullptr, len, flags};
+}
+
+void op_done(SpiBus::Transfer* t) {
+    Op* op = (Op*)t->user;
+    op->done(op->user);
+}
+
+/**
+ * @brief Enfileira a operação no SpiBus. Retorna false se ele não aceitou nada
+ * (o begin() falhou): quem chamou manda a operação pelo TFT_eSPI.
+ */
+bool submit(Op& op) {
+    if (op.done) {
+        op.xfers[op.count - 1].on_done = op_done;
+        op.xfers[op.count - 1].user = &op;
+    }
+    for (uint8_t i = 0; i < op.count; i++) {
+        if (SpiBus::submit(SPI_BUS_TFT, &op.xfers[i])) continue;
+        if (i == 0) return false;
+        // O fim da operação não vai para o fio: o on_done não viria e o LVGL esperaria para sempre
+        pda_log(PDA_LOG_SYSTEM, PDA_LOG_ERROR, "tft_espi: SpiBus dropped an operation");
+        if (op.done) op.done(op.user);
+        return true;
+    }
+    return true;
+}
+
+void put_range(uint8_t* out, uint16_t from, uint16_t to) {
+    out[0] = from >> 8;
+    out[1] = from & 0xFF;
+    out[2] = to >> 8;
+    out[3] = to & 0xFF;
+}
+
+} // namespace
+
+namespace DisplayBackend {
+
+TFT_eSPI tft;
+
+const char* name() {
+    return "tft_espi";
+}
+
+void init(uint8_t rotation) {
+    SPI.begin(TDECK_SPI_SCK, TDECK_SPI_MISO, TDECK_SPI_MOSI);
+    tft.begin();
+    tft.setRotation(rotation);
+    tft.fillScreen(TFT_BLACK);
+    // Daqui em diante o SPI é do árbitro: o tft não deve mais desenhar. Se o
+    // begin() falhar, o SPI volta ao Arduino e as operações abaixo vão pelo tft.
+    if (!SpiBus::begin()) pda_log(PDA_LOG_SYSTEM, PDA_LOG_WARN, "tft_espi: no SpiBus, drawing with TFT_eSPI");
+}
+
+uint8_t rotation() {
+    return tft.getRotation();
+}
+
+void command(uint8_t cmd, const uint8_t* params, uint8_t len, done_cb_t done, void* user) {
+    Op& op = begin_op(done, user);
+    if (len > sizeof(op.params)) len = sizeof(op.params);
+    op.cmds[0] = cmd;
+    add(op, &op.cmds[0], 1, SPI_BUS_CMD);
+    if (len) {
+        memcpy(op.params, params, len);
+        add(op, op.params, len, 0);
+    }
+    if (submit(op)) return;
+
+    tft.startWrite();
+    tft.writecommand(cmd);
+    for (uint8_t i = 0; i < len; i++) tft.writedata(params[i]);
+    tft.endWrite();
+    if (done) done(user);
+}
+
+void set_window(const lv_area_t* area) {
+    window = *area;
+    Op& op = begin_op(nullptr, nullptr);
+    op.cmds[0] = 0x2A; // CASET
+    op.cmds[1] = 0x2B; // RASET
+    op.cmds[2] = 0x2C; // RAMWR
+    put_range(&op.params[0], area->x1, area->x2);
+    put_range(&op.params[4], area->y1, area->y2);
+    add(op, &op.cmds[0], 1, SPI_BUS_CMD);
+    add(op, &op.params[0], 4, 0);
+    add(op, &op.cmds[1], 1, SPI_BUS_CMD);
+    add(op, &op.params[4], 4, 0);
+    add(op, &op.cmds[2], 1, SPI_BUS_CMD);
+    submit(op);
+}
+
+void push(const void* pixels, uint32_t len, done_cb_t done, void* user) {
+    Op& op = begin_op(done, user);
+    add(op, pixels, len, 0);
+    if (submit(op)) return;
+
+    // Os bytes já estão na ordem do fio (LV_COLOR_16_SWAP, ou RGB444 empacotado): sem troca
+    tft.startWrite();
+    tft.setAddrWindow(window.x1, window.y1, lv_area_get_width(&window), lv_area_get_height(&window));
+    tft.pushColors((uint16_t*)pixels, len / 2, false);
+    if (len & 1) tft.writedata(((const uint8_t*)pixels)[len - 1]);
+    tft.endWrite();
+    if (done) done(user);
+}
+
+uint32_t clock_hz() {
+    return SpiBus::stats(SPI_BUS_TFT).clock_hz;
+}
+
+} // namespace DisplayBackend
+
+#endif // DISPLAY_BACKEND == DISPLAY_BACKEND_TFT_ESPI
@@ -0,0 +1,162 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+#include "input/touch/display_backend.h"
+#include "system/pda_log.h"
+#include "system/tft_rgb444.h"
+
+/**
+ * Display Bench - Vazão do flush no aparelho
+ *
+ * Mede o DisplayBackend escolhido no build com três formas de flush, cada uma
+ * cobrindo a tela DISPLAY_BENCH_FRAMES vezes:
+ *
+ * - full:  a tela inteira de uma vez, de um buffer na PSRAM (o do LVGL)
+ * - bands: faixas de 40 linhas, de um buffer de DMA na SRAM
+ * - tiles: blocos de 32x32, de um buffer de DMA na SRAM (o pior caso: janela
+ *   e comandos a cada 2 KB)
+ *
+ * Para cada uma, escreve no log o tempo por quadro (até o último done), os
+ * quadros por segundo, os KB/s no fio e o tempo que o chamador passou dentro
+ * de set_window()/push() por quadro: o que a tarefa do LVGL perde esperando
+ * em vez de desenhar o próximo.
+ *
+ * Depois, o mesmo para o RGB444 (TftRgb444) e os quadros do LVGL:
+ *
+ * - full444: a tela inteira já empacotada, com o painel em COLMOD 0x53
+ * - lvgl565 / lvgl444: a tela invalidada e redesenhada pelo LVGL (render,
+ *   empacotamento e flush), com o formato preso em RGB565 ou em RGB444 (hold)
+ *
+ * Roda uma vez no boot, depois do DisplayTouch::init() e antes da UI, com
+ * -DDISPLAY_BENCH=1. Compare os dois backends (DISPLAY_BACKEND) no mesmo
+ * aparelho.
+ *
+ * ⏱️ Exemplo de uso:
+ *
+ * DisplayTouch::init();
+ * #if DISPLAY_BENCH
+ * DisplayBench::run();
+ * #endif
+ */
+
+#ifndef DISPLAY_BENCH
+#define DISPLAY_BENCH 0
+#endif
+
+#ifndef DISPLAY_BENCH_FRAMES
+#define DISPLAY_BENCH_FRAMES 30
+#endif
+
+namespace DisplayBench {
+
+static volatile uint32_t bench_done = 0;
+
+static void bench_done_cb(void*) {
+    bench_done = bench_done + 1;
+}
+
+/**
+ * Cobre a tela com janelas de `w` x `h` a partir de `pixels`, DISPLAY_BENCH_FRAMES vezes.
+ */
+inline void measure(const char* name, const uint16_t* pixels, lv_coord_t w, lv_coord_t h, bool rgb444 = false) {
+    lv_coord_t hor = TFT_HEIGHT, ver = TFT_WIDTH;      // Paisagem
+    uint32_t pushes = 0;
+    uint32_t bytes = 0;
+    uint32_t caller_us = 0;
+    bench_done = 0;
+    uint32_t start = micros();
+    for (int f = 0; f < DISPLAY_BENCH_FRAMES; f++) {
+        for (lv_coord_t y = 0; y < ver; y += h) {
+            for (lv_coord_t x = 0; x < hor; x += w) {
+                lv_area_t a = {x, y, (lv_coord_t)(LV_MIN(x + w, hor) - 1), (lv_coord_t)(LV_MIN(y + h, ver) - 1)};
+                // Um done por push: no máximo DISPLAY_BACKEND_QUEUE chamadas em andamento
+                while (pushes - bench_done >= DISPLAY_BACKEND_QUEUE / 2) delayMicroseconds(20);
+                uint32_t len = rgb444 ? TftRgb444::packed_size(lv_area_get_size(&a)) : lv_area_get_size(&a) * 2;
+                uint32_t t0 = micros();
+                DisplayBackend::set_window(&a);
+                DisplayBackend::push(pixels, len, bench_done_cb);
+                caller_us += micros() - t0;
+                pushes++;
+                bytes += len;
+            }
+        }
+    }
+    while (bench_done < pushes) delayMicroseconds(20);
+    uint32_t total_us = micros() - start;
+
+    uint32_t frame_us = total_us / DISPLAY_BENCH_FRAMES;
+    pda_log(PDA_LOG_SYSTEM, PDA_LOG_USER, "%s %s: %lu us/frame, %lu.%lu fps, %lu KB/s, caller %lu us/frame",
+            DisplayBackend::name(), name, (unsigned long)frame_us, (unsigned long)(10000000UL / frame_us / 10),
+            (unsigned long)(10000000UL / frame_us % 10), (unsigned long)((uint64_t)bytes * 1000 / total_us / 1024),
+            (unsigned long)(caller_us / DISPLAY_BENCH_FRAMES));
+}
+
+/**
+ * Redesenha a tela inteira pelo LVGL DISPLAY_BENCH_FRAMES vezes, com o formato
+ * preso em RGB565 ou em RGB444: os quadros por segundo de uma transição.
+ */
+inline void measure_lvgl(const char* name, bool rgb444) {
+    lv_disp_t* disp = lv_disp_get_default();
+    if (rgb444) TftRgb444::hold(TFT_RGB444_TRANSITION);
+    uint32_t frames_444 = TftRgb444::stats().frames_444;
+    uint32_t start = micros();
+    for (int f = 0; f < DISPLAY_BENCH_FRAMES; f++) {
+        lv_obj_invalidate(lv_scr_act());
+        lv_refr_now(disp);
+    }
+    while (disp->driver->draw_buf->flushing) delayMicroseconds(20);
+    uint32_t total_us = micros() - start;
+    frames_444 = TftRgb444::stats().frames_444 - frames_444;
+    if (rgb444) TftRgb444::release(TFT_RGB444_TRANSITION);
+
+    uint32_t frame_us = total_us / DISPLAY_BENCH_FRAMES;
+    pda_log(PDA_LOG_SYSTEM, PDA_LOG_USER, "%s %s: %lu us/frame, %lu.%lu fps, %lu/%d frames in RGB444",
+            DisplayBackend::name(), name, (unsigned long)frame_us, (unsigned long)(10000000UL / frame_us / 10),
+            (unsigned long)(10000000UL / frame_us % 10), (unsigned long)frames_444, DISPLAY_BENCH_FRAMES);
+}
+
+/**
+ * Roda as medidas. A tela fica com lixo: a UI precisa redesenhar tudo depois.
+ */
+inline void run() {
+    pda_log(PDA_LOG_SYSTEM, PDA_LOG_USER, "Display bench: %s, SPI %lu Hz", DisplayBackend::name(),
+            (unsigned long)DisplayBackend::clock_hz());
+
+    size_t full_size = (size_t)TFT_WIDTH * TFT_HEIGHT * 2;
+    uint16_t* full = (uint16_t*)ps_malloc(full_size);
+    size_t band_size = (size_t)TFT_HEIGHT * 40 * 2;
+    uint16_t* band = (uint16_t*)heap_caps_malloc(band_size, MALLOC_CAP_DMA);
+    if (!full || !band) {
+        pda_log(PDA_LOG_SYSTEM, PDA_LOG_ERROR, "Display bench: out of memory");
+        free(full);
+        free(band);
+        return;
+    }
+    // Um degradê, para o painel mostrar que algo chegou
+    for (size_t i = 0; i < full_size / 2; i++) full[i] = (uint16_t)(i * 7);
+    memcpy(band, full, band_size);
+
+    measure("full", full, TFT_HEIGHT, TFT_WIDTH);
+    measure("bands", band, TFT_HEIGHT, 40);
+    measure("tiles", band, 32, 32);
+
+    // O degradê empacotado no próprio buffer, como o flush faz
+    lv_area_t screen = {0, 0, TFT_HEIGHT - 1, TFT_WIDTH - 1};
+    TftRgb444::pack(&screen, (const lv_color_t*)full, (uint8_t*)full);
+    const uint8_t colmod_444 = 0x53, colmod_565 = 0x55;
+    DisplayBackend::command(0x3A, &colmod_444, 1);
+    measure("full444", full, TFT_HEIGHT, TFT_WIDTH, true);
+    DisplayBackend::command(0x3A, &colmod_565, 1);
+
+    // Sem o modo automático, que mandaria os quadros seguidos do lvgl565 em 12 bits
+    TftRgb444::set_auto(false);
+    measure_lvgl("lvgl565", false);
+    measure_lvgl("lvgl444", true);
+    TftRgb444::set_auto(true);
+
+    free(full);
+    free(band);
+    lv_obj_invalidate(lv_scr_act());
+}
+
+} // namespace DisplayBench
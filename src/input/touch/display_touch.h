@@ -1,9 +1,15 @@
 #pragma once
-#include <TFT_eSPI.h>
 #include <lvgl.h>
 #include <Arduino.h>
 #include "TouchDrvGT911.hpp"
 #include "hardware/TDECK_PINS.h"
+#include "input/input_trace.h"
+#include "input/touch/display_backend.h"
+#include "system/sys_monitor.h"
+#include "system/pda_trace.h"
+#include "system/spi_bus.h"
+#include "system/tft_scroll.h"
+#include "system/tft_rgb444.h"
 
 /**
  * Driver de Display + Touch + LVGL para LilyGO T-Deck
@@ -12,6 +18,15 @@
  * configura o LVGL para renderização gráfica e fornece funções utilitárias
  * para ajuste de brilho e leitura de eventos de toque.
  *
+ * O painel é do DisplayBackend (input/touch/display_backend.h), escolhido no
+ * build: o flush manda as janelas e os pixels por ele, por DMA, e volta antes
+ * de eles chegarem ao ST7789.
+ *
+ * O LVGL desenha só as áreas invalidadas (refresh parcial). Containers que
+ * podem rolar no próprio ST7789 passam pelo TftScroll: a rolagem anda na GRAM
+ * e o flush remapeia as janelas (system/tft_scroll.h). Sequências de quadros
+ * de tela inteira vão em 12 bits por pixel (system/tft_rgb444.h).
+ *
  * Exemplo de uso:
  *
  * #include "input/display_touch.h"
@@ -30,9 +45,7 @@
 namespace DisplayTouch {
 
 #define LVGL_BUFFER_SIZE (TFT_WIDTH * TFT_HEIGHT * sizeof(lv_color_t))
-#define BRIGHTNESS_STEPS 16
 
-TFT_eSPI tft;
 TouchDrvGT911 touch;
 static lv_obj_t* slider_label;
 
@@ -41,39 +54,92 @@ static lv_obj_t* slider_label;
  * @param value Brilho entre 0 (mínimo) e 16 (máximo).
  */
 inline void set_brightness(uint8_t value) {
-    static uint8_t level = 0;
-    if (value == 0) {
-        digitalWrite(TDECK_TFT_BACKLIGHT, LOW);
-        delay(3);
-        level = 0;
-        return;
-    }
-    if (level == 0) {
-        digitalWrite(TDECK_TFT_BACKLIGHT, HIGH);
-        level = BRIGHTNESS_STEPS;
-        delayMicroseconds(30);
-    }
-    int from = BRIGHTNESS_STEPS - level;
-    int to = BRIGHTNESS_STEPS - value;
-    int num = (BRIGHTNESS_STEPS + to - from) % BRIGHTNESS_STEPS;
-    for (int i = 0; i < num; ++i) {
-        digitalWrite(TDECK_TFT_BACKLIGHT, LOW);
-        digitalWrite(TDECK_TFT_BACKLIGHT, HIGH);
+    DisplayBackend::set_brightness(value);
+}
+
+// Um flush é uma janela e os pixels por pedaço do TftScroll (uma área pode
+// virar até TFT_SCROLL_PIECES janelas), e o último flush do quadro leva o
+// VSCRDEF/VSCSAD. Quando o formato dos pixels muda (RGB565 ou RGB444), o COLMOD
+// vai antes da primeira janela. Só há um flush por vez.
+static lv_disp_drv_t* flush_disp = nullptr;
+#if SPI_BUS_ASYNC
+static TaskHandle_t flush_waiter = nullptr;
+#endif
+
+// Na tarefa do SpiBus ou, com o esp_lcd, na interrupção do fim do DMA
+static void flush_done(void*) {
+    SysMonitor::flush_end();
+    lv_disp_flush_ready(flush_disp);
+#if SPI_BUS_ASYNC
+    if (!flush_waiter) return;
+    if (xPortInIsrContext()) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(flush_waiter, &woken);
+        if (woken) portYIELD_FROM_ISR();
+    } else {
+        xTaskNotifyGive(flush_waiter);
     }
-    level = value;
+#endif
+}
+
+#if SPI_BUS_ASYNC
+/**
+ * O LVGL chama wait_cb em laço até o flush acabar: a UI dorme enquanto o DMA
+ * trabalha, em vez de girar no núcleo 1. O tempo limite cobre uma notificação
+ * perdida.
+ */
+static void disp_wait(lv_disp_drv_t*) {
+    flush_waiter = xTaskGetCurrentTaskHandle();
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(5));
 }
+#endif
 
 /**
- * Função de flush de tela, chamada pelo LVGL.
+ * render_start_cb: a rolagem pendente passa a valer para este quadro, que
+ * escolhe o formato dos pixels.
+ */
+static void disp_render_start(lv_disp_drv_t* drv) {
+    TftScroll::frame_begin();
+    TftRgb444::frame_begin(drv);
+    SysMonitor::render_start_cb(drv);
+}
+
+/**
+ * monitor_cb: fim do quadro.
+ */
+static void disp_monitor(lv_disp_drv_t* drv, uint32_t time_ms, uint32_t px) {
+    TftRgb444::frame_end();
+    SysMonitor::monitor_cb(drv, time_ms, px);
+}
+
+/**
+ * Função de flush de tela, chamada pelo LVGL. Enfileira a janela e os pixels
+ * no DisplayBackend e volta; lv_disp_flush_ready() vem no fim do DMA.
  */
 static void disp_flush(lv_disp_drv_t* disp, const lv_area_t* area, lv_color_t* color_p) {
-    uint32_t w = area->x2 - area->x1 + 1;
-    uint32_t h = area->y2 - area->y1 + 1;
-    tft.startWrite();
-    tft.setAddrWindow(area->x1, area->y1, w, h);
-    tft.pushColors((uint16_t*)&color_p->full, w * h, false);
-    tft.endWrite();
-    lv_disp_flush_ready(disp);
+    PDA_TRACE_SCOPE("disp_flush");
+    SysMonitor::flush_begin();
+    flush_disp = disp;
+    if (const uint8_t* colmod = TftRgb444::colmod()) DisplayBackend::command(0x3A, colmod, 1);
+
+    TftScroll::Piece pieces[TFT_SCROLL_PIECES];
+    uint8_t n = TftScroll::map(area, color_p, pieces);
+    bool rgb444 = TftRgb444::active();
+    // A rolagem muda depois dos pixels da faixa descoberta
+    TftScroll::Commands c = {};
+    if (lv_disp_flush_is_last(disp)) c = TftScroll::commands();
+    bool scroll = c.vscrdef || c.vscsad;
+    for (uint8_t i = 0; i < n; i++) {
+        const lv_area_t& a = pieces[i].area;
+        // RGB444: empacotado no próprio buffer, que o LVGL só volta a usar depois do flush_ready
+        uint32_t len = rgb444 ? TftRgb444::pack(&a, pieces[i].pixels, (uint8_t*)pieces[i].pixels)
+                              : lv_area_get_size(&a) * (uint32_t)sizeof(lv_color_t);
+        DisplayBackend::set_window(&a);
+        bool last = i + 1 == n && !scroll;
+        DisplayBackend::push(pieces[i].pixels, len, last ? flush_done : nullptr);
+    }
+    if (c.vscrdef) DisplayBackend::command(0x33, c.vscrdef, 6, c.vscsad ? nullptr : flush_done);
+    if (c.vscsad) DisplayBackend::command(0x37, c.vscsad, 2, flush_done);
 }
 
 /**
@@ -91,6 +157,7 @@ static void touchpad_read(lv_indev_drv_t* indev_driver, lv_indev_data_t* data) {
             data->point.y = y[0];
         }
     }
+    INPUT_TRACE_TOUCH(data->state == LV_INDEV_STATE_PR, data->point.x, data->point.y);
 }
 
 /**
@@ -111,11 +178,7 @@ inline void init() {
     digitalWrite(TDECK_TFT_CS, HIGH);
 
     pinMode(TDECK_SPI_MISO, INPUT_PULLUP);
-    SPI.begin(TDECK_SPI_SCK, TDECK_SPI_MISO, TDECK_SPI_MOSI);
-
-    tft.begin();
-    tft.setRotation(1);
-    tft.fillScreen(TFT_BLACK);
+    DisplayBackend::init(1); // Paisagem; liga o SpiBus
 
     pinMode(TDECK_TOUCH_INT, INPUT);
     delay(20);
@@ -145,9 +208,19 @@ inline void init() {
     disp_drv.hor_res = TFT_HEIGHT;
     disp_drv.ver_res = TFT_WIDTH;
     disp_drv.flush_cb = disp_flush;
+#if SPI_BUS_ASYNC
+    disp_drv.wait_cb = disp_wait;
+#endif
+    // Refresh parcial: o buffer comporta a tela toda, mas só as áreas
+    // invalidadas são desenhadas e enviadas
     disp_drv.draw_buf = &draw_buf;
-    disp_drv.full_refresh = 1;
+    // Tempos de render/flush de cada quadro para o app Monitor
+    disp_drv.render_start_cb = disp_render_start;
+    disp_drv.monitor_cb = disp_monitor;
     lv_disp_drv_register(&disp_drv);
+    SysMonitor::begin();
+    TftScroll::begin(DisplayBackend::rotation(), disp_drv.hor_res, disp_drv.ver_res);
+    TftRgb444::begin(disp_drv.hor_res, disp_drv.ver_res);
 
     static lv_indev_drv_t indev_drv;
     lv_indev_drv_init(&indev_drv);
@@ -1,6 +1,7 @@
 #pragma once
 #include "hardware/TDECK_PINS.h"
 #include <Arduino.h>
+#include "input/input_trace.h"
 
 /**
  * Trackball driver for LilyGO T-Deck
@@ -100,6 +101,7 @@ inline void clear_events() {
 inline bool moved_up() {
     if (interrupted && up_count > 1) {
         clear_events();
+        INPUT_TRACE_BALL("up");
         return true;
     }
     return false;
@@ -107,6 +109,7 @@ inline bool moved_up() {
 inline bool moved_down() {
     if (interrupted && down_count > 1) {
         clear_events();
+        INPUT_TRACE_BALL("down");
         return true;
     }
     return false;
@@ -114,6 +117,7 @@ inline bool moved_down() {
 inline bool moved_left() {
     if (interrupted && left_count > 1) {
         clear_events();
+        INPUT_TRACE_BALL("left");
         return true;
     }
     return false;
@@ -121,6 +125,7 @@ inline bool moved_left() {
 inline bool moved_right() {
     if (interrupted && right_count > 1) {
         clear_events();
+        INPUT_TRACE_BALL("right");
         return true;
     }
     return false;
@@ -128,6 +133,7 @@ inline bool moved_right() {
 inline bool clicked() {
     if (interrupted && click_count > 0) {
         clear_events();
+        INPUT_TRACE_BALL("click");
         return true;
     }
     return false;
@@ -1,16 +1,36 @@
 #include "input/input.h"
 #include "apps/apps.h"
+#include "system/asset_pack.h"
+#include "system/pda_trace.h"
+#include "system/stall_detector.h"
+#include "system/alloc_trace.h"
+#include "system/pda_log.h"
+#include "system/sd_card.h"
+#include "input/touch/display_bench.h"
 
 void setup() {
     Serial.begin(115200);
+    pda_log_begin(); // Logs (LV_LOG_* e pda_log) escritos por uma tarefa de baixa prioridade
     DisplayTouch::init();
+#if DISPLAY_BENCH
+    DisplayBench::run(); // Vazão do flush do DisplayBackend, no log (só com -DDISPLAY_BENCH=1)
+#endif
+    AssetPack::init(); // Ícones na partição "assets", precisa do lv_init()
+    SdCard::begin();   // Driver 'S:' do LVGL; o cartão monta numa tarefa, sem segurar o boot
     Trackball::init();
     // AppManager::init() inicializa todos os aplicativos, incluindo o MainMenu,
     // e exibe a tela inicial. Esta é a única chamada de inicialização de UI necessária.
     AppManager::init();
+    // Rastreio de alocações (só com -DALLOC_TRACE=1): o boot fica de fora
+    AllocTrace::begin();
+    // No fim do setup(): o boot não conta como travamento da UI
+    StallDetector::begin();
 }
 
 void loop() {
     AppManager::handle(); // O AppManager agora decide qual app gerenciar.
+    PDA_TRACE_DRAIN();    // Eventos de trace para a USB (só com -DPDA_TRACE=1)
+    AllocTrace::drain();  // Registros de alocação para a USB (só com -DALLOC_TRACE=1)
+    StallDetector::heartbeat(); // Fim de uma volta: a UI não está travada
     delay(5); // Pequeno delay para evitar sobrecarga da CPU
 }
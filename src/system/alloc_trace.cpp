@@ -0,0 +1,332 @@
+#include "alloc_trace.h"
+
+#if ALLOC_TRACE
+
+#include <esp_heap_caps.h>
+#include <string.h>
+#if defined(ESP_PLATFORM)
+#include <esp_debug_helpers.h>
+#else
+#include <execinfo.h>
+#endif
+
+namespace {
+
+static_assert((ALLOC_TRACE_RING & (ALLOC_TRACE_RING - 1)) == 0, "ALLOC_TRACE_RING must be a power of 2");
+
+// Mesmo formato de quadro do pda_trace: sincronismo + tipo + tamanho + soma
+constexpr uint8_t SYNC[4] = {0x00, 0xA5, 'P', 'T'};
+constexpr size_t FRAME_OVERHEAD = sizeof(SYNC) + 1 + 2 + 1;
+constexpr uint16_t RECORDS_PER_FRAME = 32;
+
+// Anel único para os dois núcleos: a alocação já passa pela trava do heap,
+// uma trava a mais aqui não muda o custo. tail só é escrito pelo drain().
+alloc_trace_record_t* records = nullptr;
+volatile uint32_t head = 0;
+volatile uint32_t tail = 0;
+volatile uint32_t dropped = 0;
+uint32_t dropped_reported = 0;
+portMUX_TYPE ring_mux = portMUX_INITIALIZER_UNLOCKED;
+volatile bool active = false;
+
+// Aninhamento por tarefa: o malloc de dentro do pda_mem ou do JsonDocument
+// não é gravado de novo, e outra tarefa no mesmo núcleo não é afetada.
+__thread uint8_t nesting = 0;
+
+const char* labels[ALLOC_TRACE_MAX_LABELS];
+uint32_t label_count = 0;
+uint32_t labels_sent = 0;
+
+uint8_t frame[FRAME_OVERHEAD + RECORDS_PER_FRAME * sizeof(alloc_trace_record_t)];
+
+/**
+ * @brief Endereço de retorno do Xtensa (com os bits da janela) -> endereço da call.
+ */
+uint32_t call_pc(uint32_t pc) {
+    if (pc & 0x80000000) pc = (pc & 0x3FFFFFFF) | 0x40000000;
+    return pc - 3;
+}
+
+/**
+ * @brief Até ALLOC_TRACE_DEPTH endereços, começando por quem chamou o alocador
+ * que chamou o record(). Nenhum dos três pode ser inline.
+ */
+__attribute__((noinline)) uint8_t capture(uint32_t* pcs) {
+    uint8_t n = 0;
+#if defined(ESP_PLATFORM)
+    esp_backtrace_frame_t bt;
+    esp_backtrace_get_start(&bt.pc, &bt.sp, &bt.next_pc);
+    // Pula o capture(), o record() e o alocador (ex: __wrap_malloc)
+    for (int skip = 0; skip < 2 && bt.next_pc; skip++) {
+        if (!esp_backtrace_get_next_frame(&bt)) return 0;
+    }
+    while (n < ALLOC_TRACE_DEPTH && bt.next_pc) {
+        if (!esp_backtrace_get_next_frame(&bt)) break;
+        pcs[n++] = call_pc(bt.pc);
+    }
+#else
+    void* frames[ALLOC_TRACE_DEPTH + 3];
+    int got = backtrace(frames, ALLOC_TRACE_DEPTH + 3);
+    for (int i = 3; i < got; i++) pcs[n++] = (uint32_t)(uintptr_t)frames[i] - 1;
+#endif
+    return n;
+}
+
+void push(AllocTraceOp op, AllocTraceKind kind, uint32_t ptr, uint32_t size, const uint32_t* pcs, uint8_t depth) {
+    portENTER_CRITICAL(&ring_mux);
+    uint32_t h = head;
+    if (h - tail < ALLOC_TRACE_RING) {
+        alloc_trace_record_t& r = records[h & (ALLOC_TRACE_RING - 1)];
+        r.ts_us = micros();
+        r.ptr = ptr;
+        r.size = size;
+        r.op = op;
+        r.kind = kind;
+        r.core = (uint8_t)xPortGetCoreID();
+        r.depth = depth;
+        memcpy(r.pcs, pcs, depth * sizeof(uint32_t));
+        memset(r.pcs + depth, 0, (ALLOC_TRACE_DEPTH - depth) * sizeof(uint32_t));
+        __atomic_store_n(&head, h + 1, __ATOMIC_RELEASE);
+    } else {
+        dropped = dropped + 1;
+    }
+    portEXIT_CRITICAL(&ring_mux);
+}
+
+bool send_frame(uint8_t type, const void* a, size_t a_len, const void* b, size_t b_len) {
+    size_t len = a_len + b_len;
+    size_t total = FRAME_OVERHEAD + len;
+    if ((size_t)Serial.availableForWrite() < total) return false;
+
+    uint8_t* p = frame;
+    memcpy(p, SYNC, sizeof(SYNC));
+    p += sizeof(SYNC);
+    *p++ = type;
+    *p++ = (uint8_t)(len & 0xFF);
+    *p++ = (uint8_t)(len >> 8);
+    memcpy(p, a, a_len);
+    memcpy(p + a_len, b, b_len);
+    uint8_t sum = 0;
+    for (size_t i = 0; i < len; i++) sum += p[i];
+    p[len] = sum;
+    Serial.write(frame, total);
+    return true;
+}
+
+void put_u32(uint8_t* out, uint32_t v) {
+    out[0] = (uint8_t)v;
+    out[1] = (uint8_t)(v >> 8);
+    out[2] = (uint8_t)(v >> 16);
+    out[3] = (uint8_t)(v >> 24);
+}
+
+bool send_labels() {
+    while (labels_sent < label_count) {
+        uint8_t id[4];
+        put_u32(id, labels_sent);
+        const char* label = labels[labels_sent];
+        if (!send_frame(ALLOC_TRACE_FRAME_LABEL, id, sizeof(id), label, strlen(label))) return false;
+        labels_sent++;
+    }
+    return true;
+}
+
+bool send_records() {
+    uint32_t d = dropped;
+    if (d != dropped_reported) {
+        uint8_t count[4];
+        put_u32(count, d - dropped_reported);
+        if (!send_frame(ALLOC_TRACE_FRAME_DROPPED, count, sizeof(count), nullptr, 0)) return false;
+        dropped_reported = d;
+    }
+
+    uint32_t h = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+    while (tail != h) {
+        uint32_t t = tail;
+        uint32_t n = h - t;
+        if (n > RECORDS_PER_FRAME) n = RECORDS_PER_FRAME;
+        // Não dá a volta no anel dentro de um quadro
+        uint32_t start = t & (ALLOC_TRACE_RING - 1);
+        if (start + n > ALLOC_TRACE_RING) n = ALLOC_TRACE_RING - start;
+        if (!send_frame(ALLOC_TRACE_FRAME_RECORDS, &records[start], n * sizeof(alloc_trace_record_t), nullptr, 0)) {
+            return false;
+        }
+        __atomic_store_n(&tail, t + n, __ATOMIC_RELEASE);
+    }
+    return true;
+}
+
+/**
+ * @brief Alocador do ArduinoJson: o malloc por baixo fica fora do trace (aninhado).
+ */
+class JsonAllocator : public ArduinoJson::Allocator {
+public:
+    void* allocate(size_t size) override {
+        AllocTrace::Scope scope;
+        void* ptr = malloc(size);
+        if (scope.traced()) AllocTrace::record(ALLOC_TRACE_ALLOC, ALLOC_TRACE_JSON, ptr, size);
+        return ptr;
+    }
+
+    void deallocate(void* ptr) override {
+        AllocTrace::Scope scope;
+        if (scope.traced() && ptr) AllocTrace::record(ALLOC_TRACE_FREE, ALLOC_TRACE_JSON, ptr, 0);
+        free(ptr);
+    }
+
+    void* reallocate(void* ptr, size_t new_size) override {
+        AllocTrace::Scope scope;
+        void* moved = realloc(ptr, new_size);
+        if (scope.traced()) AllocTrace::record_realloc(ALLOC_TRACE_JSON, ptr, moved, new_size);
+        return moved;
+    }
+};
+
+JsonAllocator json_allocator;
+
+} // namespace
+
+namespace AllocTrace {
+
+Scope::Scope() : entered_(active), traced_(false) {
+    if (entered_) traced_ = nesting++ == 0;
+}
+
+Scope::~Scope() {
+    if (entered_) nesting--;
+}
+
+__attribute__((noinline)) void record(AllocTraceOp op, AllocTraceKind kind, const void* ptr, size_t size) {
+    uint32_t pcs[ALLOC_TRACE_DEPTH];
+    uint8_t depth = op == ALLOC_TRACE_FREE ? 0 : capture(pcs);
+    push(op, kind, (uint32_t)(uintptr_t)ptr, (uint32_t)size, pcs, depth);
+}
+
+__attribute__((noinline)) void record_realloc(AllocTraceKind kind, const void* old, const void* ptr, size_t size) {
+    uint32_t pcs[ALLOC_TRACE_DEPTH];
+    uint8_t depth = capture(pcs);
+    // Falha (ptr nulo com size > 0) mantém o bloco antigo vivo
+    if (old && (ptr || size == 0)) push(ALLOC_TRACE_FREE, kind, (uint32_t)(uintptr_t)old, 0, pcs, 0);
+    if (size) push(ALLOC_TRACE_ALLOC, kind, (uint32_t)(uintptr_t)ptr, (uint32_t)size, pcs, depth);
+}
+
+void begin() {
+    if (records) return;
+    records = (alloc_trace_record_t*)heap_caps_malloc(ALLOC_TRACE_RING * sizeof(alloc_trace_record_t),
+                                                       MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!records) {
+        Serial.println("[at] sem PSRAM para o anel; rastreio desligado");
+        return;
+    }
+    Serial.printf("[at] rastreio de alocações: %u registros de %u bytes\n", (unsigned)ALLOC_TRACE_RING,
+                  (unsigned)sizeof(alloc_trace_record_t));
+    active = true;
+}
+
+void drain() {
+    if (!records) return;
+    // Rótulos antes dos registros que os usam; o que não couber fica para a próxima
+    Scope scope;
+    if (!send_labels()) return;
+    send_records();
+}
+
+void mark(const char* label) {
+    if (!active) return;
+    uint32_t id = 0;
+    portENTER_CRITICAL(&ring_mux);
+    for (; id < label_count; id++) {
+        if (labels[id] == label || strcmp(labels[id], label) == 0) break;
+    }
+    if (id == label_count) {
+        if (label_count < ALLOC_TRACE_MAX_LABELS) labels[label_count++] = label;
+        else id = ALLOC_TRACE_MAX_LABELS - 1; // Tabela cheia: divide o último id
+    }
+    portEXIT_CRITICAL(&ring_mux);
+    push(ALLOC_TRACE_MARK, ALLOC_TRACE_MALLOC, id, 0, nullptr, 0);
+}
+
+ArduinoJson::Allocator* json() {
+    return &json_allocator;
+}
+
+} // namespace AllocTrace
+
+#if ALLOC_TRACE_LIBC
+
+// Com -Wl,--wrap=X, toda chamada a X no link vira __wrap_X, e __real_X é o original
+extern "C" {
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+#if defined(ESP_PLATFORM)
+void* __real_heap_caps_malloc(size_t size, uint32_t caps);
+void* __real_heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void* __real_heap_caps_realloc(void* ptr, size_t size, uint32_t caps);
+void __real_heap_caps_free(void* ptr);
+#endif
+
+void* __wrap_malloc(size_t size) {
+    AllocTrace::Scope scope;
+    void* ptr = __real_malloc(size);
+    if (scope.traced()) AllocTrace::record(ALLOC_TRACE_ALLOC, ALLOC_TRACE_MALLOC, ptr, size);
+    return ptr;
+}
+
+void* __wrap_calloc(size_t n, size_t size) {
+    AllocTrace::Scope scope;
+    void* ptr = __real_calloc(n, size);
+    if (scope.traced()) AllocTrace::record(ALLOC_TRACE_ALLOC, ALLOC_TRACE_MALLOC, ptr, n * size);
+    return ptr;
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    AllocTrace::Scope scope;
+    void* moved = __real_realloc(ptr, size);
+    if (scope.traced()) AllocTrace::record_realloc(ALLOC_TRACE_MALLOC, ptr, moved, size);
+    return moved;
+}
+
+void __wrap_free(void* ptr) {
+    AllocTrace::Scope scope;
+    if (scope.traced() && ptr) AllocTrace::record(ALLOC_TRACE_FREE, ALLOC_TRACE_MALLOC, ptr, 0);
+    __real_free(ptr);
+}
+
+#if defined(ESP_PLATFORM)
+// No host o heap_caps_* do shim é inline e cai no malloc acima
+void* __wrap_heap_caps_malloc(size_t size, uint32_t caps) {
+    AllocTrace::Scope scope;
+    void* ptr = __real_heap_caps_malloc(size, caps);
+    if (scope.traced()) AllocTrace::record(ALLOC_TRACE_ALLOC, ALLOC_TRACE_HEAP_CAPS, ptr, size);
+    return ptr;
+}
+
+void* __wrap_heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    AllocTrace::Scope scope;
+    void* ptr = __real_heap_caps_calloc(n, size, caps);
+    if (scope.traced()) AllocTrace::record(ALLOC_TRACE_ALLOC, ALLOC_TRACE_HEAP_CAPS, ptr, n * size);
+    return ptr;
+}
+
+void* __wrap_heap_caps_realloc(void* ptr, size_t size, uint32_t caps) {
+    AllocTrace::Scope scope;
+    void* moved = __real_heap_caps_realloc(ptr, size, caps);
+    if (scope.traced()) AllocTrace::record_realloc(ALLOC_TRACE_HEAP_CAPS, ptr, moved, size);
+    return moved;
+}
+
+void __wrap_heap_caps_free(void* ptr) {
+    AllocTrace::Scope scope;
+    if (scope.traced() && ptr) AllocTrace::record(ALLOC_TRACE_FREE, ALLOC_TRACE_HEAP_CAPS, ptr, 0);
+    __real_heap_caps_free(ptr);
+}
+#endif
+
+} // extern "C"
+
+#endif /*ALLOC_TRACE_LIBC*/
+
+#endif /*ALLOC_TRACE*/
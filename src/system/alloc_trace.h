@@ -0,0 +1,179 @@
+#pragma once
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+/**
+ * AllocTrace - Rastreio de alocações com atribuição por call site
+ *
+ * Modo de diagnóstico (desligado por padrão) que grava cada alocação e
+ * liberação num anel compacto na PSRAM: tamanho, ponteiro, micros() e os
+ * ALLOC_TRACE_DEPTH endereços de retorno de quem pediu a memória. O
+ * tools/alloc_trace/alloc_report.py casa alocação com liberação (o tempo de
+ * vida sai da diferença) e agrupa por call site:
+ *
+ * - Churn: quantas alocações e quantos bytes cada site pediu, e quantas
+ *   viveram menos de um quadro (String temporária, JsonDocument de uma busca).
+ * - Vazamentos: o que continuava vivo no fim da captura e quanto a memória
+ *   viva cresce a cada volta ao menu (abrir e fechar cada app 100 vezes com
+ *   tools/simulator/traces/app_cycle.trace ou à mão no aparelho).
+ *
+ * Alocadores cobertos (o tipo vai em cada registro):
+ * - ALLOC_TRACE_LVGL: pda_mem_alloc/free/realloc, o alocador do LVGL.
+ * - ALLOC_TRACE_JSON: JsonDocuments criados com AllocTrace::json().
+ * - ALLOC_TRACE_MALLOC e ALLOC_TRACE_HEAP_CAPS: malloc/calloc/realloc/free e
+ *   heap_caps_*, com ALLOC_TRACE_LIBC e o --wrap do linker (ver platformio.ini).
+ *   Cobre new/delete, String, HTTPClient, Wi-Fi e o ps_malloc.
+ *
+ * Uma alocação feita dentro de outra rastreada (o chunk da arena pedido pelo
+ * pda_mem, o malloc do JsonDocument) não é gravada de novo: o contador de
+ * aninhamento é por tarefa.
+ *
+ * Os registros saem pelo Serial em AllocTrace::drain(), chamado no loop(), nos
+ * mesmos quadros binários do pda_trace (sincronismo 00 A5 'P' 'T'), com tipos
+ * próprios; os dois traces podem ficar ligados juntos. O texto do Serial
+ * continua no mesmo fluxo.
+ *
+ * Custo com ALLOC_TRACE 1: um backtrace e uma trava por alocação e o anel de
+ * ALLOC_TRACE_RING registros na PSRAM. Com ALLOC_TRACE 0 nada é compilado e
+ * AllocTrace::json() é o alocador padrão do ArduinoJson.
+ *
+ * 🧮 Exemplo de uso:
+ *
+ * ; platformio.ini
+ * build_flags = ... -DALLOC_TRACE=1 -Wl,--wrap=malloc -Wl,--wrap=free ...
+ *
+ * void setup() {
+ *     ...
+ *     AllocTrace::begin();
+ * }
+ *
+ * void loop() {
+ *     AppManager::handle();
+ *     AllocTrace::drain();
+ * }
+ *
+ * JsonDocument doc(AllocTrace::json());
+ * AllocTrace::mark("Notes");   // Separa os registros por app no relatório
+ *
+ * $ python tools/alloc_trace/alloc_report.py --port /dev/ttyACM0 --seconds 120 \
+ *       --elf .pio/build/T-Deck/firmware.elf
+ */
+
+#ifndef ALLOC_TRACE
+#define ALLOC_TRACE 0
+#endif
+
+/*Grava também malloc/free e heap_caps_*; exige os -Wl,--wrap=... no link*/
+#ifndef ALLOC_TRACE_LIBC
+#define ALLOC_TRACE_LIBC ALLOC_TRACE
+#endif
+
+/*Registros no anel (na PSRAM); potência de 2*/
+#ifndef ALLOC_TRACE_RING
+#define ALLOC_TRACE_RING 8192
+#endif
+
+/*Endereços de retorno guardados por alocação*/
+#ifndef ALLOC_TRACE_DEPTH
+#define ALLOC_TRACE_DEPTH 8
+#endif
+
+/*Rótulos distintos em mark()*/
+#ifndef ALLOC_TRACE_MAX_LABELS
+#define ALLOC_TRACE_MAX_LABELS 32
+#endif
+
+/*Tipos de quadro; os do pda_trace vão de 1 a 3*/
+#define ALLOC_TRACE_FRAME_RECORDS 16  // registros alloc_trace_record_t
+#define ALLOC_TRACE_FRAME_LABEL   17  // id (4), texto da marca sem terminador
+#define ALLOC_TRACE_FRAME_DROPPED 18  // descartados desde o último aviso (4)
+
+enum AllocTraceOp : uint8_t {
+    ALLOC_TRACE_ALLOC,
+    ALLOC_TRACE_FREE,
+    ALLOC_TRACE_MARK    // ptr = id da marca (quadro ALLOC_TRACE_FRAME_LABEL)
+};
+
+enum AllocTraceKind : uint8_t {
+    ALLOC_TRACE_MALLOC,
+    ALLOC_TRACE_HEAP_CAPS,
+    ALLOC_TRACE_LVGL,
+    ALLOC_TRACE_JSON
+};
+
+struct alloc_trace_record_t {
+    uint32_t ts_us;     // micros() da operação
+    uint32_t ptr;       // Bloco alocado/liberado
+    uint32_t size;      // Bytes pedidos (0 na liberação)
+    uint8_t op;         // AllocTraceOp
+    uint8_t kind;       // AllocTraceKind
+    uint8_t core;
+    uint8_t depth;      // Endereços válidos em pcs
+    uint32_t pcs[ALLOC_TRACE_DEPTH]; // pcs[0] chamou o alocador
+};
+
+namespace AllocTrace {
+
+#if ALLOC_TRACE
+
+/**
+ * @brief Reserva o anel e começa a gravar. Alocações anteriores não aparecem;
+ * suas liberações são ignoradas pelo relatório.
+ */
+void begin();
+
+/**
+ * @brief Envia pelo Serial o que couber no buffer de transmissão.
+ */
+void drain();
+
+/**
+ * @brief Separa os registros seguintes com um rótulo (ex: o app aberto).
+ * O texto precisa viver até o drain(); use literais.
+ */
+void mark(const char* label);
+
+/**
+ * @brief Delimita a chamada a um alocador. traced() só é verdadeiro no nível
+ * mais externo da tarefa: as alocações internas não são gravadas de novo.
+ */
+class Scope {
+public:
+    Scope();
+    ~Scope();
+    bool traced() const { return traced_; }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    bool entered_;
+    bool traced_;
+};
+
+/**
+ * @brief Grava uma operação com o backtrace de quem chamou. Use dentro de um
+ * Scope com traced() verdadeiro.
+ */
+void record(AllocTraceOp op, AllocTraceKind kind, const void* ptr, size_t size);
+
+/**
+ * @brief Grava um realloc de `old` que devolveu `ptr`: liberação do bloco
+ * antigo e alocação do novo, com o mesmo backtrace.
+ */
+void record_realloc(AllocTraceKind kind, const void* old, const void* ptr, size_t size);
+
+/**
+ * @brief Alocador do ArduinoJson que grava como ALLOC_TRACE_JSON.
+ */
+ArduinoJson::Allocator* json();
+
+#else
+
+inline void begin() {}
+inline void drain() {}
+inline void mark(const char*) {}
+inline ArduinoJson::Allocator* json() { return ArduinoJson::detail::DefaultAllocator::instance(); }
+
+#endif
+
+} // namespace AllocTrace
@@ -0,0 +1,387 @@
+#include "asset_pack.h"
+#include <Arduino.h>
+#include <esp_partition.h>
+#include <esp_heap_caps.h>
+#include <string.h>
+
+namespace {
+
+// Formato gerado por tools/assets/pack_assets.py (little-endian).
+struct PackHeader {
+    char magic[4];        // "PDAP"
+    uint16_t version;
+    uint16_t count;
+    uint32_t total_size;
+    uint32_t reserved;
+};
+
+struct PackEntry {
+    char name[28];
+    uint8_t type;
+    uint8_t codec;
+    uint8_t cf;
+    uint8_t flags;
+    uint16_t w;
+    uint16_t h;
+    uint32_t offset;
+    uint32_t size;
+    uint32_t raw_size;
+};
+static_assert(sizeof(PackHeader) == 16, "PackHeader layout must match pack_assets.py");
+static_assert(sizeof(PackEntry) == 48, "PackEntry layout must match pack_assets.py");
+
+constexpr uint16_t PACK_VERSION = 1;
+constexpr uint8_t TYPE_IMAGE = 0;
+constexpr uint8_t CODEC_RAW = 0;
+constexpr uint8_t CODEC_LZ4 = 1;
+constexpr esp_partition_subtype_t PARTITION_SUBTYPE = (esp_partition_subtype_t)0x40;
+
+// Arquivo aberto pelo driver do LVGL.
+struct AssetFile {
+    const uint8_t* data;   // Direto na flash (raw) ou no buffer descomprimido
+    uint8_t* owned;        // Buffer descomprimido, liberado no close
+    uint32_t size;
+    uint32_t pos;
+};
+
+const uint8_t* pack = nullptr;
+const PackHeader* header = nullptr;
+const PackEntry* entries = nullptr;
+spi_flash_mmap_handle_t mmap_handle;
+AssetPack::Stats stats;
+lv_fs_drv_t fs_drv;
+
+/**
+ * @brief Descompressor de blocos LZ4. Retorna false se os dados estiverem
+ * corrompidos ou não produzirem exatamente dst_size bytes.
+ */
+bool lz4_decompress(const uint8_t* src, uint32_t src_size, uint8_t* dst, uint32_t dst_size) {
+    const uint8_t* ip = src;
+    const uint8_t* iend = src + src_size;
+    uint8_t* op = dst;
+    uint8_t* oend = dst + dst_size;
+
+    while (ip < iend) {
+        uint8_t token = *ip++;
+
+        uint32_t lit = token >> 4;
+        if (lit == 15) {
+            uint8_t b;
+            do {
+                if (ip >= iend) return false;
+                b = *ip++;
+                lit += b;
+            } while (b == 255);
+        }
+        if (lit > (uint32_t)(iend - ip) || lit > (uint32_t)(oend - op)) return false;
+        memcpy(op, ip, lit);
+        op += lit;
+        ip += lit;
+        if (ip >= iend) break; // A última sequência só tem literais
+
+        if (iend - ip < 2) return false;
+        uint32_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (uint32_t)(op - dst)) return false;
+
+        uint32_t len = (token & 15) + 4;
+        if ((token & 15) == 15) {
+            uint8_t b;
+            do {
+                if (ip >= iend) return false;
+                b = *ip++;
+                len += b;
+            } while (b == 255);
+        }
+        if (len > (uint32_t)(oend - op)) return false;
+
+        const uint8_t* match = op - offset;
+        if (offset >= len) {
+            memcpy(op, match, len);
+            op += len;
+        } else {
+            while (len--) *op++ = *match++; // Sobreposição: repete o padrão
+        }
+    }
+    return op == oend;
+}
+
+const PackEntry* find(const char* name) {
+    if (!entries) return nullptr;
+    int lo = 0;
+    int hi = (int)header->count - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        int cmp = strncmp(name, entries[mid].name, sizeof(entries[mid].name));
+        if (cmp == 0) return &entries[mid];
+        if (cmp < 0) hi = mid - 1;
+        else lo = mid + 1;
+    }
+    return nullptr;
+}
+
+// "A:launcher/notes_80" -> entrada "launcher/notes_80"
+const PackEntry* find_path(const void* src) {
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_FILE) return nullptr;
+    const char* path = (const char*)src;
+    if (path[0] != ASSET_PACK_LETTER || path[1] != ':') return nullptr;
+    return find(path + 2);
+}
+
+/**
+ * @brief Descomprime a entrada em `dst` (raw_size bytes). O pacote guarda RGB565
+ * sem swap; aqui as cores são convertidas para a ordem do lv_color_t.
+ */
+bool decode(const PackEntry* e, uint8_t* dst) {
+    const uint8_t* src = pack + e->offset;
+    uint32_t t0 = micros();
+
+    bool ok = true;
+    if (e->codec == CODEC_LZ4) ok = lz4_decompress(src, e->size, dst, e->raw_size);
+    else if (e->codec == CODEC_RAW && e->size == e->raw_size) memcpy(dst, src, e->raw_size);
+    else ok = false;
+
+#if LV_COLOR_16_SWAP
+    if (ok && e->type == TYPE_IMAGE && e->cf == LV_IMG_CF_RGB565A8) {
+        uint8_t* p = dst;
+        uint8_t* end = dst + (uint32_t)e->w * e->h * 2;
+        for (; p < end; p += 2) {
+            uint8_t t = p[0];
+            p[0] = p[1];
+            p[1] = t;
+        }
+    }
+#endif
+
+    if (!ok) {
+        stats.failures++;
+        LV_LOG_WARN("AssetPack: corrupted entry %.28s", e->name);
+        return false;
+    }
+    stats.decodes++;
+    stats.decoded_bytes += e->raw_size;
+    stats.decode_us += micros() - t0;
+    return true;
+}
+
+uint8_t* alloc_psram(uint32_t size) {
+    uint8_t* buf = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (!buf) buf = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_8BIT);
+    if (!buf) stats.failures++;
+    return buf;
+}
+
+// --- Decoder de imagens do LVGL ---
+
+lv_res_t decoder_info(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* img_header) {
+    LV_UNUSED(decoder);
+    const PackEntry* e = find_path(src);
+    if (!e || e->type != TYPE_IMAGE) return LV_RES_INV;
+
+    img_header->always_zero = 0;
+    img_header->cf = e->cf;
+    img_header->w = e->w;
+    img_header->h = e->h;
+    return LV_RES_OK;
+}
+
+lv_res_t decoder_open(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    LV_UNUSED(decoder);
+    const PackEntry* e = find_path(dsc->src);
+    if (!e || e->type != TYPE_IMAGE) return LV_RES_INV;
+
+    // Descompressão preguiçosa: só acontece quando a imagem vai ser desenhada
+    // e não está no cache de imagens do LVGL.
+    uint8_t* buf = alloc_psram(e->raw_size);
+    if (!buf) return LV_RES_INV;
+    if (!decode(e, buf)) {
+        heap_caps_free(buf);
+        return LV_RES_INV;
+    }
+    dsc->img_data = buf;
+    return LV_RES_OK;
+}
+
+void decoder_close(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc) {
+    LV_UNUSED(decoder);
+    if (dsc->img_data) {
+        heap_caps_free((void*)dsc->img_data);
+        dsc->img_data = nullptr;
+    }
+}
+
+// --- Driver de arquivos do LVGL (somente leitura) ---
+
+void* fs_open(lv_fs_drv_t* drv, const char* path, lv_fs_mode_t mode) {
+    LV_UNUSED(drv);
+    if (mode != LV_FS_MODE_RD) return nullptr;
+    const PackEntry* e = find(path);
+    if (!e) return nullptr;
+
+    AssetFile* f = (AssetFile*)lv_mem_alloc(sizeof(AssetFile));
+    if (!f) return nullptr;
+    f->owned = nullptr;
+    f->size = e->raw_size;
+    f->pos = 0;
+
+    if (e->codec == CODEC_RAW) {
+        f->data = pack + e->offset; // Lido direto da flash mapeada
+    } else {
+        f->owned = alloc_psram(e->raw_size);
+        if (!f->owned || !decode(e, f->owned)) {
+            if (f->owned) heap_caps_free(f->owned);
+            lv_mem_free(f);
+            return nullptr;
+        }
+        f->data = f->owned;
+    }
+    return f;
+}
+
+lv_fs_res_t fs_close(lv_fs_drv_t* drv, void* file_p) {
+    LV_UNUSED(drv);
+    AssetFile* f = (AssetFile*)file_p;
+    if (f->owned) heap_caps_free(f->owned);
+    lv_mem_free(f);
+    return LV_FS_RES_OK;
+}
+
+lv_fs_res_t fs_read(lv_fs_drv_t* drv, void* file_p, void* buf, uint32_t btr, uint32_t* br) {
+    LV_UNUSED(drv);
+    AssetFile* f = (AssetFile*)file_p;
+    uint32_t n = f->size - f->pos;
+    if (n > btr) n = btr;
+    memcpy(buf, f->data + f->pos, n);
+    f->pos += n;
+    if (br) *br = n;
+    return LV_FS_RES_OK;
+}
+
+lv_fs_res_t fs_seek(lv_fs_drv_t* drv, void* file_p, uint32_t pos, lv_fs_whence_t whence) {
+    LV_UNUSED(drv);
+    AssetFile* f = (AssetFile*)file_p;
+    int64_t target = pos;
+    if (whence == LV_FS_SEEK_CUR) target += f->pos;
+    else if (whence == LV_FS_SEEK_END) target += f->size;
+    if (target < 0 || target > f->size) return LV_FS_RES_INV_PARAM;
+    f->pos = (uint32_t)target;
+    return LV_FS_RES_OK;
+}
+
+lv_fs_res_t fs_tell(lv_fs_drv_t* drv, void* file_p, uint32_t* pos_p) {
+    LV_UNUSED(drv);
+    *pos_p = ((AssetFile*)file_p)->pos;
+    return LV_FS_RES_OK;
+}
+
+/**
+ * @brief Confere o cabeçalho e se todas as entradas cabem no pacote. Uma imagem
+ * precisa ter exatamente os bytes que o LVGL vai ler de w*h no seu formato, e
+ * uma entrada sem compressão, o mesmo tamanho dentro e fora do pacote.
+ */
+bool validate(const uint8_t* data, uint32_t partition_size) {
+    const PackHeader* h = (const PackHeader*)data;
+    if (memcmp(h->magic, "PDAP", 4) != 0 || h->version != PACK_VERSION) return false;
+    if (h->total_size > partition_size) return false;
+    if (sizeof(PackHeader) + (uint32_t)h->count * sizeof(PackEntry) > h->total_size) return false;
+
+    const PackEntry* e = (const PackEntry*)(data + sizeof(PackHeader));
+    for (uint16_t i = 0; i < h->count; i++) {
+        if (e[i].offset > h->total_size || e[i].size > h->total_size - e[i].offset) return false;
+        if (e[i].name[sizeof(e[i].name) - 1] != '\0') return false;
+        if (e[i].codec == CODEC_RAW && e[i].size != e[i].raw_size) return false;
+        if (e[i].type == TYPE_IMAGE) {
+            if (e[i].w == 0 || e[i].h == 0) return false;
+            if (e[i].raw_size != lv_img_buf_get_img_size(e[i].w, e[i].h, (lv_img_cf_t)e[i].cf)) return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+namespace AssetPack {
+
+bool init() {
+    if (pack) return true;
+
+    const esp_partition_t* part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, PARTITION_SUBTYPE, "assets");
+    if (!part) {
+        LV_LOG_WARN("AssetPack: no 'assets' partition");
+        return false;
+    }
+
+    const void* mapped = nullptr;
+    if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &mapped, &mmap_handle) != ESP_OK) {
+        LV_LOG_WARN("AssetPack: mmap failed");
+        return false;
+    }
+    if (!validate((const uint8_t*)mapped, part->size)) {
+        LV_LOG_WARN("AssetPack: invalid pack, flash it with 'pio run -t upload_assets'");
+        spi_flash_munmap(mmap_handle);
+        return false;
+    }
+
+    pack = (const uint8_t*)mapped;
+    header = (const PackHeader*)pack;
+    entries = (const PackEntry*)(pack + sizeof(PackHeader));
+    stats.entries = header->count;
+    stats.pack_size = header->total_size;
+
+    lv_img_decoder_t* decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, decoder_info);
+    lv_img_decoder_set_open_cb(decoder, decoder_open);
+    lv_img_decoder_set_close_cb(decoder, decoder_close);
+
+    lv_fs_drv_init(&fs_drv);
+    fs_drv.letter = ASSET_PACK_LETTER;
+    fs_drv.open_cb = fs_open;
+    fs_drv.close_cb = fs_close;
+    fs_drv.read_cb = fs_read;
+    fs_drv.seek_cb = fs_seek;
+    fs_drv.tell_cb = fs_tell;
+    lv_fs_drv_register(&fs_drv);
+
+    Serial.printf("[Assets] %u entries, %u bytes mapped from flash\n",
+                  (unsigned)stats.entries, (unsigned)stats.pack_size);
+    return true;
+}
+
+bool ready() {
+    return pack != nullptr;
+}
+
+Stats get_stats() {
+    return stats;
+}
+
+void benchmark() {
+    if (!pack) return;
+
+    uint32_t max_size = 0;
+    for (uint16_t i = 0; i < header->count; i++) {
+        if (entries[i].raw_size > max_size) max_size = entries[i].raw_size;
+    }
+    uint8_t* buf = alloc_psram(max_size);
+    if (!buf) return;
+
+    Serial.println("[Assets] decode benchmark (LZ4 from flash to PSRAM)");
+    uint32_t total_us = 0;
+    uint32_t total_bytes = 0;
+    for (uint16_t i = 0; i < header->count; i++) {
+        const PackEntry& e = entries[i];
+        uint32_t t0 = micros();
+        bool ok = decode(&e, buf);
+        uint32_t us = micros() - t0;
+        total_us += us;
+        total_bytes += e.raw_size;
+        Serial.printf("[Assets] %-28.28s %6u -> %6u bytes %s %5u us\n", e.name, (unsigned)e.size,
+                      (unsigned)e.raw_size, e.codec == CODEC_LZ4 ? "lz4" : "raw", (unsigned)us);
+        if (!ok) Serial.printf("[Assets] %-28.28s FAILED\n", e.name);
+    }
+    Serial.printf("[Assets] total %u bytes in %u us (%u KB/s)\n", (unsigned)total_bytes, (unsigned)total_us,
+                  total_us ? (unsigned)((uint64_t)total_bytes * 1000000 / 1024 / total_us) : 0);
+    heap_caps_free(buf);
+}
+
+} // namespace AssetPack
@@ -0,0 +1,71 @@
+#pragma once
+#include <stdint.h>
+#include <lvgl.h>
+
+/**
+ * Asset Pack - Ícones e fontes fora da imagem do firmware
+ *
+ * Os assets ficam em um pacote indexado gravado na partição "assets"
+ * (partitions.csv), gerado por tools/assets/pack_assets.py e gravado com
+ * `pio run -t upload_assets`. A partição é mapeada com esp_partition_mmap,
+ * então o índice e os dados comprimidos são lidos direto da flash.
+ *
+ * - Imagens: um decoder do LVGL reconhece os caminhos "A:<nome>" e descomprime
+ *   (LZ4) a imagem só no primeiro uso, em um buffer na PSRAM. O cache de imagens
+ *   do LVGL (LV_IMG_CACHE_DEF_SIZE / LV_IMG_CACHE_BUDGET) mantém as decodificadas.
+ * - Outros arquivos (ex: fontes .bin): um driver de arquivos do LVGL na letra 'A'
+ *   expõe cada entrada como arquivo, então lv_font_load("A:fonts/x.bin") funciona.
+ *
+ * 📦 Exemplo de uso:
+ *
+ * #include "system/asset_pack.h"
+ *
+ * void setup() {
+ *     DisplayTouch::init();      // lv_init() antes
+ *     AssetPack::init();
+ *     lv_obj_t* img = lv_img_create(lv_scr_act());
+ *     lv_img_set_src(img, ASSET_PATH("launcher/notes_80"));
+ * }
+ */
+
+/*Letra do driver do LVGL usada pelos caminhos do pacote*/
+#define ASSET_PACK_LETTER 'A'
+/*Monta o caminho de um asset a partir do nome no pacote*/
+#define ASSET_PATH(name) "A:" name
+
+namespace AssetPack {
+
+struct Stats {
+    uint32_t entries;        // Entradas no pacote
+    uint32_t pack_size;      // Bytes do pacote na flash
+    uint32_t decodes;        // Imagens descomprimidas (misses do cache do LVGL)
+    uint32_t decoded_bytes;  // Bytes produzidos pelas descompressões
+    uint32_t decode_us;      // Tempo total gasto descomprimindo
+    uint32_t failures;       // Entradas corrompidas ou sem memória
+};
+
+/**
+ * @brief Mapeia a partição "assets", valida o pacote e registra o decoder de
+ * imagens e o driver de arquivos no LVGL. Chame depois de lv_init().
+ * @return false se a partição não existir ou o pacote for inválido (os ícones
+ * simplesmente não aparecem; grave-o com `pio run -t upload_assets`).
+ */
+bool init();
+
+/**
+ * @brief Indica se o pacote foi carregado.
+ */
+bool ready();
+
+/**
+ * @brief Retorna uma cópia dos contadores do pacote.
+ */
+Stats get_stats();
+
+/**
+ * @brief Descomprime cada entrada do pacote e imprime no Serial o tempo de
+ * decodificação por asset e o total.
+ */
+void benchmark();
+
+} // namespace AssetPack
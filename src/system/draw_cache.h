@@ -0,0 +1,62 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+
+/**
+ * DrawCache - Estatísticas dos caches de desenho do LVGL
+ *
+ * Os caches guardam o que o LVGL calculava de novo a cada quadro:
+ * - circle: tabelas de anti-aliasing dos cantos arredondados (raio 8/12) e dos
+ *   botões redondos. Ficam entre os quadros até LV_CIRCLE_CACHE_BUDGET bytes.
+ * - glyph: letras já convertidas em máscaras A8 (LV_GLYPH_CACHE_SIZE).
+ * - text layout: quebras de linha dos labels (LV_TXT_LAYOUT_CACHE_CNT).
+ *
+ * Os tamanhos são definidos no lv_conf.h; o tools/draw_bench mede o efeito
+ * em cada tela.
+ *
+ * 📊 Exemplo de uso:
+ *
+ * #include "system/draw_cache.h"
+ *
+ * DrawCache::reset_stats();
+ * // ... usar o app por alguns segundos ...
+ * DrawCache::print_stats();   // hits/misses de cada cache no Serial
+ */
+
+namespace DrawCache {
+
+inline void print_one(const char* name, const lv_draw_cache_stats_t& s) {
+    uint32_t total = s.hits + s.misses;
+    Serial.printf("[DrawCache] %s: hits=%u misses=%u hit_rate=%u%% evictions=%u entries=%u %u/%u bytes\n",
+                  name, (unsigned)s.hits, (unsigned)s.misses, total ? (unsigned)(s.hits * 100 / total) : 0,
+                  (unsigned)s.evictions, (unsigned)s.entries, (unsigned)s.used_bytes, (unsigned)s.size);
+}
+
+/**
+ * @brief Imprime hits, misses e a memória de cada cache no Serial.
+ */
+inline void print_stats() {
+    lv_draw_cache_stats_t stats;
+    lv_draw_mask_circle_cache_get_stats(&stats);
+    print_one("circle", stats);
+    lv_glyph_cache_get_stats(&stats);
+    print_one("glyph", stats);
+
+    lv_txt_layout_cache_stats_t layout;
+    lv_txt_layout_cache_get_stats(&layout);
+    uint32_t total = layout.hits + layout.misses;
+    Serial.printf("[DrawCache] text layout: hits=%u misses=%u hit_rate=%u%% entries=%u %u bytes\n",
+                  (unsigned)layout.hits, (unsigned)layout.misses, total ? (unsigned)(layout.hits * 100 / total) : 0,
+                  (unsigned)layout.entries, (unsigned)layout.used_bytes);
+}
+
+/**
+ * @brief Zera os contadores de todos os caches.
+ */
+inline void reset_stats() {
+    lv_draw_mask_circle_cache_reset_stats();
+    lv_glyph_cache_reset_stats();
+    lv_txt_layout_cache_reset_stats();
+}
+
+} // namespace DrawCache
@@ -0,0 +1,87 @@
+#pragma once
+#include <lvgl.h>
+
+/**
+ * LvBulk - Atualizações em lote da árvore de objetos do LVGL
+ *
+ * Reconstruir uma lista com N itens chama, para cada item, o refresh de estilo,
+ * a invalidação das áreas e o recálculo do texto dos labels. Parte disso custa
+ * O(N) por item:
+ * - Cada filho que muda de tamanho ou posição invalida as barras de rolagem do
+ *   pai, o que percorre todos os irmãos para achar o tamanho do conteúdo.
+ * - Os labels dos itens de lista (LV_LABEL_LONG_SCROLL_CIRCULAR) ainda não têm a
+ *   largura final, então cada um cria uma animação de rolagem que o layout
+ *   apaga depois, percorrendo a lista de todas as animações.
+ *
+ * Enquanto um Scope existir, o refresh de estilo (inclusive o texto dos labels)
+ * e a invalidação ficam desligados. No fim do escopo é feita uma única passada:
+ * layout, refresh de estilo de toda a árvore da raiz, layout de novo (só o que o
+ * texto mudou) e uma invalidação da raiz.
+ *
+ * - Dentro do escopo não leia tamanhos/posições nem chame lv_obj_update_layout(),
+ *   lv_refr_now() ou lv_timer_handler(): os dados ainda não foram atualizados.
+ * - A raiz deve conter tudo o que muda no escopo e continuar existindo no fim.
+ * - Escopos aninhados não fazem nada; só o mais externo faz a passada final.
+ *
+ * 🧱 Exemplo de uso:
+ *
+ * #include "system/lv_bulk.h"
+ *
+ * void rebuild_list() {
+ *     LvBulk::Scope bulk(list);
+ *     lv_obj_clean(list);
+ *     for (int i = 0; i < count; i++) lv_list_add_btn(list, NULL, names[i]);
+ * }   // Layout e refresh acontecem aqui, uma vez
+ */
+
+namespace LvBulk {
+
+/**
+ * @brief Indica se um escopo de atualização em lote está ativo.
+ */
+inline bool active() {
+    return !lv_obj_is_style_refresh_enabled();
+}
+
+/**
+ * @brief Faz a passada única que o escopo adiou. Chamado pelo ~Scope().
+ */
+inline void flush(lv_obj_t* root) {
+    // 1. Tamanhos e posições finais, ainda sem invalidar nada
+    lv_obj_update_layout(root);
+
+    // 2. Estilos e textos com as coordenadas já corretas (sem animações desnecessárias)
+    lv_obj_enable_style_refresh(true);
+    lv_obj_refresh_style_tree(root);
+
+    // 3. Só os labels cujo texto mudou alteram o layout de novo
+    lv_obj_update_layout(root);
+
+    lv_disp_t* disp = lv_obj_get_disp(root);
+    lv_disp_enable_invalidation(disp, true);
+    lv_obj_invalidate(root);
+}
+
+/**
+ * @brief Enquanto existir, adia o refresh de estilo, o layout e a invalidação
+ * da árvore de `root`.
+ */
+class Scope {
+public:
+    explicit Scope(lv_obj_t* root) : root_(root), outer_(!active()) {
+        if (!outer_) return;
+        lv_obj_enable_style_refresh(false);
+        lv_disp_enable_invalidation(lv_obj_get_disp(root_), false);
+    }
+    ~Scope() {
+        if (outer_) flush(root_);
+    }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    lv_obj_t* root_;
+    bool outer_;
+};
+
+} // namespace LvBulk
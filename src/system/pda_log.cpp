@@ -0,0 +1,572 @@
+#include <Arduino.h> // Primeiro: no host ele define PDA_LOG_ASYNC 0
+#include "pda_log.h"
+#include <ctype.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace {
+
+static_assert((PDA_LOG_RING & (PDA_LOG_RING - 1)) == 0, "PDA_LOG_RING must be a power of 2");
+static_assert(PDA_LOG_ARG_BYTES <= 255, "PDA_LOG_ARG_BYTES must fit in Record::used");
+
+constexpr int CORES = 2;
+constexpr uint32_t FLUSH_MS = 10;         // Espera da tarefa de escrita com os anéis vazios
+constexpr uint32_t WRITER_STACK = 3072;
+constexpr UBaseType_t WRITER_PRIORITY = 1; // Logo acima da idle
+constexpr BaseType_t WRITER_CORE = 0;
+constexpr size_t LINE_MAX = 256;
+constexpr size_t STR_RESERVE = 12;        // Espaço deixado por uma string para os números depois dela
+
+// Marcas de tipo dos argumentos empacotados
+constexpr uint8_t TAG_INT32 = 'I';
+constexpr uint8_t TAG_INT64 = 'L';
+constexpr uint8_t TAG_DOUBLE = 'D';
+constexpr uint8_t TAG_PTR = 'P';
+constexpr uint8_t TAG_STR = 'S';          // + tamanho (bit 7: cortada) + bytes sem terminador
+constexpr uint8_t STR_CUT = 0x80;
+
+struct Record {
+    uint32_t ts_ms;
+    const char* format;
+    const char* func;       // Função do LV_LOG_*; nullptr no pda_log()
+    uint8_t module;
+    uint8_t level;
+    uint8_t used;           // Bytes válidos em args
+    uint8_t reserved;
+    uint8_t args[PDA_LOG_ARG_BYTES];
+};
+
+// Anel de um núcleo: head só é escrito pelo próprio núcleo (com as interrupções
+// dele mascaradas), tail só pela tarefa de escrita.
+struct Ring {
+    Record records[PDA_LOG_RING];
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    volatile uint32_t dropped;
+    uint32_t dropped_reported;
+    uint64_t cycles;        // Custo acumulado das chamadas deste núcleo
+    uint32_t max_cycles;
+    uint32_t measured;
+};
+
+Ring rings[CORES];
+
+struct Rate {
+    uint16_t per_sec;       // 0 = sem limite
+    uint16_t burst;
+    int32_t tokens_milli;   // Fichas x 1000
+    uint32_t last_ms;
+    uint32_t limited_reported;
+};
+
+uint8_t levels[PDA_LOG_MODULES];
+Rate rates[PDA_LOG_MODULES];
+volatile uint32_t limited[PDA_LOG_MODULES];
+portMUX_TYPE rate_mux = portMUX_INITIALIZER_UNLOCKED;
+bool config_done = false;
+
+volatile uint32_t calls = 0;
+volatile uint32_t written = 0;
+
+const char* const MODULE_NAMES[PDA_LOG_MODULES] = {
+    "lvgl", "system", "input", "menu", "settings", "weather", "notes", "calendar", "monitor"
+};
+const char* const LEVEL_NAMES[] = {"Trace", "Info", "Warn", "Error", "User"};
+
+// Módulo dos LV_LOG_* pelo caminho do arquivo; o primeiro trecho encontrado vale
+struct FileModule {
+    const char* dir;
+    pda_log_module_t module;
+};
+const FileModule FILE_MODULES[] = {
+    {"lvgl/", PDA_LOG_LVGL},        {"apps/notes/", PDA_LOG_NOTES},     {"apps/calendar/", PDA_LOG_CALENDAR},
+    {"apps/weather/", PDA_LOG_WEATHER}, {"apps/settings/", PDA_LOG_SETTINGS}, {"apps/mainmenu/", PDA_LOG_MENU},
+    {"apps/monitor/", PDA_LOG_MONITOR}, {"input/", PDA_LOG_INPUT},
+};
+
+// Cache arquivo -> módulo sem trava: quem escreve zera o ponteiro, grava o
+// módulo e repõe o ponteiro; quem lê confere o ponteiro antes e depois.
+constexpr uint8_t FILE_CACHE = 16;
+const char* volatile cache_files[FILE_CACHE];
+volatile uint8_t cache_modules[FILE_CACHE];
+volatile uint32_t cache_next = 0;
+
+void init_config() {
+    for (int m = 0; m < PDA_LOG_MODULES; m++) {
+        levels[m] = PDA_LOG_TRACE;
+        rates[m] = Rate{PDA_LOG_RATE, PDA_LOG_BURST, PDA_LOG_BURST * 1000, 0, 0};
+    }
+    config_done = true;
+}
+
+pda_log_module_t module_of_file(const char* file) {
+    for (uint8_t i = 0; i < FILE_CACHE; i++) {
+        if (cache_files[i] != file) continue;
+        uint8_t m = cache_modules[i];
+        if (cache_files[i] == file) return (pda_log_module_t)m;
+    }
+
+    pda_log_module_t m = PDA_LOG_SYSTEM;
+    for (const FileModule& fm : FILE_MODULES) {
+        if (strstr(file, fm.dir)) {
+            m = fm.module;
+            break;
+        }
+    }
+    uint8_t slot = __atomic_fetch_add(&cache_next, 1, __ATOMIC_RELAXED) % FILE_CACHE;
+    cache_files[slot] = nullptr;
+    cache_modules[slot] = m;
+    __atomic_store_n(&cache_files[slot], file, __ATOMIC_RELEASE);
+    return m;
+}
+
+/**
+ * @brief Fichas do módulo. Retorna false se a mensagem passa do limite.
+ */
+bool take_token(uint8_t module, uint32_t now) {
+    Rate& r = rates[module];
+    if (!r.per_sec) return true;
+    portENTER_CRITICAL(&rate_mux);
+    uint32_t elapsed = now - r.last_ms;
+    if (elapsed > 100000) elapsed = 100000; // Mais que o suficiente para encher qualquer rajada
+    int32_t tokens = r.tokens_milli + (int32_t)(elapsed * r.per_sec);
+    if (tokens > r.burst * 1000) tokens = r.burst * 1000;
+    r.last_ms = now;
+    bool ok = tokens >= 1000;
+    r.tokens_milli = ok ? tokens - 1000 : tokens;
+    portEXIT_CRITICAL(&rate_mux);
+    return ok;
+}
+
+// --- Formato: a mesma varredura no empacotamento e na formatação ---
+
+enum ArgKind : uint8_t { ARG_NONE, ARG_INT, ARG_LONG, ARG_LLONG, ARG_SIZE, ARG_DOUBLE, ARG_STR, ARG_PTR, ARG_COUNT };
+
+struct Spec {
+    const char* start;      // Logo depois do '%'
+    const char* mods;       // Início dos modificadores de tamanho
+    char conv;
+    uint8_t stars;          // Largura/precisão vindas dos argumentos ('*')
+    ArgKind kind;
+};
+
+/**
+ * @brief Lê uma conversão a partir do caractere depois do '%'. Retorna o
+ * ponteiro para o caractere da conversão (ou o terminador).
+ */
+const char* scan_spec(const char* p, Spec& s) {
+    s.start = p;
+    s.stars = 0;
+    while (*p && strchr("-+ #0", *p)) p++;
+    if (*p == '*') {
+        s.stars++;
+        p++;
+    }
+    while (isdigit((unsigned char)*p)) p++;
+    if (*p == '.') {
+        p++;
+        if (*p == '*') {
+            s.stars++;
+            p++;
+        }
+        while (isdigit((unsigned char)*p)) p++;
+    }
+    s.mods = p;
+    int longs = 0;
+    bool size = false;
+    while (*p && strchr("hlLjzt", *p)) {
+        if (*p == 'l') longs++;
+        else if (*p == 'j') longs = 2;
+        else if (*p == 'z' || *p == 't') size = true;
+        p++;
+    }
+    s.conv = *p;
+    switch (*p) {
+        case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+            s.kind = longs >= 2 ? ARG_LLONG : longs == 1 ? ARG_LONG : size ? ARG_SIZE : ARG_INT;
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            s.kind = ARG_DOUBLE;
+            break;
+        case 's':
+            s.kind = ARG_STR;
+            break;
+        case 'p':
+            s.kind = ARG_PTR;
+            break;
+        case 'n':
+            s.kind = ARG_COUNT;
+            break;
+        default:
+            s.kind = ARG_NONE; // "%%" ou conversão desconhecida: sem argumento
+            break;
+    }
+    return p;
+}
+
+struct Packer {
+    uint8_t* p;
+    uint8_t* end;
+    bool full;
+
+    bool room(size_t n) {
+        if (full || (size_t)(end - p) < n) full = true;
+        return !full;
+    }
+    void put_int(int64_t v, bool wide) {
+        size_t n = wide ? 8 : 4;
+        if (!room(1 + n)) return;
+        *p++ = wide ? TAG_INT64 : TAG_INT32;
+        if (wide) {
+            memcpy(p, &v, 8);
+        } else {
+            int32_t v32 = (int32_t)v;
+            memcpy(p, &v32, 4);
+        }
+        p += n;
+    }
+    void put_double(double v) {
+        if (!room(1 + sizeof(v))) return;
+        *p++ = TAG_DOUBLE;
+        memcpy(p, &v, sizeof(v));
+        p += sizeof(v);
+    }
+    void put_ptr(const void* v) {
+        if (!room(1 + sizeof(v))) return;
+        *p++ = TAG_PTR;
+        memcpy(p, &v, sizeof(v));
+        p += sizeof(v);
+    }
+    void put_str(const char* s) {
+        if (!s) s = "(null)";
+        if (!room(2)) return;
+        size_t space = (size_t)(end - p) - 2;
+        if (space > STR_RESERVE * 2) space -= STR_RESERVE; // Deixa lugar para os números seguintes
+        if (space > 0x7F) space = 0x7F;
+        size_t len = strnlen(s, space + 1);
+        uint8_t cut = 0;
+        if (len > space) {
+            len = space;
+            cut = STR_CUT;
+        }
+        *p++ = TAG_STR;
+        *p++ = (uint8_t)len | cut;
+        memcpy(p, s, len);
+        p += len;
+    }
+};
+
+/**
+ * @brief Copia os argumentos de `format` para `out`. Retorna os bytes usados.
+ */
+uint8_t pack(uint8_t* out, const char* format, va_list args) {
+    Packer pk{out, out + PDA_LOG_ARG_BYTES, false};
+    for (const char* f = format; *f && !pk.full; f++) {
+        if (*f != '%') continue;
+        Spec s;
+        f = scan_spec(f + 1, s);
+        if (!*f) break;
+        for (uint8_t i = 0; i < s.stars; i++) pk.put_int(va_arg(args, int), false);
+        switch (s.kind) {
+            case ARG_INT: pk.put_int(va_arg(args, int), false); break;
+            case ARG_LONG: pk.put_int(va_arg(args, long), sizeof(long) > 4); break;
+            case ARG_LLONG: pk.put_int(va_arg(args, long long), true); break;
+            case ARG_SIZE: pk.put_int((int64_t)va_arg(args, size_t), sizeof(size_t) > 4); break;
+            case ARG_DOUBLE: pk.put_double(va_arg(args, double)); break;
+            case ARG_STR: pk.put_str(va_arg(args, const char*)); break;
+            case ARG_PTR: pk.put_ptr(va_arg(args, void*)); break;
+            case ARG_COUNT: (void)va_arg(args, void*); break; // %n não é suportado
+            case ARG_NONE: break;
+        }
+    }
+    return (uint8_t)(pk.p - out);
+}
+
+struct Unpacker {
+    const uint8_t* p;
+    const uint8_t* end;
+
+    uint8_t tag() const { return p < end ? *p : 0; }
+    bool get_int(int64_t& v, bool& wide) {
+        uint8_t t = tag();
+        if (t == TAG_INT32 && end - p >= 5) {
+            int32_t v32;
+            memcpy(&v32, p + 1, 4);
+            v = v32;
+            wide = false;
+            p += 5;
+            return true;
+        }
+        if (t == TAG_INT64 && end - p >= 9) {
+            memcpy(&v, p + 1, 8);
+            wide = true;
+            p += 9;
+            return true;
+        }
+        return false;
+    }
+};
+
+/**
+ * @brief Formata um registro numa linha terminada em '\n'. Retorna o tamanho.
+ */
+size_t format_record(const Record& r, char* line, size_t size) {
+    size_t len = snprintf(line, size, "[%s] %lu.%03lu %s%s%s: ", LEVEL_NAMES[r.level < 5 ? r.level : 4],
+                          (unsigned long)(r.ts_ms / 1000), (unsigned long)(r.ts_ms % 1000),
+                          MODULE_NAMES[r.module], r.func ? " " : "", r.func ? r.func : "");
+    size_t limit = size - 2; // Espaço para o '\n' e o terminador
+    Unpacker in{r.args, r.args + r.used};
+
+    for (const char* f = r.format; *f && len < limit; f++) {
+        if (*f != '%') {
+            line[len++] = *f;
+            continue;
+        }
+        Spec s;
+        const char* conv = scan_spec(f + 1, s);
+        if (!*conv) break;
+        f = conv;
+        if (s.kind == ARG_NONE) {
+            line[len++] = s.conv == '%' ? '%' : '?';
+            continue;
+        }
+        if (s.kind == ARG_COUNT) continue;
+
+        // Reconstrói a conversão: flags e largura, '*' trocado pelo valor, sem os modificadores
+        char spec[40];
+        size_t n = 0;
+        spec[n++] = '%';
+        bool ok = true;
+        for (const char* c = s.start; c < s.mods && n < sizeof(spec) - 16; c++) {
+            if (*c != '*') {
+                spec[n++] = *c;
+                continue;
+            }
+            int64_t v;
+            bool wide;
+            if (!in.get_int(v, wide)) {
+                ok = false;
+                break;
+            }
+            n += snprintf(spec + n, sizeof(spec) - n, "%d", (int)v);
+        }
+
+        int written_now = 0;
+        int64_t v = 0;
+        bool wide = false;
+        if (!ok) {
+            written_now = snprintf(line + len, size - len, "?");
+        } else if (s.kind == ARG_DOUBLE && in.tag() == TAG_DOUBLE && in.end - in.p >= 9) {
+            double d;
+            memcpy(&d, in.p + 1, sizeof(d));
+            in.p += 9;
+            spec[n++] = s.conv;
+            spec[n] = '\0';
+            written_now = snprintf(line + len, size - len, spec, d);
+        } else if (s.kind == ARG_STR && in.tag() == TAG_STR && in.end - in.p >= 2) {
+            uint8_t hdr = in.p[1];
+            size_t slen = hdr & ~STR_CUT;
+            char str[0x80 + 4];
+            memcpy(str, in.p + 2, slen);
+            if (hdr & STR_CUT) {
+                memcpy(str + slen, "...", 3);
+                slen += 3;
+            }
+            str[slen] = '\0';
+            in.p += 2 + (hdr & ~STR_CUT);
+            spec[n++] = 's';
+            spec[n] = '\0';
+            written_now = snprintf(line + len, size - len, spec, str);
+        } else if (s.kind == ARG_PTR && in.tag() == TAG_PTR) {
+            void* ptr;
+            memcpy(&ptr, in.p + 1, sizeof(ptr));
+            in.p += 1 + sizeof(ptr);
+            spec[n++] = 'p';
+            spec[n] = '\0';
+            written_now = snprintf(line + len, size - len, spec, ptr);
+        } else if (s.kind != ARG_DOUBLE && s.kind != ARG_STR && s.kind != ARG_PTR && in.get_int(v, wide)) {
+            if (wide) {
+                spec[n++] = 'l';
+                spec[n++] = 'l';
+            }
+            spec[n++] = s.conv;
+            spec[n] = '\0';
+            written_now = wide ? snprintf(line + len, size - len, spec, (long long)v)
+                               : snprintf(line + len, size - len, spec, (int)v);
+        } else {
+            // Faltou espaço no registro para este argumento
+            written_now = snprintf(line + len, size - len, "?");
+        }
+        if (written_now > 0) len += (size_t)written_now;
+    }
+    if (len > limit) len = limit;
+    line[len++] = '\n';
+    line[len] = '\0';
+    return len;
+}
+
+void write_record(const Record& r) {
+    char line[LINE_MAX];
+    size_t len = format_record(r, line, sizeof(line));
+    Serial.write((const uint8_t*)line, len);
+    __atomic_fetch_add(&written, 1, __ATOMIC_RELAXED);
+}
+
+void report_losses() {
+    char line[96];
+    for (uint8_t core = 0; core < CORES; core++) {
+        Ring& ring = rings[core];
+        uint32_t d = ring.dropped;
+        if (d == ring.dropped_reported) continue;
+        int len = snprintf(line, sizeof(line), "[log] núcleo %u: %lu mensagens perdidas (anel cheio)\n",
+                           (unsigned)core, (unsigned long)(d - ring.dropped_reported));
+        Serial.write((const uint8_t*)line, len);
+        ring.dropped_reported = d;
+    }
+    for (int m = 0; m < PDA_LOG_MODULES; m++) {
+        uint32_t l = limited[m];
+        if (l == rates[m].limited_reported) continue;
+        int len = snprintf(line, sizeof(line), "[log] %s: %lu mensagens acima do limite de %u/s\n", MODULE_NAMES[m],
+                           (unsigned long)(l - rates[m].limited_reported), (unsigned)rates[m].per_sec);
+        Serial.write((const uint8_t*)line, len);
+        rates[m].limited_reported = l;
+    }
+}
+
+#if PDA_LOG_ASYNC
+bool drain_ring(Ring& ring) {
+    bool any = false;
+    uint32_t head = __atomic_load_n(&ring.head, __ATOMIC_ACQUIRE);
+    while (ring.tail != head) {
+        write_record(ring.records[ring.tail & (PDA_LOG_RING - 1)]);
+        __atomic_store_n(&ring.tail, ring.tail + 1, __ATOMIC_RELEASE);
+        any = true;
+    }
+    return any;
+}
+
+void writer_task(void*) {
+    for (;;) {
+        bool any = false;
+        for (uint8_t core = 0; core < CORES; core++) any |= drain_ring(rings[core]);
+        report_losses();
+        if (!any) vTaskDelay(pdMS_TO_TICKS(FLUSH_MS));
+    }
+}
+#endif
+
+} // namespace
+
+extern "C" void pda_log_va(pda_log_module_t module, uint8_t level, const char* func, const char* format, va_list args) {
+    uint32_t start = ESP.getCycleCount();
+    if (!config_done) init_config();
+    if (module >= PDA_LOG_MODULES || level < levels[module] || level >= PDA_LOG_NONE) return;
+    __atomic_fetch_add(&calls, 1, __ATOMIC_RELAXED);
+
+    uint32_t now = millis();
+    if (!take_token(module, now)) {
+        __atomic_fetch_add(&limited[module], 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    // Monta o registro fora da região mascarada; lá dentro é só a cópia
+    Record rec;
+    rec.ts_ms = now;
+    rec.format = format;
+    rec.func = func;
+    rec.module = (uint8_t)module;
+    rec.level = level;
+    rec.reserved = 0;
+    rec.used = pack(rec.args, format, args);
+
+#if PDA_LOG_ASYNC
+    UBaseType_t irq = portSET_INTERRUPT_MASK_FROM_ISR();
+    Ring& ring = rings[xPortGetCoreID()];
+    uint32_t head = ring.head;
+    if (head - __atomic_load_n(&ring.tail, __ATOMIC_ACQUIRE) < PDA_LOG_RING) {
+        memcpy(&ring.records[head & (PDA_LOG_RING - 1)], &rec, offsetof(Record, args) + rec.used);
+        __atomic_store_n(&ring.head, head + 1, __ATOMIC_RELEASE);
+    } else {
+        ring.dropped = ring.dropped + 1;
+    }
+    uint32_t cycles = ESP.getCycleCount() - start;
+    ring.cycles += cycles;
+    if (cycles > ring.max_cycles) ring.max_cycles = cycles;
+    ring.measured++;
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(irq);
+#else
+    // Host: sem tarefa de escrita, formata aqui pelo mesmo caminho
+    Ring& ring = rings[0];
+    uint32_t cycles = ESP.getCycleCount() - start;
+    ring.cycles += cycles;
+    if (cycles > ring.max_cycles) ring.max_cycles = cycles;
+    ring.measured++;
+    write_record(rec);
+    report_losses();
+#endif
+}
+
+extern "C" void pda_log(pda_log_module_t module, uint8_t level, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    pda_log_va(module, level, nullptr, format, args);
+    va_end(args);
+}
+
+extern "C" void pda_log_lvgl(int8_t level, const char* file, int line, const char* func, const char* format,
+                             va_list args) {
+    (void)line;
+    pda_log_va(module_of_file(file), (uint8_t)level, func, format, args);
+}
+
+extern "C" void pda_log_begin(void) {
+    if (!config_done) init_config();
+#if PDA_LOG_ASYNC
+    static bool started = false;
+    if (started) return;
+    started = true;
+    xTaskCreatePinnedToCore(writer_task, "LogWriter", WRITER_STACK, NULL, WRITER_PRIORITY, NULL, WRITER_CORE);
+#endif
+}
+
+extern "C" void pda_log_set_level(pda_log_module_t module, uint8_t level) {
+    if (!config_done) init_config();
+    if (module < PDA_LOG_MODULES) levels[module] = level;
+}
+
+extern "C" void pda_log_set_rate(pda_log_module_t module, uint16_t per_sec, uint16_t burst) {
+    if (!config_done) init_config();
+    if (module >= PDA_LOG_MODULES) return;
+    portENTER_CRITICAL(&rate_mux);
+    Rate& r = rates[module];
+    r.per_sec = per_sec;
+    r.burst = burst ? burst : 1;
+    r.tokens_milli = r.burst * 1000;
+    r.last_ms = millis();
+    portEXIT_CRITICAL(&rate_mux);
+}
+
+extern "C" const char* pda_log_module_name(pda_log_module_t module) {
+    return module < PDA_LOG_MODULES ? MODULE_NAMES[module] : "?";
+}
+
+extern "C" void pda_log_get_stats(pda_log_stats_t* out) {
+    uint64_t cycles = 0;
+    uint32_t measured = 0;
+    uint32_t max_cycles = 0;
+    out->dropped = 0;
+    for (uint8_t core = 0; core < CORES; core++) {
+        // Leitura sem trava: é só para o Monitor, um valor de uma amostra atrás serve
+        cycles += rings[core].cycles;
+        measured += rings[core].measured;
+        out->dropped += rings[core].dropped;
+        if (rings[core].max_cycles > max_cycles) max_cycles = rings[core].max_cycles;
+    }
+    out->limited = 0;
+    for (int m = 0; m < PDA_LOG_MODULES; m++) out->limited += limited[m];
+    out->calls = calls;
+    out->written = written;
+    uint32_t mhz = ESP.getCpuFreqMHz();
+    out->avg_ns = measured ? (uint32_t)(cycles * 1000 / measured / mhz) : 0;
+    out->max_ns = max_cycles * 1000 / mhz;
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+/**
+ * PDA Log - Log assíncrono com formatação adiada
+ *
+ * O LV_LOG_* (do LVGL e dos apps) e o pda_log() não formatam nem escrevem no
+ * Serial na hora: guardam o ponteiro do formato e os argumentos crus num anel e
+ * uma tarefa de baixa prioridade no núcleo 0 formata e escreve depois. Uma
+ * chamada custa uma varredura do formato e algumas cópias, nunca a espera pela
+ * USB; nem a UI nem a tarefa de rede travam num log.
+ *
+ * - Cada núcleo tem seu anel de PDA_LOG_RING registros de tamanho fixo. O
+ *   produtor só mascara as interrupções do próprio núcleo enquanto copia o
+ *   registro pronto (nenhuma trava entre núcleos), como no pda_trace.
+ * - Argumentos %s são copiados na hora (o String de origem pode morrer antes da
+ *   formatação) e cortados no espaço do registro, com "..." no fim: um payload
+ *   HTTP inteiro vira as primeiras dezenas de caracteres.
+ * - Nível e limite de taxa por módulo, ajustáveis em tempo de execução. O
+ *   módulo dos LV_LOG_* sai do caminho do arquivo (apps/notes/ -> "notes").
+ *   Os níveis são os do LVGL (USER fica acima de ERROR) e o nível de
+ *   compilação (LV_LOG_LEVEL no lv_conf.h) continua valendo.
+ * - Anel cheio ou taxa estourada: a mensagem é descartada e contada; a tarefa
+ *   de escrita avisa quantas se perderam.
+ * - pda_log_get_stats() mede o custo de cada chamada (em ciclos da CPU) para o
+ *   app Monitor.
+ *
+ * Com PDA_LOG_ASYNC 0 (o host, onde não há tarefas de verdade) o registro é
+ * formatado e escrito na própria chamada, pelo mesmo caminho.
+ *
+ * Este header também é incluído pelo LVGL (lv_conf.h), por isso a interface é em C.
+ *
+ * 📜 Exemplo de uso:
+ *
+ * void setup() {
+ *     Serial.begin(115200);
+ *     pda_log_begin();   // Antes do resto: o que foi logado até aqui sai agora
+ *     ...
+ * }
+ *
+ * LV_LOG_USER("Payload received: %s", payload.c_str());    // Módulo "notes"
+ * pda_log(PDA_LOG_MENU, PDA_LOG_USER, "Abrindo aplicativo: %s", name);
+ *
+ * pda_log_set_level(PDA_LOG_NOTES, PDA_LOG_NONE);    // Cala o Notes
+ * pda_log_set_rate(PDA_LOG_LVGL, 5, 10);             // 5/s, rajadas de até 10
+ */
+
+#include <stdarg.h>
+#include <stdint.h>
+
+#ifndef PDA_LOG_ASYNC
+#define PDA_LOG_ASYNC 1
+#endif
+
+/*Registros por núcleo*/
+#ifndef PDA_LOG_RING
+#define PDA_LOG_RING 32
+#endif
+
+/*Bytes para os argumentos de um registro (strings incluídas)*/
+#ifndef PDA_LOG_ARG_BYTES
+#define PDA_LOG_ARG_BYTES 104
+#endif
+
+/*Limite de taxa padrão de cada módulo: mensagens por segundo e rajada*/
+#ifndef PDA_LOG_RATE
+#define PDA_LOG_RATE 50
+#endif
+#ifndef PDA_LOG_BURST
+#define PDA_LOG_BURST 100
+#endif
+
+/*Níveis: os mesmos valores do LV_LOG_LEVEL_* do LVGL*/
+#define PDA_LOG_TRACE 0
+#define PDA_LOG_INFO  1
+#define PDA_LOG_WARN  2
+#define PDA_LOG_ERROR 3
+#define PDA_LOG_USER  4
+#define PDA_LOG_NONE  5
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    PDA_LOG_LVGL,
+    PDA_LOG_SYSTEM,
+    PDA_LOG_INPUT,
+    PDA_LOG_MENU,
+    PDA_LOG_SETTINGS,
+    PDA_LOG_WEATHER,
+    PDA_LOG_NOTES,
+    PDA_LOG_CALENDAR,
+    PDA_LOG_MONITOR,
+    PDA_LOG_MODULES
+} pda_log_module_t;
+
+typedef struct {
+    uint32_t calls;         /*Chamadas que passaram pelo filtro de nível*/
+    uint32_t written;       /*Mensagens escritas pela tarefa*/
+    uint32_t dropped;       /*Anel cheio*/
+    uint32_t limited;       /*Acima da taxa do módulo*/
+    uint32_t avg_ns;        /*Custo médio de uma chamada no produtor*/
+    uint32_t max_ns;
+} pda_log_stats_t;
+
+/**
+ * @brief Cria a tarefa de escrita. Antes dela os registros só se acumulam.
+ */
+void pda_log_begin(void);
+
+void pda_log(pda_log_module_t module, uint8_t level, const char * format, ...)
+    __attribute__((format(printf, 3, 4)));
+void pda_log_va(pda_log_module_t module, uint8_t level, const char * func, const char * format, va_list args);
+
+/**
+ * @brief Destino dos LV_LOG_* (LV_LOG_CUSTOM_ADD no lv_conf.h).
+ */
+void pda_log_lvgl(int8_t level, const char * file, int line, const char * func, const char * format, va_list args);
+
+/**
+ * @brief Mensagens abaixo de `level` são descartadas na chamada.
+ */
+void pda_log_set_level(pda_log_module_t module, uint8_t level);
+
+/**
+ * @brief Limite de `per_sec` mensagens por segundo, com rajadas de até `burst`.
+ * per_sec 0 tira o limite.
+ */
+void pda_log_set_rate(pda_log_module_t module, uint16_t per_sec, uint16_t burst);
+
+const char * pda_log_module_name(pda_log_module_t module);
+void pda_log_get_stats(pda_log_stats_t * out);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
@@ -0,0 +1,486 @@
+#include "pda_mem.h"
+#include "alloc_trace.h"
+#include <Arduino.h>
+#include <lvgl.h>
+#include <esp_heap_caps.h>
+#include <string.h>
+#include "src/misc/lv_tlsf.h"
+
+namespace {
+
+// Cabeçalho colocado antes de cada bloco entregue ao LVGL.
+struct BlockHeader {
+    uint32_t size;   // Bytes pedidos
+    uint8_t arena;   // 0 = heap, senão índice da arena + 1
+    uint8_t tier;    // Nível do heap (TIER_SRAM/TIER_PSRAM); não usado em blocos de arena
+    uint16_t magic;
+};
+static_assert(sizeof(BlockHeader) == 8, "BlockHeader must keep 8-byte alignment");
+
+// Chunk de uma arena; os dados vêm logo depois do cabeçalho.
+struct Chunk {
+    Chunk* next;
+    uint32_t used;
+    uint32_t capacity;
+    uint32_t reserved;
+};
+
+constexpr uint16_t BLOCK_MAGIC = 0xA110;
+constexpr uint32_t ALIGN = 8;
+constexpr uint32_t ARENA_CHUNK_SIZE = 4096;       // Chunks pequenos na SRAM interna
+constexpr uint32_t ARENA_LARGE_THRESHOLD = 1024;  // A partir daqui, chunk dedicado na PSRAM
+constexpr uint32_t ARENA_FREE_CLASSES = 32;      // Listas livres de 8 em 8 bytes (até 256 bytes)
+constexpr int ARENA_MAX = 16;
+constexpr int ARENA_STACK_DEPTH = 8;
+
+enum Tier : uint8_t {
+    TIER_SRAM = 0,   // Pool TLSF na SRAM interna
+    TIER_PSRAM = 1,  // heap_caps na PSRAM (ou SRAM interna, se a PSRAM acabar)
+};
+
+inline uint32_t align_up(uint32_t v) {
+    return (v + ALIGN - 1) & ~(ALIGN - 1);
+}
+
+inline uint8_t* chunk_data(Chunk* chunk) {
+    return reinterpret_cast<uint8_t*>(chunk + 1);
+}
+
+inline BlockHeader* header_of(void* ptr) {
+    return reinterpret_cast<BlockHeader*>(ptr) - 1;
+}
+
+} // namespace
+
+namespace LvMem {
+
+struct Arena {
+    const char* name;
+    Chunk* chunks;         // O primeiro chunk é o ativo para alocação sequencial
+    void* free_lists[ARENA_FREE_CLASSES]; // Blocos soltos, reaproveitados por tamanho
+    uint32_t live_blocks;
+    bool in_use;
+    bool released;
+};
+
+} // namespace LvMem
+
+using LvMem::Arena;
+
+static Arena arenas[ARENA_MAX];
+static Arena* arena_stack[ARENA_STACK_DEPTH];
+static int arena_depth = 0;
+static int arena_overflow = 0;   // Pushes recusados com a pilha cheia: só para os pops casarem
+static pda_mem_stats_t stats;
+static lv_tlsf_t sram_tlsf = nullptr;
+static bool sram_init_done = false;
+
+#if PDA_MEM_TRACE
+#define MEM_TRACE(...) Serial.printf(__VA_ARGS__)
+#else
+#define MEM_TRACE(...)
+#endif
+
+static Arena* current_arena() {
+#if PDA_MEM_ARENAS
+    return arena_depth > 0 ? arena_stack[arena_depth - 1] : nullptr;
+#else
+    return nullptr;
+#endif
+}
+
+static void* finish_block(BlockHeader* hdr, size_t size, uint8_t arena_id) {
+    hdr->size = (uint32_t)size;
+    hdr->arena = arena_id;
+    hdr->magic = BLOCK_MAGIC;
+
+    stats.alloc_count++;
+    stats.live_blocks++;
+    stats.bytes_in_use += (uint32_t)size;
+    if (stats.bytes_in_use > stats.peak_bytes) stats.peak_bytes = stats.bytes_in_use;
+    if (arena_id) stats.arena_allocs++;
+    return hdr + 1;
+}
+
+static Chunk* new_chunk(uint32_t capacity, uint32_t caps) {
+    Chunk* chunk = (Chunk*)heap_caps_malloc(sizeof(Chunk) + capacity, caps);
+    if (!chunk && (caps & MALLOC_CAP_SPIRAM)) {
+        chunk = (Chunk*)heap_caps_malloc(sizeof(Chunk) + capacity, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    if (!chunk) return nullptr;
+    chunk->next = nullptr;
+    chunk->used = 0;
+    chunk->capacity = capacity;
+    stats.arena_chunks++;
+    stats.arena_reserved += capacity;
+    return chunk;
+}
+
+static void* arena_alloc(Arena* arena, size_t size) {
+    uint32_t total = align_up(sizeof(BlockHeader) + (uint32_t)size);
+    uint8_t id = (uint8_t)(arena - arenas) + 1;
+
+    if (total >= ARENA_LARGE_THRESHOLD) {
+        // Objeto grande: chunk dedicado na PSRAM, inserido depois do chunk ativo.
+        Chunk* chunk = new_chunk(total, MALLOC_CAP_SPIRAM);
+        if (!chunk) return nullptr;
+        chunk->used = total;
+        if (arena->chunks) {
+            chunk->next = arena->chunks->next;
+            arena->chunks->next = chunk;
+        } else {
+            arena->chunks = chunk;
+        }
+        arena->live_blocks++;
+        return finish_block((BlockHeader*)chunk_data(chunk), size, id);
+    }
+
+    // Reaproveita um bloco solto do mesmo tamanho (comum com os realloc do LVGL).
+    uint32_t cls = total / ALIGN - 1;
+    if (cls < ARENA_FREE_CLASSES && arena->free_lists[cls]) {
+        BlockHeader* hdr = (BlockHeader*)arena->free_lists[cls];
+        arena->free_lists[cls] = *(void**)(hdr + 1);
+        arena->live_blocks++;
+        return finish_block(hdr, size, id);
+    }
+
+    Chunk* head = arena->chunks;
+    if (!head || head->capacity - head->used < total) {
+        head = new_chunk(ARENA_CHUNK_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (!head) return nullptr;
+        head->next = arena->chunks;
+        arena->chunks = head;
+    }
+
+    BlockHeader* hdr = (BlockHeader*)(chunk_data(head) + head->used);
+    head->used += total;
+    arena->live_blocks++;
+    return finish_block(hdr, size, id);
+}
+
+static void arena_destroy(Arena* arena) {
+    Chunk* chunk = arena->chunks;
+    while (chunk) {
+        Chunk* next = chunk->next;
+        stats.arena_chunks--;
+        stats.arena_reserved -= chunk->capacity;
+        heap_caps_free(chunk);
+        chunk = next;
+    }
+    arena->chunks = nullptr;
+    arena->in_use = false;
+    stats.arenas_live--;
+    stats.arenas_released++;
+}
+
+static pda_mem_tier_stats_t& tier_stats(uint8_t tier) {
+    return tier == TIER_SRAM ? stats.sram : stats.psram;
+}
+
+static void tier_account(uint8_t tier, uint32_t old_size, uint32_t new_size) {
+    pda_mem_tier_stats_t& t = tier_stats(tier);
+    t.bytes_in_use = t.bytes_in_use - old_size + new_size;
+    if (t.bytes_in_use > t.peak_bytes) t.peak_bytes = t.bytes_in_use;
+}
+
+static void sram_init() {
+    sram_init_done = true;
+    void* pool = heap_caps_malloc(LV_MEM_CUSTOM_TLSF_POOL_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!pool) {
+        LV_LOG_WARN("pda_mem: no internal SRAM for the TLSF pool, using PSRAM only");
+        return;
+    }
+    sram_tlsf = lv_tlsf_create_with_pool(pool, LV_MEM_CUSTOM_TLSF_POOL_SIZE);
+    stats.sram.total_size = LV_MEM_CUSTOM_TLSF_POOL_SIZE;
+}
+
+// Blocos pequenos vão para o pool TLSF da SRAM interna; os grandes (ou quando o
+// pool está cheio) vão para a PSRAM.
+static void* tier_alloc(size_t size) {
+    size_t total = sizeof(BlockHeader) + size;
+    BlockHeader* hdr = nullptr;
+    uint8_t tier = TIER_PSRAM;
+
+    if (size <= PDA_MEM_SRAM_MAX_SIZE) {
+        if (!sram_init_done) sram_init();
+        if (sram_tlsf) {
+            hdr = (BlockHeader*)lv_tlsf_malloc(sram_tlsf, total);
+            if (hdr) tier = TIER_SRAM;
+            else stats.sram.failed_allocs++;
+        }
+    }
+    if (!hdr) {
+        hdr = (BlockHeader*)heap_caps_malloc(total, MALLOC_CAP_SPIRAM);
+        if (!hdr) {
+            stats.psram.failed_allocs++;
+            hdr = (BlockHeader*)heap_caps_malloc(total, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        }
+        if (!hdr) return nullptr;
+    }
+
+    hdr->tier = tier;
+    tier_stats(tier).blocks++;
+    tier_account(tier, 0, (uint32_t)size);
+    return finish_block(hdr, size, 0);
+}
+
+static void tier_free(BlockHeader* hdr) {
+    tier_stats(hdr->tier).blocks--;
+    tier_account(hdr->tier, hdr->size, 0);
+    if (hdr->tier == TIER_SRAM) {
+        lv_tlsf_free(sram_tlsf, hdr);
+    } else {
+        heap_caps_free(hdr);
+    }
+}
+
+static void* mem_alloc(size_t size) {
+    void* ptr = nullptr;
+    Arena* arena = current_arena();
+    if (arena && arena->in_use && !arena->released) ptr = arena_alloc(arena, size);
+    if (!ptr) ptr = tier_alloc(size);
+    if (!ptr) stats.failed_allocs++;
+    return ptr;
+}
+
+static void mem_free(void* ptr) {
+    BlockHeader* hdr = header_of(ptr);
+    if (hdr->magic != BLOCK_MAGIC) {
+        LV_LOG_ERROR("pda_mem_free: invalid block %p", ptr);
+        return;
+    }
+    hdr->magic = 0;
+
+    stats.free_count++;
+    stats.live_blocks--;
+    stats.bytes_in_use -= hdr->size;
+
+    if (hdr->arena == 0) {
+        tier_free(hdr);
+        return;
+    }
+
+    // Bloco de arena: só decrementa; a arena inteira volta ao heap no final.
+    Arena* arena = &arenas[hdr->arena - 1];
+    arena->live_blocks--;
+    if (arena->released) {
+        if (arena->live_blocks == 0) arena_destroy(arena);
+        return;
+    }
+
+    // Arena ainda em uso: guarda blocos pequenos para reutilização.
+    uint32_t cls = align_up(sizeof(BlockHeader) + hdr->size) / ALIGN - 1;
+    if (cls < ARENA_FREE_CLASSES) {
+        *(void**)ptr = arena->free_lists[cls];
+        arena->free_lists[cls] = hdr;
+    }
+}
+
+static void* mem_realloc(void* ptr, size_t new_size) {
+    BlockHeader* hdr = header_of(ptr);
+    if (hdr->magic != BLOCK_MAGIC) {
+        LV_LOG_ERROR("pda_mem_realloc: invalid block %p", ptr);
+        return nullptr;
+    }
+    stats.realloc_count++;
+    uint32_t old_size = hdr->size;
+
+    if (hdr->arena == 0) {
+        // Tenta crescer dentro do mesmo nível; se o tamanho mudou de classe, o bloco muda de nível.
+        uint8_t tier = hdr->tier;
+        BlockHeader* grown = nullptr;
+        if (tier == TIER_SRAM && new_size <= PDA_MEM_SRAM_MAX_SIZE) {
+            grown = (BlockHeader*)lv_tlsf_realloc(sram_tlsf, hdr, sizeof(BlockHeader) + new_size);
+        } else if (tier == TIER_PSRAM && new_size > PDA_MEM_SRAM_MAX_SIZE) {
+            grown = (BlockHeader*)heap_caps_realloc(hdr, sizeof(BlockHeader) + new_size, MALLOC_CAP_SPIRAM);
+        }
+        if (grown) {
+            tier_account(tier, old_size, (uint32_t)new_size);
+            stats.bytes_in_use = stats.bytes_in_use - old_size + (uint32_t)new_size;
+            if (stats.bytes_in_use > stats.peak_bytes) stats.peak_bytes = stats.bytes_in_use;
+            grown->size = (uint32_t)new_size;
+            return grown + 1;
+        }
+    } else {
+        Arena* arena = &arenas[hdr->arena - 1];
+        if (!arena->released) {
+            // Último bloco do chunk ativo: cresce no lugar.
+            Chunk* head = arena->chunks;
+            uint8_t* block_end = (uint8_t*)hdr + align_up(sizeof(BlockHeader) + old_size);
+            uint32_t new_total = align_up(sizeof(BlockHeader) + (uint32_t)new_size);
+            uint8_t* data = chunk_data(head);
+            if (block_end == data + head->used && ((uint8_t*)hdr - data) + new_total <= head->capacity) {
+                head->used = (uint32_t)((uint8_t*)hdr - data) + new_total;
+                stats.bytes_in_use = stats.bytes_in_use - old_size + (uint32_t)new_size;
+                if (stats.bytes_in_use > stats.peak_bytes) stats.peak_bytes = stats.bytes_in_use;
+                hdr->size = (uint32_t)new_size;
+                return ptr;
+            }
+            void* moved = arena_alloc(arena, new_size);
+            if (moved) {
+                memcpy(moved, ptr, old_size < new_size ? old_size : new_size);
+                mem_free(ptr);
+                return moved;
+            }
+        }
+    }
+
+    void* moved = tier_alloc(new_size);
+    if (!moved) {
+        stats.failed_allocs++;
+        return nullptr;
+    }
+    memcpy(moved, ptr, old_size < new_size ? old_size : new_size);
+    mem_free(ptr);
+    return moved;
+}
+
+extern "C" void* pda_mem_alloc(size_t size) {
+#if ALLOC_TRACE
+    AllocTrace::Scope trace; // Os chunks e a PSRAM pedidos aqui dentro não contam de novo
+#endif
+    void* ptr = mem_alloc(size);
+    MEM_TRACE("[mt] a %p %u\n", ptr, (unsigned)size);
+#if ALLOC_TRACE
+    if (trace.traced()) AllocTrace::record(ALLOC_TRACE_ALLOC, ALLOC_TRACE_LVGL, ptr, size);
+#endif
+    return ptr;
+}
+
+extern "C" void pda_mem_free(void* ptr) {
+    if (!ptr) return;
+    MEM_TRACE("[mt] f %p\n", ptr);
+#if ALLOC_TRACE
+    AllocTrace::Scope trace;
+    if (trace.traced()) AllocTrace::record(ALLOC_TRACE_FREE, ALLOC_TRACE_LVGL, ptr, 0);
+#endif
+    mem_free(ptr);
+}
+
+extern "C" void* pda_mem_realloc(void* ptr, size_t new_size) {
+    if (!ptr) return pda_mem_alloc(new_size);
+    if (new_size == 0) {
+        pda_mem_free(ptr);
+        return nullptr;
+    }
+#if ALLOC_TRACE
+    AllocTrace::Scope trace;
+#endif
+    void* moved = mem_realloc(ptr, new_size);
+    MEM_TRACE("[mt] r %p %p %u\n", ptr, moved, (unsigned)new_size);
+#if ALLOC_TRACE
+    if (trace.traced()) AllocTrace::record_realloc(ALLOC_TRACE_LVGL, ptr, moved, new_size);
+#endif
+    return moved;
+}
+
+static void sram_walker(void* ptr, size_t size, int used, void* user) {
+    LV_UNUSED(ptr);
+    if (used) return;
+    pda_mem_tier_stats_t* t = (pda_mem_tier_stats_t*)user;
+    t->free_size += (uint32_t)size;
+    if (size > t->largest_free) t->largest_free = (uint32_t)size;
+}
+
+static uint8_t frag_pct(const pda_mem_tier_stats_t& t) {
+    return t.free_size ? (uint8_t)(100 - ((uint64_t)t.largest_free * 100) / t.free_size) : 0;
+}
+
+extern "C" void pda_mem_get_stats(pda_mem_stats_t* out) {
+    if (!out) return;
+    *out = stats;
+
+    // Os campos de espaço livre são calculados na hora.
+    out->sram.free_size = 0;
+    out->sram.largest_free = 0;
+    if (sram_tlsf) lv_tlsf_walk_pool(lv_tlsf_get_pool(sram_tlsf), sram_walker, &out->sram);
+    out->sram.frag_pct = frag_pct(out->sram);
+
+    out->psram.total_size = (uint32_t)heap_caps_get_total_size(MALLOC_CAP_SPIRAM);
+    out->psram.free_size = (uint32_t)heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    out->psram.largest_free = (uint32_t)heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
+    out->psram.frag_pct = frag_pct(out->psram);
+}
+
+extern "C" void pda_mem_reset_peak(void) {
+    stats.peak_bytes = stats.bytes_in_use;
+    stats.sram.peak_bytes = stats.sram.bytes_in_use;
+    stats.psram.peak_bytes = stats.psram.bytes_in_use;
+}
+
+namespace LvMem {
+
+Arena* arena_create(const char* name) {
+#if PDA_MEM_ARENAS
+    for (int i = 0; i < ARENA_MAX; i++) {
+        if (!arenas[i].in_use) {
+            arenas[i].name = name;
+            arenas[i].chunks = nullptr;
+            memset(arenas[i].free_lists, 0, sizeof(arenas[i].free_lists));
+            arenas[i].live_blocks = 0;
+            arenas[i].in_use = true;
+            arenas[i].released = false;
+            stats.arenas_live++;
+            return &arenas[i];
+        }
+    }
+    LV_LOG_WARN("LvMem: no free arena slot for %s", name);
+#endif
+    return nullptr;
+}
+
+void arena_release(Arena* arena) {
+    if (!arena || !arena->in_use || arena->released) return;
+    arena->released = true;
+    if (arena->live_blocks == 0) {
+        arena_destroy(arena);
+    }
+}
+
+void arena_push(Arena* arena) {
+    if (arena_depth < ARENA_STACK_DEPTH) {
+        arena_stack[arena_depth++] = arena;
+        return;
+    }
+    // Pilha cheia: a alocação continua na arena do topo
+    arena_overflow++;
+    LV_LOG_WARN("LvMem: arena stack overflow");
+}
+
+void arena_pop() {
+    if (arena_overflow > 0) {
+        arena_overflow--;
+    } else if (arena_depth > 0) {
+        arena_depth--;
+    }
+}
+
+void print_stats(const char* tag) {
+    size_t free_internal = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    size_t largest_internal = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+    unsigned frag = free_internal ? (unsigned)(100 - (largest_internal * 100) / free_internal) : 0;
+
+    Serial.printf("[LvMem] %s: allocs=%u frees=%u reallocs=%u live=%u in_use=%u peak=%u failed=%u\n",
+                  tag, (unsigned)stats.alloc_count, (unsigned)stats.free_count, (unsigned)stats.realloc_count,
+                  (unsigned)stats.live_blocks, (unsigned)stats.bytes_in_use, (unsigned)stats.peak_bytes,
+                  (unsigned)stats.failed_allocs);
+    Serial.printf("[LvMem] %s: arena_allocs=%u arenas=%u released=%u chunks=%u reserved=%u\n",
+                  tag, (unsigned)stats.arena_allocs, (unsigned)stats.arenas_live, (unsigned)stats.arenas_released,
+                  (unsigned)stats.arena_chunks, (unsigned)stats.arena_reserved);
+    Serial.printf("[LvMem] %s: internal free=%u largest=%u fragmentation=%u%%\n",
+                  tag, (unsigned)free_internal, (unsigned)largest_internal, frag);
+
+    pda_mem_stats_t now;
+    pda_mem_get_stats(&now);
+    const pda_mem_tier_stats_t* tiers[] = { &now.sram, &now.psram };
+    const char* names[] = { "sram", "psram" };
+    for (int i = 0; i < 2; i++) {
+        const pda_mem_tier_stats_t& t = *tiers[i];
+        Serial.printf("[LvMem] %s: %s blocks=%u in_use=%u peak=%u failed=%u size=%u free=%u largest=%u fragmentation=%u%%\n",
+                      tag, names[i], (unsigned)t.blocks, (unsigned)t.bytes_in_use, (unsigned)t.peak_bytes,
+                      (unsigned)t.failed_allocs, (unsigned)t.total_size, (unsigned)t.free_size,
+                      (unsigned)t.largest_free, (unsigned)t.frag_pct);
+    }
+}
+
+} // namespace LvMem
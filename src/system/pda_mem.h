@@ -0,0 +1,164 @@
+#pragma once
+
+/**
+ * PDA Memory - Alocador customizado do LVGL
+ *
+ * Este header é incluído pelo próprio LVGL (via LV_MEM_CUSTOM_INCLUDE no lv_conf.h),
+ * por isso a interface básica é em C. As funções pda_mem_alloc/free/realloc
+ * substituem malloc/free/realloc para todas as alocações do LVGL.
+ *
+ * Dois níveis de heap (fora das arenas):
+ * - Alocações de até PDA_MEM_SRAM_MAX_SIZE bytes (objetos, estilos, textos curtos)
+ *   vão para um pool TLSF na SRAM interna (LV_MEM_CUSTOM_TLSF_POOL_SIZE).
+ * - As maiores (textos longos, cache de imagens, canvas, buffers de desenho) e tudo
+ *   que não couber no pool vão para a PSRAM.
+ * - Cada nível tem contadores próprios: uso, pico, fragmentação e falhas.
+ *
+ * Modo região (arena):
+ * - Uma arena agrupa as alocações de uma tela, modal ou reconstrução de lista
+ *   em blocos contíguos (chunks) de SRAM interna; objetos grandes vão para
+ *   chunks próprios na PSRAM.
+ * - Enquanto um ArenaScope estiver ativo, toda alocação do LVGL vai para a arena.
+ * - lv_mem_free() de um bloco da arena só decrementa um contador. Quando a arena
+ *   foi liberada (arena_release) e o último bloco é solto, todos os chunks voltam
+ *   ao heap de uma só vez. Blocos que "escapam" da tela (ex: um lv_group criado
+ *   dentro do modal) apenas mantêm a arena viva, nunca ficam pendurados.
+ * - Blocos soltos enquanto a arena está ativa (ex: realloc que precisou mover)
+ *   entram em listas livres por tamanho e são reaproveitados pela própria arena.
+ * - Containers que recebem os filhos devem ser criados fora do escopo. Se o
+ *   container ainda não tem filhos, chame lv_obj_allocate_spec_attr() nele antes,
+ *   senão seus dados internos nascem na arena e a mantêm viva.
+ *
+ * Exemplo de uso:
+ *
+ * #include "system/pda_mem.h"
+ *
+ * static LvMem::Arena* list_arena = nullptr;
+ *
+ * void rebuild_list() {
+ *     lv_obj_clean(list);
+ *     LvMem::arena_renew(list_arena, "my.list");
+ *     LvMem::ArenaScope scope(list_arena);
+ *     lv_list_add_btn(list, NULL, "Item");
+ * }
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*1: habilita o modo arena. 0: tudo vai para o heap, mas as estatísticas continuam ativas*/
+#ifndef PDA_MEM_ARENAS
+#define PDA_MEM_ARENAS 1
+#endif
+
+/*Alocações até este tamanho vão para o pool TLSF da SRAM interna; maiores vão para a PSRAM*/
+#ifndef PDA_MEM_SRAM_MAX_SIZE
+#define PDA_MEM_SRAM_MAX_SIZE 256
+#endif
+
+/*1: imprime cada alloc/free/realloc no Serial (linhas "[mt] ...") para reproduzir no host
+ *com tools/mem_replay. Deixa tudo bem mais lento, use só para capturar traces*/
+#ifndef PDA_MEM_TRACE
+#define PDA_MEM_TRACE 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t blocks;            /*Blocos vivos neste nível*/
+    uint32_t bytes_in_use;      /*Bytes pedidos e ainda não liberados*/
+    uint32_t peak_bytes;        /*Pico de bytes_in_use*/
+    uint32_t failed_allocs;     /*Pedidos que este nível não atendeu (foram para o próximo)*/
+    uint32_t total_size;        /*Tamanho do pool TLSF / da PSRAM*/
+    uint32_t free_size;         /*Bytes livres (calculado em pda_mem_get_stats)*/
+    uint32_t largest_free;      /*Maior bloco livre*/
+    uint8_t frag_pct;           /*100 - largest_free * 100 / free_size*/
+} pda_mem_tier_stats_t;
+
+typedef struct {
+    uint32_t alloc_count;       /*Total de alocações desde o boot*/
+    uint32_t free_count;        /*Total de liberações*/
+    uint32_t realloc_count;     /*Total de realocações*/
+    uint32_t live_blocks;       /*Blocos atualmente alocados*/
+    uint32_t bytes_in_use;      /*Bytes pedidos pelo LVGL e ainda não liberados*/
+    uint32_t peak_bytes;        /*Pico de bytes_in_use*/
+    uint32_t failed_allocs;     /*Alocações que retornaram NULL*/
+    uint32_t arena_allocs;      /*Alocações servidas por uma arena*/
+    uint32_t arena_chunks;      /*Chunks de arena atualmente reservados*/
+    uint32_t arena_reserved;    /*Bytes reservados pelos chunks das arenas*/
+    uint32_t arenas_live;       /*Arenas ainda não devolvidas ao heap*/
+    uint32_t arenas_released;   /*Arenas devolvidas inteiras ao heap*/
+    pda_mem_tier_stats_t sram;  /*Pool TLSF na SRAM interna*/
+    pda_mem_tier_stats_t psram; /*PSRAM (e SRAM interna como último recurso)*/
+} pda_mem_stats_t;
+
+void * pda_mem_alloc(size_t size);
+void pda_mem_free(void * ptr);
+void * pda_mem_realloc(void * ptr, size_t new_size);
+void pda_mem_get_stats(pda_mem_stats_t * stats);
+/*Reinicia os picos (geral e de cada nível) no uso atual, para medir o pico de um trecho*/
+void pda_mem_reset_peak(void);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+
+namespace LvMem {
+
+struct Arena;
+
+/**
+ * @brief Cria uma nova arena. Retorna nullptr se não houver slots livres
+ * (nesse caso as alocações simplesmente vão para o heap).
+ */
+Arena* arena_create(const char* name);
+
+/**
+ * @brief Marca a arena como liberada. A memória volta ao heap inteira
+ * assim que o último bloco vivo for solto (imediatamente, se já não houver nenhum).
+ */
+void arena_release(Arena* arena);
+
+/**
+ * @brief Libera a arena antiga (se houver) e cria uma nova no mesmo ponteiro.
+ */
+inline void arena_renew(Arena*& arena, const char* name) {
+    arena_release(arena);
+    arena = arena_create(name);
+}
+
+void arena_push(Arena* arena);
+void arena_pop();
+
+/**
+ * @brief Enquanto existir, direciona as alocações do LVGL para a arena.
+ * Com nullptr, força o heap (ex: em torno de lv_refr_now() dentro de um escopo,
+ * para que os buffers temporários do desenho não ocupem a arena).
+ */
+class ArenaScope {
+public:
+    explicit ArenaScope(Arena* arena) { arena_push(arena); }
+    ~ArenaScope() { arena_pop(); }
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+};
+
+/**
+ * @brief Retorna uma cópia das estatísticas do alocador.
+ */
+inline pda_mem_stats_t get_stats() {
+    pda_mem_stats_t stats;
+    pda_mem_get_stats(&stats);
+    return stats;
+}
+
+/**
+ * @brief Imprime as estatísticas e a fragmentação da SRAM interna no Serial.
+ * @param tag Texto para identificar o ponto da medição (ex: "before rebuild").
+ */
+void print_stats(const char* tag);
+
+} // namespace LvMem
+
+#endif /*__cplusplus*/
@@ -0,0 +1,142 @@
+#include "pda_trace.h"
+
+#if PDA_TRACE
+
+#include <Arduino.h>
+#include <string.h>
+
+namespace {
+
+static_assert(sizeof(pda_trace_record_t) == 12, "pda_trace_record_t is part of the wire format");
+static_assert((PDA_TRACE_RING & (PDA_TRACE_RING - 1)) == 0, "PDA_TRACE_RING must be a power of 2");
+
+constexpr int CORES = 2;
+constexpr uint8_t SYNC[4] = {0x00, 0xA5, 'P', 'T'};
+// Sincronismo + tipo + tamanho + soma
+constexpr size_t FRAME_OVERHEAD = sizeof(SYNC) + 1 + 2 + 1;
+// Registros por quadro de eventos: quadros curtos não seguram o buffer da USB
+constexpr uint16_t RECORDS_PER_FRAME = 64;
+
+// Anel de um núcleo. head só é escrito pelo próprio núcleo (com as interrupções
+// dele mascaradas), tail só pelo pda_trace_drain().
+struct Ring {
+    pda_trace_record_t records[PDA_TRACE_RING];
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    volatile uint32_t dropped;
+    uint32_t dropped_reported;
+};
+
+Ring rings[CORES];
+
+const char* names[PDA_TRACE_MAX_NAMES] = {"lv_timer_handler"}; // PDA_TRACE_ID_LV_TIMER
+uint16_t name_count = 1;
+uint16_t names_sent = 0;
+portMUX_TYPE names_mux = portMUX_INITIALIZER_UNLOCKED;
+
+uint8_t frame[FRAME_OVERHEAD + 1 + RECORDS_PER_FRAME * sizeof(pda_trace_record_t)];
+
+/**
+ * @brief Monta o quadro em `frame` e envia. Retorna false se não coube no buffer da USB.
+ */
+bool send_frame(uint8_t type, const void* a, size_t a_len, const void* b, size_t b_len) {
+    size_t len = a_len + b_len;
+    size_t total = FRAME_OVERHEAD + len;
+    if ((size_t)Serial.availableForWrite() < total) return false;
+
+    uint8_t* p = frame;
+    memcpy(p, SYNC, sizeof(SYNC));
+    p += sizeof(SYNC);
+    *p++ = type;
+    *p++ = (uint8_t)(len & 0xFF);
+    *p++ = (uint8_t)(len >> 8);
+    memcpy(p, a, a_len);
+    memcpy(p + a_len, b, b_len);
+    uint8_t sum = 0;
+    for (size_t i = 0; i < len; i++) sum += p[i];
+    p[len] = sum;
+    Serial.write(frame, total);
+    return true;
+}
+
+bool send_names() {
+    while (names_sent < name_count) {
+        const char* name = names[names_sent];
+        uint8_t id[2] = {(uint8_t)(names_sent & 0xFF), (uint8_t)(names_sent >> 8)};
+        if (!send_frame(PDA_TRACE_FRAME_NAME, id, sizeof(id), name, strlen(name))) return false;
+        names_sent++;
+    }
+    return true;
+}
+
+bool send_ring(uint8_t core) {
+    Ring& ring = rings[core];
+
+    uint32_t dropped = ring.dropped;
+    if (dropped != ring.dropped_reported) {
+        uint32_t n = dropped - ring.dropped_reported;
+        uint8_t count[4] = {(uint8_t)n, (uint8_t)(n >> 8), (uint8_t)(n >> 16), (uint8_t)(n >> 24)};
+        if (!send_frame(PDA_TRACE_FRAME_DROPPED, &core, 1, count, sizeof(count))) return false;
+        ring.dropped_reported = dropped;
+    }
+
+    uint32_t head = __atomic_load_n(&ring.head, __ATOMIC_ACQUIRE);
+    while (ring.tail != head) {
+        uint32_t tail = ring.tail;
+        uint32_t n = head - tail;
+        if (n > RECORDS_PER_FRAME) n = RECORDS_PER_FRAME;
+        // Não dá a volta no anel dentro de um quadro
+        uint32_t start = tail & (PDA_TRACE_RING - 1);
+        if (start + n > PDA_TRACE_RING) n = PDA_TRACE_RING - start;
+        if (!send_frame(PDA_TRACE_FRAME_EVENTS, &core, 1, &ring.records[start], n * sizeof(pda_trace_record_t))) {
+            return false;
+        }
+        __atomic_store_n(&ring.tail, tail + n, __ATOMIC_RELEASE);
+    }
+    return true;
+}
+
+} // namespace
+
+extern "C" uint16_t pda_trace_intern(const char* name) {
+    portENTER_CRITICAL(&names_mux);
+    uint16_t id = 0;
+    for (; id < name_count; id++) {
+        if (names[id] == name || strcmp(names[id], name) == 0) break;
+    }
+    if (id == name_count) {
+        if (name_count < PDA_TRACE_MAX_NAMES) names[name_count++] = name;
+        else id = PDA_TRACE_MAX_NAMES - 1; // Tabela cheia: divide o último id
+    }
+    portEXIT_CRITICAL(&names_mux);
+    return id;
+}
+
+extern "C" void pda_trace_emit(uint16_t name_id, uint8_t type, int32_t value) {
+    // Só o núcleo atual escreve neste anel: basta mascarar as interrupções dele
+    UBaseType_t irq = portSET_INTERRUPT_MASK_FROM_ISR();
+    Ring& ring = rings[xPortGetCoreID()];
+    uint32_t head = ring.head;
+    if (head - __atomic_load_n(&ring.tail, __ATOMIC_ACQUIRE) < PDA_TRACE_RING) {
+        pda_trace_record_t& r = ring.records[head & (PDA_TRACE_RING - 1)];
+        r.ts_us = micros();
+        r.name_id = name_id;
+        r.type = type;
+        r.reserved = 0;
+        r.value = value;
+        __atomic_store_n(&ring.head, head + 1, __ATOMIC_RELEASE);
+    } else {
+        ring.dropped = ring.dropped + 1;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(irq);
+}
+
+extern "C" void pda_trace_drain(void) {
+    // Nomes antes dos eventos que os usam; o que não couber fica para a próxima chamada
+    if (!send_names()) return;
+    for (uint8_t core = 0; core < CORES; core++) {
+        if (!send_ring(core)) return;
+    }
+}
+
+#endif /*PDA_TRACE*/
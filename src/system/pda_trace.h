@@ -0,0 +1,153 @@
+#pragma once
+
+/**
+ * PDA Trace - Eventos de trace binários pela USB CDC
+ *
+ * Marca trechos quentes (flush do display, lv_timer_handler, handle() dos apps,
+ * fases das buscas HTTP e parse de JSON) com eventos de início/fim, instantes e
+ * contadores. O resultado abre no Perfetto (ui.perfetto.dev) ou no
+ * chrome://tracing depois de convertido por tools/trace/trace2perfetto.py.
+ *
+ * - Cada núcleo tem seu próprio anel de PDA_TRACE_RING registros de 12 bytes.
+ *   O produtor só mascara as interrupções do próprio núcleo enquanto grava
+ *   (nenhuma trava entre núcleos); o consumidor é o pda_trace_drain().
+ * - Os nomes viram ids de 16 bits na primeira vez que um ponto de trace roda
+ *   (o id fica numa variável estática do ponto); o nome só trafega uma vez.
+ * - pda_trace_drain(), chamado no loop(), manda quadros binários pelo Serial
+ *   (USB CDC com ARDUINO_USB_CDC_ON_BOOT=1) sem passar do espaço livre no buffer
+ *   de transmissão. O texto do Serial.printf e do LV_LOG continua no mesmo fluxo;
+ *   o conversor separa os dois pelos bytes de sincronismo.
+ * - Anel cheio: o evento é descartado e contado; o conversor avisa quantos.
+ *
+ * Formato de um quadro (little-endian):
+ *   00 A5 'P' 'T' | tipo (1) | tamanho (2) | dados | soma dos dados & 0xFF (1)
+ *   PDA_TRACE_FRAME_EVENTS:  núcleo (1), registros pda_trace_record_t
+ *   PDA_TRACE_FRAME_NAME:    id (2), texto sem terminador
+ *   PDA_TRACE_FRAME_DROPPED: núcleo (1), descartados desde o último aviso (4)
+ *
+ * Com PDA_TRACE 0 (padrão) as macros não geram código e nada é enviado. Este
+ * header também é incluído pelo LVGL (lv_conf.h) para marcar o lv_timer_handler(),
+ * por isso a interface básica é em C.
+ *
+ * 🔬 Exemplo de uso:
+ *
+ * ; platformio.ini
+ * build_flags = ... -DPDA_TRACE=1
+ *
+ * inline void handle() {
+ *     PDA_TRACE_SCOPE("Weather::handle");
+ *     ...
+ * }
+ *
+ * void loop() {
+ *     AppManager::handle();
+ *     PDA_TRACE_DRAIN();
+ * }
+ *
+ * $ python tools/trace/trace2perfetto.py --port /dev/ttyACM0 --seconds 10 -o pda.json
+ */
+
+#include <stdint.h>
+
+#ifndef PDA_TRACE
+#define PDA_TRACE 0
+#endif
+
+/*Registros por núcleo; potência de 2*/
+#ifndef PDA_TRACE_RING
+#define PDA_TRACE_RING 1024
+#endif
+
+/*Nomes distintos (pontos de trace com o mesmo texto dividem o id)*/
+#ifndef PDA_TRACE_MAX_NAMES
+#define PDA_TRACE_MAX_NAMES 128
+#endif
+
+#define PDA_TRACE_BEGIN_EVENT   0
+#define PDA_TRACE_END_EVENT     1
+#define PDA_TRACE_INSTANT_EVENT 2
+#define PDA_TRACE_COUNTER_EVENT 3
+
+#define PDA_TRACE_FRAME_EVENTS  1
+#define PDA_TRACE_FRAME_NAME    2
+#define PDA_TRACE_FRAME_DROPPED 3
+
+/*Ids fixos, usados pelo LVGL (em C não há a variável estática por ponto)*/
+#define PDA_TRACE_ID_LV_TIMER   0
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t ts_us;     /*micros() do evento*/
+    uint16_t name_id;
+    uint8_t type;       /*PDA_TRACE_*_EVENT*/
+    uint8_t reserved;
+    int32_t value;      /*Valor do contador (ou argumento do instante)*/
+} pda_trace_record_t;
+
+#if PDA_TRACE
+uint16_t pda_trace_intern(const char * name);
+void pda_trace_emit(uint16_t name_id, uint8_t type, int32_t value);
+void pda_trace_drain(void);
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#if PDA_TRACE
+
+#define PDA_TRACE_CAT2(a, b) a##b
+#define PDA_TRACE_CAT(a, b) PDA_TRACE_CAT2(a, b)
+#define PDA_TRACE_ID(name) \
+    static const uint16_t PDA_TRACE_CAT(pda_trace_id_, __LINE__) = pda_trace_intern(name)
+
+#ifdef __cplusplus
+namespace PdaTrace {
+
+/**
+ * @brief Início no construtor, fim no destrutor.
+ */
+class Scope {
+public:
+    explicit Scope(uint16_t id) : id_(id) { pda_trace_emit(id_, PDA_TRACE_BEGIN_EVENT, 0); }
+    ~Scope() { pda_trace_emit(id_, PDA_TRACE_END_EVENT, 0); }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    uint16_t id_;
+};
+
+} // namespace PdaTrace
+
+/*Marca o bloco atual inteiro*/
+#define PDA_TRACE_SCOPE(name)                                  \
+    PDA_TRACE_ID(name);                                        \
+    PdaTrace::Scope PDA_TRACE_CAT(pda_trace_scope_, __LINE__)( \
+        PDA_TRACE_CAT(pda_trace_id_, __LINE__))
+#endif
+
+/*Início e fim separados: o mesmo nome nos dois pontos*/
+#define PDA_TRACE_BEGIN(name) do { PDA_TRACE_ID(name); \
+    pda_trace_emit(PDA_TRACE_CAT(pda_trace_id_, __LINE__), PDA_TRACE_BEGIN_EVENT, 0); } while (0)
+#define PDA_TRACE_END(name) do { PDA_TRACE_ID(name); \
+    pda_trace_emit(PDA_TRACE_CAT(pda_trace_id_, __LINE__), PDA_TRACE_END_EVENT, 0); } while (0)
+#define PDA_TRACE_INSTANT(name, value) do { PDA_TRACE_ID(name); \
+    pda_trace_emit(PDA_TRACE_CAT(pda_trace_id_, __LINE__), PDA_TRACE_INSTANT_EVENT, (int32_t)(value)); } while (0)
+#define PDA_TRACE_COUNTER(name, value) do { PDA_TRACE_ID(name); \
+    pda_trace_emit(PDA_TRACE_CAT(pda_trace_id_, __LINE__), PDA_TRACE_COUNTER_EVENT, (int32_t)(value)); } while (0)
+#define PDA_TRACE_DRAIN() pda_trace_drain()
+
+#else
+
+#define PDA_TRACE_SCOPE(name) ((void)0)
+#define PDA_TRACE_BEGIN(name) ((void)0)
+#define PDA_TRACE_END(name) ((void)0)
+#define PDA_TRACE_INSTANT(name, value) ((void)0)
+#define PDA_TRACE_COUNTER(name, value) ((void)0)
+#define PDA_TRACE_DRAIN() ((void)0)
+
+#endif
@@ -0,0 +1,120 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+
+/**
+ * RenderCache - Camadas retidas para partes da tela que quase nunca mudam
+ *
+ * Com o full refresh, cada quadro redesenha a tela inteira: retângulos
+ * arredondados, labels e ícones com alfa, mesmo quando só o relógio mudou.
+ * Um objeto marcado com enable() é desenhado uma vez (com os filhos) em uma
+ * camada RGB565 na PSRAM (lv_obj_set_render_cache(), via lv_draw_layer do
+ * LVGL). Nos quadros seguintes a camada só é copiada linha a linha para o
+ * buffer de desenho.
+ *
+ * - A camada inclui o que está por baixo do objeto (fundo da tela, do pai).
+ * - Qualquer invalidação que encoste na área da camada, na mesma tela, descarta
+ *   a camada: um filho que muda, o objeto que se move, o fundo que muda. Ela é
+ *   desenhada de novo no próximo quadro (um "miss").
+ * - Com refresh parcial, descartar a camada invalida o objeto inteiro: ela só
+ *   pode ser refeita num quadro que redesenha toda a área dela.
+ * - Use em subárvores estáticas e pequenas o bastante para não mudarem a cada
+ *   quadro. Objetos animados dentro da camada fazem só misses.
+ * - A camada é liberada junto com o objeto.
+ *
+ * 🧊 Exemplo de uso:
+ *
+ * #include "system/render_cache.h"
+ *
+ * lv_obj_t* header = lv_obj_create(screen);
+ * PdaTheme::create_title(header, "Settings");
+ * RenderCache::enable(header, "settings.header");
+ *
+ * RenderCache::print_stats();   // hits/misses de cada camada no Serial
+ */
+
+namespace RenderCache {
+
+#define RENDER_CACHE_MAX_NAMES 16
+
+struct Name {
+    const lv_obj_t* obj;
+    const char* name;
+};
+
+static Name names[RENDER_CACHE_MAX_NAMES];
+
+/**
+ * @brief Retorna o nome dado à camada de `obj` em enable(), ou "?".
+ */
+inline const char* name_of(const lv_obj_t* obj) {
+    for (int i = 0; i < RENDER_CACHE_MAX_NAMES; i++) {
+        if (names[i].obj == obj) return names[i].name;
+    }
+    return "?";
+}
+
+/**
+ * @brief Passa a desenhar `obj` e seus filhos a partir de uma camada retida.
+ * @param name Nome usado nas estatísticas (string estática).
+ */
+inline void enable(lv_obj_t* obj, const char* name) {
+#if LV_USE_RENDER_CACHE
+    lv_obj_set_render_cache(obj, true);
+
+    // Reaproveita a entrada de um objeto que já foi apagado
+    int slot = -1;
+    for (int i = 0; i < RENDER_CACHE_MAX_NAMES && slot < 0; i++) {
+        if (names[i].obj == obj || names[i].obj == nullptr) slot = i;
+    }
+    for (int i = 0; i < RENDER_CACHE_MAX_NAMES && slot < 0; i++) {
+        bool alive = false;
+        for (const lv_obj_render_cache_t* c = lv_obj_render_cache_get_next(NULL); c; c = lv_obj_render_cache_get_next(c)) {
+            if (c->obj == names[i].obj) alive = true;
+        }
+        if (!alive) slot = i;
+    }
+    if (slot >= 0) names[slot] = { obj, name };
+#else
+    LV_UNUSED(obj);
+    LV_UNUSED(name);
+#endif
+}
+
+/**
+ * @brief Volta a desenhar `obj` normalmente e libera a camada.
+ */
+inline void disable(lv_obj_t* obj) {
+#if LV_USE_RENDER_CACHE
+    lv_obj_set_render_cache(obj, false);
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+/**
+ * @brief Imprime hits, misses e o tamanho de cada camada no Serial.
+ */
+inline void print_stats() {
+#if LV_USE_RENDER_CACHE
+    for (const lv_obj_render_cache_t* c = lv_obj_render_cache_get_next(NULL); c; c = lv_obj_render_cache_get_next(c)) {
+        uint32_t total = c->hits + c->misses;
+        Serial.printf("[RenderCache] %s: hits=%u misses=%u hit_rate=%u%% %dx%d valid=%u\n",
+                      name_of(c->obj), (unsigned)c->hits, (unsigned)c->misses,
+                      total ? (unsigned)(c->hits * 100 / total) : 0,
+                      lv_area_get_width(&c->area), lv_area_get_height(&c->area), (unsigned)c->valid);
+    }
+    Serial.printf("[RenderCache] total: %u bytes\n", (unsigned)lv_obj_render_cache_get_used_bytes());
+#endif
+}
+
+/**
+ * @brief Zera os contadores de todas as camadas.
+ */
+inline void reset_stats() {
+#if LV_USE_RENDER_CACHE
+    lv_obj_render_cache_reset_stats();
+#endif
+}
+
+} // namespace RenderCache
@@ -0,0 +1,510 @@
+#include "sd_card.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "system/pda_log.h"
+
+#if defined(ESP_PLATFORM)
+#include "system/sd_spi.h"
+#endif
+
+static_assert((SD_CARD_BLOCK & (SD_CARD_BLOCK - 1)) == 0 && SD_CARD_BLOCK % 512 == 0,
+              "SD_CARD_BLOCK must be a power of two and a multiple of the sector");
+
+namespace {
+
+constexpr uint32_t TASK_STACK = 4096;
+constexpr UBaseType_t TASK_PRIORITY = 3;   // Acima do loop() (1): a leitura adiante chega antes da UI
+constexpr BaseType_t TASK_CORE = 0;
+constexpr uint8_t QUEUE = 8;               // Pedidos de leitura adiante pendentes
+constexpr uint32_t WAIT_MS = 50;           // Limite de cada espera: cobre uma notificação perdida
+
+// Arquivo aberto pelo driver do LVGL
+struct SdFile {
+    int fd;
+    uint32_t size;
+    uint32_t pos;
+    uint32_t last_block;        // Bloco da última leitura: o seguinte continua a sequência
+    uint8_t reading;            // Blocos deste arquivo sendo lidos adiante pela tarefa
+    bool busy;                  // Fechando ou escrevendo: nada de ler adiante
+    TaskHandle_t waiter;        // Quem espera `reading` zerar
+};
+
+enum : uint8_t { SLOT_FREE, SLOT_LOADING, SLOT_READY };
+
+// Um bloco do cache: pool + índice * SD_CARD_BLOCK
+struct Slot {
+    SdFile* file;
+    uint32_t offset;            // Alinhado em SD_CARD_BLOCK
+    uint32_t len;               // Menor no último bloco do arquivo
+    uint32_t used;              // Para o LRU
+    uint8_t state;
+    bool prefetched;            // Lido adiante e ainda não usado
+    TaskHandle_t waiter;        // Quem espera o fim do carregamento
+};
+
+struct Request {
+    SdFile* file;
+    uint32_t offset;
+};
+
+SemaphoreHandle_t lock = nullptr;   // Cache, fila e contadores
+uint8_t* pool = nullptr;
+Slot slots[SD_CARD_CACHE_BLOCKS];
+uint32_t tick = 0;
+Request queue[QUEUE];
+uint8_t queue_count = 0;
+#if SD_CARD_ASYNC
+TaskHandle_t task = nullptr;
+#endif
+volatile bool is_mounted = false;
+uint32_t begin_ms = 0;
+SdCard::Stats counters = {};
+lv_fs_drv_t fs_drv;
+
+inline void take() {
+    xSemaphoreTake(lock, portMAX_DELAY);
+}
+
+inline void give() {
+    xSemaphoreGive(lock);
+}
+
+inline uint32_t block_of(uint32_t pos) {
+    return pos & ~(uint32_t)(SD_CARD_BLOCK - 1);
+}
+
+inline uint8_t* slot_data(const Slot& s) {
+    return pool + (&s - slots) * SD_CARD_BLOCK;
+}
+
+/*Espera uma notificação com a trava solta. Só na tarefa da UI*/
+void wait_unlocked(TaskHandle_t* waiter) {
+#if SD_CARD_ASYNC
+    *waiter = xTaskGetCurrentTaskHandle();
+    give();
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(WAIT_MS));
+    take();
+#else
+    (void)waiter;   // No host nada fica pela metade fora da própria chamada
+#endif
+}
+
+void wake(TaskHandle_t* waiter) {
+#if SD_CARD_ASYNC
+    if (*waiter) xTaskNotifyGive(*waiter);
+#endif
+    *waiter = nullptr;
+}
+
+void full_path(const char* path, char* out, size_t size) {
+    while (*path == '/') path++;
+    snprintf(out, size, "%s/%s", SD_CARD_MOUNT, path);
+}
+
+Slot* find(SdFile* f, uint32_t offset) {
+    for (Slot& s : slots) {
+        if (s.state != SLOT_FREE && s.file == f && s.offset == offset) return &s;
+    }
+    return nullptr;
+}
+
+void drop(Slot& s) {
+    if (s.prefetched) counters.prefetch_unused++;
+    s.state = SLOT_FREE;
+    s.file = nullptr;
+    s.prefetched = false;
+}
+
+/*Bloco livre ou o usado há mais tempo. nullptr se todos estão sendo carregados*/
+Slot* victim() {
+    Slot* best = nullptr;
+    for (Slot& s : slots) {
+        if (s.state == SLOT_FREE) return &s;
+        if (s.state == SLOT_READY && (!best || s.used < best->used)) best = &s;
+    }
+    if (best) drop(*best);
+    return best;
+}
+
+/**
+ * @brief Lê `len` bytes de `offset` no cartão, com a trava solta. Conta nos
+ * contadores de E/S e retorna os bytes lidos (-1 em erro).
+ */
+int32_t io_read(SdFile* f, uint8_t* dst, uint32_t len, uint32_t offset) {
+    give();
+    uint32_t start = micros();
+    ssize_t n = pread(f->fd, dst, len, offset);
+    uint32_t us = micros() - start;
+    take();
+    counters.io_reads++;
+    counters.io_us += us;
+    if (n < 0) {
+        counters.errors++;
+        return -1;
+    }
+    counters.io_bytes += n;
+    return (int32_t)n;
+}
+
+/**
+ * @brief Carrega o bloco `offset` de `f` em `s`. Volta com o bloco pronto (true)
+ * ou livre de novo, e acorda quem esperava por ele.
+ */
+bool load(Slot& s, SdFile* f, uint32_t offset, bool prefetch) {
+    s.file = f;
+    s.offset = offset;
+    s.state = SLOT_LOADING;
+    s.prefetched = prefetch;
+    s.waiter = nullptr;
+    uint32_t want = f->size - offset < SD_CARD_BLOCK ? f->size - offset : SD_CARD_BLOCK;
+    int32_t n = io_read(f, slot_data(s), want, offset);
+    bool ok = n == (int32_t)want;
+    if (ok) {
+        s.len = want;
+        s.used = ++tick;
+        s.state = SLOT_READY;
+    } else {
+        s.state = SLOT_FREE;
+        s.file = nullptr;
+        s.prefetched = false;
+    }
+    wake(&s.waiter);
+    return ok;
+}
+
+/**
+ * @brief Pede os blocos depois de `block` que ainda não estão no cache nem na fila.
+ */
+void request_readahead(SdFile* f, uint32_t block) {
+    for (uint32_t i = 1; i <= SD_CARD_READAHEAD; i++) {
+        uint32_t offset = block + i * SD_CARD_BLOCK;
+        if (offset >= f->size) break;
+        if (find(f, offset)) continue;
+        bool queued = false;
+        for (uint8_t q = 0; q < queue_count && !queued; q++) {
+            queued = queue[q].file == f && queue[q].offset == offset;
+        }
+        if (queued || queue_count == QUEUE) continue;
+        queue[queue_count++] = Request{f, offset};
+    }
+}
+
+void forget_requests(SdFile* f) {
+    uint8_t kept = 0;
+    for (uint8_t q = 0; q < queue_count; q++) {
+        if (queue[q].file != f) queue[kept++] = queue[q];
+    }
+    queue_count = kept;
+}
+
+/*Espera as leituras adiante de `f` em andamento. Com `busy`, nenhuma nova começa*/
+void wait_readahead(SdFile* f) {
+    f->busy = true;
+    forget_requests(f);
+    while (f->reading) wait_unlocked(&f->waiter);
+}
+
+/**
+ * @brief Atende a fila de leitura adiante, na ordem dos pedidos. Com a trava.
+ */
+void service() {
+    while (queue_count) {
+        Request r = queue[0];
+        memmove(&queue[0], &queue[1], (queue_count - 1) * sizeof(Request));
+        queue_count--;
+        if (r.file->busy || find(r.file, r.offset)) continue;
+        Slot* s = victim();
+        if (!s) return;
+        r.file->reading++;
+        if (load(*s, r.file, r.offset, true)) counters.prefetches++;
+        r.file->reading--;
+        if (!r.file->reading) wake(&r.file->waiter);
+    }
+}
+
+void mount() {
+#if defined(ESP_PLATFORM)
+    bool ok = SdSpi::mount(SD_CARD_MOUNT, SD_CARD_MAX_FILES);
+    uint32_t card_mb = SdSpi::sectors() / 2048;
+#else
+    struct stat st;
+    bool ok = stat(SD_CARD_MOUNT, &st) == 0 && S_ISDIR(st.st_mode);
+    uint32_t card_mb = 0;
+#endif
+    take();
+    counters.mounted = ok;
+    counters.mount_ms = millis() - begin_ms;
+    counters.card_mb = card_mb;
+    give();
+    is_mounted = ok;
+    if (ok) {
+        pda_log(PDA_LOG_SYSTEM, PDA_LOG_INFO, "SdCard: %lu MB mounted at %s in %lu ms", (unsigned long)card_mb,
+                SD_CARD_MOUNT, (unsigned long)counters.mount_ms);
+    }
+}
+
+#if SD_CARD_ASYNC
+void task_fn(void*) {
+    mount();
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        take();
+        service();
+        give();
+    }
+}
+#endif
+
+// --- Driver de arquivos do LVGL ---
+
+bool fs_ready(lv_fs_drv_t* drv) {
+    LV_UNUSED(drv);
+    return is_mounted;
+}
+
+void* fs_open(lv_fs_drv_t* drv, const char* path, lv_fs_mode_t mode) {
+    LV_UNUSED(drv);
+    if (!is_mounted) return nullptr;
+    // Como os modos "rb", "wb" e "r+b" do stdio
+    int flags = O_RDONLY;
+    if (mode == LV_FS_MODE_WR) flags = O_WRONLY | O_CREAT | O_TRUNC;
+    else if (mode == (LV_FS_MODE_WR | LV_FS_MODE_RD)) flags = O_RDWR | O_CREAT;
+
+    char full[LV_FS_MAX_PATH_LENGTH];
+    full_path(path, full, sizeof(full));
+    int fd = open(full, flags, 0644);
+    if (fd < 0) return nullptr;
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    SdFile* f = (SdFile*)lv_mem_alloc(sizeof(SdFile));
+    if (!f) {
+        close(fd);
+        return nullptr;
+    }
+    *f = SdFile{fd, (uint32_t)st.st_size, 0, 0, 0, false, nullptr};
+    return f;
+}
+
+lv_fs_res_t fs_close(lv_fs_drv_t* drv, void* file_p) {
+    LV_UNUSED(drv);
+    SdFile* f = (SdFile*)file_p;
+    take();
+    wait_readahead(f);
+    for (Slot& s : slots) {
+        if (s.state == SLOT_READY && s.file == f) drop(s);
+    }
+    give();
+    close(f->fd);
+    lv_mem_free(f);
+    return LV_FS_RES_OK;
+}
+
+lv_fs_res_t fs_read(lv_fs_drv_t* drv, void* file_p, void* buf, uint32_t btr, uint32_t* br) {
+    LV_UNUSED(drv);
+    SdFile* f = (SdFile*)file_p;
+    uint32_t start = micros();
+    uint8_t* out = (uint8_t*)buf;
+    uint32_t done = 0;
+    lv_fs_res_t res = LV_FS_RES_OK;
+    if (f->pos >= f->size) btr = 0;
+    else if (btr > f->size - f->pos) btr = f->size - f->pos;
+
+    take();
+    // Sequencial: continua o bloco anterior ou o seguinte
+    uint32_t first_block = block_of(f->pos);
+    bool sequential = first_block == f->last_block || first_block == f->last_block + SD_CARD_BLOCK;
+    while (done < btr) {
+        uint32_t block = block_of(f->pos);
+        Slot* s = find(f, block);
+        if (s && s->state == SLOT_LOADING) {
+            // A tarefa está trazendo este bloco: espera só o resto dele
+            counters.waits++;
+            wait_unlocked(&s->waiter);
+            continue;
+        }
+        if (s) {
+            uint32_t n = s->len - (f->pos - block);
+            if (n > btr - done) n = btr - done;
+            memcpy(out + done, slot_data(*s) + (f->pos - block), n);
+            s->used = ++tick;
+            s->prefetched = false;
+            counters.hits++;
+            done += n;
+            f->pos += n;
+            continue;
+        }
+
+        counters.misses++;
+        uint32_t want = btr - done;
+        if (f->pos == block && want >= SD_CARD_BLOCK) want = block_of(want);
+        else if (sequential || want < SD_CARD_BLOCK / 4) s = victim();
+        if (!s) {
+            // Grande e alinhada, um salto grande ou todos os blocos sendo
+            // carregados: só o pedido, direto para o destino
+            if (io_read(f, out + done, want, f->pos) != (int32_t)want) {
+                res = LV_FS_RES_HW_ERR;
+                break;
+            }
+            done += want;
+            f->pos += want;
+            continue;
+        }
+        if (!load(*s, f, block, false)) {
+            res = LV_FS_RES_HW_ERR;
+            break;
+        }
+    }
+
+    if (done) f->last_block = block_of(f->pos - 1);
+    if (sequential && !f->busy && res == LV_FS_RES_OK) request_readahead(f, f->last_block);
+
+    uint32_t us = micros() - start;
+    counters.reads++;
+    counters.bytes += done;
+    counters.read_us += us;
+    if (us > counters.max_read_us) counters.max_read_us = us;
+#if SD_CARD_ASYNC
+    bool pending = queue_count > 0;
+    give();
+    if (pending) xTaskNotifyGive(task);
+#else
+    // Host: a leitura adiante acontece aqui, depois de entregar o pedido
+    service();
+    give();
+#endif
+    if (br) *br = done;
+    return res;
+}
+
+lv_fs_res_t fs_write(lv_fs_drv_t* drv, void* file_p, const void* buf, uint32_t btw, uint32_t* bw) {
+    LV_UNUSED(drv);
+    SdFile* f = (SdFile*)file_p;
+    take();
+    // Nada lido adiante pode misturar o conteúdo velho com o novo
+    wait_readahead(f);
+    for (Slot& s : slots) {
+        if (s.state == SLOT_READY && s.file == f && s.offset < f->pos + btw && s.offset + s.len > f->pos) drop(s);
+    }
+    give();
+
+    ssize_t n = pwrite(f->fd, buf, btw, f->pos);
+
+    take();
+    f->busy = false;
+    if (n < 0) {
+        counters.errors++;
+        give();
+        if (bw) *bw = 0;
+        return LV_FS_RES_HW_ERR;
+    }
+    f->pos += n;
+    if (f->pos > f->size) f->size = f->pos;
+    counters.writes++;
+    counters.write_bytes += n;
+    give();
+    if (bw) *bw = (uint32_t)n;
+    return LV_FS_RES_OK;
+}
+
+lv_fs_res_t fs_seek(lv_fs_drv_t* drv, void* file_p, uint32_t pos, lv_fs_whence_t whence) {
+    LV_UNUSED(drv);
+    SdFile* f = (SdFile*)file_p;
+    int64_t target = pos;
+    if (whence == LV_FS_SEEK_CUR) target += f->pos;
+    else if (whence == LV_FS_SEEK_END) target += f->size;
+    if (target < 0 || target > UINT32_MAX) return LV_FS_RES_INV_PARAM;
+    f->pos = (uint32_t)target;
+    return LV_FS_RES_OK;
+}
+
+lv_fs_res_t fs_tell(lv_fs_drv_t* drv, void* file_p, uint32_t* pos_p) {
+    LV_UNUSED(drv);
+    *pos_p = ((SdFile*)file_p)->pos;
+    return LV_FS_RES_OK;
+}
+
+void* fs_dir_open(lv_fs_drv_t* drv, const char* path) {
+    LV_UNUSED(drv);
+    if (!is_mounted) return nullptr;
+    char full[LV_FS_MAX_PATH_LENGTH];
+    full_path(path, full, sizeof(full));
+    return opendir(full);
+}
+
+/*Como nos drivers do LVGL: diretórios com '/' na frente e "" no fim da lista*/
+lv_fs_res_t fs_dir_read(lv_fs_drv_t* drv, void* dir_p, char* fn) {
+    LV_UNUSED(drv);
+    struct dirent* e;
+    do {
+        e = readdir((DIR*)dir_p);
+        if (!e) {
+            fn[0] = '\0';
+            return LV_FS_RES_OK;
+        }
+    } while (strcmp(e->d_name, ".") == 0 || strcmp(e->d_name, "..") == 0);
+    if (e->d_type == DT_DIR) lv_snprintf(fn, LV_FS_MAX_FN_LENGTH, "/%s", e->d_name);
+    else lv_snprintf(fn, LV_FS_MAX_FN_LENGTH, "%s", e->d_name);
+    return LV_FS_RES_OK;
+}
+
+lv_fs_res_t fs_dir_close(lv_fs_drv_t* drv, void* dir_p) {
+    LV_UNUSED(drv);
+    closedir((DIR*)dir_p);
+    return LV_FS_RES_OK;
+}
+
+} // namespace
+
+namespace SdCard {
+
+void begin() {
+    if (lock) return;
+    begin_ms = millis();
+    pool = (uint8_t*)ps_malloc((size_t)SD_CARD_BLOCK * SD_CARD_CACHE_BLOCKS);
+    if (!pool) {
+        pda_log(PDA_LOG_SYSTEM, PDA_LOG_ERROR, "SdCard: no PSRAM for the cache");
+        return;
+    }
+    lock = xSemaphoreCreateMutex();
+
+    lv_fs_drv_init(&fs_drv);
+    fs_drv.letter = SD_CARD_LETTER;
+    fs_drv.ready_cb = fs_ready;
+    fs_drv.open_cb = fs_open;
+    fs_drv.close_cb = fs_close;
+    fs_drv.read_cb = fs_read;
+    fs_drv.write_cb = fs_write;
+    fs_drv.seek_cb = fs_seek;
+    fs_drv.tell_cb = fs_tell;
+    fs_drv.dir_open_cb = fs_dir_open;
+    fs_drv.dir_read_cb = fs_dir_read;
+    fs_drv.dir_close_cb = fs_dir_close;
+    lv_fs_drv_register(&fs_drv);
+
+#if SD_CARD_ASYNC
+    xTaskCreatePinnedToCore(task_fn, "SdCard", TASK_STACK, NULL, TASK_PRIORITY, &task, TASK_CORE);
+#else
+    mount();
+#endif
+}
+
+bool mounted() {
+    return is_mounted;
+}
+
+Stats stats() {
+    if (!lock) return counters;
+    take();
+    Stats copy = counters;
+    give();
+    return copy;
+}
+
+} // namespace SdCard
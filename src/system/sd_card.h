@@ -0,0 +1,120 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+
+/**
+ * SdCard - Cartão SD para o LVGL e para os apps, sem travar a UI
+ *
+ * O cartão é montado no boot por uma tarefa no núcleo 0 (SdSpi: protocolo do
+ * cartão pelo SpiBus e FatFs), enquanto a UI já desenha. Depois disso:
+ *
+ * - Os arquivos aparecem em SD_CARD_MOUNT para open()/fopen() (VFS do IDF).
+ * - Um driver de arquivos do LVGL na letra 'S' serve imagens, fontes e dados:
+ *   lv_img_set_src(img, SD_PATH("photos/cat.bin")), lv_font_load(SD_PATH(...)).
+ *   Antes de montar (ou sem cartão) o open falha, como um arquivo que não existe.
+ *
+ * As leituras do driver passam por um cache de SD_CARD_CACHE_BLOCKS blocos de
+ * SD_CARD_BLOCK bytes na PSRAM, alinhados no arquivo:
+ *
+ * - Uma leitura que cai num bloco do cache é só um memcpy.
+ * - Uma falta lê o bloco inteiro do cartão (a UI espera só essa vez). Uma
+ *   leitura grande e alinhada, ou um salto de 1/4 de bloco ou mais, vai direto
+ *   para o destino, sem o cache: o acesso aleatório não lê bytes a mais.
+ * - Leitura sequencial: os SD_CARD_READAHEAD blocos seguintes são lidos
+ *   adiante pela tarefa, enquanto a UI usa o bloco atual. Se a UI chega num
+ *   bloco que ainda está sendo lido, espera só o resto dele.
+ * - Escrever num arquivo descarta os blocos dele no cache.
+ *
+ * Contadores de acertos, faltas, blocos lidos adiante (e os jogados fora sem
+ * uso), vazão do cartão e latência das leituras do LVGL vão para o app Monitor.
+ *
+ * Com SD_CARD_ASYNC 0 (o host) não há tarefa: a montagem acontece no begin() e
+ * a leitura adiante no fim do próprio lv_fs_read, pelo mesmo caminho. O
+ * "cartão" do host é o diretório SD_CARD_MOUNT.
+ *
+ * 🗂️ Exemplo de uso:
+ *
+ * DisplayTouch::init();      // lv_init() e SpiBus::begin() antes
+ * SdCard::begin();           // Volta na hora; o cartão monta em segundo plano
+ *
+ * lv_fs_file_t f;
+ * if (lv_fs_open(&f, SD_PATH("notes/todo.txt"), LV_FS_MODE_RD) == LV_FS_RES_OK) {
+ *     lv_fs_read(&f, buf, sizeof(buf), &n);
+ *     lv_fs_close(&f);
+ * }
+ */
+
+#ifndef SD_CARD_ASYNC
+#define SD_CARD_ASYNC 1
+#endif
+
+/*Onde o volume aparece no VFS*/
+#ifndef SD_CARD_MOUNT
+#define SD_CARD_MOUNT "/sd"
+#endif
+
+/*Arquivos abertos ao mesmo tempo no VFS (LVGL e apps)*/
+#ifndef SD_CARD_MAX_FILES
+#define SD_CARD_MAX_FILES 8
+#endif
+
+/*Bloco do cache (potência de 2, múltiplo do setor): a unidade de leitura no cartão*/
+#ifndef SD_CARD_BLOCK
+#define SD_CARD_BLOCK 8192
+#endif
+
+/*Blocos do cache na PSRAM, divididos entre os arquivos abertos (LRU)*/
+#ifndef SD_CARD_CACHE_BLOCKS
+#define SD_CARD_CACHE_BLOCKS 8
+#endif
+
+/*Blocos lidos adiante numa leitura sequencial*/
+#ifndef SD_CARD_READAHEAD
+#define SD_CARD_READAHEAD 2
+#endif
+
+/*Letra do driver do LVGL*/
+#define SD_CARD_LETTER 'S'
+/*Monta o caminho do LVGL para um arquivo do cartão*/
+#define SD_PATH(name) "S:" name
+
+namespace SdCard {
+
+struct Stats {
+    bool mounted;
+    uint32_t mount_ms;          // Do begin() ao fim da montagem
+    uint32_t card_mb;           // Tamanho do cartão (0 no host)
+    uint32_t reads;             // lv_fs_read
+    uint64_t bytes;             // Bytes entregues ao LVGL
+    uint64_t read_us;           // Tempo dentro dos lv_fs_read
+    uint32_t max_read_us;
+    uint32_t hits;              // Pedaços servidos do cache
+    uint32_t waits;             // Pedaços que esperaram um bloco sendo lido adiante
+    uint32_t misses;            // Leituras do cartão feitas pela própria UI
+    uint32_t prefetches;        // Blocos lidos adiante pela tarefa
+    uint32_t prefetch_unused;   // Lidos adiante e descartados sem uso
+    uint32_t io_reads;          // Leituras no cartão (faltas e adiante)
+    uint64_t io_bytes;
+    uint64_t io_us;             // Tempo delas: io_bytes / io_us é a vazão do cartão
+    uint32_t writes;
+    uint64_t write_bytes;
+    uint32_t errors;
+};
+
+/**
+ * @brief Reserva o cache, registra o driver do LVGL e começa a montagem fora
+ * da UI. Chame depois do DisplayTouch::init() (lv_init e SpiBus).
+ */
+void begin();
+
+/**
+ * @brief true depois que o cartão foi montado.
+ */
+bool mounted();
+
+/**
+ * @brief Retorna uma cópia dos contadores.
+ */
+Stats stats();
+
+} // namespace SdCard
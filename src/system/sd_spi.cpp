@@ -0,0 +1,329 @@
+#include "sd_spi.h"
+#include <string.h>
+#include <ff.h>
+#include <diskio.h>
+#include <diskio_impl.h>
+#include <esp_vfs_fat.h>
+#include "system/pda_log.h"
+#include "system/spi_bus.h"
+
+namespace {
+
+constexpr uint32_t SECTOR = 512;
+constexpr uint32_t INIT_TIMEOUT_MS = 1000;     // ACMD41 até o cartão sair do idle
+constexpr uint32_t READ_TIMEOUT_MS = 100;      // Até o token de dados
+constexpr uint32_t WRITE_TIMEOUT_MS = 500;     // Cartão ocupado gravando
+constexpr uint32_t POLL_BYTES = SPI_BUS_POLL_MAX; // Bytes por consulta do token ou do cartão ocupado
+
+constexpr uint8_t CMD0 = 0;     // GO_IDLE_STATE
+constexpr uint8_t CMD8 = 8;     // SEND_IF_COND
+constexpr uint8_t CMD9 = 9;     // SEND_CSD
+constexpr uint8_t CMD12 = 12;   // STOP_TRANSMISSION
+constexpr uint8_t CMD16 = 16;   // SET_BLOCKLEN
+constexpr uint8_t CMD17 = 17;   // READ_SINGLE_BLOCK
+constexpr uint8_t CMD18 = 18;   // READ_MULTIPLE_BLOCK
+constexpr uint8_t CMD24 = 24;   // WRITE_BLOCK
+constexpr uint8_t CMD55 = 55;   // APP_CMD
+constexpr uint8_t CMD58 = 58;   // READ_OCR
+constexpr uint8_t ACMD41 = 41;  // SD_SEND_OP_COND
+
+constexpr uint8_t R1_IDLE = 0x01;
+constexpr uint8_t R1_ILLEGAL = 0x04;
+constexpr uint8_t TOKEN_DATA = 0xFE;
+
+bool ready = false;
+bool high_capacity = false;     // SDHC/SDXC: endereço em setores, não em bytes
+uint32_t sector_count = 0;
+
+void xfer(const void* tx, void* rx, uint32_t len) {
+    SpiBus::transfer(SPI_BUS_SD, tx, rx, len, SPI_BUS_CHAIN);
+}
+
+/*Fim da corrente: um byte a mais de clock e o CS sobe*/
+void end() {
+    SpiBus::transfer(SPI_BUS_SD, nullptr, nullptr, 1, 0);
+}
+
+uint8_t read_byte() {
+    uint8_t b;
+    xfer(nullptr, &b, 1);
+    return b;
+}
+
+/**
+ * @brief Manda o comando e lê a resposta R1 e mais `extra` bytes (R3/R7).
+ * Deixa a corrente aberta. Retorna 0xFF se o cartão não respondeu.
+ */
+uint8_t command(uint8_t cmd, uint32_t arg, uint8_t* extra = nullptr, uint8_t extra_len = 0) {
+    // Um byte de folga antes, o comando e até 8 bytes de espera pela resposta (Ncr)
+    uint8_t tx[16], rx[16];
+    memset(tx, 0xFF, sizeof(tx));
+    tx[1] = 0x40 | cmd;
+    tx[2] = arg >> 24;
+    tx[3] = arg >> 16;
+    tx[4] = arg >> 8;
+    tx[5] = arg;
+    // Só o CMD0 e o CMD8 precisam do CRC certo: depois o cartão não confere
+    tx[6] = cmd == CMD0 ? 0x95 : cmd == CMD8 ? 0x87 : 0x01;
+    xfer(tx, rx, sizeof(tx));
+    if (cmd == CMD12) rx[7] = 0xFF; // Byte de enchimento depois do STOP_TRANSMISSION
+
+    uint8_t i = 7;
+    while (i < sizeof(rx) && (rx[i] & 0x80)) i++;
+    if (i == sizeof(rx)) return 0xFF;
+    uint8_t r1 = rx[i++];
+    for (uint8_t n = 0; n < extra_len; n++) extra[n] = i < sizeof(rx) ? rx[i++] : read_byte();
+    return r1;
+}
+
+uint8_t app_command(uint8_t cmd, uint32_t arg) {
+    command(CMD55, 0);
+    return command(cmd, arg);
+}
+
+/**
+ * @brief Espera o cartão sair de ocupado (gravando, depois do CMD12). Ele pode
+ * ficar ocupado com o CS alto, então cada consulta é uma transferência solta:
+ * chame depois do end(), e o display e o rádio passam entre as consultas.
+ */
+bool wait_not_busy(uint32_t timeout_ms) {
+    uint8_t rx[POLL_BYTES];
+    uint32_t start = millis();
+    do {
+        SpiBus::transfer(SPI_BUS_SD, nullptr, rx, sizeof(rx), 0);
+        if (rx[sizeof(rx) - 1] == 0xFF) return true;
+    } while (millis() - start < timeout_ms);
+    return false;
+}
+
+/**
+ * @brief Um bloco de dados: espera o token e lê os bytes e o CRC (descartado).
+ * O token é procurado POLL_BYTES por vez; o que chegou depois dele na mesma
+ * consulta já é o começo do bloco.
+ */
+bool read_data(uint8_t* buf, uint32_t len) {
+    uint8_t rx[POLL_BYTES];
+    uint32_t i;
+    uint32_t start = millis();
+    for (;;) {
+        xfer(nullptr, rx, sizeof(rx));
+        for (i = 0; i < sizeof(rx) && rx[i] == 0xFF; i++) {}
+        if (i < sizeof(rx)) break;
+        if (millis() - start >= READ_TIMEOUT_MS) return false;
+    }
+    if (rx[i++] != TOKEN_DATA) return false;    // Token de erro
+
+    uint32_t got = sizeof(rx) - i;
+    uint32_t data = got < len ? got : len;
+    memcpy(buf, rx + i, data);
+    if (data < len) xfer(nullptr, buf + data, len - data);
+    uint32_t crc = got - data;
+    if (crc < 2) xfer(nullptr, nullptr, 2 - crc);
+    return true;
+}
+
+uint32_t csd_sectors(const uint8_t* csd) {
+    if ((csd[0] >> 6) == 1) {
+        // CSD 2.0 (SDHC/SDXC): (C_SIZE + 1) * 512 KB
+        uint32_t c_size = ((uint32_t)(csd[7] & 0x3F) << 16) | ((uint32_t)csd[8] << 8) | csd[9];
+        return (c_size + 1) * 1024;
+    }
+    uint32_t read_bl_len = csd[5] & 0x0F;
+    uint32_t c_size = ((uint32_t)(csd[6] & 0x03) << 10) | ((uint32_t)csd[7] << 2) | (csd[8] >> 6);
+    uint32_t c_size_mult = ((csd[9] & 0x03) << 1) | (csd[10] >> 7);
+    return (c_size + 1) << (c_size_mult + 2 + read_bl_len - 9);
+}
+
+bool card_init() {
+    ready = false;
+    SpiBus::set_clock(SPI_BUS_SD, SPI_BUS_SD_HZ);
+    SpiBus::transfer(SPI_BUS_SD, nullptr, nullptr, 10, 0);
+
+    uint8_t r1 = 0xFF;
+    for (uint8_t i = 0; i < 10 && r1 != R1_IDLE; i++) r1 = command(CMD0, 0);
+    if (r1 != R1_IDLE) {
+        end();
+        return false;
+    }
+
+    uint8_t r7[4];
+    bool v2 = false;
+    r1 = command(CMD8, 0x1AA, r7, sizeof(r7));
+    if (r1 == R1_IDLE) {
+        if ((r7[2] & 0x0F) != 0x01 || r7[3] != 0xAA) {
+            end();
+            return false;
+        }
+        v2 = true;
+    } else if (!(r1 & R1_ILLEGAL)) {
+        end();
+        return false;
+    }
+
+    uint32_t start = millis();
+    do {
+        r1 = app_command(ACMD41, v2 ? 0x40000000 : 0);
+        if (r1 == 0) break;
+        end();
+        delay(10);
+    } while (millis() - start < INIT_TIMEOUT_MS);
+    if (r1 != 0) {
+        end();
+        return false;
+    }
+
+    high_capacity = false;
+    if (v2) {
+        uint8_t ocr[4];
+        if (command(CMD58, 0, ocr, sizeof(ocr)) != 0) {
+            end();
+            return false;
+        }
+        high_capacity = ocr[0] & 0x40;
+    }
+    if (!high_capacity && command(CMD16, SECTOR) != 0) {
+        end();
+        return false;
+    }
+
+    uint8_t csd[16];
+    if (command(CMD9, 0) != 0 || !read_data(csd, sizeof(csd))) {
+        end();
+        return false;
+    }
+    end();
+    sector_count = csd_sectors(csd);
+    SpiBus::set_clock(SPI_BUS_SD, SD_SPI_HZ);
+    ready = true;
+    return true;
+}
+
+uint32_t address(uint32_t sector) {
+    return high_capacity ? sector : sector * SECTOR;
+}
+
+bool read_sectors(uint8_t* buf, uint32_t sector, uint32_t count) {
+    while (count) {
+        uint32_t n = 0;
+        bool ok;
+        if (count == 1 || SpiBus::contended(SPI_BUS_SD)) {
+            // Com o display ou o rádio na fila, um setor por corrente
+            ok = command(CMD17, address(sector)) == 0 && read_data(buf, SECTOR);
+            end();
+            n = 1;
+        } else {
+            uint32_t burst = count < SD_SPI_BURST ? count : SD_SPI_BURST;
+            ok = command(CMD18, address(sector)) == 0;
+            while (ok && n < burst) {
+                ok = read_data(buf + n * SECTOR, SECTOR);
+                n++;
+                // A rajada para no setor atual quando alguém espera o barramento
+                if (SpiBus::contended(SPI_BUS_SD)) break;
+            }
+            command(CMD12, 0);
+            end();
+            wait_not_busy(READ_TIMEOUT_MS);
+        }
+        if (!ok) return false;
+        buf += n * SECTOR;
+        sector += n;
+        count -= n;
+    }
+    return true;
+}
+
+bool write_sectors(const uint8_t* buf, uint32_t sector, uint32_t count) {
+    static const uint8_t start_token[2] = {0xFF, TOKEN_DATA};
+    static const uint8_t crc[2] = {0xFF, 0xFF};
+    for (uint32_t i = 0; i < count; i++) {
+        bool ok = command(CMD24, address(sector + i)) == 0;
+        if (ok) {
+            xfer(start_token, nullptr, sizeof(start_token));
+            xfer(buf + i * SECTOR, nullptr, SECTOR);
+            xfer(crc, nullptr, sizeof(crc));
+            ok = (read_byte() & 0x1F) == 0x05;
+        }
+        end();
+        // O cartão grava com o CS alto: a espera não segura o barramento
+        if (!ok || !wait_not_busy(WRITE_TIMEOUT_MS)) return false;
+    }
+    return true;
+}
+
+// --- Disco do FatFs ---
+
+DSTATUS sd_disk_status(uint8_t pdrv) {
+    (void)pdrv;
+    return ready ? 0 : STA_NOINIT;
+}
+
+DSTATUS sd_disk_init(uint8_t pdrv) {
+    return sd_disk_status(pdrv);
+}
+
+DRESULT sd_disk_read(uint8_t pdrv, uint8_t* buf, DWORD sector, UINT count) {
+    (void)pdrv;
+    if (!ready) return RES_NOTRDY;
+    return read_sectors(buf, sector, count) ? RES_OK : RES_ERROR;
+}
+
+DRESULT sd_disk_write(uint8_t pdrv, const uint8_t* buf, DWORD sector, UINT count) {
+    (void)pdrv;
+    if (!ready) return RES_NOTRDY;
+    return write_sectors(buf, sector, count) ? RES_OK : RES_ERROR;
+}
+
+DRESULT sd_disk_ioctl(uint8_t pdrv, uint8_t cmd, void* buf) {
+    (void)pdrv;
+    switch (cmd) {
+    case CTRL_SYNC:
+        return RES_OK;      // Cada escrita só volta depois do cartão gravar
+    case GET_SECTOR_COUNT:
+        *(DWORD*)buf = sector_count;
+        return RES_OK;
+    case GET_SECTOR_SIZE:
+        *(WORD*)buf = SECTOR;
+        return RES_OK;
+    case GET_BLOCK_SIZE:
+        *(DWORD*)buf = 1;   // Bloco de apagamento desconhecido
+        return RES_OK;
+    }
+    return RES_PARERR;
+}
+
+const ff_diskio_impl_t disk = {sd_disk_init, sd_disk_status, sd_disk_read, sd_disk_write, sd_disk_ioctl};
+
+} // namespace
+
+namespace SdSpi {
+
+bool mount(const char* base_path, uint8_t max_files) {
+    if (!card_init()) {
+        pda_log(PDA_LOG_SYSTEM, PDA_LOG_WARN, "SdSpi: no card");
+        return false;
+    }
+
+    BYTE pdrv = 0xFF;
+    if (ff_diskio_get_drive(&pdrv) != ESP_OK || pdrv == 0xFF) return false;
+    ff_diskio_register(pdrv, &disk);
+    char drive[3] = {(char)('0' + pdrv), ':', 0};
+    FATFS* fs = nullptr;
+    if (esp_vfs_fat_register(base_path, drive, max_files, &fs) != ESP_OK) {
+        ff_diskio_register(pdrv, nullptr);
+        return false;
+    }
+    FRESULT res = f_mount(fs, drive, 1);
+    if (res != FR_OK) {
+        pda_log(PDA_LOG_SYSTEM, PDA_LOG_WARN, "SdSpi: no FAT volume (%d)", (int)res);
+        esp_vfs_fat_unregister_path(base_path);
+        ff_diskio_register(pdrv, nullptr);
+        return false;
+    }
+    return true;
+}
+
+uint32_t sectors() {
+    return ready ? sector_count : 0;
+}
+
+} // namespace SdSpi
@@ -0,0 +1,62 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * SdSpi - Cartão SD no modo SPI, pelo SpiBus, montado com o FatFs do IDF
+ *
+ * O cartão divide o barramento com o display e o rádio, então não dá para
+ * usar o SD do Arduino nem o sdspi do IDF (os dois querem o SPI só para si).
+ * Este driver fala o protocolo do cartão pelo SpiBus (SPI_BUS_SD) e se liga
+ * ao FatFs como um disco (ff_diskio_register); o VFS do IDF expõe o volume em
+ * `base_path`, com open()/read()/fopen() normais.
+ *
+ * - Inicialização a SPI_BUS_SD_HZ (400 kHz): CMD0, CMD8, ACMD41 e CMD58 para
+ *   SDSC/SDHC/SDXC, CMD9 para o tamanho; depois o clock sobe para SD_SPI_HZ.
+ * - Cada comando é uma corrente do SpiBus (SPI_BUS_CHAIN): comando, resposta e
+ *   dados com o CS baixo do começo ao fim. Leituras de vários setores vão em
+ *   rajadas de até SD_SPI_BURST setores (CMD18 + CMD12) enquanto ninguém mais
+ *   espera o barramento. Com o display ou o rádio na fila (SpiBus::contended)
+ *   a rajada para no setor atual e a leitura segue um setor por corrente
+ *   (CMD17): o quadro espera no máximo um setor.
+ * - O token de dados e o fim do cartão ocupado são consultados em pedaços de
+ *   SPI_BUS_POLL_MAX bytes, não byte a byte. A espera do ocupado (gravação,
+ *   CMD12) é feita com o CS alto, fora da corrente.
+ * - O SpiBus controla o CS pelo hardware, então os 80 clocks do começo vão com
+ *   o CS baixo e o CMD0 é repetido até o cartão responder.
+ *
+ * Bloqueia quem chama (é síncrono): chame de uma tarefa que possa esperar o
+ * cartão, não da UI. Quem monta é o SdCard (system/sd_card.h).
+ *
+ * 💾 Exemplo de uso:
+ *
+ * if (SdSpi::mount("/sd", 8)) {
+ *     FILE* f = fopen("/sd/notes.txt", "r");
+ *     ...
+ * }
+ */
+
+/*Clock do cartão depois da inicialização*/
+#ifndef SD_SPI_HZ
+#define SD_SPI_HZ 20000000
+#endif
+
+/*Setores por rajada de CMD18, quando ninguém mais espera o barramento*/
+#ifndef SD_SPI_BURST
+#define SD_SPI_BURST 8
+#endif
+
+namespace SdSpi {
+
+/**
+ * @brief Inicializa o cartão e monta o primeiro volume FAT em `base_path`.
+ * Não formata: um cartão sem FAT só não é montado.
+ * @return false sem cartão, com um cartão que não respondeu ou sem FAT.
+ */
+bool mount(const char* base_path, uint8_t max_files);
+
+/**
+ * @brief Setores de 512 bytes do cartão montado (0 sem cartão).
+ */
+uint32_t sectors();
+
+} // namespace SdSpi
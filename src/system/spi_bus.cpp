@@ -0,0 +1,413 @@
+#include "spi_bus.h"
+#include <SPI.h>
+#include <driver/spi_master.h>
+#include <esp_heap_caps.h>
+#include <string.h>
+#include "hardware/TDECK_PINS.h"
+#include "system/pda_log.h"
+
+#if defined(ESP_PLATFORM)
+#if __has_include(<esp_memory_utils.h>)
+#include <esp_memory_utils.h>
+#else
+#include <soc/soc_memory_layout.h>
+#endif
+#endif
+
+namespace {
+
+constexpr uint32_t TASK_STACK = 3072;
+constexpr UBaseType_t TASK_PRIORITY = 20;  // Abaixo do Wi-Fi (23), acima de tudo do PDA
+constexpr BaseType_t TASK_CORE = 0;
+constexpr uint8_t SET_CLOCK = 0x80;        // Transferência de controle: o clock vai em len
+constexpr uint8_t RELEASE = 0x40;          // Transferência de controle: tira o dispositivo do barramento
+
+struct Device {
+    const char* name;
+    int cs;
+    bool has_dc;
+    uint32_t hz;
+    spi_device_handle_t handle;
+    SpiBus::Transfer* head;     // Fila FIFO; head é a transferência em andamento
+    SpiBus::Transfer* tail;
+    SpiBus::DeviceStats stats;
+};
+
+Device devices[SPI_BUS_DEVICES] = {
+    {"radio", TDECK_RADIO_CS, false, SPI_BUS_RADIO_HZ, nullptr, nullptr, nullptr, {}},
+    {"tft", TDECK_TFT_CS, true, SPI_BUS_TFT_HZ, nullptr, nullptr, nullptr, {}},
+    {"sd", TDECK_SDCARD_CS, false, SPI_BUS_SD_HZ, nullptr, nullptr, nullptr, {}},
+};
+
+portMUX_TYPE queue_mux = portMUX_INITIALIZER_UNLOCKED;
+bool started = false;
+int8_t chained = -1;            // Dispositivo segurando o barramento (SPI_BUS_CHAIN)
+
+// Buffers de rebote na SRAM interna. `prepared` guarda o próximo pedaço de
+// uma transferência, copiado enquanto o anterior estava no fio.
+uint8_t* bounce[2] = {nullptr, nullptr};
+struct Prepared {
+    SpiBus::Transfer* t;
+    uint32_t offset;
+    uint8_t buf;
+} prepared = {nullptr, 0, 0};
+
+#if SPI_BUS_ASYNC
+TaskHandle_t bus_task = nullptr;
+#else
+bool servicing = false;
+#endif
+
+bool dma_capable(const void* p) {
+#if defined(ESP_PLATFORM)
+    return esp_ptr_dma_capable(p);
+#else
+    (void)p;
+    return false; // No host tudo passa pelo rebote, para exercitar esse caminho
+#endif
+}
+
+// Roda antes de cada transação do display, na interrupção do spi_master
+void IRAM_ATTR tft_pre_cb(spi_transaction_t* tr) {
+    digitalWrite(TDECK_TFT_DC, (uint8_t)(uintptr_t)tr->user);
+}
+
+bool add_device(Device& d) {
+    spi_device_interface_config_t cfg = {};
+    cfg.mode = 0;
+    cfg.clock_speed_hz = (int)d.hz;
+    cfg.spics_io_num = d.cs;
+    cfg.queue_size = 2;                 // O pedaço no fio e o próximo
+    cfg.pre_cb = d.has_dc ? tft_pre_cb : nullptr;
+    d.stats.clock_hz = d.hz;
+    return spi_bus_add_device(SPI2_HOST, &cfg, &d.handle) == ESP_OK;
+}
+
+/**
+ * @brief Dispositivo a atender agora: o da corrente em andamento ou o de maior
+ * prioridade com algo na fila. -1 se não há o que fazer.
+ */
+int8_t pick() {
+    int8_t d = -1;
+    portENTER_CRITICAL(&queue_mux);
+    if (chained >= 0) {
+        if (devices[chained].head) d = chained;
+    } else {
+        for (uint8_t i = 0; i < SPI_BUS_DEVICES && d < 0; i++) {
+            if (devices[i].head) d = (int8_t)i;
+        }
+    }
+    portEXIT_CRITICAL(&queue_mux);
+    return d;
+}
+
+/**
+ * @brief Buffer de rebote livre: o que não guarda um pedaço preparado.
+ */
+uint8_t free_buffer() {
+    return prepared.t ? (uint8_t)(prepared.buf ^ 1) : 0;
+}
+
+void prepare(SpiBus::Transfer* t, uint32_t offset, uint8_t buf) {
+    uint32_t n = t->len - offset;
+    if (n > SPI_BUS_CHUNK) n = SPI_BUS_CHUNK;
+    memcpy(bounce[buf], (const uint8_t*)t->tx + offset, n);
+    prepared = Prepared{t, offset, buf};
+}
+
+void finish(uint8_t dev, SpiBus::Transfer* t) {
+    Device& d = devices[dev];
+    portENTER_CRITICAL(&queue_mux);
+    d.head = t->next;
+    if (!d.head) d.tail = nullptr;
+    d.stats.transfers++;
+    portEXIT_CRITICAL(&queue_mux);
+
+    if (chained == (int8_t)dev && !(t->flags & SPI_BUS_CHAIN)) {
+        spi_device_release_bus(d.handle);
+        chained = -1;
+    }
+    if (t->on_done) t->on_done(t);
+}
+
+/**
+ * @brief Manda o próximo pedaço da transferência em andamento de `dev`.
+ */
+void run_chunk(uint8_t dev) {
+    Device& d = devices[dev];
+    SpiBus::Transfer* t = d.head;
+
+    if (!d.handle) {
+        // Dispositivo perdido numa troca de clock: nada vai para o fio, a leitura volta 0xFF
+        if (t->rx && !(t->flags & (SET_CLOCK | RELEASE))) memset(t->rx, 0xFF, t->len);
+        finish(dev, t);
+        return;
+    }
+    if (t->flags & SET_CLOCK) {
+        uint32_t old_hz = d.hz;
+        spi_bus_remove_device(d.handle);
+        d.handle = nullptr;
+        d.hz = t->len;
+        if (!add_device(d)) {
+            pda_log(PDA_LOG_SYSTEM, PDA_LOG_ERROR, "SpiBus: can't set %s to %lu Hz", d.name, (unsigned long)d.hz);
+            // Volta ao clock anterior; sem isso o dispositivo sai do barramento
+            d.hz = old_hz;
+            if (!add_device(d)) {
+                d.handle = nullptr;
+                pda_log(PDA_LOG_SYSTEM, PDA_LOG_ERROR, "SpiBus: lost %s", d.name);
+            }
+        }
+        finish(dev, t);
+        return;
+    }
+    if (t->flags & RELEASE) {
+        spi_bus_remove_device(d.handle);
+        d.handle = nullptr;
+        finish(dev, t);
+        return;
+    }
+
+    uint32_t now = micros();
+    if (t->sent == 0) {
+        uint32_t wait = now - t->queued_us;
+        portENTER_CRITICAL(&queue_mux);
+        if (wait > d.stats.max_wait_us) d.stats.max_wait_us = wait;
+        portEXIT_CRITICAL(&queue_mux);
+        if ((t->flags & SPI_BUS_CHAIN) && chained < 0) {
+            spi_device_acquire_bus(d.handle, portMAX_DELAY);
+            chained = (int8_t)dev;
+        }
+    }
+
+    uint32_t offset = t->sent;
+    uint32_t n = t->len - offset;
+    if (n > SPI_BUS_CHUNK) n = SPI_BUS_CHUNK;
+    const uint8_t* tx = t->tx ? (const uint8_t*)t->tx + offset : nullptr;
+    uint8_t* rx = t->rx ? (uint8_t*)t->rx + offset : nullptr;
+
+    spi_transaction_t tr = {};
+    tr.length = n * 8;
+    tr.user = (void*)(uintptr_t)((t->flags & SPI_BUS_CMD) ? LOW : HIGH);
+    // Numa corrente o CS só sobe no fim da última transferência
+    if (chained == (int8_t)dev && ((t->flags & SPI_BUS_CHAIN) || offset + n < t->len)) {
+        tr.flags |= SPI_TRANS_CS_KEEP_ACTIVE;
+    }
+
+    // Origem e destino: direto quando o DMA alcança, senão por um rebote.
+    // Sem tx o cartão precisa ver 0xFF no MOSI: o rebote (ou o próprio rx)
+    // é preenchido e serve de tx e rx ao mesmo tempo, como no sdspi do IDF.
+    uint8_t* buf = nullptr;
+    bool direct_rx = rx && dma_capable(rx) && ((uintptr_t)rx & 3) == 0 && (n & 3) == 0;
+    if (prepared.t == t && prepared.offset == offset) {
+        buf = bounce[prepared.buf];
+        prepared.t = nullptr;
+    } else if (tx && !rx && dma_capable(tx) && n > SPI_BUS_POLL_MAX) {
+        tr.tx_buffer = tx;
+    } else if (!tx && direct_rx) {
+        memset(rx, 0xFF, n);
+        tr.tx_buffer = rx;
+        tr.rx_buffer = rx;
+    } else {
+        buf = bounce[free_buffer()];
+        if (tx) memcpy(buf, tx, n);
+        else memset(buf, 0xFF, n);
+    }
+    if (buf) {
+        tr.tx_buffer = buf;
+        if (rx) tr.rx_buffer = buf;
+    }
+
+    if (n <= SPI_BUS_POLL_MAX) {
+        spi_device_polling_transmit(d.handle, &tr);
+    } else {
+        spi_device_queue_trans(d.handle, &tr, portMAX_DELAY);
+        // Enquanto este pedaço está no fio, copia o próximo da mesma transferência
+        uint32_t next = offset + n;
+        if (tx && !rx && next < t->len && !prepared.t && !dma_capable(tx)) {
+            prepare(t, next, (uint8_t)(buf == bounce[0]));
+        }
+        spi_transaction_t* result;
+        spi_device_get_trans_result(d.handle, &result, portMAX_DELAY);
+    }
+    if (rx && buf) memcpy(rx, buf, n);
+
+    uint32_t busy = micros() - now;
+    portENTER_CRITICAL(&queue_mux);
+    d.stats.busy_us += busy;
+    d.stats.bytes += n;
+    d.stats.chunks++;
+    portEXIT_CRITICAL(&queue_mux);
+    t->sent += n;
+    if (t->sent >= t->len) finish(dev, t);
+}
+
+/**
+ * @brief Atende as filas até esvaziarem, reavaliando a prioridade a cada pedaço.
+ */
+void service() {
+    for (int8_t dev = pick(); dev >= 0; dev = pick()) run_chunk((uint8_t)dev);
+}
+
+#if SPI_BUS_ASYNC
+void bus_task_fn(void*) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        service();
+    }
+}
+
+struct Waiter {
+    TaskHandle_t task;
+    volatile bool done;
+};
+
+void wake_waiter(SpiBus::Transfer* t) {
+    Waiter* w = (Waiter*)t->user;
+    TaskHandle_t task = w->task;
+    w->done = true;
+    xTaskNotifyGive(task);
+}
+#endif
+
+void enqueue(SpiBusDevice dev, SpiBus::Transfer* t) {
+    t->next = nullptr;
+    t->sent = 0;
+    t->queued_us = micros();
+    Device& d = devices[dev];
+    portENTER_CRITICAL(&queue_mux);
+    if (d.tail) d.tail->next = t;
+    else d.head = t;
+    d.tail = t;
+    portEXIT_CRITICAL(&queue_mux);
+
+#if SPI_BUS_ASYNC
+    xTaskNotifyGive(bus_task);
+#else
+    // Host: atende na hora; uma submissão feita de dentro de um on_done entra na fila da volta atual
+    if (servicing) return;
+    servicing = true;
+    service();
+    servicing = false;
+#endif
+}
+
+/**
+ * @brief Desfaz um begin() que falhou no meio: solta os dispositivos, os
+ * buffers de rebote e o barramento, e devolve o SPI ao Arduino.
+ */
+void abort_begin() {
+    for (uint8_t i = 0; i < 2; i++) {
+        heap_caps_free(bounce[i]);
+        bounce[i] = nullptr;
+    }
+    for (Device& d : devices) {
+        if (!d.handle) continue;
+        spi_bus_remove_device(d.handle);
+        d.handle = nullptr;
+    }
+    spi_bus_free(SPI2_HOST);
+    SPI.begin(TDECK_SPI_SCK, TDECK_SPI_MISO, TDECK_SPI_MOSI);
+}
+
+} // namespace
+
+namespace SpiBus {
+
+bool begin() {
+    if (started) return true;
+    SPI.end(); // O TFT_eSPI já configurou o display; daqui em diante o barramento é do spi_master
+
+    spi_bus_config_t bus = {};
+    bus.mosi_io_num = TDECK_SPI_MOSI;
+    bus.miso_io_num = TDECK_SPI_MISO;
+    bus.sclk_io_num = TDECK_SPI_SCK;
+    bus.quadwp_io_num = -1;
+    bus.quadhd_io_num = -1;
+    bus.max_transfer_sz = SPI_BUS_CHUNK;
+    if (spi_bus_initialize(SPI2_HOST, &bus, SPI_DMA_CH_AUTO) != ESP_OK) {
+        pda_log(PDA_LOG_SYSTEM, PDA_LOG_ERROR, "SpiBus: spi_bus_initialize failed");
+        SPI.begin(TDECK_SPI_SCK, TDECK_SPI_MISO, TDECK_SPI_MOSI);
+        return false;
+    }
+    for (Device& d : devices) {
+        if (!add_device(d)) {
+            pda_log(PDA_LOG_SYSTEM, PDA_LOG_ERROR, "SpiBus: can't add %s", d.name);
+            abort_begin();
+            return false;
+        }
+    }
+    for (uint8_t i = 0; i < 2; i++) {
+        bounce[i] = (uint8_t*)heap_caps_malloc(SPI_BUS_CHUNK, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        if (!bounce[i]) {
+            pda_log(PDA_LOG_SYSTEM, PDA_LOG_ERROR, "SpiBus: no internal RAM for the bounce buffers");
+            abort_begin();
+            return false;
+        }
+    }
+
+#if SPI_BUS_ASYNC
+    BaseType_t created =
+        xTaskCreatePinnedToCore(bus_task_fn, "SpiBus", TASK_STACK, NULL, TASK_PRIORITY, &bus_task, TASK_CORE);
+    if (created != pdPASS) {
+        pda_log(PDA_LOG_SYSTEM, PDA_LOG_ERROR, "SpiBus: can't create the task");
+        abort_begin();
+        return false;
+    }
+#endif
+    started = true;
+    return true;
+}
+
+bool submit(SpiBusDevice dev, Transfer* t) {
+    if (!started || dev >= SPI_BUS_DEVICES || !devices[dev].handle) return false;
+    enqueue(dev, t);
+    return true;
+}
+
+void transfer(SpiBusDevice dev, const void* tx, void* rx, uint32_t len, uint8_t flags) {
+    if (!started || dev >= SPI_BUS_DEVICES || !devices[dev].handle) return;
+#if SPI_BUS_ASYNC
+    // done protege contra uma notificação antiga pendente na tarefa: `t` vive na pilha
+    Waiter w = {xTaskGetCurrentTaskHandle(), false};
+    Transfer t = {tx, rx, len, flags, wake_waiter, &w};
+    enqueue(dev, &t);
+    while (!w.done) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+#else
+    Transfer t = {tx, rx, len, flags, nullptr, nullptr};
+    enqueue(dev, &t);
+#endif
+}
+
+void set_clock(SpiBusDevice dev, uint32_t hz) {
+    if (!started || dev >= SPI_BUS_DEVICES || !devices[dev].handle) return;
+    // Só a tarefa do árbitro mexe nos dispositivos: a troca vai pela fila
+    transfer(dev, nullptr, nullptr, hz, SET_CLOCK);
+}
+
+void release(SpiBusDevice dev) {
+    if (!started || dev >= SPI_BUS_DEVICES || !devices[dev].handle) return;
+    transfer(dev, nullptr, nullptr, 0, RELEASE);
+}
+
+bool contended(SpiBusDevice dev) {
+    bool waiting = false;
+    portENTER_CRITICAL(&queue_mux);
+    for (uint8_t i = 0; i < dev && i < SPI_BUS_DEVICES; i++) waiting |= devices[i].head != nullptr;
+    portEXIT_CRITICAL(&queue_mux);
+    return waiting;
+}
+
+DeviceStats stats(SpiBusDevice dev) {
+    DeviceStats s = {};
+    if (dev >= SPI_BUS_DEVICES) return s;
+    portENTER_CRITICAL(&queue_mux);
+    s = devices[dev].stats;
+    portEXIT_CRITICAL(&queue_mux);
+    return s;
+}
+
+const char* device_name(SpiBusDevice dev) {
+    return dev < SPI_BUS_DEVICES ? devices[dev].name : "?";
+}
+
+} // namespace SpiBus
@@ -0,0 +1,166 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * SpiBus - Árbitro do barramento SPI compartilhado do T-Deck
+ *
+ * O ST7789 (TDECK_TFT_CS), o cartão SD (TDECK_SDCARD_CS) e o SX1262
+ * (TDECK_RADIO_CS) ficam no mesmo SPI (TDECK_SPI_SCK/MOSI/MISO). Depois do
+ * begin() o barramento é só do árbitro: cada dispositivo tem a sua fila de
+ * transferências e o seu clock, e uma tarefa no núcleo 0 escolhe o que vai
+ * para o fio, sempre pela prioridade do dispositivo:
+ *
+ * 1. Rádio: transações curtas (comandos, leitura do IRQ do SX1262) com prazo;
+ *    passam na frente de tudo e custam microssegundos.
+ * 2. Display: o flush do quadro, para a latência da UI.
+ * 3. SD: leituras e escritas grandes, com o barramento que sobrar.
+ *
+ * Uma transferência grande vai em pedaços de até SPI_BUS_CHUNK bytes por DMA e
+ * a prioridade é reavaliada entre um pedaço e outro: um flush espera no máximo
+ * um pedaço de SD, nunca a leitura inteira, e um bloco do SD nunca entra no
+ * meio de um quadro (o display tem prioridade sobre ele). O rádio pode entrar
+ * entre dois pedaços do quadro; o ST7789 continua o RAMWR de onde parou.
+ *
+ * - DMA: buffers fora da SRAM interna (o buffer do LVGL fica na PSRAM) passam
+ *   por dois buffers de rebote internos; a cópia do próximo pedaço é feita
+ *   enquanto o anterior está no fio. Transações até SPI_BUS_POLL_MAX bytes vão
+ *   por polling, sem o custo da interrupção.
+ * - Clock por dispositivo (o spi_master troca na mudança de dispositivo);
+ *   set_clock() muda o de um deles (ex: o SD sobe de 400 kHz para 20 MHz
+ *   depois da inicialização).
+ * - SPI_BUS_CMD deixa o DC do display em nível baixo (byte de comando).
+ * - SPI_BUS_CHAIN segura o barramento e o CS para a próxima transferência do
+ *   mesmo dispositivo (comando + resposta + bloco de um SD). Use em sequências
+ *   curtas: enquanto a corrente durar, nem o display passa. contended() diz
+ *   quando alguém mais prioritário está esperando, para cortar a corrente.
+ * - Pior caso de uma corrente do SdSpi: um setor lido. São o comando, a espera
+ *   do token de dados e 514 bytes (~0,2 ms a 20 MHz). A espera costuma ficar
+ *   abaixo de 1 ms, mas o cartão pode levar até o limite de leitura do SD
+ *   (100 ms, o READ_TIMEOUT_MS do sd_spi.cpp). O cartão ocupado gravando
+ *   (até 500 ms) é esperado sem a corrente, com o CS alto entre as consultas.
+ * - Ocupação: tempo no fio, bytes, transferências e a maior espera na fila de
+ *   cada dispositivo, para o app Monitor.
+ *
+ * As callbacks de fim (on_done) rodam na tarefa do árbitro: devem ser curtas e
+ * podem submeter outra transferência, mas não chamar transfer().
+ *
+ * Com SPI_BUS_ASYNC 0 (o host, sem tarefas de verdade) submit() executa a fila
+ * na própria chamada, pelo mesmo caminho.
+ *
+ * 🚌 Exemplo de uso:
+ *
+ * DisplayTouch::init();   // Configura o ST7789 e chama SpiBus::begin()
+ *
+ * // Assíncrono: o buffer precisa viver até o on_done
+ * static SpiBus::Transfer t;
+ * t = SpiBus::Transfer{pixels, nullptr, len, 0, flush_done};
+ * SpiBus::submit(SPI_BUS_TFT, &t);
+ *
+ * // Síncrono: volta depois da transferência (só fora da tarefa do árbitro)
+ * uint8_t cmd[2] = {0x12, 0x00}, rsp[2];      // GetIrqStatus do SX1262
+ * SpiBus::transfer(SPI_BUS_RADIO, cmd, rsp, sizeof(cmd));
+ */
+
+#ifndef SPI_BUS_ASYNC
+#define SPI_BUS_ASYNC 1
+#endif
+
+/*Maior pedaço de uma transferência e tamanho de cada buffer de rebote (SRAM interna)*/
+#ifndef SPI_BUS_CHUNK
+#define SPI_BUS_CHUNK 8192
+#endif
+
+/*Transações até este tamanho vão por polling*/
+#ifndef SPI_BUS_POLL_MAX
+#define SPI_BUS_POLL_MAX 32
+#endif
+
+/*Clock de cada dispositivo*/
+#ifndef SPI_BUS_TFT_HZ
+#define SPI_BUS_TFT_HZ 40000000
+#endif
+#ifndef SPI_BUS_SD_HZ
+#define SPI_BUS_SD_HZ 400000    // Inicialização do cartão; o driver do SD sobe com set_clock()
+#endif
+#ifndef SPI_BUS_RADIO_HZ
+#define SPI_BUS_RADIO_HZ 8000000
+#endif
+
+/*Dispositivos, em ordem de prioridade*/
+enum SpiBusDevice : uint8_t {
+    SPI_BUS_RADIO,
+    SPI_BUS_TFT,
+    SPI_BUS_SD,
+    SPI_BUS_DEVICES
+};
+
+/*Flags de Transfer*/
+#define SPI_BUS_CMD   0x01  // DC baixo: byte de comando do display
+#define SPI_BUS_CHAIN 0x02  // Segura o barramento para a próxima transferência do dispositivo
+
+namespace SpiBus {
+
+struct Transfer {
+    const void* tx;             // nullptr: envia 0xFF (leitura)
+    void* rx;                   // nullptr: descarta o que chega
+    uint32_t len;               // Bytes
+    uint8_t flags;              // SPI_BUS_*
+    void (*on_done)(Transfer*); // Na tarefa do árbitro; pode ser nullptr
+    void* user;
+
+    // Do árbitro
+    Transfer* next;
+    uint32_t sent;
+    uint32_t queued_us;
+};
+
+struct DeviceStats {
+    uint32_t transfers;
+    uint32_t chunks;
+    uint64_t bytes;
+    uint64_t busy_us;       // Tempo no fio
+    uint32_t max_wait_us;   // Maior espera entre o submit() e o primeiro pedaço
+    uint32_t clock_hz;
+};
+
+/**
+ * @brief Toma o barramento (o SPI do Arduino não pode mais ser usado) e cria
+ * a tarefa do árbitro. Os CS ficam em nível alto até a primeira transferência.
+ * Se algo falhar, solta o que já tinha reservado, devolve o barramento ao SPI
+ * do Arduino e retorna false: submit() e transfer() não fazem nada.
+ */
+bool begin();
+
+/**
+ * @brief Enfileira `t` no dispositivo. Os buffers e o próprio `t` precisam
+ * viver até o on_done. Retorna false antes do begin().
+ */
+bool submit(SpiBusDevice dev, Transfer* t);
+
+/**
+ * @brief Transferência síncrona: espera o fim. Usa a notificação da tarefa que chama.
+ */
+void transfer(SpiBusDevice dev, const void* tx, void* rx, uint32_t len, uint8_t flags = 0);
+
+/**
+ * @brief Troca o clock do dispositivo depois das transferências já enfileiradas.
+ */
+void set_clock(SpiBusDevice dev, uint32_t hz);
+
+/**
+ * @brief Tira o dispositivo do árbitro, com a fila vazia: o CS fica livre para
+ * outro driver do spi_master no mesmo barramento (ex: o esp_lcd do display).
+ * Depois disso submit() para ele retorna false.
+ */
+void release(SpiBusDevice dev);
+
+/**
+ * @brief true quando um dispositivo mais prioritário que `dev` tem
+ * transferências na fila, esperando a corrente de `dev` acabar.
+ */
+bool contended(SpiBusDevice dev);
+
+DeviceStats stats(SpiBusDevice dev);
+const char* device_name(SpiBusDevice dev);
+
+} // namespace SpiBus
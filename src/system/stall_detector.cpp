@@ -0,0 +1,187 @@
+#include "stall_detector.h"
+
+#if STALL_DETECTOR_ENABLE
+
+namespace {
+
+// Limites superiores dos baldes do histograma; o último balde é ">= 5 s"
+constexpr uint32_t HIST_EDGES_MS[STALL_HIST_BUCKETS - 1] = {500, 1000, 2000, 5000};
+const char* const HIST_LABELS[STALL_HIST_BUCKETS] = {"<0.5s", "<1s", "<2s", "<5s", ">=5s"};
+
+constexpr uint32_t WATCH_STACK = 4096;
+constexpr UBaseType_t WATCH_PRIORITY = 2;
+constexpr BaseType_t WATCH_CORE = 0;
+
+TaskHandle_t ui_task = nullptr;
+volatile uint32_t last_beat_ms = 0;
+
+// Pilha-sombra da UI: só a thread de UI escreve; a tarefa de verificação lê.
+// Os nomes são literais, então uma leitura no meio de uma troca no máximo
+// mostra o site anterior.
+const char* volatile site_names[STALL_SITE_DEPTH];
+const void* volatile site_callers[STALL_SITE_DEPTH];
+volatile uint8_t site_depth = 0;
+
+// Estado do travamento em andamento (só a tarefa de verificação mexe)
+bool in_stall = false;
+uint32_t stall_beat_ms = 0;
+const char* stall_site = nullptr;
+const void* stall_caller = nullptr;
+
+// Resultados: escritos pela tarefa de verificação, lidos pela UI (Monitor)
+portMUX_TYPE stats_mux = portMUX_INITIALIZER_UNLOCKED;
+StallDetector::Stats totals = {};
+StallDetector::Offender offenders[STALL_MAX_OFFENDERS];
+uint8_t offenders_used = 0;
+
+/**
+ * @brief "Settings::handle > WiFi.scanNetworks (0x42012345)" com os sites ativos agora.
+ * Guarda o mais interno em stall_site/stall_caller.
+ */
+void describe_sites(char* buf, size_t size) {
+    uint8_t depth = site_depth;
+    if (depth > STALL_SITE_DEPTH) depth = STALL_SITE_DEPTH;
+    stall_site = depth ? site_names[depth - 1] : nullptr;
+    stall_caller = depth ? site_callers[depth - 1] : nullptr;
+    if (!depth) {
+        snprintf(buf, size, "(sem site marcado)");
+        return;
+    }
+
+    size_t len = 0;
+    buf[0] = '\0';
+    for (uint8_t i = 0; i < depth && len < size; i++) {
+        len += snprintf(buf + len, size - len, "%s%s", i ? " > " : "", site_names[i]);
+    }
+    if (len < size) snprintf(buf + len, size - len, " (%p)", stall_caller);
+}
+
+uint8_t bucket_of(uint32_t ms) {
+    uint8_t b = 0;
+    while (b < STALL_HIST_BUCKETS - 1 && ms >= HIST_EDGES_MS[b]) b++;
+    return b;
+}
+
+void record(uint32_t ms) {
+    portENTER_CRITICAL(&stats_mux);
+    totals.stalls++;
+    totals.histogram[bucket_of(ms)]++;
+    if (ms > totals.worst_ms) {
+        totals.worst_ms = ms;
+        totals.worst_site = stall_site;
+    }
+
+    StallDetector::Offender* o = nullptr;
+    for (uint8_t i = 0; i < offenders_used; i++) {
+        if (offenders[i].site == stall_site) o = &offenders[i];
+    }
+    if (!o && offenders_used < STALL_MAX_OFFENDERS) {
+        o = &offenders[offenders_used++];
+        *o = StallDetector::Offender{stall_site, stall_caller, 0, 0, 0};
+    }
+    if (o) {
+        o->count++;
+        o->total_ms += ms;
+        if (ms > o->max_ms) {
+            o->max_ms = ms;
+            o->caller = stall_caller;
+        }
+    }
+    portEXIT_CRITICAL(&stats_mux);
+}
+
+void print_report(uint32_t ms) {
+    Serial.printf("[stall] UI travada por %lu ms em %s (%p)\n", (unsigned long)ms,
+                  stall_site ? stall_site : "(sem site marcado)", stall_caller);
+
+    char line[128];
+    size_t len = snprintf(line, sizeof(line), "[stall] histograma:");
+    for (uint8_t b = 0; b < STALL_HIST_BUCKETS && len < sizeof(line); b++) {
+        len += snprintf(line + len, sizeof(line) - len, " %s=%lu", HIST_LABELS[b], (unsigned long)totals.histogram[b]);
+    }
+    Serial.println(line);
+
+    for (uint8_t i = 0; i < offenders_used; i++) {
+        const StallDetector::Offender& o = offenders[i];
+        Serial.printf("[stall]   %-28s %3lu x, máx %5lu ms, total %6lu ms\n", o.site ? o.site : "(sem site marcado)",
+                      (unsigned long)o.count, (unsigned long)o.max_ms, (unsigned long)o.total_ms);
+    }
+}
+
+void check() {
+    uint32_t beat = last_beat_ms;
+    if (!in_stall) {
+        uint32_t waited = millis() - beat;
+        if (waited < STALL_THRESHOLD_MS) return;
+        in_stall = true;
+        stall_beat_ms = beat;
+        char sites[160];
+        describe_sites(sites, sizeof(sites));
+        Serial.printf("[stall] UI sem quadro há %lu ms: %s\n", (unsigned long)waited, sites);
+    } else if (beat != stall_beat_ms) {
+        // A UI terminou a volta que estava travada
+        in_stall = false;
+        uint32_t ms = beat - stall_beat_ms;
+        record(ms);
+        print_report(ms);
+    }
+}
+
+void watch_task(void*) {
+    for (;;) {
+        check();
+        vTaskDelay(pdMS_TO_TICKS(STALL_CHECK_MS));
+    }
+}
+
+} // namespace
+
+namespace StallDetector {
+
+Site::Site(const char* name, const void* caller) : active_(false) {
+    if (!ui_task || xTaskGetCurrentTaskHandle() != ui_task) return;
+    uint8_t depth = site_depth;
+    if (depth < STALL_SITE_DEPTH) {
+        site_names[depth] = name;
+        site_callers[depth] = caller;
+    }
+    site_depth = depth + 1;
+    active_ = true;
+}
+
+Site::~Site() {
+    if (active_) site_depth = site_depth - 1;
+}
+
+void begin() {
+    if (ui_task) return;
+    ui_task = xTaskGetCurrentTaskHandle();
+    last_beat_ms = millis();
+    xTaskCreatePinnedToCore(watch_task, "StallWatch", WATCH_STACK, NULL, WATCH_PRIORITY, NULL, WATCH_CORE);
+}
+
+void heartbeat() {
+    last_beat_ms = millis();
+}
+
+Stats stats() {
+    portENTER_CRITICAL(&stats_mux);
+    Stats s = totals;
+    portEXIT_CRITICAL(&stats_mux);
+    return s;
+}
+
+uint8_t offender_count() {
+    return offenders_used;
+}
+
+Offender offender(uint8_t i) {
+    portENTER_CRITICAL(&stats_mux);
+    Offender o = i < offenders_used ? offenders[i] : Offender{};
+    portEXIT_CRITICAL(&stats_mux);
+    return o;
+}
+
+} // namespace StallDetector
+
+#endif /*STALL_DETECTOR_ENABLE*/
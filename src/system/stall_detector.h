@@ -0,0 +1,127 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * StallDetector - Detector de travamentos da thread de UI
+ *
+ * Uma tarefa no núcleo 0 (o loop() roda no núcleo 1) confere a cada
+ * STALL_CHECK_MS se o loop() terminou uma volta nos últimos STALL_THRESHOLD_MS.
+ * Quando não terminou, a UI está travada e o detector:
+ *
+ * - Avisa no Serial na hora, com a pilha de "sites" ativa na UI: os trechos
+ *   marcados com STALL_SITE() (ex: "Settings::handle > WiFi.scanNetworks") e o
+ *   endereço de quem chamou cada um, para o addr2line:
+ *     xtensa-esp32s3-elf-addr2line -pfiaC -e .pio/build/T-Deck/firmware.elf 0x42012345
+ * - Quando a UI volta, registra a duração no histograma e na tabela dos
+ *   piores sites, e imprime os dois.
+ *
+ * A tarefa de outro núcleo não consegue ler a pilha de chamadas de uma tarefa
+ * em execução (só o panic handler faz isso), por isso os sites marcados fazem o
+ * papel do backtrace: uma pilha-sombra com nome e endereço de retorno, só da
+ * thread de UI. Marque as chamadas que bloqueiam: rede, scan de Wi-Fi, NTP.
+ *
+ * Custo: um millis() por volta do loop(), algumas escritas por site e a tarefa
+ * de verificação acordando a cada STALL_CHECK_MS.
+ *
+ * 🧊 Exemplo de uso:
+ *
+ * void setup() {
+ *     ...
+ *     StallDetector::begin();   // No fim: o boot inteiro não conta como travamento
+ * }
+ *
+ * void loop() {
+ *     AppManager::handle();
+ *     StallDetector::heartbeat();
+ * }
+ *
+ * static void fetch_weather_data() {
+ *     STALL_SITE("Weather::fetch_weather_data");
+ *     ...
+ * }
+ */
+
+#ifndef STALL_DETECTOR_ENABLE
+#define STALL_DETECTOR_ENABLE 1
+#endif
+
+/*A UI é considerada travada depois deste tempo sem terminar uma volta do loop()*/
+#ifndef STALL_THRESHOLD_MS
+#define STALL_THRESHOLD_MS 250
+#endif
+
+/*Período da verificação feita pela tarefa do núcleo 0*/
+#ifndef STALL_CHECK_MS
+#define STALL_CHECK_MS 20
+#endif
+
+#define STALL_SITE_DEPTH 8      // Sites aninhados guardados
+#define STALL_MAX_OFFENDERS 8   // Sites diferentes na tabela dos piores
+#define STALL_HIST_BUCKETS 5    // < 0.5 s, < 1 s, < 2 s, < 5 s, >= 5 s
+
+namespace StallDetector {
+
+struct Offender {
+    const char* site;       // Site mais interno ativo quando travou
+    const void* caller;     // Quem chamou esse site
+    uint32_t count;
+    uint32_t max_ms;
+    uint32_t total_ms;
+};
+
+struct Stats {
+    uint32_t stalls;
+    uint32_t worst_ms;
+    const char* worst_site;
+    uint32_t histogram[STALL_HIST_BUCKETS];
+};
+
+#if STALL_DETECTOR_ENABLE
+
+/**
+ * @brief Marca o início de um trecho da UI; o destrutor marca o fim.
+ * Fora da thread de UI não faz nada.
+ */
+class Site {
+public:
+    Site(const char* name, const void* caller);
+    ~Site();
+    Site(const Site&) = delete;
+    Site& operator=(const Site&) = delete;
+
+private:
+    bool active_;
+};
+
+/**
+ * @brief Registra a thread atual como a de UI e cria a tarefa de verificação.
+ */
+void begin();
+
+/**
+ * @brief Fim de uma volta do loop(). Chame uma vez por volta.
+ */
+void heartbeat();
+
+Stats stats();
+uint8_t offender_count();
+Offender offender(uint8_t i);
+
+#define STALL_CAT2(a, b) a##b
+#define STALL_CAT(a, b) STALL_CAT2(a, b)
+#define STALL_SITE(name) \
+    StallDetector::Site STALL_CAT(stall_site_, __LINE__)(name, __builtin_return_address(0))
+
+#else
+
+inline void begin() {}
+inline void heartbeat() {}
+inline Stats stats() { return Stats{}; }
+inline uint8_t offender_count() { return 0; }
+inline Offender offender(uint8_t) { return Offender{}; }
+
+#define STALL_SITE(name) ((void)0)
+
+#endif
+
+} // namespace StallDetector
@@ -0,0 +1,466 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+#include <esp_heap_caps.h>
+#include "system/pda_mem.h"
+#include "system/pda_trace.h"
+
+/**
+ * SysMonitor - Amostrador de CPU, memória e tempos de quadro
+ *
+ * Alimenta o app Monitor (apps/monitor) com o que o aparelho está gastando
+ * enquanto roda, sem pesar no próprio sistema:
+ *
+ * - Quadros: o driver do display chama frame_begin() (render_start_cb do LVGL),
+ *   flush_begin()/flush_end() em volta do pushColors e frame_end() (monitor_cb).
+ *   Cada quadro custa duas leituras de micros() e algumas somas.
+ * - Amostra: um lv_timer de SYS_MONITOR_PERIOD_MS lê as tarefas do FreeRTOS
+ *   (uxTaskGetSystemState), os dois níveis de heap (heap_caps) e fecha a janela
+ *   de quadros. A própria amostra é cronometrada (sampler_us) para que o custo
+ *   do monitor apareça na tela: ~100 µs por segundo, bem abaixo de 1% da CPU.
+ * - Histórico: os últimos SYS_MONITOR_HISTORY valores de carga, heap e quadro,
+ *   em buffers circulares de lv_coord_t que o lv_chart usa direto
+ *   (lv_chart_set_ext_y_array + lv_chart_set_x_start_point), sem cópias.
+ *
+ * A CPU por tarefa depende de CONFIG_FREERTOS_USE_TRACE_FACILITY e
+ * CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS no sdkconfig. Sem elas, tasks_available
+ * fica false e a carga de cada núcleo vem de ganchos na tarefa IDLE
+ * (esp_register_freertos_idle_hook_for_cpu): enquanto set_core_sampling(true),
+ * cada passada da IDLE soma o tempo desde a anterior quando ele é curto; um
+ * intervalo longo quer dizer que outra tarefa rodou. Para isso o gancho impede
+ * o WFI da IDLE, o que gasta energia, por isso só o app Monitor liga a medição,
+ * e só enquanto está na tela. Sem ela (ou no host), cores_available fica false e a
+ * carga mostrada é só a do LVGL (render + flush / período).
+ *
+ * Tarefas curtas (buscas na rede) já não existem quando a amostra roda; elas
+ * registram a própria marca d'água da pilha com record_stack() antes do vTaskDelete().
+ *
+ * 📈 Exemplo de uso:
+ *
+ * SysMonitor::begin();                           // Depois de registrar o display
+ * SysMonitor::set_listener(on_sample);           // Chamado a cada amostra
+ * SysMonitor::set_core_sampling(true);           // Só com a carga na tela
+ *
+ * static void fetch_task(void*) {
+ *     ...
+ *     SysMonitor::record_stack("FetchTasks");
+ *     vTaskDelete(NULL);
+ * }
+ */
+
+#ifndef SYS_MONITOR_PERIOD_MS
+#define SYS_MONITOR_PERIOD_MS 1000
+#endif
+
+// Pontos do histórico (um por amostra)
+#define SYS_MONITOR_HISTORY 60
+// Tarefas lidas por amostra; as que passarem disso ficam de fora da tabela
+#define SYS_MONITOR_MAX_TASKS 24
+// Tarefas curtas com marca d'água registrada
+#define SYS_MONITOR_MAX_STACKS 4
+
+#if defined(configUSE_TRACE_FACILITY) && configUSE_TRACE_FACILITY && \
+    defined(configGENERATE_RUN_TIME_STATS) && configGENERATE_RUN_TIME_STATS
+#define SYS_MONITOR_TASK_STATS 1
+#else
+#define SYS_MONITOR_TASK_STATS 0
+#endif
+
+// Sem run-time stats, a carga dos núcleos vem dos ganchos da IDLE
+#if !SYS_MONITOR_TASK_STATS && defined(ESP_PLATFORM)
+#define SYS_MONITOR_IDLE_HOOKS 1
+#include <esp_freertos_hooks.h>
+#include <esp_timer.h>
+#else
+#define SYS_MONITOR_IDLE_HOOKS 0
+#endif
+
+// Maior intervalo entre passadas da IDLE que ainda conta como ocioso
+#ifndef SYS_MONITOR_IDLE_GAP_US
+#define SYS_MONITOR_IDLE_GAP_US 50
+#endif
+
+namespace SysMonitor {
+
+struct HeapTier {
+    uint32_t total;
+    uint32_t free;
+    uint32_t largest;   // Maior bloco livre
+    uint32_t min_free;  // Menor "free" desde o boot
+};
+
+struct TaskInfo {
+    char name[16];
+    uint16_t cpu_permille;  // Fatia da CPU (dos dois núcleos) na última janela
+    uint32_t stack_free;    // Marca d'água: menor folga da pilha, em bytes
+    int8_t core;            // -1: sem afinidade
+};
+
+struct StackMark {
+    char name[16];
+    uint32_t stack_free;
+    uint32_t runs;
+};
+
+struct Snapshot {
+    uint32_t at_ms;
+    uint32_t window_ms;
+    uint32_t sampler_us;      // Custo da última amostra
+
+    HeapTier sram;
+    HeapTier psram;
+    pda_mem_stats_t lvgl;
+
+    bool tasks_available;
+    bool cores_available;                   // core_load_permille vale nesta amostra
+    uint8_t task_count;
+    TaskInfo tasks[SYS_MONITOR_MAX_TASKS];  // Ordenadas por CPU, maior primeiro
+    uint16_t core_load_permille[2];         // 1000 - fatia ociosa de cada núcleo
+    uint16_t lvgl_load_permille;            // (render + flush) / janela
+
+    uint32_t frames;
+    uint32_t render_avg_us;
+    uint32_t render_max_us;
+    uint32_t flush_avg_us;
+    uint32_t flush_max_us;
+};
+
+// --- Estado ---
+static Snapshot snap;
+static StackMark stacks[SYS_MONITOR_MAX_STACKS];
+static uint8_t stack_count = 0;
+static lv_timer_t* sample_timer = nullptr;
+static void (*listener)() = nullptr;
+
+// Histórico circular; history_head é o índice do ponto mais antigo
+static lv_coord_t hist_cpu[SYS_MONITOR_HISTORY];    // Carga em %
+static lv_coord_t hist_sram[SYS_MONITOR_HISTORY];   // SRAM interna livre em KB
+static lv_coord_t hist_psram[SYS_MONITOR_HISTORY];  // PSRAM livre em %
+static lv_coord_t hist_frame[SYS_MONITOR_HISTORY];  // Quadro (render + flush) médio em ms
+static uint16_t history_head = 0;
+
+// Janela de quadros em andamento
+static uint32_t frame_start_us = 0;
+static uint32_t flush_start_us = 0;
+static uint32_t frame_flush_us = 0;
+static uint32_t win_frames = 0;
+static uint64_t win_render_us = 0;
+static uint64_t win_flush_us = 0;
+static uint32_t win_render_max_us = 0;
+static uint32_t win_flush_max_us = 0;
+static uint32_t win_start_ms = 0;
+
+// --- Ganchos do driver do display ---
+
+inline void frame_begin() {
+    PDA_TRACE_BEGIN("lv_refr");
+    frame_start_us = micros();
+    frame_flush_us = 0;
+}
+
+inline void flush_begin() {
+    flush_start_us = micros();
+}
+
+inline void flush_end() {
+    frame_flush_us += micros() - flush_start_us;
+}
+
+inline void frame_end() {
+    uint32_t total = micros() - frame_start_us;
+    uint32_t render = total > frame_flush_us ? total - frame_flush_us : 0;
+    win_frames++;
+    win_render_us += render;
+    win_flush_us += frame_flush_us;
+    if (render > win_render_max_us) win_render_max_us = render;
+    if (frame_flush_us > win_flush_max_us) win_flush_max_us = frame_flush_us;
+    PDA_TRACE_END("lv_refr");
+}
+
+/**
+ * @brief render_start_cb do LVGL.
+ */
+static void render_start_cb(lv_disp_drv_t* drv) {
+    LV_UNUSED(drv);
+    frame_begin();
+}
+
+/**
+ * @brief monitor_cb do LVGL: chamado depois do flush do último pedaço do quadro.
+ */
+static void monitor_cb(lv_disp_drv_t* drv, uint32_t time_ms, uint32_t px) {
+    LV_UNUSED(drv);
+    LV_UNUSED(time_ms);
+    LV_UNUSED(px);
+    frame_end();
+}
+
+// --- Pilhas das tarefas curtas ---
+
+/**
+ * @brief Guarda a marca d'água da pilha da tarefa atual sob `name`.
+ * Chame no fim da tarefa, antes do vTaskDelete(NULL). Fica o menor valor visto.
+ */
+inline void record_stack(const char* name) {
+#if defined(INCLUDE_uxTaskGetStackHighWaterMark) && INCLUDE_uxTaskGetStackHighWaterMark
+    uint32_t free_bytes = uxTaskGetStackHighWaterMark(NULL);  // No ESP-IDF StackType_t é byte
+#else
+    uint32_t free_bytes = 0;
+#endif
+    StackMark* mark = nullptr;
+    for (uint8_t i = 0; i < stack_count; i++) {
+        if (strncmp(stacks[i].name, name, sizeof(stacks[i].name)) == 0) mark = &stacks[i];
+    }
+    if (!mark) {
+        if (stack_count >= SYS_MONITOR_MAX_STACKS) return;
+        mark = &stacks[stack_count++];
+        strncpy(mark->name, name, sizeof(mark->name) - 1);
+        mark->stack_free = free_bytes;
+    }
+    if (free_bytes < mark->stack_free) mark->stack_free = free_bytes;
+    mark->runs++;
+}
+
+// --- Amostra ---
+
+inline void read_heap(HeapTier* tier, uint32_t caps) {
+    tier->total = heap_caps_get_total_size(caps);
+    tier->free = heap_caps_get_free_size(caps);
+    tier->largest = heap_caps_get_largest_free_block(caps);
+    tier->min_free = heap_caps_get_minimum_free_size(caps);
+}
+
+#if SYS_MONITOR_TASK_STATS
+/**
+ * @brief Lê as tarefas e calcula a fatia de CPU de cada uma desde a amostra anterior.
+ */
+inline void read_tasks() {
+    static TaskStatus_t status[SYS_MONITOR_MAX_TASKS];
+    // Contadores da amostra anterior, por handle
+    static TaskHandle_t prev_handle[SYS_MONITOR_MAX_TASKS];
+    static uint32_t prev_counter[SYS_MONITOR_MAX_TASKS];
+    static uint8_t prev_count = 0;
+    static uint32_t prev_total = 0;
+
+    uint32_t total = 0;
+    UBaseType_t n = uxTaskGetSystemState(status, SYS_MONITOR_MAX_TASKS, &total);
+    // O contador total anda em tempo de relógio; cada núcleo acumula o seu
+    uint32_t capacity = (total - prev_total) * portNUM_PROCESSORS;
+    bool have_prev = prev_total != 0 && capacity > 0;
+
+    snap.task_count = 0;
+    snap.core_load_permille[0] = snap.core_load_permille[1] = 0;
+    for (UBaseType_t i = 0; i < n; i++) {
+        uint32_t delta = 0;
+        for (uint8_t j = 0; j < prev_count; j++) {
+            if (prev_handle[j] == status[i].xHandle) {
+                delta = status[i].ulRunTimeCounter - prev_counter[j];
+                break;
+            }
+        }
+        TaskInfo& t = snap.tasks[snap.task_count++];
+        strncpy(t.name, status[i].pcTaskName, sizeof(t.name) - 1);
+        t.name[sizeof(t.name) - 1] = '\0';
+        t.cpu_permille = have_prev ? (uint16_t)((uint64_t)delta * 1000 / capacity) : 0;
+        t.stack_free = status[i].usStackHighWaterMark;
+#if configTASKLIST_INCLUDE_COREID
+        t.core = status[i].xCoreID == tskNO_AFFINITY ? -1 : (int8_t)status[i].xCoreID;
+#else
+        t.core = -1;
+#endif
+        // A carga de cada núcleo é o que a IDLE dele não usou
+        if (have_prev && strncmp(t.name, "IDLE", 4) == 0) {
+            uint8_t core = t.name[4] == '1' ? 1 : 0;
+            uint32_t idle = (uint32_t)((uint64_t)delta * 1000 / (capacity / portNUM_PROCESSORS));
+            snap.core_load_permille[core] = idle >= 1000 ? 0 : 1000 - idle;
+        }
+    }
+
+    for (UBaseType_t i = 0; i < n; i++) {
+        prev_handle[i] = status[i].xHandle;
+        prev_counter[i] = status[i].ulRunTimeCounter;
+    }
+    prev_count = n;
+    prev_total = total;
+
+    // Ordenação por inserção: são poucas tarefas
+    for (uint8_t i = 1; i < snap.task_count; i++) {
+        TaskInfo t = snap.tasks[i];
+        int j = i - 1;
+        while (j >= 0 && snap.tasks[j].cpu_permille < t.cpu_permille) {
+            snap.tasks[j + 1] = snap.tasks[j];
+            j--;
+        }
+        snap.tasks[j + 1] = t;
+    }
+    snap.tasks_available = true;
+    snap.cores_available = true;
+}
+
+inline void set_core_sampling(bool on) {
+    LV_UNUSED(on);  // Os contadores de run-time já dão a carga dos núcleos
+}
+#else
+#if SYS_MONITOR_IDLE_HOOKS
+static volatile bool idle_sampling = false;
+static int64_t idle_last_us[2];
+static volatile uint32_t idle_us[2];
+static int64_t idle_window_start_us = 0;
+static bool idle_hooks_registered = false;
+
+/**
+ * @brief Passada da IDLE no núcleo `core`: soma o intervalo desde a anterior se for curto.
+ * Retorna false durante a medição para a IDLE não entrar em WFI, senão o tempo
+ * dormindo esperando interrupção não se distinguiria do tempo de outras tarefas.
+ */
+static bool idle_hook(uint8_t core) {
+    if (!idle_sampling) return true;
+    int64_t now = esp_timer_get_time();
+    int64_t gap = now - idle_last_us[core];
+    idle_last_us[core] = now;
+    if (gap > 0 && gap < SYS_MONITOR_IDLE_GAP_US) idle_us[core] += (uint32_t)gap;
+    return false;
+}
+
+static bool idle_hook_core0() {
+    return idle_hook(0);
+}
+
+static bool idle_hook_core1() {
+    return idle_hook(1);
+}
+
+/**
+ * @brief Carga de cada núcleo na janela, a partir do tempo ocioso somado pelos ganchos.
+ */
+inline void read_cores() {
+    int64_t now = esp_timer_get_time();
+    uint32_t window_us = (uint32_t)(now - idle_window_start_us);
+    idle_window_start_us = now;
+    snap.cores_available = idle_sampling && idle_hooks_registered && window_us > 0;
+    for (uint8_t core = 0; core < 2; core++) {
+        uint32_t idle = idle_us[core];
+        idle_us[core] = 0;
+        uint32_t idle_permille = window_us ? (uint32_t)((uint64_t)idle * 1000 / window_us) : 0;
+        snap.core_load_permille[core] = snap.cores_available && idle_permille < 1000 ? 1000 - idle_permille : 0;
+    }
+}
+#endif
+
+inline void read_tasks() {
+    snap.tasks_available = false;
+    snap.task_count = 0;
+#if SYS_MONITOR_IDLE_HOOKS
+    read_cores();
+#else
+    snap.cores_available = false;
+#endif
+}
+
+/**
+ * @brief Liga/desliga a medição da carga dos núcleos pelos ganchos da IDLE.
+ * Enquanto ligada a IDLE não dorme (WFI); desligue quando ninguém estiver olhando.
+ */
+inline void set_core_sampling(bool on) {
+#if SYS_MONITOR_IDLE_HOOKS
+    if (on && !idle_hooks_registered) {
+        idle_hooks_registered = esp_register_freertos_idle_hook_for_cpu(idle_hook_core0, 0) == ESP_OK;
+#if portNUM_PROCESSORS > 1
+        if (idle_hooks_registered &&
+            esp_register_freertos_idle_hook_for_cpu(idle_hook_core1, 1) != ESP_OK) {
+            esp_deregister_freertos_idle_hook_for_cpu(idle_hook_core0, 0);
+            idle_hooks_registered = false;
+        }
+#endif
+    }
+    // Zera a janela: o primeiro intervalo de cada núcleo é longo e não conta
+    idle_us[0] = idle_us[1] = 0;
+    idle_window_start_us = esp_timer_get_time();
+    idle_sampling = on;
+#else
+    LV_UNUSED(on);
+#endif
+}
+#endif
+
+inline lv_coord_t clamp_coord(uint32_t v) {
+    return v > 10000 ? 10000 : (lv_coord_t)v;
+}
+
+/**
+ * @brief Lê tudo, fecha a janela de quadros e avança o histórico.
+ */
+inline void sample() {
+    uint32_t t0 = micros();
+    uint32_t now = millis();
+
+    snap.at_ms = now;
+    snap.window_ms = now - win_start_ms;
+    read_heap(&snap.sram, MALLOC_CAP_INTERNAL);
+    read_heap(&snap.psram, MALLOC_CAP_SPIRAM);
+    pda_mem_get_stats(&snap.lvgl);
+    read_tasks();
+
+    snap.frames = win_frames;
+    snap.render_avg_us = win_frames ? (uint32_t)(win_render_us / win_frames) : 0;
+    snap.flush_avg_us = win_frames ? (uint32_t)(win_flush_us / win_frames) : 0;
+    snap.render_max_us = win_render_max_us;
+    snap.flush_max_us = win_flush_max_us;
+    snap.lvgl_load_permille = snap.window_ms
+        ? (uint16_t)LV_MIN((uint64_t)1000, (win_render_us + win_flush_us) / snap.window_ms)
+        : 0;
+    win_frames = 0;
+    win_render_us = win_flush_us = 0;
+    win_render_max_us = win_flush_max_us = 0;
+    win_start_ms = now;
+
+    uint16_t load = snap.cores_available
+        ? (snap.core_load_permille[0] + snap.core_load_permille[1]) / 2
+        : snap.lvgl_load_permille;
+    hist_cpu[history_head] = load / 10;
+    hist_sram[history_head] = clamp_coord(snap.sram.free / 1024);
+    hist_psram[history_head] = snap.psram.total ? (lv_coord_t)((uint64_t)snap.psram.free * 100 / snap.psram.total) : 0;
+    hist_frame[history_head] = clamp_coord((snap.render_avg_us + snap.flush_avg_us) / 1000);
+    history_head = (history_head + 1) % SYS_MONITOR_HISTORY;
+
+    snap.sampler_us = micros() - t0;
+}
+
+static void sample_timer_cb(lv_timer_t* timer) {
+    LV_UNUSED(timer);
+    sample();
+    if (listener) listener();
+}
+
+/**
+ * @brief Cria o timer de amostragem. Chame depois de registrar o display do LVGL.
+ */
+inline void begin() {
+    if (sample_timer) return;
+    for (uint16_t i = 0; i < SYS_MONITOR_HISTORY; i++) {
+        hist_cpu[i] = hist_sram[i] = hist_psram[i] = hist_frame[i] = LV_CHART_POINT_NONE;
+    }
+    win_start_ms = millis();
+    sample_timer = lv_timer_create(sample_timer_cb, SYS_MONITOR_PERIOD_MS, NULL);
+}
+
+/**
+ * @brief Função chamada depois de cada amostra (nullptr para remover).
+ */
+inline void set_listener(void (*fn)()) {
+    listener = fn;
+}
+
+inline const Snapshot& latest() {
+    return snap;
+}
+
+inline uint8_t stack_mark_count() {
+    return stack_count;
+}
+
+inline const StackMark& stack_mark(uint8_t i) {
+    return stacks[i];
+}
+
+} // namespace SysMonitor
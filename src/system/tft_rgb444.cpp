@@ -0,0 +1,188 @@
+#include <Arduino.h>
+#include "tft_rgb444.h"
+#include "system/tft_scroll.h"
+
+namespace {
+
+bool ready = false;             // begin() feito
+bool auto_on = true;
+uint8_t holds = 0;              // TFT_RGB444_* de quem pediu
+uint32_t screen_px = 0;
+
+bool frame_444 = false;         // Formato dos flushes do quadro atual
+bool panel_444 = false;         // Formato do último COLMOD enviado
+uint8_t colmod_param = 0x55;
+bool last_large = false;        // O quadro anterior cobriu a tela
+uint32_t last_frame_ms = 0;
+bool settling = false;          // O próximo quadro é o acabamento: sempre RGB565
+
+lv_area_t lossy;                // Enviado em 12 bits desde o último acabamento
+bool has_lossy = false;
+uint32_t lossy_scrolls = 0;     // Passos do TftScroll quando `lossy` começou
+lv_timer_t* settle_timer = nullptr;
+TftRgb444::Stats counters = {};
+
+// Canal de 5 ou 6 bits para 4 bits: floor(v * 15 / max + bias / 32). O bias
+// 2t + 1 é o limiar t (0..15) do pontilhado; 16, na última linha, arredonda.
+#define RGB444_ROUND 16
+uint8_t lut5[17][32];
+uint8_t lut6[17][64];
+bool luts_ready = false;
+
+const uint8_t bayer[4][4] = {
+    {0, 8, 2, 10},
+    {12, 4, 14, 6},
+    {3, 11, 1, 9},
+    {15, 7, 13, 5},
+};
+const uint8_t round_row[4] = {RGB444_ROUND, RGB444_ROUND, RGB444_ROUND, RGB444_ROUND};
+
+void build_luts() {
+    for (int t = 0; t <= RGB444_ROUND; t++) {
+        int bias = t == RGB444_ROUND ? 16 : 2 * t + 1;
+        for (int v = 0; v < 32; v++) lut5[t][v] = (uint8_t)((v * 15 * 32 + bias * 31) / (31 * 32));
+        for (int v = 0; v < 64; v++) lut6[t][v] = (uint8_t)((v * 15 * 32 + bias * 63) / (63 * 32));
+    }
+    luts_ready = true;
+}
+
+/*Acabamento: a tela parada volta a ser a de 16 bits*/
+void settle_cb(lv_timer_t* timer) {
+    lv_timer_pause(timer);
+    if (holds || !has_lossy) return;
+    settling = true;
+    // Com a GRAM rolada no meio, os pixels de 12 bits não estão mais na mesma área
+    if (TftScroll::stats().accelerated != lossy_scrolls) lv_obj_invalidate(lv_scr_act());
+    else _lv_inv_area(lv_disp_get_default(), &lossy);
+    has_lossy = false;
+    counters.settles++;
+}
+
+void arm_settle() {
+    if (!settle_timer) return;
+    lv_timer_reset(settle_timer);
+    lv_timer_resume(settle_timer);
+}
+
+} // namespace
+
+namespace TftRgb444 {
+
+uint32_t pack(const lv_area_t* area, const lv_color_t* src, uint8_t* dst, bool dither) {
+    if (!luts_ready) build_luts();
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t h = lv_area_get_height(area);
+    uint8_t* out = dst;
+    uint16_t first = 0;         // Pixel par esperando o par, 12 bits
+    bool half = false;
+    // Dois pixels viram 3 bytes (R1G1 B1R2 G2B2), seguindo pelas linhas. Cada
+    // par é lido antes de ser escrito e a saída anda mais devagar que a
+    // entrada: `dst` pode ser o próprio `src`.
+    for (lv_coord_t y = 0; y < h; y++) {
+        const uint8_t* t = dither ? bayer[(area->y1 + y) & 3] : round_row;
+        lv_coord_t x = area->x1;
+        for (lv_coord_t i = 0; i < w; i++, x++) {
+            lv_color_t c = *src++;
+            uint8_t b = t[x & 3];
+            uint16_t p = (uint16_t)(lut5[b][LV_COLOR_GET_R(c)] << 8 | lut6[b][LV_COLOR_GET_G(c)] << 4 |
+                                    lut5[b][LV_COLOR_GET_B(c)]);
+            if (!half) {
+                first = p;
+                half = true;
+                continue;
+            }
+            out[0] = (uint8_t)(first >> 4);
+            out[1] = (uint8_t)((first & 0x0F) << 4 | p >> 8);
+            out[2] = (uint8_t)p;
+            out += 3;
+            half = false;
+        }
+    }
+    // O painel só grava um pixel com os 12 bits: o nibble que sobra é ignorado
+    if (half) {
+        out[0] = (uint8_t)(first >> 4);
+        out[1] = (uint8_t)((first & 0x0F) << 4);
+        out += 2;
+    }
+    return (uint32_t)(out - dst);
+}
+
+void begin(lv_coord_t hor_res, lv_coord_t ver_res) {
+    screen_px = (uint32_t)hor_res * ver_res;
+    if (!luts_ready) build_luts();
+    if (!settle_timer) {
+        settle_timer = lv_timer_create(settle_cb, TFT_RGB444_SETTLE_MS, nullptr);
+        lv_timer_pause(settle_timer);
+    }
+    ready = TFT_RGB444_ENABLE;
+}
+
+void set_auto(bool enabled) {
+    auto_on = enabled;
+}
+
+void hold(uint8_t reason) {
+    holds |= reason;
+}
+
+void release(uint8_t reason) {
+    holds &= ~reason;
+    if (!holds && has_lossy) arm_settle();
+}
+
+void frame_begin(lv_disp_drv_t* drv) {
+    LV_UNUSED(drv);
+    frame_444 = false;
+    if (!ready) return;
+
+    lv_disp_t* disp = _lv_refr_get_disp_refreshing();
+    uint32_t px = 0;
+    for (uint16_t i = 0; i < disp->inv_p; i++) {
+        if (!disp->inv_area_joined[i]) px += lv_area_get_size(&disp->inv_areas[i]);
+    }
+    uint32_t now = lv_tick_get();
+    bool large = (uint64_t)px * 100 >= (uint64_t)screen_px * TFT_RGB444_AUTO_PCT;
+    bool bulk = holds || (auto_on && large && last_large && now - last_frame_ms <= TFT_RGB444_SETTLE_MS);
+    if (settling) {
+        // O acabamento não conta como o primeiro quadro de outra sequência
+        bulk = holds;
+        large = false;
+        settling = false;
+    }
+    last_large = large;
+    last_frame_ms = now;
+    counters.frames++;
+    if (!bulk) return;
+
+    frame_444 = true;
+    counters.frames_444++;
+    counters.bytes_saved += (uint64_t)px * sizeof(lv_color_t) - packed_size(px);
+    if (!has_lossy) lossy_scrolls = TftScroll::stats().accelerated;
+    for (uint16_t i = 0; i < disp->inv_p; i++) {
+        if (disp->inv_area_joined[i]) continue;
+        if (has_lossy) _lv_area_join(&lossy, &lossy, &disp->inv_areas[i]);
+        else lossy = disp->inv_areas[i];
+        has_lossy = true;
+    }
+}
+
+void frame_end() {
+    if (frame_444) arm_settle();
+}
+
+bool active() {
+    return frame_444;
+}
+
+const uint8_t* colmod() {
+    if (frame_444 == panel_444) return nullptr;
+    panel_444 = frame_444;
+    colmod_param = frame_444 ? 0x53 : 0x55;
+    return &colmod_param;
+}
+
+Stats stats() {
+    return counters;
+}
+
+} // namespace TftRgb444
@@ -0,0 +1,131 @@
+#pragma once
+
+/**
+ * TFT RGB444 - Transporte de 12 bits por pixel para o ST7789
+ *
+ * O LVGL desenha em RGB565 e o flush manda 2 bytes por pixel: um quadro
+ * inteiro são 153.600 bytes, ~31 ms no fio a 40 MHz. Com o COLMOD (0x3A) em
+ * 0x53 o ST7789 aceita 12 bits por pixel (RGB444, dois pixels em 3 bytes):
+ * 25% a menos no fio, com menos cores. Vale nos momentos em que a tela inteira
+ * muda a cada quadro e ninguém repara no degrau de cor:
+ *
+ * - Automático: dois quadros seguidos cobrindo TFT_RGB444_AUTO_PCT da tela, a
+ *   menos de TFT_RGB444_SETTLE_MS um do outro (animação de tela inteira,
+ *   transição), vão em 12 bits.
+ * - hold()/release(): quem sabe que vai mandar quadros inteiros (vídeo, tela
+ *   remota) segura o modo pelo tempo que precisar.
+ * - Acabamento: TFT_RGB444_SETTLE_MS depois do último quadro em 12 bits, a área
+ *   enviada assim é invalidada e redesenhada em RGB565. A tela parada é sempre
+ *   a de 16 bits.
+ *
+ * O empacotamento é feito no flush, no próprio buffer do LVGL (a saída é menor
+ * que a entrada e o buffer não é lido de novo até o próximo desenho). Com
+ * TFT_RGB444_DITHER, um pontilhado ordenado 4x4 (Bayer) nas coordenadas da
+ * janela esconde as faixas dos degradês; sem ele, cada canal é arredondado.
+ *
+ * O driver manda o COLMOD antes da primeira janela do quadro em que o formato
+ * muda (colmod()) e só empacota quando active().
+ *
+ * Os quadros por segundo no aparelho, nos dois formatos, saem do display_bench.h
+ * (-DDISPLAY_BENCH=1: full/full444 no fio, lvgl565/lvgl444 com o render).
+ *
+ * 🎨 Exemplo de uso:
+ *
+ * // render_start_cb e monitor_cb do display
+ * TftRgb444::frame_begin(drv);
+ * TftRgb444::frame_end();
+ *
+ * // disp_flush()
+ * if (const uint8_t* p = TftRgb444::colmod()) send_command(0x3A, p, 1);
+ * uint32_t bytes = TftRgb444::active() ? TftRgb444::pack(area, pixels, (uint8_t*)pixels)
+ *                                      : lv_area_get_size(area) * sizeof(lv_color_t);
+ *
+ * // Um player de vídeo
+ * TftRgb444::hold(TFT_RGB444_VIDEO);
+ * ...
+ * TftRgb444::release(TFT_RGB444_VIDEO);
+ */
+
+#include <lvgl.h>
+
+#ifndef TFT_RGB444_ENABLE
+#define TFT_RGB444_ENABLE 1
+#endif
+
+/*Pontilhado ordenado em vez do arredondamento*/
+#ifndef TFT_RGB444_DITHER
+#define TFT_RGB444_DITHER 1
+#endif
+
+/*Fração da tela (%) que um quadro precisa cobrir para contar como "de tela inteira"*/
+#ifndef TFT_RGB444_AUTO_PCT
+#define TFT_RGB444_AUTO_PCT 75
+#endif
+
+/*Tempo sem quadros em 12 bits até o redesenho em RGB565*/
+#ifndef TFT_RGB444_SETTLE_MS
+#define TFT_RGB444_SETTLE_MS 150
+#endif
+
+/*Quem pediu o modo (hold/release)*/
+#define TFT_RGB444_TRANSITION 0x01
+#define TFT_RGB444_VIDEO      0x02
+#define TFT_RGB444_REMOTE     0x04  // Tela remota (VNC)
+
+namespace TftRgb444 {
+
+struct Stats {
+    uint32_t frames;            // Quadros desenhados
+    uint32_t frames_444;        // Quadros enviados em 12 bits
+    uint32_t settles;           // Redesenhos em RGB565 depois de uma sequência
+    uint64_t bytes_saved;       // Bytes que o RGB565 mandaria a mais
+};
+
+/**
+ * @brief Bytes de `px` pixels em RGB444. Um pixel sobrando no fim vai em 2 bytes.
+ */
+inline uint32_t packed_size(uint32_t px) { return (px * 3 + 1) / 2; }
+
+/**
+ * @brief Empacota os pixels de `area` (linha a linha, RGB565 do LVGL) em
+ * RGB444 na ordem do fio. `dst` pode ser o próprio `src`. Retorna os bytes.
+ */
+uint32_t pack(const lv_area_t* area, const lv_color_t* src, uint8_t* dst, bool dither = TFT_RGB444_DITHER);
+
+/**
+ * @brief Prepara o modo para o display `hor_res` x `ver_res` (o painel começa em RGB565).
+ */
+void begin(lv_coord_t hor_res, lv_coord_t ver_res);
+
+/**
+ * @brief Liga ou desliga o modo automático. hold() continua valendo.
+ */
+void set_auto(bool enabled);
+
+void hold(uint8_t reason);
+void release(uint8_t reason);
+
+/**
+ * @brief render_start_cb: decide o formato do quadro pelas áreas invalidadas.
+ */
+void frame_begin(lv_disp_drv_t* drv);
+
+/**
+ * @brief monitor_cb: depois de um quadro em 12 bits, agenda o acabamento.
+ */
+void frame_end();
+
+/**
+ * @brief true quando os flushes deste quadro vão em RGB444.
+ */
+bool active();
+
+/**
+ * @brief Parâmetro do COLMOD quando o formato do painel precisa mudar antes
+ * da próxima janela, ou nullptr. O byte fica válido até o próximo quadro.
+ */
+const uint8_t* colmod();
+
+Stats stats();
+
+} // namespace TftRgb444
@@ -0,0 +1,351 @@
+#include <Arduino.h>
+#include "tft_scroll.h"
+#include <string.h>
+#include "system/pda_log.h"
+
+namespace {
+
+// Linhas do painel: VSCSAD = tfa + off, e a linha visível p da região mostra
+// a linha tfa + (p - tfa + off) % vsa da GRAM.
+struct Region {
+    lv_coord_t tfa;
+    lv_coord_t vsa;
+    lv_coord_t off;
+};
+
+bool ready = false;             // begin() feito
+bool active = false;            // Aceleração ligada
+bool axis_x = false;            // As linhas do painel correm no X da tela
+bool mirrored = false;          // A linha 0 do painel é a última coordenada da tela
+lv_coord_t lines = 0;           // Linhas do painel: o eixo da rolagem
+lv_coord_t cross = 0;           // Tamanho da tela no outro eixo
+lv_color_t* columns = nullptr;  // Janelas em colunas, copiadas contíguas (eixo em X)
+
+Region cur = {0, 0, 0};         // Na GRAM: vale para os flushes do quadro atual
+Region next = {0, 0, 0};        // Do próximo quadro
+lv_coord_t moved = 0;           // Passos desde o início do quadro, na coordenada da tela
+bool define_dirty = false;
+bool start_dirty = false;
+uint8_t vscrdef[6];
+uint8_t vscsad[2];
+TftScroll::Stats counters = {};
+
+lv_coord_t line(lv_coord_t a) {
+    return mirrored ? lines - 1 - a : a;
+}
+
+/*Coordenada da GRAM (CASET/RASET) que aparece na coordenada `a` da tela*/
+lv_coord_t target(lv_coord_t a) {
+    lv_coord_t p = line(a);
+    if (p >= cur.tfa && p < cur.tfa + cur.vsa) p = cur.tfa + (p - cur.tfa + cur.off) % cur.vsa;
+    return line(p);
+}
+
+lv_coord_t axis1(const lv_area_t& a) { return axis_x ? a.x1 : a.y1; }
+lv_coord_t axis2(const lv_area_t& a) { return axis_x ? a.x2 : a.y2; }
+
+void set_axis(lv_area_t* a, lv_coord_t from, lv_coord_t to) {
+    if (axis_x) {
+        a->x1 = from;
+        a->x2 = to;
+    } else {
+        a->y1 = from;
+        a->y2 = to;
+    }
+}
+
+void shift(lv_area_t* a, lv_coord_t d) {
+    set_axis(a, axis1(*a) + d, axis2(*a) + d);
+}
+
+/*A região na tela, com o eixo cruzado inteiro*/
+lv_area_t region_area(const Region& r) {
+    lv_area_t a;
+    if (axis_x) lv_area_set(&a, 0, 0, 0, cross - 1);
+    else lv_area_set(&a, 0, 0, cross - 1, 0);
+    lv_coord_t from = LV_MIN(line(r.tfa), line(r.tfa + r.vsa - 1));
+    set_axis(&a, from, from + r.vsa - 1);
+    return a;
+}
+
+void put16(uint8_t* out, uint16_t v) {
+    out[0] = v >> 8;
+    out[1] = v & 0xFF;
+}
+
+/*`o` desenha algo sobre `area`*/
+bool draws_over(const lv_obj_t* o, const lv_area_t* area) {
+    if (lv_obj_has_flag(o, LV_OBJ_FLAG_HIDDEN)) return false;
+    lv_area_t coords = o->coords;
+    lv_coord_t ext = _lv_obj_get_ext_draw_size(o);
+    lv_area_increase(&coords, ext, ext);
+    lv_area_t common;
+    return _lv_area_intersect(&common, &coords, area);
+}
+
+bool layer_draws_over(lv_obj_t* layer, const lv_area_t* area) {
+    if (!layer) return false;
+    uint32_t count = lv_obj_get_child_cnt(layer);
+    for (uint32_t i = 0; i < count; i++) {
+        if (draws_over(lv_obj_get_child(layer, i), area)) return true;
+    }
+    return false;
+}
+
+/**
+ * O conteúdo de `obj` pode andar na GRAM: o que aparece nele é só o fundo
+ * (igual ao longo do eixo) e os filhos que rolam. `visible` recebe a área dele
+ * na tela.
+ */
+bool eligible(lv_obj_t* obj, lv_area_t* visible) {
+    lv_disp_t* disp = lv_obj_get_disp(obj);
+    if (disp->driver->full_refresh || disp->prev_scr || lv_obj_get_screen(obj) != disp->act_scr) return false;
+    if (!lv_disp_is_invalidation_enabled(disp) || !lv_obj_is_visible(obj)) return false;
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return false;
+
+    if (lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) < LV_OPA_COVER) return false;
+    if (lv_obj_get_style_opa(obj, LV_PART_MAIN) < LV_OPA_COVER) return false;
+    if (lv_obj_get_style_blend_mode(obj, LV_PART_MAIN) != LV_BLEND_MODE_NORMAL) return false;
+    if (lv_obj_get_style_bg_img_src(obj, LV_PART_MAIN)) return false;
+    if (lv_obj_get_style_radius(obj, LV_PART_MAIN) != 0) return false;
+    if (lv_obj_get_style_transform_zoom(obj, LV_PART_MAIN) != LV_IMG_ZOOM_NONE) return false;
+    if (lv_obj_get_style_transform_angle(obj, LV_PART_MAIN) != 0) return false;
+    // Um degradê ao longo do eixo cruzado é o mesmo em toda a região
+    lv_grad_dir_t grad = lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN);
+    if (grad != LV_GRAD_DIR_NONE && grad != (axis_x ? LV_GRAD_DIR_VER : LV_GRAD_DIR_HOR)) return false;
+    // Bordas nas pontas da região ficariam paradas enquanto tudo anda
+    if (lv_obj_get_style_border_width(obj, LV_PART_MAIN) > 0 &&
+        lv_obj_get_style_border_opa(obj, LV_PART_MAIN) > LV_OPA_TRANSP) {
+        lv_border_side_t ends = axis_x ? (LV_BORDER_SIDE_LEFT | LV_BORDER_SIDE_RIGHT)
+                                       : (LV_BORDER_SIDE_TOP | LV_BORDER_SIDE_BOTTOM);
+        if (lv_obj_get_style_border_side(obj, LV_PART_MAIN) & ends) return false;
+    }
+
+    uint32_t count = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < count; i++) {
+        if (lv_obj_has_flag(lv_obj_get_child(obj, i), LV_OBJ_FLAG_FLOATING)) return false;
+    }
+
+    // Área visível: cortada pelos pais e pela tela, com o eixo cruzado inteiro
+    lv_area_t area = obj->coords;
+    for (lv_obj_t* par = lv_obj_get_parent(obj); par; par = lv_obj_get_parent(par)) {
+        if (!_lv_area_intersect(&area, &area, &par->coords)) return false;
+    }
+    lv_area_t screen;
+    lv_area_set(&screen, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+    if (!_lv_area_intersect(&area, &area, &screen)) return false;
+    if (axis_x ? (area.y1 != 0 || area.y2 != cross - 1) : (area.x1 != 0 || area.x2 != cross - 1)) return false;
+
+    // Nada desenhado depois dele em cima da região
+    for (lv_obj_t* o = obj; lv_obj_get_parent(o); o = lv_obj_get_parent(o)) {
+        lv_obj_t* par = lv_obj_get_parent(o);
+        uint32_t siblings = lv_obj_get_child_cnt(par);
+        for (uint32_t i = lv_obj_get_index(o) + 1; i < siblings; i++) {
+            if (draws_over(lv_obj_get_child(par, i), &area)) return false;
+        }
+    }
+    if (layer_draws_over(disp->top_layer, &area) || layer_draws_over(disp->sys_layer, &area)) return false;
+
+    *visible = area;
+    return true;
+}
+
+/**
+ * Invalida a parte de `area` dentro de `visible` (a área de `obj` na tela),
+ * sem a margem de 5 px do lv_obj_invalidate_area(): a faixa fica exata.
+ */
+void invalidate(lv_obj_t* obj, const lv_area_t* area, const lv_area_t* visible) {
+    lv_area_t a;
+    if (!_lv_area_intersect(&a, area, visible)) return;
+#if LV_USE_RENDER_CACHE
+    _lv_obj_render_cache_invalidate_area(obj, &a);
+#endif
+    _lv_inv_area(lv_obj_get_disp(obj), &a);
+}
+
+bool fallback() {
+    counters.fallback++;
+    return false;
+}
+
+} // namespace
+
+extern "C" bool tft_scroll_lvgl(lv_obj_t* obj, lv_coord_t dx, lv_coord_t dy) {
+    if (!active) return false;
+    lv_coord_t d = axis_x ? dx : dy;
+    if ((axis_x ? dy : dx) != 0) return fallback();
+
+    lv_area_t visible;
+    if (!eligible(obj, &visible)) return fallback();
+    lv_coord_t a1 = axis1(visible);
+    lv_coord_t a2 = axis2(visible);
+    lv_coord_t len = a2 - a1 + 1;
+
+    Region r = {LV_MIN(line(a1), line(a2)), len, 0};
+    if (r.tfa != next.tfa || r.vsa != next.vsa) {
+        // Outra região: a antiga volta ao início e é redesenhada inteira; a
+        // nova passa a valer no próximo quadro
+        if (next.off) {
+            lv_area_t old = region_area(next);
+            lv_obj_invalidate_area(lv_obj_get_screen(obj), &old);
+        }
+        next = r;
+        return fallback();
+    }
+    if (cur.tfa != next.tfa || cur.vsa != next.vsa) return fallback(); // VSCRDEF ainda não foi
+
+    // O buffer das janelas em colunas só é reservado no primeiro passo feito no painel
+    if (axis_x && !columns) {
+        columns = (lv_color_t*)ps_malloc((size_t)lines * cross * sizeof(lv_color_t));
+        if (!columns) {
+            pda_log(PDA_LOG_SYSTEM, PDA_LOG_WARN, "TftScroll: no memory for the column buffer");
+            return fallback();
+        }
+    }
+
+    // Os pixels que ainda iam ser redesenhados andaram junto com o conteúdo
+    lv_disp_t* disp = lv_obj_get_disp(obj);
+    uint16_t pending = disp->inv_p;
+    for (uint16_t i = 0; i < pending; i++) {
+        lv_area_t a;
+        if (!_lv_area_intersect(&a, &disp->inv_areas[i], &visible)) continue;
+        shift(&a, d);
+        invalidate(obj, &a, &visible);
+    }
+
+    lv_coord_t step = mirrored ? -d : d;
+    next.off = ((next.off - step) % next.vsa + next.vsa) % next.vsa;
+    moved += d;
+
+    // Faixa descoberta desde o início do quadro
+    lv_area_t strip = visible;
+    lv_coord_t uncovered = LV_MIN(LV_ABS(moved), len);
+    if (moved > 0) set_axis(&strip, a1, a1 + uncovered - 1);
+    else set_axis(&strip, a2 - uncovered + 1, a2);
+    if (uncovered) invalidate(obj, &strip, &visible);
+
+    // Barras de rolagem: a que corre ao longo do eixo muda em toda a região; a
+    // outra fica parada e a cópia dela andou com o conteúdo
+    lv_area_t hor, ver;
+    lv_obj_get_scrollbar_area(obj, &hor, &ver);
+    lv_area_t& along = axis_x ? hor : ver;
+    lv_area_t& across = axis_x ? ver : hor;
+    if (lv_area_get_width(&along) > 0 && lv_area_get_height(&along) > 0) {
+        set_axis(&along, a1, a2);
+        invalidate(obj, &along, &visible);
+    }
+    if (lv_area_get_width(&across) > 0 && lv_area_get_height(&across) > 0) {
+        invalidate(obj, &across, &visible);
+        shift(&across, d);
+        invalidate(obj, &across, &visible);
+    }
+
+    counters.accelerated++;
+    return true;
+}
+
+namespace TftScroll {
+
+void begin(uint8_t rotation, lv_coord_t hor_res, lv_coord_t ver_res) {
+    axis_x = rotation & 1;
+    mirrored = rotation >= 2;
+    lines = axis_x ? hor_res : ver_res;
+    cross = axis_x ? ver_res : hor_res;
+    cur = next = Region{0, lines, 0};
+    moved = 0;
+    ready = true;
+#if TFT_SCROLL_ENABLE
+    set_enabled(true);
+#endif
+}
+
+void set_enabled(bool enabled) {
+    if (!enabled && next.off) {
+        lv_area_t area = region_area(next);
+        lv_obj_invalidate_area(lv_scr_act(), &area);
+        next.off = 0;
+    }
+    active = enabled && ready;
+}
+
+bool enabled() {
+    return active;
+}
+
+void frame_begin() {
+    if (next.tfa != cur.tfa || next.vsa != cur.vsa) define_dirty = true;
+    if (define_dirty || next.off != cur.off) start_dirty = true;
+    cur = next;
+    moved = 0;
+}
+
+uint8_t map(const lv_area_t* area, lv_color_t* pixels, Piece* out) {
+    if (cur.off == 0) {
+        out[0] = Piece{*area, pixels};
+        return 1;
+    }
+
+    // Corta a área onde a coordenada na GRAM deixa de seguir a da tela
+    lv_coord_t a1 = axis1(*area);
+    lv_coord_t a2 = axis2(*area);
+    lv_coord_t from[TFT_SCROLL_PIECES];
+    uint8_t n = 0;
+    lv_coord_t start = a1;
+    lv_coord_t start_target = target(a1);
+    for (lv_coord_t a = a1 + 1; a <= a2 + 1; a++) {
+        lv_coord_t t = a <= a2 ? target(a) : 0;
+        if (a <= a2 && t == start_target + (a - start)) continue;
+        LV_ASSERT(n < TFT_SCROLL_PIECES);
+        out[n].area = *area;
+        set_axis(&out[n].area, start_target, start_target + (a - 1 - start));
+        from[n++] = start;
+        start = a;
+        start_target = t;
+    }
+
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t h = lv_area_get_height(area);
+    if (!axis_x) {
+        for (uint8_t i = 0; i < n; i++) out[i].pixels = pixels + (uint32_t)(from[i] - a1) * w;
+    } else if (n == 1) {
+        out[0].pixels = pixels;
+    } else {
+        // Colunas: cada janela vai contígua para o buffer, linha a linha
+        lv_color_t* dst = columns;
+        for (uint8_t i = 0; i < n; i++) {
+            lv_coord_t cols = lv_area_get_width(&out[i].area);
+            const lv_color_t* src = pixels + (from[i] - a1);
+            out[i].pixels = dst;
+            for (lv_coord_t row = 0; row < h; row++) {
+                memcpy(dst, src, cols * sizeof(lv_color_t));
+                dst += cols;
+                src += w;
+            }
+        }
+    }
+    if (n > 1) counters.split_flushes++;
+    return n;
+}
+
+Commands commands() {
+    Commands c = {nullptr, nullptr};
+    if (define_dirty) {
+        put16(&vscrdef[0], cur.tfa);
+        put16(&vscrdef[2], cur.vsa);
+        put16(&vscrdef[4], lines - cur.tfa - cur.vsa);
+        c.vscrdef = vscrdef;
+        define_dirty = false;
+    }
+    if (start_dirty) {
+        put16(vscsad, cur.tfa + cur.off);
+        c.vscsad = vscsad;
+        start_dirty = false;
+    }
+    return c;
+}
+
+Stats stats() {
+    return counters;
+}
+
+} // namespace TftScroll
@@ -0,0 +1,130 @@
+#pragma once
+
+/**
+ * TFT Scroll - Rolagem por hardware do ST7789 (VSCRDEF/VSCSAD)
+ *
+ * Sem ajuda, rolar um container faz o LVGL invalidar o container inteiro: cada
+ * passo redesenha e reenvia toda a área rolável pelo SPI. O ST7789 sabe rolar
+ * sozinho uma faixa das suas 320 linhas (VSCRDEF: área fixa do topo, área de
+ * rolagem, área fixa de baixo) a partir de um ponteiro de início (VSCSAD): o
+ * que já está na GRAM continua lá e só a faixa que aparece precisa ser
+ * desenhada.
+ *
+ * - Glue no LVGL: _lv_obj_scroll_by_raw() chama tft_scroll_lvgl()
+ *   (LV_SCROLL_CUSTOM_INVALIDATE no lv_conf.h) no lugar do lv_obj_invalidate().
+ *   Quando o container é elegível, o ponteiro anda o passo da rolagem e só a
+ *   faixa descoberta e as barras de rolagem são invalidadas. As áreas que já
+ *   estavam pendentes dentro dele são invalidadas de novo na posição para onde
+ *   os pixels antigos foram.
+ * - Elegível: o container cobre a tela inteira no eixo cruzado (com a área
+ *   visível, depois do corte dos pais), rola só no eixo das linhas do painel,
+ *   tem fundo opaco e igual ao longo desse eixo (sem imagem, borda nas pontas,
+ *   raio ou transformação), nenhum filho flutuante e nada desenhado por cima
+ *   (irmãos depois dele, layer_top/layer_sys). Todo o resto volta ao caminho de
+ *   sempre, e qualquer desenho continua certo: o flush remapeia as coordenadas.
+ * - Remapeamento: com o ponteiro fora do zero, uma linha visível da região
+ *   mora em outra linha da GRAM. map() traduz a área do flush em até
+ *   TFT_SCROLL_PIECES janelas; com o eixo em X (paisagem) as colunas de cada
+ *   janela são copiadas para um buffer contíguo (PSRAM, uma tela), reservado
+ *   só no primeiro passo feito no painel.
+ * - Os comandos vão no fim do último flush do quadro, depois dos pixels da
+ *   faixa, pelo mesmo SpiBus: commands() entrega os bytes ao driver.
+ *
+ * O eixo das linhas é o eixo de 320 pixels do painel. Na rotação 1 do T-Deck
+ * (paisagem) ele é o X da tela: só containers com a altura toda rolando na
+ * horizontal são acelerados. As listas verticais (Notes, Calendar, Wi-Fi) usam
+ * o refresh parcial, que já envia só o container.
+ *
+ * Este header também é incluído pelo LVGL (lv_obj_scroll.c), por isso o glue é em C.
+ *
+ * 🎞️ Exemplo de uso:
+ *
+ * // DisplayTouch::init(), depois do setRotation()
+ * TftScroll::begin(1, TFT_HEIGHT, TFT_WIDTH);
+ * TftScroll::set_enabled(true);   // Sem TFT_SCROLL_ENABLE
+ *
+ * // disp_flush()
+ * TftScroll::Piece pieces[TFT_SCROLL_PIECES];
+ * uint8_t n = TftScroll::map(area, color_p, pieces);
+ * for (uint8_t i = 0; i < n; i++) send_window(pieces[i].area, pieces[i].pixels);
+ * if (lv_disp_flush_is_last(drv)) send_commands(TftScroll::commands());
+ */
+
+#include <lvgl.h>
+
+/*Liga a aceleração no begin(). Desligada: nenhum container dos apps é elegível
+  hoje (as listas rolam no eixo de 240 pixels); o set_enabled() liga depois*/
+#ifndef TFT_SCROLL_ENABLE
+#define TFT_SCROLL_ENABLE 0
+#endif
+
+/*Máximo de janelas de um flush: área fixa, região em dois pedaços e a outra área fixa*/
+#define TFT_SCROLL_PIECES 4
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Glue do _lv_obj_scroll_by_raw(): `obj` acabou de rolar (dx, dy).
+ * Retorna true quando a rolagem foi feita no painel e as áreas já foram invalidadas.
+ */
+bool tft_scroll_lvgl(lv_obj_t * obj, lv_coord_t dx, lv_coord_t dy);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+
+namespace TftScroll {
+
+struct Piece {
+    lv_area_t area;             // Janela na GRAM (coordenadas do CASET/RASET)
+    lv_color_t* pixels;         // Pixels da janela, linha a linha (o driver pode reescrevê-los)
+};
+
+struct Commands {
+    const uint8_t* vscrdef;     // 6 bytes do VSCRDEF (0x33), ou nullptr
+    const uint8_t* vscsad;      // 2 bytes do VSCSAD (0x37), ou nullptr
+};
+
+struct Stats {
+    uint32_t accelerated;       // Passos de rolagem feitos no painel
+    uint32_t fallback;          // Passos com o container inteiro invalidado
+    uint32_t split_flushes;     // Flushes que viraram mais de uma janela
+};
+
+/**
+ * @brief Prepara a aceleração para o display `hor_res` x `ver_res` na `rotation`
+ * do TFT_eSPI, e a liga com TFT_SCROLL_ENABLE.
+ */
+void begin(uint8_t rotation, lv_coord_t hor_res, lv_coord_t ver_res);
+
+/**
+ * @brief Liga ou desliga a aceleração. Desligar volta o ponteiro ao início da
+ * região e invalida a região, se ela estava rolada.
+ */
+void set_enabled(bool enabled);
+bool enabled();
+
+/**
+ * @brief Início do quadro (render_start_cb): a rolagem pendente passa a valer
+ * para os flushes deste quadro.
+ */
+void frame_begin();
+
+/**
+ * @brief Traduz a área do flush para janelas na GRAM. Retorna quantas.
+ * Os pixels podem apontar para o buffer interno até o próximo map().
+ */
+uint8_t map(const lv_area_t* area, lv_color_t* pixels, Piece* out);
+
+/**
+ * @brief Comandos pendentes do quadro, para o fim do último flush. Os bytes
+ * ficam válidos até o próximo quadro.
+ */
+Commands commands();
+
+Stats stats();
+
+} // namespace TftScroll
+
+#endif /*__cplusplus*/
@@ -1,11 +1,13 @@
 #include "utils.h"
 #include <WiFi.h>
 #include <time.h>
+#include "system/stall_detector.h"
 
 namespace Utils {
 
 void initTimeSync()
 {
+    STALL_SITE("Utils::initTimeSync");
     configTime(0, 0, "pool.ntp.org", "time.nist.gov");
     // Wait for time to be set
     time_t now = time(nullptr);
@@ -0,0 +1,302 @@
+"""
+Relatório de alocações por call site a partir do rastreio do PDA
+
+Lê o fluxo da USB CDC gravado com -DALLOC_TRACE=1 (src/system/alloc_trace.h),
+casa cada alocação com sua liberação e agrupa por call site:
+
+- Churn: alocações, bytes e tempo de vida por site; "curtas" são as que
+  viveram menos de --short-ms (padrão: um quadro de 16 ms).
+- Vazamentos: blocos ainda vivos no fim da captura, por site.
+- Crescimento por volta: a memória viva em cada marca --home (padrão
+  "MainMenu", a volta ao menu) e os sites cuja memória viva mais cresceu entre
+  a primeira e a última volta. Abra e feche cada app muitas vezes (no aparelho
+  ou com tools/simulator/traces/app_cycle.trace) para o sinal aparecer.
+- Por app: alocações por visita entre as marcas de AllocTrace::mark().
+
+O call site de uma alocação é o primeiro endereço do backtrace no código do
+projeto (src/, ver --project): a linha do app que criou a tela, a String ou o
+JsonDocument. Se o backtrace não chega lá, é o primeiro endereço fora de um
+alocador ou do encanamento dele (malloc, String, lv_mem_*, ArduinoJson,
+std::...; ver --skip), marcado com "[lib]". Isso exige símbolos: passe --elf
+com o firmware.elf (o addr2line do toolchain precisa estar no PATH ou em
+--addr2line). Sem --elf o site é o endereço de quem chamou o alocador.
+
+Uso:
+  python tools/alloc_trace/alloc_report.py --port /dev/ttyACM0 --seconds 120 \\
+      --raw-out alloc.bin --elf .pio/build/T-Deck/firmware.elf
+  python tools/alloc_trace/alloc_report.py alloc.bin --elf .pio/build/T-Deck/firmware.elf
+
+Reaproveita a leitura da porta e a separação de quadros do
+tools/trace/trace2perfetto.py (mesmo formato de quadro).
+"""
+
+import argparse
+import os
+import re
+import struct
+import subprocess
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "trace"))
+from trace2perfetto import read_port, split_stream  # noqa: E402
+
+FRAME_RECORDS = 16
+FRAME_LABEL = 17
+FRAME_DROPPED = 18
+
+OP_ALLOC, OP_FREE, OP_MARK = 0, 1, 2
+KINDS = {0: "malloc", 1: "heap_caps", 2: "lvgl", 3: "json"}
+
+HEADER = struct.Struct("<IIIBBBB")  # alloc_trace_record_t sem os pcs
+
+# Funções que só repassam o pedido de memória: o site é quem chamou a primeira fora delas
+DEFAULT_SKIP = (r"^(malloc|calloc|realloc|free|_?_?wrap_|__real_|heap_caps_|operator new|operator delete"
+                r"|ps_(malloc|calloc|realloc)|String::|lv_mem_|pda_mem_|_lv_mem_|ArduinoJson::|AllocTrace::|std::|__gnu_cxx::"
+                r"|strdup|_strdup_r|__ssprint_r|_svfprintf_r|vasprintf|_vasprintf_r|\(anonymous namespace\)::JsonAllocator)")
+
+
+class Site:
+    __slots__ = ("name", "kinds", "allocs", "bytes", "frees", "short", "life_us", "live_blocks", "live_bytes",
+                 "failed", "home_first", "home_last")
+
+    def __init__(self, name):
+        self.name = name
+        self.kinds = set()
+        self.allocs = 0
+        self.bytes = 0
+        self.frees = 0
+        self.short = 0
+        self.life_us = 0
+        self.live_blocks = 0
+        self.live_bytes = 0
+        self.failed = 0
+        self.home_first = None
+        self.home_last = 0
+
+
+def parse(frames, depth):
+    """Retorna (registros em ordem, rótulos por id, descartados)."""
+    size = HEADER.size + 4 * depth
+    labels = {}
+    dropped = 0
+    records = []
+    for ftype, payload in frames:
+        if ftype == FRAME_LABEL and len(payload) >= 4:
+            labels[struct.unpack_from("<I", payload)[0]] = payload[4:].decode("utf-8", "replace")
+        elif ftype == FRAME_DROPPED and len(payload) == 4:
+            dropped += struct.unpack_from("<I", payload)[0]
+        elif ftype == FRAME_RECORDS:
+            if len(payload) % size:
+                sys.exit("quadro de %d bytes não é múltiplo de %d: confira --depth (ALLOC_TRACE_DEPTH)"
+                         % (len(payload), size))
+            for off in range(0, len(payload), size):
+                ts, ptr, nbytes, op, kind, _core, n = HEADER.unpack_from(payload, off)
+                pcs = struct.unpack_from("<%dI" % depth, payload, off + HEADER.size)[:n]
+                records.append((ts, ptr, nbytes, op, kind, pcs))
+    return records, labels, dropped
+
+
+def symbolize(pcs, elf, addr2line):
+    """{pc: (função, caminho, linha)} com o addr2line, em lote."""
+    if not elf or not pcs:
+        return {}
+    pcs = sorted(pcs)
+    try:
+        out = subprocess.run([addr2line, "-f", "-C", "-e", elf] + ["0x%x" % pc for pc in pcs],
+                             capture_output=True, text=True, check=True).stdout.splitlines()
+    except (OSError, subprocess.CalledProcessError) as e:
+        sys.exit("addr2line falhou (%s); informe --addr2line" % e)
+    result = {}
+    for i, pc in enumerate(pcs):
+        func = out[2 * i] if 2 * i < len(out) else "??"
+        where = out[2 * i + 1] if 2 * i + 1 < len(out) else "??:0"
+        path, _, line = where.split(" (discriminator")[0].rpartition(":")
+        result[pc] = (func, path, line)
+    return result
+
+
+def site_name(pcs, symbols, skip, project):
+    if not pcs:
+        return "(sem backtrace)"
+    if not symbols:
+        return "0x%08x" % pcs[0]
+    frames = [symbols.get(pc, ("??", "??", "0")) for pc in pcs]
+    for func, path, line in frames:
+        if project.search(path) and not skip.match(func):
+            return "%s (%s:%s)" % (func, os.path.basename(path), line)
+    for func, path, line in frames:
+        if func != "??" and not skip.match(func):
+            return "%s (%s:%s) [lib]" % (func, os.path.basename(path), line)
+    return "%s (%s:%s) [backtrace curto]" % (frames[-1][0], os.path.basename(frames[-1][1]), frames[-1][2])
+
+
+def analyze(records, labels, symbols, skip, project, short_us, home):
+    sites = {}
+    live = {}        # ptr -> (ts, size, site)
+    live_total = 0
+    unknown_frees = 0
+    homes = []       # memória viva rastreada em cada marca --home
+    apps = {}        # rótulo -> [visitas, alocações, bytes]
+    current = None
+    site_cache = {}
+    last_ts = None
+    wraps = 0
+
+    for ts, ptr, nbytes, op, kind, pcs in records:
+        # Desenrola o micros() de 32 bits
+        if last_ts is not None and ts < last_ts and last_ts - ts > 0x80000000:
+            wraps += 1
+        last_ts = ts
+        ts += wraps << 32
+
+        if op == OP_MARK:
+            current = labels.get(ptr, "#%d" % ptr)
+            app = apps.setdefault(current, [0, 0, 0])
+            app[0] += 1
+            if current == home:
+                homes.append(live_total)
+                for s in sites.values():
+                    if s.home_first is None:
+                        s.home_first = s.live_bytes
+                    s.home_last = s.live_bytes
+            continue
+
+        if op == OP_ALLOC:
+            name = site_cache.get(pcs)
+            if name is None:
+                name = site_cache[pcs] = site_name(pcs, symbols, skip, project)
+            s = sites.get(name)
+            if s is None:
+                s = sites[name] = Site(name)
+                s.home_first = 0 if homes else None
+            s.kinds.add(KINDS.get(kind, str(kind)))
+            if not ptr:
+                s.failed += 1
+                continue
+            s.allocs += 1
+            s.bytes += nbytes
+            s.live_blocks += 1
+            s.live_bytes += nbytes
+            live_total += nbytes
+            old = live.pop(ptr, None)
+            if old:  # Liberação perdida (anel cheio): não conta duas vezes
+                live_total -= old[1]
+                old[2].live_blocks -= 1
+                old[2].live_bytes -= old[1]
+            live[ptr] = (ts, nbytes, s)
+            if current is not None:
+                apps[current][1] += 1
+                apps[current][2] += nbytes
+        elif op == OP_FREE:
+            entry = live.pop(ptr, None)
+            if entry is None:
+                unknown_frees += 1  # Alocado antes do begin()
+                continue
+            start, nbytes, s = entry
+            life = ts - start
+            s.frees += 1
+            s.life_us += life
+            if life < short_us:
+                s.short += 1
+            s.live_blocks -= 1
+            s.live_bytes -= nbytes
+            live_total -= nbytes
+
+    return sites, apps, homes, unknown_frees, live_total
+
+
+def kb(n):
+    return "%.1f" % (n / 1024.0)
+
+
+def print_report(sites, apps, homes, unknown_frees, live_total, args, nrecords, dropped):
+    top = args.top
+    print("%d registros, %d sites, %d liberações de blocos anteriores ao begin()" %
+          (nrecords, len(sites), unknown_frees))
+    if dropped:
+        print("aviso: %d registros descartados (anel cheio; chame AllocTrace::drain() mais vezes ou aumente "
+              "ALLOC_TRACE_RING): os vazamentos podem ser falsos" % dropped)
+
+    print("\n== Churn (por número de alocações) ==")
+    print("%8s %9s %7s %10s %8s  %s" % ("allocs", "KB", "curtas", "vida méd", "falhas", "site"))
+    for s in sorted(sites.values(), key=lambda s: s.allocs, reverse=True)[:top]:
+        life = "%.1f ms" % (s.life_us / s.frees / 1000.0) if s.frees else "-"
+        short = "%d%%" % (100 * s.short // s.frees) if s.frees else "-"
+        print("%8d %9s %7s %10s %8d  %s [%s]" % (s.allocs, kb(s.bytes), short, life, s.failed, s.name,
+                                                 ",".join(sorted(s.kinds))))
+
+    print("\n== Vivos no fim da captura ==")
+    print("%8s %9s  %s" % ("blocos", "KB", "site"))
+    leaks = [s for s in sites.values() if s.live_blocks > 0]
+    for s in sorted(leaks, key=lambda s: s.live_bytes, reverse=True)[:top]:
+        print("%8d %9s  %s [%s]" % (s.live_blocks, kb(s.live_bytes), s.name, ",".join(sorted(s.kinds))))
+    print("total vivo rastreado: %s KB" % kb(live_total))
+
+    if len(homes) >= 2:
+        cycles = len(homes) - 1
+        print("\n== Crescimento por volta ao %s (%d voltas) ==" % (args.home, cycles))
+        print("vivo na 1a volta: %s KB, na última: %s KB, %+.0f bytes/volta" %
+              (kb(homes[0]), kb(homes[-1]), (homes[-1] - homes[0]) / float(cycles)))
+        growing = [s for s in sites.values() if s.home_first is not None and s.home_last > s.home_first]
+        for s in sorted(growing, key=lambda s: s.home_last - s.home_first, reverse=True)[:top]:
+            print("%+10.0f bytes/volta  %s [%s]" % ((s.home_last - s.home_first) / float(cycles), s.name,
+                                                    ",".join(sorted(s.kinds))))
+    elif args.home:
+        print("\n(menos de duas marcas '%s': sem crescimento por volta)" % args.home)
+
+    if apps:
+        print("\n== Por app (entre marcas) ==")
+        print("%-12s %7s %11s %11s" % ("app", "visitas", "allocs/vis", "KB/visita"))
+        for name, (visits, n, nbytes) in sorted(apps.items(), key=lambda a: a[1][2], reverse=True):
+            print("%-12s %7d %11.0f %11s" % (name, visits, n / float(visits), kb(nbytes / float(visits))))
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Relatório de churn e vazamentos por call site do rastreio de alocações.")
+    ap.add_argument("input", nargs="?", help="captura crua da USB CDC")
+    ap.add_argument("--port", help="lê direto da porta serial (ex: /dev/ttyACM0, COM5)")
+    ap.add_argument("--seconds", type=float, default=60.0, help="duração da captura com --port")
+    ap.add_argument("--baud", type=int, default=115200, help="ignorado pela USB CDC, usado por UARTs")
+    ap.add_argument("--raw-out", help="também grava os bytes crus lidos da porta")
+    ap.add_argument("--log", help="grava o texto do Serial neste arquivo (padrão: descartado)")
+    ap.add_argument("--elf", help="firmware.elf para dar nome aos sites")
+    ap.add_argument("--addr2line", default="xtensa-esp32s3-elf-addr2line", help="addr2line do toolchain")
+    ap.add_argument("--depth", type=int, default=8, help="ALLOC_TRACE_DEPTH do firmware")
+    ap.add_argument("--skip", default=DEFAULT_SKIP, help="regex das funções que não contam como site")
+    ap.add_argument("--project", default=r"^(?!.*(^|/)(lib|\.pio|packages)/).*(^|/)src/",
+                    help="regex do caminho dos fontes do projeto (fora de lib/ e dos pacotes)")
+    ap.add_argument("--short-ms", type=float, default=16.0, help="vida abaixo disto conta como curta")
+    ap.add_argument("--home", default="MainMenu", help="marca que fecha uma volta (crescimento por volta)")
+    ap.add_argument("--top", type=int, default=20, help="linhas por tabela")
+    args = ap.parse_args()
+
+    if args.port:
+        data = read_port(args.port, args.seconds, args.baud)
+        if args.raw_out:
+            with open(args.raw_out, "wb") as f:
+                f.write(data)
+    elif args.input:
+        with open(args.input, "rb") as f:
+            data = f.read()
+    else:
+        ap.error("informe um arquivo de captura ou --port")
+
+    frames, text, bad = split_stream(data)
+    if args.log:
+        with open(args.log, "wb") as f:
+            f.write(text)
+    if bad:
+        print("aviso: %d quadros com soma errada foram ignorados" % bad)
+
+    records, labels, dropped = parse(frames, args.depth)
+    pcs = set()
+    for r in records:
+        if r[3] == OP_ALLOC:
+            pcs.update(r[5])
+    symbols = symbolize(pcs, args.elf, args.addr2line)
+    result = analyze(records, labels, symbols, re.compile(args.skip), re.compile(args.project), args.short_ms * 1000, args.home)
+    print_report(*result, args=args, nrecords=len(records), dropped=dropped)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,253 @@
+"""
+Empacotador de assets
+
+Monta o pacote gravado na partição "assets" (ver partitions.csv) e lido em
+tempo de execução por src/system/asset_pack.h via esp_partition_mmap.
+
+Conteúdo:
+- Ícones pré-escalados (tools/icons/prescale_icons.py) em RGB565A8.
+- Qualquer arquivo da pasta assets/ na raiz do projeto (ex: fontes .bin do
+  lv_font_conv), com o caminho relativo como nome.
+
+Cada entrada é comprimida com LZ4 (formato de bloco) e guardada sem compressão
+quando isso não economiza espaço.
+
+Formato (little-endian):
+  Cabeçalho (16 bytes): "PDAP", versão u16, quantidade u16, tamanho total u32, reservado u32
+  Índice: quantidade x 48 bytes, ordenado por nome:
+    nome[28] (terminado em zero), tipo u8, codec u8, cf u8, flags u8,
+    largura u16, altura u16, offset u32, tamanho u32, tamanho descomprimido u32
+  Dados: cada entrada alinhada em 4 bytes.
+
+Uso:
+- Automático no build (extra_scripts = pre:tools/assets/pack_assets.py): gera
+  .pio/build/<env>/assets.bin quando algo mudou e registra o alvo
+  "upload_assets":  pio run -t upload_assets
+- À mão: python tools/assets/pack_assets.py [saida.bin]
+  (mostra o tamanho e a taxa de compressão de cada entrada)
+"""
+
+import os
+import struct
+import sys
+import time
+
+MAGIC = b"PDAP"
+VERSION = 1
+HEADER_FMT = "<4sHHII"
+ENTRY_FMT = "<28sBBBBHHIII"
+NAME_MAX = 27
+
+TYPE_IMAGE = 0
+TYPE_BLOB = 1
+
+CODEC_RAW = 0
+CODEC_LZ4 = 1
+
+LV_IMG_CF_RGB565A8 = 20   # Valor de LV_IMG_CF_RGB565A8 no LVGL 8
+PARTITION_NAME = "assets"
+
+
+def lz4_compress(data):
+    """Compressor LZ4 (formato de bloco) simples, guloso, com tabela de hash."""
+    n = len(data)
+    out = bytearray()
+
+    def write_len(v):
+        while v >= 255:
+            out.append(255)
+            v -= 255
+        out.append(v)
+
+    def emit(literals, offset=0, match_len=0):
+        lit = len(literals)
+        token = (min(lit, 15) << 4) | (min(match_len - 4, 15) if match_len else 0)
+        out.append(token)
+        if lit >= 15:
+            write_len(lit - 15)
+        out.extend(literals)
+        if match_len:
+            out.extend(struct.pack("<H", offset))
+            if match_len - 4 >= 15:
+                write_len(match_len - 4 - 15)
+
+    table = {}
+    anchor = 0
+    i = 0
+    limit = n - 12          # A última sequência começa ao menos 12 bytes antes do fim
+    while i < limit:
+        key = data[i:i + 4]
+        cand = table.get(key)
+        table[key] = i
+        if cand is None or i - cand > 0xFFFF:
+            i += 1
+            continue
+        m = 4
+        max_len = n - 5 - i  # Os últimos 5 bytes são sempre literais
+        while m < max_len and data[cand + m] == data[i + m]:
+            m += 1
+        emit(data[anchor:i], i - cand, m)
+        i += m
+        anchor = i
+    emit(data[anchor:])
+    return bytes(out)
+
+
+def lz4_decompress(src, size):
+    """Descompressor de referência, usado para validar o pacote."""
+    out = bytearray()
+    i = 0
+    while i < len(src):
+        token = src[i]
+        i += 1
+        lit = token >> 4
+        if lit == 15:
+            while True:
+                b = src[i]
+                i += 1
+                lit += b
+                if b != 255:
+                    break
+        out += src[i:i + lit]
+        i += lit
+        if i >= len(src):
+            break
+        offset = src[i] | (src[i + 1] << 8)
+        i += 2
+        m = (token & 15) + 4
+        if (token & 15) == 15:
+            while True:
+                b = src[i]
+                i += 1
+                m += b
+                if b != 255:
+                    break
+        start = len(out) - offset
+        for k in range(m):
+            out.append(out[start + k])
+    assert len(out) == size
+    return bytes(out)
+
+
+def collect(project_dir):
+    """Retorna [(nome, tipo, cf, largura, altura, dados)] de tudo que vai no pacote."""
+    sys.path.insert(0, os.path.join(project_dir, "tools", "icons"))
+    import prescale_icons
+
+    entries = []
+    for name, w, h, data in prescale_icons.generate(project_dir):
+        entries.append((name, TYPE_IMAGE, LV_IMG_CF_RGB565A8, w, h, data))
+
+    assets_dir = os.path.join(project_dir, "assets")
+    for root, _, files in os.walk(assets_dir):
+        for f in sorted(files):
+            path = os.path.join(root, f)
+            name = os.path.relpath(path, assets_dir).replace(os.sep, "/")
+            with open(path, "rb") as fp:
+                entries.append((name, TYPE_BLOB, 0, 0, 0, fp.read()))
+    return entries
+
+
+def sources(project_dir):
+    sys.path.insert(0, os.path.join(project_dir, "tools", "icons"))
+    import prescale_icons
+
+    files = [os.path.abspath(__file__), prescale_icons.__file__] + prescale_icons.icon_sources(project_dir)
+    for root, _, names in os.walk(os.path.join(project_dir, "assets")):
+        files += [os.path.join(root, n) for n in names]
+    return files
+
+
+def build(project_dir, out_path, verbose=False):
+    entries = sorted(collect(project_dir), key=lambda e: e[0].encode())
+    index_size = struct.calcsize(HEADER_FMT) + len(entries) * struct.calcsize(ENTRY_FMT)
+
+    index = []
+    blob = bytearray()
+    offset = index_size
+    total_raw = 0
+    for name, kind, cf, w, h, data in entries:
+        if len(name.encode()) > NAME_MAX:
+            raise ValueError("asset name too long (max %d): %s" % (NAME_MAX, name))
+        t0 = time.perf_counter()
+        packed = lz4_compress(data)
+        codec = CODEC_LZ4
+        if len(packed) >= len(data):
+            packed, codec = data, CODEC_RAW
+        elif lz4_decompress(packed, len(data)) != data:
+            raise RuntimeError("LZ4 round trip failed for %s" % name)
+        if verbose:
+            print("%-28s %7d -> %7d (%5.1f%%) %s %.0f ms" % (
+                name, len(data), len(packed), 100.0 * len(packed) / max(len(data), 1),
+                "lz4" if codec == CODEC_LZ4 else "raw", (time.perf_counter() - t0) * 1000))
+
+        pad = (-offset) % 4
+        blob += b"\0" * pad
+        offset += pad
+        index.append(struct.pack(ENTRY_FMT, name.encode(), kind, codec, cf, 0, w, h,
+                                 offset, len(packed), len(data)))
+        blob += packed
+        offset += len(packed)
+        total_raw += len(data)
+
+    header = struct.pack(HEADER_FMT, MAGIC, VERSION, len(entries), offset, 0)
+    os.makedirs(os.path.dirname(os.path.abspath(out_path)), exist_ok=True)
+    with open(out_path + ".tmp", "wb") as f:
+        f.write(header)
+        f.write(b"".join(index))
+        f.write(blob)
+    os.replace(out_path + ".tmp", out_path)
+    print("pack_assets: %d entries, %d -> %d bytes (%s)" % (len(entries), total_raw, offset, out_path))
+    return offset
+
+
+def partition_offset(project_dir, name=PARTITION_NAME):
+    """Lê o offset e o tamanho da partição no partitions.csv do projeto."""
+    with open(os.path.join(project_dir, "partitions.csv")) as f:
+        for line in f:
+            cols = [c.strip() for c in line.split("#")[0].split(",")]
+            if len(cols) >= 5 and cols[0] == name:
+                return int(cols[3], 0), int(cols[4], 0)
+    raise ValueError("partition '%s' not found in partitions.csv" % name)
+
+
+def is_stale(out_path, inputs):
+    if not os.path.exists(out_path):
+        return True
+    out_time = os.path.getmtime(out_path)
+    return any(os.path.getmtime(p) > out_time for p in inputs)
+
+
+def setup_platformio(env):
+    project_dir = env["PROJECT_DIR"]
+    out_path = os.path.join(env.subst("$BUILD_DIR"), "assets.bin")
+    part_offset, part_size = partition_offset(project_dir)
+
+    if is_stale(out_path, sources(project_dir)):
+        size = build(project_dir, out_path)
+        if size > part_size:
+            sys.stderr.write("pack_assets: pack (%d bytes) does not fit the partition (%d bytes)\n"
+                             % (size, part_size))
+            env.Exit(1)
+
+    def upload_assets(source, target, env):
+        env.AutodetectUploadPort()
+        env.Execute('"$PYTHONEXE" "$UPLOADER" --chip esp32s3 --port "$UPLOAD_PORT" --baud $UPLOAD_SPEED '
+                    'write_flash 0x%X "%s"' % (part_offset, out_path))
+
+    env.AddCustomTarget(
+        name="upload_assets",
+        dependencies=None,
+        actions=[upload_assets],
+        title="Upload assets",
+        description="Grava o pacote de assets na partição 'assets'",
+    )
+
+
+try:
+    Import("env")  # noqa: F821 - definido pelo SCons do PlatformIO
+    setup_platformio(env)  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..")
+        build(root, sys.argv[1] if len(sys.argv) > 1 else os.path.join(root, ".pio", "assets.bin"), verbose=True)
@@ -0,0 +1,259 @@
+/**
+ * RGB565 blend micro-benchmark
+ *
+ * Mede no host os kernels de mistura do LVGL (lv_draw_sw_blend_basic) com e
+ * sem LV_DRAW_SW_WORD_BLEND (dois pixels por palavra de 32 bits), nos casos
+ * que as telas usam:
+ *   overlay 80%  - fundo dos modais (LV_OPA_80) sobre a tela inteira
+ *   select 50%   - contêiner selecionado (LV_OPA_50) de 80x80
+ *   image 50%    - imagem/camada RGB565 com opacidade
+ *   alpha icon   - ícone com canal alfa (máscara) de 64x64
+ *
+ * Antes de medir, compara cada resultado com lv_color_mix() pixel a pixel
+ * (opacidades 0..255, larguras e alinhamentos variados) e sai com erro se
+ * algum pixel for diferente.
+ *
+ * Uso:
+ *   tools/blend_bench/build.sh
+ *   .pio/host/blend_bench [repetições]
+ *   .pio/host/blend_bench_pixel [repetições]
+ */
+
+#include <Arduino.h>
+#include <chrono>
+#include <lvgl.h>
+#include "src/core/lv_refr.h"
+#include "src/draw/sw/lv_draw_sw.h"
+#include "system/pda_mem.h"
+
+namespace {
+
+const int W = 320;
+const int H = 240;
+
+lv_color_t disp_buf[W * H];
+lv_color_t dest[W * H];
+lv_color_t src[W * H];
+lv_color_t expected[W * H];
+lv_opa_t mask[W * H];
+lv_draw_ctx_t* draw_ctx;
+lv_area_t full_area = {0, 0, W - 1, H - 1};
+
+uint32_t rnd_state = 1;
+uint32_t rnd() {
+    rnd_state = rnd_state * 1103515245U + 12345U;
+    return rnd_state >> 8;
+}
+
+void flush_cb(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_p) {
+    (void)area;
+    (void)color_p;
+    lv_disp_flush_ready(drv);
+}
+
+void init_display() {
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+    lv_disp_draw_buf_init(&draw_buf, disp_buf, NULL, W * H);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = W;
+    disp_drv.ver_res = H;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    lv_disp_t* disp = lv_disp_drv_register(&disp_drv);
+
+    // Desenha direto em `dest`, como o lv_refr faz com o buffer do display
+    _lv_refr_set_disp_refreshing(disp);
+    draw_ctx = disp->driver->draw_ctx;
+    draw_ctx->buf = dest;
+    draw_ctx->buf_area = &full_area;
+    draw_ctx->clip_area = &full_area;
+}
+
+double now_ms() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+void fill_random(lv_color_t* buf, int n) {
+    for (int i = 0; i < n; i++) buf[i].full = (uint16_t)rnd();
+}
+
+/*`area` em coordenadas da tela; a imagem e a máscara têm o tamanho de `area`*/
+void blend(const lv_area_t* area, lv_color_t color, const lv_color_t* src_buf, lv_opa_t* mask_buf, lv_opa_t opa) {
+    lv_draw_sw_blend_dsc_t dsc;
+    lv_memset_00(&dsc, sizeof(dsc));
+    dsc.blend_area = area;
+    dsc.src_buf = src_buf;
+    dsc.color = color;
+    dsc.mask_buf = mask_buf;
+    dsc.mask_res = mask_buf ? LV_DRAW_MASK_RES_CHANGED : LV_DRAW_MASK_RES_FULL_COVER;
+    dsc.mask_area = area;
+    dsc.opa = opa;
+    dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    lv_draw_sw_blend_basic(draw_ctx, &dsc);
+}
+
+/*O que o LVGL desenha pixel a pixel com lv_color_mix(), seguindo os mesmos casos de opacidade e máscara*/
+void reference(const lv_area_t* area, lv_color_t color, const lv_color_t* src_buf, const lv_opa_t* mask_buf,
+               lv_opa_t opa) {
+    lv_memcpy(expected, dest, sizeof(dest));
+    int w = lv_area_get_width(area);
+    for (int y = area->y1; y <= area->y2; y++) {
+        for (int x = area->x1; x <= area->x2; x++) {
+            int i = (y - area->y1) * w + (x - area->x1);
+            lv_color_t fg = src_buf ? src_buf[i] : color;
+            lv_color_t* d = &expected[y * W + x];
+            if (mask_buf == NULL) {
+                *d = opa >= LV_OPA_MAX ? fg : lv_color_mix(fg, *d, opa);
+                continue;
+            }
+            lv_opa_t m = mask_buf[i];
+            if (m == LV_OPA_TRANSP) continue;
+            if (opa > LV_OPA_MAX) *d = m == LV_OPA_COVER ? fg : lv_color_mix(fg, *d, m);
+            else *d = lv_color_mix(fg, *d, m >= LV_OPA_MAX ? opa : (opa * m) >> 8);
+        }
+    }
+}
+
+bool check(const char* name, int opa, const lv_area_t* area) {
+    if (memcmp(expected, dest, sizeof(dest)) == 0) return true;
+    for (int i = 0; i < W * H; i++) {
+        if (expected[i].full != dest[i].full) {
+            printf("MISMATCH %s opa %d area %d,%d..%d,%d: px %d,%d expected %04x got %04x\n", name, opa, area->x1,
+                   area->y1, area->x2, area->y2, i % W, i / W, expected[i].full, dest[i].full);
+            break;
+        }
+    }
+    return false;
+}
+
+/*Todas as opacidades, larguras 1..9 e os 4 alinhamentos de destino e origem*/
+bool verify() {
+    int cases = 0;
+    for (int opa = 0; opa <= 255; opa++) {
+        for (int w = 1; w <= 9; w++) {
+            for (int ofs = 0; ofs < 4; ofs++) {
+                lv_area_t area = {(lv_coord_t)(ofs + 3), 2, (lv_coord_t)(ofs + 3 + w - 1), 4};
+                lv_color_t color;
+                color.full = (uint16_t)rnd();
+
+                fill_random(dest, W * H);
+                reference(&area, color, NULL, NULL, opa);
+                blend(&area, color, NULL, NULL, opa);
+                if (!check("fill", opa, &area)) return false;
+
+                // A imagem começa em `src + ofs` para variar o alinhamento da origem
+                fill_random(src, W * H);
+                fill_random(dest, W * H);
+                reference(&area, color, src + ofs, NULL, opa);
+                blend(&area, color, src + ofs, NULL, opa);
+                if (!check("map", opa, &area)) return false;
+
+                for (int i = 0; i < W * H; i++) mask[i] = rnd() % 3 ? (rnd() % 2 ? 0xFF : 0) : (lv_opa_t)rnd();
+                fill_random(dest, W * H);
+                reference(&area, color, src + ofs, mask, opa);
+                blend(&area, color, src + ofs, mask, opa);
+                if (!check("map mask", opa, &area)) return false;
+                cases += 3;
+            }
+        }
+    }
+
+    // Todas as cores de fundo (cabem numa tela de 320x240) contra as opacidades das telas
+    const lv_opa_t opas[] = {LV_OPA_20, LV_OPA_30, LV_OPA_50, LV_OPA_70, LV_OPA_80};
+    for (lv_opa_t opa : opas) {
+        for (int j = 0; j < W * H; j++) dest[j].full = (uint16_t)j;
+        lv_color_t color = lv_color_hex(0x1A5FB4);
+        reference(&full_area, color, NULL, NULL, opa);
+        blend(&full_area, color, NULL, NULL, opa);
+        if (!check("fill all colors", opa, &full_area)) return false;
+        cases++;
+    }
+    printf("verified %d cases: same pixels as lv_color_mix()\n", cases);
+    return true;
+}
+
+/*O destino é preparado de novo a cada repetição: o overlay repetido deixaria a tela lisa*/
+double bench(int reps, void (*setup)(), void (*run)()) {
+    double total = 0;
+    for (int i = 0; i < reps; i++) {
+        setup();
+        double start = now_ms();
+        run();
+        total += now_ms() - start;
+    }
+    return total / reps;
+}
+
+lv_area_t select_area = {120, 80, 199, 159};
+lv_area_t icon_area = {128, 88, 191, 151};
+
+void setup_busy() {
+    // Conteúdo variado (textos, ícones): poucos pixels vizinhos iguais
+    rnd_state = 1;
+    fill_random(dest, W * H);
+    fill_random(src, W * H);
+}
+
+void setup_icon() {
+    setup_busy();
+    // Ícone redondo: dentro opaco, borda anti-aliased, fora transparente
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 64; x++) {
+            int dx = x - 32, dy = y - 32;
+            int d2 = dx * dx + dy * dy;
+            mask[y * 64 + x] = d2 < 28 * 28 ? 0xFF : d2 < 31 * 31 ? (lv_opa_t)(255 - (d2 - 784) * 255 / 177) : 0;
+        }
+    }
+}
+
+void setup_plain() {
+    lv_color_fill(dest, lv_color_hex(0xF0F0F0), W * H);
+}
+
+void run_overlay() {
+    blend(&full_area, lv_color_hex(0x101418), NULL, NULL, LV_OPA_80);
+}
+
+void run_select() {
+    blend(&select_area, lv_color_hex(0x1A5FB4), NULL, NULL, LV_OPA_50);
+}
+
+void run_image() {
+    blend(&full_area, lv_color_black(), src, NULL, LV_OPA_50);
+}
+
+void run_icon() {
+    blend(&icon_area, lv_color_black(), src, mask, LV_OPA_COVER);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int reps = argc > 1 ? atoi(argv[1]) : 500;
+    if (reps < 1) reps = 1;
+
+    lv_init();
+    init_display();
+
+    printf("LV_DRAW_SW_WORD_BLEND %d\n", LV_DRAW_SW_WORD_BLEND);
+    if (!verify()) return 1;
+
+    struct Case {
+        const char* name;
+        void (*setup)();
+        void (*run)();
+    };
+    const Case cases[] = {{"overlay 80% (busy)", setup_busy, run_overlay},
+                          {"overlay 80% (plain)", setup_plain, run_overlay},
+                          {"select 50% (busy)", setup_busy, run_select},
+                          {"image 50%", setup_busy, run_image},
+                          {"alpha icon", setup_icon, run_icon}};
+
+    for (const Case& c : cases) {
+        double ms = bench(reps, c.setup, c.run);
+        printf("%-22s %8.4f ms\n", c.name, ms);
+    }
+    return 0;
+}
@@ -0,0 +1,34 @@
+#!/bin/sh
+# Compila o micro-benchmark de mistura RGB565 para o host (gcc/g++ do sistema).
+# Gera .pio/host/blend_bench (LV_DRAW_SW_WORD_BLEND do lv_conf.h) e
+# .pio/host/blend_bench_pixel (o mesmo LVGL com lv_draw_sw_blend.c pixel a pixel).
+# Uso: tools/blend_bench/build.sh   (a partir da raiz do projeto)
+set -e
+
+OUT=.pio/host/blend_bench.obj
+PIXEL=.pio/host/blend_bench_pixel.conf
+mkdir -p "$OUT" "$PIXEL"
+
+sed 's/^#define LV_DRAW_SW_WORD_BLEND .*/#define LV_DRAW_SW_WORD_BLEND 0/' lib/lv_conf.h > "$PIXEL/lv_conf.h.new"
+# Só troca o arquivo se mudou, para não recompilar a cada build
+cmp -s "$PIXEL/lv_conf.h.new" "$PIXEL/lv_conf.h" || mv "$PIXEL/lv_conf.h.new" "$PIXEL/lv_conf.h"
+rm -f "$PIXEL/lv_conf.h.new"
+
+FLAGS="-O2 -DLV_CONF_INCLUDE_SIMPLE -DARDUINOJSON_ENABLE_ARDUINO_STRING=1 -Ilib -Ilib/lvgl -Ilib/ArduinoJson/src -Isrc -Itools/host/include"
+BLEND=lib/lvgl/src/draw/sw/lv_draw_sw_blend.c
+
+for f in $(find lib/lvgl/src src/fonts/generated -name '*.c'); do
+    o="$OUT/$(echo "$f" | tr '/.' '__').o"
+    [ "$o" -nt "$f" ] && [ "$o" -nt lib/lv_conf.h ] || cc -c -w $FLAGS "$f" -o "$o"
+done
+
+# Só o arquivo dos kernels muda entre os dois binários
+BLEND_O="$OUT/$(echo "$BLEND" | tr '/.' '__').o"
+[ "$PIXEL/blend.o" -nt "$BLEND" ] && [ "$PIXEL/blend.o" -nt "$PIXEL/lv_conf.h" ] || \
+    cc -c -w -I"$PIXEL" $FLAGS "$BLEND" -o "$PIXEL/blend.o"
+
+SRCS="tools/blend_bench/blend_bench.cpp tools/host/arduino_host.cpp src/system/pda_mem.cpp src/system/pda_log.cpp src/system/tft_scroll.cpp"
+c++ -std=c++17 $FLAGS $SRCS "$OUT"/*.o -lm -o .pio/host/blend_bench
+c++ -std=c++17 -I"$PIXEL" $FLAGS $SRCS $(ls "$OUT"/*.o | grep -v "$BLEND_O") "$PIXEL/blend.o" -lm \
+    -o .pio/host/blend_bench_pixel
+echo "built .pio/host/blend_bench .pio/host/blend_bench_pixel"
@@ -0,0 +1,32 @@
+#!/bin/sh
+# Compila o benchmark dos caches de desenho para o host (gcc/g++ do sistema).
+# Gera .pio/host/draw_bench (lv_conf.h do projeto) e .pio/host/draw_bench_nocache
+# (mesmo lv_conf.h com o cache de círculos nos valores antigos).
+# Uso: tools/draw_bench/build.sh   (a partir da raiz do projeto)
+set -e
+
+NOCACHE=.pio/host/draw_bench_nocache.conf
+mkdir -p "$NOCACHE"
+sed -e 's/^#define LV_CIRCLE_CACHE_SIZE .*/#define LV_CIRCLE_CACHE_SIZE 4/' \
+    -e 's/^#define LV_CIRCLE_CACHE_BUDGET .*/#define LV_CIRCLE_CACHE_BUDGET 0/' \
+    lib/lv_conf.h > "$NOCACHE/lv_conf.h.new"
+# Só troca o arquivo se mudou, para não recompilar tudo a cada build
+cmp -s "$NOCACHE/lv_conf.h.new" "$NOCACHE/lv_conf.h" || mv "$NOCACHE/lv_conf.h.new" "$NOCACHE/lv_conf.h"
+rm -f "$NOCACHE/lv_conf.h.new"
+
+# $1: pasta dos objetos, $2: binário, $3: includes extras (antes dos do projeto)
+build() {
+    OUT=$1
+    FLAGS="-O2 -DLV_CONF_INCLUDE_SIMPLE -DARDUINOJSON_ENABLE_ARDUINO_STRING=1 $3 -Ilib -Ilib/lvgl -Ilib/ArduinoJson/src -Isrc -Itools/host/include"
+    mkdir -p "$OUT"
+    for f in $(find lib/lvgl/src src/fonts/generated -name '*.c'); do
+        o="$OUT/$(echo "$f" | tr '/.' '__').o"
+        [ "$o" -nt "$f" ] && [ "$o" -nt lib/lv_conf.h ] || cc -c -w $FLAGS "$f" -o "$o"
+    done
+    c++ -std=c++17 $FLAGS tools/draw_bench/draw_bench.cpp tools/host/arduino_host.cpp src/system/pda_mem.cpp src/system/pda_log.cpp src/system/tft_scroll.cpp \
+        "$OUT"/*.o -lm -o "$2"
+    echo "built $2"
+}
+
+build .pio/host/draw_bench.obj .pio/host/draw_bench ""
+build .pio/host/draw_bench_nocache.obj .pio/host/draw_bench_nocache "-I$NOCACHE"
@@ -0,0 +1,242 @@
+/**
+ * Draw primitive cache benchmark
+ *
+ * Mede no host o custo de desenhar as telas dos apps com o cache de círculos
+ * do LVGL (ver lv_draw_cache.h): as tabelas de anti-aliasing dos cantos
+ * arredondados e dos botões redondos mantidas entre quadros
+ * (LV_CIRCLE_CACHE_SIZE / LV_CIRCLE_CACHE_BUDGET). Cada falta é uma alocação
+ * e o cálculo da tabela.
+ *
+ * O build.sh gera dois binários: draw_bench com o lv_conf.h do projeto e
+ * draw_bench_nocache com o cache nos valores antigos do LVGL. O hash dos
+ * quadros tem de ser o mesmo nos dois: o cache não pode mudar pixels.
+ *
+ * Uso:
+ *   tools/draw_bench/build.sh
+ *   .pio/host/draw_bench [quadros]
+ *   .pio/host/draw_bench_nocache [quadros]
+ *
+ * Cada cena roda DRAW_BENCH_ROUNDS vezes e vale o menor ms/frame: a diferença
+ * entre os caches é pequena no host e a média pega o ruído da máquina.
+ */
+
+#include <Arduino.h>
+#include <chrono>
+#include <lvgl.h>
+#include "system/pda_mem.h"
+#include "apps/pda_theme.h"
+
+#define DRAW_BENCH_ROUNDS 7
+
+namespace {
+
+lv_color_t draw_buf_data[320 * 240];
+uint32_t frame_hash;
+double hash_ms;  // descontado do tempo dos quadros
+
+double now_ms() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+void flush_cb(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_p) {
+    // FNV-1a de todos os quadros da cena
+    double start = now_ms();
+    uint32_t n = lv_area_get_size(area) * sizeof(lv_color_t);
+    const uint8_t* p = (const uint8_t*)color_p;
+    for (uint32_t i = 0; i < n; i++) frame_hash = (frame_hash ^ p[i]) * 16777619U;
+    hash_ms += now_ms() - start;
+    lv_disp_flush_ready(drv);
+}
+
+void init_display() {
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+    lv_disp_draw_buf_init(&draw_buf, draw_buf_data, NULL, 320 * 240);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = 320;
+    disp_drv.ver_res = 240;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.full_refresh = 1;
+    lv_disp_drv_register(&disp_drv);
+}
+
+lv_obj_t* load_screen() {
+    lv_obj_t* screen = PdaTheme::create_screen();
+    lv_obj_clear_flag(screen, LV_OBJ_FLAG_HIDDEN);
+    lv_scr_load_anim(screen, LV_SCR_LOAD_ANIM_NONE, 0, 0, true);
+    return screen;
+}
+
+/*Grade do menu principal: contêineres de raio 12, o selecionado a 50% anda a cada quadro*/
+lv_obj_t* items[12];
+
+void build_mainmenu(lv_obj_t* screen) {
+    static lv_style_t normal, selected;
+    lv_style_init(&normal);
+    lv_style_set_bg_opa(&normal, LV_OPA_TRANSP);
+    lv_style_set_border_width(&normal, 0);
+    lv_style_set_radius(&normal, 12);
+    lv_style_init(&selected);
+    lv_style_set_bg_color(&selected, lv_color_hex(0x1A5FB4));
+    lv_style_set_bg_opa(&selected, LV_OPA_50);
+
+    for (int i = 0; i < 12; i++) {
+        items[i] = lv_obj_create(screen);
+        lv_obj_set_size(items[i], 80, 80);
+        lv_obj_set_pos(items[i], (i % 4) * 80, (i / 4) * 80);
+        lv_obj_add_style(items[i], &normal, LV_PART_MAIN);
+        lv_obj_add_style(items[i], &selected, LV_PART_MAIN | LV_STATE_CHECKED);
+        lv_obj_clear_flag(items[i], LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_t* label = lv_label_create(items[i]);
+        lv_label_set_text(label, "App");
+        lv_obj_align(label, LV_ALIGN_BOTTOM_MID, 0, 0);
+    }
+}
+
+void step_mainmenu(int f) {
+    lv_obj_clear_state(items[(f + 11) % 12], LV_STATE_CHECKED);
+    lv_obj_add_state(items[f % 12], LV_STATE_CHECKED);
+}
+
+/*Calculadora: visor de raio 12 e teclado com os botões (sombra) do tema padrão*/
+lv_obj_t* display_label;
+
+void build_calculator(lv_obj_t* screen) {
+    lv_obj_t* display = lv_obj_create(screen);
+    lv_obj_set_size(display, 300, 50);
+    lv_obj_align(display, LV_ALIGN_TOP_MID, 0, 5);
+    lv_obj_set_style_radius(display, 12, LV_PART_MAIN);
+    lv_obj_set_style_shadow_opa(display, 0, LV_PART_MAIN);
+    display_label = lv_label_create(display);
+    lv_obj_align(display_label, LV_ALIGN_RIGHT_MID, 0, 0);
+
+    const char* keys = "789/456*123-0.=+";
+    for (int i = 0; i < 16; i++) {
+        lv_obj_t* btn = lv_btn_create(screen);
+        lv_obj_set_size(btn, 70, 38);
+        lv_obj_set_pos(btn, 8 + (i % 4) * 78, 64 + (i / 4) * 44);
+        lv_obj_t* label = lv_label_create(btn);
+        char text[2] = {keys[i], '\0'};
+        lv_label_set_text(label, text);
+        lv_obj_center(label);
+    }
+}
+
+void step_calculator(int f) {
+    lv_label_set_text_fmt(display_label, "%d", f * 7);
+}
+
+/*Configurações: cabeçalho de raio 8 e lista com o item selecionado*/
+lv_obj_t* settings_list;
+
+void build_settings(lv_obj_t* screen) {
+    lv_obj_t* header = lv_obj_create(screen);
+    lv_obj_set_size(header, 310, 40);
+    lv_obj_align(header, LV_ALIGN_TOP_MID, 0, 5);
+    lv_obj_set_style_shadow_width(header, 0, 0);
+    lv_obj_set_style_radius(header, 8, 0);
+    lv_obj_t* title = lv_label_create(header);
+    lv_label_set_text(title, "Settings");
+    lv_obj_center(title);
+
+    settings_list = lv_list_create(screen);
+    lv_obj_set_size(settings_list, 310, 180);
+    lv_obj_align(settings_list, LV_ALIGN_BOTTOM_MID, 0, -5);
+    const char* names[] = {"Wi-Fi", "Brightness", "Date & time", "Keyboard", "Storage", "About"};
+    for (const char* name : names) lv_list_add_btn(settings_list, LV_SYMBOL_SETTINGS, name);
+}
+
+void step_settings(int f) {
+    uint32_t cnt = lv_obj_get_child_cnt(settings_list);
+    lv_obj_clear_state(lv_obj_get_child(settings_list, (f + cnt - 1) % cnt), LV_STATE_CHECKED);
+    lv_obj_add_state(lv_obj_get_child(settings_list, f % cnt), LV_STATE_CHECKED);
+}
+
+/*Notas e calendário: voltar, "+" e o modal com os botões redondos*/
+lv_obj_t* modal_screen;
+lv_obj_t* modal;
+
+void build_modal(lv_obj_t* screen) {
+    modal_screen = screen;
+    modal = nullptr;
+    PdaTheme::create_back_button(screen, NULL);
+    PdaTheme::create_title(screen, "Notes");
+    PdaTheme::create_add_button(screen, NULL);
+}
+
+void step_modal(int f) {
+    // Aberto e fechado a cada 10 quadros
+    if (f % 10 != 0) return;
+    if (modal) {
+        lv_obj_del(modal);
+        modal = nullptr;
+        return;
+    }
+    modal = PdaTheme::create_modal(modal_screen);
+    lv_obj_t* save = PdaTheme::create_round_button(modal, LV_SYMBOL_SAVE, NULL);
+    lv_obj_align(save, LV_ALIGN_BOTTOM_MID, -50, -10);
+    lv_obj_t* close = PdaTheme::create_round_button(modal, LV_SYMBOL_CLOSE, NULL);
+    lv_obj_align(close, LV_ALIGN_BOTTOM_MID, 0, -10);
+    lv_obj_t* del = PdaTheme::create_round_button(modal, LV_SYMBOL_TRASH, NULL, true);
+    lv_obj_align(del, LV_ALIGN_BOTTOM_MID, 50, -10);
+}
+
+void print_stats(const char* name, const lv_draw_cache_stats_t& s) {
+    uint32_t total = s.hits + s.misses;
+    printf("    %-8s hits %7u  misses %6u  hit rate %5.1f%%  evictions %5u  %2u entries  %5u/%u bytes\n",
+           name, (unsigned)s.hits, (unsigned)s.misses, total ? 100.0 * s.hits / total : 0.0,
+           (unsigned)s.evictions, (unsigned)s.entries, (unsigned)s.used_bytes, (unsigned)s.size);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? atoi(argv[1]) : 300;
+    if (frames < 1) frames = 1;
+
+    lv_init();
+    init_display();
+    PdaTheme::init();
+
+    struct Scene {
+        const char* name;
+        void (*build)(lv_obj_t*);
+        void (*step)(int);
+    };
+    const Scene scenes[] = {{"mainmenu", build_mainmenu, step_mainmenu},
+                            {"calculator", build_calculator, step_calculator},
+                            {"settings", build_settings, step_settings},
+                            {"notes", build_modal, step_modal}};
+
+    printf("circle cache %d (budget %u B)\n", LV_CIRCLE_CACHE_SIZE, (unsigned)LV_CIRCLE_CACHE_BUDGET);
+
+    for (const Scene& s : scenes) {
+        s.build(load_screen());
+        lv_refr_now(NULL);
+
+        // Os contadores e o hash são os da última rodada
+        double ms = 0;
+        for (int round = 0; round < DRAW_BENCH_ROUNDS; round++) {
+            lv_draw_mask_circle_cache_reset_stats();
+            frame_hash = 2166136261U;
+            hash_ms = 0;
+
+            double start = now_ms();
+            for (int f = 0; f < frames; f++) {
+                s.step(f);
+                lv_obj_invalidate(lv_scr_act());
+                lv_refr_now(NULL);
+            }
+            double round_ms = (now_ms() - start - hash_ms) / frames;
+            if (round == 0 || round_ms < ms) ms = round_ms;
+        }
+
+        printf("%-10s %8.3f ms/frame  hash %08x\n", s.name, ms, (unsigned)frame_hash);
+        lv_draw_cache_stats_t stats;
+        lv_draw_mask_circle_cache_get_stats(&stats);
+        print_stats("circle", stats);
+    }
+    return 0;
+}
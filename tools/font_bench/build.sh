@@ -0,0 +1,18 @@
+#!/bin/sh
+# Compila o benchmark de desenho de texto para o host (gcc/g++ do sistema).
+# Uso: tools/font_bench/build.sh   (a partir da raiz do projeto)
+set -e
+
+OUT=.pio/host/font_bench.obj
+mkdir -p "$OUT"
+
+FLAGS="-O2 -DLV_CONF_INCLUDE_SIMPLE -DARDUINOJSON_ENABLE_ARDUINO_STRING=1 -Ilib -Ilib/lvgl -Ilib/ArduinoJson/src -Isrc -Itools/host/include"
+
+for f in $(find lib/lvgl/src src/fonts/generated -name '*.c'); do
+    o="$OUT/$(echo "$f" | tr '/.' '__').o"
+    [ "$o" -nt "$f" ] || cc -c -w $FLAGS "$f" -o "$o"
+done
+
+cc -c -w $FLAGS tools/font_bench/builtin_montserrat_28.c -o "$OUT/builtin_montserrat_28.o"
+c++ -std=c++17 $FLAGS tools/font_bench/font_bench.cpp tools/host/arduino_host.cpp src/system/pda_mem.cpp src/system/pda_log.cpp src/system/tft_scroll.cpp "$OUT"/*.o -lm -o .pio/host/font_bench
+echo "built .pio/host/font_bench"
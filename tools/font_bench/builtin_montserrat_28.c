@@ -0,0 +1,11 @@
+/**
+ * Fonte Montserrat 28 embutida no LVGL (4 bpp, sem compressão), com outro nome,
+ * para o font_bench comparar com a gerada por tools/fonts/gen_fonts.py.
+ */
+#include "lvgl.h"
+
+#undef LV_FONT_MONTSERRAT_28
+#define LV_FONT_MONTSERRAT_28 1
+#define lv_font_montserrat_28 lv_font_montserrat_28_builtin
+
+#include "lvgl/src/font/lv_font_montserrat_28.c"
@@ -0,0 +1,146 @@
+/**
+ * Text drawing benchmark
+ *
+ * Mede no host quantas letras por segundo o renderizador por software desenha
+ * com a Montserrat 28 (a maior fonte com texto livre, usada no relógio e no
+ * clima). Compara:
+ *   builtin   - a fonte embutida do LVGL (4 bpp sem compressão), sem cache
+ *   generated - a fonte de src/fonts/generated (comprimida), sem cache
+ *   cached    - a fonte gerada com o cache de glifos (LV_GLYPH_CACHE_SIZE)
+ *
+ * Depois, o mesmo texto em cada tamanho gerado, sem cache (o custo de uma
+ * falta do cache de glifos) e com cache, com o formato do bitmap de cada um
+ * (plain ou rle, ver FONTS em tools/fonts/gen_fonts.py).
+ *
+ * Uso:
+ *   tools/font_bench/build.sh
+ *   .pio/host/font_bench [quadros]
+ *
+ * O display é um driver sem saída de 320x240 (o tamanho do T-Deck) com full_refresh.
+ * O tempo de um quadro sem texto é descontado, então sobra só o das letras.
+ */
+
+#include <Arduino.h>
+#include <chrono>
+#include <lvgl.h>
+#include "system/pda_mem.h"
+
+extern "C" const lv_font_t lv_font_montserrat_28_builtin;
+
+namespace {
+
+const char* TEXT =
+    "Sao Paulo 23:45\n"
+    "Partly cloudy, 18C\n"
+    "Meeting with the team\n"
+    "Buy milk and bread\n"
+    "Wind 12 km/h NE\n"
+    "Battery 87% - Wi-Fi";
+
+lv_color_t draw_buf_data[320 * 240];
+
+void flush_cb(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_p) {
+    (void)area;
+    (void)color_p;
+    lv_disp_flush_ready(drv);
+}
+
+void init_display() {
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+    lv_disp_draw_buf_init(&draw_buf, draw_buf_data, NULL, 320 * 240);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = 320;
+    disp_drv.ver_res = 240;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.full_refresh = 1;
+    lv_disp_drv_register(&disp_drv);
+}
+
+double now_ms() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+/*Tempo médio (ms) de um quadro completo*/
+double measure(int frames) {
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);  // aquece o cache, se houver
+    double start = now_ms();
+    for (int f = 0; f < frames; f++) {
+        lv_obj_invalidate(lv_scr_act());
+        lv_refr_now(NULL);
+    }
+    return (now_ms() - start) / frames;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? atoi(argv[1]) : 200;
+    if (frames < 1) frames = 1;
+
+    lv_init();
+    init_display();
+
+    lv_obj_t* label = lv_label_create(lv_scr_act());
+    lv_obj_set_pos(label, 4, 4);
+
+    // Letras desenhadas por quadro (as quebras de linha não são desenhadas)
+    uint32_t letters = 0;
+    for (const char* p = TEXT; *p; p++) {
+        if (*p != '\n') letters++;
+    }
+
+    lv_label_set_text(label, "");
+    lv_glyph_cache_set_size(0);
+    double empty = measure(frames);
+
+    struct Config {
+        const char* name;
+        const lv_font_t* font;
+        uint32_t cache_size;
+    };
+    const Config configs[] = {
+        {"builtin", &lv_font_montserrat_28_builtin, 0},
+        {"generated", &lv_font_montserrat_28, 0},
+        {"cached", &lv_font_montserrat_28, LV_GLYPH_CACHE_SIZE},
+    };
+
+    lv_label_set_text_static(label, TEXT);
+    printf("%10s %10s %14s\n", "font", "ms/frame", "letters/s");
+    for (const Config& c : configs) {
+        lv_obj_set_style_text_font(label, c.font, 0);
+        lv_glyph_cache_set_size(c.cache_size);
+        double ms = measure(frames);
+        double text_ms = ms - empty;
+        printf("%10s %10.3f %14.0f\n", c.name, ms, text_ms > 0 ? letters * 1000.0 / text_ms : 0.0);
+    }
+
+    struct Size {
+        int px;
+        const lv_font_t* font;
+    };
+    const Size sizes[] = {
+        {12, &lv_font_montserrat_12}, {14, &lv_font_montserrat_14}, {16, &lv_font_montserrat_16},
+        {18, &lv_font_montserrat_18}, {20, &lv_font_montserrat_20}, {28, &lv_font_montserrat_28},
+    };
+    printf("\n%10s %6s %12s %12s\n", "size", "format", "miss ms", "cached ms");
+    for (const Size& s : sizes) {
+        const lv_font_fmt_txt_dsc_t* dsc = (const lv_font_fmt_txt_dsc_t*)s.font->dsc;
+        lv_obj_set_style_text_font(label, s.font, 0);
+        lv_glyph_cache_set_size(0);
+        double miss = measure(frames) - empty;
+        lv_glyph_cache_set_size(LV_GLYPH_CACHE_SIZE);
+        double cached = measure(frames) - empty;
+        printf("%10d %6s %12.3f %12.3f\n", s.px, dsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN ? "plain" : "rle",
+               miss, cached);
+    }
+
+    lv_glyph_cache_stats_t stats;
+    lv_glyph_cache_get_stats(&stats);
+    printf("cache: %u entries, %u/%u bytes, %u hits, %u misses\n", (unsigned)stats.entries,
+           (unsigned)stats.used_bytes, (unsigned)stats.size, (unsigned)stats.hits, (unsigned)stats.misses);
+    return 0;
+}
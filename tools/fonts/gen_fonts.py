@@ -0,0 +1,879 @@
+"""
+Gerador das fontes Montserrat
+
+Gera src/fonts/generated/lv_font_montserrat_NN.c no formato do lv_font_conv
+(lv_font_fmt_txt, 4 bpp), com os mesmos nomes das fontes embutidas do LVGL,
+mas:
+
+- Só com os caracteres que cada tamanho usa (ver FONTS). Os tamanhos que
+  mostram texto vindo de fora (notas, agenda, clima, títulos) levam também o
+  Latin-1, então "ação" e "São Paulo" aparecem com acento, sem
+  Utils::sanitizeString.
+- Símbolos LV_SYMBOL_* usados em src/ em todos os tamanhos; o 14 (fonte
+  padrão dos widgets do LVGL) leva todos.
+- Caracteres fora do ASCII que aparecem em literais dos arquivos que usam
+  cada tamanho (ex: "°" do clima).
+- Bitmaps comprimidos (LV_FONT_FMT_TXT_COMPRESSED: RLE com prefiltro por
+  linha, lidos com LV_USE_FONT_COMPRESSED) só nos tamanhos grandes. Numa falta
+  do cache de glifos o glifo comprimido é descomprimido de novo, bem mais
+  lento que o plano (ver tools/font_bench), e nos tamanhos pequenos a
+  compressão economiza pouco: esses ficam em LV_FONT_FMT_TXT_PLAIN (ver FONTS).
+- line_height e base_line copiados das fontes embutidas do LVGL, para o
+  layout das telas não mudar.
+
+As fontes de origem são as mesmas do LVGL (lib/lvgl/scripts/built_in_font).
+O rasterizador é próprio (cobertura exata de área, só com a linha de base
+alinhada ao pixel), então depende só do fontTools (tools/fonts/requirements.txt).
+
+Os .c gerados ficam versionados e o build não roda este script, então compilar
+não precisa de Python nem do fontTools. Como o conjunto de cada tamanho sai dos
+literais de src/, quem muda texto com caractere novo (ou um LV_SYMBOL_* novo)
+regenera e versiona o resultado junto.
+
+Uso:
+- python tools/fonts/gen_fonts.py [pasta de saída]
+  (mostra glifos e bytes de cada tamanho)
+- python tools/fonts/gen_fonts.py --check
+  (não escreve nada; sai com 1 se algum .c de src/fonts/generated está velho)
+"""
+
+import math
+import os
+import re
+import sys
+
+FONT_DIR = os.path.join("lib", "lvgl", "scripts", "built_in_font")
+TEXT_FONT = "Montserrat-Medium.ttf"
+SYMBOL_FONT = "FontAwesome5-Solid+Brands+Regular.woff"
+SYMBOL_DEF = os.path.join("lib", "lvgl", "src", "font", "lv_symbol_def.h")
+BUILTIN_DIR = os.path.join("lib", "lvgl", "src", "font")
+OUT_DIR = os.path.join("src", "fonts", "generated")
+BPP = 4
+
+ASCII = list(range(0x20, 0x7F))
+LATIN1 = list(range(0xA0, 0x100))
+# – — ‘ ’ “ ” … €
+TYPOGRAPHY = [0x2013, 0x2014, 0x2018, 0x2019, 0x201C, 0x201D, 0x2026, 0x20AC]
+DEGREE_BULLET = [0xB0, 0x2022]
+
+CHARSETS = {
+    "text": ASCII + LATIN1 + TYPOGRAPHY + DEGREE_BULLET,
+    "ascii": ASCII + DEGREE_BULLET,
+    "digits": [ord(c) for c in " 0123456789+-.,:%°CF"],
+}
+
+# tamanho -> (conjunto, todos os símbolos do LVGL, bitmap comprimido)
+# Até 20 px o texto muda muito (listas, teclado, notas) e o cache de glifos
+# erra mais; comprimir esses economiza só ~11 KB. 28 e 36 desenham poucos
+# glifos diferentes, que ficam no cache, e comprimidos economizam ~17 KB.
+FONTS = {
+    12: ("text", False, False),    # status, nomes no launcher, previsão, dias da agenda
+    14: ("text", True, False),     # LV_FONT_DEFAULT: textareas, teclado, listas
+    16: ("ascii", False, False),   # botão voltar, botões da calculadora
+    18: ("text", False, False),    # descrição do clima, expressão da calculadora
+    20: ("ascii", False, False),   # mês da agenda
+    28: ("text", False, True),     # títulos, cidade, visor da calculadora
+    36: ("digits", False, True),   # temperatura
+}
+
+SOURCE_EXTS = (".h", ".hpp", ".c", ".cpp", ".ino")
+STRING_RE = re.compile(r'"(?:[^"\\\n]|\\.)*"')
+
+
+# ---------------------------------------------------------------------------
+# fontTools
+# ---------------------------------------------------------------------------
+
+def import_fonttools():
+    try:
+        import fontTools  # noqa: F401
+    except ImportError:
+        raise SystemExit("gen_fonts: fontTools not found; install it with:\n"
+                         "    python3 -m pip install -r tools/fonts/requirements.txt")
+    from fontTools.ttLib import TTFont
+    from fontTools.pens.basePen import BasePen
+    from fontTools.pens.boundsPen import BoundsPen
+    return TTFont, BasePen, BoundsPen
+
+
+# ---------------------------------------------------------------------------
+# Conjunto de caracteres
+# ---------------------------------------------------------------------------
+
+def source_files(project_dir):
+    files = []
+    for root, dirs, names in os.walk(os.path.join(project_dir, "src")):
+        dirs[:] = [d for d in dirs if os.path.join(root, d) != os.path.join(project_dir, OUT_DIR)]
+        files += [os.path.join(root, n) for n in sorted(names) if n.endswith(SOURCE_EXTS)]
+    return sorted(files)
+
+
+def lvgl_symbols(project_dir):
+    """Retorna {nome: código} de lv_symbol_def.h e a lista de símbolos embutidos."""
+    with open(os.path.join(project_dir, SYMBOL_DEF), "r", encoding="utf-8") as f:
+        text = f.read()
+    symbols = {}
+    for name, value in re.findall(r'#define\s+(LV_SYMBOL_\w+)\s+"((?:\\x[0-9A-Fa-f]{2})+)"', text):
+        raw = bytes(int(h, 16) for h in re.findall(r"\\x([0-9A-Fa-f]{2})", value))
+        symbols.setdefault(name, ord(raw.decode("utf-8")))
+    m = re.search(r"use this list as range:(.*?)\*/", text, re.S)
+    builtin = [int(v) for v in re.findall(r"\d+", m.group(1))]
+    return symbols, builtin
+
+
+def used_chars(project_dir, size, symbols):
+    """Símbolos usados em src/ e caracteres não ASCII dos literais de quem usa `size`."""
+    font_name = "lv_font_montserrat_%d" % size
+    syms = set()
+    chars = set()
+    for path in source_files(project_dir):
+        with open(path, "r", encoding="utf-8", errors="replace") as f:
+            text = f.read()
+        for name in re.findall(r"LV_SYMBOL_\w+", text):
+            if name in symbols:
+                syms.add(symbols[name])
+        # O 14 é a fonte padrão: vale para qualquer arquivo
+        if size == 14 or font_name in text:
+            for literal in STRING_RE.findall(text):
+                chars.update(ord(c) for c in literal if ord(c) > 0x7E and c != "�")
+    return syms, chars
+
+
+def charset(project_dir, size):
+    kind, all_symbols, _ = FONTS[size]
+    symbols, builtin = lvgl_symbols(project_dir)
+    syms, chars = used_chars(project_dir, size, symbols)
+    cps = set(CHARSETS[kind]) | syms | chars
+    if all_symbols:
+        cps |= set(builtin)
+    return sorted(cps)
+
+
+def builtin_metrics(project_dir, size):
+    """line_height e base_line da fonte embutida do mesmo tamanho."""
+    with open(os.path.join(project_dir, BUILTIN_DIR, "lv_font_montserrat_%d.c" % size), "r") as f:
+        text = f.read()
+    return (int(re.search(r"\.line_height = (\d+)", text).group(1)),
+            int(re.search(r"\.base_line = (\d+)", text).group(1)))
+
+
+# ---------------------------------------------------------------------------
+# Rasterização
+# ---------------------------------------------------------------------------
+
+def make_flatten_pen(BasePen):
+    class FlattenPen(BasePen):
+        """Converte o contorno em polígonos (em pixels, y para cima)."""
+
+        def __init__(self, glyph_set, scale, y_map=None):
+            BasePen.__init__(self, glyph_set)
+            self.scale = scale
+            self.y_map = y_map
+            self.contours = []
+            self.cur = None
+
+        def _pt(self, p):
+            if self.y_map:
+                return (p[0] * self.scale, self.y_map(p[1]))
+            return (p[0] * self.scale, p[1] * self.scale)
+
+        def _moveTo(self, p):
+            self.cur = [self._pt(p)]
+            self.contours.append(self.cur)
+
+        def _lineTo(self, p):
+            self.cur.append(self._pt(p))
+
+        def _qCurveToOne(self, p1, p2):
+            p0 = self.cur[-1]
+            p1, p2 = self._pt(p1), self._pt(p2)
+            dev = math.hypot(p0[0] - 2 * p1[0] + p2[0], p0[1] - 2 * p1[1] + p2[1])
+            n = min(32, max(1, int(math.ceil(math.sqrt(dev * 4)))))
+            for i in range(1, n + 1):
+                t = i / n
+                mt = 1 - t
+                self.cur.append((mt * mt * p0[0] + 2 * mt * t * p1[0] + t * t * p2[0],
+                                 mt * mt * p0[1] + 2 * mt * t * p1[1] + t * t * p2[1]))
+
+        def _curveToOne(self, p1, p2, p3):
+            p0 = self.cur[-1]
+            p1, p2, p3 = self._pt(p1), self._pt(p2), self._pt(p3)
+            dev = max(math.hypot(p0[0] - 2 * p1[0] + p2[0], p0[1] - 2 * p1[1] + p2[1]),
+                      math.hypot(p1[0] - 2 * p2[0] + p3[0], p1[1] - 2 * p2[1] + p3[1]))
+            n = min(32, max(1, int(math.ceil(math.sqrt(dev * 6)))))
+            for i in range(1, n + 1):
+                t = i / n
+                mt = 1 - t
+                a, b, c, d = mt * mt * mt, 3 * mt * mt * t, 3 * mt * t * t, t * t * t
+                self.cur.append((a * p0[0] + b * p1[0] + c * p2[0] + d * p3[0],
+                                 a * p0[1] + b * p1[1] + c * p2[1] + d * p3[1]))
+
+        def _closePath(self):
+            self.cur = None
+
+        def _endPath(self):
+            self.cur = None
+
+    return FlattenPen
+
+
+def baseline_map(font, BoundsPen, scale):
+    """Hinting vertical mínimo: o overshoot das letras redondas abaixo da linha
+    de base (ex: "o", "0") é achatado nela, como no hinting leve do FreeType,
+    para não virar uma linha a mais, meio apagada, embaixo do texto."""
+    glyph_set = font.getGlyphSet()
+    pen = BoundsPen(glyph_set)
+    glyph_set[font.getBestCmap()[ord("o")]].draw(pen)
+    overshoot = min(pen.bounds[1], 0)
+
+    def y_map(y):
+        if y >= 0:
+            return y * scale
+        if y >= overshoot:
+            return 0.0
+        return (y - overshoot) * scale
+
+    return y_map
+
+
+def accumulate_line(acc, w, h, x0, y0, x1, y1):
+    """Soma a área com sinal coberta pelo segmento em cada célula (à la font-rs)."""
+    if y0 == y1:
+        return
+    direction = 1.0
+    if y0 > y1:
+        direction = -1.0
+        x0, y0, x1, y1 = x1, y1, x0, y0
+    dxdy = (x1 - x0) / (y1 - y0)
+    x = x0
+    if y0 < 0:
+        x -= y0 * dxdy
+    for y in range(max(0, int(y0)), min(h, int(math.ceil(y1)))):
+        ls = y * w
+        dy = min(y + 1.0, y1) - max(float(y), y0)
+        xnext = x + dxdy * dy
+        d = dy * direction
+        xa, xb = (x, xnext) if x < xnext else (xnext, x)
+        xa_floor = math.floor(xa)
+        xai = int(xa_floor)
+        xbi = int(math.ceil(xb))
+        if xbi <= xai + 1:
+            xmf = 0.5 * (x + xnext) - xa_floor
+            acc[ls + xai] += d - d * xmf
+            acc[ls + xai + 1] += d * xmf
+        else:
+            s = 1.0 / (xb - xa)
+            xaf = xa - xa_floor
+            a0 = 0.5 * s * (1.0 - xaf) ** 2
+            xbf = xb - xbi + 1.0
+            am = 0.5 * s * xbf * xbf
+            acc[ls + xai] += d * a0
+            if xbi == xai + 2:
+                acc[ls + xai + 1] += d * (1.0 - a0 - am)
+            else:
+                a1 = s * (1.5 - xaf)
+                acc[ls + xai + 1] += d * (a1 - a0)
+                for xi in range(xai + 2, xbi - 1):
+                    acc[ls + xi] += d * s
+                a2 = a1 + (xbi - xai - 3) * s
+                acc[ls + xbi - 1] += d * (1.0 - a2 - am)
+            acc[ls + xbi] += d * am
+        x = xnext
+
+
+def rasterize(contours):
+    """Retorna (box_w, box_h, ofs_x, ofs_y, valores de 0 a 2^BPP-1 por pixel)."""
+    pts = [p for c in contours for p in c]
+    if not pts:
+        return 0, 0, 0, 0, []
+    x0 = int(math.floor(min(p[0] for p in pts)))
+    x1 = int(math.ceil(max(p[0] for p in pts)))
+    y0 = int(math.floor(min(p[1] for p in pts)))
+    y1 = int(math.ceil(max(p[1] for p in pts)))
+    w, h = x1 - x0, y1 - y0
+    stride = w + 2
+    acc = [0.0] * (stride * h + 2)
+    for c in contours:
+        n = len(c)
+        for i in range(n):
+            ax, ay = c[i]
+            bx, by = c[(i + 1) % n]
+            accumulate_line(acc, stride, h, ax - x0, y1 - ay, bx - x0, y1 - by)
+
+    levels = (1 << BPP) - 1
+    px = []
+    total = 0.0
+    for y in range(h):
+        row = []
+        for x in range(stride):
+            total += acc[y * stride + x]
+            if x < w:
+                row.append(int(min(abs(total), 1.0) * levels + 0.5))
+        total = 0.0
+        px.append(row)
+
+    # Tira linhas e colunas vazias das bordas
+    while px and not any(px[0]):
+        px.pop(0)
+    while px and not any(px[-1]):
+        px.pop()
+        y0 += 1
+    if not px:
+        return 0, 0, 0, 0, []
+    left = min(next(i for i, v in enumerate(r) if v) for r in px if any(r))
+    right = max(len(r) - next(i for i, v in enumerate(reversed(r)) if v) for r in px if any(r))
+    px = [r[left:right] for r in px]
+    return right - left, len(px), x0 + left, y0, [v for r in px for v in r]
+
+
+# ---------------------------------------------------------------------------
+# Bitmaps: plano (LV_FONT_FMT_TXT_PLAIN) ou comprimido (o inverso de
+# rle_next() em lv_font_fmt_txt.c)
+# ---------------------------------------------------------------------------
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.nbits = 0
+
+    def write(self, value, bits):
+        for i in range(bits - 1, -1, -1):
+            if self.nbits % 8 == 0:
+                self.out.append(0)
+            if (value >> i) & 1:
+                self.out[-1] |= 0x80 >> (self.nbits % 8)
+            self.nbits += 1
+
+
+def pack_plain(values):
+    """Valores seguidos, sem alinhar as linhas; só o glifo começa num byte."""
+    bw = BitWriter()
+    for v in values:
+        bw.write(v, BPP)
+    return bytes(bw.out)
+
+
+def compress(values, w, h):
+    """RLE com prefiltro (cada linha em XOR com a anterior), alinhado em byte."""
+    stream = list(values[:w])
+    for y in range(1, h):
+        stream += [values[y * w + x] ^ values[(y - 1) * w + x] for x in range(w)]
+
+    bw = BitWriter()
+    single = True
+    prev = 0
+    cnt = 0
+    i = 0
+    n = len(stream)
+    while i < n:
+        v = stream[i]
+        if single:
+            bw.write(v, BPP)
+            if i != 0 and v == prev:
+                single = False
+                cnt = 0
+            prev = v
+            i += 1
+        elif v == prev:
+            bw.write(1, 1)
+            cnt += 1
+            i += 1
+            if cnt == 11:
+                run = 0
+                while i + run < n and stream[i + run] == prev and run < 62:
+                    run += 1
+                bw.write(run + 1, 6)
+                i += run
+                if i < n:
+                    prev = stream[i]
+                    bw.write(prev, BPP)
+                    i += 1
+                single = True
+        else:
+            bw.write(0, 1)
+            bw.write(v, BPP)
+            prev = v
+            single = True
+            i += 1
+    return bytes(bw.out)
+
+
+def decompress(data, w, h):
+    """Referência em Python do descompressor do LVGL, usada para validar."""
+    pos = [0]
+
+    def bits(n):
+        v = 0
+        for _ in range(n):
+            v = (v << 1) | ((data[pos[0] >> 3] >> (7 - (pos[0] & 7))) & 1)
+            pos[0] += 1
+        return v
+
+    state, prev, cnt = "single", 0, 0
+    stream = []
+    for _ in range(w * h):
+        if state == "single":
+            ret = bits(BPP)
+            if pos[0] != BPP and ret == prev:
+                cnt, state = 0, "repeat"
+            prev = ret
+        elif state == "repeat":
+            cnt += 1
+            if bits(1):
+                ret = prev
+                if cnt == 11:
+                    cnt = bits(6)
+                    if cnt:
+                        state = "counter"
+                    else:
+                        ret = prev = bits(BPP)
+                        state = "single"
+            else:
+                ret = prev = bits(BPP)
+                state = "single"
+        else:
+            ret = prev
+            cnt -= 1
+            if cnt == 0:
+                ret = prev = bits(BPP)
+                state = "single"
+        stream.append(ret)
+
+    out = stream[:w]
+    for y in range(1, h):
+        out += [stream[y * w + x] ^ out[(y - 1) * w + x] for x in range(w)]
+    return out
+
+
+# ---------------------------------------------------------------------------
+# Kerning (GPOS PairPos do Montserrat)
+# ---------------------------------------------------------------------------
+
+def gpos_kerning(font, names):
+    """Retorna {(esquerdo, direito): avanço extra em unidades da fonte}."""
+    if "GPOS" not in font:
+        return {}
+    gpos = font["GPOS"].table
+    lookups = set()
+    for fr in gpos.FeatureList.FeatureRecord:
+        if fr.FeatureTag == "kern":
+            lookups.update(fr.Feature.LookupListIndex)
+
+    names = set(names)
+    kern = {}
+    for li in sorted(lookups):
+        lookup = gpos.LookupList.Lookup[li]
+        done = set()
+        for st in lookup.SubTable:
+            if lookup.LookupType == 9:
+                if st.ExtensionLookupType != 2:
+                    continue
+                st = st.ExtSubTable
+            elif lookup.LookupType != 2:
+                continue
+            covered = [g for g in st.Coverage.glyphs if g in names]
+            if st.Format == 1:
+                for g in covered:
+                    ps = st.PairSet[st.Coverage.glyphs.index(g)]
+                    for rec in ps.PairValueRecord:
+                        pair = (g, rec.SecondGlyph)
+                        if rec.SecondGlyph not in names or pair in done:
+                            continue
+                        done.add(pair)
+                        v = getattr(rec.Value1, "XAdvance", 0) or 0
+                        if v:
+                            kern[pair] = kern.get(pair, 0) + v
+            elif st.Format == 2:
+                cd1 = st.ClassDef1.classDefs
+                cd2 = st.ClassDef2.classDefs
+                for g in covered:
+                    row = st.Class1Record[cd1.get(g, 0)].Class2Record
+                    for r in names:
+                        pair = (g, r)
+                        if pair in done:
+                            continue
+                        done.add(pair)
+                        v = getattr(row[cd2.get(r, 0)].Value1, "XAdvance", 0) or 0
+                        if v:
+                            kern[pair] = kern.get(pair, 0) + v
+    return kern
+
+
+def kern_classes(matrix, count):
+    """Agrupa glifos com a mesma linha/coluna de kerning. Classe 0 = sem kerning."""
+    def classes(vectors):
+        mapping = [0] * count
+        index = {}
+        for gid in range(1, count):
+            vec = vectors(gid)
+            if not any(vec):
+                continue
+            if vec not in index:
+                index[vec] = len(index) + 1
+            mapping[gid] = index[vec]
+        return mapping, len(index)
+
+    left_map, left_cnt = classes(lambda g: tuple(matrix.get((g, r), 0) for r in range(1, count)))
+    right_map, right_cnt = classes(lambda g: tuple(matrix.get((l, g), 0) for l in range(1, count)))
+    if left_cnt > 255 or right_cnt > 255:
+        raise ValueError("too many kerning classes")
+
+    values = [0] * (left_cnt * right_cnt)
+    for (l, r), v in matrix.items():
+        values[(left_map[l] - 1) * right_cnt + (right_map[r] - 1)] = v
+    return left_map, right_map, left_cnt, right_cnt, values
+
+
+# ---------------------------------------------------------------------------
+# Geração
+# ---------------------------------------------------------------------------
+
+class Sources:
+    def __init__(self, project_dir, TTFont, BasePen, BoundsPen):
+        self.text = TTFont(os.path.join(project_dir, FONT_DIR, TEXT_FONT))
+        self.BoundsPen = BoundsPen
+        self.symbol = TTFont(os.path.join(project_dir, FONT_DIR, SYMBOL_FONT))
+        self.fonts = []
+        for f in (self.text, self.symbol):
+            self.fonts.append((f, f.getBestCmap(), f.getGlyphSet(), f["head"].unitsPerEm, f["hmtx"]))
+        self.FlattenPen = make_flatten_pen(BasePen)
+
+    def lookup(self, cp):
+        for entry in self.fonts:
+            if cp in entry[1]:
+                return entry
+        return None
+
+    def glyph(self, cp, size):
+        """Retorna (nome, fonte de texto?, avanço em 1/16 px, box_w, box_h, ofs_x, ofs_y, valores)."""
+        font, cmap, glyph_set, upem, hmtx = self.lookup(cp)
+        name = cmap[cp]
+        scale = size / float(upem)
+        pen = self.FlattenPen(glyph_set, scale, baseline_map(font, self.BoundsPen, scale) if font is self.text else None)
+        glyph_set[name].draw(pen)
+        box_w, box_h, ofs_x, ofs_y, values = rasterize(pen.contours)
+        adv_w = int(round(hmtx[name][0] * scale * 16))
+        return name, font is self.text, adv_w, box_w, box_h, ofs_x, ofs_y, values
+
+
+def c_char(cp):
+    if cp == 0x22:
+        return "\\\""
+    if cp == 0x5C:
+        return "\\\\"
+    if cp < 0x7F:
+        return chr(cp)
+    if 0xF000 <= cp <= 0xF8FF:
+        return ""
+    ch = chr(cp)
+    return ch if ch.isprintable() and cp != 0xA0 and cp != 0xAD else ""
+
+
+def hex_lines(data, per_line=16, indent="    "):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join("0x%x" % b for b in data[i:i + per_line]) + ",")
+    return lines
+
+
+def build_cmaps(cps):
+    """Sequências de 8 ou mais códigos viram FORMAT0_TINY; o resto vira SPARSE_TINY."""
+    runs = []
+    for cp in cps:
+        if runs and runs[-1][-1] == cp - 1:
+            runs[-1].append(cp)
+        else:
+            runs.append([cp])
+
+    cmaps = []
+    gid = 1
+    sparse = []
+
+    def flush_sparse():
+        if sparse:
+            cmaps.append(("sparse", sparse[0], sparse[-1] - sparse[0] + 1, gid - len(sparse), list(sparse)))
+            del sparse[:]
+
+    for run in runs:
+        if len(run) >= 8:
+            flush_sparse()
+            cmaps.append(("format0", run[0], len(run), gid, None))
+        else:
+            for cp in run:
+                if sparse and cp - sparse[0] > 0xFFFF:
+                    flush_sparse()
+                sparse.append(cp)
+                gid += 1
+            continue
+        gid += len(run)
+    flush_sparse()
+    return cmaps
+
+
+def generate_font(src, project_dir, size):
+    wanted = charset(project_dir, size)
+    cps = [cp for cp in wanted if src.lookup(cp)]
+    missing = [cp for cp in wanted if not src.lookup(cp)]
+
+    # O layout continua igual ao das fontes embutidas
+    line_height, base_line = builtin_metrics(project_dir, size)
+
+    glyphs = []
+    bitmap = bytearray()
+    for cp in cps:
+        name, is_text, adv_w, box_w, box_h, ofs_x, ofs_y, values = src.glyph(cp, size)
+        if not (box_w and box_h):
+            packed = b""
+        elif FONTS[size][2]:
+            packed = compress(values, box_w, box_h)
+            if decompress(packed, box_w, box_h) != values:
+                raise RuntimeError("RLE round trip failed for U+%04X" % cp)
+        else:
+            packed = pack_plain(values)
+        glyphs.append((cp, name if is_text else None, len(bitmap), adv_w, box_w, box_h, ofs_x, ofs_y, packed))
+        bitmap += packed
+    if len(bitmap) >= (1 << 20):
+        raise ValueError("bitmap too large for LV_FONT_FMT_TXT_LARGE == 0")
+
+    # Kerning em 1/16 px; gid = índice em `glyphs` + 1
+    scale = size / float(src.fonts[0][3])
+    gids_of = {}
+    for i, g in enumerate(glyphs):
+        if g[1]:
+            gids_of.setdefault(g[1], []).append(i + 1)
+    matrix = {}
+    for (l, r), v in gpos_kerning(src.text, gids_of.keys()).items():
+        k16 = int(round(v * scale * 16))
+        if k16:
+            for gl in gids_of[l]:
+                for gr in gids_of[r]:
+                    matrix[(gl, gr)] = k16
+    kern_scale = 16
+    if matrix:
+        kern_scale = max(16, int(math.ceil(max(abs(v) for v in matrix.values()) * 16 / 127.0)))
+        matrix = {k: int(round(v * 16.0 / kern_scale)) for k, v in matrix.items()}
+        matrix = {k: v for k, v in matrix.items() if v}
+
+    return {
+        "size": size,
+        "kind": FONTS[size][0],
+        "compressed": FONTS[size][2],
+        "glyphs": glyphs,
+        "bitmap": bytes(bitmap),
+        "cmaps": build_cmaps(cps),
+        "line_height": line_height,
+        "base_line": base_line,
+        "kern": kern_classes(matrix, len(glyphs) + 1) if matrix else None,
+        "kern_scale": kern_scale,
+        "missing": missing,
+        "underline_position": int(round(src.text["post"].underlinePosition * scale)),
+        "underline_thickness": max(1, int(round(src.text["post"].underlineThickness * scale))),
+    }
+
+
+def to_c(font):
+    size = font["size"]
+    name = "lv_font_montserrat_%d" % size
+    out = []
+    w = out.append
+
+    w("/*******************************************************************************")
+    w(" * Size: %d px" % size)
+    w(" * Bpp: %d" % BPP)
+    w(" * Charset: %s, %d glyphs" % (font["kind"], len(font["glyphs"])))
+    w(" * Generated by tools/fonts/gen_fonts.py from %s and %s. Do not edit." % (TEXT_FONT, SYMBOL_FONT))
+    w(" ******************************************************************************/")
+    w("")
+    w("#include \"lvgl.h\"")
+    w("")
+    w("/*-----------------")
+    w(" *    BITMAPS")
+    w(" *----------------*/")
+    w("")
+    w("/*Store the image of the glyphs*/")
+    w("static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {")
+    for i, g in enumerate(font["glyphs"]):
+        if i:
+            w("")
+        w("    /* U+%04X \"%s\" */" % (g[0], c_char(g[0])))
+        out.extend(hex_lines(g[8]))
+    w("};")
+    w("")
+    w("")
+    w("/*---------------------")
+    w(" *  GLYPH DESCRIPTION")
+    w(" *--------------------*/")
+    w("")
+    w("static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {")
+    w("    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,")
+    for g in font["glyphs"]:
+        w("    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d},"
+          % (g[2], g[3], g[4], g[5], g[6], g[7]))
+    out[-1] = out[-1].rstrip(",")
+    w("};")
+    w("")
+    w("/*---------------------")
+    w(" *  CHARACTER MAPPING")
+    w(" *--------------------*/")
+    w("")
+    for i, cm in enumerate(font["cmaps"]):
+        if cm[0] == "sparse":
+            w("static const uint16_t unicode_list_%d[] = {" % i)
+            ofs = [cp - cm[1] for cp in cm[4]]
+            for j in range(0, len(ofs), 8):
+                w("    " + ", ".join("0x%x" % v for v in ofs[j:j + 8]) + ",")
+            out[-1] = out[-1].rstrip(",")
+            w("};")
+            w("")
+    w("/*Collect the unicode lists and glyph_id offsets*/")
+    w("static const lv_font_fmt_txt_cmap_t cmaps[] = {")
+    entries = []
+    for i, cm in enumerate(font["cmaps"]):
+        if cm[0] == "sparse":
+            entries.append("    {\n        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+                           "        .unicode_list = unicode_list_%d, .glyph_id_ofs_list = NULL, .list_length = %d, "
+                           ".type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY\n    }" % (cm[1], cm[2], cm[3], i, len(cm[4])))
+        else:
+            entries.append("    {\n        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+                           "        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, "
+                           ".type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY\n    }" % (cm[1], cm[2], cm[3]))
+    w(",\n".join(entries))
+    w("};")
+    w("")
+
+    kern = font["kern"]
+    if kern:
+        left_map, right_map, left_cnt, right_cnt, values = kern
+        w("/*-----------------")
+        w(" *    KERNING")
+        w(" *----------------*/")
+        w("")
+        w("")
+        w("/*Map glyph_ids to kern left classes*/")
+        w("static const uint8_t kern_left_class_mapping[] = {")
+        for j in range(0, len(left_map), 16):
+            w("    " + ", ".join(str(v) for v in left_map[j:j + 16]) + ",")
+        out[-1] = out[-1].rstrip(",")
+        w("};")
+        w("")
+        w("/*Map glyph_ids to kern right classes*/")
+        w("static const uint8_t kern_right_class_mapping[] = {")
+        for j in range(0, len(right_map), 16):
+            w("    " + ", ".join(str(v) for v in right_map[j:j + 16]) + ",")
+        out[-1] = out[-1].rstrip(",")
+        w("};")
+        w("")
+        w("/*Kern values between classes*/")
+        w("static const int8_t kern_class_values[] = {")
+        for j in range(0, len(values), 16):
+            w("    " + ", ".join(str(v) for v in values[j:j + 16]) + ",")
+        out[-1] = out[-1].rstrip(",")
+        w("};")
+        w("")
+        w("")
+        w("/*Collect the kern class' data in one place*/")
+        w("static const lv_font_fmt_txt_kern_classes_t kern_classes = {")
+        w("    .class_pair_values   = kern_class_values,")
+        w("    .left_class_mapping  = kern_left_class_mapping,")
+        w("    .right_class_mapping = kern_right_class_mapping,")
+        w("    .left_class_cnt      = %d," % left_cnt)
+        w("    .right_class_cnt     = %d," % right_cnt)
+        w("};")
+        w("")
+    w("/*--------------------")
+    w(" *  ALL CUSTOM DATA")
+    w(" *--------------------*/")
+    w("")
+    w("/*Store all the custom data of the font*/")
+    w("static lv_font_fmt_txt_glyph_cache_t cache;")
+    w("static const lv_font_fmt_txt_dsc_t font_dsc = {")
+    w("    .glyph_bitmap = glyph_bitmap,")
+    w("    .glyph_dsc = glyph_dsc,")
+    w("    .cmaps = cmaps,")
+    w("    .kern_dsc = %s," % ("&kern_classes" if kern else "NULL"))
+    w("    .kern_scale = %d," % font["kern_scale"])
+    w("    .cmap_num = %d," % len(font["cmaps"]))
+    w("    .bpp = %d," % BPP)
+    w("    .kern_classes = %d," % (1 if kern else 0))
+    w("    .bitmap_format = %s," % ("LV_FONT_FMT_TXT_COMPRESSED" if font["compressed"] else "LV_FONT_FMT_TXT_PLAIN"))
+    w("    .cache = &cache")
+    w("};")
+    w("")
+    w("")
+    w("/*-----------------")
+    w(" *  PUBLIC FONT")
+    w(" *----------------*/")
+    w("")
+    w("/*Initialize a public general font descriptor*/")
+    w("const lv_font_t %s = {" % name)
+    w("    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/")
+    w("    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/")
+    w("    .line_height = %d,          /*The maximum line height required by the font*/" % font["line_height"])
+    w("    .base_line = %d,             /*Baseline measured from the bottom of the line*/" % font["base_line"])
+    w("    .subpx = LV_FONT_SUBPX_NONE,")
+    w("    .underline_position = %d," % font["underline_position"])
+    w("    .underline_thickness = %d," % font["underline_thickness"])
+    w("    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */")
+    w("};")
+    w("")
+    return "\n".join(out)
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path, "r", encoding="utf-8") as f:
+            if f.read() == text:
+                return False
+    with open(path + ".tmp", "w", encoding="utf-8") as f:
+        f.write(text)
+    os.replace(path + ".tmp", path)
+    return True
+
+
+def build(project_dir, out_dir, verbose=False):
+    src = Sources(project_dir, *import_fonttools())
+    os.makedirs(out_dir, exist_ok=True)
+    total = 0
+    for size in sorted(FONTS):
+        font = generate_font(src, project_dir, size)
+        path = os.path.join(out_dir, "lv_font_montserrat_%d.c" % size)
+        changed = write_if_changed(path, to_c(font))
+        total += len(font["bitmap"])
+        if verbose:
+            print("montserrat_%-3d %-6s %3d glyphs  %6d bytes %-5s  line_height=%d base_line=%d%s" % (
+                size, font["kind"], len(font["glyphs"]), len(font["bitmap"]),
+                "rle" if font["compressed"] else "plain",
+                font["line_height"], font["base_line"], "" if changed else "  (unchanged)"))
+        if font["missing"]:
+            print("gen_fonts: montserrat_%d: no glyph for %s" % (
+                size, ", ".join("U+%04X" % cp for cp in font["missing"])))
+    print("gen_fonts: %d sizes, %d bitmap bytes (%s)" % (len(FONTS), total, out_dir))
+
+
+def check(project_dir, out_dir):
+    """Compara o que seria gerado com os .c versionados; retorna os tamanhos velhos."""
+    src = Sources(project_dir, *import_fonttools())
+    stale = []
+    for size in sorted(FONTS):
+        path = os.path.join(out_dir, "lv_font_montserrat_%d.c" % size)
+        try:
+            with open(path, encoding="utf-8") as f:
+                current = f.read()
+        except OSError:
+            current = None
+        if current != to_c(generate_font(src, project_dir, size)):
+            stale.append(size)
+    return stale
+
+
+if __name__ == "__main__":
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..")
+    if sys.argv[1:] == ["--check"]:
+        stale = check(root, os.path.join(root, OUT_DIR))
+        if stale:
+            print("gen_fonts: out of date: %s; run python tools/fonts/gen_fonts.py" % ", ".join(
+                "montserrat_%d" % s for s in stale))
+            sys.exit(1)
+        print("gen_fonts: %s is up to date" % OUT_DIR)
+    else:
+        build(root, sys.argv[1] if len(sys.argv) > 1 else os.path.join(root, OUT_DIR), verbose=True)
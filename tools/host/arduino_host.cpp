@@ -0,0 +1,78 @@
+#include <Arduino.h>
+#include <chrono>
+
+HostSerial Serial;
+HostESP ESP;
+
+static const std::chrono::steady_clock::time_point boot = std::chrono::steady_clock::now();
+// Tempo "dormido" em delay(): somado ao relógio em vez de esperar de verdade
+static uint64_t skipped_us = 0;
+
+static uint64_t now_us() {
+    using namespace std::chrono;
+    return (uint64_t)duration_cast<microseconds>(steady_clock::now() - boot).count() + skipped_us;
+}
+
+extern "C" uint32_t millis(void) {
+    return (uint32_t)(now_us() / 1000);
+}
+
+extern "C" uint32_t micros(void) {
+    return (uint32_t)now_us();
+}
+
+// Relógio de parede: anda com o millis() virtual e começa em 1970, como o
+// aparelho antes do NTP, a menos que host_set_epoch() dê outra data
+static time_t epoch = 0;
+
+extern "C" time_t time(time_t* out) noexcept {
+    time_t t = epoch + (time_t)(now_us() / 1000000);
+    if (out) *out = t;
+    return t;
+}
+
+void host_set_epoch(time_t t) {
+    epoch = t - (time_t)(now_us() / 1000000);
+}
+
+void delay(uint32_t ms) {
+    skipped_us += (uint64_t)ms * 1000;
+}
+
+void delayMicroseconds(uint32_t us) {
+    skipped_us += us;
+}
+
+// Níveis escritos por digitalWrite(), por pino
+static uint8_t pin_levels[64] = {};
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+    if (pin < 64) pin_levels[pin] = level;
+}
+
+uint8_t host_pin_level(uint8_t pin) {
+    return pin < 64 ? pin_levels[pin] : LOW;
+}
+
+// ISRs registradas por attachInterrupt(), por pino
+static void (*isrs[64])(void) = {};
+
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode) {
+    (void)mode;
+    if (pin < 64) isrs[pin] = isr;
+}
+
+void host_fire_interrupt(uint8_t pin) {
+    if (pin < 64 && isrs[pin]) isrs[pin]();
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack, void* param, int priority,
+                       TaskHandle_t* handle) {
+    (void)name;
+    (void)stack;
+    (void)priority;
+    // O handle é preenchido antes: as tarefas dos apps o zeram ao terminar
+    if (handle) *handle = (TaskHandle_t)fn;
+    fn(param);
+    return pdPASS;
+}
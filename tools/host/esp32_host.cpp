@@ -0,0 +1,315 @@
+// Definições dos shims de periféricos do host (tools/host/include): Wi-Fi,
+// HTTP, Preferences, I2C, SPI (Arduino e spi_master) e partições. Só as
+// ferramentas que compilam os apps precisam deste arquivo; as demais usam
+// apenas arduino_host.cpp.
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <Preferences.h>
+#include <SPI.h>
+#include <WiFi.h>
+#include <Wire.h>
+#include <driver/spi_master.h>
+#include <esp_partition.h>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+WiFiClass WiFi;
+TwoWire Wire;
+SPIClass SPI;
+
+// --- WiFi ---
+
+void WiFiClass::host_add_network(const char* ssid, int32_t rssi, wifi_auth_mode_t auth) {
+    if (count_ >= MAX_NETWORKS) return;
+    networks_[count_].ssid = ssid;
+    networks_[count_].rssi = rssi;
+    networks_[count_].auth = auth;
+    count_++;
+}
+
+void WiFiClass::host_set_connected(const char* ssid) {
+    connected_ = ssid != nullptr;
+    ssid_ = ssid ? ssid : "";
+}
+
+wl_status_t WiFiClass::begin(const char* ssid, const char* passphrase) {
+    (void)passphrase;
+    for (uint8_t i = 0; i < count_; i++) {
+        if (networks_[i].ssid == ssid) {
+            host_set_connected(ssid);
+            return WL_CONNECTED;
+        }
+    }
+    host_set_connected(nullptr);
+    return WL_NO_SSID_AVAIL;
+}
+
+bool WiFiClass::disconnect(bool wifi_off, bool erase_ap) {
+    (void)wifi_off;
+    (void)erase_ap;
+    host_set_connected(nullptr);
+    return true;
+}
+
+// --- HTTPClient ---
+
+namespace {
+
+struct Route {
+    std::string url_part;
+    int code;
+    std::string body;
+};
+
+std::vector<Route>& routes() {
+    static std::vector<Route> r;
+    return r;
+}
+
+} // namespace
+
+void HTTPClient::host_route(const char* url_part, int code, const String& body) {
+    for (Route& r : routes()) {
+        if (r.url_part == url_part) {
+            r.code = code;
+            r.body = body.c_str();
+            return;
+        }
+    }
+    routes().push_back(Route{url_part, code, body.c_str()});
+}
+
+void HTTPClient::host_clear_routes() {
+    routes().clear();
+}
+
+int HTTPClient::request() {
+    body_ = "";
+    if (WiFi.status() != WL_CONNECTED) return HTTPC_ERROR_CONNECTION_REFUSED;
+    for (const Route& r : routes()) {
+        if (strstr(url_.c_str(), r.url_part.c_str())) {
+            body_ = String(r.body);
+            return r.code;
+        }
+    }
+    return HTTP_CODE_NOT_FOUND;
+}
+
+// --- Preferences ---
+
+namespace {
+
+std::map<std::string, std::string>& prefs() {
+    static std::map<std::string, std::string> p;
+    return p;
+}
+
+std::string pref_key(const String& name, const char* key) {
+    return std::string(name.c_str()) + "/" + key;
+}
+
+} // namespace
+
+String Preferences::getString(const char* key, const String& default_value) {
+    auto it = prefs().find(pref_key(name_, key));
+    return it == prefs().end() ? default_value : String(it->second);
+}
+
+size_t Preferences::putString(const char* key, const String& value) {
+    prefs()[pref_key(name_, key)] = value.c_str();
+    return value.length();
+}
+
+bool Preferences::remove(const char* key) {
+    return prefs().erase(pref_key(name_, key)) > 0;
+}
+
+bool Preferences::clear() {
+    std::string prefix = std::string(name_.c_str()) + "/";
+    for (auto it = prefs().begin(); it != prefs().end();) {
+        if (it->first.compare(0, prefix.size(), prefix) == 0) it = prefs().erase(it);
+        else ++it;
+    }
+    return true;
+}
+
+// --- Wire ---
+
+namespace {
+
+std::map<uint8_t, std::deque<uint8_t>>& i2c_queues() {
+    static std::map<uint8_t, std::deque<uint8_t>> q;
+    return q;
+}
+
+} // namespace
+
+void TwoWire::host_push(uint8_t address, uint8_t value) {
+    i2c_queues()[address].push_back(value);
+}
+
+uint8_t TwoWire::requestFrom(int address, int quantity) {
+    std::deque<uint8_t>& q = i2c_queues()[(uint8_t)address];
+    rx_len_ = 0;
+    rx_pos_ = 0;
+    while (rx_len_ < quantity && rx_len_ < (int)sizeof(rx_) && !q.empty()) {
+        rx_[rx_len_++] = q.front();
+        q.pop_front();
+    }
+    return (uint8_t)rx_len_;
+}
+
+int TwoWire::available() {
+    return rx_len_ - rx_pos_;
+}
+
+int TwoWire::read() {
+    return rx_pos_ < rx_len_ ? rx_[rx_pos_++] : -1;
+}
+
+// --- esp_partition ---
+
+namespace {
+
+std::deque<esp_partition_t>& partitions() {
+    static std::deque<esp_partition_t> p; // deque: os ponteiros devolvidos continuam válidos
+    return p;
+}
+
+} // namespace
+
+bool host_partition_load(const char* label, const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t* data = size > 0 ? (uint8_t*)malloc(size) : nullptr;
+    bool ok = data && fread(data, 1, size, f) == (size_t)size;
+    fclose(f);
+    if (!ok) {
+        free(data);
+        return false;
+    }
+
+    esp_partition_t part = {};
+    part.type = ESP_PARTITION_TYPE_DATA;
+    part.subtype = ESP_PARTITION_SUBTYPE_ANY;
+    part.size = (uint32_t)size;
+    strncpy(part.label, label, sizeof(part.label) - 1);
+    part.host_data = data;
+    partitions().push_back(part);
+    return true;
+}
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char* label) {
+    (void)subtype;
+    for (const esp_partition_t& p : partitions()) {
+        if (p.type == type && (!label || strcmp(p.label, label) == 0)) return &p;
+    }
+    return nullptr;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t* partition, size_t offset, size_t size,
+                             spi_flash_mmap_memory_t memory, const void** out_ptr,
+                             spi_flash_mmap_handle_t* out_handle) {
+    (void)memory;
+    if (!partition || offset + size > partition->size) return ESP_FAIL;
+    *out_ptr = partition->host_data + offset;
+    *out_handle = 0;
+    return ESP_OK;
+}
+
+// --- spi_master ---
+
+struct host_spi_device {
+    spi_device_interface_config_t config;
+    spi_transaction_t* done;    // Resultado do último queue_trans
+};
+
+namespace {
+
+struct SpiSink {
+    host_spi_sink_t fn;
+    void* ctx;
+};
+
+std::map<int, SpiSink>& spi_sinks() {
+    static std::map<int, SpiSink> sinks;
+    return sinks;
+}
+
+void spi_run(spi_device_handle_t dev, spi_transaction_t* t) {
+    if (dev->config.pre_cb) dev->config.pre_cb(t);
+    size_t len = t->length / 8;
+    const uint8_t* tx = (t->flags & SPI_TRANS_USE_TXDATA) ? t->tx_data : (const uint8_t*)t->tx_buffer;
+    uint8_t* rx = (t->flags & SPI_TRANS_USE_RXDATA) ? t->rx_data : (uint8_t*)t->rx_buffer;
+    auto it = spi_sinks().find(dev->config.spics_io_num);
+    if (it != spi_sinks().end()) it->second.fn(it->second.ctx, tx, rx, len);
+    else if (rx) memset(rx, 0xFF, len);
+    if (dev->config.post_cb) dev->config.post_cb(t);
+}
+
+} // namespace
+
+void host_spi_attach(int cs, host_spi_sink_t sink, void* ctx) {
+    spi_sinks()[cs] = SpiSink{sink, ctx};
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t* config, int dma_chan) {
+    (void)host;
+    (void)config;
+    (void)dma_chan;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_free(spi_host_device_t host) {
+    (void)host;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t* config,
+                             spi_device_handle_t* handle) {
+    (void)host;
+    *handle = new host_spi_device{*config, nullptr};
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle) {
+    delete handle;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t* trans) {
+    spi_run(handle, trans);
+    return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t* trans, TickType_t wait) {
+    (void)wait;
+    spi_run(handle, trans);
+    handle->done = trans;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t** trans, TickType_t wait) {
+    (void)wait;
+    if (!handle->done) return ESP_FAIL;
+    *trans = handle->done;
+    handle->done = nullptr;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_acquire_bus(spi_device_handle_t handle, TickType_t wait) {
+    (void)handle;
+    (void)wait;
+    return ESP_OK;
+}
+
+void spi_device_release_bus(spi_device_handle_t handle) {
+    (void)handle;
+}
@@ -0,0 +1,249 @@
+#pragma once
+
+/**
+ * Host Arduino shim
+ *
+ * Substitui o Arduino.h do ESP32 nos builds de host (ferramentas em tools/).
+ * Cobre o que o código em src/ usa: millis(), micros(), delay(), Serial.printf(),
+ * as variantes ps_* de malloc, a classe String, os pinos (sem efeito), o objeto
+ * ESP e o pouco de FreeRTOS que os apps usam.
+ *
+ * - delay() não dorme: avança o relógio de millis()/micros(), então timeouts
+ *   e animações do LVGL andam sem deixar as ferramentas lentas.
+ * - time() segue o mesmo relógio, a partir de 1970 (sem NTP) ou da data dada
+ *   a host_set_epoch().
+ * - xTaskCreate() roda a tarefa até o fim dentro da própria chamada; os mutexes
+ *   sempre são obtidos na hora.
+ * - attachInterrupt() guarda a ISR do pino; host_fire_interrupt() a chama, como
+ *   uma borda no pino (ex: o simulador mexendo o trackball).
+ * - digitalWrite() guarda o nível do pino para os periféricos simulados
+ *   (host_pin_level(), ex: o DC do ST7789 do TFT_eSPI do host).
+ *
+ * As definições ficam em tools/host/arduino_host.cpp.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t millis(void);
+uint32_t micros(void);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+
+#include <string>
+
+#define IRAM_ATTR
+
+#define LOW 0x0
+#define HIGH 0x1
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void host_set_epoch(time_t t);
+
+inline void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t pin, uint8_t level);
+uint8_t host_pin_level(uint8_t pin);
+inline int digitalRead(uint8_t) { return HIGH; }
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode);
+void host_fire_interrupt(uint8_t pin);
+
+inline uint32_t ledcSetup(uint8_t, uint32_t freq, uint8_t) { return freq; }
+inline void ledcAttachPin(uint8_t, uint8_t) {}
+inline void ledcWrite(uint8_t, uint32_t) {}
+
+inline void configTime(long, int, const char*, const char* = nullptr, const char* = nullptr) {}
+
+inline void* ps_malloc(size_t size) { return malloc(size); }
+inline void* ps_realloc(void* ptr, size_t size) { return realloc(ptr, size); }
+
+/*String do Arduino sobre std::string, com o que os apps e o ArduinoJson usam*/
+class String {
+public:
+    String(const char* s = "") : s_(s ? s : "") {}
+    String(const std::string& s) : s_(s) {}
+    explicit String(char c) : s_(1, c) {}
+    explicit String(int v) : s_(std::to_string(v)) {}
+    explicit String(unsigned int v) : s_(std::to_string(v)) {}
+    explicit String(long v) : s_(std::to_string(v)) {}
+    explicit String(unsigned long v) : s_(std::to_string(v)) {}
+    explicit String(double v, unsigned int decimals = 2) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+        s_ = buf;
+    }
+
+    const char* c_str() const { return s_.c_str(); }
+    unsigned int length() const { return (unsigned int)s_.length(); }
+    bool isEmpty() const { return s_.empty(); }
+    char operator[](unsigned int i) const { return i < s_.length() ? s_[i] : 0; }
+    int toInt() const { return atoi(s_.c_str()); }
+    int indexOf(char c, unsigned int from = 0) const {
+        size_t i = s_.find(c, from);
+        return i == std::string::npos ? -1 : (int)i;
+    }
+    int indexOf(const char* s, unsigned int from = 0) const {
+        size_t i = s_.find(s, from);
+        return i == std::string::npos ? -1 : (int)i;
+    }
+    bool startsWith(const String& s) const { return s_.compare(0, s.s_.length(), s.s_) == 0; }
+    String substring(unsigned int from, unsigned int to = 0xFFFFFFFF) const {
+        if (from > s_.length()) return String();
+        return String(s_.substr(from, to < from ? 0 : to - from));
+    }
+
+    String& operator=(const char* s) {
+        s_ = s ? s : "";
+        return *this;
+    }
+    bool concat(const char* s) {
+        if (s) s_ += s;
+        return true;
+    }
+    bool concat(const String& s) {
+        s_ += s.s_;
+        return true;
+    }
+    String& operator+=(const String& s) {
+        s_ += s.s_;
+        return *this;
+    }
+    String& operator+=(const char* s) {
+        concat(s);
+        return *this;
+    }
+    String& operator+=(char c) {
+        s_ += c;
+        return *this;
+    }
+    String& operator+=(int v) {
+        s_ += std::to_string(v);
+        return *this;
+    }
+
+    bool operator==(const String& s) const { return s_ == s.s_; }
+    bool operator==(const char* s) const { return s_ == (s ? s : ""); }
+    bool operator!=(const String& s) const { return s_ != s.s_; }
+    bool operator!=(const char* s) const { return !(*this == s); }
+
+    friend String operator+(String a, const String& b) {
+        a += b;
+        return a;
+    }
+    friend String operator+(String a, const char* b) {
+        a += b;
+        return a;
+    }
+
+private:
+    std::string s_;
+};
+
+struct HostSerial {
+    void begin(unsigned long) {}
+    template <typename... Args>
+    int printf(const char* fmt, Args... args) { return ::printf(fmt, args...); }
+    void println() { ::puts(""); }
+    void println(const char* s) { ::puts(s); }
+    void println(const String& s) { ::puts(s.c_str()); }
+    void println(int v) { ::printf("%d\n", v); }
+    void print(const char* s) { ::fputs(s, stdout); }
+    void print(const String& s) { ::fputs(s.c_str(), stdout); }
+    void print(char c) { ::putchar(c); }
+    void print(int v) { ::printf("%d", v); }
+    size_t write(const uint8_t* buf, size_t len) { return ::fwrite(buf, 1, len, stdout); }
+    int availableForWrite() { return 4096; }
+};
+
+extern HostSerial Serial;
+
+/*ESP: valores fixos de um ESP32-S3 com 8 MB de PSRAM, para telas determinísticas*/
+struct HostESP {
+    uint32_t getFreeHeap() { return 256u * 1024; }
+    uint32_t getHeapSize() { return 320u * 1024; }
+    uint32_t getFreePsram() { return 8u * 1024 * 1024; }
+    uint32_t getPsramSize() { return 8u * 1024 * 1024; }
+    const char* getChipModel() { return "ESP32-S3"; }
+    uint8_t getChipCores() { return 2; }
+    uint32_t getCpuFreqMHz() { return 240; }
+    uint32_t getCycleCount() { return micros() * 240; }
+};
+
+extern HostESP ESP;
+
+// --- FreeRTOS ---
+typedef void* TaskHandle_t;
+typedef void* SemaphoreHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack, void* param, int priority,
+                       TaskHandle_t* handle);
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack, void* param,
+                                          int priority, TaskHandle_t* handle, int) {
+    return xTaskCreate(fn, name, stack, param, priority, handle);
+}
+inline void vTaskDelete(TaskHandle_t) {}
+inline void vTaskDelay(TickType_t ticks) { delay(ticks); }
+
+// Um só "núcleo" e sem interrupções de verdade: as seções críticas não fazem nada
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+#define portSET_INTERRUPT_MASK_FROM_ISR() 0u
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR(mask) ((void)(mask))
+inline BaseType_t xPortGetCoreID() { return 1; } // loopTask roda no núcleo 1
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { return (TaskHandle_t)1; }
+
+// O StallDetector precisa de uma tarefa rodando em paralelo com o loop(), que
+// o xTaskCreate() síncrono daqui não tem: no host ele fica desligado
+#ifndef STALL_DETECTOR_ENABLE
+#define STALL_DETECTOR_ENABLE 0
+#endif
+// Pelo mesmo motivo o PdaLog formata e escreve na própria chamada
+#ifndef PDA_LOG_ASYNC
+#define PDA_LOG_ASYNC 0
+#endif
+// e o SpiBus atende a fila dentro do submit()
+#ifndef SPI_BUS_ASYNC
+#define SPI_BUS_ASYNC 0
+#endif
+// e o SdCard monta no begin() e lê adiante dentro do lv_fs_read(); o "cartão" é um diretório
+#ifndef SD_CARD_ASYNC
+#define SD_CARD_ASYNC 0
+#endif
+#ifndef SD_CARD_MOUNT
+#define SD_CARD_MOUNT ".pio/host/sd"
+#endif
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return (SemaphoreHandle_t)1; }
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t) { return pdTRUE; }
+
+#endif /*__cplusplus*/
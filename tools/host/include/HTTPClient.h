@@ -0,0 +1,67 @@
+#pragma once
+
+/**
+ * Host HTTPClient shim
+ *
+ * Não acessa a rede: cada requisição é respondida pela primeira rota cujo
+ * trecho de URL aparece na URL pedida (host_route), com o código e o corpo
+ * registrados. Sem Wi-Fi conectado (WiFi.h), falha como sem conexão; sem rota,
+ * responde 404.
+ */
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#define HTTP_CODE_OK 200
+#define HTTP_CODE_CREATED 201
+#define HTTP_CODE_MOVED_PERMANENTLY 301
+#define HTTP_CODE_FOUND 302
+#define HTTP_CODE_TEMPORARY_REDIRECT 307
+#define HTTP_CODE_PERMANENT_REDIRECT 308
+#define HTTP_CODE_NOT_FOUND 404
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+
+class HTTPClient {
+public:
+    bool begin(const String& url) {
+        url_ = url;
+        return true;
+    }
+    void end() {
+        url_ = "";
+        body_ = "";
+    }
+    void addHeader(const String& name, const String& value) {
+        (void)name;
+        (void)value;
+    }
+    void setTimeout(uint16_t ms) { (void)ms; }
+    void setConnectTimeout(int32_t ms) { (void)ms; }
+    void collectHeaders(const char* keys[], size_t count) {
+        (void)keys;
+        (void)count;
+    }
+    String header(const char* name) {
+        (void)name;
+        return String();
+    }
+    int GET() { return request(); }
+    int POST(const String& payload) {
+        (void)payload;
+        return request();
+    }
+    String getString() { return body_; }
+    static String errorToString(int code) { return code < 0 ? String("connection refused") : String(); }
+
+    /*Host: responde com `code` e `body` as URLs que contêm `url_part`*/
+    static void host_route(const char* url_part, int code, const String& body);
+    /*Host: remove todas as rotas*/
+    static void host_clear_routes();
+
+private:
+    int request();
+
+    String url_;
+    String body_;
+};
@@ -0,0 +1,28 @@
+#pragma once
+
+/**
+ * Host Preferences shim
+ *
+ * Guarda os valores em memória (nada vai para o disco), separados pelo
+ * namespace passado a begin(). Cada execução começa sem nada salvo.
+ */
+
+#include <Arduino.h>
+
+class Preferences {
+public:
+    bool begin(const char* name, bool read_only = false, const char* partition = nullptr) {
+        (void)read_only;
+        (void)partition;
+        name_ = name;
+        return true;
+    }
+    void end() { name_ = ""; }
+    String getString(const char* key, const String& default_value = String());
+    size_t putString(const char* key, const String& value);
+    bool remove(const char* key);
+    bool clear();
+
+private:
+    String name_;
+};
@@ -0,0 +1,215 @@
+#pragma once
+
+/**
+ * Host TFT_eSPI shim
+ *
+ * Em vez do ST7789 do T-Deck, os pixels vão para um framebuffer em memória
+ * (TFT_HEIGHT x TFT_WIDTH depois do setRotation(1)), exatamente como o flush
+ * do DisplayTouch os entrega ao SPI: RGB565 com os bytes trocados
+ * (LV_COLOR_16_SWAP). setAddrWindow(), pushColors(), writecommand() e
+ * writedata() passam pelo mesmo decodificador do ST7789 descrito abaixo.
+ *
+ * Depois do begin() o shim também é um ST7789 no TFT_CS do spi_master do host:
+ * decodifica CASET, RASET e RAMWR (DC lido com host_pin_level(TFT_DC)) e
+ * escreve no mesmo framebuffer. É por aí que chega o flush feito pelo SpiBus.
+ * Com o COLMOD em 12 bits (0x53), o RAMWR chega em RGB444 e cada canal é
+ * expandido como o painel faz (repetindo os bits altos).
+ *
+ * O framebuffer é a GRAM. A rolagem vertical (VSCRDEF/VSCSAD) é aplicada na
+ * leitura, como na varredura do painel: host_framebuffer() e host_write_ppm()
+ * mostram o que aparece na tela. O eixo da rolagem são as 320 linhas do
+ * painel, o X da tela nas rotações 1 e 3, invertido nas rotações 2 e 3 (a
+ * mesma convenção do system/tft_scroll.cpp).
+ */
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <driver/spi_master.h>
+
+#define TFT_WIDTH 240
+#define TFT_HEIGHT 320
+#define TFT_BLACK 0x0000
+
+/*Pinos do User_Setups/Setup210_LilyGo_T_Deck.h*/
+#define TFT_CS 12
+#define TFT_DC 11
+
+class TFT_eSPI {
+public:
+    void begin() { host_spi_attach(TFT_CS, host_spi_sink, this); }
+    void init() {}
+    void setRotation(uint8_t r) { rotation_ = r & 3; }
+    uint8_t getRotation() const { return rotation_; }
+    int16_t width() const { return (rotation_ & 1) ? TFT_HEIGHT : TFT_WIDTH; }
+    int16_t height() const { return (rotation_ & 1) ? TFT_WIDTH : TFT_HEIGHT; }
+    void fillScreen(uint32_t color) {
+        for (int i = 0; i < TFT_WIDTH * TFT_HEIGHT; i++) fb_[i] = (uint16_t)color;
+    }
+    void startWrite() {}
+    void endWrite() {}
+    /*Comando e parâmetro avulsos: passam pelo mesmo ST7789 do spi_master*/
+    void writecommand(uint8_t c) { spi_command(c); }
+    void writedata(uint8_t d) { spi_data(d); }
+    /*CASET, RASET e RAMWR, como o TFT_eSPI manda*/
+    void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+        uint16_t x2 = (uint16_t)(x + w - 1), y2 = (uint16_t)(y + h - 1);
+        const uint8_t caset[4] = {(uint8_t)(x >> 8), (uint8_t)x, (uint8_t)(x2 >> 8), (uint8_t)x2};
+        const uint8_t raset[4] = {(uint8_t)(y >> 8), (uint8_t)y, (uint8_t)(y2 >> 8), (uint8_t)y2};
+        spi_command(0x2A);
+        for (uint8_t b : caset) spi_data(b);
+        spi_command(0x2B);
+        for (uint8_t b : raset) spi_data(b);
+        spi_command(0x2C);
+    }
+    /*Sem troca (swap false), os bytes vão na ordem da memória, como o flush os entrega*/
+    void pushColors(uint16_t* data, uint32_t len, bool swap = true) {
+        (void)swap;
+        const uint8_t* p = (const uint8_t*)data;
+        size_t i = 0, n = len * 2;
+        while (i < n) {
+            if (cmd_ == 0x2C && !rgb444_ && !(param_ & 1)) i += spi_pixels(p + i, n - i);
+            else spi_data(p[i++]);
+        }
+    }
+
+    /*Host: o conteúdo atual da tela, width() x height() pixels*/
+    const uint16_t* host_framebuffer() const {
+        if (vsa_ == 0 || (vsp_ - tfa_) % vsa_ == 0) return fb_;
+        bool axis_x = rotation_ & 1;
+        int w = width(), h = height();
+        for (int a = 0; a < TFT_HEIGHT; a++) {
+            int src = scan_line(a);
+            if (axis_x) {
+                for (int y = 0; y < h; y++) view_[y * w + a] = fb_[y * w + src];
+            } else {
+                memcpy(&view_[a * w], &fb_[src * w], w * sizeof(uint16_t));
+            }
+        }
+        return view_;
+    }
+
+    /*Host: grava a tela como imagem PPM (RGB888)*/
+    bool host_write_ppm(const char* path) const {
+        FILE* f = fopen(path, "wb");
+        if (!f) return false;
+        fprintf(f, "P6\n%d %d\n255\n", width(), height());
+        const uint16_t* fb = host_framebuffer();
+        for (int i = 0; i < width() * height(); i++) {
+            uint16_t c = (uint16_t)((fb[i] << 8) | (fb[i] >> 8)); // Desfaz a troca de bytes
+            uint8_t rgb[3] = {(uint8_t)((c >> 11) << 3), (uint8_t)(((c >> 5) & 0x3F) << 2), (uint8_t)((c & 0x1F) << 3)};
+            fwrite(rgb, 1, 3, f);
+        }
+        return fclose(f) == 0;
+    }
+
+private:
+    /*Coordenada da GRAM mostrada na coordenada `a` do eixo da rolagem*/
+    int scan_line(int a) const {
+        bool mirrored = rotation_ >= 2;
+        int p = mirrored ? TFT_HEIGHT - 1 - a : a;
+        if (p >= tfa_ && p < tfa_ + vsa_) p = tfa_ + ((p - tfa_) + (vsp_ - tfa_) % vsa_ + vsa_) % vsa_;
+        return mirrored ? TFT_HEIGHT - 1 - p : p;
+    }
+
+    /*ST7789 no spi_master do host: comandos com DC baixo, parâmetros e pixels com DC alto*/
+    static void host_spi_sink(void* ctx, const uint8_t* tx, uint8_t* rx, size_t len) {
+        TFT_eSPI* self = (TFT_eSPI*)ctx;
+        if (rx) memset(rx, 0xFF, len);
+        if (!tx) return;
+        bool command = host_pin_level(TFT_DC) == LOW;
+        size_t i = 0;
+        while (i < len) {
+            if (command) {
+                self->spi_command(tx[i++]);
+            } else if (self->cmd_ == 0x2C && !self->rgb444_ && !(self->param_ & 1)) {
+                i += self->spi_pixels(tx + i, len - i);
+            } else {
+                self->spi_data(tx[i++]);
+            }
+        }
+    }
+
+    /*RAMWR alinhado num pixel: copia o que couber na linha atual de uma vez*/
+    size_t spi_pixels(const uint8_t* data, size_t len) {
+        if (len < 2 || cur_y_ > row_[1] || cur_y_ >= height() || col_[1] >= width()) {
+            spi_data(data[0]);
+            return 1;
+        }
+        size_t px = col_[1] - cur_x_ + 1;
+        if (px > len / 2) px = len / 2;
+        memcpy(&fb_[cur_y_ * width() + cur_x_], data, px * 2);
+        param_ += (uint32_t)(px * 2);
+        cur_x_ += (uint16_t)px;
+        if (cur_x_ > col_[1]) {
+            cur_x_ = col_[0];
+            cur_y_++;
+        }
+        return px * 2;
+    }
+
+    void spi_command(uint8_t cmd) {
+        cmd_ = cmd;
+        param_ = 0;
+        if (cmd == 0x2C) { // RAMWR: volta ao início da janela
+            cur_x_ = col_[0];
+            cur_y_ = row_[0];
+        }
+    }
+
+    void spi_data(uint8_t b) {
+        if (cmd_ == 0x2A || cmd_ == 0x2B) { // CASET/RASET: início e fim, 16 bits big-endian cada
+            uint16_t* range = cmd_ == 0x2A ? col_ : row_;
+            if (param_ < 4) {
+                uint16_t& v = range[param_ / 2];
+                v = (param_ & 1) ? (uint16_t)((v & 0xFF00) | b) : (uint16_t)(b << 8);
+            }
+            param_++;
+        } else if (cmd_ == 0x33 || cmd_ == 0x37) { // VSCRDEF (TFA, VSA, BFA) e VSCSAD, 16 bits big-endian
+            if (param_ < sizeof(scroll_)) scroll_[param_] = b;
+            param_++;
+            if (cmd_ == 0x33 && param_ == 6) {
+                tfa_ = (scroll_[0] << 8) | scroll_[1];
+                vsa_ = (scroll_[2] << 8) | scroll_[3];
+            } else if (cmd_ == 0x37 && param_ == 2) {
+                vsp_ = (scroll_[0] << 8) | scroll_[1];
+            }
+        } else if (cmd_ == 0x3A) { // COLMOD: 0x55 = 16 bits, 0x53 = 12 bits por pixel
+            rgb444_ = (b & 0x07) == 0x03;
+        } else if ((cmd_ == 0x2C || cmd_ == 0x3C) && rgb444_) { // RAMWR em 12 bits: três nibbles por pixel
+            for (int shift = 4; shift >= 0; shift -= 4) {
+                nibbles_ = (nibbles_ << 4) | ((b >> shift) & 0x0F);
+                if (++param_ % 3) continue;
+                uint16_t r = (nibbles_ >> 8) & 0x0F, g = (nibbles_ >> 4) & 0x0F, bl = nibbles_ & 0x0F;
+                uint16_t c = (uint16_t)((r << 1 | r >> 3) << 11 | (g << 2 | g >> 2) << 5 | (bl << 1 | bl >> 3));
+                put_pixel((uint16_t)(c << 8 | c >> 8));
+            }
+        } else if (cmd_ == 0x2C || cmd_ == 0x3C) { // RAMWR/RAMWRC: dois bytes por pixel
+            pixel_[param_++ & 1] = b;
+            if (param_ & 1) return;
+            uint16_t c;
+            memcpy(&c, pixel_, 2); // Os bytes na ordem do fio, como o pushColors()
+            put_pixel(c);
+        }
+    }
+
+    void put_pixel(uint16_t c) {
+        if (cur_y_ <= row_[1] && cur_x_ < width() && cur_y_ < height()) fb_[cur_y_ * width() + cur_x_] = c;
+        if (++cur_x_ > col_[1]) {
+            cur_x_ = col_[0];
+            cur_y_++;
+        }
+    }
+
+    uint16_t fb_[TFT_WIDTH * TFT_HEIGHT] = {};
+    mutable uint16_t view_[TFT_WIDTH * TFT_HEIGHT] = {};    // A tela com a rolagem aplicada
+    uint8_t rotation_ = 0;
+    uint8_t cmd_ = 0;
+    uint32_t param_ = 0;
+    uint8_t pixel_[2] = {};
+    bool rgb444_ = false;
+    uint16_t nibbles_ = 0;
+    uint16_t col_[2] = {0, 0}, row_[2] = {0, 0};
+    uint16_t cur_x_ = 0, cur_y_ = 0;
+    uint8_t scroll_[6] = {};
+    int tfa_ = 0, vsa_ = TFT_HEIGHT, vsp_ = 0;   // Sem rolagem: a região toda, começando na linha 0
+};
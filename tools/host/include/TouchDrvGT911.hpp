@@ -0,0 +1,59 @@
+#pragma once
+
+/**
+ * Host TouchDrvGT911 shim: o sensor sempre inicializa e o toque vem de
+ * host_set_touch(), já em coordenadas de tela (depois do swap/mirror que o
+ * GT911 faria). O estado é único, como o sensor: vale para todas as instâncias.
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#define GT911_SLAVE_ADDRESS_L 0x5D
+#define GT911_SLAVE_ADDRESS_H 0x14
+
+class TouchDrvGT911 {
+public:
+    void setPins(int rst, int irq) {
+        (void)rst;
+        (void)irq;
+    }
+    bool begin(TwoWire& wire, uint8_t address, int sda = -1, int scl = -1) {
+        (void)wire;
+        (void)address;
+        (void)sda;
+        (void)scl;
+        return true;
+    }
+    void setMaxCoordinates(uint16_t x, uint16_t y) {
+        (void)x;
+        (void)y;
+    }
+    void setSwapXY(bool swap) { (void)swap; }
+    void setMirrorXY(bool mirror_x, bool mirror_y) {
+        (void)mirror_x;
+        (void)mirror_y;
+    }
+    bool isPressed() { return host_pressed_; }
+    uint8_t getPoint(int16_t* x, int16_t* y, uint8_t size) {
+        if (!host_pressed_ || size == 0) return 0;
+        x[0] = host_x_;
+        y[0] = host_y_;
+        return 1;
+    }
+    uint8_t getSupportTouchPoint() { return 5; }
+
+    /*Host: dedo na tela em (x, y), ou solto*/
+    static void host_set_touch(bool pressed, int16_t x = 0, int16_t y = 0) {
+        host_pressed_ = pressed;
+        if (pressed) {
+            host_x_ = x;
+            host_y_ = y;
+        }
+    }
+
+private:
+    static inline bool host_pressed_ = false;
+    static inline int16_t host_x_ = 0;
+    static inline int16_t host_y_ = 0;
+};
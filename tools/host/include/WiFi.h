@@ -0,0 +1,92 @@
+#pragma once
+
+/**
+ * Host WiFi shim
+ *
+ * Simula o rádio a partir de redes registradas pelo host:
+ * - host_add_network(): redes que scanNetworks() encontra.
+ * - begin() conecta na hora se o SSID foi registrado; host_set_connected()
+ *   conecta (ou desconecta, com nullptr) sem passar pelo begin().
+ */
+
+#include <Arduino.h>
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_SCAN_COMPLETED = 2,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum {
+    WIFI_AUTH_OPEN = 0,
+    WIFI_AUTH_WEP,
+    WIFI_AUTH_WPA_PSK,
+    WIFI_AUTH_WPA2_PSK,
+    WIFI_AUTH_WPA_WPA2_PSK,
+    WIFI_AUTH_WPA2_ENTERPRISE,
+    WIFI_AUTH_WPA3_PSK
+} wifi_auth_mode_t;
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+class IPAddress {
+public:
+    IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : a_(a), b_(b), c_(c), d_(d) {}
+    String toString() const {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", a_, b_, c_, d_);
+        return String(buf);
+    }
+
+private:
+    uint8_t a_, b_, c_, d_;
+};
+
+class WiFiClass {
+public:
+    static const int MAX_NETWORKS = 16;
+
+    wl_status_t status() { return connected_ ? WL_CONNECTED : WL_DISCONNECTED; }
+    wl_status_t begin(const char* ssid, const char* passphrase = nullptr);
+    bool disconnect(bool wifi_off = false, bool erase_ap = false);
+    bool mode(wifi_mode_t m) {
+        mode_ = m;
+        return true;
+    }
+    int16_t scanNetworks(bool async = false, bool show_hidden = false) {
+        (void)async;
+        (void)show_hidden;
+        return (int16_t)count_;
+    }
+    String SSID() { return connected_ ? ssid_ : String(); }
+    String SSID(uint8_t i) { return i < count_ ? networks_[i].ssid : String(); }
+    int32_t RSSI() { return connected_ ? -55 : 0; }
+    int32_t RSSI(uint8_t i) { return i < count_ ? networks_[i].rssi : 0; }
+    wifi_auth_mode_t encryptionType(uint8_t i) { return i < count_ ? networks_[i].auth : WIFI_AUTH_OPEN; }
+    IPAddress localIP() { return connected_ ? IPAddress(192, 168, 0, 42) : IPAddress(); }
+
+    /*Host: registra uma rede para scanNetworks() e begin()*/
+    void host_add_network(const char* ssid, int32_t rssi, wifi_auth_mode_t auth);
+    /*Host: esquece todas as redes registradas*/
+    void host_clear_networks() { count_ = 0; }
+    /*Host: conecta em `ssid`, ou desconecta com nullptr*/
+    void host_set_connected(const char* ssid);
+
+private:
+    struct Network {
+        String ssid;
+        int32_t rssi;
+        wifi_auth_mode_t auth;
+    };
+    Network networks_[MAX_NETWORKS];
+    uint8_t count_ = 0;
+    bool connected_ = false;
+    String ssid_;
+    wifi_mode_t mode_ = WIFI_OFF;
+};
+
+extern WiFiClass WiFi;
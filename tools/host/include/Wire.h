@@ -0,0 +1,35 @@
+#pragma once
+
+/**
+ * Host Wire (I2C) shim
+ *
+ * Cada endereço tem uma fila de bytes que o host preenche com host_push()
+ * (ex: teclas do teclado do T-Deck no endereço 0x55). requestFrom() move os
+ * bytes da fila para o buffer lido por read()/available(); sem bytes na fila,
+ * o dispositivo não responde e read() retorna -1.
+ */
+
+#include <Arduino.h>
+
+class TwoWire {
+public:
+    bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) {
+        (void)sda;
+        (void)scl;
+        (void)frequency;
+        return true;
+    }
+    uint8_t requestFrom(int address, int quantity);
+    int available();
+    int read();
+
+    /*Host: enfileira um byte que o dispositivo em `address` vai responder*/
+    void host_push(uint8_t address, uint8_t value);
+
+private:
+    uint8_t rx_[32];
+    int rx_len_ = 0;
+    int rx_pos_ = 0;
+};
+
+extern TwoWire Wire;
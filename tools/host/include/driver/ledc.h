@@ -0,0 +1,7 @@
+#pragma once
+
+/**
+ * Host ledc shim: ledcSetup()/ledcAttachPin()/ledcWrite() ficam no Arduino.h.
+ */
+
+#include <Arduino.h>
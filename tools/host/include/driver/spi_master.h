@@ -0,0 +1,86 @@
+#pragma once
+
+/**
+ * Host spi_master shim
+ *
+ * Sem barramento de verdade: cada transação termina dentro da própria chamada
+ * (queue_trans já entrega o resultado ao get_trans_result) e os bytes vão para
+ * o periférico simulado ligado ao CS do dispositivo com host_spi_attach(). O
+ * pre_cb roda antes, como no IDF, então um DC escrito por ele aparece em
+ * host_pin_level(). Sem periférico ligado, o rx recebe 0xFF.
+ *
+ * As definições ficam em tools/host/esp32_host.cpp.
+ */
+
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef ESP_OK
+typedef int esp_err_t;
+#define ESP_OK 0
+#endif
+#define ESP_FAIL -1
+
+typedef enum { SPI1_HOST = 0, SPI2_HOST = 1, SPI3_HOST = 2 } spi_host_device_t;
+#define SPI_DMA_CH_AUTO 3
+
+#define SPI_TRANS_USE_RXDATA       (1 << 2)
+#define SPI_TRANS_USE_TXDATA       (1 << 3)
+#define SPI_TRANS_CS_KEEP_ACTIVE   (1 << 8)
+
+typedef struct {
+    int mosi_io_num;
+    int miso_io_num;
+    int sclk_io_num;
+    int quadwp_io_num;
+    int quadhd_io_num;
+    int max_transfer_sz;
+    uint32_t flags;
+} spi_bus_config_t;
+
+typedef struct spi_transaction_t spi_transaction_t;
+typedef void (*transaction_cb_t)(spi_transaction_t* trans);
+
+typedef struct {
+    uint8_t mode;
+    int clock_speed_hz;
+    int spics_io_num;
+    uint32_t flags;
+    int queue_size;
+    transaction_cb_t pre_cb;
+    transaction_cb_t post_cb;
+} spi_device_interface_config_t;
+
+struct spi_transaction_t {
+    uint32_t flags;
+    size_t length;      // Bits
+    size_t rxlength;
+    void* user;
+    union {
+        const void* tx_buffer;
+        uint8_t tx_data[4];
+    };
+    union {
+        void* rx_buffer;
+        uint8_t rx_data[4];
+    };
+};
+
+typedef struct host_spi_device* spi_device_handle_t;
+typedef spi_device_handle_t spi_device_t;
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t* config, int dma_chan);
+esp_err_t spi_bus_free(spi_host_device_t host);
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t* config,
+                             spi_device_handle_t* handle);
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle);
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t* trans);
+esp_err_t spi_device_queue_trans(spi_device_handle_t handle, spi_transaction_t* trans, TickType_t wait);
+esp_err_t spi_device_get_trans_result(spi_device_handle_t handle, spi_transaction_t** trans, TickType_t wait);
+esp_err_t spi_device_acquire_bus(spi_device_handle_t handle, TickType_t wait);
+void spi_device_release_bus(spi_device_handle_t handle);
+
+/*Host: periférico simulado no CS `cs`. rx pode ser nullptr (ninguém lê a resposta)*/
+typedef void (*host_spi_sink_t)(void* ctx, const uint8_t* tx, uint8_t* rx, size_t len);
+void host_spi_attach(int cs, host_spi_sink_t sink, void* ctx);
@@ -0,0 +1,30 @@
+#pragma once
+
+/**
+ * Host heap_caps shim
+ *
+ * No host todas as capacidades vão para o malloc do sistema. As consultas de
+ * espaço livre simulam uma PSRAM de 8 MB e uma SRAM interna de 320 KB vazias,
+ * só para que as estatísticas tenham valores plausíveis.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT  (1 << 12)
+
+inline void* heap_caps_malloc(size_t size, uint32_t caps) { (void)caps; return malloc(size); }
+inline void* heap_caps_realloc(void* ptr, size_t size, uint32_t caps) { (void)caps; return realloc(ptr, size); }
+inline void heap_caps_free(void* ptr) { free(ptr); }
+
+inline size_t heap_caps_get_total_size(uint32_t caps) {
+    return (caps & MALLOC_CAP_SPIRAM) ? 8u * 1024 * 1024 : 320u * 1024;
+}
+inline size_t heap_caps_get_free_size(uint32_t caps) { return heap_caps_get_total_size(caps); }
+inline size_t heap_caps_get_largest_free_block(uint32_t caps) { return heap_caps_get_total_size(caps); }
+inline size_t heap_caps_get_minimum_free_size(uint32_t caps) { return heap_caps_get_total_size(caps); }
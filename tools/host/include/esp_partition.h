@@ -0,0 +1,41 @@
+#pragma once
+
+/**
+ * Host esp_partition shim
+ *
+ * As partições são arquivos carregados pelo host com host_partition_load()
+ * (ex: o pacote de tools/assets/pack_assets.py como a partição "assets").
+ * esp_partition_mmap() devolve o arquivo inteiro já em memória.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+typedef enum { ESP_PARTITION_TYPE_APP = 0x00, ESP_PARTITION_TYPE_DATA = 0x01 } esp_partition_type_t;
+typedef enum { ESP_PARTITION_SUBTYPE_ANY = 0xff } esp_partition_subtype_t;
+typedef enum { SPI_FLASH_MMAP_DATA, SPI_FLASH_MMAP_INST } spi_flash_mmap_memory_t;
+typedef uint32_t spi_flash_mmap_handle_t;
+
+typedef struct {
+    esp_partition_type_t type;
+    esp_partition_subtype_t subtype;
+    uint32_t address;
+    uint32_t size;
+    char label[17];
+    bool encrypted;
+    const uint8_t* host_data; /*Host: conteúdo do arquivo carregado*/
+} esp_partition_t;
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char* label);
+esp_err_t esp_partition_mmap(const esp_partition_t* partition, size_t offset, size_t size,
+                             spi_flash_mmap_memory_t memory, const void** out_ptr,
+                             spi_flash_mmap_handle_t* out_handle);
+inline void spi_flash_munmap(spi_flash_mmap_handle_t handle) { (void)handle; }
+
+/*Host: carrega o arquivo `path` como a partição de dados `label`. Retorna false se não der para ler*/
+bool host_partition_load(const char* label, const char* path);
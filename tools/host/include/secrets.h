@@ -0,0 +1,7 @@
+#pragma once
+
+// Host: URLs das fixtures servidas pelo HTTPClient do host (ver HTTPClient.h),
+// no lugar do src/secrets.h do aparelho.
+
+const char* GOOGLE_SCRIPT_URL_TASKS = "https://script.google.com/fixture/tasks";
+const char* GOOGLE_SCRIPT_URL_CALENDAR = "https://script.google.com/fixture/calendar";
@@ -0,0 +1,150 @@
+"""
+Pré-escala dos ícones
+
+Lê os ícones gerados pelo LVGL Image Converter (TRUE_COLOR_ALPHA, 100x100) e
+gera variantes já no tamanho exato em que aparecem na tela, no formato
+LV_IMG_CF_RGB565A8. Assim o LVGL desenha os ícones sem zoom, sem passar pelo
+caminho de transformação por pixel.
+
+- Launcher: 80 px (normal) e 100/104/108 px (quadros da animação de pulso).
+- Clima: 125 px (o antigo zoom de LV_IMG_ZOOM_NONE + 64).
+
+É usado por tools/assets/pack_assets.py, que coloca as variantes no pacote de
+assets gravado na partição "assets". Rodado à mão, lista os ícones gerados:
+python tools/icons/prescale_icons.py
+
+Não depende de bibliotecas externas; o redimensionamento usa filtro triangular
+com alfa pré-multiplicado para não escurecer as bordas.
+"""
+
+import os
+import re
+import sys
+
+LAUNCHER_ICONS = ["calculator", "notes", "sketch", "weather", "calendar",
+                  "map", "settings", "audio", "about", "monitor"]
+WEATHER_ICONS = ["sun", "moon", "cloud_sun", "cloud_moon", "cloud", "rain",
+                 "thunderstorm", "snow", "mist", "unknown"]
+
+# (prefixo no pacote, [(arquivo de origem, nome)], tamanhos)
+# Cada variante vira "<prefixo>/<nome>_<px>", ex: "launcher/calculator_80".
+GROUPS = [
+    ("launcher", [("src/Icons/lv_img_%s.c" % n, n) for n in LAUNCHER_ICONS], [80, 100, 104, 108]),
+    ("weather", [("src/Icons/weather/lv_img_weather_%s.c" % n, n) for n in WEATHER_ICONS], [125]),
+]
+
+
+def load_icon(path):
+    """Retorna (w, h, pixels RGBA 8 bits) a partir do .c do Image Converter."""
+    with open(path, "r", encoding="utf-8") as f:
+        text = f.read()
+    m = re.search(r"LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0(.*?)#endif", text, re.S)
+    if not m:
+        raise ValueError("%s: 16-bit section not found" % path)
+    data = [int(b, 16) for b in re.findall(r"0x([0-9a-fA-F]{2})", m.group(1))]
+    dm = re.search(r"LV_IMG_CF_TRUE_COLOR_ALPHA,\s*0,\s*0,\s*(\d+),\s*(\d+)\}", text)
+    if not dm:
+        raise ValueError("%s: not a TRUE_COLOR_ALPHA image" % path)
+    w, h = int(dm.group(1)), int(dm.group(2))
+    if len(data) != w * h * 3:
+        raise ValueError("%s: expected %d bytes, found %d" % (path, w * h * 3, len(data)))
+
+    pixels = []
+    for i in range(w * h):
+        c = data[i * 3] | (data[i * 3 + 1] << 8)
+        a = data[i * 3 + 2]
+        r = ((c >> 11) & 0x1F) * 255 // 31
+        g = ((c >> 5) & 0x3F) * 255 // 63
+        b = (c & 0x1F) * 255 // 31
+        pixels.append((r, g, b, a))
+    return w, h, pixels
+
+
+def weights(src_len, dst_len):
+    """Pesos do filtro triangular para cada posição de destino."""
+    scale = dst_len / src_len
+    support = max(1.0, 1.0 / scale)
+    table = []
+    for d in range(dst_len):
+        center = (d + 0.5) / scale - 0.5
+        lo = int(center - support)
+        hi = int(center + support) + 1
+        taps = []
+        for s in range(lo, hi + 1):
+            wgt = 1.0 - abs(s - center) / support
+            if wgt > 0:
+                taps.append((min(max(s, 0), src_len - 1), wgt))
+        total = sum(wgt for _, wgt in taps)
+        table.append([(s, wgt / total) for s, wgt in taps])
+    return table
+
+
+def resize(w, h, pixels, dw, dh):
+    # Alfa pré-multiplicado
+    pm = [(r * a / 255.0, g * a / 255.0, b * a / 255.0, float(a)) for r, g, b, a in pixels]
+
+    wx = weights(w, dw)
+    tmp = []
+    for y in range(h):
+        row = pm[y * w:(y + 1) * w]
+        for taps in wx:
+            acc = [0.0, 0.0, 0.0, 0.0]
+            for s, wgt in taps:
+                p = row[s]
+                for k in range(4):
+                    acc[k] += p[k] * wgt
+            tmp.append(acc)
+
+    wy = weights(h, dh)
+    out = []
+    for taps in wy:
+        for x in range(dw):
+            acc = [0.0, 0.0, 0.0, 0.0]
+            for s, wgt in taps:
+                p = tmp[s * dw + x]
+                for k in range(4):
+                    acc[k] += p[k] * wgt
+            a = min(max(acc[3], 0.0), 255.0)
+            if a < 0.5:
+                out.append((0, 0, 0, 0))
+                continue
+            rgb = [min(max(acc[k] * 255.0 / a, 0.0), 255.0) for k in range(3)]
+            out.append((int(rgb[0] + 0.5), int(rgb[1] + 0.5), int(rgb[2] + 0.5), int(a + 0.5)))
+    return out
+
+
+def to_rgb565(r, g, b):
+    return ((r * 31 + 127) // 255) << 11 | ((g * 63 + 127) // 255) << 5 | ((b * 31 + 127) // 255)
+
+
+def to_rgb565a8(pixels):
+    """Plano de cores RGB565 (little-endian, sem swap) seguido do plano de alfa."""
+    colors = bytearray()
+    for r, g, b, _ in pixels:
+        c = to_rgb565(r, g, b)
+        colors += bytes((c & 0xFF, c >> 8))
+    alphas = bytes(a for _, _, _, a in pixels)
+    return bytes(colors) + alphas
+
+
+def icon_sources(project_dir):
+    """Arquivos de origem de todos os ícones (para saber quando regenerar)."""
+    return [os.path.join(project_dir, src) for _, icons, _ in GROUPS for src, _ in icons]
+
+
+def generate(project_dir):
+    """Retorna [(nome no pacote, largura, altura, dados RGB565A8)]."""
+    images = []
+    for prefix, icons, sizes in GROUPS:
+        for src, name in icons:
+            w, h, pixels = load_icon(os.path.join(project_dir, src))
+            for size in sizes:
+                scaled = pixels if (size == w and size == h) else resize(w, h, pixels, size, size)
+                images.append(("%s/%s_%d" % (prefix, name, size), size, size, to_rgb565a8(scaled)))
+    return images
+
+
+if __name__ == "__main__":
+    for name, w, h, data in generate(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..")):
+        print("%-28s %3dx%-3d %6d bytes" % (name, w, h, len(data)))
+    sys.exit(0)
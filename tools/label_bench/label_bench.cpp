@@ -0,0 +1,224 @@
+/**
+ * Label layout benchmark
+ *
+ * Mede no host quanto custa medir e desenhar os textos das telas com e sem o
+ * cache de quebras de linha (LV_TXT_LAYOUT_CACHE_CNT, ver lv_txt_layout.h):
+ *   notes    - a lista de tarefas (VirtualList) rolando uma linha por quadro
+ *   calendar - o modal de evento (campos de texto) aberto e redesenhado
+ *   weather  - a descrição longa com LV_LABEL_LONG_WRAP redesenhada
+ *
+ * Uso:
+ *   tools/label_bench/build.sh
+ *   .pio/host/label_bench [quadros]
+ *
+ * O display é um driver sem saída de 320x240 com full_refresh (o tamanho do T-Deck),
+ * então cada quadro mede o layout e o desenho da tela inteira.
+ *
+ * Antes de medir, confere que dois textos diferentes com o mesmo hash e o
+ * mesmo tamanho não recebem as quebras de linha um do outro (sai com 1 se
+ * receberem).
+ */
+
+#include <Arduino.h>
+#include <chrono>
+#include <lvgl.h>
+#include "system/pda_mem.h"
+#include "apps/pda_theme.h"
+#include "apps/virtual_list.h"
+
+namespace {
+
+const int TASKS = 200;
+
+const char* WORDS[] = {"Comprar", "leite", "e", "pão", "ligar", "para", "o", "escritório", "sobre",
+                       "a", "reunião", "de", "amanhã", "revisar", "relatório", "trimestral", "–", "“urgente”"};
+const int WORD_CNT = sizeof(WORDS) / sizeof(WORDS[0]);
+
+const char* DESCRIPTION =
+    "Reunião de planejamento trimestral com a equipe de produto. Trazer os números de vendas, "
+    "o roteiro atualizado e as dúvidas sobre o orçamento do próximo semestre.";
+
+const char* WEATHER =
+    "São Paulo\n"
+    "Temperature: 23.4°C\n"
+    "Feels like: 24.1°C\n"
+    "Humidity: 68%\n"
+    "Description: nuvens dispersas com possibilidade de chuva fraca no fim da tarde";
+
+char tasks[TASKS][96];
+lv_color_t draw_buf_data[320 * 240];
+VirtualList::List vlist;
+
+void flush_cb(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_p) {
+    (void)area;
+    (void)color_p;
+    lv_disp_flush_ready(drv);
+}
+
+void init_display() {
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+    lv_disp_draw_buf_init(&draw_buf, draw_buf_data, NULL, 320 * 240);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = 320;
+    disp_drv.ver_res = 240;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.full_refresh = 1;
+    lv_disp_drv_register(&disp_drv);
+}
+
+double now_ms() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+/*Uma tela nova para cada medida; a anterior é apagada*/
+lv_obj_t* load_screen() {
+    lv_obj_t* screen = PdaTheme::create_screen();
+    lv_obj_clear_flag(screen, LV_OBJ_FLAG_HIDDEN);
+    lv_scr_load_anim(screen, LV_SCR_LOAD_ANIM_NONE, 0, 0, true);
+    return screen;
+}
+
+void bind_row(lv_obj_t* row, lv_obj_t* label, uint32_t index) {
+    (void)row;
+    lv_label_set_text(label, tasks[index]);
+}
+
+/*Tempo médio (ms) de um quadro da lista rolando uma linha por vez*/
+double bench_notes(int frames) {
+    lv_obj_t* screen = load_screen();
+    vlist = VirtualList::List();  // as linhas da medida anterior foram apagadas com a tela
+    lv_obj_t* cont = VirtualList::create(&vlist, screen, bind_row, NULL);
+    lv_obj_set_size(cont, 320, 200);
+    lv_obj_align(cont, LV_ALIGN_BOTTOM_MID, 0, 0);
+    VirtualList::set_count(&vlist, TASKS);
+    lv_refr_now(NULL);
+
+    double start = now_ms();
+    for (int f = 0; f < frames; f++) {
+        // Desce até o fim e volta ao topo
+        lv_obj_scroll_by(cont, 0, (f / 60) % 2 ? vlist.row_h : -vlist.row_h, LV_ANIM_OFF);
+        lv_refr_now(NULL);
+    }
+    double ms = (now_ms() - start) / frames;
+    return ms;
+}
+
+/*Tempo médio (ms) para abrir o modal de evento e redesenhá-lo algumas vezes*/
+double bench_calendar(int frames) {
+    lv_obj_t* screen = load_screen();
+
+    lv_obj_t* modal = nullptr;
+    double start = now_ms();
+    for (int f = 0; f < frames; f++) {
+        // Aberto e fechado a cada 10 quadros, como ao editar eventos seguidos
+        if (f % 10 == 0) {
+            if (modal) lv_obj_del(modal);
+            modal = PdaTheme::create_modal(screen);
+            const char* texts[] = {tasks[f % TASKS], "09:30", "10:45", DESCRIPTION};
+            for (int i = 0; i < 4; i++) {
+                lv_obj_t* ta = lv_textarea_create(modal);
+                lv_textarea_set_one_line(ta, true);
+                lv_obj_set_width(ta, i == 1 || i == 2 ? lv_pct(39) : lv_pct(80));
+                lv_obj_set_y(ta, 40 + 40 * i);
+                lv_textarea_set_text(ta, texts[i]);
+            }
+            lv_obj_t* save = PdaTheme::create_round_button(modal, LV_SYMBOL_SAVE, NULL);
+            lv_obj_align(save, LV_ALIGN_BOTTOM_MID, 0, 5);
+        }
+        lv_obj_invalidate(screen);
+        lv_refr_now(NULL);
+    }
+    double ms = (now_ms() - start) / frames;
+    return ms;
+}
+
+/*Tempo médio (ms) de um quadro com a descrição do clima*/
+double bench_weather(int frames) {
+    lv_obj_t* screen = load_screen();
+    lv_obj_t* label = lv_label_create(screen);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
+    lv_obj_set_width(label, 300);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_center(label);
+    lv_label_set_text_static(label, WEATHER);
+
+    double start = now_ms();
+    for (int f = 0; f < frames; f++) {
+        lv_obj_invalidate(screen);
+        lv_refr_now(NULL);
+    }
+    double ms = (now_ms() - start) / frames;
+    return ms;
+}
+
+/*
+ * Textos de 20 bytes com o mesmo FNV-1a (0x9a93e13f), com o '\n' em lugares
+ * diferentes: o segundo não pode usar as linhas do primeiro
+ */
+bool verify_collision() {
+    const char* texts[] = {"ibeacb\njbhagjgffcfgg", "bhiaebjjidej\nbbeidjc"};
+    const lv_font_t* font = LV_FONT_DEFAULT;
+    lv_point_t expected[2];
+    lv_txt_layout_cache_set_enabled(false);
+    for (int i = 0; i < 2; i++) lv_txt_get_size(&expected[i], texts[i], font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+
+    lv_txt_layout_cache_set_enabled(true);
+    bool ok = true;
+    for (int i = 0; i < 2; i++) {
+        lv_point_t size;
+        lv_txt_get_size(&size, texts[i], font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+        if (size.x != expected[i].x || size.y != expected[i].y) {
+            printf("collision: \"%s\" measured %dx%d, expected %dx%d\n", texts[i], size.x, size.y,
+                   expected[i].x, expected[i].y);
+            ok = false;
+        }
+    }
+    lv_txt_layout_cache_invalidate(NULL);
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? atoi(argv[1]) : 300;
+    if (frames < 1) frames = 1;
+
+    lv_init();
+    init_display();
+    PdaTheme::init();
+
+    if (!verify_collision()) return 1;
+
+    // Títulos de tarefas de tamanhos variados, alguns com acentos
+    for (int i = 0; i < TASKS; i++) {
+        tasks[i][0] = '\0';
+        for (int w = 0; w < 3 + i % 8; w++) {
+            if (w) strcat(tasks[i], " ");
+            strcat(tasks[i], WORDS[(i * 7 + w * 3) % WORD_CNT]);
+        }
+    }
+
+    struct Scene {
+        const char* name;
+        double (*run)(int);
+    };
+    const Scene scenes[] = {{"notes", bench_notes}, {"calendar", bench_calendar}, {"weather", bench_weather}};
+
+    printf("%10s %12s %12s %8s %8s\n", "scene", "no cache ms", "cache ms", "hits", "misses");
+    for (const Scene& s : scenes) {
+        lv_txt_layout_cache_set_enabled(false);
+        double uncached = s.run(frames);
+
+        lv_txt_layout_cache_set_enabled(true);
+        lv_txt_layout_cache_reset_stats();
+        double cached = s.run(frames);
+
+        lv_txt_layout_cache_stats_t stats;
+        lv_txt_layout_cache_get_stats(&stats);
+        printf("%10s %12.3f %12.3f %8u %8u\n", s.name, uncached, cached, (unsigned)stats.hits, (unsigned)stats.misses);
+    }
+    return 0;
+}
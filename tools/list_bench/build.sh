@@ -0,0 +1,17 @@
+#!/bin/sh
+# Compila o benchmark de reconstrução de listas para o host (gcc/g++ do sistema).
+# Uso: tools/list_bench/build.sh   (a partir da raiz do projeto)
+set -e
+
+OUT=.pio/host/list_bench.obj
+mkdir -p "$OUT"
+
+FLAGS="-O2 -DLV_CONF_INCLUDE_SIMPLE -DARDUINOJSON_ENABLE_ARDUINO_STRING=1 -Ilib -Ilib/lvgl -Ilib/ArduinoJson/src -Isrc -Itools/host/include"
+
+for f in $(find lib/lvgl/src src/fonts/generated -name '*.c'); do
+    o="$OUT/$(echo "$f" | tr '/.' '__').o"
+    [ "$o" -nt "$f" ] || cc -c -w $FLAGS "$f" -o "$o"
+done
+
+c++ -std=c++17 $FLAGS tools/list_bench/list_bench.cpp tools/host/arduino_host.cpp src/system/pda_mem.cpp src/system/pda_log.cpp src/system/tft_scroll.cpp "$OUT"/*.o -lm -o .pio/host/list_bench
+echo "built .pio/host/list_bench"
@@ -0,0 +1,255 @@
+/**
+ * List rebuild benchmark
+ *
+ * Mede no host quanto custa recriar uma lista de N itens como o Settings faz com
+ * as redes Wi-Fi (lv_obj_clean + um lv_list_add_btn por item), até a lista estar
+ * desenhada (lv_refr_now). Compara:
+ *   direct  - cada item faz seu próprio refresh de estilo, layout e invalidação
+ *   bulk    - a mesma reconstrução dentro de um LvBulk::Scope
+ *   virtual - VirtualList::set_count (só as linhas visíveis existem)
+ *
+ * Antes de medir, confere a VirtualList com VERIFY_ITEMS itens (o conteúdo
+ * passaria de LV_COORD_MAX sem a janela): rolando em passos de arrasto até o
+ * fim e de volta, e com o trackball item a item além da linha 1024. Em cada
+ * passo, cada item visível precisa ter uma linha no y certo e com o seu texto.
+ * Sai com erro na primeira diferença.
+ *
+ * Mostra também o heap do LVGL (pda_mem) por linha de lista: 100 linhas como
+ * as do Wi-Fi, com os estilos do PdaTheme, e quantas referências de estilo cada
+ * uma carrega (8 bytes cada no ESP32, 16 no host).
+ *
+ * Uso:
+ *   tools/list_bench/build.sh
+ *   .pio/host/list_bench [repetições]
+ *
+ * O display é um driver sem saída de 320x240, então o tempo de desenho inclui só
+ * a renderização por software, sem o envio pelo SPI.
+ */
+
+#include <Arduino.h>
+#include <chrono>
+#include <lvgl.h>
+#include "system/pda_mem.h"
+#include "system/lv_bulk.h"
+#include "apps/pda_theme.h"
+#include "apps/virtual_list.h"
+
+namespace {
+
+const int SIZES[] = {50, 200, 1000};
+const int MAX_ITEMS = 1000;
+const int VERIFY_ITEMS = 3000;
+const int VERIFY_SELECT = 1100;     // Itens percorridos com o trackball
+
+char names[MAX_ITEMS][64];
+lv_color_t draw_buf_data[320 * 40];
+VirtualList::List vlist;
+
+void flush_cb(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* color_p) {
+    (void)area;
+    (void)color_p;
+    lv_disp_flush_ready(drv);
+}
+
+void init_display() {
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+    lv_disp_draw_buf_init(&draw_buf, draw_buf_data, NULL, 320 * 40);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = 320;
+    disp_drv.ver_res = 240;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    lv_disp_drv_register(&disp_drv);
+}
+
+double now_ms() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+void add_items(lv_obj_t* list, int count) {
+    for (int i = 0; i < count; i++) {
+        lv_list_add_btn(list, NULL, names[i]);
+    }
+}
+
+void rebuild_direct(lv_obj_t* list, int count) {
+    lv_obj_clean(list);
+    add_items(list, count);
+}
+
+void rebuild_bulk(lv_obj_t* list, int count) {
+    LvBulk::Scope bulk(list);
+    lv_obj_clean(list);
+    add_items(list, count);
+}
+
+void bind_row(lv_obj_t* row, lv_obj_t* label, uint32_t index) {
+    (void)row;
+    lv_label_set_text(label, names[index % MAX_ITEMS]);
+}
+
+/*Cada item na área visível tem uma linha no lugar certo e com o seu texto*/
+bool check_rows(const char* what) {
+    lv_obj_update_layout(vlist.cont);
+    lv_area_t view;
+    lv_obj_get_content_coords(vlist.cont, &view);
+    int32_t top = (int32_t)vlist.base * vlist.row_h + lv_obj_get_scroll_y(vlist.cont);
+    int32_t first = top / vlist.row_h;
+    int32_t last = (top + lv_area_get_height(&view) - 1) / vlist.row_h;
+    if (last >= (int32_t)vlist.count) last = (int32_t)vlist.count - 1;
+    for (int32_t index = first; index <= last; index++) {
+        lv_obj_t* row = nullptr;
+        for (uint8_t slot = 0; slot < vlist.pool_size; slot++) {
+            if (vlist.row_index[slot] == index) row = vlist.rows[slot];
+        }
+        if (!row || lv_obj_has_flag(row, LV_OBJ_FLAG_HIDDEN)) {
+            printf("MISMATCH %s: item %d has no row (base %u)\n", what, (int)index, (unsigned)vlist.base);
+            return false;
+        }
+        lv_coord_t want = view.y1 + index * vlist.row_h - top;
+        if (row->coords.y1 != want) {
+            printf("MISMATCH %s: item %d at y %d, expected %d (base %u)\n", what, (int)index, row->coords.y1, want,
+                   (unsigned)vlist.base);
+            return false;
+        }
+        if (strcmp(lv_label_get_text(lv_obj_get_child(row, 0)), names[index % MAX_ITEMS]) != 0) {
+            printf("MISMATCH %s: item %d shows \"%s\"\n", what, (int)index, lv_label_get_text(lv_obj_get_child(row, 0)));
+            return false;
+        }
+    }
+    return true;
+}
+
+/*Posição do topo da área visível na lista inteira*/
+int32_t virtual_top() {
+    return (int32_t)vlist.base * vlist.row_h + lv_obj_get_scroll_y(vlist.cont);
+}
+
+bool verify_virtual() {
+    VirtualList::set_count(&vlist, VERIFY_ITEMS);
+    lv_refr_now(NULL);
+    int32_t end = VERIFY_ITEMS * vlist.row_h - lv_obj_get_content_height(vlist.cont);
+    int steps = 0;
+
+    // Arrasto: passos que não casam com a altura da linha, até o fim e de volta
+    while (virtual_top() < end) {
+        int32_t step = end - virtual_top() < 37 ? end - virtual_top() : 37;
+        lv_obj_scroll_by(vlist.cont, 0, -step, LV_ANIM_OFF);
+        if (!check_rows("drag down")) return false;
+        steps++;
+    }
+    if (virtual_top() != end) {
+        printf("MISMATCH drag down stopped at %d, expected %d\n", (int)virtual_top(), (int)end);
+        return false;
+    }
+    while (virtual_top() > 0) {
+        int32_t step = virtual_top() < 53 ? virtual_top() : 53;
+        lv_obj_scroll_by(vlist.cont, 0, step, LV_ANIM_OFF);
+        if (!check_rows("drag up")) return false;
+        steps++;
+    }
+
+    // Trackball: um item por vez, esperando a animação da rolagem terminar
+    for (int i = 0; i < VERIFY_SELECT; i++, steps++) {
+        VirtualList::move_selection(&vlist, 1);
+        for (int t = 0; t < 20 && lv_anim_get(vlist.cont, NULL); t++) {
+            delay(20);
+            lv_timer_handler();
+        }
+        if (!check_rows("trackball")) return false;
+        int32_t sel_top = vlist.selected * vlist.row_h - virtual_top();
+        if (sel_top < 0 || sel_top + vlist.row_h > lv_obj_get_content_height(vlist.cont)) {
+            printf("MISMATCH trackball: item %d selected but not visible\n", (int)vlist.selected);
+            return false;
+        }
+    }
+
+    printf("verified %d scroll steps over %d items (last base %u)\n", steps, VERIFY_ITEMS, (unsigned)vlist.base);
+    VirtualList::set_count(&vlist, 0);
+    return true;
+}
+
+/*Tempo médio (ms) de uma reconstrução com N itens, do clean até o fim do lv_refr_now*/
+double measure(lv_obj_t* list, int count, int reps, void (*rebuild)(lv_obj_t*, int)) {
+    double total = 0;
+    for (int r = 0; r < reps; r++) {
+        rebuild_direct(list, 0);
+        lv_refr_now(NULL);
+        double start = now_ms();
+        rebuild(list, count);
+        lv_refr_now(NULL);
+        total += now_ms() - start;
+    }
+    return total / reps;
+}
+
+double measure_virtual(int count, int reps) {
+    double total = 0;
+    for (int r = 0; r < reps; r++) {
+        VirtualList::set_count(&vlist, 0);
+        lv_refr_now(NULL);
+        double start = now_ms();
+        VirtualList::set_count(&vlist, count);
+        lv_refr_now(NULL);
+        total += now_ms() - start;
+    }
+    return total / reps;
+}
+
+/*Bytes do heap do LVGL por linha de lista (botão + label), com os estilos do tema*/
+void measure_row_heap(lv_obj_t* list) {
+    const int ROWS = 100;
+    rebuild_direct(list, 0);
+    lv_refr_now(NULL);
+    pda_mem_stats_t before, after;
+    pda_mem_get_stats(&before);
+    add_items(list, ROWS);
+    pda_mem_get_stats(&after);
+    lv_obj_t* row = lv_obj_get_child(list, 0);
+    printf("heap per row: %u B, %u style refs on the button, %u on the label\n",
+           (unsigned)((after.bytes_in_use - before.bytes_in_use) / ROWS), (unsigned)row->style_cnt,
+           (unsigned)lv_obj_get_child(row, 0)->style_cnt);
+    rebuild_direct(list, 0);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int reps = argc > 1 ? atoi(argv[1]) : 5;
+    if (reps < 1) reps = 1;
+
+    lv_init();
+    init_display();
+    PdaTheme::init();
+
+    // Nomes como os da lista de Wi-Fi; alguns longos o bastante para rolar
+    for (int i = 0; i < MAX_ITEMS; i++) {
+        snprintf(names[i], sizeof(names[i]), (i % 7) ? LV_SYMBOL_WIFI " Network %d" :
+                 LV_SYMBOL_WIFI " A network with a rather long name %d " LV_SYMBOL_EYE_CLOSE, i);
+    }
+
+    lv_obj_t* screen = lv_scr_act();
+    lv_obj_t* list = lv_list_create(screen);
+    lv_obj_set_size(list, 300, 200);
+    lv_obj_t* vcont = VirtualList::create(&vlist, screen, bind_row, NULL);
+    lv_obj_set_size(vcont, 300, 200);
+
+    measure_row_heap(list);
+    lv_obj_add_flag(list, LV_OBJ_FLAG_HIDDEN);
+    if (!verify_virtual()) return 1;
+
+    printf("%6s %12s %12s %12s\n", "items", "direct ms", "bulk ms", "virtual ms");
+    for (int count : SIZES) {
+        lv_obj_clear_flag(list, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_add_flag(vcont, LV_OBJ_FLAG_HIDDEN);
+        double direct = measure(list, count, reps, rebuild_direct);
+        double bulk = measure(list, count, reps, rebuild_bulk);
+        lv_obj_add_flag(list, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_clear_flag(vcont, LV_OBJ_FLAG_HIDDEN);
+        double virt = measure_virtual(count, reps);
+        printf("%6d %12.2f %12.2f %12.2f\n", count, direct, bulk, virt);
+    }
+    return 0;
+}
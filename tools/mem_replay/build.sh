@@ -0,0 +1,18 @@
+#!/bin/sh
+# Compila o replay de traces de memória para o host (gcc/g++ do sistema).
+# Uso: tools/mem_replay/build.sh   (a partir da raiz do projeto)
+set -e
+
+OUT=.pio/host/mem_replay.obj
+mkdir -p "$OUT"
+
+FLAGS="-O2 -DLV_CONF_INCLUDE_SIMPLE -DARDUINOJSON_ENABLE_ARDUINO_STRING=1 -Ilib -Ilib/lvgl -Ilib/ArduinoJson/src -Isrc -Itools/host/include"
+
+# O LVGL é necessário pelo TLSF e pelo log.
+for f in $(find lib/lvgl/src src/fonts/generated -name '*.c'); do
+    o="$OUT/$(echo "$f" | tr '/.' '__').o"
+    [ "$o" -nt "$f" ] || cc -c -w $FLAGS "$f" -o "$o"
+done
+
+c++ -std=c++17 $FLAGS tools/mem_replay/mem_replay.cpp tools/host/arduino_host.cpp src/system/pda_mem.cpp src/system/pda_log.cpp src/system/tft_scroll.cpp "$OUT"/*.o -lm -o .pio/host/mem_replay
+echo "built .pio/host/mem_replay"
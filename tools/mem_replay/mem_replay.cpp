@@ -0,0 +1,178 @@
+/**
+ * Memory trace replay
+ *
+ * Reproduz no host um trace de alocações capturado no T-Deck e mede o alocador
+ * de dois níveis do pda_mem (pool TLSF na SRAM + PSRAM) contra o malloc do sistema.
+ *
+ * Captura do trace:
+ * 1. Compile o firmware com -DPDA_MEM_TRACE=1 em build_flags.
+ * 2. Grave o monitor serial: pio device monitor | tee trace.txt
+ *    (só as linhas "[mt] ..." são lidas, o resto é ignorado).
+ *
+ * traces/tour_sim.txt vem do simulador (o mesmo src/ e o mesmo pda_mem) no
+ * passeio tools/simulator/traces/tour.trace; o cabeçalho dele diz como refazer.
+ * Os ponteiros do host têm 8 bytes, então os objetos do LVGL saem maiores que
+ * no T-Deck: serve para comparar alocadores, não para o tamanho exato do heap.
+ *
+ * Replay:
+ *   tools/mem_replay/build.sh
+ *   .pio/host/mem_replay trace.txt [repetições]
+ *
+ * Os níveis do pda_mem são mostrados duas vezes: no fim do trace, com os
+ * blocos ainda vivos (a fragmentação de verdade), e depois de soltar tudo.
+ *
+ * Formato das linhas:
+ *   [mt] a <ptr> <size>            alocação
+ *   [mt] f <ptr>                   liberação
+ *   [mt] r <old> <new> <size>      realocação
+ */
+
+#include <Arduino.h>
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "system/pda_mem.h"
+
+namespace {
+
+enum OpType : uint8_t { OP_ALLOC, OP_FREE, OP_REALLOC };
+
+struct Op {
+    OpType type;
+    uint64_t ptr;      // Ponteiro no dispositivo (alloc: resultado; free/realloc: bloco original)
+    uint64_t result;   // Realloc: novo ponteiro no dispositivo
+    uint32_t size;
+};
+
+struct Allocator {
+    const char* name;
+    void* (*alloc)(size_t);
+    void (*free)(void*);
+    void* (*realloc)(void*, size_t);
+};
+
+bool load_trace(const char* path, std::vector<Op>& ops) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        const char* p = strstr(line, "[mt] ");
+        if (!p) continue;
+        p += 5;
+
+        Op op = {};
+        unsigned long long a = 0, b = 0;
+        unsigned size = 0;
+        if (p[0] == 'a' && sscanf(p + 1, " %llx %u", &a, &size) == 2) {
+            op.type = OP_ALLOC;
+            op.ptr = a;
+            op.size = size;
+        } else if (p[0] == 'f' && sscanf(p + 1, " %llx", &a) == 1) {
+            op.type = OP_FREE;
+            op.ptr = a;
+        } else if (p[0] == 'r' && sscanf(p + 1, " %llx %llx %u", &a, &b, &size) == 3) {
+            op.type = OP_REALLOC;
+            op.ptr = a;
+            op.result = b;
+            op.size = size;
+        } else {
+            continue;
+        }
+        ops.push_back(op);
+    }
+    fclose(f);
+    return true;
+}
+
+/**
+ * @brief Executa o trace uma vez e devolve o tempo em microssegundos.
+ * Blocos ainda vivos no fim do trace são liberados fora da medição; com
+ * `report`, os níveis do pda_mem são impressos antes disso.
+ */
+double replay(const std::vector<Op>& ops, const Allocator& a, uint32_t& failed, bool report) {
+    std::unordered_map<uint64_t, void*> live;
+    live.reserve(ops.size());
+    failed = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (const Op& op : ops) {
+        switch (op.type) {
+        case OP_ALLOC: {
+            void* p = a.alloc(op.size);
+            if (!p) failed++;
+            else live[op.ptr] = p;
+            break;
+        }
+        case OP_FREE: {
+            auto it = live.find(op.ptr);
+            if (it == live.end()) break;   // Bloco alocado antes do início da captura
+            a.free(it->second);
+            live.erase(it);
+            break;
+        }
+        case OP_REALLOC: {
+            auto it = live.find(op.ptr);
+            if (it == live.end()) break;
+            void* p = a.realloc(it->second, op.size);
+            if (!p) {
+                failed++;
+                break;
+            }
+            live.erase(it);
+            live[op.result] = p;
+            break;
+        }
+        }
+    }
+    auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    if (report) {
+        printf("%zu blocks still live at the end of the trace\n", live.size());
+        LvMem::print_stats("end of trace");
+    }
+    for (auto& kv : live) a.free(kv.second);
+    return elapsed;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <trace.txt> [repeats]\n", argv[0]);
+        return 2;
+    }
+    int repeats = argc > 2 ? atoi(argv[2]) : 10;
+    if (repeats < 1) repeats = 1;
+
+    std::vector<Op> ops;
+    if (!load_trace(argv[1], ops)) return 1;
+    if (ops.empty()) {
+        fprintf(stderr, "no [mt] lines in %s\n", argv[1]);
+        return 1;
+    }
+    printf("trace: %zu operations, %d repeats\n", ops.size(), repeats);
+
+    const Allocator allocators[] = {
+        { "pda_mem (sram tlsf + psram)", pda_mem_alloc, pda_mem_free, pda_mem_realloc },
+        { "system malloc", malloc, free, realloc },
+    };
+
+    for (const Allocator& a : allocators) {
+        double best = 0;
+        uint32_t failed = 0;
+        for (int i = 0; i < repeats; i++) {
+            double us = replay(ops, a, failed, i == 0 && a.alloc == pda_mem_alloc);
+            if (i == 0 || us < best) best = us;
+        }
+        printf("%-28s best=%.0f us (%.1f ns/op) failed=%u\n",
+               a.name, best, best * 1000.0 / ops.size(), (unsigned)failed);
+    }
+
+    // A primeira passada do pda_mem deixou os picos registrados; mostra os níveis.
+    LvMem::print_stats("replay");
+    return 0;
+}
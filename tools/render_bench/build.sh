@@ -0,0 +1,28 @@
+#!/bin/sh
+# Compila o benchmark de renderização por tela para o host (gcc/g++ do sistema).
+# Gera .pio/host/render_bench (apps de src/apps com o lv_conf.h do projeto) e,
+# se preciso, o pacote de ícones .pio/host/assets.bin.
+# Uso: tools/render_bench/build.sh   (a partir da raiz do projeto)
+set -e
+
+OUT=.pio/host/render_bench.obj
+mkdir -p "$OUT"
+
+# tools/host/include primeiro: os shims (secrets.h, WiFi.h, ...) vencem os de src/
+FLAGS="-O2 -DLV_CONF_INCLUDE_SIMPLE -DARDUINOJSON_ENABLE_ARDUINO_STRING=1 -Itools/host/include -Ilib -Ilib/lvgl -Ilib/ArduinoJson/src -Isrc"
+
+# Ícones da partição "assets": só refaz o pacote se algum ícone mudou
+ASSETS=.pio/host/assets.bin
+if [ ! -f "$ASSETS" ] || [ -n "$(find src/Icons tools/icons tools/assets -newer "$ASSETS" | head -n 1)" ]; then
+    python3 tools/assets/pack_assets.py "$ASSETS" > /dev/null
+fi
+
+for f in $(find lib/lvgl/src src/fonts/generated -name '*.c'); do
+    o="$OUT/$(echo "$f" | tr '/.' '__').o"
+    [ "$o" -nt "$f" ] && [ "$o" -nt lib/lv_conf.h ] || cc -c -w $FLAGS "$f" -o "$o"
+done
+
+SRCS="tools/render_bench/render_bench.cpp tools/host/arduino_host.cpp tools/host/esp32_host.cpp \
+    src/system/pda_mem.cpp src/system/pda_log.cpp src/system/spi_bus.cpp src/system/tft_scroll.cpp src/system/tft_rgb444.cpp src/system/sd_card.cpp src/input/touch/display_backend.cpp src/input/touch/display_backend_tft_espi.cpp src/system/asset_pack.cpp src/input/trackball/trackball.cpp src/utils/utils.cpp"
+c++ -std=gnu++17 $FLAGS $SRCS "$OUT"/*.o -lm -o .pio/host/render_bench
+echo "built .pio/host/render_bench"
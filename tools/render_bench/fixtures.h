@@ -0,0 +1,98 @@
+#pragma once
+
+/**
+ * Fixtures do render_bench
+ *
+ * Os dados que os apps buscariam na rede, no formato das respostas reais:
+ * - Weather: resposta do /data/2.5/weather da OpenWeatherMap.
+ * - Notes/Calendar: JSON dos Google Apps Scripts (src/utils/google_*.gs).
+ * - Settings: redes que o scan de Wi-Fi encontra.
+ *
+ * Os textos são fixos (sem hora atual nem números aleatórios) para que o hash
+ * do quadro só mude quando o desenho mudar.
+ */
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+namespace Fixtures {
+
+// Mês mostrado pelo Calendar (em vez da data do sistema)
+const int CALENDAR_YEAR = 2025;
+const int CALENDAR_MONTH = 8;
+// Dia com vários eventos: a lista do dia é o cenário calendar_events
+const int CALENDAR_BUSY_DAY = 12;
+
+const char* WEATHER_JSON =
+    "{\"coord\":{\"lon\":-46.6361,\"lat\":-23.5475},"
+    "\"weather\":[{\"id\":803,\"main\":\"Clouds\",\"description\":\"nublado com períodos de sol\",\"icon\":\"04d\"}],"
+    "\"base\":\"stations\",\"main\":{\"temp\":22.4,\"feels_like\":22.1,\"temp_min\":20.9,\"temp_max\":23.8,"
+    "\"pressure\":1017,\"humidity\":64},\"visibility\":10000,\"wind\":{\"speed\":3.6,\"deg\":140},"
+    "\"clouds\":{\"all\":75},\"dt\":1755000000,\"sys\":{\"country\":\"BR\",\"sunrise\":1754990000,"
+    "\"sunset\":1755031000},\"timezone\":-10800,\"id\":3448439,\"name\":\"São Paulo\",\"cod\":200}";
+
+struct Network {
+    const char* ssid;
+    int32_t rssi;
+    wifi_auth_mode_t auth;
+};
+
+const Network NETWORKS[] = {
+    {"Casa_5G", -48, WIFI_AUTH_WPA2_PSK},
+    {"Casa_2G", -57, WIFI_AUTH_WPA2_PSK},
+    {"Escritório", -66, WIFI_AUTH_WPA_WPA2_PSK},
+    {"Café Central", -71, WIFI_AUTH_OPEN},
+    {"VIVO-8A3F", -78, WIFI_AUTH_WPA2_PSK},
+    {"NET_2G_1234", -84, WIFI_AUTH_WPA2_PSK},
+    {"Convidados", -89, WIFI_AUTH_OPEN},
+};
+
+const char* TASK_TITLES[] = {
+    "Comprar café e pão",       "Revisar o relatório mensal", "Ligar para o dentista",
+    "Pagar a conta de luz",     "Enviar fotos da viagem",     "Trocar o filtro de água",
+    "Reunião com a equipe às 15h", "Renovar a CNH",          "Estudar para a prova de cálculo",
+    "Levar o carro na revisão",
+};
+
+const char* EVENT_TITLES[] = {
+    "Reunião de planejamento", "Dentista", "Aniversário da Ana", "Aula de inglês",
+    "Entrega do projeto",      "Academia", "Almoço com clientes", "Show no parque",
+};
+
+/**
+ * @brief Lista de `count` tarefas, como o script de tarefas responde.
+ */
+inline String tasks_json(int count) {
+    String json = "{\"items\":[";
+    char item[160];
+    for (int i = 0; i < count; i++) {
+        snprintf(item, sizeof(item), "%s{\"id\":\"task%03d\",\"title\":\"%s (%d)\",\"status\":\"needsAction\"}",
+                 i ? "," : "", i, TASK_TITLES[i % (sizeof(TASK_TITLES) / sizeof(TASK_TITLES[0]))], i + 1);
+        json += item;
+    }
+    json += "]}";
+    return json;
+}
+
+/**
+ * @brief `count` eventos espalhados pelo mês do Calendar, em UTC como o script do calendário responde.
+ * Um em cada três cai no CALENDAR_BUSY_DAY.
+ */
+inline String events_json(int count) {
+    String json = "{\"items\":[";
+    char item[320];
+    for (int i = 0; i < count; i++) {
+        int day = i % 3 == 0 ? CALENDAR_BUSY_DAY : 1 + (i * 5) % 28;
+        int hour = 11 + (i * 3) % 10;
+        snprintf(item, sizeof(item),
+                 "%s{\"id\":\"event%03d\",\"title\":\"%s\",\"startTime\":\"%04d-%02d-%02dT%02d:00:00Z\","
+                 "\"endTime\":\"%04d-%02d-%02dT%02d:00:00Z\",\"description\":\"\",\"location\":\"\"}",
+                 i ? "," : "", i, EVENT_TITLES[i % (sizeof(EVENT_TITLES) / sizeof(EVENT_TITLES[0]))], CALENDAR_YEAR,
+                 CALENDAR_MONTH, day, hour, CALENDAR_YEAR, CALENDAR_MONTH, day, hour + 1);
+        json += item;
+    }
+    json += "]}";
+    return json;
+}
+
+} // namespace Fixtures
@@ -0,0 +1,14 @@
+"""
+Ambientes de host do PlatformIO (pio run -e native / -e simulator)
+
+O programa de host é a ferramenta de tools/ dada por custom_host_tool no
+platformio.ini (render_bench ou simulator), com os shims de tools/host no
+lugar do Arduino/ESP32. Este script acrescenta essas fontes ao build. O pacote
+de ícones sai em .pio/build/<ambiente>/assets.bin (pack_assets.py).
+"""
+
+Import("env")  # noqa: F821 - definido pelo SCons do PlatformIO
+
+tool = env.GetProjectOption("custom_host_tool", "render_bench")  # noqa: F821
+env.BuildSources("$BUILD_DIR/tools_host", "$PROJECT_DIR/tools/host", src_filter="+<*.cpp>")  # noqa: F821
+env.BuildSources("$BUILD_DIR/" + tool, "$PROJECT_DIR/tools/" + tool, src_filter="+<*.cpp>")  # noqa: F821
@@ -0,0 +1,544 @@
+/**
+ * Benchmark de renderização por tela
+ *
+ * Compila os apps de verdade (src/apps) com o lv_conf.h do projeto e os shims
+ * de tools/host (Arduino, Wi-Fi, HTTP, TFT, ...). O display é registrado pelo
+ * próprio DisplayTouch::init(), e o TFT_eSPI do host guarda os pixels do flush
+ * num framebuffer em memória. Os dados de rede vêm de fixtures (fixtures.h).
+ *
+ * Para cada cenário (uma tela num estado típico) mede:
+ *   frame_ms   - redesenho da tela inteira
+ *   step_ms    - tempo do próprio app numa interação típica (ex: mover a seleção)
+ *   update_ms  - redesenho só da área invalidada por essa interação
+ *   inv_px     - pixels redesenhados por essa interação, somando as áreas
+ *                invalidadas (inv_pct: % da tela; passa de 100 se elas se sobrepõem)
+ *   heap_*     - memória do LVGL (pda_mem): em uso com a tela montada e pico
+ *                desde o início do cenário
+ *   hash       - FNV-1a do framebuffer: muda quando o desenho da tela muda
+ *
+ * Os quadros aqui vêm um atrás do outro: o RGB444 automático (TftRgb444) fica
+ * desligado para que o framebuffer seja sempre o de RGB565.
+ *
+ * Depois, a rolagem dos containers (lista do Notes, painel de Wi-Fi das
+ * configurações e uma faixa horizontal da altura da tela, o caso que o
+ * ST7789 rola sozinho na paisagem), passo a passo, em quatro modos:
+ *   full    - full_refresh: a tela inteira a cada passo
+ *   full444 - full_refresh com o TftRgb444 segurado: a tela inteira em 12 bits
+ *   partial - refresh parcial, o container inteiro a cada passo
+ *   hw      - com o TftScroll: só a faixa descoberta quando o container é elegível
+ * e para cada modo:
+ *   bytes_step - bytes no SPI do display por passo (SpiBus, comandos incluídos)
+ *   wire_ms    - tempo desses bytes no fio, no clock do display
+ *   fps_bus    - passos por segundo que o SPI comporta (1000 / wire_ms)
+ *   render_ms  - render + flush por passo, no host
+ *   accel      - passos feitos no painel (VSCRDEF/VSCSAD)
+ *   ok         - a tela depois dos passos é igual a um redesenho completo
+ *
+ * Por fim, as camadas retidas (RenderCache) do menu com refresh parcial: a
+ * cada interação a seleção muda e o ícone pulsa, e depois a tela é redesenhada:
+ *   hits/misses   - usos das camadas (hit_rate em %)
+ *   stale         - camadas inválidas no fim de um pulso (nenhum quadro as refez)
+ *   redraw_misses - faltas no redesenho da tela depois do pulso
+ *   ok            - stale e redraw_misses em 0
+ *
+ * A saída é uma linha JSON por cenário no stdout; os logs do LVGL e dos apps
+ * vão para o stderr.
+ *
+ * Uso:
+ *   tools/render_bench/build.sh
+ *   .pio/host/render_bench [--frames N] [--updates N] [--notes N] [--events N]
+ *                          [--scroll-steps N] [--scroll-px N]
+ *                          [--assets pacote.bin] [--dump pasta] [cenário ... | render_cache]
+ *   --dump grava o quadro de cada cenário em <pasta>/<cenário>.ppm
+ *   --scroll-steps 0 pula a rolagem
+ * ou pelo PlatformIO: pio run -e native && .pio/build/native/program
+ */
+
+#include <Arduino.h>
+#include <esp_partition.h>
+#include <chrono>
+#include <unistd.h>
+#include "input/input.h"
+#include "apps/apps.h"
+#include "system/asset_pack.h"
+#include "system/spi_bus.h"
+#include "system/tft_scroll.h"
+#include "system/tft_rgb444.h"
+#include "fixtures.h"
+
+namespace {
+
+const char* CONNECTED_SSID = "Casa_5G";
+const int SCREEN_PX = TFT_WIDTH * TFT_HEIGHT;
+
+FILE* out = stdout;
+lv_disp_t* disp = nullptr;
+uint32_t refreshed_px = 0;
+int notes_count = 25;
+int events_count = 12;
+int scroll_steps = 40;
+int scroll_px = 8;
+const char* dump_dir = nullptr;
+
+double now_ms() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// monitor_cb do firmware (SysMonitor), chamado antes da contagem
+void (*firmware_monitor_cb)(lv_disp_drv_t*, uint32_t, uint32_t) = nullptr;
+
+void monitor_cb(lv_disp_drv_t* drv, uint32_t time, uint32_t px) {
+    if (firmware_monitor_cb) firmware_monitor_cb(drv, time, px);
+    refreshed_px += px;
+}
+
+/*Roda o loop() do firmware até as animações terminarem (o relógio avança sem esperar)*/
+void settle() {
+    for (int i = 0; i < 3 || (lv_anim_count_running() && i < 300); i++) {
+        AppManager::handle();
+        delay(10);
+    }
+    lv_refr_now(NULL);
+}
+
+void open_app(AppManager::App app) {
+    AppManager::show_app(app);
+    settle();
+}
+
+uint32_t frame_hash() {
+    const uint16_t* fb = DisplayBackend::tft.host_framebuffer();
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < SCREEN_PX; i++) {
+        h = (h ^ (fb[i] & 0xFF)) * 16777619u;
+        h = (h ^ (fb[i] >> 8)) * 16777619u;
+    }
+    return h;
+}
+
+void dump_frame(const char* name) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.ppm", dump_dir, name);
+    if (!DisplayBackend::tft.host_write_ppm(path)) fprintf(stderr, "render_bench: can't write %s\n", path);
+}
+
+lv_obj_t* settings_header(int index) {
+    return lv_obj_get_child(lv_obj_get_child(Settings::main_container, index), 0);
+}
+
+// --- Cenários ---
+
+void setup_mainmenu() {
+    open_app(AppManager::APP_MAIN_MENU);
+}
+
+void step_mainmenu(int i) {
+    // Alterna a seleção entre Calendar e Map
+    MainMenu::selected_app_index = i % 2 ? 4 : 5;
+    MainMenu::update_selection_visuals();
+}
+
+void setup_calculator() {
+    open_app(AppManager::APP_CALCULATOR);
+    // Duas contas no histórico e um número no visor
+    const char* digits[] = {"1", "2", "3", "4", "7", "6", "1", "5"};
+    Calculator::handle_digit_press(digits[0]);
+    Calculator::handle_digit_press(digits[1]);
+    Calculator::handle_operator_press('+');
+    Calculator::handle_digit_press(digits[2]);
+    Calculator::handle_digit_press(digits[3]);
+    Calculator::handle_equals_press();
+    Calculator::handle_digit_press(digits[4]);
+    Calculator::handle_operator_press('*');
+    Calculator::handle_digit_press(digits[5]);
+    Calculator::handle_equals_press();
+    Calculator::handle_digit_press(digits[6]);
+    Calculator::handle_digit_press(digits[7]);
+    settle();
+}
+
+void step_calculator(int i) {
+    if (i % 2 == 0) Calculator::handle_digit_press("9");
+    else Calculator::handle_backspace_press();
+}
+
+void setup_settings_wifi() {
+    // Desconectado, o painel de Wi-Fi mostra o resultado do scan
+    WiFi.host_set_connected(nullptr);
+    open_app(AppManager::APP_SETTINGS);
+    // O clique alterna o painel: só abre se estiver fechado
+    if (lv_obj_has_flag(Settings::wifi_content_panel, LV_OBJ_FLAG_HIDDEN)) {
+        lv_event_send(settings_header(0), LV_EVENT_CLICKED, NULL);
+    }
+    settle();
+}
+
+void step_settings_wifi(int i) {
+    Settings::wifi_list_selected_index = i % 2 ? 0 : 1;
+    Settings::update_wifi_list_selection_visuals();
+}
+
+void setup_settings_display() {
+    WiFi.host_set_connected(CONNECTED_SSID);
+    open_app(AppManager::APP_SETTINGS);
+    lv_event_send(settings_header(1), LV_EVENT_CLICKED, NULL);
+    settle();
+}
+
+void step_settings_display(int i) {
+    lv_slider_set_value(Settings::brightness_slider, i % 2 ? 80 : 85, LV_ANIM_OFF);
+    lv_event_send(Settings::brightness_slider, LV_EVENT_VALUE_CHANGED, NULL);
+}
+
+void setup_calendar_month() {
+    WiFi.host_set_connected(CONNECTED_SSID);
+    open_app(AppManager::APP_CALENDAR);
+    // Com os eventos carregados a lista cobre a grade; "voltar" mostra o mês
+    Calendar::back_button_event_cb(NULL);
+    settle();
+}
+
+void step_calendar_month(int i) {
+    if (i % 2 == 0) Calendar::next_month_btn_event_cb(NULL);
+    else Calendar::prev_month_btn_event_cb(NULL);
+}
+
+void setup_calendar_events() {
+    WiFi.host_set_connected(CONNECTED_SSID);
+    open_app(AppManager::APP_CALENDAR);
+    // Toque no dia cheio: a grade some e a lista mostra os eventos do dia
+    uint32_t count = lv_obj_get_child_cnt(Calendar::calendar_grid_cont);
+    for (uint32_t i = 0; i < count; i++) {
+        lv_obj_t* child = lv_obj_get_child(Calendar::calendar_grid_cont, i);
+        if ((intptr_t)lv_obj_get_user_data(child) == Fixtures::CALENDAR_BUSY_DAY) {
+            lv_event_send(child, LV_EVENT_CLICKED, NULL);
+            break;
+        }
+    }
+    settle();
+}
+
+void step_calendar_events(int i) {
+    VirtualList::move_selection(&Calendar::events_vlist, i % 2 ? -1 : 1);
+}
+
+void setup_notes() {
+    WiFi.host_set_connected(CONNECTED_SSID);
+    open_app(AppManager::APP_NOTES);
+}
+
+void step_notes(int i) {
+    VirtualList::move_selection(&Notes::tasks_vlist, i % 2 ? -1 : 1);
+}
+
+void setup_weather() {
+    WiFi.host_set_connected(CONNECTED_SSID);
+    open_app(AppManager::APP_WEATHER);
+}
+
+void step_weather(int i) {
+    // Nova leitura com outra temperatura, como no refresh por toque
+    Weather::update_weather_ui("São Paulo", i % 2 ? 22.4f : 23.1f, "nublado com períodos de sol",
+                               Weather::get_weather_image_from_code("04d"));
+}
+
+struct Scenario {
+    const char* name;
+    void (*setup)();
+    void (*step)(int i);
+    const int* items; // Itens da fixture (listas), ou nullptr
+};
+
+const int network_count = sizeof(Fixtures::NETWORKS) / sizeof(Fixtures::NETWORKS[0]);
+
+const Scenario scenarios[] = {
+    {"mainmenu", setup_mainmenu, step_mainmenu, nullptr},
+    {"calculator", setup_calculator, step_calculator, nullptr},
+    {"settings_wifi", setup_settings_wifi, step_settings_wifi, &network_count},
+    {"settings_display", setup_settings_display, step_settings_display, nullptr},
+    {"calendar_month", setup_calendar_month, step_calendar_month, &events_count},
+    {"calendar_events", setup_calendar_events, step_calendar_events, &events_count},
+    {"notes", setup_notes, step_notes, &notes_count},
+    {"weather", setup_weather, step_weather, nullptr},
+};
+
+void run(const Scenario& s, int frames, int updates) {
+    pda_mem_reset_peak();
+    s.setup();
+    pda_mem_stats_t mem;
+    pda_mem_get_stats(&mem);
+
+    // Quadro inteiro
+    double total = 0, min = 1e9, max = 0;
+    for (int i = 0; i < frames; i++) {
+        lv_obj_invalidate(lv_scr_act());
+        double start = now_ms();
+        lv_refr_now(NULL);
+        double t = now_ms() - start;
+        total += t;
+        if (t < min) min = t;
+        if (t > max) max = t;
+    }
+    uint32_t hash = frame_hash();
+    if (dump_dir) dump_frame(s.name);
+
+    // Interações: só a área invalidada é redesenhada; mede o seu tamanho
+    double step_total = 0, update_total = 0;
+    uint64_t inv_total = 0;
+    for (int i = 0; i < updates; i++) {
+        double start = now_ms();
+        s.step(i);
+        step_total += now_ms() - start;
+
+        refreshed_px = 0;
+        start = now_ms();
+        lv_refr_now(NULL);
+        update_total += now_ms() - start;
+        inv_total += refreshed_px;
+        settle();
+    }
+    pda_mem_stats_t after;
+    pda_mem_get_stats(&after);
+
+    double inv_px = updates ? (double)inv_total / updates : 0;
+    fprintf(out,
+            "{\"scenario\":\"%s\",\"items\":%d,\"frames\":%d,\"frame_ms\":%.3f,\"frame_ms_min\":%.3f,"
+            "\"frame_ms_max\":%.3f,\"updates\":%d,\"step_ms\":%.3f,\"update_ms\":%.3f,\"inv_px\":%.0f,"
+            "\"inv_pct\":%.1f,\"heap_used\":%u,\"heap_peak\":%u,\"heap_blocks\":%u,\"sram_used\":%u,"
+            "\"psram_used\":%u,\"hash\":\"%08x\"}\n",
+            s.name, s.items ? *s.items : 0, frames, frames ? total / frames : 0, frames ? min : 0, max, updates,
+            updates ? step_total / updates : 0, updates ? update_total / updates : 0, inv_px,
+            inv_px * 100.0 / SCREEN_PX, (unsigned)mem.bytes_in_use, (unsigned)after.peak_bytes,
+            (unsigned)mem.live_blocks, (unsigned)mem.sram.bytes_in_use, (unsigned)mem.psram.bytes_in_use, hash);
+    fflush(out);
+}
+
+// --- Rolagem ---
+
+lv_obj_t* filmstrip = nullptr;
+
+void setup_filmstrip() {
+    // Cartões numa faixa da altura da tela, rolando na horizontal
+    if (!filmstrip) {
+        lv_obj_t* screen = lv_obj_create(NULL);
+        filmstrip = lv_obj_create(screen);
+        lv_obj_remove_style_all(filmstrip);
+        lv_obj_set_size(filmstrip, LV_PCT(100), LV_PCT(100));
+        lv_obj_set_style_bg_color(filmstrip, lv_color_hex(0x202830), 0);
+        lv_obj_set_style_bg_opa(filmstrip, LV_OPA_COVER, 0);
+        lv_obj_set_style_pad_all(filmstrip, 12, 0);
+        lv_obj_set_style_pad_column(filmstrip, 12, 0);
+        lv_obj_set_style_width(filmstrip, 4, LV_PART_SCROLLBAR);
+        lv_obj_set_style_bg_color(filmstrip, lv_color_hex(0xC0C8D0), LV_PART_SCROLLBAR);
+        lv_obj_set_style_bg_opa(filmstrip, LV_OPA_COVER, LV_PART_SCROLLBAR);
+        lv_obj_set_flex_flow(filmstrip, LV_FLEX_FLOW_ROW);
+        lv_obj_set_scroll_dir(filmstrip, LV_DIR_HOR);
+        for (int i = 0; i < 12; i++) {
+            lv_obj_t* card = lv_obj_create(filmstrip);
+            lv_obj_set_size(card, 120, LV_PCT(100));
+            lv_obj_set_style_bg_color(card, lv_palette_main((lv_palette_t)(i % _LV_PALETTE_LAST)), 0);
+            lv_obj_t* label = lv_label_create(card);
+            lv_label_set_text_fmt(label, "Card %d", i + 1);
+            lv_obj_center(label);
+        }
+    }
+    lv_scr_load(lv_obj_get_screen(filmstrip));
+    settle();
+}
+
+lv_obj_t* filmstrip_container() { return filmstrip; }
+lv_obj_t* notes_container() { return Notes::tasks_vlist.cont; }
+lv_obj_t* settings_container() { return Settings::main_container; }
+
+struct ScrollScenario {
+    const char* name;
+    void (*setup)();
+    lv_obj_t* (*container)();
+    bool horizontal;
+};
+
+const ScrollScenario scroll_scenarios[] = {
+    {"notes", setup_notes, notes_container, false},
+    {"settings_wifi", setup_settings_wifi, settings_container, false},
+    {"filmstrip", setup_filmstrip, filmstrip_container, true},
+};
+
+void run_scroll(const ScrollScenario& s, const char* mode) {
+    s.setup();
+    lv_obj_t* cont = s.container();
+    bool rgb444 = strcmp(mode, "full444") == 0;
+    disp->driver->full_refresh = rgb444 || strcmp(mode, "full") == 0;
+    bool was_enabled = TftScroll::enabled();
+    TftScroll::set_enabled(strcmp(mode, "hw") == 0);
+    if (rgb444) TftRgb444::hold(TFT_RGB444_VIDEO);
+    lv_obj_scroll_to(cont, 0, 0, LV_ANIM_OFF);
+    lv_obj_invalidate(lv_scr_act()); // Começa de uma tela inteira no modo
+    settle();
+
+    SpiBus::DeviceStats bus = SpiBus::stats(SPI_BUS_TFT);
+    uint32_t accel = TftScroll::stats().accelerated;
+    int dir = -1; // Conteúdo andando para cima/esquerda: rola para baixo/direita
+    double render = 0;
+    for (int i = 0; i < scroll_steps; i++) {
+        lv_coord_t left = dir < 0 ? (s.horizontal ? lv_obj_get_scroll_right(cont) : lv_obj_get_scroll_bottom(cont))
+                                  : (s.horizontal ? lv_obj_get_scroll_left(cont) : lv_obj_get_scroll_top(cont));
+        if (left <= 0) dir = -dir;
+        lv_coord_t d = dir * scroll_px;
+        lv_obj_scroll_by_bounded(cont, s.horizontal ? d : 0, s.horizontal ? 0 : d, LV_ANIM_OFF);
+        double start = now_ms();
+        lv_refr_now(NULL);
+        render += now_ms() - start;
+    }
+    SpiBus::DeviceStats after = SpiBus::stats(SPI_BUS_TFT);
+    accel = TftScroll::stats().accelerated - accel;
+
+    // O que ficou na tela tem que ser o mesmo que um redesenho completo
+    uint32_t hash = frame_hash();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    bool ok = hash == frame_hash();
+
+    disp->driver->full_refresh = 0;
+    TftScroll::set_enabled(was_enabled);
+    if (rgb444) {
+        // Espera o acabamento em RGB565, para não cair no próximo modo
+        uint32_t settles = TftRgb444::stats().settles;
+        TftRgb444::release(TFT_RGB444_VIDEO);
+        for (int i = 0; i < 100 && TftRgb444::stats().settles == settles; i++) {
+            lv_timer_handler();
+            delay(10);
+        }
+    }
+    settle();
+
+    double bytes = scroll_steps ? (double)(after.bytes - bus.bytes) / scroll_steps : 0;
+    double wire_ms = after.clock_hz ? bytes * 8 * 1000.0 / after.clock_hz : 0;
+    fprintf(out,
+            "{\"scroll\":\"%s\",\"mode\":\"%s\",\"steps\":%d,\"step_px\":%d,\"bytes_step\":%.0f,"
+            "\"wire_ms\":%.3f,\"fps_bus\":%.1f,\"render_ms\":%.3f,\"accel\":%u,\"ok\":%s}\n",
+            s.name, mode, scroll_steps, scroll_px, bytes, wire_ms, wire_ms > 0 ? 1000.0 / wire_ms : 0,
+            scroll_steps ? render / scroll_steps : 0, (unsigned)accel, ok ? "true" : "false");
+    fflush(out);
+}
+
+// --- Camadas retidas (RenderCache) ---
+
+void render_cache_counts(uint32_t* hits, uint32_t* misses, uint32_t* stale) {
+    *hits = *misses = *stale = 0;
+#if LV_USE_RENDER_CACHE
+    for (const lv_obj_render_cache_t* c = lv_obj_render_cache_get_next(NULL); c; c = lv_obj_render_cache_get_next(c)) {
+        if (lv_obj_get_screen(c->obj) != lv_scr_act()) continue;
+        *hits += c->hits;
+        *misses += c->misses;
+        *stale += !c->valid;
+    }
+#endif
+}
+
+/*Menu com refresh parcial: a seleção muda e o ícone pulsa (só parte do bloco
+  invalidada a cada quadro). Depois de cada pulso, um redesenho da tela tem
+  que achar todas as camadas prontas*/
+void run_render_cache(int updates) {
+    setup_mainmenu();
+    disp->driver->full_refresh = 0;
+    RenderCache::reset_stats();
+    uint32_t redraw_misses = 0, stale = 0;
+    for (int i = 0; i < updates; i++) {
+        step_mainmenu(i);
+        settle();
+
+        uint32_t hits, misses, invalid;
+        render_cache_counts(&hits, &misses, &invalid);
+        stale += invalid;
+        // Pela camada de cima (como um aviso que fecha): redesenha a tela sem mexer nas camadas
+        lv_obj_invalidate(lv_layer_top());
+        lv_refr_now(NULL);
+        uint32_t hits_after, misses_after;
+        render_cache_counts(&hits_after, &misses_after, &invalid);
+        redraw_misses += misses_after - misses;
+    }
+    uint32_t hits, misses, invalid;
+    render_cache_counts(&hits, &misses, &invalid);
+    uint32_t total = hits + misses;
+    fprintf(out,
+            "{\"render_cache\":\"mainmenu\",\"updates\":%d,\"hits\":%u,\"misses\":%u,\"hit_rate\":%.1f,"
+            "\"stale\":%u,\"redraw_misses\":%u,\"ok\":%s}\n",
+            updates, (unsigned)hits, (unsigned)misses, total ? hits * 100.0 / total : 0, (unsigned)stale,
+            (unsigned)redraw_misses, stale == 0 && redraw_misses == 0 ? "true" : "false");
+    fflush(out);
+}
+
+void load_assets(const char* path) {
+    const char* candidates[] = {path, ".pio/host/assets.bin", ".pio/build/native/assets.bin"};
+    for (const char* p : candidates) {
+        if (p && host_partition_load("assets", p)) {
+            fprintf(stderr, "render_bench: assets from %s\n", p);
+            return;
+        }
+    }
+    fprintf(stderr, "render_bench: no assets pack, icons will be missing (python3 tools/assets/pack_assets.py "
+                    ".pio/host/assets.bin)\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = 30;
+    int updates = 20;
+    const char* assets = nullptr;
+    const char* only[16];
+    int only_count = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) frames = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--updates") == 0 && i + 1 < argc) updates = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--notes") == 0 && i + 1 < argc) notes_count = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--events") == 0 && i + 1 < argc) events_count = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--scroll-steps") == 0 && i + 1 < argc) scroll_steps = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--scroll-px") == 0 && i + 1 < argc) scroll_px = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--assets") == 0 && i + 1 < argc) assets = argv[++i];
+        else if (strcmp(argv[i], "--dump") == 0 && i + 1 < argc) dump_dir = argv[++i];
+        else if (only_count < 16) only[only_count++] = argv[i];
+    }
+
+    // Resultados no stdout; os printf do LVGL e dos apps vão para o stderr
+    out = fdopen(dup(STDOUT_FILENO), "w");
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+
+    // Mesma sequência do setup() do firmware
+    Serial.begin(115200);
+    DisplayTouch::init();
+    TftRgb444::set_auto(false);
+    disp = lv_disp_get_default();
+    firmware_monitor_cb = disp->driver->monitor_cb;
+    disp->driver->monitor_cb = monitor_cb;
+    load_assets(assets);
+    AssetPack::init();
+    Trackball::init();
+
+    for (const Fixtures::Network& n : Fixtures::NETWORKS) WiFi.host_add_network(n.ssid, n.rssi, n.auth);
+    HTTPClient::host_route("api.openweathermap.org", HTTP_CODE_OK, Fixtures::WEATHER_JSON);
+    HTTPClient::host_route("fixture/tasks", HTTP_CODE_OK, Fixtures::tasks_json(notes_count));
+    HTTPClient::host_route("fixture/calendar", HTTP_CODE_OK, Fixtures::events_json(events_count));
+    Calendar::current_year = Fixtures::CALENDAR_YEAR;
+    Calendar::current_month = Fixtures::CALENDAR_MONTH;
+
+    AppManager::init();
+    settle();
+
+    for (const Scenario& s : scenarios) {
+        bool selected = only_count == 0;
+        for (int i = 0; i < only_count; i++) selected |= strcmp(only[i], s.name) == 0;
+        if (selected) run(s, frames, updates);
+    }
+    for (const ScrollScenario& s : scroll_scenarios) {
+        bool selected = only_count == 0;
+        for (int i = 0; i < only_count; i++) selected |= strcmp(only[i], s.name) == 0;
+        if (!selected || scroll_steps <= 0) continue;
+        for (const char* mode : {"full", "full444", "partial", "hw"}) run_scroll(s, mode);
+    }
+    bool cache_selected = only_count == 0;
+    for (int i = 0; i < only_count; i++) cache_selected |= strcmp(only[i], "render_cache") == 0;
+    if (cache_selected && updates > 0) run_render_cache(updates);
+    return 0;
+}
@@ -0,0 +1,17 @@
+#!/bin/sh
+# Compila o micro-benchmark do empacotamento RGB444 para o host (gcc/g++ do sistema).
+# Uso: tools/rgb444_bench/build.sh   (a partir da raiz do projeto)
+set -e
+
+OUT=.pio/host/rgb444_bench.obj
+mkdir -p "$OUT"
+
+FLAGS="-O2 -DLV_CONF_INCLUDE_SIMPLE -DARDUINOJSON_ENABLE_ARDUINO_STRING=1 -Ilib -Ilib/lvgl -Ilib/ArduinoJson/src -Isrc -Itools/host/include"
+
+for f in $(find lib/lvgl/src src/fonts/generated -name '*.c'); do
+    o="$OUT/$(echo "$f" | tr '/.' '__').o"
+    [ "$o" -nt "$f" ] || cc -c -w $FLAGS "$f" -o "$o"
+done
+
+c++ -std=c++17 $FLAGS tools/rgb444_bench/rgb444_bench.cpp tools/host/arduino_host.cpp src/system/pda_mem.cpp src/system/pda_log.cpp src/system/tft_scroll.cpp src/system/tft_rgb444.cpp "$OUT"/*.o -lm -o .pio/host/rgb444_bench
+echo "built .pio/host/rgb444_bench"
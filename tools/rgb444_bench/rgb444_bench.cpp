@@ -0,0 +1,196 @@
+/**
+ * RGB444 pack micro-benchmark
+ *
+ * Mede no host o kernel de empacotamento do TftRgb444 (RGB565 do LVGL para os
+ * 12 bits por pixel do ST7789), com arredondamento e com o pontilhado 4x4.
+ *
+ * Antes de medir, confere o kernel contra uma conta direta em ponto flutuante:
+ * larguras e alturas pequenas (pares e ímpares), as quatro fases do pontilhado
+ * em X e Y, destino separado e no próprio buffer, o tamanho devolvido e os
+ * bytes depois dele intactos. Sai com erro no primeiro pixel diferente.
+ *
+ * Depois mostra o erro médio de um degradê liso (o pontilhado mantém a média
+ * de cada bloco 4x4 perto da cor original) e os bytes e quadros por segundo
+ * que o SPI comporta para a tela inteira em RGB565 e RGB444.
+ *
+ * Uso:
+ *   tools/rgb444_bench/build.sh
+ *   .pio/host/rgb444_bench [repetições]
+ */
+
+#include <Arduino.h>
+#include <chrono>
+#include <math.h>
+#include <lvgl.h>
+#include "system/spi_bus.h"
+#include "system/tft_rgb444.h"
+
+namespace {
+
+const int W = 320;
+const int H = 240;
+const uint8_t BAYER[4][4] = {{0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+
+lv_color_t src[W * H];
+lv_color_t work[W * H];
+uint8_t packed[W * H * 2 + 16];
+
+uint32_t rnd_state = 1;
+uint32_t rnd() {
+    rnd_state = rnd_state * 1103515245U + 12345U;
+    return rnd_state >> 8;
+}
+
+double now_ms() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+/*O nibble que o kernel deve produzir: v/max em 0..15 mais o limiar do pontilhado (ou meio, arredondando)*/
+int expected_nibble(int v, int max, int x, int y, bool dither) {
+    double bias = dither ? (2 * BAYER[y & 3][x & 3] + 1) / 32.0 : 0.5;
+    return (int)floor(v * 15.0 / max + bias);
+}
+
+/*Nibble `n` (0 = o mais alto do primeiro byte) do fluxo empacotado*/
+int nibble(const uint8_t* p, int n) {
+    return n & 1 ? p[n / 2] & 0x0F : p[n / 2] >> 4;
+}
+
+bool check_area(const lv_area_t* area, bool dither, bool in_place) {
+    int w = lv_area_get_width(area);
+    int h = lv_area_get_height(area);
+    int px = w * h;
+    for (int i = 0; i < px; i++) src[i].full = (uint16_t)rnd();
+
+    uint8_t* dst = packed;
+    if (in_place) {
+        memcpy(work, src, px * sizeof(lv_color_t));
+        dst = (uint8_t*)work;
+    } else {
+        memset(packed, 0xA5, sizeof(packed));
+    }
+    uint32_t len = TftRgb444::pack(area, in_place ? work : src, dst, dither);
+    if (len != TftRgb444::packed_size(px)) {
+        printf("MISMATCH %dx%d: %u bytes, expected %u\n", w, h, (unsigned)len, (unsigned)TftRgb444::packed_size(px));
+        return false;
+    }
+    if (!in_place && packed[len] != 0xA5) {
+        printf("MISMATCH %dx%d: wrote past %u bytes\n", w, h, (unsigned)len);
+        return false;
+    }
+    for (int i = 0; i < px; i++) {
+        int x = area->x1 + i % w, y = area->y1 + i / w;
+        lv_color_t c = src[i];
+        int want[3] = {expected_nibble(LV_COLOR_GET_R(c), 31, x, y, dither),
+                       expected_nibble(LV_COLOR_GET_G(c), 63, x, y, dither),
+                       expected_nibble(LV_COLOR_GET_B(c), 31, x, y, dither)};
+        for (int ch = 0; ch < 3; ch++) {
+            int got = nibble(dst, i * 3 + ch);
+            if (got == want[ch]) continue;
+            printf("MISMATCH %s%s area %d,%d..%d,%d: px %d,%d channel %d color %04x expected %x got %x\n",
+                   dither ? "dither" : "round", in_place ? " in place" : "", area->x1, area->y1, area->x2, area->y2,
+                   x, y, ch, c.full, want[ch], got);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool verify() {
+    int cases = 0;
+    for (int dither = 0; dither <= 1; dither++) {
+        for (int in_place = 0; in_place <= 1; in_place++) {
+            for (int w = 1; w <= 9; w++) {
+                for (int h = 1; h <= 5; h++) {
+                    for (int ofs = 0; ofs < 4; ofs++) {
+                        lv_area_t area = {(lv_coord_t)(ofs + 5), (lv_coord_t)(ofs * 3),
+                                          (lv_coord_t)(ofs + 5 + w - 1), (lv_coord_t)(ofs * 3 + h - 1)};
+                        if (!check_area(&area, dither, in_place)) return false;
+                        cases++;
+                    }
+                }
+            }
+            // A tela inteira, com as cores todas
+            lv_area_t full = {0, 0, W - 1, H - 1};
+            if (!check_area(&full, dither, in_place)) return false;
+            cases++;
+        }
+    }
+
+    // Preto e branco não podem ganhar pontilhado
+    lv_area_t block = {0, 0, 3, 3};
+    for (lv_color_t c : {lv_color_black(), lv_color_white()}) {
+        for (int i = 0; i < 16; i++) src[i] = c;
+        uint32_t len = TftRgb444::pack(&block, src, packed, true);
+        for (uint32_t i = 0; i < len; i++) {
+            if (packed[i] != (c.full ? 0xFF : 0x00)) {
+                printf("MISMATCH %s dithered: byte %u = %02x\n", c.full ? "white" : "black", (unsigned)i, packed[i]);
+                return false;
+            }
+        }
+        cases++;
+    }
+    printf("verified %d cases: same nibbles as the float reference\n", cases);
+    return true;
+}
+
+/*Erro da média de cada bloco 4x4 liso, em níveis de 8 bits, para todos os verdes (o canal que mais perde)*/
+double block_error(bool dither) {
+    lv_area_t block = {0, 0, 3, 3};
+    double worst = 0;
+    for (int g = 0; g < 64; g++) {
+        lv_color_t c = lv_color_make(0, g << 2, 0);
+        for (int i = 0; i < 16; i++) src[i] = c;
+        TftRgb444::pack(&block, src, packed, dither);
+        double sum = 0;
+        for (int i = 0; i < 16; i++) sum += nibble(packed, i * 3 + 1) * 255.0 / 15;
+        double err = fabs(sum / 16 - g * 255.0 / 63);
+        if (err > worst) worst = err;
+    }
+    return worst;
+}
+
+double bench(int reps, bool dither) {
+    lv_area_t full = {0, 0, W - 1, H - 1};
+    double total = 0;
+    for (int i = 0; i < reps; i++) {
+        memcpy(work, src, sizeof(work));
+        double start = now_ms();
+        TftRgb444::pack(&full, work, (uint8_t*)work, dither);
+        total += now_ms() - start;
+    }
+    return total / reps;
+}
+
+void print_wire(const char* name, uint32_t hz) {
+    uint32_t px = W * H;
+    uint32_t b565 = px * 2, b444 = TftRgb444::packed_size(px);
+    double ms565 = b565 * 8 * 1000.0 / hz, ms444 = b444 * 8 * 1000.0 / hz;
+    printf("%-26s RGB565 %6u B %6.2f ms %5.1f fps | RGB444 %6u B %6.2f ms %5.1f fps\n", name, (unsigned)b565, ms565,
+           1000 / ms565, (unsigned)b444, ms444, 1000 / ms444);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int reps = argc > 1 ? atoi(argv[1]) : 200;
+    if (reps < 1) reps = 1;
+
+    lv_init();
+    if (!verify()) return 1;
+
+    printf("green 4x4 block mean error: round %.2f, dither %.2f (8-bit levels)\n", block_error(false),
+           block_error(true));
+
+    rnd_state = 1;
+    for (int i = 0; i < W * H; i++) src[i].full = (uint16_t)rnd();
+    for (int dither = 0; dither <= 1; dither++) {
+        double ms = bench(reps, dither);
+        printf("pack %dx%d %-8s %8.4f ms (%.1f Mpx/s)\n", W, H, dither ? "dither" : "round", ms, W * H / ms / 1000);
+    }
+
+    print_wire("full frame, SPI_BUS_TFT_HZ", SPI_BUS_TFT_HZ);
+    print_wire("full frame, 27 MHz", 27000000);
+    return 0;
+}
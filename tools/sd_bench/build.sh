@@ -0,0 +1,19 @@
+#!/bin/sh
+# Compila o benchmark do cache de leitura do SdCard para o host (gcc/g++ do sistema).
+# O "cartão" é o diretório .pio/host/sd_bench, criado pelo próprio benchmark.
+# Uso: tools/sd_bench/build.sh   (a partir da raiz do projeto)
+set -e
+
+OUT=.pio/host/sd_bench.obj
+mkdir -p "$OUT"
+
+FLAGS="-O2 -DLV_CONF_INCLUDE_SIMPLE -DARDUINOJSON_ENABLE_ARDUINO_STRING=1 -Ilib -Ilib/lvgl -Ilib/ArduinoJson/src -Isrc -Itools/host/include"
+
+for f in $(find lib/lvgl/src src/fonts/generated -name '*.c'); do
+    o="$OUT/$(echo "$f" | tr '/.' '__').o"
+    [ "$o" -nt "$f" ] || cc -c -w $FLAGS "$f" -o "$o"
+done
+
+c++ -std=c++17 $FLAGS -DSD_CARD_MOUNT='".pio/host/sd_card"' tools/sd_bench/sd_bench.cpp tools/host/arduino_host.cpp \
+    src/system/pda_mem.cpp src/system/pda_log.cpp src/system/tft_scroll.cpp src/system/sd_card.cpp "$OUT"/*.o -lm -o .pio/host/sd_bench
+echo "built .pio/host/sd_bench"
@@ -0,0 +1,237 @@
+/**
+ * SD read cache benchmark
+ *
+ * Roda o SdCard no host (o "cartão" é o diretório .pio/host/sd_card) pelo
+ * driver 'S:' do LVGL, com o mesmo cache e a mesma leitura adiante do aparelho.
+ *
+ * Antes de medir, confere o que o driver entrega contra o conteúdo do arquivo:
+ * leituras sequenciais em pedaços pequenos, saltos e tamanhos aleatórios
+ * (dentro de um bloco, atravessando blocos, maiores que um bloco, passando do
+ * fim), uma escrita no meio de blocos já no cache, a listagem do diretório e
+ * um arquivo que não existe. Sai com erro na primeira diferença.
+ *
+ * Depois, para padrões de acesso típicos (fonte carregada aos poucos, imagem
+ * lida linha a linha, acesso aleatório), mostra quantas leituras do LVGL
+ * viraram leituras no cartão, quantas delas a UI esperou (faltas) e quantas
+ * foram adiante, e uma estimativa do tempo de UI preso no cartão, com e sem o
+ * cache, por um modelo simples do cartão no SPI (SD_SPI_HZ e um tempo fixo
+ * por leitura). No host a leitura adiante roda no fim de cada lv_fs_read; no
+ * aparelho ela corre na tarefa do SdCard enquanto a UI trabalha.
+ *
+ * Uso:
+ *   tools/sd_bench/build.sh
+ *   .pio/host/sd_bench
+ */
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <sys/stat.h>
+#include <vector>
+#include "system/sd_card.h"
+
+namespace {
+
+const uint32_t FILE_SIZE = 300001;          // Não múltiplo do bloco: o último é parcial
+const double CARD_HZ = 20e6;                // SD_SPI_HZ
+const double ACCESS_US = 600;               // Comando, espera pelo token e o FatFs, por leitura
+
+std::vector<uint8_t> content;
+
+uint32_t rnd_state = 1;
+uint32_t rnd() {
+    rnd_state = rnd_state * 1103515245U + 12345U;
+    return rnd_state >> 8;
+}
+
+bool write_file(const char* name, const uint8_t* data, size_t len) {
+    char path[128];
+    snprintf(path, sizeof(path), "%s/%s", SD_CARD_MOUNT, name);
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    bool ok = fwrite(data, 1, len, f) == len;
+    fclose(f);
+    return ok;
+}
+
+bool check_read(lv_fs_file_t* f, uint32_t pos, uint32_t len, const char* what) {
+    static uint8_t buf[4 * SD_CARD_BLOCK];
+    if (lv_fs_seek(f, pos, LV_FS_SEEK_SET) != LV_FS_RES_OK) {
+        printf("MISMATCH %s: seek to %u failed\n", what, (unsigned)pos);
+        return false;
+    }
+    uint32_t br = 0;
+    if (lv_fs_read(f, buf, len, &br) != LV_FS_RES_OK) {
+        printf("MISMATCH %s: read %u at %u failed\n", what, (unsigned)len, (unsigned)pos);
+        return false;
+    }
+    uint32_t want = pos >= content.size() ? 0 : std::min<uint32_t>(len, content.size() - pos);
+    if (br != want) {
+        printf("MISMATCH %s: read %u at %u returned %u bytes, expected %u\n", what, (unsigned)len, (unsigned)pos,
+               (unsigned)br, (unsigned)want);
+        return false;
+    }
+    for (uint32_t i = 0; i < br; i++) {
+        if (buf[i] == content[pos + i]) continue;
+        printf("MISMATCH %s: byte %u is %02x, expected %02x\n", what, (unsigned)(pos + i), buf[i], content[pos + i]);
+        return false;
+    }
+    return true;
+}
+
+bool verify() {
+    int cases = 0;
+    lv_fs_file_t f;
+    if (lv_fs_open(&f, SD_PATH("data.bin"), LV_FS_MODE_RD) != LV_FS_RES_OK) {
+        printf("MISMATCH can't open S:data.bin\n");
+        return false;
+    }
+
+    // Sequencial em pedaços que não casam com o bloco
+    for (uint32_t pos = 0; pos < FILE_SIZE; pos += 777, cases++) {
+        if (!check_read(&f, pos, 777, "sequential")) return false;
+    }
+    // Aleatório: dentro de um bloco, atravessando, maior que um bloco, passando do fim
+    for (int i = 0; i < 3000; i++, cases++) {
+        uint32_t pos = rnd() % (FILE_SIZE + 100);
+        uint32_t len = 1 + rnd() % (i % 3 == 0 ? 3 * SD_CARD_BLOCK : 600);
+        if (i % 7 == 0) pos = (pos / SD_CARD_BLOCK) * SD_CARD_BLOCK;    // Alinhado: pode ir direto
+        if (!check_read(&f, pos, len, "random")) return false;
+    }
+    lv_fs_close(&f);
+
+    // Escrita no meio de blocos que estão no cache: a leitura seguinte vê o novo
+    if (lv_fs_open(&f, SD_PATH("data.bin"), LV_FS_MODE_RD | LV_FS_MODE_WR) != LV_FS_RES_OK) return false;
+    if (!check_read(&f, SD_CARD_BLOCK - 1000, 2 * SD_CARD_BLOCK, "before write")) return false;
+    uint8_t patch[5000];
+    for (uint32_t i = 0; i < sizeof(patch); i++) patch[i] = (uint8_t)rnd();
+    uint32_t at = 2 * SD_CARD_BLOCK - 2500;
+    uint32_t bw = 0;
+    lv_fs_seek(&f, at, LV_FS_SEEK_SET);
+    if (lv_fs_write(&f, patch, sizeof(patch), &bw) != LV_FS_RES_OK || bw != sizeof(patch)) {
+        printf("MISMATCH write failed\n");
+        return false;
+    }
+    memcpy(&content[at], patch, sizeof(patch));
+    if (!check_read(&f, SD_CARD_BLOCK - 1000, 3 * SD_CARD_BLOCK, "after write")) return false;
+    // Escrever depois do fim aumenta o arquivo
+    lv_fs_seek(&f, 0, LV_FS_SEEK_END);
+    lv_fs_write(&f, patch, 100, &bw);
+    content.insert(content.end(), patch, patch + 100);
+    if (!check_read(&f, FILE_SIZE - 50, 200, "after append")) return false;
+    lv_fs_close(&f);
+    cases += 3;
+
+    lv_fs_dir_t dir;
+    char fn[LV_FS_MAX_FN_LENGTH];
+    bool listed = false;
+    if (lv_fs_dir_open(&dir, SD_PATH("")) != LV_FS_RES_OK) {
+        printf("MISMATCH can't open S:\n");
+        return false;
+    }
+    while (lv_fs_dir_read(&dir, fn) == LV_FS_RES_OK && fn[0]) listed |= strcmp(fn, "data.bin") == 0;
+    lv_fs_dir_close(&dir);
+    if (!listed) {
+        printf("MISMATCH data.bin not listed\n");
+        return false;
+    }
+    if (lv_fs_open(&f, SD_PATH("missing.bin"), LV_FS_MODE_RD) == LV_FS_RES_OK) {
+        printf("MISMATCH missing.bin opened\n");
+        return false;
+    }
+    cases += 2;
+
+    printf("verified %d cases: same bytes as the file\n", cases);
+    return true;
+}
+
+double card_us(uint32_t reads, uint64_t bytes) {
+    return reads * ACCESS_US + bytes * 8 * 1e6 / CARD_HZ;
+}
+
+typedef void (*pattern_fn)(lv_fs_file_t* f, uint8_t* buf, uint32_t* calls, uint64_t* bytes);
+
+void font(lv_fs_file_t* f, uint8_t* buf, uint32_t* calls, uint64_t* bytes) {
+    uint32_t br;
+    for (uint32_t pos = 0; pos < FILE_SIZE; pos += br, (*calls)++) {
+        lv_fs_read(f, buf, 256, &br);
+        *bytes += br;
+        if (!br) break;
+    }
+}
+
+void image_lines(lv_fs_file_t* f, uint8_t* buf, uint32_t* calls, uint64_t* bytes) {
+    // 320x240 RGB565 com cabeçalho de 4 bytes, como o decoder do LVGL lê de um arquivo
+    for (uint32_t y = 0; y < 240; y++, (*calls)++) {
+        uint32_t br;
+        lv_fs_seek(f, 4 + y * 640, LV_FS_SEEK_SET);
+        lv_fs_read(f, buf, 640, &br);
+        *bytes += br;
+    }
+}
+
+void random_4k(lv_fs_file_t* f, uint8_t* buf, uint32_t* calls, uint64_t* bytes) {
+    for (int i = 0; i < 100; i++, (*calls)++) {
+        uint32_t br;
+        lv_fs_seek(f, rnd() % (FILE_SIZE - 4096), LV_FS_SEEK_SET);
+        lv_fs_read(f, buf, 4096, &br);
+        *bytes += br;
+    }
+}
+
+void measure(const char* name, pattern_fn fn) {
+    static uint8_t buf[4096];
+    lv_fs_file_t f;
+    lv_fs_open(&f, SD_PATH("data.bin"), LV_FS_MODE_RD);
+    SdCard::Stats a = SdCard::stats();
+    uint32_t calls = 0;
+    uint64_t bytes = 0;
+    fn(&f, buf, &calls, &bytes);
+    lv_fs_close(&f);
+    SdCard::Stats b = SdCard::stats();
+
+    uint32_t io = b.io_reads - a.io_reads;
+    uint32_t misses = b.misses - a.misses;
+    uint32_t ahead = b.prefetches - a.prefetches;
+    uint32_t unused = b.prefetch_unused - a.prefetch_unused;
+    uint32_t hits = b.hits - a.hits;
+    uint32_t served = hits + misses + (b.waits - a.waits);
+    uint64_t io_bytes = b.io_bytes - a.io_bytes;
+    // A UI espera as faltas; as leituras adiante correm em paralelo
+    uint64_t blocking_bytes = io_bytes - (uint64_t)ahead * SD_CARD_BLOCK;
+    if ((int64_t)blocking_bytes < 0) blocking_bytes = 0;
+    printf("%-12s %5u lv_fs_read %8.1f KB | card %4u reads (%4u blocking, %4u ahead, %3u unused) %8.1f KB"
+           " | %3u%% hits | UI on card %7.1f ms, uncached %7.1f ms\n",
+           name, (unsigned)calls, bytes / 1024.0, (unsigned)io, (unsigned)(io - ahead), (unsigned)ahead,
+           (unsigned)unused, io_bytes / 1024.0, (unsigned)(served ? hits * 100 / served : 0),
+           card_us(io - ahead, blocking_bytes) / 1000, card_us(calls, bytes) / 1000);
+}
+
+} // namespace
+
+int main() {
+    mkdir(".pio", 0755);
+    mkdir(".pio/host", 0755);
+    mkdir(SD_CARD_MOUNT, 0755);
+    content.resize(FILE_SIZE);
+    for (uint8_t& b : content) b = (uint8_t)rnd();
+    if (!write_file("data.bin", content.data(), content.size())) {
+        printf("can't write %s/data.bin\n", SD_CARD_MOUNT);
+        return 1;
+    }
+
+    lv_init();
+    SdCard::begin();
+    if (!SdCard::mounted()) {
+        printf("%s not mounted\n", SD_CARD_MOUNT);
+        return 1;
+    }
+    if (!verify()) return 1;
+
+    printf("block %u B, %u blocks cached, %u ahead; card model: %.0f MHz, %.0f us per read\n",
+           (unsigned)SD_CARD_BLOCK, (unsigned)SD_CARD_CACHE_BLOCKS, (unsigned)SD_CARD_READAHEAD, CARD_HZ / 1e6,
+           ACCESS_US);
+    measure("font", font);
+    measure("image lines", image_lines);
+    measure("random 4 KB", random_4k);
+    return 0;
+}
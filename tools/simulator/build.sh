@@ -0,0 +1,29 @@
+#!/bin/sh
+# Compila o simulador do PDA para o host (gcc/g++ do sistema): src/main.cpp e
+# todos os apps sobre os shims de tools/host. Gera .pio/host/simulator e, se
+# preciso, o pacote de ícones .pio/host/assets.bin.
+# Uso: tools/simulator/build.sh   (a partir da raiz do projeto)
+set -e
+
+OUT=.pio/host/simulator.obj
+mkdir -p "$OUT"
+
+# -g: para perf/valgrind. tools/host/include primeiro: os shims vencem os de src/
+FLAGS="-O2 -g -DLV_CONF_INCLUDE_SIMPLE -DARDUINOJSON_ENABLE_ARDUINO_STRING=1 -Itools/host/include -Ilib -Ilib/lvgl -Ilib/ArduinoJson/src -Isrc"
+
+# Ícones da partição "assets": só refaz o pacote se algum ícone mudou
+ASSETS=.pio/host/assets.bin
+if [ ! -f "$ASSETS" ] || [ -n "$(find src/Icons tools/icons tools/assets -newer "$ASSETS" | head -n 1)" ]; then
+    python3 tools/assets/pack_assets.py "$ASSETS" > /dev/null
+fi
+
+for f in $(find lib/lvgl/src src/fonts/generated -name '*.c'); do
+    o="$OUT/$(echo "$f" | tr '/.' '__').o"
+    [ "$o" -nt "$f" ] && [ "$o" -nt lib/lv_conf.h ] || cc -c -w $FLAGS "$f" -o "$o"
+done
+
+SRCS="tools/simulator/simulator.cpp src/main.cpp tools/host/arduino_host.cpp tools/host/esp32_host.cpp \
+    src/system/pda_mem.cpp src/system/pda_log.cpp src/system/spi_bus.cpp src/system/tft_scroll.cpp src/system/tft_rgb444.cpp src/system/sd_card.cpp src/input/touch/display_backend.cpp src/input/touch/display_backend_tft_espi.cpp src/system/asset_pack.cpp src/system/pda_trace.cpp src/system/stall_detector.cpp src/system/alloc_trace.cpp \
+    src/input/trackball/trackball.cpp src/utils/utils.cpp"
+c++ -std=gnu++17 $FLAGS $SRCS "$OUT"/*.o -lm -o .pio/host/simulator
+echo "built .pio/host/simulator"
@@ -0,0 +1,354 @@
+/**
+ * Simulador do PDA no host
+ *
+ * Roda o firmware inteiro (src/main.cpp: setup() e loop(), AppManager e todos
+ * os apps) no Linux, com os shims de tools/host:
+ * - Tela: o TFT_eSPI do host guarda o flush num framebuffer em memória.
+ * - Entrada: o traço injeta teclas pelo I2C do teclado (Wire), bordas nos pinos
+ *   do trackball (ISRs do attachInterrupt) e toques no GT911.
+ * - Rede: Wi-Fi falso e HTTPClient respondendo com os arquivos de fixtures/.
+ * - Relógio: delay() não dorme, então o traço roda o mais rápido possível e
+ *   sempre igual (millis() e time() seguem o relógio virtual).
+ *
+ * Traço: uma linha por evento, "<ms> <comando> [args]", com o tempo em ms
+ * desde o boot (o millis() do aparelho). '#' começa um comentário.
+ *   key <c>|enter|backspace|space|clear|0xNN   tecla
+ *   ball up|down|left|right|click              trackball
+ *   touch <x> <y> / release                    dedo na tela / solto
+ *   tap <x> <y>                                toque de 50 ms
+ *   wifi <ssid>|off                            conecta / desconecta
+ *   net <ssid> <rssi> <open|wep|wpa|wpa2|wpa3> rede vista pelo scan
+ *   http <trecho da URL> <código> <arquivo>    resposta HTTP (arquivo relativo ao traço)
+ *   date <AAAA-MM-DDTHH:MM:SS>                 acerta o relógio de parede (UTC)
+ *   shot <nome>                                grava a tela em <saída>/<nome>.ppm
+ * Traços gravados no aparelho (-DINPUT_TRACE_RECORD=1, src/input/input_trace.h)
+ * usam o mesmo formato.
+ *
+ * Para cada entrada, uma linha JSON no stdout:
+ *   lat_ms  - tempo (virtual) até o fim do primeiro quadro desenhado depois dela
+ *   cpu_ms  - tempo real gasto no loop() até esse quadro
+ *   busy_ms - tempo real gasto no loop() até a próxima entrada (animações etc.)
+ *   frames  - quadros desenhados até a próxima entrada
+ * e um resumo no fim. Os logs do firmware vão para o stderr.
+ *
+ * Uso:
+ *   tools/simulator/build.sh
+ *   .pio/host/simulator [--fixtures arquivo.conf] [--out pasta] [--tail ms]
+ *                       [--max-lat-ms N] traço.trace
+ * A saída dos "shot" é .pio/host/simulator_out sem o --out.
+ * Com --max-lat-ms, sai com erro se alguma entrada passar de N ms (regressões).
+ * Para perfilar: perf record .pio/host/simulator traço.trace, ou valgrind.
+ */
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <TFT_eSPI.h>
+#include <TouchDrvGT911.hpp>
+#include <WiFi.h>
+#include <Wire.h>
+#include <esp_partition.h>
+#include <lvgl.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <errno.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "hardware/TDECK_PINS.h"
+#include "input/touch/display_backend.h"
+
+// src/main.cpp
+void setup();
+void loop();
+
+namespace {
+
+struct Event {
+    uint32_t t;
+    std::string line; // Comando e argumentos
+    std::string dir;  // Pasta do arquivo de origem, para os caminhos relativos
+};
+
+// Medição da entrada atual, até a próxima
+struct Input {
+    std::string what;
+    uint32_t t = 0;
+    uint32_t injected_ms = 0;
+    int32_t lat_ms = -1;
+    double cpu_ms = 0;
+    double busy_ms = 0;
+    uint32_t frames = 0;
+};
+
+FILE* out = stdout;
+const char* out_dir = ".pio/host/simulator_out"; // Não o do binário, .pio/host/simulator
+std::vector<Event> events;
+Input current;
+bool has_input = false;
+std::vector<int32_t> latencies;
+double max_cpu_ms = 0;
+uint32_t total_frames = 0;
+int32_t max_lat_allowed = -1;
+bool over_limit = false;
+
+double now_ms() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+std::string dir_of(const std::string& path) {
+    size_t slash = path.rfind('/');
+    return slash == std::string::npos ? "." : path.substr(0, slash);
+}
+
+std::string trim(const std::string& s) {
+    size_t a = s.find_first_not_of(" \t\r\n");
+    if (a == std::string::npos) return "";
+    size_t b = s.find_last_not_of(" \t\r\n");
+    return s.substr(a, b - a + 1);
+}
+
+bool read_file(const std::string& path, std::string& data) {
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+    char buf[4096];
+    size_t n;
+    data.clear();
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) data.append(buf, n);
+    fclose(f);
+    return true;
+}
+
+/**
+ * @brief Lê um traço (com tempo) ou um arquivo de fixtures (sem tempo: tudo em t = 0).
+ */
+bool load(const char* path, bool timed) {
+    std::string text;
+    if (!read_file(path, text)) {
+        fprintf(stderr, "simulator: can't read %s\n", path);
+        return false;
+    }
+    std::string dir = dir_of(path);
+    size_t pos = 0;
+    int line_no = 0;
+    while (pos < text.size()) {
+        size_t end = text.find('\n', pos);
+        if (end == std::string::npos) end = text.size();
+        std::string line = text.substr(pos, end - pos);
+        pos = end + 1;
+        line_no++;
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+        line = trim(line);
+        if (line.empty()) continue;
+
+        uint32_t t = 0;
+        if (timed) {
+            char* rest;
+            t = (uint32_t)strtoul(line.c_str(), &rest, 10);
+            if (rest == line.c_str()) {
+                fprintf(stderr, "simulator: %s:%d: missing time\n", path, line_no);
+                return false;
+            }
+            line = trim(rest);
+        }
+        events.push_back(Event{t, line, dir});
+    }
+    return true;
+}
+
+void finish_input() {
+    if (!has_input) return;
+    fprintf(out,
+            "{\"t\":%u,\"input\":\"%s\",\"lat_ms\":%d,\"cpu_ms\":%.3f,\"busy_ms\":%.3f,\"frames\":%u}\n",
+            current.t, current.what.c_str(), current.lat_ms, current.cpu_ms, current.busy_ms, current.frames);
+    fflush(out);
+    if (current.lat_ms >= 0) latencies.push_back(current.lat_ms);
+    if (max_lat_allowed >= 0 && current.lat_ms > max_lat_allowed) over_limit = true;
+    max_cpu_ms = std::max(max_cpu_ms, current.cpu_ms);
+    has_input = false;
+}
+
+void start_input(const Event& e) {
+    finish_input();
+    current = Input();
+    current.what = e.line;
+    current.t = e.t;
+    current.injected_ms = millis();
+    has_input = true;
+}
+
+// monitor_cb do firmware (SysMonitor), chamado antes da contagem
+void (*firmware_monitor_cb)(lv_disp_drv_t*, uint32_t, uint32_t) = nullptr;
+
+void monitor_cb(lv_disp_drv_t* drv, uint32_t time, uint32_t px) {
+    if (firmware_monitor_cb) firmware_monitor_cb(drv, time, px);
+    total_frames++;
+    if (!has_input) return;
+    current.frames++;
+    if (current.lat_ms < 0) current.lat_ms = (int32_t)(millis() - current.injected_ms);
+}
+
+int parse_key(const char* arg) {
+    if (strcmp(arg, "enter") == 0) return '\r';
+    if (strcmp(arg, "backspace") == 0) return 8;
+    if (strcmp(arg, "space") == 0) return ' ';
+    if (strcmp(arg, "clear") == 0) return 2;
+    if (strncmp(arg, "0x", 2) == 0) return (int)strtol(arg + 2, nullptr, 16);
+    return arg[1] == '\0' ? arg[0] : -1;
+}
+
+wifi_auth_mode_t parse_auth(const char* arg) {
+    if (strcmp(arg, "open") == 0) return WIFI_AUTH_OPEN;
+    if (strcmp(arg, "wep") == 0) return WIFI_AUTH_WEP;
+    if (strcmp(arg, "wpa") == 0) return WIFI_AUTH_WPA_WPA2_PSK;
+    if (strcmp(arg, "wpa3") == 0) return WIFI_AUTH_WPA3_PSK;
+    return WIFI_AUTH_WPA2_PSK;
+}
+
+/**
+ * @brief Executa um comando. Retorna false se ele não existe ou tem argumentos inválidos.
+ */
+bool apply(const Event& e) {
+    char cmd[16] = "", a[128] = "", b[128] = "", c[256] = "";
+    int n = sscanf(e.line.c_str(), "%15s %127s %127s %255s", cmd, a, b, c);
+    if (n < 1) return false;
+
+    if (strcmp(cmd, "key") == 0) {
+        int key = n >= 2 ? parse_key(a) : -1;
+        if (key <= 0) return false;
+        start_input(e);
+        Wire.host_push(TDECK_KEYBOARD_ADDR, (uint8_t)key);
+    } else if (strcmp(cmd, "ball") == 0) {
+        const char* names[] = {"up", "down", "left", "right", "click"};
+        const uint8_t pins[] = {TDECK_TRACKBALL_UP, TDECK_TRACKBALL_DOWN, TDECK_TRACKBALL_LEFT,
+                                TDECK_TRACKBALL_RIGHT, TDECK_TRACKBALL_CLICK};
+        int i = 0;
+        while (i < 5 && strcmp(a, names[i]) != 0) i++;
+        if (n < 2 || i == 5) return false;
+        start_input(e);
+        host_fire_interrupt(pins[i]);
+    } else if (strcmp(cmd, "touch") == 0 || strcmp(cmd, "tap") == 0) {
+        if (n < 3) return false;
+        start_input(e);
+        TouchDrvGT911::host_set_touch(true, (int16_t)atoi(a), (int16_t)atoi(b));
+        if (cmd[1] == 'a') {
+            // Solta depois de 50 ms, sem contar como outra entrada
+            Event release{millis() + 50, "lift", e.dir};
+            auto it = std::upper_bound(events.begin(), events.end(), release,
+                                       [](const Event& x, const Event& y) { return x.t < y.t; });
+            events.insert(it, release);
+        }
+    } else if (strcmp(cmd, "release") == 0) {
+        start_input(e);
+        TouchDrvGT911::host_set_touch(false);
+    } else if (strcmp(cmd, "lift") == 0) {
+        TouchDrvGT911::host_set_touch(false);
+    } else if (strcmp(cmd, "wifi") == 0) {
+        if (n < 2) return false;
+        WiFi.host_set_connected(strcmp(a, "off") == 0 ? nullptr : strdup(a));
+    } else if (strcmp(cmd, "net") == 0) {
+        if (n < 4) return false;
+        WiFi.host_add_network(strdup(a), atoi(b), parse_auth(c));
+    } else if (strcmp(cmd, "http") == 0) {
+        std::string body;
+        if (n < 4 || !read_file(e.dir + "/" + c, body)) return false;
+        HTTPClient::host_route(a, atoi(b), String(body));
+    } else if (strcmp(cmd, "date") == 0) {
+        struct tm tm = {};
+        if (n < 2 || sscanf(a, "%d-%d-%dT%d:%d:%d", &tm.tm_year, &tm.tm_mon, &tm.tm_mday, &tm.tm_hour, &tm.tm_min,
+                            &tm.tm_sec) < 3)
+            return false;
+        tm.tm_year -= 1900;
+        tm.tm_mon -= 1;
+        host_set_epoch(timegm(&tm));
+    } else if (strcmp(cmd, "shot") == 0) {
+        if (n < 2) return false;
+        std::string path = std::string(out_dir) + "/" + a + ".ppm";
+        if (!DisplayBackend::tft.host_write_ppm(path.c_str())) fprintf(stderr, "simulator: can't write %s\n", path.c_str());
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void load_assets() {
+    const char* candidates[] = {".pio/host/assets.bin", ".pio/build/simulator/assets.bin"};
+    for (const char* p : candidates) {
+        if (host_partition_load("assets", p)) return;
+    }
+    fprintf(stderr, "simulator: no assets pack, icons will be missing (tools/simulator/build.sh makes one)\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const char* fixtures = "tools/simulator/fixtures/fixtures.conf";
+    const char* trace = nullptr;
+    uint32_t tail_ms = 3000;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--fixtures") == 0 && i + 1 < argc) fixtures = argv[++i];
+        else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) out_dir = argv[++i];
+        else if (strcmp(argv[i], "--tail") == 0 && i + 1 < argc) tail_ms = (uint32_t)atoi(argv[++i]);
+        else if (strcmp(argv[i], "--max-lat-ms") == 0 && i + 1 < argc) max_lat_allowed = atoi(argv[++i]);
+        else trace = argv[i];
+    }
+    if (!trace) {
+        fprintf(stderr, "usage: %s [--fixtures file.conf] [--out dir] [--tail ms] [--max-lat-ms N] trace.trace\n",
+                argv[0]);
+        return 2;
+    }
+
+    // O ambiente (fixtures) vem antes de tudo; o traço depois, em ordem de tempo
+    if (!load(fixtures, false)) return 2;
+    for (const Event& e : events) {
+        if (!apply(e)) fprintf(stderr, "simulator: bad fixture line: %s\n", e.line.c_str());
+    }
+    events.clear();
+    if (!load(trace, true)) return 2;
+    std::stable_sort(events.begin(), events.end(), [](const Event& x, const Event& y) { return x.t < y.t; });
+    struct stat st;
+    if (mkdir(out_dir, 0755) != 0 && (errno != EEXIST || stat(out_dir, &st) != 0 || !S_ISDIR(st.st_mode))) {
+        fprintf(stderr, "simulator: can't create the output directory %s: %s\n", out_dir,
+                errno == EEXIST ? "not a directory" : strerror(errno));
+        return 2;
+    }
+
+    // Resultados no stdout; os printf do firmware vão para o stderr
+    out = fdopen(dup(STDOUT_FILENO), "w");
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+
+    double wall_start = now_ms();
+    load_assets();
+    setup();
+    firmware_monitor_cb = lv_disp_get_default()->driver->monitor_cb;
+    lv_disp_get_default()->driver->monitor_cb = monitor_cb;
+
+    size_t next = 0;
+    uint32_t end_ms = (events.empty() ? millis() : std::max(millis(), events.back().t)) + tail_ms;
+    while (next < events.size() || millis() < end_ms) {
+        while (next < events.size() && events[next].t <= millis()) {
+            Event e = events[next++];
+            if (!apply(e)) fprintf(stderr, "simulator: bad trace line: %u %s\n", e.t, e.line.c_str());
+            if (!events.empty()) end_ms = std::max(end_ms, events.back().t + tail_ms);
+        }
+        bool waiting_frame = has_input && current.lat_ms < 0;
+        double start = now_ms();
+        loop();
+        double spent = now_ms() - start;
+        if (has_input) current.busy_ms += spent;
+        if (waiting_frame) current.cpu_ms += spent;
+    }
+    finish_input();
+
+    std::sort(latencies.begin(), latencies.end());
+    auto pct = [](double p) { return latencies.empty() ? -1 : latencies[(size_t)(p * (latencies.size() - 1))]; };
+    fprintf(out,
+            "{\"summary\":true,\"inputs\":%u,\"frames\":%u,\"lat_ms_p50\":%d,\"lat_ms_p95\":%d,\"lat_ms_max\":%d,"
+            "\"cpu_ms_max\":%.3f,\"virtual_ms\":%u,\"wall_ms\":%.1f}\n",
+            (unsigned)latencies.size(), total_frames, pct(0.5), pct(0.95), pct(1.0), max_cpu_ms, millis(),
+            now_ms() - wall_start);
+    fflush(out);
+    return over_limit ? 1 : 0;
+}
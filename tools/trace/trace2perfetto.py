@@ -0,0 +1,169 @@
+"""
+Conversor do trace binário do PDA para JSON do Chrome/Perfetto
+
+Lê o fluxo da USB CDC gravado com -DPDA_TRACE=1 (src/system/pda_trace.h),
+separa os quadros de trace do texto do Serial e escreve um JSON no formato
+"Trace Event" que abre em https://ui.perfetto.dev ou chrome://tracing.
+
+- Cada núcleo vira uma linha do tempo (tid 0 e 1).
+- Início/fim viram eventos "B"/"E", instantes "i" e contadores "C".
+- O micros() de 32 bits do aparelho dá a volta a cada ~71 min; o conversor
+  desenrola o relógio de cada núcleo.
+- O texto fora dos quadros (Serial.printf, LV_LOG) vai para o stderr, ou para
+  o arquivo de --log.
+
+Uso:
+  # Direto da porta (precisa do pyserial, que vem com o PlatformIO)
+  python tools/trace/trace2perfetto.py --port /dev/ttyACM0 --seconds 10 -o pda.json
+  # De uma captura crua já gravada (ex: --raw-out de uma execução anterior)
+  python tools/trace/trace2perfetto.py captura.bin -o pda.json
+
+Não depende de bibliotecas externas para converter um arquivo.
+"""
+
+import argparse
+import json
+import struct
+import sys
+import time
+
+SYNC = b"\x00\xa5PT"
+HEADER = len(SYNC) + 3  # sincronismo + tipo + tamanho
+RECORD = struct.Struct("<IHBxi")  # pda_trace_record_t
+
+FRAME_EVENTS = 1
+FRAME_NAME = 2
+FRAME_DROPPED = 3
+
+PHASES = {0: "B", 1: "E", 2: "i", 3: "C"}
+
+
+def read_port(port, seconds, baud):
+    """Lê a porta serial por `seconds` segundos e retorna os bytes crus."""
+    try:
+        import serial
+    except ImportError:
+        sys.exit("pyserial não encontrado: use o Python do PlatformIO ou 'pip install pyserial'")
+    data = bytearray()
+    with serial.Serial(port, baud, timeout=0.1) as s:
+        end = time.time() + seconds
+        while time.time() < end:
+            data += s.read(65536)
+    return bytes(data)
+
+
+def split_stream(data):
+    """Separa (quadros, texto). Quadros com soma errada são tratados como texto."""
+    frames = []
+    text = bytearray()
+    bad = 0
+    pos = 0
+    while True:
+        i = data.find(SYNC, pos)
+        if i < 0 or i + HEADER > len(data):
+            text += data[pos:]
+            break
+        text += data[pos:i]
+        ftype = data[i + 4]
+        length = data[i + 5] | (data[i + 6] << 8)
+        end = i + HEADER + length + 1
+        if end > len(data):
+            text += data[i:]  # Quadro cortado no fim da captura
+            break
+        payload = data[i + HEADER:end - 1]
+        if sum(payload) & 0xFF != data[end - 1]:
+            bad += 1
+            text += data[i:i + len(SYNC)]
+            pos = i + len(SYNC)
+            continue
+        frames.append((ftype, payload))
+        pos = end
+    return frames, bytes(text), bad
+
+
+def convert(frames):
+    """Retorna (lista de eventos do Chrome, estatísticas)."""
+    names = {}
+    pending = []  # Eventos antes dos nomes (o nome pode chegar depois do primeiro evento)
+    last_ts = {}
+    wraps = {}
+    dropped = {}
+    for ftype, payload in frames:
+        if ftype == FRAME_NAME and len(payload) >= 2:
+            names[payload[0] | (payload[1] << 8)] = payload[2:].decode("utf-8", "replace")
+        elif ftype == FRAME_DROPPED and len(payload) == 5:
+            core = payload[0]
+            dropped[core] = dropped.get(core, 0) + struct.unpack_from("<I", payload, 1)[0]
+        elif ftype == FRAME_EVENTS and len(payload) >= 1:
+            core = payload[0]
+            for off in range(1, len(payload) - RECORD.size + 1, RECORD.size):
+                ts, name_id, etype, value = RECORD.unpack_from(payload, off)
+                # Desenrola o micros() de 32 bits
+                prev = last_ts.get(core)
+                if prev is not None and ts < prev and prev - ts > 0x80000000:
+                    wraps[core] = wraps.get(core, 0) + 1
+                last_ts[core] = ts
+                pending.append((core, ts + (wraps.get(core, 0) << 32), name_id, etype, value))
+
+    events = []
+    for core in sorted(set(e[0] for e in pending)):
+        events.append({"name": "thread_name", "ph": "M", "pid": 1, "tid": core,
+                       "args": {"name": "core %d" % core}})
+    events.append({"name": "process_name", "ph": "M", "pid": 1, "args": {"name": "T-Deck PDA"}})
+
+    for core, ts, name_id, etype, value in pending:
+        name = names.get(name_id, "#%d" % name_id)
+        ev = {"name": name, "ph": PHASES.get(etype, "i"), "ts": ts, "pid": 1, "tid": core}
+        if etype == 2:
+            ev["s"] = "t"
+            ev["args"] = {"value": value}
+        elif etype == 3:
+            ev["args"] = {name: value}
+        events.append(ev)
+
+    stats = {"events": len(pending), "names": len(names), "dropped": dropped}
+    return events, stats
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Converte o trace binário do PDA para JSON do Perfetto/Chrome.")
+    ap.add_argument("input", nargs="?", help="captura crua da USB CDC")
+    ap.add_argument("--port", help="lê direto da porta serial (ex: /dev/ttyACM0, COM5)")
+    ap.add_argument("--seconds", type=float, default=10.0, help="duração da captura com --port")
+    ap.add_argument("--baud", type=int, default=115200, help="ignorado pela USB CDC, usado por UARTs")
+    ap.add_argument("--raw-out", help="também grava os bytes crus lidos da porta")
+    ap.add_argument("--log", help="grava o texto do Serial neste arquivo em vez do stderr")
+    ap.add_argument("-o", "--output", default="pda_trace.json", help="JSON de saída")
+    args = ap.parse_args()
+
+    if args.port:
+        data = read_port(args.port, args.seconds, args.baud)
+        if args.raw_out:
+            with open(args.raw_out, "wb") as f:
+                f.write(data)
+    elif args.input:
+        with open(args.input, "rb") as f:
+            data = f.read()
+    else:
+        ap.error("informe um arquivo de captura ou --port")
+
+    frames, text, bad = split_stream(data)
+    if args.log:
+        with open(args.log, "wb") as f:
+            f.write(text)
+    else:
+        sys.stderr.write(text.decode("utf-8", "replace"))
+
+    events, stats = convert(frames)
+    with open(args.output, "w", encoding="utf-8") as f:
+        json.dump({"traceEvents": events, "displayTimeUnit": "ms"}, f)
+
+    print("%s: %d eventos, %d nomes, %d quadros" % (args.output, stats["events"], stats["names"], len(frames)))
+    for core, n in sorted(stats["dropped"].items()):
+        print("aviso: núcleo %d descartou %d eventos (anel cheio; chame PDA_TRACE_DRAIN() mais vezes)" % (core, n))
+    if bad:
+        print("aviso: %d quadros com soma errada foram ignorados" % bad)
+
+
+if __name__ == "__main__":
+    main()